@@ -653,6 +653,20 @@ void cxlib_ostream_release( void ) {
 
 
 
+/*******************************************************************//**
+ * Reset the output stream lock in a child process after fork(). The
+ * forking thread must hold the lock across fork().
+ ***********************************************************************
+ */
+void cxlib_ostream_reset_after_fork( void ) {
+  if( g_context != NULL ) {
+    INIT_CRITICAL_SECTION( &g_context->lock.lock );
+    g_context->recursion--;
+  }
+}
+
+
+
 /*******************************************************************//**
  *
  ***********************************************************************
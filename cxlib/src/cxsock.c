@@ -675,6 +675,45 @@ int64_t cxsend( CXSOCKET *psock, const char *sbuf, size_t lenbuf, int flags ) {
 
 
 
+/*******************************************************************//**
+ * Send multiple buffers with a single system call (gather write.)
+ * At most CXSOCK_IOVEC_MAX buffers are sent.
+ ***********************************************************************
+ */
+int64_t cxsendv( CXSOCKET *psock, const cxiovec_t *iov, int iovcnt, int flags ) {
+  if( iovcnt > CXSOCK_IOVEC_MAX ) {
+    iovcnt = CXSOCK_IOVEC_MAX;
+  }
+#ifdef CXPLAT_WINDOWS_X64
+  WSABUF bufs[ CXSOCK_IOVEC_MAX ];
+  for( int i=0; i<iovcnt; i++ ) {
+    if( iov[i].len > INT_MAX ) {
+      WSASetLastError( WSAENOBUFS );
+      return SOCKET_ERROR;
+    }
+    bufs[i].buf = (CHAR*)iov[i].base;
+    bufs[i].len = (ULONG)iov[i].len;
+  }
+  DWORD n_sent = 0;
+  if( WSASend( psock->s, bufs, (DWORD)iovcnt, &n_sent, (DWORD)flags, NULL, NULL ) == SOCKET_ERROR ) {
+    return SOCKET_ERROR;
+  }
+  return (int64_t)n_sent;
+#else
+  struct iovec bufs[ CXSOCK_IOVEC_MAX ];
+  for( int i=0; i<iovcnt; i++ ) {
+    bufs[i].iov_base = (void*)iov[i].base;
+    bufs[i].iov_len = iov[i].len;
+  }
+  struct msghdr msg = {0};
+  msg.msg_iov = bufs;
+  msg.msg_iovlen = iovcnt;
+  return sendmsg( psock->s, &msg, flags );
+#endif
+}
+
+
+
 /*******************************************************************//**
  * 
  ***********************************************************************
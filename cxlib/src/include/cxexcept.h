@@ -228,6 +228,7 @@ void cxlib_exception_counters( int64_t *nWarning, int64_t *nError, int64_t *nCri
 void cxlib_exception_counters_reset( void );
 void cxlib_ostream_lock( void );
 void cxlib_ostream_release( void );
+void cxlib_ostream_reset_after_fork( void );
 int cxlib_ostream( const char *msg, ... );
 int cxlib_msg_set( const char *filename, int line, const char *msg, ... );
 const char * cxlib_msg_get( const char **filename, int *line );
@@ -160,6 +160,7 @@ __inline static ULONG InterlockedExchange_u32( ULONG volatile * _Target, ULONG _
 #define ATOMIC_SUB_i64(ptr, N)      InterlockedAdd64( ptr, -(N) )
 #define ATOMIC_READ_i64(ptr)        InterlockedCompareExchange64( ptr, 0, 0)
 #define ATOMIC_ASSIGN_i64(ptr, val) InterlockedExchange64( ptr, val )
+#define ATOMIC_CMPXCHG_i64(ptr, expected, desired) (InterlockedCompareExchange64( ptr, desired, expected ) == (expected))
 
 
 
@@ -332,6 +333,7 @@ extern int64_t __TIMED_WAIT_CONDITION_CS( pthread_cond_t *cond, pthread_mutex_t
 #define ATOMIC_SUB_i64(ptr, N)      __CXATOMIC_SUB(ptr, N)
 #define ATOMIC_READ_i64(ptr)        __CXATOMIC_READ(ptr)
 #define ATOMIC_ASSIGN_i64(ptr, val) __CXATOMIC_ASSIGN(ptr, val)
+#define ATOMIC_CMPXCHG_i64(ptr, expected, desired) __sync_bool_compare_and_swap(ptr, expected, desired)
 
 #define ATOMIC_INCREMENT_u64(ptr)   __CXATOMIC_INCREMENT(ptr)
 #define ATOMIC_DECREMENT_u64(ptr)   __CXATOMIC_DECREMENT(ptr)
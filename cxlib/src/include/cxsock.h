@@ -64,6 +64,14 @@ typedef struct s_CXSOCKET {
 } CXSOCKET;
 
 
+#define CXSOCK_IOVEC_MAX 8
+
+typedef struct s_cxiovec_t {
+  const char *base;
+  size_t len;
+} cxiovec_t;
+
+
 struct addrinfo *   cxgetaddrinfo( const char *node, const char *service, int *err );
 struct addrinfo *   cxlowaddr( struct addrinfo *address );
 struct addrinfo *   cxhiaddr( struct addrinfo *address );
@@ -86,6 +94,7 @@ int                 cxaccept( CXSOCKET *paccepted, CXSOCKET *plisten, struct soc
 int                 cxconnect( CXSOCKET *psock, const struct sockaddr *addr, size_t addrlen, int timeout_ms, short *revents );
 int64_t             cxclose( CXSOCKET **psock );
 int64_t             cxsend( CXSOCKET *psock, const char *sbuf, size_t lenbuf, int flags );
+int64_t             cxsendv( CXSOCKET *psock, const cxiovec_t *iov, int iovcnt, int flags );
 int64_t             cxsendall( CXSOCKET *psock, const char *data, int64_t sz, int timeout_ms );
 int64_t             cxrecv( CXSOCKET *psock, char *rbuf, size_t lenbuf, int flags );
 
@@ -31,7 +31,7 @@ import re
 # sysplugin__ADMIN_Subscribe
 #
 ###############################################################################
-def sysplugin__ADMIN_Subscribe( request:pyvgx.PluginRequest, headers:dict, authtoken:str, uri:str, hardsync:int=0, timeout:int=30000):
+def sysplugin__ADMIN_Subscribe( request:pyvgx.PluginRequest, headers:dict, authtoken:str, uri:str, hardsync:int=0, timeout:int=30000, snapshot:int=0):
     """
     ADMIN: Subscribe to provider
     """
@@ -46,7 +46,7 @@ def sysplugin__ADMIN_Subscribe( request:pyvgx.PluginRequest, headers:dict, autht
         host = match.group(1)
         port = int( match.group(2) )
 
-        pyvgx.op.Subscribe( address=(host, port), hardsync=hardsync, timeout=timeout )
+        pyvgx.op.Subscribe( address=(host, port), hardsync=hardsync, timeout=timeout, snapshot=snapshot )
         return { 'action': 'subscribed' }
     except Exception as err:
         return err
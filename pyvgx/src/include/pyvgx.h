@@ -523,6 +523,15 @@ DLL_HIDDEN extern bool _pyvgx_api_enabled;
  */
 DLL_HIDDEN extern bool _auto_arc_timestamps;
 
+/******************************************************************************
+ * Flag indicating whether large native search results returned by plugins
+ * are rendered as JSON with the GIL released. Float fields are formatted
+ * with the GIL held before it is released, the remaining output is produced
+ * while other threads run Python code.
+ ******************************************************************************
+ */
+DLL_HIDDEN extern bool _render_without_gil;
+
 // Some integer and string constants we often need
 DLL_HIDDEN extern PyObject * g_py_zero;
 DLL_HIDDEN extern PyObject * g_py_one;
@@ -793,7 +802,9 @@ __inline static void __pyvgx_reset_vertex_identifier( pyvgx_VertexIdentifier_t *
   const char *select_statement;               \
   int offset;                                 \
   int64_t hits;                               \
-  vgx_sortspec_t sortspec;
+  const char *cursor;                         \
+  vgx_sortspec_t sortspec;                    \
+  int lazy;
 
 
 
@@ -840,6 +851,7 @@ typedef struct __s_neighborhood_query_args {
   vgx_ArcConditionSet_t *collect_arc_condition_set;
   int nest;
   int64_t nested_hits;
+  vgx_ExpandCondition_t expand;
 } __neighborhood_query_args;
 
 
@@ -865,6 +877,7 @@ typedef struct __s_aggregator_query_args {
 typedef struct __s_global_query_args {
   __BASE_QUERY_ARGS
   __QUERY_RESULT_SET_ARGS
+  vgx_PageRankCondition_t *pagerank_condition;
 } __global_query_args;
 
 
@@ -1160,6 +1173,32 @@ typedef struct s_PyVGX_Query {
 
 
 
+/******************************************************************************
+ * PyVGX_SearchResult
+ *
+ * Result list kept in its native form until accessed from Python. Response
+ * renderers can serialize the native result directly.
+ *
+ ******************************************************************************
+ */
+typedef struct s_PyVGX_SearchResult {
+  PyObject_HEAD
+  PyVGX_Graph *py_parent;
+  vgx_Graph_t *parent;
+  vgx_SearchResult_t *search_result;
+  PyObject *py_list;
+  int pins;
+} PyVGX_SearchResult;
+
+
+DLL_HIDDEN extern PyObject * __pyvgx_SearchResult_New( PyVGX_Graph *pygraph, vgx_SearchResult_t **search_result );
+DLL_HIDDEN extern PyObject * __pyvgx_SearchResult_Materialize( PyVGX_SearchResult *py_result );
+DLL_HIDDEN extern const vgx_SearchResult_t * __pyvgx_SearchResult_Native( PyVGX_SearchResult *py_result );
+DLL_HIDDEN extern const vgx_SearchResult_t * __pyvgx_SearchResult_Pin( PyVGX_SearchResult *py_result );
+DLL_HIDDEN extern void __pyvgx_SearchResult_Unpin( PyVGX_SearchResult *py_result );
+
+
+
 /******************************************************************************
  *
  *
@@ -1247,6 +1286,7 @@ DLL_HIDDEN extern PyObject *              __pyvgx_plugin__get_argspec( PyObject
 DLL_HIDDEN extern f_vgx_ServicePluginCall __pyvgx_plugin__get_call( void );
 DLL_HIDDEN extern int                     __pyvgx_plugin__add( const char *plugin_name, vgx_server_plugin_phase phase, PyObject *py_plugin, PyObject *py_bound_graph );
 DLL_HIDDEN extern int                     __pyvgx_plugin__remove( const char *name );
+DLL_HIDDEN extern PyObject *              __pyvgx_plugin__add_native( const char *path, PyObject *py_bound_graph );
 DLL_HIDDEN extern PyObject *              __pyvgx_plugin__get_plugins( bool user, const char *onlyname );
 DLL_HIDDEN extern HTTPStatus              __pyvgx_plugin__map_keyval_to_dict( vgx_KeyVal_t *kv, PyObject *py_dict );
 DLL_HIDDEN extern int                     __pyvgx_plugin__set_dict_keyval( PyObject *py_dict, int64_t __ign, const char *key, int64_t sz_key, const char *value, int64_t sz_value );
@@ -1336,6 +1376,7 @@ PyVGX_DOC_DECLARE( pyvgx_Adjacent__doc__ );
 PyVGX_DOC_DECLARE( pyvgx_Aggregate__doc__ );
 PyVGX_DOC_DECLARE( pyvgx_ArcValue__doc__ );
 PyVGX_DOC_DECLARE( pyvgx_Degree__doc__ );
+PyVGX_DOC_DECLARE( pyvgx_CommonNeighbors__doc__ );
 PyVGX_DOC_DECLARE( pyvgx_Arcs__doc__ );
 PyVGX_DOC_DECLARE( pyvgx_Vertices__doc__ );
 
@@ -1343,6 +1384,7 @@ PyVGX_DOC_DECLARE( pyvgx_Vertices__doc__ );
 
 DLL_HIDDEN extern PyObject * pyvgx_ArcValue( PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames );
 DLL_HIDDEN extern PyObject * pyvgx_Degree( PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames );
+DLL_HIDDEN extern PyObject * pyvgx_CommonNeighbors( PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames );
 
 // OpenNeighborQuery
 DLL_HIDDEN extern PyObject * pyvgx_OpenNeighbor( PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames );
@@ -1375,6 +1417,8 @@ DLL_HIDDEN extern PyObject * pyvgx_Vertices( PyVGX_Graph *pygraph, PyObject *arg
 
 
 DLL_HIDDEN extern int64_t pyvgx_SetVertexProperties( vgx_Vertex_t *vertex_WL, PyObject *py_properties );
+DLL_HIDDEN extern int pyvgx_NewVertexProperty( vgx_Graph_t *graph, const char *name, PyObject *py_value, PyObject *py_virtual, vgx_VertexProperty_t *vertex_property );
+DLL_HIDDEN extern void pyvgx_ClearVertexProperty( vgx_VertexProperty_t *vertex_property );
 DLL_HIDDEN extern PyObject * pyvgx__vertex_keys_and_values( PyVGX_Vertex *pyvertex, bool _keys, bool _values );
 DLL_HIDDEN extern int pyvgx__vertex_contains( PyVGX_Vertex *pyvertex, PyObject *py_key );
 DLL_HIDDEN extern PyObject * PyVGX_Vertex__FromInstance( PyVGX_Graph *pygraph, vgx_Vertex_t *vertex_LCK );
@@ -1392,6 +1436,9 @@ typedef struct s_IPyVGXSearchResult {
   PyObject * (*PyResultList_FromSearchResult)( vgx_SearchResult_t *search_result, bool nested, int64_t nested_hits );
   PyObject * (*PyPredicatorValue_FromArcHead)( const vgx_ArcHead_t *archead );
   PyObject * (*PyDict_FromVertexProperties)( vgx_Vertex_t *vertex );
+  bool (*IsDeferrable)( const vgx_SearchResult_t *search_result, bool nested );
+  vgx_ResponseFieldMap_t * (*NewFieldMap)( const vgx_SearchResult_t *search_result );
+  int (*AddCursorMetas)( PyObject *py_dict, const vgx_SearchResult_t *search_result );
 } IPyVGXSearchResult;
 
 
@@ -1462,6 +1509,7 @@ typedef struct s_IPyVGXBuilder {
 
 typedef struct s_IPyVGXPersist {
   int64_t (*Serialize)( vgx_Graph_t *graph, int timeout_ms, bool force, bool remote );
+  int64_t (*SerializeBackground)( vgx_Graph_t *graph, int timeout_ms, bool remote );
 } IPyVGXPersist;
 
 
@@ -1512,6 +1560,8 @@ DLL_HIDDEN extern PyTypeObject * p_PyVGX_PluginResponseType;
 
 DLL_HIDDEN extern PyTypeObject * p_PyVGX_Query__QueryType;
 
+DLL_HIDDEN extern PyTypeObject * p_PyVGX_SearchResultType;
+
 DLL_HIDDEN extern PyTypeObject * p_PyVGX_System__SystemType;
 DLL_HIDDEN extern PyObject * PyVGX_System_GetNewConstantsDict( void );
 
@@ -1535,6 +1585,8 @@ DLL_HIDDEN extern PyObject * PyVGX_Operation_GetNewConstantsDict( void );
 
 #define PyVGX_Query_CheckExact( op )          Py_IS_TYPE(op, p_PyVGX_Query__QueryType)
 
+#define PyVGX_SearchResult_CheckExact( op )   Py_IS_TYPE(op, p_PyVGX_SearchResultType)
+
 #define PyVGX_Vector_AsComparable( pyvgx_vector ) ((vgx_Comparable_t)((PyVGX_Vector*)pyvgx_vector)->vint)
 #define PyVGX_Vertex_AsComparable( pyvgx_vertex ) ((vgx_Comparable_t)((PyVGX_Vertex*)pyvgx_vertex)->vertex)
 #define PyVGX_PyObject_AsComparable( op )         (PyVGX_Vector_CheckExact( op ) ? PyVGX_Vector_AsComparable( op ) : PyVGX_Vertex_CheckExact( op ) ? PyVGX_Vertex_AsComparable( op ) : NULL)
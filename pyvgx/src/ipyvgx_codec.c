@@ -465,178 +465,150 @@ static PyObject * __json_loads( PyObject *py_json ) {
 
 /******************************************************************************
  *
+ * NATIVE JSON PARSER
+ *
+ * Builds Python objects directly from UTF-8 bytes with the same result as
+ * json.loads(). Strings are scanned eight bytes at a time and arrays of
+ * numbers are consumed in a tight loop. Input the native parser rejects
+ * (syntax errors, invalid UTF-8, nesting deeper than __JSON_PARSE_MAX_DEPTH)
+ * is handed to json.loads() so errors are reported exactly as before.
  *
  ******************************************************************************
  */
-static PyObject * __json_load( const char *bytes, int64_t sz_bytes ) {
-  PyObject *py_obj = NULL;
-  // TODO: Implement this so we don't have to go via a python string
-  PyObject *py_str = PyUnicode_FromStringAndSize( bytes, sz_bytes );
-  if( py_str ) {
-    py_obj = __json_loads( py_str );
-    Py_DECREF( py_str );
-  }
-  return py_obj;
-}
+#define __JSON_PARSE_MAX_DEPTH    512
+
+typedef struct s___json_parser_t {
+  const char *p;
+  const char *end;
+  int depth;
+  char *scratch;
+  int64_t sz_scratch;
+} __json_parser_t;
+
+static PyObject * __json_parse_value( __json_parser_t *P );
+
+#define __JSON_BYTES( b )   ((b) * 0x0101010101010101ULL)
+#define __JSON_HIGH         __JSON_BYTES( 0x80 )
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-static CString_t * __new_cstring( const char *data, int64_t sz, int64_t ucsz, object_allocator_context_t *allocator_context, CString_attr attr, bool allow_oversized ) {
-  CString_t *CSTR__string = NULL;
-
-  // Large string where malloc is allowed
-  if( sz > _VXOBALLOC_CSTRING_MAX_LENGTH && allow_oversized ) {
-    allocator_context = NULL;
-  }
-
-  // Compress?
-  if( sz >= CSTRING_MIN_COMPRESS_SZ ) {
-    attr |= CSTRING_ATTR_COMPRESSED;
-  }
-
-  // Construct CString
-  if( (CSTR__string = CStringNewSizeAttrAlloc( data, (int)sz, (int)ucsz, allocator_context, attr )) == NULL ) {
-    // Failed with allocator context, try without allocator context if allowed
-    if( allocator_context && allow_oversized ) {
-      CSTR__string = CStringNewSizeAttrAlloc( data, (int)sz, (int)ucsz, allocator_context, attr );
-    }
+__inline static void __json_skip_ws( __json_parser_t *P ) {
+  const char *p = P->p;
+  while( p < P->end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t') ) {
+    ++p;
   }
-
-  if( CSTR__string ) {
-    return CSTR__string;
-  }
-
-  // Too large
-  char detail[32] = " ";
-  char *p = detail;
-  if( (attr & CSTRING_ATTR_COMPRESSED) != 0 ) {
-    p = write_chars( p, "compressed " );
-  }
-  if( (attr & CSTRING_ATTR_BYTES) != 0 ) {
-    p = write_chars( p, "bytes " );
-  }
-  write_term( p );
-  BEGIN_PYTHON_INTERPRETER {
-    PyErr_Format( PyExc_Exception, "Internal %svalue too large (max length is %u, got %lld bytes)", detail, _VXOBALLOC_CSTRING_MAX_LENGTH, sz );
-  } END_PYTHON_INTERPRETER;
-  return NULL;
+  P->p = p;
 }
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-static CString_t * __new_cstring_from_pystring( PyObject *py_data, object_allocator_context_t *allocator_context, CString_attr attr, bool allow_oversized ) {
-
-  const char *data;
-  Py_ssize_t sz;
-  Py_ssize_t ucsz;
-
-  if( PyVGX_PyObject_CheckString( py_data ) ) {
-    if( (data = PyVGX_PyObject_AsStringAndSize( py_data, &sz, &ucsz )) == NULL ) {
-      return NULL;
-    }
-  }
-  else if( PyByteArray_CheckExact( py_data ) ) {
-    data = PyByteArray_AS_STRING( py_data );
-    sz = PyByteArray_GET_SIZE( py_data );
-    ucsz = 0;
-  }
-  else {
-    PyErr_SetString( PyExc_TypeError, "string or bytes-like object required" );
-    return NULL;
-  }
-
-  CString_t *CSTR__str;
-  BEGIN_PYVGX_THREADS {
-    CSTR__str = __new_cstring( data, sz, ucsz, allocator_context, attr, allow_oversized );
-  } END_PYVGX_THREADS;
-  return CSTR__str;
+__inline static bool __json_is_digit( char c ) {
+  return c >= '0' && c <= '9';
 }
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-static PyObject * __new_pybytearray_from_cstring( const CString_t *CSTR__string ) {
-  PyObject *py_bytearray = NULL;
-  if( CSTR__string ) {
-    py_bytearray = PyByteArray_FromStringAndSize( CStringValue( CSTR__string ), CStringLength( CSTR__string ) );
+__inline static bool __json_match( __json_parser_t *P, const char *literal, int64_t sz ) {
+  if( P->end - P->p >= sz && memcmp( P->p, literal, sz ) == 0 ) {
+    P->p += sz;
+    return true;
   }
-  return py_bytearray;
+  return false;
 }
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-static PyObject * __new_pybytes_from_cstring( const CString_t *CSTR__string ) {
-  if( CSTR__string == NULL ) {
-    return NULL;
+static char * __json_scratch( __json_parser_t *P, int64_t sz ) {
+  if( sz > P->sz_scratch ) {
+    int64_t n = P->sz_scratch > 0 ? P->sz_scratch : 256;
+    while( n < sz ) {
+      n <<= 1;
+    }
+    char *scratch = realloc( P->scratch, n );
+    if( scratch == NULL ) {
+      PyErr_NoMemory();
+      return NULL;
+    }
+    P->scratch = scratch;
+    P->sz_scratch = n;
   }
-  return  PyBytes_FromStringAndSize( CStringValue( CSTR__string ), CStringLength( CSTR__string ) );
+  return P->scratch;
 }
 
 
 
 /******************************************************************************
- *
- * 
+ * Return pointer to the first byte at or after p that terminates a run of
+ * unescaped string data, i.e. '"', '\\' or a control character. Flag any
+ * non-ASCII bytes in the run.
  *
  ******************************************************************************
  */
-static PyObject * __new_pyunicode_from_cstring( const CString_t *CSTR__string ) {
-  PyObject *py_string = NULL;
-  if( CSTR__string ) {
-    py_string = PyUnicode_FromStringAndSize( CStringValue( CSTR__string ), CStringLength( CSTR__string ) );
+__inline static const char * __json_scan_plain( const char *p, const char *end, bool *nonascii ) {
+  while( end - p >= 8 ) {
+    uint64_t w;
+    memcpy( &w, p, 8 );
+    uint64_t ctl = (w - __JSON_BYTES( 0x20 )) & ~w & __JSON_HIGH;
+    uint64_t q = w ^ __JSON_BYTES( '"' );
+    uint64_t b = w ^ __JSON_BYTES( '\\' );
+    q = (q - __JSON_BYTES( 0x01 )) & ~q & __JSON_HIGH;
+    b = (b - __JSON_BYTES( 0x01 )) & ~b & __JSON_HIGH;
+    if( ctl | q | b ) {
+      break;
+    }
+    if( w & __JSON_HIGH ) {
+      *nonascii = true;
+    }
+    p += 8;
   }
-  return py_string;
+  while( p < end ) {
+    unsigned char c = (unsigned char)*p;
+    if( c == '"' || c == '\\' || c < 0x20 ) {
+      break;
+    }
+    if( c >= 0x80 ) {
+      *nonascii = true;
+    }
+    ++p;
+  }
+  return p;
 }
 
 
 
 /******************************************************************************
- *
+ * Raw UTF-8 encoded surrogates are rejected by json.loads() (the input
+ * cannot be decoded), but escaped strings are decoded with surrogatepass.
  *
  ******************************************************************************
  */
-__inline static int __can_pickle( PyObject *py_object ) {
-  struct _typeobject *tp = py_object->ob_type;
-
-  // NOTE: This is not complete, because we could have nested objects.
-  // Find a better way to bullet-proof things.
-
-  if( tp == p_PyVGX_Graph__GraphType ||
-      tp == p_PyVGX_Vertex__VertexType ||
-      tp == p_PyVGX_Vector__VectorType ||
-      tp == p_PyVGX_Similarity__SimilarityType ||
-      tp == p_PyVGX_Memory__MemoryType
-    )
-  {
-    PyErr_Format( PyExc_ValueError, "Objects of type '%s' cannot be encoded.", py_object->ob_type->tp_name );
-    return 0;
-  }
-  else {
-    return 1;
+__inline static bool __json_has_raw_surrogate( const char *p, const char *end ) {
+  for( --end; p < end; p++ ) {
+    if( (unsigned char)p[0] == 0xED && (unsigned char)p[1] >= 0xA0 ) {
+      return true;
+    }
   }
+  return false;
 }
 
 
@@ -646,21 +618,25 @@ __inline static int __can_pickle( PyObject *py_object ) {
  *
  ******************************************************************************
  */
-static PyObject * __new_keyval( PyObject *py_key, PyObject *py_val, CString_attr *attr ) {
-  PyObject *py_keyval = PyTuple_New( 2 );
-  if( py_keyval ) {
-    PyTuple_SET_ITEM( py_keyval, 0, py_key );
-    Py_INCREF( py_key );
-    PyTuple_SET_ITEM( py_keyval, 1, py_val );
-    Py_INCREF( py_val );
-    PyObject *py_serialized = __pickle_dumps( py_keyval );
-    Py_DECREF( py_keyval );
-    if( py_serialized ) {
-      *attr |= CSTRING_ATTR_KEYVAL;
-      return py_serialized;
+__inline static int __json_hex4( const char *p ) {
+  int v = 0;
+  for( int i=0; i<4; i++ ) {
+    char c = p[i];
+    v <<= 4;
+    if( c >= '0' && c <= '9' ) {
+      v |= c - '0';
+    }
+    else if( c >= 'a' && c <= 'f' ) {
+      v |= c - 'a' + 10;
+    }
+    else if( c >= 'A' && c <= 'F' ) {
+      v |= c - 'A' + 10;
+    }
+    else {
+      return -1;
     }
   }
-  return NULL;
+  return v;
 }
 
 
@@ -670,160 +646,273 @@ static PyObject * __new_keyval( PyObject *py_key, PyObject *py_val, CString_attr
  *
  ******************************************************************************
  */
-static int __encode_bytearray( PyObject *py_key, PyObject *py_bytearray, CString_t **CSTR__encoded_bytearray, object_allocator_context_t *allocator_context, bool allow_oversized ) {
-  if( !PyByteArray_CheckExact( py_bytearray ) ) {
-    return 0;
+__inline static char * __json_put_utf8( char *w, int c ) {
+  if( c < 0x80 ) {
+    *w++ = (char)c;
   }
-
-  CString_attr attr = CSTRING_ATTR_BYTEARRAY;
-
-  PyObject *py_encoded;
-
-  if( py_key ) {
-    py_encoded = __new_keyval( py_key, py_bytearray, &attr );
+  else if( c < 0x800 ) {
+    *w++ = (char)(0xC0 | (c >> 6));
+    *w++ = (char)(0x80 | (c & 0x3F));
   }
-  else {
-    py_encoded = py_bytearray;
-    Py_INCREF( py_encoded );
+  else if( c < 0x10000 ) {
+    *w++ = (char)(0xE0 | (c >> 12));
+    *w++ = (char)(0x80 | ((c >> 6) & 0x3F));
+    *w++ = (char)(0x80 | (c & 0x3F));
   }
-
-  if( py_encoded ) {
-    *CSTR__encoded_bytearray = __new_cstring_from_pystring( py_encoded, allocator_context, attr, allow_oversized );
-    Py_DECREF( py_encoded );
-    if( *CSTR__encoded_bytearray ) {
-      return 1;
-    }
+  else {
+    *w++ = (char)(0xF0 | (c >> 18));
+    *w++ = (char)(0x80 | ((c >> 12) & 0x3F));
+    *w++ = (char)(0x80 | ((c >> 6) & 0x3F));
+    *w++ = (char)(0x80 | (c & 0x3F));
   }
-
-  return -1;
+  return w;
 }
 
 
 
 /******************************************************************************
- *
+ * Parse string. P->p is positioned after the opening quote.
  *
  ******************************************************************************
  */
-static int __encode_string( PyObject *py_key, PyObject *py_string, CString_t **CSTR__encoded_string, object_allocator_context_t *allocator_context, bool allow_oversized ) {
-  if( !PyVGX_PyObject_CheckString( py_string ) ) {
-    return 0;
-  }
-
-  CString_attr attr = CSTRING_ATTR_NONE;
+static PyObject * __json_parse_string( __json_parser_t *P ) {
+  const char *start = P->p;
+  const char *end = P->end;
+  bool nonascii = false;
+  const char *p = __json_scan_plain( start, end, &nonascii );
 
-  // Python object is bytes, set flag
-  if( PyBytes_CheckExact( py_string ) ) {
-    attr |= CSTRING_ATTR_BYTES;
+  if( p >= end ) {
+    return NULL;
   }
 
-  // Encode as keyval
-  PyObject *py_encoded = py_string;
-  if( py_key ) {
-    if( (py_encoded = __new_keyval( py_key, py_string, &attr )) == NULL ) {
-      return -1;
+  // No escapes
+  if( *p == '"' ) {
+    P->p = p + 1;
+    if( nonascii ) {
+      return PyUnicode_DecodeUTF8( start, p - start, NULL );
     }
-  }
-  // No key
-  else {
-    Py_INCREF( py_encoded );
+    PyObject *py_str = PyUnicode_New( p - start, 127 );
+    if( py_str ) {
+      memcpy( PyUnicode_1BYTE_DATA( py_str ), start, p - start );
+    }
+    return py_str;
   }
 
-  // Convert to cstring
-  *CSTR__encoded_string = __new_cstring_from_pystring( py_encoded, allocator_context, attr, allow_oversized );
-  Py_DECREF( py_encoded );
+  // Escaped string, decode into scratch buffer
+  int64_t n = 0;
+  for(;;) {
+    // Copy plain run
+    int64_t sz_run = p - start;
+    if( sz_run > 0 ) {
+      if( nonascii && __json_has_raw_surrogate( start, p ) ) {
+        return NULL;
+      }
+      char *scratch = __json_scratch( P, n + sz_run );
+      if( scratch == NULL ) {
+        return NULL;
+      }
+      memcpy( scratch + n, start, sz_run );
+      n += sz_run;
+    }
 
-  if( *CSTR__encoded_string == NULL ) {
-    return -1;
-  }
+    if( p >= end ) {
+      return NULL;
+    }
 
-  return 1;
+    // End of string
+    if( *p == '"' ) {
+      P->p = p + 1;
+      return PyUnicode_DecodeUTF8( P->scratch, n, "surrogatepass" );
+    }
+
+    // Control character
+    if( *p != '\\' || ++p >= end ) {
+      return NULL;
+    }
+
+    // Escape
+    char *w = __json_scratch( P, n + 8 );
+    if( w == NULL ) {
+      return NULL;
+    }
+    w += n;
+    switch( *p++ ) {
+    case '"':
+      *w++ = '"';
+      break;
+    case '\\':
+      *w++ = '\\';
+      break;
+    case '/':
+      *w++ = '/';
+      break;
+    case 'b':
+      *w++ = '\b';
+      break;
+    case 'f':
+      *w++ = '\f';
+      break;
+    case 'n':
+      *w++ = '\n';
+      break;
+    case 'r':
+      *w++ = '\r';
+      break;
+    case 't':
+      *w++ = '\t';
+      break;
+    case 'u':
+      {
+        int c;
+        if( end - p < 4 || (c = __json_hex4( p )) < 0 ) {
+          return NULL;
+        }
+        p += 4;
+        // Combine surrogate pair
+        if( c >= 0xD800 && c <= 0xDBFF && end - p >= 6 && p[0] == '\\' && p[1] == 'u' ) {
+          int c2 = __json_hex4( p + 2 );
+          if( c2 >= 0xDC00 && c2 <= 0xDFFF ) {
+            c = 0x10000 + (((c - 0xD800) << 10) | (c2 - 0xDC00));
+            p += 6;
+          }
+        }
+        w = __json_put_utf8( w, c );
+      }
+      break;
+    default:
+      return NULL;
+    }
+    n = w - P->scratch;
+
+    // Next plain run
+    start = p;
+    nonascii = false;
+    p = __json_scan_plain( start, end, &nonascii );
+  }
 }
 
 
 
 /******************************************************************************
- *
+ * Parse number with the same grammar as json.loads(). Integers are int and
+ * numbers with fraction or exponent are float.
  *
  ******************************************************************************
  */
-static int __encode_callable( PyObject *py_key, PyObject *py_callable, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
-  if( !PyFunction_Check( py_callable ) ) {
-    return 0;
-  }
+static PyObject * __json_parse_number( __json_parser_t *P ) {
+  const char *s = P->p;
+  const char *p = s;
+  const char *end = P->end;
+  bool real = false;
 
-  if( PyFunction_GetClosure( py_callable ) != NULL ) {
-    PyErr_SetString( PyExc_ValueError, "Functions with closures cannot be encoded" );
-    return -1;
+  if( p < end && *p == '-' ) {
+    ++p;
   }
-
-  CString_attr attr = CSTRING_ATTR_CALLABLE;
-
-  // Extract the code from the function
-  PyObject *py_func_code = PyFunction_GetCode( py_callable ); // borrowed ref.
-  // Extract default parameters from the function
-  PyObject *py_func_defaults = PyFunction_GetDefaults( py_callable ); // borrowed
-  // Extract annotations from the function
-  PyObject *py_func_annotations = PyFunction_GetAnnotations( py_callable ); // borrowed
-
-  // Make sure we can proceed with the serialization
-  if( !(py_func_code && (py_func_defaults == NULL || __can_pickle( py_func_defaults )) && (py_func_annotations == NULL || __can_pickle( py_func_annotations ))) ) {
-    return -1;
+  if( p >= end ) {
+    return NULL;
   }
-
-  PyObject *py_serialized = NULL;
-  // Packed format is always a 3-tuple (code, defaults, annotations)
-  PyObject *py_triple = PyTuple_New( 3 );
-  if( !py_triple ) {
-    return -1;
+  if( *p == '0' ) {
+    ++p;
   }
-  // Marshal function code
-  PyObject *py_bytes = PyMarshal_WriteObjectToString( py_func_code, Py_MARSHAL_VERSION );
-  if( !py_bytes ) {
-    Py_DECREF( py_triple );
-    return -1;
-  }
-
-  // Code in slot 0
-  PyTuple_SET_ITEM( py_triple, 0, py_bytes );
-
-  // Defaults (or None) in slot 1
-  if( !py_func_defaults ) {
-    py_func_defaults = Py_None;
+  else if( *p >= '1' && *p <= '9' ) {
+    while( ++p < end && __json_is_digit( *p ) );
   }
-  Py_INCREF( py_func_defaults );
-  PyTuple_SET_ITEM( py_triple, 1, py_func_defaults );
-
-  // Annotations (or None) in slot 2
-  if( !py_func_annotations ) {
-    py_func_annotations = Py_None;
+  else {
+    return NULL;
   }
-  Py_INCREF( py_func_annotations );
-  PyTuple_SET_ITEM( py_triple, 2, py_func_annotations );
-
-  // Keyval packing
-  if( py_key ) {
-    py_serialized = __new_keyval( py_key, py_triple, &attr );
+  // Fraction
+  if( end - p >= 2 && *p == '.' && __json_is_digit( p[1] ) ) {
+    for( p += 2; p < end && __json_is_digit( *p ); p++ );
+    real = true;
   }
-  else {
-    py_serialized = __pickle_dumps( py_triple );
+  // Exponent
+  if( end - p >= 2 && (*p == 'e' || *p == 'E') ) {
+    const char *x = p + 1;
+    if( *x == '+' || *x == '-' ) {
+      ++x;
+    }
+    if( x < end && __json_is_digit( *x ) ) {
+      for( p = x + 1; p < end && __json_is_digit( *p ); p++ );
+      real = true;
+    }
   }
-  Py_DECREF( py_triple );
 
-  if( py_serialized == NULL ) {
-    return -1;
-  }
+  int64_t sz = p - s;
+  P->p = p;
 
-  // Convert to cstring
-  *CSTR__encoded = __new_cstring_from_pystring( py_serialized, allocator_context, attr, allow_oversized );
-  Py_DECREF( py_serialized );
+  // Small integer
+  if( !real && sz <= 18 ) {
+    const char *d = s;
+    int64_t v = 0;
+    if( *d == '-' ) {
+      ++d;
+    }
+    while( d < p ) {
+      v = v * 10 + (*d++ - '0');
+    }
+    return PyLong_FromLongLong( *s == '-' ? -v : v );
+  }
+
+  // Exact float: up to 15 significant digits scaled by an exact power of ten
+  if( real ) {
+    static const double p10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    const char *d = *s == '-' ? s + 1 : s;
+    int64_t m = 0;
+    int ndigits = 0;
+    int e10 = 0;
+    bool frac = false;
+    for( ; d < p && *d != 'e' && *d != 'E'; d++ ) {
+      if( *d == '.' ) {
+        frac = true;
+        continue;
+      }
+      if( m > 0 || *d != '0' ) {
+        m = m * 10 + (*d - '0');
+        if( ++ndigits > 15 ) {
+          break;
+        }
+      }
+      if( frac ) {
+        --e10;
+      }
+    }
+    if( ndigits <= 15 ) {
+      if( d < p ) {
+        int x = 0;
+        bool xneg = *++d == '-';
+        if( *d == '-' || *d == '+' ) {
+          ++d;
+        }
+        for( ; d < p && x < 1000; d++ ) {
+          x = x * 10 + (*d - '0');
+        }
+        e10 += xneg ? -x : x;
+      }
+      if( e10 >= -22 && e10 <= 22 ) {
+        double x = e10 < 0 ? (double)m / p10[-e10] : (double)m * p10[e10];
+        return PyFloat_FromDouble( *s == '-' ? -x : x );
+      }
+    }
+  }
 
-  if( *CSTR__encoded ) {
-    return 1;
+  // Terminated copy for conversion
+  char buf[64];
+  char *num = buf;
+  if( sz >= (int64_t)sizeof( buf ) && (num = __json_scratch( P, sz + 1 )) == NULL ) {
+    return NULL;
   }
-  else {
-    return -1;
+  memcpy( num, s, sz );
+  num[sz] = '\0';
+
+  if( real ) {
+    double x = PyOS_string_to_double( num, NULL, NULL );
+    if( x == -1.0 && PyErr_Occurred() ) {
+      return NULL;
+    }
+    return PyFloat_FromDouble( x );
   }
+  return PyLong_FromString( num, NULL, 10 );
 }
 
 
@@ -833,37 +922,151 @@ static int __encode_callable( PyObject *py_key, PyObject *py_callable, CString_t
  *
  ******************************************************************************
  */
-static int __encode_pickled( PyObject *py_key, PyObject *py_object, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
-  if( !__can_pickle( py_object ) ) {
-    return 0;
+__inline static bool __json_at_number( const __json_parser_t *P ) {
+  const char *p = P->p;
+  if( p < P->end && *p == '-' ) {
+    ++p;
   }
+  return p < P->end && __json_is_digit( *p );
+}
 
-  CString_attr attr = CSTRING_ATTR_SERIALIZED_TXT;
 
-  PyObject *py_serialized;
 
-  // Keyval packing
-  if( py_key ) {
-    py_serialized = __new_keyval( py_key, py_object, &attr );
+/******************************************************************************
+ * Parse array. P->p is positioned at the opening bracket.
+ *
+ ******************************************************************************
+ */
+static PyObject * __json_parse_array( __json_parser_t *P ) {
+  ++P->p;
+  PyObject *py_list = PyList_New( 0 );
+  if( py_list == NULL ) {
+    return NULL;
   }
-  else {
-    py_serialized = __pickle_dumps( py_object );
+  __json_skip_ws( P );
+  if( P->p < P->end && *P->p == ']' ) {
+    ++P->p;
+    return py_list;
   }
 
-  if( py_serialized == NULL ) {
-    return -1;
+  PyObject *py_item;
+
+  // Numeric array fast path
+  while( __json_at_number( P ) ) {
+    if( (py_item = __json_parse_number( P )) == NULL ) {
+      goto error;
+    }
+    int r = PyList_Append( py_list, py_item );
+    Py_DECREF( py_item );
+    if( r < 0 ) {
+      goto error;
+    }
+    __json_skip_ws( P );
+    if( P->p >= P->end ) {
+      goto error;
+    }
+    if( *P->p == ']' ) {
+      ++P->p;
+      return py_list;
+    }
+    if( *P->p++ != ',' ) {
+      goto error;
+    }
+    __json_skip_ws( P );
+    if( !__json_at_number( P ) ) {
+      break;
+    }
   }
 
-  // Convert to cstring
-  *CSTR__encoded = __new_cstring_from_pystring( py_serialized, allocator_context, attr, allow_oversized );
-  Py_DECREF( py_serialized );
+  // Any values
+  for(;;) {
+    if( (py_item = __json_parse_value( P )) == NULL ) {
+      goto error;
+    }
+    int r = PyList_Append( py_list, py_item );
+    Py_DECREF( py_item );
+    if( r < 0 ) {
+      goto error;
+    }
+    __json_skip_ws( P );
+    if( P->p >= P->end ) {
+      goto error;
+    }
+    if( *P->p == ']' ) {
+      ++P->p;
+      return py_list;
+    }
+    if( *P->p++ != ',' ) {
+      goto error;
+    }
+  }
 
-  if( *CSTR__encoded ) {
-    return 1;
+error:
+  Py_DECREF( py_list );
+  return NULL;
+}
+
+
+
+/******************************************************************************
+ * Parse object. P->p is positioned at the opening brace.
+ *
+ ******************************************************************************
+ */
+static PyObject * __json_parse_object( __json_parser_t *P ) {
+  ++P->p;
+  PyObject *py_dict = PyDict_New();
+  if( py_dict == NULL ) {
+    return NULL;
   }
-  else {
-    return -1;
+  __json_skip_ws( P );
+  if( P->p < P->end && *P->p == '}' ) {
+    ++P->p;
+    return py_dict;
+  }
+
+  for(;;) {
+    __json_skip_ws( P );
+    if( P->p >= P->end || *P->p != '"' ) {
+      goto error;
+    }
+    ++P->p;
+    PyObject *py_key = __json_parse_string( P );
+    if( py_key == NULL ) {
+      goto error;
+    }
+    __json_skip_ws( P );
+    if( P->p >= P->end || *P->p++ != ':' ) {
+      Py_DECREF( py_key );
+      goto error;
+    }
+    PyObject *py_value = __json_parse_value( P );
+    if( py_value == NULL ) {
+      Py_DECREF( py_key );
+      goto error;
+    }
+    int r = PyDict_SetItem( py_dict, py_key, py_value );
+    Py_DECREF( py_key );
+    Py_DECREF( py_value );
+    if( r < 0 ) {
+      goto error;
+    }
+    __json_skip_ws( P );
+    if( P->p >= P->end ) {
+      goto error;
+    }
+    if( *P->p == '}' ) {
+      ++P->p;
+      return py_dict;
+    }
+    if( *P->p++ != ',' ) {
+      goto error;
+    }
   }
+
+error:
+  Py_DECREF( py_dict );
+  return NULL;
 }
 
 
@@ -873,17 +1076,90 @@ static int __encode_pickled( PyObject *py_key, PyObject *py_object, CString_t **
  *
  ******************************************************************************
  */
-__inline static int __set_cstring_qword_int( QWORD *data, int64_t i, PyObject *py_int_value ) {
-  int64_t *p = (int64_t*)data + i;
-  if( PyLong_CheckExact( py_int_value ) ) {
-    if( (*p = PyLong_AsLongLong( py_int_value )) == -1 && PyErr_Occurred() ) {
-      return -1;
+static PyObject * __json_parse_value( __json_parser_t *P ) {
+  __json_skip_ws( P );
+  if( P->p >= P->end ) {
+    return NULL;
+  }
+
+  PyObject *py_obj;
+
+  switch( *P->p ) {
+  case '"':
+    ++P->p;
+    return __json_parse_string( P );
+  case '[':
+  case '{':
+    if( ++P->depth > __JSON_PARSE_MAX_DEPTH ) {
+      return NULL;
     }
-    return 1;
+    py_obj = *P->p == '[' ? __json_parse_array( P ) : __json_parse_object( P );
+    --P->depth;
+    return py_obj;
+  case 'n':
+    if( __json_match( P, "null", 4 ) ) {
+      Py_RETURN_NONE;
+    }
+    return NULL;
+  case 't':
+    if( __json_match( P, "true", 4 ) ) {
+      Py_RETURN_TRUE;
+    }
+    return NULL;
+  case 'f':
+    if( __json_match( P, "false", 5 ) ) {
+      Py_RETURN_FALSE;
+    }
+    return NULL;
+  case 'N':
+    if( __json_match( P, "NaN", 3 ) ) {
+      return PyFloat_FromDouble( Py_NAN );
+    }
+    return NULL;
+  case 'I':
+    if( __json_match( P, "Infinity", 8 ) ) {
+      return PyFloat_FromDouble( Py_HUGE_VAL );
+    }
+    return NULL;
+  case '-':
+    if( __json_match( P, "-Infinity", 9 ) ) {
+      return PyFloat_FromDouble( -Py_HUGE_VAL );
+    }
+    return __json_parse_number( P );
+  default:
+    return __json_parse_number( P );
   }
-  else {
-    return 0;
+}
+
+
+
+/******************************************************************************
+ * Return new object parsed from JSON bytes, or NULL if the native parser
+ * cannot handle the input.
+ *
+ ******************************************************************************
+ */
+static PyObject * __json_parse( const char *bytes, int64_t sz_bytes ) {
+  __json_parser_t P = {
+    .p          = bytes,
+    .end        = bytes + sz_bytes,
+    .depth      = 0,
+    .scratch    = NULL,
+    .sz_scratch = 0
+  };
+
+  PyObject *py_obj = __json_parse_value( &P );
+  if( py_obj ) {
+    __json_skip_ws( &P );
+    // Extra data
+    if( P.p != P.end ) {
+      Py_DECREF( py_obj );
+      py_obj = NULL;
+    }
   }
+
+  free( P.scratch );
+  return py_obj;
 }
 
 
@@ -893,903 +1169,2497 @@ __inline static int __set_cstring_qword_int( QWORD *data, int64_t i, PyObject *p
  *
  ******************************************************************************
  */
-__inline static int __set_cstring_qword_float( QWORD *data, int64_t i, PyObject *py_float_value ) {
-  double *p = (double*)data + i;
-  if( PyFloat_CheckExact( py_float_value ) ) {
-    *p = PyFloat_AS_DOUBLE( py_float_value );
-    return 1;
+static PyObject * __json_load( const char *bytes, int64_t sz_bytes ) {
+  PyObject *py_obj = __json_parse( bytes, sz_bytes );
+  if( py_obj ) {
+    return py_obj;
   }
-  else {
-    return 0;
+  PyErr_Clear();
+
+  // Let json.loads() produce the result or report the error
+  PyObject *py_str = PyUnicode_FromStringAndSize( bytes, sz_bytes );
+  if( py_str ) {
+    py_obj = __json_loads( py_str );
+    Py_DECREF( py_str );
   }
+  return py_obj;
 }
 
 
 
 /******************************************************************************
  *
+ * 
  *
  ******************************************************************************
  */
-__inline static int __encode_num_list( PyObject *py_key, PyObject *py_object, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
-  static const int64_t maxlen = _VXOBALLOC_CSTRING_MAX_LENGTH >> 3;
+static CString_t * __new_cstring( const char *data, int64_t sz, int64_t ucsz, object_allocator_context_t *allocator_context, CString_attr attr, bool allow_oversized ) {
+  CString_t *CSTR__string = NULL;
 
-  int64_t sz = 0;
-  if( PyList_CheckExact( py_object ) ) {
-    sz = PyList_GET_SIZE( py_object );
+  // Large string where malloc is allowed
+  if( sz > _VXOBALLOC_CSTRING_MAX_LENGTH && allow_oversized ) {
+    allocator_context = NULL;
   }
-  else {
-    return 0; // not a list
+
+  // Compress?
+  if( sz >= CSTRING_MIN_COMPRESS_SZ ) {
+    attr |= CSTRING_ATTR_COMPRESSED;
   }
 
-  if( sz > maxlen ) {
-    if( allow_oversized ) {
-      allocator_context = NULL;
-    }
-    else {
-      if( PyNumber_Check( PyList_GET_ITEM( py_object, 0 ) ) ) {
-        PyErr_SetString( PyExc_ValueError, "too many values" );
-        return -1;
-      }
-      else {
-        return 0; // not a numeric list
-      }
+  // Construct CString
+  if( (CSTR__string = CStringNewSizeAttrAlloc( data, (int)sz, (int)ucsz, allocator_context, attr )) == NULL ) {
+    // Failed with allocator context, try without allocator context if allowed
+    if( allocator_context && allow_oversized ) {
+      CSTR__string = CStringNewSizeAttrAlloc( data, (int)sz, (int)ucsz, allocator_context, attr );
     }
   }
 
-  // Construct destination string
-  CString_constructor_args_t string_args = {
-    .string       = NULL,
-    .len          = (int32_t)sz * 8,
-    .ucsz         = 0,
-    .format       = NULL,
-    .format_args  = NULL,
-    .alloc        = allocator_context
-  };
-  CString_t *CSTR__list;
-  if( (CSTR__list = COMLIB_OBJECT_NEW( CString_t, NULL, &string_args )) == NULL ) {
-    PyErr_SetString( PyExc_MemoryError, "internal error" );
-    return -1;
+  if( CSTR__string ) {
+    return CSTR__string;
   }
-  QWORD *qdata = CALLABLE( CSTR__list )->ModifiableQwords( CSTR__list );
-  if( qdata == NULL ) {
-    iString.Discard( &CSTR__list );
-    PyErr_SetString( PyExc_AssertionError, "internal error" );
-    return -1;
+
+  // Too large
+  char detail[32] = " ";
+  char *p = detail;
+  if( (attr & CSTRING_ATTR_COMPRESSED) != 0 ) {
+    p = write_chars( p, "compressed " );
+  }
+  if( (attr & CSTRING_ATTR_BYTES) != 0 ) {
+    p = write_chars( p, "bytes " );
   }
+  write_term( p );
+  BEGIN_PYTHON_INTERPRETER {
+    PyErr_Format( PyExc_Exception, "Internal %svalue too large (max length is %u, got %lld bytes)", detail, _VXOBALLOC_CSTRING_MAX_LENGTH, sz );
+  } END_PYTHON_INTERPRETER;
+  return NULL;
+}
 
-  int is_encoded = 0;
-  CString_attr attr = CSTRING_ATTR_ARRAY_INT;
 
-  PyObject *py_item;
-  if( sz > 0 ) {
-    py_item = PyList_GET_ITEM( py_object, 0 );
-    if( PyFloat_CheckExact( py_item ) ) {
-      attr = CSTRING_ATTR_ARRAY_FLOAT;
-    }
-    else if( !PyLong_CheckExact( py_item ) ) {
-      iString.Discard( &CSTR__list );
-      return 0; // not a list of numbers
-    }
-  }
-
-  XTRY {
-    int r;
-    for( int64_t i=0; i<sz; i++ ) {
-      py_item = PyList_GET_ITEM( py_object, i );
-      if( attr == CSTRING_ATTR_ARRAY_FLOAT ) {
-        r = __set_cstring_qword_float( qdata, i, py_item );
-      }
-      else {
-        r = __set_cstring_qword_int( qdata, i, py_item );
-      }
 
-      // can't be encoded as internal array, or error
-      if( r <= 0 ) {
-        // error
-        if( r < 0 ) {
-          is_encoded = -1;
-        }
-        THROW_SILENT( CXLIB_ERR_GENERAL, 0x001 );
-      }
-    }
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+static CString_t * __new_cstring_from_pystring( PyObject *py_data, object_allocator_context_t *allocator_context, CString_attr attr, bool allow_oversized ) {
 
-    if( py_key == NULL ) {
-      is_encoded = 1;
-      CStringAttributes( CSTR__list ) = attr;
-      /* // Can't compress internal array because vxeval can't decompress on the fly
-      if( CStringLength( CSTR__list ) >= CSTRING_MIN_COMPRESS_SZ ) {
-        CString_t *CSTR__compressed = CALLABLE( CSTR__list )->Compress( CSTR__list, CSTRING_COMPRESS_MODE_LZ4 );
-        if( CSTR__compressed ) {
-          iString.Discard( &CSTR__list );
-          CSTR__list = CSTR__compressed;
-        }
-      }
-      */
-    }
-    else {
-      is_encoded = -1;
-      PyObject *py_tmp = PyBytes_FromStringAndSize( CStringValue( CSTR__list ), CStringLength( CSTR__list ) );
-      iString.Discard( &CSTR__list );
-      if( py_tmp == NULL ) {
-        THROW_ERROR( CXLIB_ERR_MEMORY, 0x002 );
-      }
-      PyObject *py_bytes = __new_keyval( py_key, py_tmp, &attr );
-      Py_DECREF( py_tmp );
-      if( py_bytes == NULL ) {
-        THROW_ERROR( CXLIB_ERR_GENERAL, 0x003 );
-      }
+  const char *data;
+  Py_ssize_t sz;
+  Py_ssize_t ucsz;
 
-      if( (CSTR__list = __new_cstring_from_pystring( py_bytes, allocator_context, attr, allow_oversized )) == NULL ) {
-        THROW_ERROR( CXLIB_ERR_GENERAL, 0x003 );
-      }
-      is_encoded = 1;
+  if( PyVGX_PyObject_CheckString( py_data ) ) {
+    if( (data = PyVGX_PyObject_AsStringAndSize( py_data, &sz, &ucsz )) == NULL ) {
+      return NULL;
     }
-
-    // Return
-    *CSTR__encoded = CSTR__list;
   }
-  XCATCH( errcode ) {
-    iString.Discard( &CSTR__list );
+  else if( PyByteArray_CheckExact( py_data ) ) {
+    data = PyByteArray_AS_STRING( py_data );
+    sz = PyByteArray_GET_SIZE( py_data );
+    ucsz = 0;
   }
-  XFINALLY {
+  else {
+    PyErr_SetString( PyExc_TypeError, "string or bytes-like object required" );
+    return NULL;
   }
 
-  return is_encoded;
+  CString_t *CSTR__str;
+  BEGIN_PYVGX_THREADS {
+    CSTR__str = __new_cstring( data, sz, ucsz, allocator_context, attr, allow_oversized );
+  } END_PYVGX_THREADS;
+  return CSTR__str;
 }
 
 
 
 /******************************************************************************
  *
+ * 
  *
  ******************************************************************************
  */
-__inline static int __encode_num_mapping( PyObject *py_key, PyObject *py_object, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
-  static const uint64_t maxlen = _VXOBALLOC_CSTRING_MAX_LENGTH >> 3;
-
-  if( !PyDict_CheckExact( py_object ) ) {
-    return 0;
+static PyObject * __new_pybytearray_from_cstring( const CString_t *CSTR__string ) {
+  PyObject *py_bytearray = NULL;
+  if( CSTR__string ) {
+    py_bytearray = PyByteArray_FromStringAndSize( CStringValue( CSTR__string ), CStringLength( CSTR__string ) );
   }
+  return py_bytearray;
+}
 
-  // Make sure all items are int:num
-  Py_ssize_t pos = 0;
-  PyObject *py_intkey;
-  PyObject *py_numval;
-  while( PyDict_Next( py_object, &pos, &py_intkey, &py_numval ) ) {
-    if( !PyLong_CheckExact( py_intkey ) || !PyNumber_Check( py_numval ) ) {
-      return 0;
-    }
+
+
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+static PyObject * __new_pybytes_from_cstring( const CString_t *CSTR__string ) {
+  if( CSTR__string == NULL ) {
+    return NULL;
   }
+  return  PyBytes_FromStringAndSize( CStringValue( CSTR__string ), CStringLength( CSTR__string ) );
+}
 
 
-  // Number of mapped values
-  int64_t sz = PyDict_Size( py_object );
 
-  // The hash table must have size power-of-2 so we can apply a simple
-  // bitmask to the hashkey to find the offset.
-  //
-  // We need a memory array larger than the number of mapped elements
-  // in order to avoid too many collisions and linear probes.
-  //
-  // We need one slot at the start to hold map metas in a QWORD
-  //
-  // 
-  //
-  //
-  //
-  //
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+static PyObject * __new_pyunicode_from_cstring( const CString_t *CSTR__string ) {
+  PyObject *py_string = NULL;
+  if( CSTR__string ) {
+    py_string = PyUnicode_FromStringAndSize( CStringValue( CSTR__string ), CStringLength( CSTR__string ) );
+  }
+  return py_string;
+}
 
-  static const double maxfill = 0.66;
 
 
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static int __can_pickle( PyObject *py_object ) {
+  struct _typeobject *tp = py_object->ob_type;
 
-  // Minimum number of cells in hash table to not exceed max fillrate
-  uint64_t hsize_min = (uint64_t)(sz / maxfill) + 1; // at least one cell
+  // NOTE: This is not complete, because we could have nested objects.
+  // Find a better way to bullet-proof things.
 
-  // Next power-of-two
-  uint64_t hsize = ipow2log2( hsize_min );
+  if( tp == p_PyVGX_Graph__GraphType ||
+      tp == p_PyVGX_Vertex__VertexType ||
+      tp == p_PyVGX_Vector__VectorType ||
+      tp == p_PyVGX_Similarity__SimilarityType ||
+      tp == p_PyVGX_Memory__MemoryType
+    )
+  {
+    PyErr_Format( PyExc_ValueError, "Objects of type '%s' cannot be encoded.", py_object->ob_type->tp_name );
+    return 0;
+  }
+  else {
+    return 1;
+  }
+}
 
-  // Total size includes header plus one unused cell at the end
-  uint64_t ncells = hsize + 2;
 
-  if( ncells > maxlen ) {
-    vgx_cstring_array_map_header_t H;
-    uint64_t max_oversized = 1ULL << (8*sizeof( H.mask ));
-    if( allow_oversized && ncells <= max_oversized ) {
-      allocator_context = NULL;
-    }
-    else {
-      PyErr_SetString( PyExc_ValueError, "too many mapped values" );
-      return -1;
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static PyObject * __new_keyval( PyObject *py_key, PyObject *py_val, CString_attr *attr ) {
+  PyObject *py_keyval = PyTuple_New( 2 );
+  if( py_keyval ) {
+    PyTuple_SET_ITEM( py_keyval, 0, py_key );
+    Py_INCREF( py_key );
+    PyTuple_SET_ITEM( py_keyval, 1, py_val );
+    Py_INCREF( py_val );
+    PyObject *py_serialized = __pickle_dumps( py_keyval );
+    Py_DECREF( py_keyval );
+    if( py_serialized ) {
+      *attr |= CSTRING_ATTR_KEYVAL;
+      return py_serialized;
     }
   }
+  return NULL;
+}
 
-  // Construct destination string
-  CString_constructor_args_t string_args = {
-    .string       = NULL,
-    .len          = (int32_t)ncells * 8,
-    .ucsz         = 0,
-    .format       = NULL,
-    .format_args  = NULL,
-    .alloc        = allocator_context
-  };
-  CString_t *CSTR__map;
-  if( (CSTR__map = COMLIB_OBJECT_NEW( CString_t, NULL, &string_args )) == NULL ) {
-    PyErr_SetString( PyExc_MemoryError, "internal error" );
-    return -1;
-  }
-  QWORD *qdata = CALLABLE( CSTR__map )->ModifiableQwords( CSTR__map );
-  if( qdata == NULL ) {
-    iString.Discard( &CSTR__map );
-    PyErr_SetString( PyExc_AssertionError, "internal error" );
-    return -1;
-  }
 
-  // Initialize array header
-  vgx_cstring_array_map_header_t *header = (vgx_cstring_array_map_header_t*)qdata;
-  header->mask = (uint16_t)hsize - 1;
-  header->items = (uint16_t)sz;
-  header->_collisions = 0;
 
-  // Initialize array cells to unoccupied
-  vgx_cstring_array_map_cell_t *htable = (vgx_cstring_array_map_cell_t*)qdata+1; // start of hash table
-  vgx_cstring_array_map_cell_t *cell = htable;
-  vgx_cstring_array_map_cell_t *end = htable + hsize;
-  while( cell < end ) {
-    cell->key = VGX_CSTRING_ARRAY_MAP_KEY_NONE;
-    cell->value = 0.0;
-    ++cell;
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __encode_bytearray( PyObject *py_key, PyObject *py_bytearray, CString_t **CSTR__encoded_bytearray, object_allocator_context_t *allocator_context, bool allow_oversized ) {
+  if( !PyByteArray_CheckExact( py_bytearray ) ) {
+    return 0;
   }
 
-  int is_encoded = 0;
-  CString_attr attr = CSTRING_ATTR_ARRAY_MAP;
+  CString_attr attr = CSTRING_ATTR_BYTEARRAY;
 
-  XTRY {
+  PyObject *py_encoded;
 
-    // Iterate over all items in dict and insert into hashtable
-    pos = 0;
-    while( PyDict_Next( py_object, &pos, &py_intkey, &py_numval ) ) {
-      int ovf;
-      int key = PyLong_AsLongAndOverflow( py_intkey, &ovf );
-      float val = (float)PyFloat_AsDouble( py_numval );
-      if( ovf != 0 ) {
-        THROW_SILENT( CXLIB_ERR_GENERAL, 0x001 );
-      }
-      else if( vgx_cstring_array_map_set( qdata, key, val ) == NULL ) {
-        PyErr_SetString( PyExc_Exception, "mapping space exhausted" );
-        is_encoded = -1;
-        THROW_SILENT( CXLIB_ERR_GENERAL, 0x002 );
-      }
-    }
-
-    if( py_key == NULL ) {
-      is_encoded = 1;
-      CStringAttributes( CSTR__map ) = attr;
-      /* // Can't compress internal map because vxeval can't decompress on the fly
-      if( CStringLength( CSTR__map ) >= CSTRING_MIN_COMPRESS_SZ ) {
-        CString_t *CSTR__compressed = CALLABLE( CSTR__map )->Compress( CSTR__map, CSTRING_COMPRESS_MODE_LZ4 );
-        if( CSTR__compressed ) {
-          iString.Discard( &CSTR__map );
-          CSTR__map = CSTR__compressed;
-        }
-      }
-      */
-    }
-    else {
-      is_encoded = -1;
-      PyObject *py_tmp = PyBytes_FromStringAndSize( CStringValue( CSTR__map ), CStringLength( CSTR__map ) );
-      iString.Discard( &CSTR__map );
-      if( py_tmp == NULL ) {
-        THROW_ERROR( CXLIB_ERR_MEMORY, 0x004 );
-      }
-      PyObject *py_bytes = __new_keyval( py_key, py_tmp, &attr );
-      Py_DECREF( py_tmp );
-      if( py_bytes == NULL ) {
-        THROW_ERROR( CXLIB_ERR_GENERAL, 0x005 );
-      }
-
-      if( (CSTR__map = __new_cstring_from_pystring( py_bytes, allocator_context, attr, allow_oversized )) == NULL ) {
-        THROW_ERROR( CXLIB_ERR_GENERAL, 0x006 );
-      }
-      is_encoded = 1;
-    }
-
-    // Return
-    *CSTR__encoded = CSTR__map;
+  if( py_key ) {
+    py_encoded = __new_keyval( py_key, py_bytearray, &attr );
   }
-  XCATCH( errcode ) {
-    iString.Discard( &CSTR__map );
+  else {
+    py_encoded = py_bytearray;
+    Py_INCREF( py_encoded );
   }
-  XFINALLY {
+
+  if( py_encoded ) {
+    *CSTR__encoded_bytearray = __new_cstring_from_pystring( py_encoded, allocator_context, attr, allow_oversized );
+    Py_DECREF( py_encoded );
+    if( *CSTR__encoded_bytearray ) {
+      return 1;
+    }
   }
 
-  return is_encoded;
+  return -1;
 }
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-static CString_t * _ipyvgx_codec__new_encoded_object_from_pyobject( PyObject *py_key, PyObject *py_object, object_allocator_context_t *allocator_context, bool allow_oversized ) {
-  CString_t *CSTR__encoded = NULL;
-
-  // Bytearray
-  if( __encode_bytearray( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
-    return CSTR__encoded;
-  }
-  // Unicode or Bytes
-  else if( __encode_string( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
-    return CSTR__encoded;
-  }
-  // Python object is a list of numeric objects
-  else if( __encode_num_list( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
-    return CSTR__encoded;
-  }
-  // Python object is a dict mapping integer keys to numeric values
-  else if( __encode_num_mapping( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
-    return CSTR__encoded;
+static int __encode_string( PyObject *py_key, PyObject *py_string, CString_t **CSTR__encoded_string, object_allocator_context_t *allocator_context, bool allow_oversized ) {
+  if( !PyVGX_PyObject_CheckString( py_string ) ) {
+    return 0;
   }
-  // Python object is a function. Marshal it and possibly compress it.
-  else if( __encode_callable( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
-    return CSTR__encoded;
+
+  CString_attr attr = CSTRING_ATTR_NONE;
+
+  // Python object is bytes, set flag
+  if( PyBytes_CheckExact( py_string ) ) {
+    attr |= CSTRING_ATTR_BYTES;
   }
-  // Python object other than function. Pickle it and possibly compress it.
-  else if( __encode_pickled( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
-    return CSTR__encoded;
+
+  // Encode as keyval
+  PyObject *py_encoded = py_string;
+  if( py_key ) {
+    if( (py_encoded = __new_keyval( py_key, py_string, &attr )) == NULL ) {
+      return -1;
+    }
   }
-  // Unsupported object
+  // No key
   else {
-    return NULL;
+    Py_INCREF( py_encoded );
+  }
+
+  // Convert to cstring
+  *CSTR__encoded_string = __new_cstring_from_pystring( py_encoded, allocator_context, attr, allow_oversized );
+  Py_DECREF( py_encoded );
+
+  if( *CSTR__encoded_string == NULL ) {
+    return -1;
   }
+
+  return 1;
 }
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-static PyObject * __decode_callable( PyObject *py_triple ) {
+static int __encode_callable( PyObject *py_key, PyObject *py_callable, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
+  if( !PyFunction_Check( py_callable ) ) {
+    return 0;
+  }
 
-  // Unpickle to get the 3-tuple (code, defaults, annotation)
-  if( py_triple == NULL || !PyTuple_Check( py_triple ) || PyTuple_GET_SIZE( py_triple ) != 3 ) {
-    return NULL;
+  if( PyFunction_GetClosure( py_callable ) != NULL ) {
+    PyErr_SetString( PyExc_ValueError, "Functions with closures cannot be encoded" );
+    return -1;
   }
 
-  PyObject *py_callable = NULL;
+  CString_attr attr = CSTRING_ATTR_CALLABLE;
 
-  PyObject *py_code = NULL;
-  PyObject *py_defaults = NULL;
-  PyObject *py_annotations = NULL;
-  // 0: code
-  // 1: defaults
-  // 2: annotations
-  PyObject *py_code_bytes = PyTuple_GET_ITEM( py_triple, 0 );
-  if( PyBytes_CheckExact( py_code_bytes ) ) {
-    py_code = PyMarshal_ReadObjectFromString( PyBytes_AS_STRING( py_code_bytes ), PyBytes_GET_SIZE( py_code_bytes ) );
+  // Extract the code from the function
+  PyObject *py_func_code = PyFunction_GetCode( py_callable ); // borrowed ref.
+  // Extract default parameters from the function
+  PyObject *py_func_defaults = PyFunction_GetDefaults( py_callable ); // borrowed
+  // Extract annotations from the function
+  PyObject *py_func_annotations = PyFunction_GetAnnotations( py_callable ); // borrowed
+
+  // Make sure we can proceed with the serialization
+  if( !(py_func_code && (py_func_defaults == NULL || __can_pickle( py_func_defaults )) && (py_func_annotations == NULL || __can_pickle( py_func_annotations ))) ) {
+    return -1;
   }
-  py_defaults = PyTuple_GET_ITEM( py_triple, 1 );
-  Py_INCREF( py_defaults );
-  py_annotations = PyTuple_GET_ITEM( py_triple, 2 );
-  Py_INCREF( py_annotations );
 
-  // Create function instance from code, defaults and annotations
-  if( py_code ) {
-    py_callable = __new_function_from_code_object( py_code, py_defaults, py_annotations );
-    Py_DECREF( py_code );
+  PyObject *py_serialized = NULL;
+  // Packed format is always a 3-tuple (code, defaults, annotations)
+  PyObject *py_triple = PyTuple_New( 3 );
+  if( !py_triple ) {
+    return -1;
+  }
+  // Marshal function code
+  PyObject *py_bytes = PyMarshal_WriteObjectToString( py_func_code, Py_MARSHAL_VERSION );
+  if( !py_bytes ) {
+    Py_DECREF( py_triple );
+    return -1;
   }
-  Py_XDECREF( py_defaults );
-  Py_XDECREF( py_annotations );
 
-  return py_callable;
-}
+  // Code in slot 0
+  PyTuple_SET_ITEM( py_triple, 0, py_bytes );
+
+  // Defaults (or None) in slot 1
+  if( !py_func_defaults ) {
+    py_func_defaults = Py_None;
+  }
+  Py_INCREF( py_func_defaults );
+  PyTuple_SET_ITEM( py_triple, 1, py_func_defaults );
+
+  // Annotations (or None) in slot 2
+  if( !py_func_annotations ) {
+    py_func_annotations = Py_None;
+  }
+  Py_INCREF( py_func_annotations );
+  PyTuple_SET_ITEM( py_triple, 2, py_func_annotations );
+
+  // Keyval packing
+  if( py_key ) {
+    py_serialized = __new_keyval( py_key, py_triple, &attr );
+  }
+  else {
+    py_serialized = __pickle_dumps( py_triple );
+  }
+  Py_DECREF( py_triple );
+
+  if( py_serialized == NULL ) {
+    return -1;
+  }
 
+  // Convert to cstring
+  *CSTR__encoded = __new_cstring_from_pystring( py_serialized, allocator_context, attr, allow_oversized );
+  Py_DECREF( py_serialized );
 
+  if( *CSTR__encoded ) {
+    return 1;
+  }
+  else {
+    return -1;
+  }
+}
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-static PyObject * _ipyvgx_codec__new_pyobject_from_encoded_object( const CString_t *CSTR__encoded, PyObject **py_retkey ) {
-  char PALIGNED_ decomp_buffer[ARCH_PAGE_SIZE];
-
-  if( CSTR__encoded == NULL ) {
-    return NULL;
+static int __encode_pickled( PyObject *py_key, PyObject *py_object, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
+  if( !__can_pickle( py_object ) ) {
+    return 0;
   }
 
-  PyObject *py_object = NULL;
-    
-  const char *data = CStringValue( CSTR__encoded );
-  int32_t len = CStringLength( CSTR__encoded );
-  int32_t uclen = CStringCodepoints( CSTR__encoded );
-  CString_attr attr = CStringAttributes( CSTR__encoded );
+  CString_attr attr = CSTRING_ATTR_SERIALIZED_TXT;
 
-  PyObject *py_key = NULL;
-  PyObject *py_bytes = NULL;
-  PyObject *py_exc = NULL;
-  const char *serr = NULL;
+  PyObject *py_serialized;
 
-  char *decompressed = NULL;
-  Py_ssize_t sz = 0;
+  // Keyval packing
+  if( py_key ) {
+    py_serialized = __new_keyval( py_key, py_object, &attr );
+  }
+  else {
+    py_serialized = __pickle_dumps( py_object );
+  }
 
-  bool keyval = false;
+  if( py_serialized == NULL ) {
+    return -1;
+  }
 
-  XTRY {
+  // Convert to cstring
+  *CSTR__encoded = __new_cstring_from_pystring( py_serialized, allocator_context, attr, allow_oversized );
+  Py_DECREF( py_serialized );
 
-    // If compressed, decompress it first
-    if( (attr & CSTRING_ATTR_COMPRESSED) ) {
-      int r;
-      BEGIN_PYVGX_THREADS {
-        int32_t csz = len;
-        r = CStringDecompressBytesToBytes( data, csz, decomp_buffer, ARCH_PAGE_SIZE, &decompressed, &len, &uclen, &attr );
-      } END_PYVGX_THREADS;
-      if( r < 0 ) {
-        py_exc = PyExc_MemoryError;
-        serr = "decompress error";
-        THROW_SILENT( CXLIB_ERR_MEMORY, 0x001 );
-      }
-      data = decompressed;
+  if( *CSTR__encoded ) {
+    return 1;
+  }
+  else {
+    return -1;
+  }
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static int __set_cstring_qword_int( QWORD *data, int64_t i, PyObject *py_int_value ) {
+  int64_t *p = (int64_t*)data + i;
+  if( PyLong_CheckExact( py_int_value ) ) {
+    if( (*p = PyLong_AsLongLong( py_int_value )) == -1 && PyErr_Occurred() ) {
+      return -1;
     }
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
 
-    // Unpack keyval
-    if( (attr & CSTRING_ATTR_KEYVAL) ) {
-      attr ^= CSTRING_ATTR_KEYVAL; // remove keyval bit
-      keyval = true;
 
-      // We need a PyBytes object to unpickle
-      if( (py_bytes = PyBytes_FromStringAndSize( data, len )) == NULL ) {
-        THROW_SILENT( CXLIB_ERR_GENERAL, 0x002 );
-      }
 
-      // Unpickle to get the tuple (key, val)
-      PyObject *py_tuple = __pickle_loads( py_bytes );
-      Py_DECREF( py_bytes );
-      if( py_tuple == NULL || !PyTuple_Check( py_tuple ) || PyTuple_GET_SIZE( py_tuple ) != 2 ) {
-        if( !PyErr_Occurred() ) {
-          py_exc = PyExc_Exception;
-          serr = "bad internal keyval encoding";
-        }
-        Py_XDECREF( py_tuple );
-        THROW_SILENT( CXLIB_ERR_GENERAL, 0x003 );
-      }
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static int __set_cstring_qword_float( QWORD *data, int64_t i, PyObject *py_float_value ) {
+  double *p = (double*)data + i;
+  if( PyFloat_CheckExact( py_float_value ) ) {
+    *p = PyFloat_AS_DOUBLE( py_float_value );
+    return 1;
+  }
+  else {
+    return 0;
+  }
+}
 
-      // Own the key
-      py_key = PyTuple_GET_ITEM( py_tuple, 0 );
-      Py_INCREF( py_key );
 
-      // Own the value
-      py_bytes = PyTuple_GET_ITEM( py_tuple, 1 );
-      Py_INCREF( py_bytes );
 
-      // We don't know what's inside py_bytes
-      data = NULL;
-      len = 0;
-      uclen = 0;
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static int __encode_num_list( PyObject *py_key, PyObject *py_object, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
+  static const int64_t maxlen = _VXOBALLOC_CSTRING_MAX_LENGTH >> 3;
 
-      // Discard the tuple
-      Py_DECREF( py_tuple );
-    }
+  int64_t sz = 0;
+  if( PyList_CheckExact( py_object ) ) {
+    sz = PyList_GET_SIZE( py_object );
+  }
+  else {
+    return 0; // not a list
+  }
 
-    switch( attr ) {
-    case CSTRING_ATTR_NONE:
-      if( data ) {
-        py_object = PyUnicode_FromStringAndSize( data, len );
-      }
-      else if( (py_object = py_bytes) != NULL ) {
-        if( PyUnicode_Check( py_object ) ) {
-          py_bytes = NULL; // stolen
-        }
-        else {
-          py_object = PyUnicode_FromEncodedObject( py_bytes, "utf-8", NULL ); 
-        }
+  if( sz > maxlen ) {
+    if( allow_oversized ) {
+      allocator_context = NULL;
+    }
+    else {
+      if( PyNumber_Check( PyList_GET_ITEM( py_object, 0 ) ) ) {
+        PyErr_SetString( PyExc_ValueError, "too many values" );
+        return -1;
       }
-      break;
-    case CSTRING_ATTR_SERIALIZED_TXT:
-      // We need PyBytes to unpickle
-      if( data ) {
-        py_bytes = PyBytes_FromStringAndSize( data, len );
+      else {
+        return 0; // not a numeric list
       }
-      if( py_bytes ) {
-        if( keyval ) {
-          py_object = py_bytes; // already unpickled, steal
-          py_bytes = NULL;
-        }
-        else {
-          py_object = __pickle_loads( py_bytes );
-        }
+    }
+  }
+
+  // Construct destination string
+  CString_constructor_args_t string_args = {
+    .string       = NULL,
+    .len          = (int32_t)sz * 8,
+    .ucsz         = 0,
+    .format       = NULL,
+    .format_args  = NULL,
+    .alloc        = allocator_context
+  };
+  CString_t *CSTR__list;
+  if( (CSTR__list = COMLIB_OBJECT_NEW( CString_t, NULL, &string_args )) == NULL ) {
+    PyErr_SetString( PyExc_MemoryError, "internal error" );
+    return -1;
+  }
+  QWORD *qdata = CALLABLE( CSTR__list )->ModifiableQwords( CSTR__list );
+  if( qdata == NULL ) {
+    iString.Discard( &CSTR__list );
+    PyErr_SetString( PyExc_AssertionError, "internal error" );
+    return -1;
+  }
+
+  int is_encoded = 0;
+  CString_attr attr = CSTRING_ATTR_ARRAY_INT;
+
+  PyObject *py_item;
+  if( sz > 0 ) {
+    py_item = PyList_GET_ITEM( py_object, 0 );
+    if( PyFloat_CheckExact( py_item ) ) {
+      attr = CSTRING_ATTR_ARRAY_FLOAT;
+    }
+    else if( !PyLong_CheckExact( py_item ) ) {
+      iString.Discard( &CSTR__list );
+      return 0; // not a list of numbers
+    }
+  }
+
+  XTRY {
+    int r;
+    for( int64_t i=0; i<sz; i++ ) {
+      py_item = PyList_GET_ITEM( py_object, i );
+      if( attr == CSTRING_ATTR_ARRAY_FLOAT ) {
+        r = __set_cstring_qword_float( qdata, i, py_item );
       }
-      break;
-    case CSTRING_ATTR_BYTES:
-      if( data ) {
-        py_object = PyBytes_FromStringAndSize( data, len );
+      else {
+        r = __set_cstring_qword_int( qdata, i, py_item );
       }
-      else if( (py_object = py_bytes) != NULL ) {
-        if( PyBytes_CheckExact( py_object ) ) {
-          py_bytes = NULL; // stolen
-        }
-        else {
-          py_object = PyBytes_FromObject( py_bytes );
+
+      // can't be encoded as internal array, or error
+      if( r <= 0 ) {
+        // error
+        if( r < 0 ) {
+          is_encoded = -1;
         }
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x001 );
       }
-      break;
-    case CSTRING_ATTR_BYTEARRAY:
-      if( data ) {
-        py_object = PyByteArray_FromStringAndSize( data, len );
+    }
+
+    if( py_key == NULL ) {
+      is_encoded = 1;
+      CStringAttributes( CSTR__list ) = attr;
+      /* // Can't compress internal array because vxeval can't decompress on the fly
+      if( CStringLength( CSTR__list ) >= CSTRING_MIN_COMPRESS_SZ ) {
+        CString_t *CSTR__compressed = CALLABLE( CSTR__list )->Compress( CSTR__list, CSTRING_COMPRESS_MODE_LZ4 );
+        if( CSTR__compressed ) {
+          iString.Discard( &CSTR__list );
+          CSTR__list = CSTR__compressed;
+        }
       }
-      else if( (py_object = py_bytes) != NULL ) {
-        py_bytes = NULL; // stolen
+      */
+    }
+    else {
+      is_encoded = -1;
+      PyObject *py_tmp = PyBytes_FromStringAndSize( CStringValue( CSTR__list ), CStringLength( CSTR__list ) );
+      iString.Discard( &CSTR__list );
+      if( py_tmp == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x002 );
       }
-      break;
-    case CSTRING_ATTR_CALLABLE:
+      PyObject *py_bytes = __new_keyval( py_key, py_tmp, &attr );
+      Py_DECREF( py_tmp );
       if( py_bytes == NULL ) {
-        py_bytes = PyBytes_FromStringAndSize( data, len );
-      }
-      if( py_bytes ) {
-        PyObject *py_triple;
-        if( keyval ) {
-          py_triple = py_bytes; // already unpickled, steal
-          py_bytes = NULL;
-        }
-        else {
-          py_triple = __pickle_loads( py_bytes );
-        }
-        if( py_triple ) {
-          py_object = __decode_callable( py_triple );
-          Py_DECREF( py_triple );
-        }
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x003 );
       }
-      break;
-    case CSTRING_ATTR_ARRAY_INT:
-    case CSTRING_ATTR_ARRAY_FLOAT:
-    case CSTRING_ATTR_ARRAY_MAP:
-      if( py_bytes ) {
-        if( PyBytes_AsStringAndSize( py_bytes, (char**)&data, &sz ) < 0 ) {
-          THROW_SILENT( CXLIB_ERR_GENERAL, 0x004 );
-        }
-        len = (int)sz;
+
+      if( (CSTR__list = __new_cstring_from_pystring( py_bytes, allocator_context, attr, allow_oversized )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x003 );
       }
-      if( data ) {
-        if( attr == CSTRING_ATTR_ARRAY_INT ) {
-          py_object = iPyVGXBuilder.NumberListFromBytes( data, len, false );
-        }
-        else if( attr == CSTRING_ATTR_ARRAY_FLOAT ) {
+      is_encoded = 1;
+    }
+
+    // Return
+    *CSTR__encoded = CSTR__list;
+  }
+  XCATCH( errcode ) {
+    iString.Discard( &CSTR__list );
+  }
+  XFINALLY {
+  }
+
+  return is_encoded;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static int __encode_num_mapping( PyObject *py_key, PyObject *py_object, CString_t **CSTR__encoded, object_allocator_context_t *allocator_context, bool allow_oversized ) {
+  static const uint64_t maxlen = _VXOBALLOC_CSTRING_MAX_LENGTH >> 3;
+
+  if( !PyDict_CheckExact( py_object ) ) {
+    return 0;
+  }
+
+  // Make sure all items are int:num
+  Py_ssize_t pos = 0;
+  PyObject *py_intkey;
+  PyObject *py_numval;
+  while( PyDict_Next( py_object, &pos, &py_intkey, &py_numval ) ) {
+    if( !PyLong_CheckExact( py_intkey ) || !PyNumber_Check( py_numval ) ) {
+      return 0;
+    }
+  }
+
+
+  // Number of mapped values
+  int64_t sz = PyDict_Size( py_object );
+
+  // The hash table must have size power-of-2 so we can apply a simple
+  // bitmask to the hashkey to find the offset.
+  //
+  // We need a memory array larger than the number of mapped elements
+  // in order to avoid too many collisions and linear probes.
+  //
+  // We need one slot at the start to hold map metas in a QWORD
+  //
+  // 
+  //
+  //
+  //
+  //
+
+  static const double maxfill = 0.66;
+
+
+
+  // Minimum number of cells in hash table to not exceed max fillrate
+  uint64_t hsize_min = (uint64_t)(sz / maxfill) + 1; // at least one cell
+
+  // Next power-of-two
+  uint64_t hsize = ipow2log2( hsize_min );
+
+  // Total size includes header plus one unused cell at the end
+  uint64_t ncells = hsize + 2;
+
+  if( ncells > maxlen ) {
+    vgx_cstring_array_map_header_t H;
+    uint64_t max_oversized = 1ULL << (8*sizeof( H.mask ));
+    if( allow_oversized && ncells <= max_oversized ) {
+      allocator_context = NULL;
+    }
+    else {
+      PyErr_SetString( PyExc_ValueError, "too many mapped values" );
+      return -1;
+    }
+  }
+
+  // Construct destination string
+  CString_constructor_args_t string_args = {
+    .string       = NULL,
+    .len          = (int32_t)ncells * 8,
+    .ucsz         = 0,
+    .format       = NULL,
+    .format_args  = NULL,
+    .alloc        = allocator_context
+  };
+  CString_t *CSTR__map;
+  if( (CSTR__map = COMLIB_OBJECT_NEW( CString_t, NULL, &string_args )) == NULL ) {
+    PyErr_SetString( PyExc_MemoryError, "internal error" );
+    return -1;
+  }
+  QWORD *qdata = CALLABLE( CSTR__map )->ModifiableQwords( CSTR__map );
+  if( qdata == NULL ) {
+    iString.Discard( &CSTR__map );
+    PyErr_SetString( PyExc_AssertionError, "internal error" );
+    return -1;
+  }
+
+  // Initialize array header
+  vgx_cstring_array_map_header_t *header = (vgx_cstring_array_map_header_t*)qdata;
+  header->mask = (uint16_t)hsize - 1;
+  header->items = (uint16_t)sz;
+  header->_collisions = 0;
+
+  // Initialize array cells to unoccupied
+  vgx_cstring_array_map_cell_t *htable = (vgx_cstring_array_map_cell_t*)qdata+1; // start of hash table
+  vgx_cstring_array_map_cell_t *cell = htable;
+  vgx_cstring_array_map_cell_t *end = htable + hsize;
+  while( cell < end ) {
+    cell->key = VGX_CSTRING_ARRAY_MAP_KEY_NONE;
+    cell->value = 0.0;
+    ++cell;
+  }
+
+  int is_encoded = 0;
+  CString_attr attr = CSTRING_ATTR_ARRAY_MAP;
+
+  XTRY {
+
+    // Iterate over all items in dict and insert into hashtable
+    pos = 0;
+    while( PyDict_Next( py_object, &pos, &py_intkey, &py_numval ) ) {
+      int ovf;
+      int key = PyLong_AsLongAndOverflow( py_intkey, &ovf );
+      float val = (float)PyFloat_AsDouble( py_numval );
+      if( ovf != 0 ) {
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x001 );
+      }
+      else if( vgx_cstring_array_map_set( qdata, key, val ) == NULL ) {
+        PyErr_SetString( PyExc_Exception, "mapping space exhausted" );
+        is_encoded = -1;
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x002 );
+      }
+    }
+
+    if( py_key == NULL ) {
+      is_encoded = 1;
+      CStringAttributes( CSTR__map ) = attr;
+      /* // Can't compress internal map because vxeval can't decompress on the fly
+      if( CStringLength( CSTR__map ) >= CSTRING_MIN_COMPRESS_SZ ) {
+        CString_t *CSTR__compressed = CALLABLE( CSTR__map )->Compress( CSTR__map, CSTRING_COMPRESS_MODE_LZ4 );
+        if( CSTR__compressed ) {
+          iString.Discard( &CSTR__map );
+          CSTR__map = CSTR__compressed;
+        }
+      }
+      */
+    }
+    else {
+      is_encoded = -1;
+      PyObject *py_tmp = PyBytes_FromStringAndSize( CStringValue( CSTR__map ), CStringLength( CSTR__map ) );
+      iString.Discard( &CSTR__map );
+      if( py_tmp == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x004 );
+      }
+      PyObject *py_bytes = __new_keyval( py_key, py_tmp, &attr );
+      Py_DECREF( py_tmp );
+      if( py_bytes == NULL ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x005 );
+      }
+
+      if( (CSTR__map = __new_cstring_from_pystring( py_bytes, allocator_context, attr, allow_oversized )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x006 );
+      }
+      is_encoded = 1;
+    }
+
+    // Return
+    *CSTR__encoded = CSTR__map;
+  }
+  XCATCH( errcode ) {
+    iString.Discard( &CSTR__map );
+  }
+  XFINALLY {
+  }
+
+  return is_encoded;
+}
+
+
+
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+static CString_t * _ipyvgx_codec__new_encoded_object_from_pyobject( PyObject *py_key, PyObject *py_object, object_allocator_context_t *allocator_context, bool allow_oversized ) {
+  CString_t *CSTR__encoded = NULL;
+
+  // Bytearray
+  if( __encode_bytearray( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
+    return CSTR__encoded;
+  }
+  // Unicode or Bytes
+  else if( __encode_string( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
+    return CSTR__encoded;
+  }
+  // Python object is a list of numeric objects
+  else if( __encode_num_list( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
+    return CSTR__encoded;
+  }
+  // Python object is a dict mapping integer keys to numeric values
+  else if( __encode_num_mapping( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
+    return CSTR__encoded;
+  }
+  // Python object is a function. Marshal it and possibly compress it.
+  else if( __encode_callable( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
+    return CSTR__encoded;
+  }
+  // Python object other than function. Pickle it and possibly compress it.
+  else if( __encode_pickled( py_key, py_object, &CSTR__encoded, allocator_context, allow_oversized ) ) {
+    return CSTR__encoded;
+  }
+  // Unsupported object
+  else {
+    return NULL;
+  }
+}
+
+
+
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+static PyObject * __decode_callable( PyObject *py_triple ) {
+
+  // Unpickle to get the 3-tuple (code, defaults, annotation)
+  if( py_triple == NULL || !PyTuple_Check( py_triple ) || PyTuple_GET_SIZE( py_triple ) != 3 ) {
+    return NULL;
+  }
+
+  PyObject *py_callable = NULL;
+
+  PyObject *py_code = NULL;
+  PyObject *py_defaults = NULL;
+  PyObject *py_annotations = NULL;
+  // 0: code
+  // 1: defaults
+  // 2: annotations
+  PyObject *py_code_bytes = PyTuple_GET_ITEM( py_triple, 0 );
+  if( PyBytes_CheckExact( py_code_bytes ) ) {
+    py_code = PyMarshal_ReadObjectFromString( PyBytes_AS_STRING( py_code_bytes ), PyBytes_GET_SIZE( py_code_bytes ) );
+  }
+  py_defaults = PyTuple_GET_ITEM( py_triple, 1 );
+  Py_INCREF( py_defaults );
+  py_annotations = PyTuple_GET_ITEM( py_triple, 2 );
+  Py_INCREF( py_annotations );
+
+  // Create function instance from code, defaults and annotations
+  if( py_code ) {
+    py_callable = __new_function_from_code_object( py_code, py_defaults, py_annotations );
+    Py_DECREF( py_code );
+  }
+  Py_XDECREF( py_defaults );
+  Py_XDECREF( py_annotations );
+
+  return py_callable;
+}
+
+
+
+
+
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+static PyObject * _ipyvgx_codec__new_pyobject_from_encoded_object( const CString_t *CSTR__encoded, PyObject **py_retkey ) {
+  char PALIGNED_ decomp_buffer[ARCH_PAGE_SIZE];
+
+  if( CSTR__encoded == NULL ) {
+    return NULL;
+  }
+
+  PyObject *py_object = NULL;
+    
+  const char *data = CStringValue( CSTR__encoded );
+  int32_t len = CStringLength( CSTR__encoded );
+  int32_t uclen = CStringCodepoints( CSTR__encoded );
+  CString_attr attr = CStringAttributes( CSTR__encoded );
+
+  PyObject *py_key = NULL;
+  PyObject *py_bytes = NULL;
+  PyObject *py_exc = NULL;
+  const char *serr = NULL;
+
+  char *decompressed = NULL;
+  Py_ssize_t sz = 0;
+
+  bool keyval = false;
+
+  XTRY {
+
+    // If compressed, decompress it first
+    if( (attr & CSTRING_ATTR_COMPRESSED) ) {
+      int r;
+      BEGIN_PYVGX_THREADS {
+        int32_t csz = len;
+        r = CStringDecompressBytesToBytes( data, csz, decomp_buffer, ARCH_PAGE_SIZE, &decompressed, &len, &uclen, &attr );
+      } END_PYVGX_THREADS;
+      if( r < 0 ) {
+        py_exc = PyExc_MemoryError;
+        serr = "decompress error";
+        THROW_SILENT( CXLIB_ERR_MEMORY, 0x001 );
+      }
+      data = decompressed;
+    }
+
+    // Unpack keyval
+    if( (attr & CSTRING_ATTR_KEYVAL) ) {
+      attr ^= CSTRING_ATTR_KEYVAL; // remove keyval bit
+      keyval = true;
+
+      // We need a PyBytes object to unpickle
+      if( (py_bytes = PyBytes_FromStringAndSize( data, len )) == NULL ) {
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x002 );
+      }
+
+      // Unpickle to get the tuple (key, val)
+      PyObject *py_tuple = __pickle_loads( py_bytes );
+      Py_DECREF( py_bytes );
+      if( py_tuple == NULL || !PyTuple_Check( py_tuple ) || PyTuple_GET_SIZE( py_tuple ) != 2 ) {
+        if( !PyErr_Occurred() ) {
+          py_exc = PyExc_Exception;
+          serr = "bad internal keyval encoding";
+        }
+        Py_XDECREF( py_tuple );
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x003 );
+      }
+
+      // Own the key
+      py_key = PyTuple_GET_ITEM( py_tuple, 0 );
+      Py_INCREF( py_key );
+
+      // Own the value
+      py_bytes = PyTuple_GET_ITEM( py_tuple, 1 );
+      Py_INCREF( py_bytes );
+
+      // We don't know what's inside py_bytes
+      data = NULL;
+      len = 0;
+      uclen = 0;
+
+      // Discard the tuple
+      Py_DECREF( py_tuple );
+    }
+
+    switch( attr ) {
+    case CSTRING_ATTR_NONE:
+      if( data ) {
+        py_object = PyUnicode_FromStringAndSize( data, len );
+      }
+      else if( (py_object = py_bytes) != NULL ) {
+        if( PyUnicode_Check( py_object ) ) {
+          py_bytes = NULL; // stolen
+        }
+        else {
+          py_object = PyUnicode_FromEncodedObject( py_bytes, "utf-8", NULL ); 
+        }
+      }
+      break;
+    case CSTRING_ATTR_SERIALIZED_TXT:
+      // We need PyBytes to unpickle
+      if( data ) {
+        py_bytes = PyBytes_FromStringAndSize( data, len );
+      }
+      if( py_bytes ) {
+        if( keyval ) {
+          py_object = py_bytes; // already unpickled, steal
+          py_bytes = NULL;
+        }
+        else {
+          py_object = __pickle_loads( py_bytes );
+        }
+      }
+      break;
+    case CSTRING_ATTR_BYTES:
+      if( data ) {
+        py_object = PyBytes_FromStringAndSize( data, len );
+      }
+      else if( (py_object = py_bytes) != NULL ) {
+        if( PyBytes_CheckExact( py_object ) ) {
+          py_bytes = NULL; // stolen
+        }
+        else {
+          py_object = PyBytes_FromObject( py_bytes );
+        }
+      }
+      break;
+    case CSTRING_ATTR_BYTEARRAY:
+      if( data ) {
+        py_object = PyByteArray_FromStringAndSize( data, len );
+      }
+      else if( (py_object = py_bytes) != NULL ) {
+        py_bytes = NULL; // stolen
+      }
+      break;
+    case CSTRING_ATTR_CALLABLE:
+      if( py_bytes == NULL ) {
+        py_bytes = PyBytes_FromStringAndSize( data, len );
+      }
+      if( py_bytes ) {
+        PyObject *py_triple;
+        if( keyval ) {
+          py_triple = py_bytes; // already unpickled, steal
+          py_bytes = NULL;
+        }
+        else {
+          py_triple = __pickle_loads( py_bytes );
+        }
+        if( py_triple ) {
+          py_object = __decode_callable( py_triple );
+          Py_DECREF( py_triple );
+        }
+      }
+      break;
+    case CSTRING_ATTR_ARRAY_INT:
+    case CSTRING_ATTR_ARRAY_FLOAT:
+    case CSTRING_ATTR_ARRAY_MAP:
+      if( py_bytes ) {
+        if( PyBytes_AsStringAndSize( py_bytes, (char**)&data, &sz ) < 0 ) {
+          THROW_SILENT( CXLIB_ERR_GENERAL, 0x004 );
+        }
+        len = (int)sz;
+      }
+      if( data ) {
+        if( attr == CSTRING_ATTR_ARRAY_INT ) {
+          py_object = iPyVGXBuilder.NumberListFromBytes( data, len, false );
+        }
+        else if( attr == CSTRING_ATTR_ARRAY_FLOAT ) {
           py_object = iPyVGXBuilder.NumberListFromBytes( data, len, true );
         }
-        else {
-          py_object = iPyVGXBuilder.NumberMapFromBytes( data );
+        else {
+          py_object = iPyVGXBuilder.NumberMapFromBytes( data );
+        }
+      }
+      break;
+    default:
+      break;
+    }
+
+    if( !py_object ) {
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0x005 );
+    }
+
+    if( py_object && py_retkey ) {
+      *py_retkey = py_key; // steal for return
+      py_key = NULL;
+    }
+
+  }
+  XCATCH( errcode ) {
+    if( !PyErr_Occurred() ) {
+      if( py_exc && serr ) {
+        PyErr_SetString( py_exc, serr );
+      }
+      else {
+        PyErr_SetString( PyExc_Exception, "unknown decoder error" );
+      }
+    }
+
+    Py_XDECREF( py_object );
+    py_object = NULL;
+  }
+  XFINALLY {
+    if( decompressed && decompressed != decomp_buffer ) {
+      ALIGNED_FREE( decompressed );
+    }
+    Py_XDECREF( py_key );
+    Py_XDECREF( py_bytes );
+  }
+
+  return py_object;
+}
+
+
+
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+static PyObject * ORIG_ipyvgx_codec__new_pyobject_from_encoded_object( const CString_t *CSTR__encoded, PyObject **py_retkey ) {
+  char PALIGNED_ decomp_buffer[ARCH_PAGE_SIZE];
+
+  if( CSTR__encoded == NULL ) {
+    return NULL;
+  }
+    
+  CString_attr attr = CStringAttributes( CSTR__encoded );
+
+  PyObject *py_key = NULL;
+  PyObject *py_bytes = NULL;
+
+  // If compressed, decompress it first
+  bool compressed = false;
+  if( attr & CSTRING_ATTR_COMPRESSED ) {
+    attr ^= CSTRING_ATTR_COMPRESSED; // remove compressed bit
+    compressed = true;
+
+    char *rdata;
+    int rsz;
+    int rucsz;
+    CString_attr rattr;
+    int r;
+    BEGIN_PYVGX_THREADS {
+      r = CALLABLE( CSTR__encoded )->DecompressToBytes( CSTR__encoded, decomp_buffer, ARCH_PAGE_SIZE, &rdata, &rsz, &rucsz, &rattr );
+    } END_PYVGX_THREADS;
+    if( r < 0 ) {
+      PyErr_SetString( PyExc_MemoryError, "decompress error" );
+      return NULL;
+    }
+
+    py_bytes = PyBytes_FromStringAndSize( rdata, rsz );
+    if( rdata != decomp_buffer ) {
+      ALIGNED_FREE( rdata );
+    }
+    if( py_bytes == NULL ) {
+      return NULL;
+    }
+  }
+
+  // Unpack keyval
+  bool keyval = false;
+  if( attr & CSTRING_ATTR_KEYVAL ) {
+    attr ^= CSTRING_ATTR_KEYVAL; // remove keyval bit
+    keyval = true;
+    // Convert cstring to bytes if we didn't decompress above
+    if( py_bytes == NULL ) {
+      if( (py_bytes = __new_pybytes_from_cstring( CSTR__encoded )) == NULL ) {
+        return NULL;
+      }
+    }
+    // Unpickle to get the tuple (key, val)
+    PyObject *py_tuple = __pickle_loads( py_bytes );
+    Py_DECREF( py_bytes );
+    if( py_tuple == NULL || !PyTuple_Check( py_tuple ) || PyTuple_GET_SIZE( py_tuple ) != 2 ) {
+      if( !PyErr_Occurred() ) {
+        PyErr_SetString( PyExc_Exception, "bad internal encoding" );
+      }
+      Py_XDECREF( py_tuple );
+      return NULL;
+    }
+
+    py_key = PyTuple_GET_ITEM( py_tuple, 0 );
+    Py_INCREF( py_key );
+
+    py_bytes = PyTuple_GET_ITEM( py_tuple, 1 );
+    Py_INCREF( py_bytes );
+
+    Py_DECREF( py_tuple );
+  }
+
+  // Data was compressed and/or a keyval pair, create a new cstring for further processing
+  CString_t *CSTR__bytes = NULL;
+  if( py_bytes && ( (attr & CSTRING_ATTR_BYTEARRAY) || (attr & __CSTRING_ATTR_ARRAY_MASK) ) ) {
+    CSTR__bytes = __new_cstring_from_pystring( py_bytes, NULL, attr, true );
+    Py_DECREF( py_bytes );
+    py_bytes = NULL;
+    if( (CSTR__encoded = CSTR__bytes) == NULL ) {
+      Py_XDECREF( py_key );
+      return NULL;
+    }
+  }
+
+  PyObject *py_object = NULL;
+
+  // Bytearray
+  if( attr & CSTRING_ATTR_BYTEARRAY ) {
+    py_object = __new_pybytearray_from_cstring( CSTR__encoded );
+  }
+  // Bytes
+  else if( attr == CSTRING_ATTR_BYTES ) {
+    if( py_bytes ) {
+      if( PyBytes_CheckExact( py_bytes ) ) {
+        py_object = py_bytes; // already bytes, steal
+        py_bytes = NULL;
+      }
+      else {
+        py_object = PyBytes_FromObject( py_bytes );
+      }
+    }
+    else {
+      py_object = __new_pybytes_from_cstring( CSTR__encoded );
+    }
+  }
+  // Unicode string
+  else if( attr == CSTRING_ATTR_NONE ) {
+    if( py_bytes ) {
+      if( PyUnicode_Check( py_bytes ) ) {
+        py_object = py_bytes; // already unicode, steal
+        py_bytes = NULL;
+      }
+      else {
+        py_object = PyUnicode_FromEncodedObject( py_bytes, "utf-8", NULL ); 
+      }
+    }
+    else {
+      py_object = __new_pyunicode_from_cstring( CSTR__encoded );
+    }
+  }
+  // Encoded array or map
+  else if( attr & __CSTRING_ATTR_ARRAY_MASK ) {
+    switch( attr & __CSTRING_ATTR_ARRAY_MASK ) {
+    case CSTRING_ATTR_ARRAY_INT:
+    case CSTRING_ATTR_ARRAY_FLOAT:
+      py_object = iPyVGXBuilder.NumberListFromCString( CSTR__encoded );
+      break;
+    case CSTRING_ATTR_ARRAY_MAP:
+      py_object = iPyVGXBuilder.NumberMapFromCString( CSTR__encoded );
+      break;
+    }
+  }
+  // Callable
+  else if( attr & CSTRING_ATTR_CALLABLE ) {
+    // Convert cstring to bytes if we didn't already do so because of compression and/or keyval packing
+    if( py_bytes == NULL ) {
+      py_bytes = __new_pybytes_from_cstring( CSTR__encoded );
+    }
+    if( py_bytes ) {
+      PyObject *py_triple;
+      if( keyval ) {
+        py_triple = py_bytes; // already unpickled, steal
+        py_bytes = NULL;
+      }
+      else {
+        py_triple = __pickle_loads( py_bytes );
+      }
+      // Unpickle to get the 3-tuple (code, defaults, annotation)
+      if( py_triple && PyTuple_Check( py_triple ) && PyTuple_GET_SIZE( py_triple ) == 3 ) {
+        PyObject *py_code = NULL;
+        PyObject *py_defaults = NULL;
+        PyObject *py_annotations = NULL;
+        // 0: code
+        // 1: defaults
+        // 2: annotations
+        PyObject *py_code_bytes = PyTuple_GET_ITEM( py_triple, 0 );
+        if( PyBytes_CheckExact( py_code_bytes ) ) {
+          py_code = PyMarshal_ReadObjectFromString( PyBytes_AS_STRING( py_code_bytes ), PyBytes_GET_SIZE( py_code_bytes ) );
+        }
+        py_defaults = PyTuple_GET_ITEM( py_triple, 1 );
+        Py_INCREF( py_defaults );
+        py_annotations = PyTuple_GET_ITEM( py_triple, 2 );
+        Py_INCREF( py_annotations );
+        Py_XDECREF( py_triple );
+
+        // Create function instance from code, defaults and annotations
+        if( py_code ) {
+          py_object = __new_function_from_code_object( py_code, py_defaults, py_annotations );
+          Py_DECREF( py_code );
         }
+        Py_XDECREF( py_defaults );
+        Py_XDECREF( py_annotations );
+      }
+    }
+  }
+  else if( attr & CSTRING_ATTR_SERIALIZED_TXT ) {
+    // Convert cstring to bytes if we didn't already do so because of compression and/or keyval packing
+    if( py_bytes == NULL ) {
+      py_bytes = __new_pybytes_from_cstring( CSTR__encoded );
+    }
+    if( py_bytes ) {
+      if( keyval ) {
+        py_object = py_bytes; // already unpickled, steal
+        py_bytes = NULL;
+      }
+      else {
+        py_object = __pickle_loads( py_bytes );
+      }
+    }
+  }
+
+  iString.Discard( &CSTR__bytes );
+
+  if( py_object && py_retkey ) {
+    *py_retkey = py_key;
+    py_key = NULL;
+  }
+  Py_XDECREF( py_key );
+  Py_XDECREF( py_bytes );
+
+  return py_object;
+}
+
+
+
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+__inline static bool _ipyvgx_codec__is_cstring_compressible( const CString_t *CSTR__string ) {
+  return CALLABLE( CSTR__string )->Length( CSTR__string ) >= CSTRING_MIN_COMPRESS_SZ;
+}
+
+
+
+/******************************************************************************
+ *
+ * 
+ *
+ ******************************************************************************
+ */
+__inline static bool _ipyvgx_codec__is_pystring_compressible( PyObject *py_string ) {
+  // Bytes
+  if( PyBytes_CheckExact( py_string ) ) {
+    return PyBytes_GET_SIZE( py_string ) >= CSTRING_MIN_COMPRESS_SZ;
+  }
+  // Unicode
+  if( PyUnicode_Check( py_string ) ) {
+    Py_ssize_t sz = 0;
+    PyUnicode_AsUTF8AndSize( py_string, &sz );
+    return sz >= CSTRING_MIN_COMPRESS_SZ;
+  }
+  // Not a string
+  return false;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static PyObject * _ipyvgx_codec__new_compressed_pybytes_from_pyobject( PyObject *py_object ) {
+  PyObject *s = __marshal_dumps( py_object );
+  if( s == NULL ) {
+    return NULL;
+  }
+
+  if( !PyBytes_Check( s ) ) {
+    PyErr_SetString( PyExc_Exception, "internal error" );
+    return NULL;
+  }
+  
+  int64_t sz = PyBytes_GET_SIZE( s );
+  const char *data = PyBytes_AS_STRING( s );
+  
+  CString_t *CSTR__compressed;
+  BEGIN_PYVGX_THREADS {
+    CSTR__compressed = CStringNewCompressedAlloc( data, (int)sz, 0, NULL, CSTRING_ATTR_NONE, CSTRING_COMPRESS_MODE_LZ4 );
+  } END_PYVGX_THREADS;
+
+  if( !CSTR__compressed ) {
+    PyErr_SetNone( PyExc_MemoryError );
+    return NULL;
+  }
+
+  PyObject *py_bytes = PyBytes_FromStringAndSize( CStringValue( CSTR__compressed ), CStringLength( CSTR__compressed ) );
+
+  CStringDelete( CSTR__compressed );
+
+  return py_bytes;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static PyObject * _ipyvgx_codec__new_pyobject_from_compressed_pybytes( PyObject *py_bytes ) {
+  char PALIGNED_ decomp_buffer[ARCH_PAGE_SIZE];
+
+  if( !PyBytes_Check( py_bytes ) ) {
+    PyErr_SetString( PyExc_TypeError, "bytes required" );
+    return NULL;
+  }
+
+  int64_t sz = PyBytes_GET_SIZE( py_bytes );
+  const char *data = PyBytes_AS_STRING( py_bytes );
+
+  const char *marshalled;
+  char *decompressed = NULL;
+  int32_t len = 0;
+  int32_t uclen = 0;
+  CString_attr attr = CSTRING_ATTR_NONE;
+  if( CStringCharsNotCompressed( data, sz ) ) {
+    marshalled = data;
+    len = (int)sz;
+  }
+  else {
+    int cret;
+    BEGIN_PYVGX_THREADS {
+      cret = CStringDecompressBytesToBytes( data, (int)sz, decomp_buffer, ARCH_PAGE_SIZE, &decompressed, &len, &uclen, &attr );
+    } END_PYVGX_THREADS;
+    if( cret < 0 ) {
+      PyErr_SetString( PyExc_Exception, "internal decompression error" );
+      return NULL;
+    }
+    marshalled = decompressed;
+  }
+
+  PyObject *py_marshalled_bytes = PyBytes_FromStringAndSize( marshalled, len );
+
+  if( decompressed && decompressed != decomp_buffer ) {
+    ALIGNED_FREE( decompressed );
+  }
+
+  if( py_marshalled_bytes == NULL ) {
+    return py_marshalled_bytes;
+  }
+
+  PyObject *py_obj = __marshal_loads( py_marshalled_bytes );
+
+  Py_DECREF( py_marshalled_bytes );
+
+  return py_obj;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static bool _ipyvgx_codec__is_type_json( const PyObject *py_type ) {
+  return py_type == mod_json;
+}
+
+
+
+/******************************************************************************
+ * 
+ *
+ ******************************************************************************
+ */
+static int __render_bytes( const char *data, int64_t sz_data, vgx_StreamBuffer_t *output ) {
+  if( iStreamBuffer.Write( output, data, sz_data ) < 0 ) {
+    PyErr_SetString( PyExc_MemoryError, "out of memory" );
+    return -1;
+  }
+  return 0;
+}
+
+
+
+/******************************************************************************
+ * 
+ *
+ ******************************************************************************
+ */
+static int __render_pyunicode( PyObject *py_obj, vgx_StreamBuffer_t *output ) {
+  Py_ssize_t sz_data = 0;
+  const char *data = PyUnicode_AsUTF8AndSize( py_obj, &sz_data );
+  if( data ) {
+    return __render_bytes( data, sz_data, output );
+  }
+  PyErr_Clear();
+  PyObject *py_fallback = PyObject_Repr( py_obj );
+  if( py_fallback == NULL ) {
+    return -1;
+  }
+  int ret;
+  if( (data = PyUnicode_AsUTF8AndSize( py_fallback, &sz_data )) == NULL ) {
+    ret = -1;
+  }
+  else {
+    ret = __render_bytes( data, sz_data, output );
+  }
+  Py_DECREF( py_fallback );
+  return ret;
+}
+
+
+
+/******************************************************************************
+ *
+ * NATIVE JSON ENCODER
+ *
+ * Renders exact dict, list, tuple, str, int, float, bool and None objects
+ * directly into the output stream. Output is byte-identical to json.dumps()
+ * with default arguments. Objects are validated before anything is written
+ * since partial output cannot be rolled back. Objects containing other types,
+ * or nested deeper than __JSON_MAX_DEPTH, are left to json.dumps().
+ *
+ ******************************************************************************
+ */
+#define __JSON_MAX_DEPTH    256
+#define __JSON_CHUNK_SZ     8192
+#define __JSON_REPR_SZ      32
+#define __JSON_NOGIL_MIN_ENTRIES  64
+
+typedef char __json_repr_t[ __JSON_REPR_SZ ];
+
+typedef struct s___json_writer_t {
+  vgx_StreamBuffer_t *output;
+  bool nogil;   // no Python API calls allowed, caller reports errors
+  const vgx_ResponseFieldData_t *fields;  // search result list when nogil
+  const __json_repr_t *reprs;             // float field reprs by list position when nogil
+  char *wp;
+  char *end;
+  char chunk[ __JSON_CHUNK_SZ ];
+} __json_writer_t;
+
+static const char __json_hexdigits[] = "0123456789abcdef";
+
+static int __json_write_value( __json_writer_t *W, PyObject *py_obj );
+static bool __json_search_result_encodable( const vgx_SearchResult_t *search_result );
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static bool __json_is_scalar_type( const PyObject *py_obj ) {
+  const PyTypeObject *type = Py_TYPE( py_obj );
+  return type == &PyUnicode_Type
+      || type == &PyLong_Type
+      || type == &PyFloat_Type
+      || type == &PyBool_Type
+      || py_obj == Py_None;
+}
+
+
+
+/******************************************************************************
+ * Return true if object can be rendered by the native encoder
+ *
+ ******************************************************************************
+ */
+static bool __json_encodable( PyObject *py_obj, int depth ) {
+  if( __json_is_scalar_type( py_obj ) ) {
+#if PY_VERSION_HEX < 0x030C0000
+    if( PyUnicode_CheckExact( py_obj ) && PyUnicode_READY( py_obj ) < 0 ) {
+      PyErr_Clear();
+      return false;
+    }
+#endif
+    return true;
+  }
+
+  // Search result not yet materialized is rendered from native data if possible
+  if( PyVGX_SearchResult_CheckExact( py_obj ) ) {
+    PyVGX_SearchResult *py_result = (PyVGX_SearchResult*)py_obj;
+    const vgx_SearchResult_t *search_result = __pyvgx_SearchResult_Native( py_result );
+    if( search_result && __json_search_result_encodable( search_result ) ) {
+      return true;
+    }
+    PyObject *py_list = __pyvgx_SearchResult_Materialize( py_result );
+    if( py_list == NULL ) {
+      PyErr_Clear();
+      return false;
+    }
+    return __json_encodable( py_list, depth );
+  }
+
+  if( ++depth > __JSON_MAX_DEPTH ) {
+    return false;
+  }
+
+  // list / tuple
+  if( PyList_CheckExact( py_obj ) || PyTuple_CheckExact( py_obj ) ) {
+    Py_ssize_t sz = PySequence_Fast_GET_SIZE( py_obj );
+    PyObject **items = PySequence_Fast_ITEMS( py_obj );
+    for( Py_ssize_t i=0; i<sz; i++ ) {
+      if( !__json_encodable( items[i], depth ) ) {
+        return false;
       }
-      break;
-    default:
-      break;
     }
+    return true;
+  }
 
-    if( !py_object ) {
-      THROW_SILENT( CXLIB_ERR_GENERAL, 0x005 );
+  // dict
+  if( PyDict_CheckExact( py_obj ) ) {
+    Py_ssize_t pos = 0;
+    PyObject *py_key;
+    PyObject *py_value;
+    while( PyDict_Next( py_obj, &pos, &py_key, &py_value ) ) {
+      if( !__json_is_scalar_type( py_key ) || !__json_encodable( py_key, depth ) || !__json_encodable( py_value, depth ) ) {
+        return false;
+      }
     }
+    return true;
+  }
 
-    if( py_object && py_retkey ) {
-      *py_retkey = py_key; // steal for return
-      py_key = NULL;
+  return false;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_output( __json_writer_t *W, const char *data, int64_t sz ) {
+  if( W->nogil ) {
+    return iStreamBuffer.Write( W->output, data, sz ) < 0 ? -1 : 0;
+  }
+  return __render_bytes( data, sz, W->output );
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_flush( __json_writer_t *W ) {
+  int64_t n = W->wp - W->chunk;
+  W->wp = W->chunk;
+  if( n > 0 ) {
+    return __json_output( W, W->chunk, n );
+  }
+  return 0;
+}
+
+
+
+/******************************************************************************
+ * Make room for at least n bytes in the staging chunk (n <= __JSON_CHUNK_SZ)
+ *
+ ******************************************************************************
+ */
+__inline static int __json_reserve( __json_writer_t *W, int64_t n ) {
+  if( W->end - W->wp < n ) {
+    return __json_flush( W );
+  }
+  return 0;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_write( __json_writer_t *W, const char *data, int64_t sz ) {
+  if( W->end - W->wp < sz ) {
+    if( __json_flush( W ) < 0 ) {
+      return -1;
     }
+    if( sz > __JSON_CHUNK_SZ ) {
+      return __json_output( W, data, sz );
+    }
+  }
+  memcpy( W->wp, data, sz );
+  W->wp += sz;
+  return 0;
+}
+
+
 
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static int __json_write_char( __json_writer_t *W, char c ) {
+  if( __json_reserve( W, 1 ) < 0 ) {
+    return -1;
   }
-  XCATCH( errcode ) {
-    if( !PyErr_Occurred() ) {
-      if( py_exc && serr ) {
-        PyErr_SetString( py_exc, serr );
+  *W->wp++ = c;
+  return 0;
+}
+
+
+
+/******************************************************************************
+ * Characters written as-is in a JSON string when ensure_ascii is in effect
+ *
+ ******************************************************************************
+ */
+__inline static bool __json_is_literal_char( Py_UCS4 c ) {
+  return c >= 0x20 && c < 0x7f && c != '"' && c != '\\';
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static char * __json_put_u4( char *p, Py_UCS4 c ) {
+  *p++ = 'u';
+  *p++ = __json_hexdigits[ (c >> 12) & 0xf ];
+  *p++ = __json_hexdigits[ (c >> 8) & 0xf ];
+  *p++ = __json_hexdigits[ (c >> 4) & 0xf ];
+  *p++ = __json_hexdigits[ c & 0xf ];
+  return p;
+}
+
+
+
+/******************************************************************************
+ * Write escape sequence for character c, splitting into a surrogate pair
+ * outside the BMP
+ *
+ ******************************************************************************
+ */
+static int __json_write_escape( __json_writer_t *W, Py_UCS4 c ) {
+  if( __json_reserve( W, 12 ) < 0 ) {
+    return -1;
+  }
+  char *p = W->wp;
+  *p++ = '\\';
+  switch( c ) {
+  case '"':
+    *p++ = '"';
+    break;
+  case '\\':
+    *p++ = '\\';
+    break;
+  case '\b':
+    *p++ = 'b';
+    break;
+  case '\f':
+    *p++ = 'f';
+    break;
+  case '\n':
+    *p++ = 'n';
+    break;
+  case '\r':
+    *p++ = 'r';
+    break;
+  case '\t':
+    *p++ = 't';
+    break;
+  default:
+    if( c >= 0x10000 ) {
+      Py_UCS4 v = c - 0x10000;
+      p = __json_put_u4( p, 0xd800 | ((v >> 10) & 0x3ff) );
+      *p++ = '\\';
+      p = __json_put_u4( p, 0xdc00 | (v & 0x3ff) );
+    }
+    else {
+      p = __json_put_u4( p, c );
+    }
+  }
+  W->wp = p;
+  return 0;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_write_string( __json_writer_t *W, PyObject *py_str ) {
+  Py_ssize_t len = PyUnicode_GET_LENGTH( py_str );
+  if( __json_write_char( W, '"' ) < 0 ) {
+    return -1;
+  }
+
+  // ASCII: copy runs of literal characters
+  if( PyUnicode_IS_ASCII( py_str ) ) {
+    const char *s = (const char*)PyUnicode_1BYTE_DATA( py_str );
+    const char *end = s + len;
+    const char *run = s;
+    while( s < end ) {
+      if( __json_is_literal_char( (Py_UCS4)*s ) ) {
+        ++s;
+        continue;
       }
-      else {
-        PyErr_SetString( PyExc_Exception, "unknown decoder error" );
+      if( s > run && __json_write( W, run, s - run ) < 0 ) {
+        return -1;
+      }
+      if( __json_write_escape( W, (Py_UCS4)*s ) < 0 ) {
+        return -1;
+      }
+      run = ++s;
+    }
+    if( s > run && __json_write( W, run, s - run ) < 0 ) {
+      return -1;
+    }
+  }
+  // Non-ASCII
+  else {
+    int kind = PyUnicode_KIND( py_str );
+    const void *data = PyUnicode_DATA( py_str );
+    for( Py_ssize_t i=0; i<len; i++ ) {
+      Py_UCS4 c = PyUnicode_READ( kind, data, i );
+      if( __json_is_literal_char( c ) ) {
+        if( __json_write_char( W, (char)c ) < 0 ) {
+          return -1;
+        }
+      }
+      else if( __json_write_escape( W, c ) < 0 ) {
+        return -1;
       }
     }
+  }
+
+  return __json_write_char( W, '"' );
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_write_digits( __json_writer_t *W, uint64_t u, bool negative ) {
+  char digits[24];
+  char *p = digits + sizeof( digits );
+  do {
+    *--p = (char)('0' + u % 10);
+    u /= 10;
+  } while( u > 0 );
+  if( negative ) {
+    *--p = '-';
+  }
+  return __json_write( W, p, digits + sizeof( digits ) - p );
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static int __json_write_int64( __json_writer_t *W, int64_t value ) {
+  return __json_write_digits( W, value < 0 ? 0 - (uint64_t)value : (uint64_t)value, value < 0 );
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_write_int( __json_writer_t *W, PyObject *py_int ) {
+  int overflow = 0;
+  long long value = PyLong_AsLongLongAndOverflow( py_int, &overflow );
+  if( overflow == 0 ) {
+    return __json_write_int64( W, value );
+  }
+  // Big int
+  PyObject *py_repr = PyLong_Type.tp_repr( py_int );
+  if( py_repr == NULL ) {
+    return -1;
+  }
+  int ret;
+  Py_ssize_t sz = 0;
+  const char *data = PyUnicode_AsUTF8AndSize( py_repr, &sz );
+  if( data == NULL ) {
+    ret = -1;
+  }
+  else {
+    ret = __json_write( W, data, sz );
+  }
+  Py_DECREF( py_repr );
+  return ret;
+}
+
+
+
+/******************************************************************************
+ * Shortest repr that round-trips, same as float.__repr__()
+ *
+ * Returns length of repr, or -1 on error (Python exception set)
+ ******************************************************************************
+ */
+static int __json_format_double( double value, __json_repr_t repr ) {
+  if( isnan( value ) ) {
+    strcpy( repr, "NaN" );
+    return 3;
+  }
+  if( isinf( value ) ) {
+    strcpy( repr, value > 0 ? "Infinity" : "-Infinity" );
+    return value > 0 ? 8 : 9;
+  }
+  char *str = PyOS_double_to_string( value, 'r', 0, Py_DTSF_ADD_DOT_0, NULL );
+  if( str == NULL ) {
+    return -1;
+  }
+  size_t sz = strlen( str );
+  if( sz < __JSON_REPR_SZ ) {
+    memcpy( repr, str, sz + 1 );
+  }
+  PyMem_Free( str );
+  if( sz >= __JSON_REPR_SZ ) {
+    PyErr_SetString( PyExc_ValueError, "float repr too long" );
+    return -1;
+  }
+  return (int)sz;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_write_double( __json_writer_t *W, double value ) {
+  __json_repr_t repr;
+  int sz = __json_format_double( value, repr );
+  if( sz < 0 ) {
+    return -1;
+  }
+  return __json_write( W, repr, sz );
+}
+
+
+
+/******************************************************************************
+ * Dict keys are always strings. Non-string keys are converted the same way
+ * json.dumps() converts them.
+ *
+ ******************************************************************************
+ */
+static int __json_write_key( __json_writer_t *W, PyObject *py_key ) {
+  if( PyUnicode_CheckExact( py_key ) ) {
+    return __json_write_string( W, py_key );
+  }
+  if( py_key == Py_True ) {
+    return __json_write( W, "\"true\"", 6 );
+  }
+  if( py_key == Py_False ) {
+    return __json_write( W, "\"false\"", 7 );
+  }
+  if( py_key == Py_None ) {
+    return __json_write( W, "\"null\"", 6 );
+  }
+  if( __json_write_char( W, '"' ) < 0 ) {
+    return -1;
+  }
+  if( PyFloat_CheckExact( py_key ) ) {
+    if( __json_write_double( W, PyFloat_AS_DOUBLE( py_key ) ) < 0 ) {
+      return -1;
+    }
+  }
+  else if( __json_write_int( W, py_key ) < 0 ) {
+    return -1;
+  }
+  return __json_write_char( W, '"' );
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_write_sequence( __json_writer_t *W, PyObject *py_seq ) {
+  Py_ssize_t sz = PySequence_Fast_GET_SIZE( py_seq );
+  if( sz == 0 ) {
+    return __json_write( W, "[]", 2 );
+  }
+  PyObject **items = PySequence_Fast_ITEMS( py_seq );
+  if( __json_write_char( W, '[' ) < 0 ) {
+    return -1;
+  }
+  for( Py_ssize_t i=0; i<sz; i++ ) {
+    if( i > 0 && __json_write( W, ", ", 2 ) < 0 ) {
+      return -1;
+    }
+    if( __json_write_value( W, items[i] ) < 0 ) {
+      return -1;
+    }
+  }
+  return __json_write_char( W, ']' );
+}
 
-    Py_XDECREF( py_object );
-    py_object = NULL;
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int __json_write_dict( __json_writer_t *W, PyObject *py_dict ) {
+  if( PyDict_GET_SIZE( py_dict ) == 0 ) {
+    return __json_write( W, "{}", 2 );
   }
-  XFINALLY {
-    if( decompressed && decompressed != decomp_buffer ) {
-      ALIGNED_FREE( decompressed );
+  if( __json_write_char( W, '{' ) < 0 ) {
+    return -1;
+  }
+  Py_ssize_t pos = 0;
+  PyObject *py_key;
+  PyObject *py_value;
+  bool first = true;
+  while( PyDict_Next( py_dict, &pos, &py_key, &py_value ) ) {
+    if( !first && __json_write( W, ", ", 2 ) < 0 ) {
+      return -1;
+    }
+    first = false;
+    if( __json_write_key( W, py_key ) < 0 || __json_write( W, ": ", 2 ) < 0 || __json_write_value( W, py_value ) < 0 ) {
+      return -1;
     }
-    Py_XDECREF( py_key );
-    Py_XDECREF( py_bytes );
   }
-
-  return py_object;
+  return __json_write_char( W, '}' );
 }
 
 
 
 /******************************************************************************
  *
- * 
+ * NATIVE SEARCH RESULT RENDERING
+ *
+ * Search results kept in native form (see pyvgx.SearchResult) are rendered
+ * straight from the result list into the output, producing the same JSON as
+ * the materialized Python result list would. No Python API is used here so
+ * large results can be rendered without holding the GIL, with float fields
+ * formatted ahead of time. Errors are reported by returning -1 and must be
+ * raised by the caller.
  *
  ******************************************************************************
  */
-static PyObject * ORIG_ipyvgx_codec__new_pyobject_from_encoded_object( const CString_t *CSTR__encoded, PyObject **py_retkey ) {
-  char PALIGNED_ decomp_buffer[ARCH_PAGE_SIZE];
 
-  if( CSTR__encoded == NULL ) {
-    return NULL;
+
+
+/******************************************************************************
+ * Return the number of bytes in the UTF-8 sequence starting at s, or 0 if
+ * the sequence is not valid strict UTF-8 (same rules as the utf-8 codec)
+ *
+ ******************************************************************************
+ */
+static int __json_utf8_sequence( const unsigned char *s, const unsigned char *end, Py_UCS4 *c ) {
+  unsigned char b0 = *s;
+  int n;
+  Py_UCS4 min;
+  if( b0 < 0x80 ) {
+    *c = b0;
+    return 1;
   }
-    
-  CString_attr attr = CStringAttributes( CSTR__encoded );
+  else if( (b0 & 0xE0) == 0xC0 ) {
+    n = 2;
+    min = 0x80;
+    *c = b0 & 0x1F;
+  }
+  else if( (b0 & 0xF0) == 0xE0 ) {
+    n = 3;
+    min = 0x800;
+    *c = b0 & 0x0F;
+  }
+  else if( (b0 & 0xF8) == 0xF0 ) {
+    n = 4;
+    min = 0x10000;
+    *c = b0 & 0x07;
+  }
+  else {
+    return 0;
+  }
+  if( end - s < n ) {
+    return 0;
+  }
+  for( int i=1; i<n; i++ ) {
+    if( (s[i] & 0xC0) != 0x80 ) {
+      return 0;
+    }
+    *c = (*c << 6) | (s[i] & 0x3F);
+  }
+  if( *c < min || *c > 0x10FFFF || (*c >= 0xD800 && *c <= 0xDFFF) ) {
+    return 0;
+  }
+  return n;
+}
 
-  PyObject *py_key = NULL;
-  PyObject *py_bytes = NULL;
 
-  // If compressed, decompress it first
-  bool compressed = false;
-  if( attr & CSTRING_ATTR_COMPRESSED ) {
-    attr ^= CSTRING_ATTR_COMPRESSED; // remove compressed bit
-    compressed = true;
 
-    char *rdata;
-    int rsz;
-    int rucsz;
-    CString_attr rattr;
-    int r;
-    BEGIN_PYVGX_THREADS {
-      r = CALLABLE( CSTR__encoded )->DecompressToBytes( CSTR__encoded, decomp_buffer, ARCH_PAGE_SIZE, &rdata, &rsz, &rucsz, &rattr );
-    } END_PYVGX_THREADS;
-    if( r < 0 ) {
-      PyErr_SetString( PyExc_MemoryError, "decompress error" );
-      return NULL;
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static bool __json_utf8_valid( const char *data, int64_t sz ) {
+  const unsigned char *s = (const unsigned char*)data;
+  const unsigned char *end = s + sz;
+  Py_UCS4 c;
+  int n;
+  while( s < end ) {
+    if( *s < 0x80 ) {
+      ++s;
     }
-
-    py_bytes = PyBytes_FromStringAndSize( rdata, rsz );
-    if( rdata != decomp_buffer ) {
-      ALIGNED_FREE( rdata );
+    else if( (n = __json_utf8_sequence( s, end, &c )) > 0 ) {
+      s += n;
     }
-    if( py_bytes == NULL ) {
-      return NULL;
+    else {
+      return false;
     }
   }
+  return true;
+}
 
-  // Unpack keyval
-  bool keyval = false;
-  if( attr & CSTRING_ATTR_KEYVAL ) {
-    attr ^= CSTRING_ATTR_KEYVAL; // remove keyval bit
-    keyval = true;
-    // Convert cstring to bytes if we didn't decompress above
-    if( py_bytes == NULL ) {
-      if( (py_bytes = __new_pybytes_from_cstring( CSTR__encoded )) == NULL ) {
-        return NULL;
-      }
+
+
+/******************************************************************************
+ * Write JSON string from valid UTF-8 data
+ *
+ ******************************************************************************
+ */
+static int __json_write_utf8( __json_writer_t *W, const char *data, int64_t sz ) {
+  const unsigned char *s = (const unsigned char*)data;
+  const unsigned char *end = s + sz;
+  const unsigned char *run = s;
+  Py_UCS4 c;
+  int n;
+  if( __json_write_char( W, '"' ) < 0 ) {
+    return -1;
+  }
+  while( s < end ) {
+    if( __json_is_literal_char( *s ) ) {
+      ++s;
+      continue;
     }
-    // Unpickle to get the tuple (key, val)
-    PyObject *py_tuple = __pickle_loads( py_bytes );
-    Py_DECREF( py_bytes );
-    if( py_tuple == NULL || !PyTuple_Check( py_tuple ) || PyTuple_GET_SIZE( py_tuple ) != 2 ) {
-      if( !PyErr_Occurred() ) {
-        PyErr_SetString( PyExc_Exception, "bad internal encoding" );
-      }
-      Py_XDECREF( py_tuple );
-      return NULL;
+    if( s > run && __json_write( W, (const char*)run, s - run ) < 0 ) {
+      return -1;
     }
+    if( (n = __json_utf8_sequence( s, end, &c )) == 0 ) {
+      return -1;
+    }
+    if( __json_write_escape( W, c ) < 0 ) {
+      return -1;
+    }
+    s += n;
+    run = s;
+  }
+  if( s > run && __json_write( W, (const char*)run, s - run ) < 0 ) {
+    return -1;
+  }
+  return __json_write_char( W, '"' );
+}
 
-    py_key = PyTuple_GET_ITEM( py_tuple, 0 );
-    Py_INCREF( py_key );
 
-    py_bytes = PyTuple_GET_ITEM( py_tuple, 1 );
-    Py_INCREF( py_bytes );
 
-    Py_DECREF( py_tuple );
-  }
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+__inline static const char * __json_ident_string( const vgx_VertexCompleteIdentifier_t *ident, int64_t *sz ) {
+  const CString_t *CSTR__id = ident->identifier.CSTR__idstr;
+  if( CSTR__id ) {
+    *sz = CStringLength( CSTR__id );
+    return CStringValue( CSTR__id );
+  }
+  *sz = strlen( ident->identifier.idprefix.data );
+  return ident->identifier.idprefix.data;
+}
 
-  // Data was compressed and/or a keyval pair, create a new cstring for further processing
-  CString_t *CSTR__bytes = NULL;
-  if( py_bytes && ( (attr & CSTRING_ATTR_BYTEARRAY) || (attr & __CSTRING_ATTR_ARRAY_MASK) ) ) {
-    CSTR__bytes = __new_cstring_from_pystring( py_bytes, NULL, attr, true );
-    Py_DECREF( py_bytes );
-    py_bytes = NULL;
-    if( (CSTR__encoded = CSTR__bytes) == NULL ) {
-      Py_XDECREF( py_key );
-      return NULL;
-    }
-  }
 
-  PyObject *py_object = NULL;
 
-  // Bytearray
-  if( attr & CSTRING_ATTR_BYTEARRAY ) {
-    py_object = __new_pybytearray_from_cstring( CSTR__encoded );
-  }
-  // Bytes
-  else if( attr == CSTRING_ATTR_BYTES ) {
-    if( py_bytes ) {
-      if( PyBytes_CheckExact( py_bytes ) ) {
-        py_object = py_bytes; // already bytes, steal
-        py_bytes = NULL;
-      }
-      else {
-        py_object = PyBytes_FromObject( py_bytes );
-      }
-    }
-    else {
-      py_object = __new_pybytes_from_cstring( CSTR__encoded );
+/******************************************************************************
+ * Return true if field value can be rendered as JSON
+ *
+ ******************************************************************************
+ */
+static bool __json_field_encodable( vgx_ResponseAttrFastMask attr, vgx_ResponseFieldValue_t value ) {
+  const char *str;
+  int64_t sz;
+  switch( attr ) {
+  case VGX_RESPONSE_ATTR_ANCHOR:
+  case VGX_RESPONSE_ATTR_ID:
+    if( value.ident == NULL ) {
+      return true;
     }
+    str = __json_ident_string( value.ident, &sz );
+    return __json_utf8_valid( str, sz );
+  case VGX_RESPONSE_ATTR_ANCHOR_OBID:
+  case VGX_RESPONSE_ATTR_OBID:
+    return value.ident != NULL;
+  case VGX_RESPONSE_ATTR_RELTYPE:
+  case VGX_RESPONSE_ATTR_TYPENAME:
+    return value.CSTR__str != NULL && __json_utf8_valid( CStringValue( value.CSTR__str ), CStringLength( value.CSTR__str ) );
+  case VGX_RESPONSE_ATTR_ARCDIR:
+  case VGX_RESPONSE_ATTR_MODIFIER:
+  case VGX_RESPONSE_ATTR_VALUE:
+  case VGX_RESPONSE_ATTR_DEGREE:
+  case VGX_RESPONSE_ATTR_INDEGREE:
+  case VGX_RESPONSE_ATTR_OUTDEGREE:
+  case VGX_RESPONSE_ATTR_RANKSCORE:
+  case VGX_RESPONSE_ATTR_SIMILARITY:
+  case VGX_RESPONSE_ATTR_HAMDIST:
+  case VGX_RESPONSE_ATTR_TMC:
+  case VGX_RESPONSE_ATTR_TMM:
+  case VGX_RESPONSE_ATTR_TMX:
+  case VGX_RESPONSE_ATTR_DESCRIPTOR:
+  case VGX_RESPONSE_ATTR_ADDRESS:
+  case VGX_RESPONSE_ATTR_HANDLE:
+    return true;
+  default:
+    return false;
   }
-  // Unicode string
-  else if( attr == CSTRING_ATTR_NONE ) {
-    if( py_bytes ) {
-      if( PyUnicode_Check( py_bytes ) ) {
-        py_object = py_bytes; // already unicode, steal
-        py_bytes = NULL;
-      }
-      else {
-        py_object = PyUnicode_FromEncodedObject( py_bytes, "utf-8", NULL ); 
-      }
-    }
-    else {
-      py_object = __new_pyunicode_from_cstring( CSTR__encoded );
+}
+
+
+
+/******************************************************************************
+ * Return true if field value is rendered as float
+ *
+ ******************************************************************************
+ */
+static bool __json_field_double( vgx_ResponseAttrFastMask attr, vgx_ResponseFieldValue_t value, double *real ) {
+  switch( attr ) {
+  case VGX_RESPONSE_ATTR_VALUE:
+    if( _vgx_predicator_value_range( NULL, NULL, value.pred.mod.bits ) == VGX_PREDICATOR_VAL_TYPE_REAL ) {
+      *real = value.pred.val.real;
+      return true;
     }
+    return false;
+  case VGX_RESPONSE_ATTR_RANKSCORE:
+  case VGX_RESPONSE_ATTR_SIMILARITY:
+    *real = value.real;
+    return true;
+  default:
+    return false;
   }
-  // Encoded array or map
-  else if( attr & __CSTRING_ATTR_ARRAY_MASK ) {
-    switch( attr & __CSTRING_ATTR_ARRAY_MASK ) {
-    case CSTRING_ATTR_ARRAY_INT:
-    case CSTRING_ATTR_ARRAY_FLOAT:
-      py_object = iPyVGXBuilder.NumberListFromCString( CSTR__encoded );
-      break;
-    case CSTRING_ATTR_ARRAY_MAP:
-      py_object = iPyVGXBuilder.NumberMapFromCString( CSTR__encoded );
-      break;
-    }
+}
+
+
+
+/******************************************************************************
+ * Float field formatted by the Python float repr. Without the GIL the repr
+ * made by __json_format_search_result_doubles() is used.
+ *
+ ******************************************************************************
+ */
+static int __json_write_field_double( __json_writer_t *W, const vgx_ResponseFieldData_t *field, double real ) {
+  if( W->nogil ) {
+    const char *repr = W->reprs[ field - W->fields ];
+    return __json_write( W, repr, strlen( repr ) );
   }
-  // Callable
-  else if( attr & CSTRING_ATTR_CALLABLE ) {
-    // Convert cstring to bytes if we didn't already do so because of compression and/or keyval packing
-    if( py_bytes == NULL ) {
-      py_bytes = __new_pybytes_from_cstring( CSTR__encoded );
-    }
-    if( py_bytes ) {
-      PyObject *py_triple;
-      if( keyval ) {
-        py_triple = py_bytes; // already unpickled, steal
-        py_bytes = NULL;
-      }
-      else {
-        py_triple = __pickle_loads( py_bytes );
-      }
-      // Unpickle to get the 3-tuple (code, defaults, annotation)
-      if( py_triple && PyTuple_Check( py_triple ) && PyTuple_GET_SIZE( py_triple ) == 3 ) {
-        PyObject *py_code = NULL;
-        PyObject *py_defaults = NULL;
-        PyObject *py_annotations = NULL;
-        // 0: code
-        // 1: defaults
-        // 2: annotations
-        PyObject *py_code_bytes = PyTuple_GET_ITEM( py_triple, 0 );
-        if( PyBytes_CheckExact( py_code_bytes ) ) {
-          py_code = PyMarshal_ReadObjectFromString( PyBytes_AS_STRING( py_code_bytes ), PyBytes_GET_SIZE( py_code_bytes ) );
-        }
-        py_defaults = PyTuple_GET_ITEM( py_triple, 1 );
-        Py_INCREF( py_defaults );
-        py_annotations = PyTuple_GET_ITEM( py_triple, 2 );
-        Py_INCREF( py_annotations );
-        Py_XDECREF( py_triple );
+  return __json_write_double( W, real );
+}
 
-        // Create function instance from code, defaults and annotations
-        if( py_code ) {
-          py_object = __new_function_from_code_object( py_code, py_defaults, py_annotations );
-          Py_DECREF( py_code );
-        }
-        Py_XDECREF( py_defaults );
-        Py_XDECREF( py_annotations );
-      }
+
+
+/******************************************************************************
+ * Render field value the same way the corresponding Python object is
+ * rendered by json.dumps()
+ *
+ ******************************************************************************
+ */
+static int __json_write_field( __json_writer_t *W, vgx_ResponseAttrFastMask attr, const vgx_ResponseFieldData_t *field ) {
+  vgx_ResponseFieldValue_t value = field->value;
+  const char *str;
+  int64_t sz;
+  char buffer[64];
+  switch( attr ) {
+  case VGX_RESPONSE_ATTR_ANCHOR:
+  case VGX_RESPONSE_ATTR_ID:
+    if( value.ident == NULL ) {
+      return __json_write( W, "\"*\"", 3 );
+    }
+    str = __json_ident_string( value.ident, &sz );
+    return __json_write_utf8( W, str, sz );
+  case VGX_RESPONSE_ATTR_ANCHOR_OBID:
+  case VGX_RESPONSE_ATTR_OBID:
+    return __json_write_utf8( W, idtostr( buffer, &value.ident->internalid ), 32 );
+  case VGX_RESPONSE_ATTR_RELTYPE:
+  case VGX_RESPONSE_ATTR_TYPENAME:
+    return __json_write_utf8( W, CStringValue( value.CSTR__str ), CStringLength( value.CSTR__str ) );
+  case VGX_RESPONSE_ATTR_ARCDIR:
+    str = __reverse_arcdir_map[ value.pred.rel.dir ];
+    return __json_write_utf8( W, str, strlen( str ) );
+  case VGX_RESPONSE_ATTR_MODIFIER:
+    str = _vgx_modifier_as_string( value.pred.mod );
+    return __json_write_utf8( W, str, strlen( str ) );
+  case VGX_RESPONSE_ATTR_VALUE:
+    switch( _vgx_predicator_value_range( NULL, NULL, value.pred.mod.bits ) ) {
+    case VGX_PREDICATOR_VAL_TYPE_UNITY:
+      return __json_write_char( W, '1' );
+    case VGX_PREDICATOR_VAL_TYPE_INTEGER:
+      return __json_write_int64( W, value.pred.val.integer );
+    case VGX_PREDICATOR_VAL_TYPE_UNSIGNED:
+      return __json_write_digits( W, value.pred.val.uinteger, false );
+    case VGX_PREDICATOR_VAL_TYPE_REAL:
+      return __json_write_field_double( W, field, value.pred.val.real );
+    default:
+      return __json_write( W, "-1", 2 );
     }
-  }
-  else if( attr & CSTRING_ATTR_SERIALIZED_TXT ) {
-    // Convert cstring to bytes if we didn't already do so because of compression and/or keyval packing
-    if( py_bytes == NULL ) {
-      py_bytes = __new_pybytes_from_cstring( CSTR__encoded );
+  case VGX_RESPONSE_ATTR_DEGREE:
+  case VGX_RESPONSE_ATTR_INDEGREE:
+  case VGX_RESPONSE_ATTR_OUTDEGREE:
+  case VGX_RESPONSE_ATTR_TMC:
+  case VGX_RESPONSE_ATTR_TMM:
+  case VGX_RESPONSE_ATTR_TMX:
+    return __json_write_int64( W, value.i64 );
+  case VGX_RESPONSE_ATTR_RANKSCORE:
+  case VGX_RESPONSE_ATTR_SIMILARITY:
+    return __json_write_field_double( W, field, value.real );
+  case VGX_RESPONSE_ATTR_HAMDIST:
+  case VGX_RESPONSE_ATTR_DESCRIPTOR:
+  case VGX_RESPONSE_ATTR_ADDRESS:
+    return __json_write_digits( W, value.bits, false );
+  case VGX_RESPONSE_ATTR_HANDLE:
+    {
+      cxmalloc_handle_t handle = {0};
+      handle.qword = value.bits;
+      int n = snprintf( buffer, sizeof( buffer ), "%02X:%u:%u:%u", (unsigned)handle.objclass, (unsigned)handle.aidx, (unsigned)handle.bidx, (unsigned)handle.offset );
+      return __json_write_utf8( W, buffer, n );
     }
-    if( py_bytes ) {
-      if( keyval ) {
-        py_object = py_bytes; // already unpickled, steal
-        py_bytes = NULL;
-      }
-      else {
-        py_object = __pickle_loads( py_bytes );
+  default:
+    return -1;
+  }
+}
+
+
+
+/******************************************************************************
+ * Return true if all entries in the search result can be rendered natively
+ *
+ ******************************************************************************
+ */
+static bool __json_search_result_encodable( const vgx_SearchResult_t *search_result ) {
+  int64_t length = search_result->list ? search_result->list_length : 0;
+  const vgx_ResponseFieldData_t *entry = search_result->list;
+
+  // Entries are plain strings
+  if( vgx_response_show_as_string( search_result->list_fields.fastmask ) ) {
+    for( int64_t n=0; n<length; n++ ) {
+      const CString_t *CSTR__string = entry++->value.CSTR__str;
+      if( CSTR__string && (CStringAttributes( CSTR__string ) != CSTRING_ATTR_NONE || !__json_utf8_valid( CStringValue( CSTR__string ), CStringLength( CSTR__string ) )) ) {
+        return false;
       }
     }
+    return true;
   }
 
-  iString.Discard( &CSTR__bytes );
+  if( length == 0 ) {
+    return true;
+  }
 
-  if( py_object && py_retkey ) {
-    *py_retkey = py_key;
-    py_key = NULL;
+  vgx_ResponseFieldMap_t *fieldmap = iPyVGXSearchResult.NewFieldMap( search_result );
+  if( fieldmap == NULL ) {
+    return false;
   }
-  Py_XDECREF( py_key );
-  Py_XDECREF( py_bytes );
 
-  return py_object;
+  bool encodable = true;
+  int width = search_result->list_width;
+  for( int64_t n=0; n<length && encodable; n++ ) {
+    for( const vgx_ResponseFieldMap_t *cursor = fieldmap; cursor->srcpos != -1; ++cursor ) {
+      if( !__json_field_encodable( cursor->attr, entry[ cursor->srcpos ].value ) ) {
+        encodable = false;
+        break;
+      }
+    }
+    entry += width;
+  }
+
+  free( fieldmap );
+  return encodable;
 }
 
 
 
 /******************************************************************************
- *
- * 
+ * Entry rendered as dict. Predicator fields are nested under "arc" followed
+ * by "distance" when the arc carries a distance.
  *
  ******************************************************************************
  */
-__inline static bool _ipyvgx_codec__is_cstring_compressible( const CString_t *CSTR__string ) {
-  return CALLABLE( CSTR__string )->Length( CSTR__string ) >= CSTRING_MIN_COMPRESS_SZ;
+static int __json_write_search_result_dict_entry( __json_writer_t *W, const vgx_ResponseFieldMap_t *fieldmap, const vgx_ResponseFieldData_t *entry ) {
+  bool first = true;
+  bool arc_written = false;
+  if( __json_write_char( W, '{' ) < 0 ) {
+    return -1;
+  }
+  for( const vgx_ResponseFieldMap_t *cursor = fieldmap; cursor->srcpos != -1; ++cursor ) {
+    if( cursor->attr & VGX_RESPONSE_ATTRS_PREDICATOR ) {
+      if( arc_written ) {
+        continue;
+      }
+      arc_written = true;
+      if( !first && __json_write( W, ", ", 2 ) < 0 ) {
+        return -1;
+      }
+      first = false;
+      if( __json_write( W, "\"arc\": {", 8 ) < 0 ) {
+        return -1;
+      }
+      int distance = -1;
+      bool first_arcfield = true;
+      for( const vgx_ResponseFieldMap_t *arcfield = cursor; arcfield->srcpos != -1; ++arcfield ) {
+        if( !(arcfield->attr & VGX_RESPONSE_ATTRS_PREDICATOR) ) {
+          continue;
+        }
+        vgx_ResponseFieldValue_t value = entry[ arcfield->srcpos ].value;
+        if( distance < 0 && value.pred.eph.type == VGX_PREDICATOR_EPH_TYPE_DISTANCE ) {
+          distance = value.pred.eph.value;
+        }
+        if( !first_arcfield && __json_write( W, ", ", 2 ) < 0 ) {
+          return -1;
+        }
+        first_arcfield = false;
+        if( __json_write_utf8( W, arcfield->fieldname, strlen( arcfield->fieldname ) ) < 0
+            ||
+            __json_write( W, ": ", 2 ) < 0
+            ||
+            __json_write_field( W, arcfield->attr, &entry[ arcfield->srcpos ] ) < 0 )
+        {
+          return -1;
+        }
+      }
+      if( __json_write_char( W, '}' ) < 0 ) {
+        return -1;
+      }
+      if( distance >= 0 && (__json_write( W, ", \"distance\": ", 14 ) < 0 || __json_write_int64( W, distance ) < 0) ) {
+        return -1;
+      }
+      continue;
+    }
+    if( !first && __json_write( W, ", ", 2 ) < 0 ) {
+      return -1;
+    }
+    first = false;
+    if( __json_write_utf8( W, cursor->fieldname, strlen( cursor->fieldname ) ) < 0
+        ||
+        __json_write( W, ": ", 2 ) < 0
+        ||
+        __json_write_field( W, cursor->attr, &entry[ cursor->srcpos ] ) < 0 )
+    {
+      return -1;
+    }
+  }
+  return __json_write_char( W, '}' );
 }
 
 
 
 /******************************************************************************
  *
- * 
  *
  ******************************************************************************
  */
-__inline static bool _ipyvgx_codec__is_pystring_compressible( PyObject *py_string ) {
-  // Bytes
-  if( PyBytes_CheckExact( py_string ) ) {
-    return PyBytes_GET_SIZE( py_string ) >= CSTRING_MIN_COMPRESS_SZ;
-  }
-  // Unicode
-  if( PyUnicode_Check( py_string ) ) {
-    Py_ssize_t sz = 0;
-    PyUnicode_AsUTF8AndSize( py_string, &sz );
-    return sz >= CSTRING_MIN_COMPRESS_SZ;
+static int __json_write_search_result_entry( __json_writer_t *W, vgx_ResponseAttrFastMask show_as, const vgx_ResponseFieldMap_t *fieldmap, const vgx_ResponseFieldData_t *entry ) {
+  switch( show_as ) {
+  case VGX_RESPONSE_SHOW_AS_LIST:
+    if( __json_write_char( W, '[' ) < 0 ) {
+      return -1;
+    }
+    for( const vgx_ResponseFieldMap_t *cursor = fieldmap; cursor->srcpos != -1; ++cursor ) {
+      if( cursor != fieldmap && __json_write( W, ", ", 2 ) < 0 ) {
+        return -1;
+      }
+      if( __json_write_field( W, cursor->attr, &entry[ cursor->srcpos ] ) < 0 ) {
+        return -1;
+      }
+    }
+    return __json_write_char( W, ']' );
+  case VGX_RESPONSE_SHOW_AS_DICT:
+    return __json_write_search_result_dict_entry( W, fieldmap, entry );
+  default:
+    if( fieldmap->srcpos == -1 ) {
+      return __json_write( W, "null", 4 );
+    }
+    return __json_write_field( W, fieldmap->attr, &entry[ fieldmap->srcpos ] );
   }
-  // Not a string
-  return false;
 }
 
 
 
 /******************************************************************************
- *
+ * Render search result list. Caller must first verify the result with
+ * __json_search_result_encodable().
  *
  ******************************************************************************
  */
-static PyObject * _ipyvgx_codec__new_compressed_pybytes_from_pyobject( PyObject *py_object ) {
-  PyObject *s = __marshal_dumps( py_object );
-  if( s == NULL ) {
-    return NULL;
-  }
+static int __json_write_search_result( __json_writer_t *W, const vgx_SearchResult_t *search_result ) {
+  int64_t length = search_result->list ? search_result->list_length : 0;
+  const vgx_ResponseFieldData_t *entry = search_result->list;
+  vgx_ResponseAttrFastMask show_as = vgx_response_show_as( search_result->list_fields.fastmask );
 
-  if( !PyBytes_Check( s ) ) {
-    PyErr_SetString( PyExc_Exception, "internal error" );
-    return NULL;
+  if( length == 0 ) {
+    return __json_write( W, "[]", 2 );
   }
-  
-  int64_t sz = PyBytes_GET_SIZE( s );
-  const char *data = PyBytes_AS_STRING( s );
-  
-  CString_t *CSTR__compressed;
-  BEGIN_PYVGX_THREADS {
-    CSTR__compressed = CStringNewCompressedAlloc( data, (int)sz, 0, NULL, CSTRING_ATTR_NONE, CSTRING_COMPRESS_MODE_LZ4 );
-  } END_PYVGX_THREADS;
 
-  if( !CSTR__compressed ) {
-    PyErr_SetNone( PyExc_MemoryError );
-    return NULL;
+  if( __json_write_char( W, '[' ) < 0 ) {
+    return -1;
   }
 
-  PyObject *py_bytes = PyBytes_FromStringAndSize( CStringValue( CSTR__compressed ), CStringLength( CSTR__compressed ) );
+  int ret = 0;
 
-  CStringDelete( CSTR__compressed );
+  // Entries are plain strings
+  if( show_as == VGX_RESPONSE_SHOW_AS_STRING ) {
+    for( int64_t n=0; n<length && ret == 0; n++ ) {
+      const CString_t *CSTR__string = entry++->value.CSTR__str;
+      if( n > 0 && __json_write( W, ", ", 2 ) < 0 ) {
+        return -1;
+      }
+      if( CSTR__string ) {
+        ret = __json_write_utf8( W, CStringValue( CSTR__string ), CStringLength( CSTR__string ) );
+      }
+      else {
+        ret = __json_write( W, "null", 4 );
+      }
+    }
+  }
+  // Entries rendered according to fieldmap
+  else {
+    vgx_ResponseFieldMap_t *fieldmap = iPyVGXSearchResult.NewFieldMap( search_result );
+    if( fieldmap == NULL ) {
+      return -1;
+    }
+    int width = search_result->list_width;
+    for( int64_t n=0; n<length && ret == 0; n++ ) {
+      if( n > 0 && __json_write( W, ", ", 2 ) < 0 ) {
+        ret = -1;
+        break;
+      }
+      ret = __json_write_search_result_entry( W, show_as, fieldmap, entry );
+      entry += width;
+    }
+    free( fieldmap );
+  }
 
-  return py_bytes;
+  if( ret < 0 ) {
+    return -1;
+  }
+
+  return __json_write_char( W, ']' );
 }
 
 
@@ -1799,119 +3669,289 @@ static PyObject * _ipyvgx_codec__new_compressed_pybytes_from_pyobject( PyObject
  *
  ******************************************************************************
  */
-static PyObject * _ipyvgx_codec__new_pyobject_from_compressed_pybytes( PyObject *py_bytes ) {
-  char PALIGNED_ decomp_buffer[ARCH_PAGE_SIZE];
-
-  if( !PyBytes_Check( py_bytes ) ) {
-    PyErr_SetString( PyExc_TypeError, "bytes required" );
-    return NULL;
+static int __json_write_value( __json_writer_t *W, PyObject *py_obj ) {
+  if( PyUnicode_CheckExact( py_obj ) ) {
+    return __json_write_string( W, py_obj );
   }
-
-  int64_t sz = PyBytes_GET_SIZE( py_bytes );
-  const char *data = PyBytes_AS_STRING( py_bytes );
-
-  const char *marshalled;
-  char *decompressed = NULL;
-  int32_t len = 0;
-  int32_t uclen = 0;
-  CString_attr attr = CSTRING_ATTR_NONE;
-  if( CStringCharsNotCompressed( data, sz ) ) {
-    marshalled = data;
-    len = (int)sz;
+  if( PyLong_CheckExact( py_obj ) ) {
+    return __json_write_int( W, py_obj );
   }
-  else {
-    int cret;
-    BEGIN_PYVGX_THREADS {
-      cret = CStringDecompressBytesToBytes( data, (int)sz, decomp_buffer, ARCH_PAGE_SIZE, &decompressed, &len, &uclen, &attr );
-    } END_PYVGX_THREADS;
-    if( cret < 0 ) {
-      PyErr_SetString( PyExc_Exception, "internal decompression error" );
-      return NULL;
+  if( PyFloat_CheckExact( py_obj ) ) {
+    return __json_write_double( W, PyFloat_AS_DOUBLE( py_obj ) );
+  }
+  if( PyDict_CheckExact( py_obj ) ) {
+    return __json_write_dict( W, py_obj );
+  }
+  if( PyList_CheckExact( py_obj ) || PyTuple_CheckExact( py_obj ) ) {
+    return __json_write_sequence( W, py_obj );
+  }
+  if( PyVGX_SearchResult_CheckExact( py_obj ) ) {
+    PyVGX_SearchResult *py_result = (PyVGX_SearchResult*)py_obj;
+    const vgx_SearchResult_t *search_result;
+    if( py_result->py_list ) {
+      return __json_write_sequence( W, py_result->py_list );
     }
-    marshalled = decompressed;
+    if( (search_result = __pyvgx_SearchResult_Native( py_result )) != NULL ) {
+      if( __json_write_search_result( W, search_result ) < 0 ) {
+        if( !PyErr_Occurred() ) {
+          PyErr_SetString( PyExc_ValueError, "search result could not be rendered" );
+        }
+        return -1;
+      }
+      return 0;
+    }
+  }
+  if( py_obj == Py_True ) {
+    return __json_write( W, "true", 4 );
   }
+  if( py_obj == Py_False ) {
+    return __json_write( W, "false", 5 );
+  }
+  if( py_obj == Py_None ) {
+    return __json_write( W, "null", 4 );
+  }
+  PyErr_Format( PyExc_TypeError, "Object of type %s is not JSON serializable", Py_TYPE( py_obj )->tp_name );
+  return -1;
+}
 
-  PyObject *py_marshalled_bytes = PyBytes_FromStringAndSize( marshalled, len );
 
-  if( decompressed && decompressed != decomp_buffer ) {
-    ALIGNED_FREE( decompressed );
-  }
 
-  if( py_marshalled_bytes == NULL ) {
-    return py_marshalled_bytes;
+/******************************************************************************
+ * Same layout as PluginResponse.ToJSON()
+ *
+ ******************************************************************************
+ */
+static int __json_write_plugin_response( __json_writer_t *W, PyVGX_PluginResponse *py_plugres ) {
+  const x_vgx_partial__aggregator *A = &py_plugres->aggregator;
+  if( __json_write( W, "{\"level\": ", 10 ) < 0
+      ||
+      __json_write_int64( W, (int)py_plugres->metas.level.number ) < 0
+      ||
+      __json_write( W, ", \"levelparts\": ", 16 ) < 0
+      ||
+      __json_write_int64( W, (int)py_plugres->metas.level.parts ) < 0
+      ||
+      __json_write( W, ", \"partials\": ", 14 ) < 0
+      ||
+      __json_write_int64( W, (int)py_plugres->metas.level.deep_parts ) < 0
+      ||
+      __json_write( W, ", \"hitcount\": ", 14 ) < 0
+      ||
+      __json_write_int64( W, py_plugres->metas.hitcount ) < 0
+      ||
+      __json_write( W, ", \"aggregator\": [", 17 ) < 0
+      ||
+      __json_write_int64( W, A->int_aggr[0] ) < 0
+      ||
+      __json_write( W, ", ", 2 ) < 0
+      ||
+      __json_write_int64( W, A->int_aggr[1] ) < 0
+      ||
+      __json_write( W, ", ", 2 ) < 0
+      ||
+      __json_write_double( W, A->dbl_aggr[0] ) < 0
+      ||
+      __json_write( W, ", ", 2 ) < 0
+      ||
+      __json_write_double( W, A->dbl_aggr[1] ) < 0
+      ||
+      __json_write( W, "]", 1 ) < 0 )
+  {
+    return -1;
   }
 
-  PyObject *py_obj = __marshal_loads( py_marshalled_bytes );
+  if( py_plugres->py_message ) {
+    if( __json_write( W, ", \"message\": ", 13 ) < 0 || __json_write_value( W, py_plugres->py_message ) < 0 ) {
+      return -1;
+    }
+  }
 
-  Py_DECREF( py_marshalled_bytes );
+  if( __json_write( W, ", \"entries\": ", 13 ) < 0 || __json_write_value( W, py_plugres->py_entries ) < 0 ) {
+    return -1;
+  }
 
-  return py_obj;
+  return __json_write_char( W, '}' );
 }
 
 
 
 /******************************************************************************
+ * Format all float fields of search result with the GIL held, indexed by
+ * position in the result list. Float repr needs the Python API, the rest of
+ * the result can then be rendered without it.
  *
- *
+ * Returns reprs (caller frees), or NULL on error (Python exception set)
  ******************************************************************************
  */
-static bool _ipyvgx_codec__is_type_json( const PyObject *py_type ) {
-  return py_type == mod_json;
+static __json_repr_t * __json_format_search_result_doubles( const vgx_SearchResult_t *search_result ) {
+  int64_t length = search_result->list_length;
+  int width = search_result->list_width;
+  const vgx_ResponseFieldData_t *entry = search_result->list;
+
+  __json_repr_t *reprs = calloc( length * width + 1, sizeof( __json_repr_t ) );
+  if( reprs == NULL ) {
+    PyErr_SetNone( PyExc_MemoryError );
+    return NULL;
+  }
+
+  // Entries are plain strings
+  if( vgx_response_show_as_string( search_result->list_fields.fastmask ) ) {
+    return reprs;
+  }
+
+  vgx_ResponseFieldMap_t *fieldmap = iPyVGXSearchResult.NewFieldMap( search_result );
+  if( fieldmap == NULL ) {
+    free( reprs );
+    PyErr_SetNone( PyExc_MemoryError );
+    return NULL;
+  }
+
+  int ret = 0;
+  double real;
+  for( int64_t n=0; n<length && ret >= 0; n++ ) {
+    for( const vgx_ResponseFieldMap_t *cursor = fieldmap; cursor->srcpos != -1; ++cursor ) {
+      const vgx_ResponseFieldData_t *field = &entry[ cursor->srcpos ];
+      if( __json_field_double( cursor->attr, field->value, &real ) && (ret = __json_format_double( real, reprs[ field - search_result->list ] )) < 0 ) {
+        break;
+      }
+    }
+    entry += width;
+  }
+
+  free( fieldmap );
+  if( ret < 0 ) {
+    free( reprs );
+    return NULL;
+  }
+  return reprs;
 }
 
 
 
 /******************************************************************************
- * 
+ * Render search result without holding the GIL, letting other plugin calls
+ * run Python code while the response is produced. Only used when enabled by
+ * pyvgx.RenderWithoutGIL(). Small results are left to the regular path since
+ * releasing and reacquiring the GIL is not free.
  *
+ * Returns:  1 : rendered
+ *           0 : not rendered, nothing written
+ *          -1 : error
  ******************************************************************************
  */
-static int __render_bytes( const char *data, int64_t sz_data, vgx_StreamBuffer_t *output ) {
-  if( iStreamBuffer.Write( output, data, sz_data ) < 0 ) {
-    PyErr_SetString( PyExc_MemoryError, "out of memory" );
+static int __render_search_result_as_native_json( PyVGX_SearchResult *py_result, vgx_StreamBuffer_t *output ) {
+  if( !_render_without_gil ) {
+    return 0;
+  }
+
+  const vgx_SearchResult_t *search_result = __pyvgx_SearchResult_Native( py_result );
+  if( search_result == NULL || search_result->list == NULL || search_result->list_length < __JSON_NOGIL_MIN_ENTRIES ) {
+    return 0;
+  }
+
+  __json_writer_t W;
+  W.output = output;
+  W.nogil = true;
+  W.fields = search_result->list;
+  W.wp = W.chunk;
+  W.end = W.chunk + __JSON_CHUNK_SZ;
+
+  __json_repr_t *reprs = __json_format_search_result_doubles( search_result );
+  if( reprs == NULL ) {
     return -1;
   }
-  return 0;
+  W.reprs = reprs;
+
+  int ret = 0;
+  search_result = __pyvgx_SearchResult_Pin( py_result );
+  BEGIN_PYVGX_THREADS {
+    if( __json_search_result_encodable( search_result ) ) {
+      if( __json_write_search_result( &W, search_result ) < 0 || __json_flush( &W ) < 0 ) {
+        ret = -1;
+      }
+      else {
+        ret = 1;
+      }
+    }
+  } END_PYVGX_THREADS;
+  __pyvgx_SearchResult_Unpin( py_result );
+  free( reprs );
+
+  // Output and field map allocation are the only failures possible once
+  // the result has been verified
+  if( ret < 0 ) {
+    PyErr_SetString( PyExc_MemoryError, "out of memory" );
+  }
+  return ret;
 }
 
 
 
 /******************************************************************************
- * 
+ * Render object as JSON using the native encoder
  *
+ * Returns:  1 : rendered
+ *           0 : not natively encodable, nothing written
+ *          -1 : error
  ******************************************************************************
  */
-static int __render_pyunicode( PyObject *py_obj, vgx_StreamBuffer_t *output ) {
-  Py_ssize_t sz_data = 0;
-  const char *data = PyUnicode_AsUTF8AndSize( py_obj, &sz_data );
-  if( data ) {
-    return __render_bytes( data, sz_data, output );
+static int __render_pyobject_as_native_json( PyObject *py_obj, vgx_StreamBuffer_t *output ) {
+  PyVGX_PluginResponse *py_plugres = NULL;
+  if( PyVGX_SearchResult_CheckExact( py_obj ) ) {
+    int ret;
+    if( (ret = __render_search_result_as_native_json( (PyVGX_SearchResult*)py_obj, output )) != 0 ) {
+      return ret;
+    }
   }
-  PyErr_Clear();
-  PyObject *py_fallback = PyObject_Repr( py_obj );
-  if( py_fallback == NULL ) {
-    return -1;
+  else if( PyVGX_PluginResponse_CheckExact( py_obj ) ) {
+    py_plugres = (PyVGX_PluginResponse*)py_obj;
+    if( py_plugres->py_entries == NULL
+        ||
+        !__json_encodable( py_plugres->py_entries, 1 )
+        ||
+        (py_plugres->py_message && !__json_encodable( py_plugres->py_message, 1 )) )
+    {
+      return 0;
+    }
   }
+  else if( !__json_encodable( py_obj, 0 ) ) {
+    return 0;
+  }
+
+  __json_writer_t W;
+  W.output = output;
+  W.nogil = false;
+  W.fields = NULL;
+  W.reprs = NULL;
+  W.wp = W.chunk;
+  W.end = W.chunk + __JSON_CHUNK_SZ;
+
   int ret;
-  if( (data = PyUnicode_AsUTF8AndSize( py_fallback, &sz_data )) == NULL ) {
-    ret = -1;
+  if( py_plugres ) {
+    ret = __json_write_plugin_response( &W, py_plugres );
   }
   else {
-    ret = __render_bytes( data, sz_data, output );
+    ret = __json_write_value( &W, py_obj );
   }
-  Py_DECREF( py_fallback );
-  return ret;
+
+  if( ret < 0 || __json_flush( &W ) < 0 ) {
+    return -1;
+  }
+  return 1;
 }
 
 
 
 /******************************************************************************
- * 
+ *
  *
  ******************************************************************************
  */
 static int __render_pyobject_as_json( PyObject *py_obj, vgx_StreamBuffer_t *output ) {
   int ret;
+  if( (ret = __render_pyobject_as_native_json( py_obj, output )) != 0 ) {
+    return ret < 0 ? -1 : 0;
+  }
   PyObject *py_json;
   if( PyVGX_PluginResponse_CheckExact( py_obj ) ) {
     py_json = __pyvgx_PluginResponse_ToJSON( (PyVGX_PluginResponse*)py_obj );
@@ -105,6 +105,8 @@ static int __set_probe_condition__id_list(            PyObject *py_value,     vg
 static int __set_probe_condition__time_general(       PyObject *py_time_conditions, vgx_VertexCondition_t *vertex_condition, int64_t ref_ts );
 static int __set_probe_condition__abstime(            PyObject *py_time_conditions, vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context );
 static int __set_probe_condition__reltime(            PyObject *py_time_conditions, vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context );
+static int __set_probe_condition__geo(                PyObject *py_geo,       vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context );
+static int __set_probe_condition__text(               PyObject *py_text,      vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context );
 static int __set_probe_condition__property(           PyObject *py_property_conditions, vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context );
 static int __set_probe_condition__local_filter(       PyObject *py_value,     vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context );
 static int __set_probe_condition__post(               PyObject *py_value,     vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context );
@@ -2055,6 +2057,152 @@ static int __set_probe_condition__reltime( PyObject *py_time_conditions, vgx_Ver
 
 
 
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
+static int __set_probe_condition__geo( PyObject *py_geo, vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context ) {
+  int ret = 0;
+  /*
+  py_geo = ( <lat>, <lon>, <radius> )
+        or { 'lat':<lat>, 'lon':<lon>, 'radius':<radius> }
+  */
+
+  XTRY {
+    // Default positive match
+    bool positive = true;
+    PyObject *py_lat = NULL;
+    PyObject *py_lon = NULL;
+    PyObject *py_radius = NULL;
+
+    // Unwrap sign tuple (if applicable) and invert sign if false
+    __unwrap_signed_condition( &positive, &py_geo );
+
+    if( PyTuple_Check( py_geo ) && PyTuple_Size( py_geo ) == 3 ) {
+      py_lat = PyTuple_GET_ITEM( py_geo, 0 );
+      py_lon = PyTuple_GET_ITEM( py_geo, 1 );
+      py_radius = PyTuple_GET_ITEM( py_geo, 2 );
+    }
+    else if( PyDict_Check( py_geo ) ) {
+      py_lat = PyDict_GetItemString( py_geo, "lat" );
+      py_lon = PyDict_GetItemString( py_geo, "lon" );
+      py_radius = PyDict_GetItemString( py_geo, "radius" );
+    }
+
+    if( py_lat == NULL || py_lon == NULL || py_radius == NULL ) {
+      PyVGXError_SetString( PyVGX_QueryError, "geo condition must be (lat, lon, radius) or {'lat':<lat>, 'lon':<lon>, 'radius':<radius>}" );
+      THROW_SILENT( CXLIB_ERR_API, 0x7E1 );
+    }
+
+    double lat = PyFloat_AsDouble( py_lat );
+    double lon = PyFloat_AsDouble( py_lon );
+    double radius = PyFloat_AsDouble( py_radius );
+    if( PyErr_Occurred() ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x7E2 );
+    }
+
+    if( iVertexCondition.RequireGeo( vertex_condition, positive, lat, lon, radius ) < 0 ) {
+      PyErr_Format( PyVGX_QueryError, "Invalid geo condition: lat=%f lon=%f radius=%f", lat, lon, radius );
+      THROW_SILENT( CXLIB_ERR_API, 0x7E3 );
+    }
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+  }
+  XFINALLY {
+  }
+
+  return ret;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
+static int __set_probe_condition__text( PyObject *py_text, vgx_VertexCondition_t *vertex_condition, __probe_condition_context_t *context ) {
+  int ret = 0;
+  /*
+  py_text = ( <key>, <terms> [, <mode>] )
+         or { 'key':<key>, 'terms':<terms> [, 'mode':<mode>] }
+
+  <mode> = 'all' | 'any' | 'phrase'
+  */
+
+  XTRY {
+    // Default positive match
+    bool positive = true;
+    PyObject *py_key = NULL;
+    PyObject *py_terms = NULL;
+    PyObject *py_mode = NULL;
+
+    // Unwrap sign tuple (if applicable) and invert sign if false
+    __unwrap_signed_condition( &positive, &py_text );
+
+    if( PyTuple_Check( py_text ) && (PyTuple_Size( py_text ) == 2 || PyTuple_Size( py_text ) == 3) ) {
+      py_key = PyTuple_GET_ITEM( py_text, 0 );
+      py_terms = PyTuple_GET_ITEM( py_text, 1 );
+      if( PyTuple_Size( py_text ) == 3 ) {
+        py_mode = PyTuple_GET_ITEM( py_text, 2 );
+      }
+    }
+    else if( PyDict_Check( py_text ) ) {
+      py_key = PyDict_GetItemString( py_text, "key" );
+      py_terms = PyDict_GetItemString( py_text, "terms" );
+      py_mode = PyDict_GetItemString( py_text, "mode" );
+    }
+
+    if( py_key == NULL || py_terms == NULL || !PyVGX_PyObject_CheckString( py_key ) || !PyVGX_PyObject_CheckString( py_terms ) ) {
+      PyVGXError_SetString( PyVGX_QueryError, "text condition must be (key, terms[, mode]) or {'key':<key>, 'terms':<terms>[, 'mode':<mode>]}" );
+      THROW_SILENT( CXLIB_ERR_API, 0x7E4 );
+    }
+
+    const char *key = PyVGX_PyObject_AsUTF8( py_key, "key" );
+    const char *terms = PyVGX_PyObject_AsUTF8( py_terms, "terms" );
+    if( key == NULL || terms == NULL ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x7E5 );
+    }
+
+    vgx_TextMatchMode mode = VGX_TEXT_MATCH_ALL;
+    if( py_mode ) {
+      const char *smode = PyVGX_PyObject_CheckString( py_mode ) ? PyVGX_PyObject_AsString( py_mode ) : NULL;
+      if( smode && CharsEqualsConst( smode, "all" ) ) {
+        mode = VGX_TEXT_MATCH_ALL;
+      }
+      else if( smode && CharsEqualsConst( smode, "any" ) ) {
+        mode = VGX_TEXT_MATCH_ANY;
+      }
+      else if( smode && CharsEqualsConst( smode, "phrase" ) ) {
+        mode = VGX_TEXT_MATCH_PHRASE;
+      }
+      else {
+        PyErr_Clear();
+        PyVGXError_SetString( PyVGX_QueryError, "text condition mode must be 'all', 'any' or 'phrase'" );
+        THROW_SILENT( CXLIB_ERR_API, 0x7E6 );
+      }
+    }
+
+    if( iVertexCondition.RequireText( vertex_condition, positive, key, terms, mode ) < 0 ) {
+      PyErr_Format( PyVGX_QueryError, "Invalid text condition: key=%s terms=%s", key, terms );
+      THROW_SILENT( CXLIB_ERR_API, 0x7E7 );
+    }
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+  }
+  XFINALLY {
+  }
+
+  return ret;
+}
+
+
+
 /******************************************************************************
  *
  *
@@ -2603,6 +2751,8 @@ static framehash_cell_t * __new_vertex_condition_keymap( framehash_dynamic_t *dy
     iMapping.IntegerMapAdd( &map, dyn, "id",         (int64_t)__set_probe_condition__id );
     iMapping.IntegerMapAdd( &map, dyn, "abstime",    (int64_t)__set_probe_condition__abstime );
     iMapping.IntegerMapAdd( &map, dyn, "reltime",    (int64_t)__set_probe_condition__reltime );
+    iMapping.IntegerMapAdd( &map, dyn, "geo",        (int64_t)__set_probe_condition__geo );
+    iMapping.IntegerMapAdd( &map, dyn, "text",       (int64_t)__set_probe_condition__text );
     iMapping.IntegerMapAdd( &map, dyn, "property",   (int64_t)__set_probe_condition__property );
     
     iMapping.IntegerMapAdd( &map, dyn, "traverse",   (int64_t)__set_probe_condition__traverse );
@@ -1352,6 +1352,45 @@ static PyObject * _ipyvgx_search_result__py_result_list_from_search_result( vgx_
 
 
 
+/******************************************************************************
+ * Return true if the search result can be kept in its native form and
+ * rendered later. Results holding vectors, properties or vertex references
+ * depend on graph state beyond the result itself and are always rendered
+ * immediately.
+ *
+ ******************************************************************************
+ */
+static bool _ipyvgx_search_result__is_deferrable( const vgx_SearchResult_t *search_result, bool nested ) {
+  static const vgx_ResponseAttrFastMask immediate = VGX_RESPONSE_ATTRS_PROPERTIES
+                                                  | VGX_RESPONSE_ATTR__P_RSV
+                                                  | VGX_RESPONSE_ATTR_AS_ENUM
+                                                  | VGX_RESPONSE_ATTR__R_RSV
+                                                  | VGX_RESPONSE_ATTR__T_RSV
+                                                  | VGX_RESPONSE_ATTR_RAW_VERTEX
+                                                  | VGX_RESPONSE_SHOW_WITH_MASK;
+  if( nested ) {
+    return false;
+  }
+  return (search_result->list_fields.fastmask & immediate) == 0;
+}
+
+
+
+/******************************************************************************
+ * Return a new fieldmap for the search result, or NULL if the result has
+ * no entries or is shown as strings. Caller owns the fieldmap.
+ *
+ ******************************************************************************
+ */
+static vgx_ResponseFieldMap_t * _ipyvgx_search_result__new_fieldmap( const vgx_SearchResult_t *search_result ) {
+  if( search_result->list_length > 0 && search_result->list && !vgx_response_show_as_string( search_result->list_fields.fastmask ) ) {
+    return iGraphResponse.NewFieldMap( search_result->list, search_result->list_width, pyobj_fieldmap_definition );
+  }
+  return NULL;
+}
+
+
+
 /******************************************************************************
  *
  *
@@ -1395,8 +1434,53 @@ static PyObject * _ipyvgx_search_result__py_dict_from_vertex_properties( vgx_Ver
  *
  ******************************************************************************
  */
+/******************************************************************************
+ * _ipyvgx_search_result__add_cursor_metas
+ * Add "cursor" (next page token or None) and "cursors" (token per listed
+ * item) to a result dict when the query pages by cursor.
+ ******************************************************************************
+ */
+static int _ipyvgx_search_result__add_cursor_metas( PyObject *py_dict, const vgx_SearchResult_t *search_result ) {
+  if( !search_result->next_cursor.enabled ) {
+    return 0;
+  }
+
+  char token[ VGX_COLLECTOR_CURSOR_TOKEN_SIZE ];
+  PyObject *py_next;
+  if( iGraphResponse.EncodeCursor( &search_result->next_cursor, token ) != NULL ) {
+    py_next = PyUnicode_FromString( token );
+  }
+  else {
+    py_next = Py_None;
+    Py_INCREF( py_next );
+  }
+  if( py_next == NULL || PyVGX_DictStealItemString( py_dict, "cursor", py_next ) < 0 ) {
+    return -1;
+  }
+
+  int64_t n = search_result->cursors ? search_result->list_length : 0;
+  PyObject *py_cursors = PyList_New( n );
+  if( py_cursors == NULL ) {
+    return -1;
+  }
+  for( int64_t i=0; i<n; i++ ) {
+    PyObject *py_token;
+    if( iGraphResponse.EncodeCursor( &search_result->cursors[i], token ) == NULL || (py_token = PyUnicode_FromString( token )) == NULL ) {
+      Py_DECREF( py_cursors );
+      return -1;
+    }
+    PyList_SET_ITEM( py_cursors, i, py_token );
+  }
+  return PyVGX_DictStealItemString( py_dict, "cursors", py_cursors );
+}
+
+
+
 DLL_HIDDEN IPyVGXSearchResult iPyVGXSearchResult = {
   .PyResultList_FromSearchResult      = _ipyvgx_search_result__py_result_list_from_search_result,
   .PyPredicatorValue_FromArcHead      = _ipyvgx_search_result__py_predicator_val_from_archead,
-  .PyDict_FromVertexProperties        = _ipyvgx_search_result__py_dict_from_vertex_properties
+  .PyDict_FromVertexProperties        = _ipyvgx_search_result__py_dict_from_vertex_properties,
+  .IsDeferrable                       = _ipyvgx_search_result__is_deferrable,
+  .NewFieldMap                        = _ipyvgx_search_result__new_fieldmap,
+  .AddCursorMetas                     = _ipyvgx_search_result__add_cursor_metas
 };
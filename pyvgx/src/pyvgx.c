@@ -73,6 +73,7 @@ DLL_HIDDEN PyObject *g_py_plugins = NULL;
 DLL_HIDDEN PyObject *g_py_cfdispatcher = NULL;
 
 DLL_HIDDEN bool _auto_arc_timestamps = false;
+DLL_HIDDEN bool _render_without_gil = false;
 
 DLL_HIDDEN PyObject * g_py_zero = NULL;
 DLL_HIDDEN PyObject * g_py_one = NULL;
@@ -1924,6 +1925,27 @@ static PyObject * PyVGX_AutoArcTimestamps( PyObject *self, PyObject *py_enable )
 
 
 
+/******************************************************************************
+ * PyVGX_RenderWithoutGIL
+ *
+ ******************************************************************************
+ */
+SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
+static PyObject * PyVGX_RenderWithoutGIL( PyObject *self, PyObject *py_enable ) {
+
+  if( PyBool_Check(py_enable) || PyLong_Check( py_enable ) ) {
+    _render_without_gil = PyLong_AsLong( py_enable ) != 0;
+  }
+  else {
+    PyErr_SetString( PyExc_TypeError, "an integer is required" );
+    return NULL;
+  }
+
+  Py_RETURN_NONE;
+}
+
+
+
 
 /*******************************************************************//**
  *
@@ -1989,6 +2011,7 @@ static PyMethodDef pyvgx_methods[] = {
   {"LogTimestamp",        (PyCFunction)PyVGX_LogTimestamp,      METH_VARARGS | METH_KEYWORDS,   "LogTimestamp( message, ts=<now>, clf=False ) -> None"  },
 
   {"AutoArcTimestamps",   (PyCFunction)PyVGX_AutoArcTimestamps, METH_O,                         "AutoArcTimestamps( enable=False ) -> None" },
+  {"RenderWithoutGIL",    (PyCFunction)PyVGX_RenderWithoutGIL,  METH_O,                         "RenderWithoutGIL( enable=False ) -> None" },
 
   {NULL}  /* Sentinel */
 };
@@ -2500,6 +2523,7 @@ int init_PyVGX( PyObject *module ) {
   Py_SET_TYPE( p_PyVGX_PluginRequestType, &PyType_Type);
   Py_SET_TYPE( p_PyVGX_PluginResponseType, &PyType_Type);
   Py_SET_TYPE( p_PyVGX_Query__QueryType, &PyType_Type);
+  Py_SET_TYPE( p_PyVGX_SearchResultType, &PyType_Type);
   Py_SET_TYPE( p_PyVGX_System__SystemType, &PyType_Type);
   Py_SET_TYPE( p_PyVGX_Operation__OperationType, &PyType_Type);
 
@@ -2544,6 +2568,10 @@ int init_PyVGX( PyObject *module ) {
     return -1;
   }
 
+  if( PyType_Ready(p_PyVGX_SearchResultType) < 0 ) {
+    return -1;
+  }
+
   p_PyVGX_System__SystemType->tp_dict = PyVGX_System_GetNewConstantsDict();
 
   if( PyType_Ready(p_PyVGX_System__SystemType) < 0 ) {
@@ -2631,6 +2659,13 @@ int init_PyVGX( PyObject *module ) {
     return -1;
   }
 
+  // Search Result
+  Py_INCREF( p_PyVGX_SearchResultType );
+  if( PyModule_AddObject( module, "SearchResult", (PyObject*)p_PyVGX_SearchResultType ) < 0 ) {
+    Py_DECREF( p_PyVGX_SearchResultType );
+    return -1;
+  }
+
   // Operation
   Py_INCREF( p_PyVGX_Operation__OperationType );
   if( PyModule_AddObject( module, "Operation", (PyObject*)p_PyVGX_Operation__OperationType ) < 0 ) {
@@ -2189,6 +2189,321 @@ static PyObject * PyVGX_Graph__Connect( PyVGX_Graph *pygraph, PyObject *args, Py
 
 
 
+/******************************************************************************
+ * __set_mutation_property
+ *
+ ******************************************************************************
+ */
+static int __set_mutation_property( vgx_Graph_t *graph, PyObject *py_key, PyObject *py_value, vgx_VertexProperty_t *vertex_property ) {
+  const char *name = PyVGX_PyObject_AsString( py_key );
+  if( name == NULL ) {
+    if( !PyErr_Occurred() ) {
+      PyErr_SetString( PyExc_TypeError, "property key must be a string" );
+    }
+    return -1;
+  }
+  return pyvgx_NewVertexProperty( graph, name, py_value, NULL, vertex_property );
+}
+
+
+
+/******************************************************************************
+ * __get_mutation_arg
+ *
+ ******************************************************************************
+ */
+static PyObject * __get_mutation_arg( PyObject *py_arg, Py_ssize_t n, const char *name ) {
+  PyObject *py_seq = PySequence_Fast( py_arg, name );
+  if( py_seq && PySequence_Fast_GET_SIZE( py_seq ) != n ) {
+    PyErr_Format( PyExc_ValueError, "%s: expected %lld items, got %lld", name, (int64_t)n, (int64_t)PySequence_Fast_GET_SIZE( py_seq ) );
+    Py_DECREF( py_seq );
+    return NULL;
+  }
+  return py_seq;
+}
+
+
+
+/******************************************************************************
+ * PyVGX_Graph__Mutate
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( Mutate__doc__,
+  "Mutate( ids, arcs=None, terminals=None, properties=None, vectors=None, lifespan=-1, timeout=0 ) -> list\n"
+  "\n"
+  "Apply a batch of mutations. Mutations are grouped by vertex and all vertices\n"
+  "are acquired atomically, so each vertex is acquired, modified and committed\n"
+  "once for the whole batch.\n"
+  "\n"
+  "ids        : List of N vertex IDs. Vertices are created if they do not exist.\n"
+  "arcs       : Arc specification for all connections, or list of N arc\n"
+  "             specifications\n"
+  "terminals  : List of N terminal IDs (or None) to connect from ids[i]\n"
+  "properties : List of N dicts (or None) of properties to set on ids[i]\n"
+  "vectors    : List of N vectors (or None) to set on ids[i]\n"
+  "lifespan   : Number of seconds arcs will exist until automatically deleted\n"
+  "timeout    : Timeout (in milliseconds) for acquiring writable access to\n"
+  "             all vertices, and to each terminal\n"
+  "\n"
+  "Returns a list of N results, where item i is 1 if a new arc was created\n"
+  "from ids[i], 0 if no new arc was created, or the exception instance\n"
+  "describing why a mutation of ids[i] failed.\n"
+  "\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__Mutate
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__Mutate( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  static char *kwlist[] = {"ids", "arcs", "terminals", "properties", "vectors", "lifespan", "timeout", NULL};
+
+  PyObject *py_ids = NULL;
+  PyObject *py_arcs = NULL;
+  PyObject *py_terminals = NULL;
+  PyObject *py_properties = NULL;
+  PyObject *py_vectors = NULL;
+  int lifespan = -1;
+  int timeout_ms = 0;
+
+  if( !PyArg_ParseTupleAndKeywords(args, kwds, "O|OOOOii", kwlist, &py_ids, &py_arcs, &py_terminals, &py_properties, &py_vectors, &lifespan, &timeout_ms ) ) {
+    return NULL;
+  }
+
+  PyObject *py_ret = NULL;
+  PyObject *py_id_seq = NULL;
+  PyObject *py_arc_seq = NULL;
+  PyObject *py_terminal_seq = NULL;
+  PyObject *py_property_seq = NULL;
+  PyObject *py_vector_seq = NULL;
+
+  CString_t **CSTR__ids = NULL;
+  vgx_Mutation_t *items = NULL;
+  vgx_VertexProperty_t *properties = NULL;
+  int64_t *entries = NULL;
+  int64_t n_items = 0;
+  CString_t *CSTR__error = NULL;
+
+  XTRY {
+    // Arguments
+    if( (py_id_seq = PySequence_Fast( py_ids, "ids must be a sequence" )) == NULL ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x271 );
+    }
+    Py_ssize_t n = PySequence_Fast_GET_SIZE( py_id_seq );
+    if( py_arcs && PyList_Check( py_arcs ) && (py_arc_seq = __get_mutation_arg( py_arcs, n, "arcs" )) == NULL ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x272 );
+    }
+    if( py_terminals && py_terminals != Py_None && (py_terminal_seq = __get_mutation_arg( py_terminals, n, "terminals" )) == NULL ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x273 );
+    }
+    if( py_properties && py_properties != Py_None && (py_property_seq = __get_mutation_arg( py_properties, n, "properties" )) == NULL ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x274 );
+    }
+    if( py_vectors && py_vectors != Py_None && (py_vector_seq = __get_mutation_arg( py_vectors, n, "vectors" )) == NULL ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x275 );
+    }
+
+    // Count items
+    int64_t n_max = 0;
+    for( Py_ssize_t i=0; i<n; i++ ) {
+      if( py_property_seq ) {
+        PyObject *py_props = PySequence_Fast_GET_ITEM( py_property_seq, i );
+        if( py_props != Py_None ) {
+          if( !PyDict_Check( py_props ) ) {
+            PyErr_SetString( PyExc_TypeError, "properties must be dict or None" );
+            THROW_SILENT( CXLIB_ERR_API, 0x276 );
+          }
+          n_max += PyDict_Size( py_props );
+        }
+      }
+      n_max += 2; // vector, connect
+    }
+
+    if( (CSTR__ids = calloc( n + 1, sizeof( CString_t* ) )) == NULL
+        ||
+        (items = calloc( n_max + 1, sizeof( vgx_Mutation_t ) )) == NULL
+        ||
+        (properties = calloc( n_max + 1, sizeof( vgx_VertexProperty_t ) )) == NULL
+        ||
+        (entries = calloc( n_max + 1, sizeof( int64_t ) )) == NULL )
+    {
+      PyErr_SetNone( PyExc_MemoryError );
+      THROW_SILENT( CXLIB_ERR_MEMORY, 0x277 );
+    }
+
+    // Build items
+    for( Py_ssize_t i=0; i<n; i++ ) {
+      pyvgx_VertexIdentifier_t ident;
+      __pyvgx_reset_vertex_identifier( &ident );
+      if( iPyVGXParser.GetVertexID( pygraph, PySequence_Fast_GET_ITEM( py_id_seq, i ), &ident, NULL, false, "Vertex ID" ) < 0 ) {
+        THROW_SILENT( CXLIB_ERR_API, 0x278 );
+      }
+      if( (CSTR__ids[i] = NewEphemeralCString( graph, ident.id )) == NULL ) {
+        PyErr_SetNone( PyExc_MemoryError );
+        THROW_SILENT( CXLIB_ERR_MEMORY, 0x279 );
+      }
+
+      // Properties
+      PyObject *py_props = py_property_seq ? PySequence_Fast_GET_ITEM( py_property_seq, i ) : Py_None;
+      if( py_props != Py_None ) {
+        Py_ssize_t pos = 0;
+        PyObject *py_key;
+        PyObject *py_value;
+        while( PyDict_Next( py_props, &pos, &py_key, &py_value ) ) {
+          vgx_Mutation_t *item = &items[ n_items ];
+          entries[ n_items++ ] = i;
+          item->type = VGX_MUTATION_SET_PROPERTY;
+          item->CSTR__idstr = CSTR__ids[i];
+          item->property = &properties[ n_items-1 ];
+          if( __set_mutation_property( graph, py_key, py_value, item->property ) < 0 ) {
+            THROW_SILENT( CXLIB_ERR_API, 0x27A );
+          }
+        }
+      }
+
+      // Vector
+      PyObject *py_vector = py_vector_seq ? PySequence_Fast_GET_ITEM( py_vector_seq, i ) : Py_None;
+      if( py_vector != Py_None ) {
+        vgx_Mutation_t *item = &items[ n_items ];
+        entries[ n_items++ ] = i;
+        item->type = VGX_MUTATION_SET_VECTOR;
+        item->CSTR__idstr = CSTR__ids[i];
+        if( (item->vector = iPyVGXParser.InternalVectorFromPyObject( graph->similarity, py_vector, NULL, false )) == NULL ) {
+          THROW_SILENT( CXLIB_ERR_API, 0x27B );
+        }
+      }
+
+      // Connect
+      PyObject *py_terminal = py_terminal_seq ? PySequence_Fast_GET_ITEM( py_terminal_seq, i ) : Py_None;
+      if( py_terminal != Py_None ) {
+        pyvgx_VertexIdentifier_t terminal_ident;
+        __pyvgx_reset_vertex_identifier( &terminal_ident );
+        if( iPyVGXParser.GetVertexID( pygraph, py_terminal, &terminal_ident, NULL, false, "Terminal ID" ) < 0 ) {
+          THROW_SILENT( CXLIB_ERR_API, 0x27C );
+        }
+        PyObject *py_arc = py_arc_seq ? PySequence_Fast_GET_ITEM( py_arc_seq, i ) : py_arcs;
+        vgx_Mutation_t *item = &items[ n_items ];
+        entries[ n_items++ ] = i;
+        item->type = VGX_MUTATION_CONNECT;
+        item->lifespan = lifespan;
+        if( (item->relation = iPyVGXParser.NewRelation( graph, ident.id, py_arc, terminal_ident.id )) == NULL ) {
+          THROW_SILENT( CXLIB_ERR_API, 0x27D );
+        }
+        // Lifespan implies timestamps
+        if( lifespan > -1 ) {
+          iRelation.AutoTimestamps( item->relation );
+        }
+      }
+    }
+
+    // Apply
+    int64_t n_failed;
+    BEGIN_PYVGX_THREADS {
+      n_failed = CALLABLE( graph )->advanced->MutateBatch( graph, items, n_items, timeout_ms, &CSTR__error );
+    } END_PYVGX_THREADS;
+
+    if( n_failed < 0 ) {
+      iPyVGXBuilder.SetPyErrorFromAccessReason( NULL, VGX_ACCESS_REASON_ERROR, &CSTR__error );
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0x27E );
+    }
+
+    // Per-item results
+    if( (py_ret = PyList_New( n )) == NULL ) {
+      THROW_SILENT( CXLIB_ERR_MEMORY, 0x27F );
+    }
+    for( Py_ssize_t i=0; i<n; i++ ) {
+      PyList_SET_ITEM( py_ret, i, PyLong_FromLong( 0 ) );
+    }
+    for( int64_t k=0; k<n_items; k++ ) {
+      vgx_Mutation_t *item = &items[k];
+      Py_ssize_t i = entries[k];
+      PyObject *py_current = PyList_GET_ITEM( py_ret, i );
+      if( !PyLong_CheckExact( py_current ) ) {
+        continue; // already failed
+      }
+      PyObject *py_result = NULL;
+      if( item->result < 0 ) {
+        PyObject *py_typ=NULL, *py_val=NULL, *py_tb=NULL;
+        if( item->type == VGX_MUTATION_CONNECT ) {
+          __py_set_vertex_pair_error_ident( pygraph, PySequence_Fast_GET_ITEM( py_id_seq, i ), PySequence_Fast_GET_ITEM( py_terminal_seq, i ), item->reason, &item->CSTR__error );
+        }
+        else {
+          iPyVGXBuilder.SetPyErrorFromAccessReason( CStringValue( CSTR__ids[i] ), item->reason, &item->CSTR__error );
+        }
+        PyErr_Fetch( &py_typ, &py_val, &py_tb );
+        PyErr_NormalizeException( &py_typ, &py_val, &py_tb );
+        Py_XDECREF( py_typ );
+        Py_XDECREF( py_tb );
+        py_result = py_val;
+      }
+      else if( item->type == VGX_MUTATION_CONNECT && item->result > 0 ) {
+        py_result = PyLong_FromLong( item->result );
+      }
+      if( py_result ) {
+        PyList_SET_ITEM( py_ret, i, py_result );
+        Py_DECREF( py_current );
+      }
+    }
+  }
+  XCATCH( errcode ) {
+    PyVGX_XDECREF( py_ret );
+    py_ret = NULL;
+    if( !PyErr_Occurred() ) {
+      PyErr_Format( PyVGX_InternalError, "internal error %03x", errcode );
+    }
+  }
+  XFINALLY {
+    if( items ) {
+      for( int64_t k=0; k<n_items; k++ ) {
+        vgx_Mutation_t *item = &items[k];
+        switch( item->type ) {
+        case VGX_MUTATION_CONNECT:
+          iRelation.Delete( &item->relation );
+          break;
+        case VGX_MUTATION_SET_PROPERTY:
+          pyvgx_ClearVertexProperty( item->property );
+          break;
+        case VGX_MUTATION_SET_VECTOR:
+          // Discard if not stolen
+          if( item->vector ) {
+            CALLABLE( item->vector )->Decref( item->vector );
+          }
+          break;
+        default:
+          break;
+        }
+        iString.Discard( &item->CSTR__error );
+      }
+      free( items );
+    }
+    free( properties );
+    free( entries );
+    if( CSTR__ids ) {
+      for( CString_t **cursor = CSTR__ids; *cursor; ++cursor ) {
+        iString.Discard( cursor );
+      }
+      free( CSTR__ids );
+    }
+    iString.Discard( &CSTR__error );
+    PyVGX_XDECREF( py_id_seq );
+    PyVGX_XDECREF( py_arc_seq );
+    PyVGX_XDECREF( py_terminal_seq );
+    PyVGX_XDECREF( py_property_seq );
+    PyVGX_XDECREF( py_vector_seq );
+  }
+
+  return py_ret;
+}
+
+
+
 /******************************************************************************
  * PyVGX_Graph__Disconnect
  *
@@ -3970,6 +4285,346 @@ static PyObject * PyVGX_Graph__ResetSerial( PyVGX_Graph *pygraph, PyObject *args
 
 
 
+/******************************************************************************
+ * PyVGX_Graph__FreezeArcs
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( FreezeArcs__doc__,
+  "FreezeArcs( min_degree=64 ) -> (n_frozen, bytes, n_oversized)\n"
+  "\n"
+  "Convert arc arrays with at least min_degree arcs into a compact read-only\n"
+  "encoding. Vertices currently acquired by any thread are skipped. Arc arrays\n"
+  "with multiple arcs to the same neighbor are not frozen. Arc arrays exceeding\n"
+  "the capacity of the frozen encoding (roughly 75k to 1M arcs, or more than 256\n"
+  "distinct relationship/modifier combinations) are left unchanged.\n"
+  "\n"
+  "Frozen arc arrays are thawed automatically when modified. The frozen state is\n"
+  "not persisted; arcs are always saved and loaded in mutable form.\n"
+  "\n"
+  "Returns the number of frozen arc arrays, their total size in bytes, and the\n"
+  "number of arc arrays left unchanged because they exceed frozen capacity.\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__FreezeArcs
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__FreezeArcs( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  static char *kwlist[] = { "min_degree", NULL };
+
+  int64_t min_degree = 64;
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|L", kwlist, &min_degree ) ) {
+    return NULL;
+  }
+
+  int64_t n_frozen;
+  int64_t n_bytes = 0;
+  int64_t n_oversized = 0;
+  BEGIN_PYVGX_THREADS {
+    n_frozen = CALLABLE( graph )->advanced->FreezeArcs( graph, min_degree, &n_bytes, &n_oversized );
+  } END_PYVGX_THREADS;
+
+  if( n_frozen < 0 ) {
+    PyErr_SetString( PyVGX_AccessError, "Cannot freeze arcs (graph is readonly or internal error)" );
+    return NULL;
+  }
+
+  return Py_BuildValue( "(LLL)", n_frozen, n_bytes, n_oversized );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_Graph__ThawArcs
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( ThawArcs__doc__,
+  "ThawArcs() -> long\n"
+  "\n"
+  "Convert all frozen arc arrays back to mutable form. Vertices currently\n"
+  "acquired by any thread are skipped.\n"
+  "\n"
+  "Returns the number of arc arrays thawed.\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__ThawArcs
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__ThawArcs( PyVGX_Graph *pygraph ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  int64_t n_thawed;
+  BEGIN_PYVGX_THREADS {
+    n_thawed = CALLABLE( graph )->advanced->ThawArcs( graph );
+  } END_PYVGX_THREADS;
+
+  if( n_thawed < 0 ) {
+    PyErr_SetString( PyVGX_AccessError, "Cannot thaw arcs (graph is readonly or internal error)" );
+    return NULL;
+  }
+
+  return PyLong_FromLongLong( n_thawed );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_Graph__CreateGeoIndex
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( CreateGeoIndex__doc__,
+  "CreateGeoIndex( lat='lat', lon='lon' ) -> long\n"
+  "\n"
+  "Index vertex positions given by numeric properties lat and lon (degrees)\n"
+  "for use with the 'geo' vertex condition. Any previous geo index is replaced.\n"
+  "\n"
+  "The geo index is maintained automatically as properties and vertices are\n"
+  "modified. It is not persisted and must be created again after the graph\n"
+  "is loaded.\n"
+  "\n"
+  "Returns the number of indexed vertices.\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__CreateGeoIndex
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__CreateGeoIndex( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  static char *kwlist[] = { "lat", "lon", NULL };
+
+  const char *lat_key = "lat";
+  const char *lon_key = "lon";
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|ss", kwlist, &lat_key, &lon_key ) ) {
+    return NULL;
+  }
+
+  int64_t n_indexed;
+  CString_t *CSTR__error = NULL;
+  BEGIN_PYVGX_THREADS {
+    n_indexed = CALLABLE( graph )->advanced->CreateGeoIndex( graph, lat_key, lon_key, &CSTR__error );
+  } END_PYVGX_THREADS;
+
+  if( n_indexed < 0 ) {
+    PyVGXError_SetString( PyVGX_AccessError, CSTR__error ? CStringValue( CSTR__error ) : "Cannot create geo index" );
+    iString.Discard( &CSTR__error );
+    return NULL;
+  }
+
+  return PyLong_FromLongLong( n_indexed );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_Graph__DropGeoIndex
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( DropGeoIndex__doc__,
+  "DropGeoIndex() -> bool\n"
+  "\n"
+  "Remove the geo index. Returns True if a geo index existed.\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__DropGeoIndex
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__DropGeoIndex( PyVGX_Graph *pygraph ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  int dropped;
+  BEGIN_PYVGX_THREADS {
+    dropped = CALLABLE( graph )->advanced->DropGeoIndex( graph );
+  } END_PYVGX_THREADS;
+
+  if( dropped < 0 ) {
+    PyErr_SetString( PyVGX_AccessError, "Cannot drop geo index (graph is readonly)" );
+    return NULL;
+  }
+
+  return PyBool_FromLong( dropped );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_Graph__CreateTextIndex
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( CreateTextIndex__doc__,
+  "CreateTextIndex( key ) -> long\n"
+  "\n"
+  "Index the words in string property key for use with the 'text' vertex\n"
+  "condition and the bm25() evaluator function. Any previous text index for\n"
+  "the same key is replaced.\n"
+  "\n"
+  "The text index is maintained automatically as properties and vertices are\n"
+  "modified. It is not persisted and must be created again after the graph\n"
+  "is loaded.\n"
+  "\n"
+  "Returns the number of indexed vertices.\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__CreateTextIndex
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__CreateTextIndex( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  static char *kwlist[] = { "key", NULL };
+
+  const char *key = NULL;
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "s", kwlist, &key ) ) {
+    return NULL;
+  }
+
+  int64_t n_indexed;
+  CString_t *CSTR__error = NULL;
+  BEGIN_PYVGX_THREADS {
+    n_indexed = CALLABLE( graph )->advanced->CreateTextIndex( graph, key, &CSTR__error );
+  } END_PYVGX_THREADS;
+
+  if( n_indexed < 0 ) {
+    PyVGXError_SetString( PyVGX_AccessError, CSTR__error ? CStringValue( CSTR__error ) : "Cannot create text index" );
+    iString.Discard( &CSTR__error );
+    return NULL;
+  }
+
+  return PyLong_FromLongLong( n_indexed );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_Graph__DropTextIndex
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( DropTextIndex__doc__,
+  "DropTextIndex( key=None ) -> bool\n"
+  "\n"
+  "Remove the text index for key, or all text indexes if key is None.\n"
+  "Returns True if a text index existed.\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__DropTextIndex
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__DropTextIndex( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  static char *kwlist[] = { "key", NULL };
+
+  const char *key = NULL;
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|z", kwlist, &key ) ) {
+    return NULL;
+  }
+
+  int dropped;
+  BEGIN_PYVGX_THREADS {
+    dropped = CALLABLE( graph )->advanced->DropTextIndex( graph, key );
+  } END_PYVGX_THREADS;
+
+  if( dropped < 0 ) {
+    PyErr_SetString( PyVGX_AccessError, "Cannot drop text index (graph is readonly)" );
+    return NULL;
+  }
+
+  return PyBool_FromLong( dropped );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_Graph__ParallelTraversal
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( ParallelTraversal__doc__,
+  "ParallelTraversal( min_degree=-1, workers=-1 ) -> (min_degree, workers)\n"
+  "\n"
+  "Configure parallel traversal of high degree vertices. When the graph is\n"
+  "readonly, Neighborhood() queries collecting arcs in a single direction from\n"
+  "an anchor with at least min_degree arcs split the arc array across workers\n"
+  "threads and merge the partial top-k results. Queries using cull or\n"
+  "expressions with memory, synthetic arcs or other state run serially.\n"
+  "\n"
+  "A negative value leaves the corresponding setting unchanged. Set workers\n"
+  "to 0 or 1 to disable parallel traversal.\n"
+  "\n"
+  "Returns the current settings.\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__ParallelTraversal
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__ParallelTraversal( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  static char *kwlist[] = { "min_degree", "workers", NULL };
+
+  int min_degree = -1;
+  int workers = -1;
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|ii", kwlist, &min_degree, &workers ) ) {
+    return NULL;
+  }
+
+  int ret;
+  BEGIN_PYVGX_THREADS {
+    ret = CALLABLE( graph )->advanced->ParallelTraversal( graph, min_degree, workers, &min_degree, &workers );
+  } END_PYVGX_THREADS;
+
+  if( ret < 0 ) {
+    PyErr_Format( PyExc_ValueError, "workers cannot exceed %d", VGX_PARALLEL_TRAVERSAL_MAX_WORKERS );
+    return NULL;
+  }
+
+  return Py_BuildValue( "(ii)", min_degree, workers );
+}
+
+
+
 /******************************************************************************
  *
  *
@@ -5165,7 +5820,7 @@ static PyObject * PyVGX_Graph__Erase( PyVGX_Graph *pygraph ) {
  ******************************************************************************
  */
 PyDoc_STRVAR( Save__doc__,
-  "Save( timeout=1000, force=False, remote=False ) -> long\n"
+  "Save( timeout=1000, force=False, remote=False, background=False ) -> long\n"
   "\n"
   "Persist graph to disk. The optional timeout (in milliseconds) allows blocking\n"
   "while waiting for the graph to become idle in order for the operation to proceed.\n"
@@ -5181,6 +5836,12 @@ PyDoc_STRVAR( Save__doc__,
   "By default data is persisted on the local host only. To trigger persist in\n"
   "attached instances set remote=True.\n"
   "\n"
+  "With background=True the graph is readonly only while a point-in-time\n"
+  "snapshot is taken. The snapshot is written to disk by a separate process\n"
+  "while the graph remains writable, and Save() returns when it is complete.\n"
+  "Transactions applied after the snapshot are replayed from the transaction\n"
+  "log on restore. Cannot be combined with force=True.\n"
+  "\n"
 );
 
 /**************************************************************************//**
@@ -5194,12 +5855,18 @@ static PyObject * PyVGX_Graph__Save( PyVGX_Graph *pygraph, PyObject *args, PyObj
     return NULL;
   }
 
-  static char *kwlist[] = { "timeout", "force", "remote", NULL };
+  static char *kwlist[] = { "timeout", "force", "remote", "background", NULL };
 
   int timeout_ms = 1000;
   int force = false;
   int remote = false;
-  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|iii", kwlist, &timeout_ms, &force, &remote ) ) {
+  int background = false;
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|iiii", kwlist, &timeout_ms, &force, &remote, &background ) ) {
+    return NULL;
+  }
+
+  if( force && background ) {
+    PyErr_SetString( PyExc_ValueError, "force=True cannot be used with background=True" );
     return NULL;
   }
 
@@ -5208,7 +5875,12 @@ static PyObject * PyVGX_Graph__Save( PyVGX_Graph *pygraph, PyObject *args, PyObj
   int64_t nqwords = 0;
 
   XTRY {
-    nqwords = iPyVGXPersist.Serialize( graph, timeout_ms, force > 0, remote > 0 );
+    if( background ) {
+      nqwords = iPyVGXPersist.SerializeBackground( graph, timeout_ms, remote > 0 );
+    }
+    else {
+      nqwords = iPyVGXPersist.Serialize( graph, timeout_ms, force > 0, remote > 0 );
+    }
 
     if( nqwords < 0 ) {
       THROW_SILENT( CXLIB_ERR_GENERAL, 0x301 );
@@ -5907,6 +6579,29 @@ static PyObject * PyVGX_Graph__EventParam( PyVGX_Graph *pygraph ) {
       }
 
       iPyVGXBuilder.DictMapStringToLongLong( py_executor, "completed", backlog.n_exec );
+      iPyVGXBuilder.DictMapStringToLongLong( py_executor, "max_rate", backlog.executor.max_rate );
+      iPyVGXBuilder.DictMapStringToLongLong( py_executor, "throttled", backlog.executor.n_throttled );
+
+      // Per-shard executor backlog
+      PyObject *py_shards = PyList_New( backlog.executor.n_shards );
+      if( py_shards == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x002 );
+      }
+      for( int shard=0; shard < backlog.executor.n_shards; shard++ ) {
+        vgx_EventShardInfo_t *info = &backlog.executor.shard[ shard ];
+        PyObject *py_shard = PyDict_New();
+        if( py_shard == NULL ) {
+          PyVGX_DECREF( py_shards );
+          THROW_ERROR( CXLIB_ERR_MEMORY, 0x003 );
+        }
+        iPyVGXBuilder.DictMapStringToLongLong( py_shard, "items",     info->n_current );
+        iPyVGXBuilder.DictMapStringToLongLong( py_shard, "completed", info->n_exec );
+        iPyVGXBuilder.DictMapStringToLongLong( py_shard, "transient", info->n_transient );
+        iPyVGXBuilder.DictMapStringToLongLong( py_shard, "yielded",   info->n_yield );
+        iPyVGXBuilder.DictMapStringToInt(      py_shard, "running",   info->is_running );
+        PyList_SET_ITEM( py_shards, shard, py_shard );
+      }
+      iPyVGXBuilder.DictMapStringToPyObject( py_executor, "shards", &py_shards );
       iPyVGXBuilder.DictMapStringToLongLong( py_input, "api", backlog.n_api );
       iPyVGXBuilder.DictMapStringToLongLong( py_input, "monitor", backlog.n_input );
       iPyVGXBuilder.DictMapStringToInt( py_state, "running", backlog.flags.is_running );
@@ -5951,6 +6646,58 @@ static PyObject * PyVGX_Graph__EventParam( PyVGX_Graph *pygraph ) {
 
 
 
+/******************************************************************************
+ * PyVGX_Graph__EventThrottle
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( EventThrottle__doc__,
+  "EventThrottle( max_rate ) -> int\n"
+  "\n"
+  "Limit the number of events (e.g. TTL expirations) executed per second\n"
+  "across all executor shards. A max_rate of 0 removes the limit.\n"
+  "Returns the previous limit.\n"
+  "\n"
+);
+
+/**************************************************************************//**
+ * PyVGX_Graph__EventThrottle
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_Graph__EventThrottle( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds ) {
+  vgx_Graph_t *graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph );
+  if( !graph ) {
+    return NULL;
+  }
+
+  static char *kwlist[] = { "max_rate", NULL };
+
+  int64_t max_rate = 0;
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "L", kwlist, &max_rate ) ) {
+    return NULL;
+  }
+
+  if( max_rate < 0 ) {
+    PyErr_SetString( PyExc_ValueError, "max_rate cannot be negative" );
+    return NULL;
+  }
+
+  int64_t prev;
+  BEGIN_PYVGX_THREADS {
+    prev = iGraphEvent.SetExecutorThrottle( graph, max_rate );
+  } END_PYVGX_THREADS;
+
+  if( prev < 0 ) {
+    PyErr_SetString( PyExc_Exception, "Graph has no event processor" );
+    return NULL;
+  }
+
+  return PyLong_FromLongLong( prev );
+}
+
+
+
 /******************************************************************************
  * PyVGX_Graph__SetGraphReadonly
  *
@@ -7090,6 +7837,7 @@ static PyMethodDef PyVGX_Graph__methods[] = {
 
     // ARC METHODS
     {"Connect",               (PyCFunction)PyVGX_Graph__Connect,                METH_VARARGS | METH_KEYWORDS, Connect__doc__ },
+    {"Mutate",                (PyCFunction)PyVGX_Graph__Mutate,                 METH_VARARGS | METH_KEYWORDS, Mutate__doc__ },
     {"Disconnect",            (PyCFunction)PyVGX_Graph__Disconnect,             METH_VARARGS | METH_KEYWORDS, Disconnect__doc__ },
     {"Count",                 (PyCFunction)PyVGX_Graph__Count,                  METH_VARARGS | METH_KEYWORDS, Count__doc__  },
     {"Accumulate",            (PyCFunction)PyVGX_Graph__Accumulate,             METH_VARARGS | METH_KEYWORDS, Accumulate__doc__  },
@@ -7112,6 +7860,7 @@ static PyMethodDef PyVGX_Graph__methods[] = {
     {"NewAggregatorQuery",    (PyCFunction)PyVGX_Graph__NewAggregatorQuery,     METH_VARARGS | METH_KEYWORDS, pyvgx_Aggregate__doc__ },
     {"ArcValue",              (PyCFunction)pyvgx_ArcValue,                      METH_FASTCALL | METH_KEYWORDS, pyvgx_ArcValue__doc__ },
     {"Degree",                (PyCFunction)pyvgx_Degree,                        METH_FASTCALL | METH_KEYWORDS, pyvgx_Degree__doc__ },
+    {"CommonNeighbors",       (PyCFunction)pyvgx_CommonNeighbors,               METH_FASTCALL | METH_KEYWORDS, pyvgx_CommonNeighbors__doc__ },
     {"Inarcs",                (PyCFunction)PyVGX_Graph__Inarcs,                 METH_VARARGS | METH_KEYWORDS, pyvgx_Inarcs__doc__ },
     {"Outarcs",               (PyCFunction)PyVGX_Graph__Outarcs,                METH_VARARGS | METH_KEYWORDS, pyvgx_Outarcs__doc__ },
     {"Initials",              (PyCFunction)PyVGX_Graph__Initials,               METH_VARARGS | METH_KEYWORDS, pyvgx_Initials__doc__ },
@@ -7125,6 +7874,13 @@ static PyMethodDef PyVGX_Graph__methods[] = {
     {"Sync",                  (PyCFunction)PyVGX_Graph__Sync,                   METH_VARARGS | METH_KEYWORDS, Sync__doc__  },
     {"Truncate",              (PyCFunction)PyVGX_Graph__Truncate,               METH_VARARGS,                 Truncate__doc__ },
     {"ResetSerial",           (PyCFunction)PyVGX_Graph__ResetSerial,            METH_VARARGS,                 ResetSerial__doc__ },
+    {"FreezeArcs",            (PyCFunction)PyVGX_Graph__FreezeArcs,             METH_VARARGS | METH_KEYWORDS, FreezeArcs__doc__ },
+    {"ThawArcs",              (PyCFunction)PyVGX_Graph__ThawArcs,               METH_NOARGS,                  ThawArcs__doc__ },
+    {"CreateGeoIndex",        (PyCFunction)PyVGX_Graph__CreateGeoIndex,         METH_VARARGS | METH_KEYWORDS, CreateGeoIndex__doc__ },
+    {"DropGeoIndex",          (PyCFunction)PyVGX_Graph__DropGeoIndex,           METH_NOARGS,                  DropGeoIndex__doc__ },
+    {"CreateTextIndex",       (PyCFunction)PyVGX_Graph__CreateTextIndex,        METH_VARARGS | METH_KEYWORDS, CreateTextIndex__doc__ },
+    {"DropTextIndex",         (PyCFunction)PyVGX_Graph__DropTextIndex,          METH_VARARGS | METH_KEYWORDS, DropTextIndex__doc__ },
+    {"ParallelTraversal",     (PyCFunction)PyVGX_Graph__ParallelTraversal,      METH_VARARGS | METH_KEYWORDS, ParallelTraversal__doc__ },
     {"SetGraphReadonly",      (PyCFunction)PyVGX_Graph__SetGraphReadonly,       METH_VARARGS | METH_KEYWORDS, SetGraphReadonly__doc__  },
     {"IsGraphReadonly",       (PyCFunction)PyVGX_Graph__IsGraphReadonly,        METH_NOARGS,                  IsGraphReadonly__doc__  },
     {"ClearGraphReadonly",    (PyCFunction)PyVGX_Graph__ClearGraphReadonly,     METH_NOARGS,                  ClearGraphReadonly__doc__  },
@@ -7157,6 +7913,7 @@ static PyMethodDef PyVGX_Graph__methods[] = {
     {"EventDisable",          (PyCFunction)PyVGX_Graph__EventDisable,           METH_NOARGS,                  EventDisable__doc__  },
     {"EventFlush",            (PyCFunction)PyVGX_Graph__EventFlush,             METH_NOARGS,                  EventFlush__doc__  },
     {"EventParam",            (PyCFunction)PyVGX_Graph__EventParam,             METH_NOARGS,                  EventParam__doc__  },
+    {"EventThrottle",         (PyCFunction)PyVGX_Graph__EventThrottle,          METH_VARARGS | METH_KEYWORDS, EventThrottle__doc__  },
 
     // MISC.
     {"ShowVertex",                  (PyCFunction)PyVGX_Graph__ShowVertex,                   METH_VARARGS,                 ShowVertex__doc__  },
@@ -1055,11 +1055,12 @@ static PyObject * PyVGX_Operation__unbind( PyObject *self ) {
  */
 SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
 static PyObject * PyVGX_Operation__subscribe( PyObject *self, PyObject *args, PyObject *kwdict ) {
-  static char *kwlist[] = { "address", "hardsync", "timeout", NULL }; 
+  static char *kwlist[] = { "address", "hardsync", "timeout", "snapshot", NULL }; 
   PyObject *py_address = NULL;
   int hardsync = false;
   int timeout_ms = 5000;
-  if( !PyArg_ParseTupleAndKeywords( args, kwdict, "O|ii", kwlist, &py_address, &hardsync, &timeout_ms ) ) {
+  int snapshot = false;
+  if( !PyArg_ParseTupleAndKeywords( args, kwdict, "O|iii", kwlist, &py_address, &hardsync, &timeout_ms, &snapshot ) ) {
     return NULL;
   }
 
@@ -1107,7 +1108,7 @@ static PyObject * PyVGX_Operation__subscribe( PyObject *self, PyObject *args, Py
   int ret = 0;
   CString_t *CSTR__error = NULL;
   BEGIN_PYVGX_THREADS {
-    ret = iOperation.System_OPEN.ConsumerService.Subscribe( SYSTEM, provider_host, provider_uport, hardsync, timeout_ms, &CSTR__error );
+    ret = iOperation.System_OPEN.ConsumerService.Subscribe( SYSTEM, provider_host, provider_uport, hardsync, snapshot, timeout_ms, &CSTR__error );
   } END_PYVGX_THREADS;
 
   PyObject *py_ret = NULL;
@@ -1982,7 +1983,7 @@ static PyMethodDef PyVGX_Operation__methods[] = {
   { "Bind",               (PyCFunction)PyVGX_Operation__bind,            METH_VARARGS | METH_KEYWORDS,   "Bind( port[, durable[, snapshot_threshold]] )" },
   { "Bound",              (PyCFunction)PyVGX_Operation__bound,           METH_NOARGS,                    "Bound() -> (port, durable)" },
   { "Unbind",             (PyCFunction)PyVGX_Operation__unbind,          METH_NOARGS,                    "Unbind()" },
-  { "Subscribe",          (PyCFunction)PyVGX_Operation__subscribe,       METH_VARARGS | METH_KEYWORDS,   "Subscribe( (host, port), hardsync=False, timeout=5000 )" },
+  { "Subscribe",          (PyCFunction)PyVGX_Operation__subscribe,       METH_VARARGS | METH_KEYWORDS,   "Subscribe( (host, port), hardsync=False, timeout=5000, snapshot=False )" },
   { "Unsubscribe",        (PyCFunction)PyVGX_Operation__unsubscribe,     METH_VARARGS | METH_KEYWORDS,   "Unsubscribe()" },
   { "Consume",            (PyCFunction)PyVGX_Operation__consume,         METH_VARARGS | METH_KEYWORDS,   "Consume( data, timeout=0 )" },
   { "Pending",            (PyCFunction)PyVGX_Operation__pending,         METH_NOARGS,                    "Pending() -> n" },
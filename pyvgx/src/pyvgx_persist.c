@@ -127,13 +127,18 @@ static void PrintReprForAllAllocators( vgx_Graph_t *graph ) {
  *
  ******************************************************************************
  */
-static int64_t _ipyvgx_persist__serialize( vgx_Graph_t *graph, int timeout_ms, bool force, bool remote ) {
+static int64_t __serialize( vgx_Graph_t *graph, int timeout_ms, bool force, bool remote, bool background ) {
   int64_t nqwords = 0;
   CString_t *CSTR__error = NULL;
 
   vgx_AccessReason_t reason = VGX_ACCESS_REASON_NONE;
   BEGIN_PYVGX_THREADS {
-    nqwords = CALLABLE(graph)->BulkSerialize( graph, timeout_ms, force, remote, &reason, &CSTR__error );
+    if( background ) {
+      nqwords = CALLABLE(graph)->BulkSerializeBackground( graph, timeout_ms, remote, &reason, &CSTR__error );
+    }
+    else {
+      nqwords = CALLABLE(graph)->BulkSerialize( graph, timeout_ms, force, remote, &reason, &CSTR__error );
+    }
   } END_PYVGX_THREADS;
 
   if( nqwords < 0 ) {
@@ -154,6 +159,28 @@ static int64_t _ipyvgx_persist__serialize( vgx_Graph_t *graph, int timeout_ms, b
 
 
 
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int64_t _ipyvgx_persist__serialize( vgx_Graph_t *graph, int timeout_ms, bool force, bool remote ) {
+  return __serialize( graph, timeout_ms, force, remote, false );
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static int64_t _ipyvgx_persist__serialize_background( vgx_Graph_t *graph, int timeout_ms, bool remote ) {
+  return __serialize( graph, timeout_ms, false, remote, true );
+}
+
+
+
 /******************************************************************************
  *
  *
@@ -161,6 +188,7 @@ static int64_t _ipyvgx_persist__serialize( vgx_Graph_t *graph, int timeout_ms, b
  */
 DLL_HIDDEN IPyVGXPersist iPyVGXPersist = {
   .Serialize           = _ipyvgx_persist__serialize,
+  .SerializeBackground = _ipyvgx_persist__serialize_background,
 };
 
 
@@ -47,6 +47,9 @@ static PyObject *g_py_param_method = NULL;
 static PyObject *g_py_param_headers = NULL;
 static PyObject *g_py_param_content = NULL;
 
+// Graphs bound to native plugins, kept open while the plugin is registered
+static PyObject *g_py_native_graphs = NULL;
+
 
 /******************************************************************************
  * 
@@ -328,20 +331,17 @@ bytes:
 // Interpret string as JSON
 json:
   {
-    PyObject *py_json_string = PyUnicode_FromString( kv->val.data.simple.string );
-    if( py_json_string ) {
-      PyObject *py_object = iPyVGXCodec.NewPyObjectFromJsonPyString( py_json_string );
-      Py_DECREF( py_json_string );
-      if( py_object ) {
-        // LEAK WARNING: Must decref this
-        kv->val.data.simple.pointer = py_object;
-        kv->val.type = VGX_VALUE_TYPE_POINTER;
-      }
-      else {
-        PyErr_Clear();
-        PyErr_Format( PyExc_ValueError, "%s=%s (invalid JSON)", kv->key, kv->val.data.simple.string );
-        return -1;
-      }
+    const char *json = kv->val.data.simple.string;
+    PyObject *py_object = iPyVGXCodec.NewPyObjectFromJsonBytes( json, strlen( json ) );
+    if( py_object ) {
+      // LEAK WARNING: Must decref this
+      kv->val.data.simple.pointer = py_object;
+      kv->val.type = VGX_VALUE_TYPE_POINTER;
+    }
+    else {
+      PyErr_Clear();
+      PyErr_Format( PyExc_ValueError, "%s=%s (invalid JSON)", kv->key, json );
+      return -1;
     }
     return 0;
   }
@@ -1352,8 +1352,18 @@ static int __plugin__call( const char *plugin_name, bool post, vgx_URIQueryParam
 
       // param: request
       if( PyDict_GetItem( py_plugin.argspec, g_py_param_request ) ) {
+        // Request content decoded as JSON is represented by the raw request
+        // content in PluginRequest, no need to serialize it back to JSON.
+        PyObject *py_raw_content = NULL;
+        if( request->content_type == MEDIA_TYPE__application_json && iPyVGXCodec.IsTypeJson( py_content_type ) ) {
+          if( (py_raw_content = __plugin__new_request_content( &PyCapsule_Type, request )) == NULL ) {
+            THROW_InternalServerError( CXLIB_ERR_MEMORY, 0x00C, response );
+          }
+        }
         // Create new PluginRequest
-        if( (plugin_param.py_plugreq = __pyvgx_PluginRequest_New( request, py_params, py_headers, py_content )) == NULL ) {
+        plugin_param.py_plugreq = __pyvgx_PluginRequest_New( request, py_params, py_headers, py_raw_content ? py_raw_content : py_content );
+        Py_XDECREF( py_raw_content );
+        if( plugin_param.py_plugreq == NULL ) {
           THROW_InternalServerError( CXLIB_ERR_MEMORY, 0x00C, response );
         }
         // Assign request to kwargs
@@ -1698,6 +1708,8 @@ DLL_HIDDEN int __pyvgx_plugin__init_plugins( void ) {
  ******************************************************************************
  */
 DLL_HIDDEN int __pyvgx_plugin__delete( void ) {
+  Py_XDECREF( g_py_native_graphs );
+  g_py_native_graphs = NULL;
   if( g_py_plugins != NULL ) {
     Py_DECREF( g_py_plugins );
     g_py_plugins = NULL;
@@ -1776,6 +1788,11 @@ DLL_HIDDEN int __pyvgx_plugin__add( const char *plugin_name, vgx_server_plugin_p
       }
     }
 
+    if( iVGXServer.Resource.Plugin.Native.Get( plugin_name, NULL, NULL ) ) {
+      PyErr_Format( PyExc_ValueError, "plugin name '%s' already used by native plugin", plugin_name );
+      THROW_SILENT( CXLIB_ERR_API, 0x004 );
+    }
+
     // Has parameter?
     bool has_request = false;
     bool has_response = false;
@@ -2041,6 +2058,14 @@ DLL_HIDDEN int __pyvgx_plugin__add( const char *plugin_name, vgx_server_plugin_p
  */
 DLL_HIDDEN int __pyvgx_plugin__remove( const char *name ) {
 
+  // Native plugin
+  if( iVGXServer.Resource.Plugin.Native.Remove( name ) > 0 ) {
+    if( g_py_native_graphs && PyDict_GetItemString( g_py_native_graphs, name ) ) {
+      return PyDict_DelItemString( g_py_native_graphs, name );
+    }
+    return 0;
+  }
+
   // Unregister plugin in Python framework
   if( PyDict_DelItemString( g_py_plugins, name ) < 0 ) {
     return -1;
@@ -2307,6 +2332,43 @@ DLL_HIDDEN PyObject * __pyvgx_plugin__get_plugins( bool user, const char *onlyna
       }
     }
     PyErr_Clear();
+
+    // Native plugins
+    if( user ) {
+      vgx_StringList_t *native = iVGXServer.Resource.Plugin.Native.List();
+      int64_t sz_native = native ? iString.List.Size( native ) : 0;
+      for( int64_t i=0; i<sz_native; i++ ) {
+        const char *name = iString.List.GetChars( native, i );
+        if( onlyname && !CharsEqualsConst( name, onlyname ) ) {
+          continue;
+        }
+        CString_t *CSTR__library = NULL;
+        const vgx_NativePlugin_t *def = iVGXServer.Resource.Plugin.Native.Get( name, &CSTR__library, NULL );
+        PyObject *py_entry;
+        if( def && (py_entry = PyDict_New()) != NULL ) {
+          strncpy( plugin_pname, name, 243 );
+          iPyVGXBuilder.DictMapStringToString( py_entry, "path", plugin_pathbuf );
+          PyObject *py_description = PyList_New( 0 );
+          if( py_description ) {
+            PyObject *py_line = PyUnicode_FromString( def->description ? def->description : "native plugin" );
+            if( py_line ) {
+              PyList_Append( py_description, py_line );
+              Py_DECREF( py_line );
+            }
+            iPyVGXBuilder.DictMapStringToPyObject( py_entry, "description", &py_description );
+          }
+          iPyVGXBuilder.DictMapStringToString( py_entry, "native", CSTR__library ? CStringValue( CSTR__library ) : "" );
+          PyObject *py_graph = g_py_native_graphs ? PyDict_GetItemString( g_py_native_graphs, name ) : NULL;
+          PyObject *py_graph_repr = PyObject_Repr( py_graph ? py_graph : Py_None );
+          iPyVGXBuilder.DictMapStringToPyObject( py_entry, "bound_graph", &py_graph_repr );
+          PyList_Append( py_display_list, py_entry );
+          Py_DECREF( py_entry );
+        }
+        iString.Discard( &CSTR__library );
+      }
+      iString.List.Discard( &native );
+      PyErr_Clear();
+    }
   }
   XCATCH( errcode ) {
     if( py_display_list ) {
@@ -2323,3 +2385,63 @@ DLL_HIDDEN PyObject * __pyvgx_plugin__get_plugins( bool user, const char *onlyna
 
   return py_display_list;
 }
+
+
+
+/******************************************************************************
+ * Load native plugin library and return list of registered plugin names
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN PyObject * __pyvgx_plugin__add_native( const char *path, PyObject *py_bound_graph ) {
+  vgx_Graph_t *graph = NULL;
+  if( py_bound_graph ) {
+    if( !PyVGX_Graph_Check( py_bound_graph ) ) {
+      PyErr_SetString( PyExc_TypeError, "a graph instance is required" );
+      return NULL;
+    }
+    graph = ((PyVGX_Graph*)py_bound_graph)->graph;
+  }
+
+  if( g_py_native_graphs == NULL && (g_py_native_graphs = PyDict_New()) == NULL ) {
+    return NULL;
+  }
+
+  PyObject *py_names = NULL;
+  vgx_StringList_t *names = NULL;
+  CString_t *CSTR__error = NULL;
+  int n;
+
+  BEGIN_PYVGX_THREADS {
+    n = iVGXServer.Resource.Plugin.Native.Load( path, graph, &names, &CSTR__error );
+  } END_PYVGX_THREADS;
+
+  if( n < 0 ) {
+    PyErr_Format( PyExc_Exception, "cannot load native plugin: %s", CSTR__error ? CStringValue( CSTR__error ) : "unknown error" );
+  }
+  else if( (py_names = PyList_New( n )) != NULL ) {
+    for( int i=0; i<n; i++ ) {
+      const char *name = iString.List.GetChars( names, i );
+      PyObject *py_name = PyUnicode_FromString( name );
+      if( py_name == NULL ) {
+        Py_DECREF( py_names );
+        py_names = NULL;
+        break;
+      }
+      PyList_SET_ITEM( py_names, i, py_name );
+      int err = py_bound_graph ? PyDict_SetItemString( g_py_native_graphs, name, py_bound_graph ) : 0;
+      if( !py_bound_graph && PyDict_GetItemString( g_py_native_graphs, name ) ) {
+        err = PyDict_DelItemString( g_py_native_graphs, name );
+      }
+      if( err < 0 ) {
+        Py_DECREF( py_names );
+        py_names = NULL;
+        break;
+      }
+    }
+  }
+
+  iString.List.Discard( &names );
+  iString.Discard( &CSTR__error );
+  return py_names;
+}
@@ -0,0 +1,396 @@
+/******************************************************************************
+ * 
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ * 
+ * Module:  pyvgx
+ * File:    pyvgx_searchresult.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ * 
+ * Copyright © 2025 Rakuten, Inc.
+ * 
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * 
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ * 
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ * 
+ *****************************************************************************/
+
+#include "pyvgx.h"
+
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX );
+
+
+
+/******************************************************************************
+ * Native result data depends on the graph (identifier strings are owned by
+ * the graph's string allocator and enumerated names are borrowed from the
+ * graph's enumerators.)
+ *
+ ******************************************************************************
+ */
+#define PARENT_GRAPH_ATTACHED( PyResultObj )  ((PyResultObj)->py_parent != NULL && (PyResultObj)->parent != NULL && (PyResultObj)->parent == (PyResultObj)->py_parent->graph)
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static void __discard_native( PyVGX_SearchResult *py_result ) {
+  if( py_result->search_result ) {
+    // If the graph has been closed the native result can no longer be
+    // safely released and is abandoned
+    if( PARENT_GRAPH_ATTACHED( py_result ) ) {
+      vgx_SearchResult_t *search_result = py_result->search_result;
+      BEGIN_PYVGX_THREADS {
+        iGraphResponse.DeleteSearchResult( &search_result );
+      } END_PYVGX_THREADS;
+    }
+    py_result->search_result = NULL;
+  }
+}
+
+
+
+/******************************************************************************
+ * __pyvgx_SearchResult_New
+ *
+ * Steals the search result.
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN PyObject * __pyvgx_SearchResult_New( PyVGX_Graph *pygraph, vgx_SearchResult_t **search_result ) {
+  PyVGX_SearchResult *py_result = PyObject_New( PyVGX_SearchResult, p_PyVGX_SearchResultType );
+  if( py_result == NULL ) {
+    return NULL;
+  }
+  Py_INCREF( pygraph );
+  py_result->py_parent = pygraph;
+  py_result->parent = pygraph->graph;
+  py_result->search_result = *search_result;
+  py_result->py_list = NULL;
+  py_result->pins = 0;
+  *search_result = NULL;
+  return (PyObject*)py_result;
+}
+
+
+
+/******************************************************************************
+ * __pyvgx_SearchResult_Materialize
+ *
+ * Return the Python result list (borrowed reference), creating it from the
+ * native result on first access. The native result is released once the
+ * list exists, unless it is pinned.
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN PyObject * __pyvgx_SearchResult_Materialize( PyVGX_SearchResult *py_result ) {
+  if( py_result->py_list == NULL ) {
+    if( py_result->search_result == NULL ) {
+      py_result->py_list = PyList_New( 0 );
+    }
+    else if( !PARENT_GRAPH_ATTACHED( py_result ) ) {
+      PyErr_SetString( PyVGX_ResultError, "Search result is no longer available, graph has been closed" );
+      return NULL;
+    }
+    else if( (py_result->py_list = iPyVGXSearchResult.PyResultList_FromSearchResult( py_result->search_result, false, -1 )) != NULL ) {
+      if( py_result->pins == 0 ) {
+        __discard_native( py_result );
+      }
+    }
+  }
+  return py_result->py_list;
+}
+
+
+
+/******************************************************************************
+ * __pyvgx_SearchResult_Native
+ *
+ * Return the native search result if it has not been materialized, or NULL.
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN const vgx_SearchResult_t * __pyvgx_SearchResult_Native( PyVGX_SearchResult *py_result ) {
+  if( py_result->py_list == NULL && PARENT_GRAPH_ATTACHED( py_result ) ) {
+    return py_result->search_result;
+  }
+  return NULL;
+}
+
+
+
+/******************************************************************************
+ * __pyvgx_SearchResult_Pin
+ *
+ * Return the native search result if it has not been materialized, or NULL.
+ * A non-NULL result remains valid until unpinned and may be accessed without
+ * holding the GIL while the caller keeps a reference to the object.
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN const vgx_SearchResult_t * __pyvgx_SearchResult_Pin( PyVGX_SearchResult *py_result ) {
+  const vgx_SearchResult_t *search_result = __pyvgx_SearchResult_Native( py_result );
+  if( search_result ) {
+    ++py_result->pins;
+  }
+  return search_result;
+}
+
+
+
+/******************************************************************************
+ * __pyvgx_SearchResult_Unpin
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN void __pyvgx_SearchResult_Unpin( PyVGX_SearchResult *py_result ) {
+  if( --py_result->pins == 0 && py_result->py_list ) {
+    __discard_native( py_result );
+  }
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult__dealloc
+ *
+ ******************************************************************************
+ */
+static void PyVGX_SearchResult__dealloc( PyVGX_SearchResult *py_result ) {
+  __discard_native( py_result );
+  Py_XDECREF( py_result->py_list );
+  Py_XDECREF( py_result->py_parent );
+  Py_TYPE( py_result )->tp_free( py_result );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult__len
+ *
+ ******************************************************************************
+ */
+static Py_ssize_t PyVGX_SearchResult__len( PyVGX_SearchResult *py_result ) {
+  if( py_result->py_list ) {
+    return PyList_GET_SIZE( py_result->py_list );
+  }
+  const vgx_SearchResult_t *search_result = py_result->search_result;
+  return search_result && search_result->list ? search_result->list_length : 0;
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult__contains
+ *
+ ******************************************************************************
+ */
+static int PyVGX_SearchResult__contains( PyVGX_SearchResult *py_result, PyObject *py_value ) {
+  PyObject *py_list = __pyvgx_SearchResult_Materialize( py_result );
+  if( py_list == NULL ) {
+    return -1;
+  }
+  return PySequence_Contains( py_list, py_value );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult__subscript
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_SearchResult__subscript( PyVGX_SearchResult *py_result, PyObject *py_key ) {
+  PyObject *py_list = __pyvgx_SearchResult_Materialize( py_result );
+  if( py_list == NULL ) {
+    return NULL;
+  }
+  return PyObject_GetItem( py_list, py_key );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult__iter
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_SearchResult__iter( PyVGX_SearchResult *py_result ) {
+  PyObject *py_list = __pyvgx_SearchResult_Materialize( py_result );
+  if( py_list == NULL ) {
+    return NULL;
+  }
+  return PyObject_GetIter( py_list );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult__richcompare
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_SearchResult__richcompare( PyVGX_SearchResult *py_result, PyObject *py_other, int op ) {
+  PyObject *py_list = __pyvgx_SearchResult_Materialize( py_result );
+  if( py_list == NULL ) {
+    return NULL;
+  }
+  if( PyVGX_SearchResult_CheckExact( py_other ) ) {
+    if( (py_other = __pyvgx_SearchResult_Materialize( (PyVGX_SearchResult*)py_other )) == NULL ) {
+      return NULL;
+    }
+  }
+  return PyObject_RichCompare( py_list, py_other, op );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult__repr
+ *
+ ******************************************************************************
+ */
+static PyObject * PyVGX_SearchResult__repr( PyVGX_SearchResult *py_result ) {
+  PyObject *py_list = __pyvgx_SearchResult_Materialize( py_result );
+  if( py_list == NULL ) {
+    return NULL;
+  }
+  return PyObject_Repr( py_list );
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult_List
+ *
+ ******************************************************************************
+ */
+PyDoc_STRVAR( List__doc__,
+  "List() -> list\n"
+  "\n"
+  "Return the result as a list.\n"
+  "\n"
+);
+static PyObject * PyVGX_SearchResult_List( PyVGX_SearchResult *py_result ) {
+  PyObject *py_list = __pyvgx_SearchResult_Materialize( py_result );
+  Py_XINCREF( py_list );
+  return py_list;
+}
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult_methods
+ *
+ ******************************************************************************
+ */
+static PyMethodDef PyVGX_SearchResult_methods[] = {
+  {"List",             (PyCFunction)PyVGX_SearchResult_List,                METH_NOARGS,                    List__doc__ },
+  {NULL}  /* Sentinel */
+};
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult_as_sequence
+ *
+ ******************************************************************************
+ */
+static PySequenceMethods PyVGX_SearchResult_as_sequence = {
+    .sq_length          = (lenfunc)PyVGX_SearchResult__len,
+    .sq_concat          = (binaryfunc)0,
+    .sq_repeat          = (ssizeargfunc)0,
+    .sq_item            = (ssizeargfunc)0,
+    .was_sq_slice       = 0,
+    .sq_ass_item        = (ssizeobjargproc)0,
+    .was_sq_ass_slice   = 0,
+    .sq_contains        = (objobjproc)PyVGX_SearchResult__contains,
+    .sq_inplace_concat  = (binaryfunc)0,
+    .sq_inplace_repeat  = (ssizeargfunc)0,
+};
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResult_as_mapping
+ *
+ ******************************************************************************
+ */
+static PyMappingMethods PyVGX_SearchResult_as_mapping = {
+    .mp_length          = (lenfunc)PyVGX_SearchResult__len,
+    .mp_subscript       = (binaryfunc)PyVGX_SearchResult__subscript,
+    .mp_ass_subscript   = (objobjargproc)0
+};
+
+
+
+/******************************************************************************
+ * PyVGX_SearchResultType
+ *
+ ******************************************************************************
+ */
+static PyTypeObject PyVGX_SearchResultType = {
+    PyVarObject_HEAD_INIT(NULL,0)
+    .tp_name            = "pyvgx.SearchResult",
+    .tp_basicsize       = sizeof(PyVGX_SearchResult),
+    .tp_itemsize        = 0,
+    .tp_dealloc         = (destructor)PyVGX_SearchResult__dealloc,
+    .tp_vectorcall_offset = 0,
+    .tp_getattr         = 0,
+    .tp_setattr         = 0,
+    .tp_as_async        = 0,
+    .tp_repr            = (reprfunc)PyVGX_SearchResult__repr,
+    .tp_as_number       = 0,
+    .tp_as_sequence     = &PyVGX_SearchResult_as_sequence,
+    .tp_as_mapping      = &PyVGX_SearchResult_as_mapping,
+    .tp_hash            = 0,
+    .tp_call            = 0,
+    .tp_str             = 0,
+    .tp_getattro        = 0,
+    .tp_setattro        = 0,
+    .tp_as_buffer       = 0,
+    .tp_flags           = Py_TPFLAGS_DEFAULT,
+    .tp_doc             = "PyVGX SearchResult objects",
+    .tp_traverse        = 0,
+    .tp_clear           = 0,
+    .tp_richcompare     = (richcmpfunc)PyVGX_SearchResult__richcompare,
+    .tp_weaklistoffset  = 0,
+    .tp_iter            = (getiterfunc)PyVGX_SearchResult__iter,
+    .tp_iternext        = 0,
+    .tp_methods         = PyVGX_SearchResult_methods,
+    .tp_members         = 0,
+    .tp_getset          = 0,
+    .tp_base            = 0,
+    .tp_dict            = 0,
+    .tp_descr_get       = 0,
+    .tp_descr_set       = 0,
+    .tp_dictoffset      = 0,
+    .tp_init            = 0,
+    .tp_alloc           = 0,
+    .tp_new             = 0,
+    .tp_free            = (freefunc)0,
+    .tp_is_gc           = (inquiry)0,
+    .tp_bases           = NULL,
+    .tp_mro             = NULL,
+    .tp_cache           = NULL,
+    .tp_subclasses      = NULL,
+    .tp_weaklist        = NULL,
+    .tp_del             = (destructor)0,
+    .tp_version_tag     = 0,
+    .tp_finalize        = (destructor)0,
+    .tp_vectorcall      = (vectorcallfunc)0
+};
+
+
+DLL_HIDDEN PyTypeObject * p_PyVGX_SearchResultType = &PyVGX_SearchResultType;
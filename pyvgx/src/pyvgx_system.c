@@ -73,6 +73,7 @@ static PyObject * PyVGX_System__ServerHost( PyVGX_System *py_system );
 static PyObject * PyVGX_System__RequestRate( PyVGX_System *py_system );
 static PyObject * PyVGX_System__ResetMetrics( PyVGX_System *py_system );
 static PyObject * PyVGX_System__AddPlugin( PyVGX_System *py_system, PyObject *args, PyObject *kwds );
+static PyObject * PyVGX_System__AddNativePlugin( PyVGX_System *py_system, PyObject *args, PyObject *kwds );
 static PyObject * PyVGX_System__RemovePlugin( PyVGX_System *py_system, PyObject *py_name );
 static PyObject * PyVGX_System__GetPlugins( PyVGX_System *py_system, PyObject *args, PyObject *kwds );
 static PyObject * PyVGX_System__GetBuiltins( PyVGX_System *py_system, PyObject *args, PyObject *kwds );
@@ -3900,7 +3901,7 @@ static PyObject * __plugin_function_name( PyObject *py_plugin ) {
 SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
 static PyObject * PyVGX_System__AddPlugin( PyVGX_System *py_system, PyObject *args, PyObject *kwds ) {
 
-  static char *kwlist[] = { "plugin", "name", "graph", "engine", "pre", "post", NULL };
+  static char *kwlist[] = { "plugin", "name", "graph", "engine", "pre", "post", "deadline", "priority", NULL };
 
   PyObject *py_plugin = NULL;
   const char *plugin_name = NULL;
@@ -3909,11 +3910,35 @@ static PyObject * PyVGX_System__AddPlugin( PyVGX_System *py_system, PyObject *ar
   PyObject *py_engine = NULL;
   PyObject *py_pre = NULL;
   PyObject *py_post = NULL;
+  int deadline_ms = 0;
+  const char *priority_name = NULL;
 
-  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|Os#OOOO", kwlist, &py_plugin, &plugin_name, &sz_name, &py_bound_graph, &py_engine, &py_pre, &py_post ) ) {
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "|Os#OOOOiz", kwlist, &py_plugin, &plugin_name, &sz_name, &py_bound_graph, &py_engine, &py_pre, &py_post, &deadline_ms, &priority_name ) ) {
     return NULL;
   }
 
+  if( deadline_ms < 0 ) {
+    PyErr_SetString( PyExc_ValueError, "deadline must be a non-negative number of milliseconds" );
+    return NULL;
+  }
+
+  vgx_server_request_priority priority = VGX_SERVER_REQUEST_PRIORITY__DEFAULT;
+  if( priority_name ) {
+    if( CharsEqualsConst( priority_name, "low" ) ) {
+      priority = VGX_SERVER_REQUEST_PRIORITY__LOW;
+    }
+    else if( CharsEqualsConst( priority_name, "normal" ) ) {
+      priority = VGX_SERVER_REQUEST_PRIORITY__NORMAL;
+    }
+    else if( CharsEqualsConst( priority_name, "high" ) ) {
+      priority = VGX_SERVER_REQUEST_PRIORITY__HIGH;
+    }
+    else {
+      PyErr_Format( PyExc_ValueError, "priority must be 'low', 'normal' or 'high', got '%s'", priority_name );
+      return NULL;
+    }
+  }
+
   if( py_plugin == Py_None ) {
     py_plugin = NULL;
   }
@@ -3996,11 +4021,48 @@ static PyObject * PyVGX_System__AddPlugin( PyVGX_System *py_system, PyObject *ar
     }
   }
 
+  // Request admission defaults
+  if( iVGXServer.Resource.Plugin.SetAdmission( plugin_name, deadline_ms, priority ) < 0 ) {
+    PyErr_SetString( PyExc_Exception, "unknown internal error" );
+    return NULL;
+  }
+
   Py_RETURN_NONE;
 }
 
 
 
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
+static PyObject * PyVGX_System__AddNativePlugin( PyVGX_System *py_system, PyObject *args, PyObject *kwds ) {
+
+  static char *kwlist[] = { "path", "graph", NULL };
+
+  const char *path = NULL;
+  PyObject *py_bound_graph = NULL;
+
+  if( !PyArg_ParseTupleAndKeywords( args, kwds, "s|O", kwlist, &path, &py_bound_graph ) ) {
+    return NULL;
+  }
+
+  if( py_bound_graph == Py_None ) {
+    py_bound_graph = NULL;
+  }
+
+  if( !igraphfactory.IsInitialized() ) {
+    PyErr_SetString( PyExc_Exception, "No registry (system not initialized?)" );
+    return NULL;
+  }
+
+  return __pyvgx_plugin__add_native( path, py_bound_graph );
+}
+
+
+
 /******************************************************************************
  *
  *
@@ -5103,7 +5165,8 @@ static PyMethodDef PyVGX_System__methods[] = {
   { "ServerAdminIP",     (PyCFunction)PyVGX_System__ServerAdminIP,      METH_NOARGS,                    "ServerAdminIP() -> str_or_None" },
   { "RequestRate",       (PyCFunction)PyVGX_System__RequestRate,        METH_NOARGS,                    "RequestRate() -> float" },
   { "ResetMetrics",      (PyCFunction)PyVGX_System__ResetMetrics,       METH_NOARGS,                    "ResetMetrics() -> None" },
-  { "AddPlugin",         (PyCFunction)PyVGX_System__AddPlugin,          METH_VARARGS | METH_KEYWORDS,   "AddPlugin( plugin, name, graph, engine, pre, post ) -> None" },
+  { "AddPlugin",         (PyCFunction)PyVGX_System__AddPlugin,          METH_VARARGS | METH_KEYWORDS,   "AddPlugin( plugin, name, graph, engine, pre, post, deadline, priority ) -> None" },
+  { "AddNativePlugin",   (PyCFunction)PyVGX_System__AddNativePlugin,    METH_VARARGS | METH_KEYWORDS,   "AddNativePlugin( path, graph ) -> list" },
   { "RemovePlugin",      (PyCFunction)PyVGX_System__RemovePlugin,       METH_O,                         "RemovePlugin( name ) -> None" },
   { "GetPlugins",        (PyCFunction)PyVGX_System__GetPlugins,         METH_VARARGS | METH_KEYWORDS,   "GetPlugins() -> dict" },
   { "GetBuiltins",       (PyCFunction)PyVGX_System__GetBuiltins,        METH_VARARGS | METH_KEYWORDS,   "GetBuiltins() -> dict" },
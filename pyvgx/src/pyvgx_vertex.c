@@ -1607,14 +1607,15 @@ static PyObject * PyVGX_Vertex__RemoveVector( PyVGX_Vertex *pyvertex ) {
 
 
 /******************************************************************************
- * __py_set_property
+ * pyvgx_NewVertexProperty
  *
+ * Populate vertex_property with key and value from python name and value.
+ * Must be called with the GIL held. Sets python error and returns -1 on
+ * failure. The populated property is released with pyvgx_ClearVertexProperty.
  ******************************************************************************
  */
-static int __py_set_property( vgx_Vertex_t *vertex_WL, const char *name, PyObject *py_value, PyObject *py_virtual ) {
+DLL_HIDDEN int pyvgx_NewVertexProperty( vgx_Graph_t *graph, const char *name, PyObject *py_value, PyObject *py_virtual, vgx_VertexProperty_t *vertex_property ) {
   int ret = 0;
-  PyObject *py_repr = NULL;
-  CString_t *CSTR__value = NULL;
 
   // vprop hint (hidden feature: '*' prefix means virtual prop if supported)
   bool vprop = false;
@@ -1623,60 +1624,103 @@ static int __py_set_property( vgx_Vertex_t *vertex_WL, const char *name, PyObjec
     vprop = true;
   }
 
-  // The property to insert
-  vgx_VertexProperty_t vertex_property = {0};
-  vertex_property.key = iEnumerator_OPEN.Property.Key.New( vertex_WL->graph, name );
-
-  BEGIN_PYTHON_INTERPRETER {
-    XTRY {
-      // Key
-      if( vertex_property.key == NULL ) {
-        PyErr_Format( PyExc_ValueError, "invalid property key: '%s'", name );
-        THROW_SILENT( CXLIB_ERR_API, 0x411 );
+  XTRY {
+    // Key
+    if( (vertex_property->key = iEnumerator_OPEN.Property.Key.New( graph, name )) == NULL ) {
+      PyErr_Format( PyExc_ValueError, "invalid property key: '%s'", name );
+      THROW_SILENT( CXLIB_ERR_API, 0x411 );
+    }
+    // We have a value
+    if( py_value && py_value != Py_None ) {
+      // INTEGER
+      if( PyLong_Check( py_value ) ) {
+        int ovf;
+        int64_t x = PyLong_AsLongLongAndOverflow( py_value, &ovf );
+        if( ovf != 0 || x > (1LL<<55)-1 || x < -(1LL<<56) ) {
+          PyErr_SetString( PyExc_ValueError, "integer value out of range" );
+          THROW_ERROR( CXLIB_ERR_API, 0x412 );
+        }
+        else {
+          vertex_property->val.type = VGX_VALUE_TYPE_INTEGER;
+          vertex_property->val.data.simple.integer = x;
+        }
       }
-      // We have a value
-      if( py_value && py_value != Py_None ) {
-        // INTEGER
-        if( PyLong_Check( py_value ) ) {
-          int ovf;
-          int64_t x = PyLong_AsLongLongAndOverflow( py_value, &ovf );
-          if( ovf != 0 || x > (1LL<<55)-1 || x < -(1LL<<56) ) {
-            PyErr_SetString( PyExc_ValueError, "integer value out of range" );
-            THROW_ERROR( CXLIB_ERR_API, 0x412 );
-          }
-          else {
-            vertex_property.val.type = VGX_VALUE_TYPE_INTEGER;
-            vertex_property.val.data.simple.integer = x;
-          }
+      // REAL
+      else if( PyFloat_Check( py_value ) ) {
+        vertex_property->val.type = VGX_VALUE_TYPE_REAL;
+        vertex_property->val.data.simple.real = PyFloat_AS_DOUBLE( py_value );
+      }
+      // STRING or OBJECT
+      else {
+        // Virtual (disk) property?
+        if( !vprop ) { // no * hint in name, check virtual parameter
+          vprop = py_virtual && ( py_virtual == Py_True || (PyLong_Check( py_virtual ) && PyLong_AsLong( py_virtual ) > 0 ));
         }
-        // REAL
-        else if( PyFloat_Check( py_value ) ) {
-          vertex_property.val.type = VGX_VALUE_TYPE_REAL;
-          vertex_property.val.data.simple.real = PyFloat_AS_DOUBLE( py_value );
+        if( vprop ) {
+          vertex_property->val.type = VGX_VALUE_TYPE_CSTRING;
         }
-        // STRING or OBJECT
         else {
-          // Virtual (disk) property?
-          if( !vprop ) { // no * hint in name, check virtual parameter
-            vprop = py_virtual && ( py_virtual == Py_True || (PyLong_Check( py_virtual ) && PyLong_AsLong( py_virtual ) > 0 ));
-          }
-          if( vprop ) {
-            vertex_property.val.type = VGX_VALUE_TYPE_CSTRING;
-          }
-          else {
-            vertex_property.val.type = VGX_VALUE_TYPE_ENUMERATED_CSTRING;
-          }
-          // Encode
-          if( (CSTR__value = iPyVGXCodec.NewEncodedObjectFromPyObject( NULL, py_value, vertex_WL->graph->property_allocator_context, vprop )) == NULL ) {
-            THROW_SILENT( CXLIB_ERR_GENERAL, 0x413 );
-          }
-          vertex_property.val.data.simple.CSTR__string = CSTR__value;
+          vertex_property->val.type = VGX_VALUE_TYPE_ENUMERATED_CSTRING;
+        }
+        // Encode
+        if( (vertex_property->val.data.simple.CSTR__string = iPyVGXCodec.NewEncodedObjectFromPyObject( NULL, py_value, graph->property_allocator_context, vprop )) == NULL ) {
+          THROW_SILENT( CXLIB_ERR_GENERAL, 0x413 );
         }
       }
-      else {
-        // EXISTS / BOOLEAN
-        vertex_property.val.type = VGX_VALUE_TYPE_BOOLEAN;
-        vertex_property.val.data.simple.integer = 0;
+    }
+    else {
+      // EXISTS / BOOLEAN
+      vertex_property->val.type = VGX_VALUE_TYPE_BOOLEAN;
+      vertex_property->val.data.simple.integer = 0;
+    }
+  }
+  XCATCH( errcode ) {
+    if( !PyErr_Occurred() ) {
+      PyErr_Format( PyExc_Exception, "internal error %03x", errcode );
+    }
+    ret = -1;
+  }
+  XFINALLY {
+  }
+
+  return ret;
+}
+
+
+
+/******************************************************************************
+ * pyvgx_ClearVertexProperty
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN void pyvgx_ClearVertexProperty( vgx_VertexProperty_t *vertex_property ) {
+  if( vertex_property->key ) {
+    CStringDelete( vertex_property->key );
+    vertex_property->key = NULL;
+  }
+  if( (vertex_property->val.type == VGX_VALUE_TYPE_CSTRING || vertex_property->val.type == VGX_VALUE_TYPE_ENUMERATED_CSTRING) && vertex_property->val.data.simple.CSTR__string ) {
+    CStringDelete( vertex_property->val.data.simple.CSTR__string );
+    vertex_property->val.data.simple.CSTR__string = NULL;
+  }
+}
+
+
+
+/******************************************************************************
+ * __py_set_property
+ *
+ ******************************************************************************
+ */
+static int __py_set_property( vgx_Vertex_t *vertex_WL, const char *name, PyObject *py_value, PyObject *py_virtual ) {
+  int ret = 0;
+
+  // The property to insert
+  vgx_VertexProperty_t vertex_property = {0};
+
+  BEGIN_PYTHON_INTERPRETER {
+    XTRY {
+      if( pyvgx_NewVertexProperty( vertex_WL->graph, name, py_value, py_virtual, &vertex_property ) < 0 ) {
+        THROW_SILENT( CXLIB_ERR_API, 0x414 );
       }
 
       // Set the vertex property
@@ -1686,7 +1730,7 @@ static int __py_set_property( vgx_Vertex_t *vertex_WL, const char *name, PyObjec
 
       if( ret < 0 ) {
         PyErr_SetString( PyExc_Exception, "Failed to set vertex property" );
-        THROW_ERROR( CXLIB_ERR_GENERAL, 0x414 );
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x415 );
       }
 
     }
@@ -1697,16 +1741,10 @@ static int __py_set_property( vgx_Vertex_t *vertex_WL, const char *name, PyObjec
       ret = -1;
     }
     XFINALLY {
-      PyVGX_XDECREF( py_repr );
     }
   } END_PYTHON_INTERPRETER;
 
-  if( CSTR__value ) {
-    CStringDelete( CSTR__value );
-  }
-  if( vertex_property.key ) {
-    CStringDelete( vertex_property.key );
-  }
+  pyvgx_ClearVertexProperty( &vertex_property );
 
   return ret;
 }
@@ -4514,6 +4552,7 @@ static PyMethodDef PyVGX_Vertex__methods[] = {
     {"Aggregate",           (PyCFunction)PyVGX_Vertex__Aggregate,         METH_VARARGS | METH_KEYWORDS, pyvgx_Aggregate__doc__ },
     {"ArcValue",            (PyCFunction)pyvgx_ArcValue,                  METH_FASTCALL | METH_KEYWORDS, pyvgx_ArcValue__doc__ },
     {"Degree",              (PyCFunction)pyvgx_Degree,                    METH_FASTCALL | METH_KEYWORDS, pyvgx_Degree__doc__ },
+    {"CommonNeighbors",     (PyCFunction)pyvgx_CommonNeighbors,           METH_FASTCALL | METH_KEYWORDS, pyvgx_CommonNeighbors__doc__ },
     {"Inarcs",              (PyCFunction)PyVGX_Vertex__Inarcs,            METH_VARARGS | METH_KEYWORDS, pyvgx_Inarcs__doc__ },
     {"Outarcs",             (PyCFunction)PyVGX_Vertex__Outarcs,           METH_VARARGS | METH_KEYWORDS, pyvgx_Outarcs__doc__ },
     {"Initials",            (PyCFunction)PyVGX_Vertex__Initials,          METH_VARARGS | METH_KEYWORDS, pyvgx_Initials__doc__ },
@@ -818,7 +818,8 @@ static int PyVGX_PluginRequest_set_content( PyVGX_PluginRequest *py_plugreq, PyO
           PyErr_SetString( PyExc_Exception, "internal error (invalid content buffer)" );
           THROW_ERROR( CXLIB_ERR_BUG, 0x001 );
         }
-        mtype = MEDIA_TYPE__application_octet_stream;
+        // Raw JSON content keeps its media type
+        mtype = request->content_type == MEDIA_TYPE__application_json ? MEDIA_TYPE__application_json : MEDIA_TYPE__application_octet_stream;
       }
       else {
         // Raw bytes
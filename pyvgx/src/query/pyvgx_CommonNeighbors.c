@@ -0,0 +1,365 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  pyvgx
+ * File:    pyvgx_CommonNeighbors.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#include "pyvgx.h"
+
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX );
+
+
+PyVGX_DOC( pyvgx_CommonNeighbors__doc__,
+  "CommonNeighbors( id, other, arc=D_OUT, metric='count', timeout=0 ) -> score or list of scores\n"
+  "\n"
+  "id      : Unique string identifier for vertex, or pyvgx.Vertex instance\n"
+  "other   : Vertex to compare with, or list of vertices\n"
+  "arc     : Arcs matching this condition define the neighbor sets (D_OUT, D_IN or D_ANY)\n"
+  "metric  : 'count', 'jaccard', 'cosine', 'adamicadar' or 'all'\n"
+  "timeout : Vertex acquisition timeout in milliseconds\n"
+  "\n"
+  "A list of scores is returned when other is a list. Metric 'all' returns\n"
+  "a dict with all scores. Other vertices that do not exist score zero.\n"
+  "\n"
+);
+
+
+
+/******************************************************************************
+ *
+ ******************************************************************************
+ */
+typedef enum __e_common_neighbors_metric {
+  __METRIC_COUNT,
+  __METRIC_JACCARD,
+  __METRIC_COSINE,
+  __METRIC_ADAMIC_ADAR,
+  __METRIC_ALL
+} __common_neighbors_metric;
+
+
+
+/******************************************************************************
+ *
+ ******************************************************************************
+ */
+typedef struct __s_common_neighbors_pyargs {
+  pyvgx_VertexIdentifier_t vertex;            // O id -> parsed from pyobject to string
+  // --------------------------------------------------
+  vgx_ArcConditionSet_t *arc_condition_set;   // O arc -> parsed into vgx_ArcConditionSet_t
+  __common_neighbors_metric metric;           // z metric
+  int timeout_ms;                             // i timeout
+  // EXTRA
+  struct {
+    vgx_Graph_t *graph;
+    bool single;
+    int64_t n_others;
+    CString_t **CSTR__others;
+    CString_t *CSTR__vertex;
+    CString_t *CSTR__error;
+    vgx_AccessReason_t reason;
+  } implied;
+} __common_neighbors_pyargs;
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static void _pyvgx_CommonNeighbors__clear_params( __common_neighbors_pyargs *param ) {
+  if( param ) {
+    if( param->arc_condition_set ) {
+      iArcConditionSet.Delete( &param->arc_condition_set );
+    }
+    if( param->implied.CSTR__others ) {
+      for( int64_t i=0; i<param->implied.n_others; i++ ) {
+        if( param->implied.CSTR__others[i] ) {
+          CStringDelete( param->implied.CSTR__others[i] );
+        }
+      }
+      free( param->implied.CSTR__others );
+    }
+    if( param->implied.CSTR__vertex ) {
+      CStringDelete( param->implied.CSTR__vertex );
+    }
+    iString.Discard( &param->implied.CSTR__error );
+  }
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static CString_t * _pyvgx_CommonNeighbors__new_vertex_name( PyVGX_Graph *pygraph, vgx_Graph_t *graph, PyObject *py_vertex ) {
+  pyvgx_VertexIdentifier_t ident = {0};
+  CString_t *CSTR__name;
+  if( iPyVGXParser.GetVertexID( pygraph, py_vertex, &ident, NULL, true, "Vertex ID" ) < 0 ) {
+    return NULL;
+  }
+  if( (CSTR__name = NewEphemeralCString( graph, ident.id )) == NULL ) {
+    PyErr_SetNone( PyExc_MemoryError );
+  }
+  return CSTR__name;
+}
+
+
+
+/******************************************************************************
+ * _pyvgx_CommonNeighbors__parse_params
+ *
+ ******************************************************************************
+ */
+static __common_neighbors_pyargs * _pyvgx_CommonNeighbors__parse_params( PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames, __common_neighbors_pyargs *param ) {
+
+  static const char *kwlist[] = {
+    "id",
+    "other",
+    "arc",
+    "metric",
+    "timeout",
+    NULL
+  };
+
+  union {
+    PyObject *args[5];
+    struct {
+      PyObject *py_id;
+      PyObject *py_other;
+      PyObject *py_arc;
+      PyObject *py_metric;
+      PyObject *py_timeout;
+    };
+  } vcargs = {0};
+
+  PyVGX_Graph *pygraph;
+  int ret;
+  if( PyVGX_Vertex_CheckExact( self ) ) {
+    ret = __parse_vectorcall_args( args, nargs, kwnames, kwlist+1, 4, vcargs.args+1 );
+    pygraph = ((PyVGX_Vertex*)self)->pygraph;
+    vcargs.py_id = self;
+  }
+  else {
+    ret = __parse_vectorcall_args( args, nargs, kwnames, kwlist, 5, vcargs.args );
+    pygraph = (PyVGX_Graph*)self;
+  }
+  if( ret < 0 ) {
+    return NULL;
+  }
+
+  vgx_Graph_t *graph = param->implied.graph;
+
+  // [REQUIRED]
+  // ----------
+  // id
+  // ----------
+  if( vcargs.py_id == NULL ) {
+    PyVGX_ReturnError( PyExc_TypeError, "Vertex required" );
+  }
+  if( (param->implied.CSTR__vertex = _pyvgx_CommonNeighbors__new_vertex_name( pygraph, graph, vcargs.py_id )) == NULL ) {
+    return NULL;
+  }
+  param->vertex.id = CStringValue( param->implied.CSTR__vertex );
+
+  // [REQUIRED]
+  // ----------
+  // other
+  // ----------
+  if( vcargs.py_other == NULL ) {
+    PyVGX_ReturnError( PyExc_TypeError, "Other vertex required" );
+  }
+  if( PyList_Check( vcargs.py_other ) || PyTuple_Check( vcargs.py_other ) ) {
+    param->implied.single = false;
+    param->implied.n_others = PySequence_Size( vcargs.py_other );
+  }
+  else {
+    param->implied.single = true;
+    param->implied.n_others = 1;
+  }
+  if( (param->implied.CSTR__others = calloc( param->implied.n_others + 1, sizeof( CString_t* ) )) == NULL ) {
+    PyErr_SetNone( PyExc_MemoryError );
+    return NULL;
+  }
+  for( int64_t i=0; i<param->implied.n_others; i++ ) {
+    PyObject *py_vertex = param->implied.single ? vcargs.py_other : PySequence_Fast_GET_ITEM( vcargs.py_other, i );
+    if( (param->implied.CSTR__others[i] = _pyvgx_CommonNeighbors__new_vertex_name( pygraph, graph, py_vertex )) == NULL ) {
+      return NULL;
+    }
+  }
+
+  // ---
+  // arc
+  // ---
+  if( vcargs.py_arc ) {
+    if( (param->arc_condition_set = iPyVGXParser.NewArcConditionSet( graph, vcargs.py_arc, VGX_ARCDIR_OUT )) == NULL ) {
+      return NULL;
+    }
+  }
+
+  // ------
+  // metric
+  // ------
+  param->metric = __METRIC_COUNT;
+  if( vcargs.py_metric ) {
+    const char *metric = PyUnicode_Check( vcargs.py_metric ) ? PyUnicode_AsUTF8( vcargs.py_metric ) : NULL;
+    if( metric == NULL ) {
+      PyVGX_ReturnError( PyExc_TypeError, "metric must be a string" );
+    }
+    if( CharsEqualsConst( metric, "count" ) ) {
+      param->metric = __METRIC_COUNT;
+    }
+    else if( CharsEqualsConst( metric, "jaccard" ) ) {
+      param->metric = __METRIC_JACCARD;
+    }
+    else if( CharsEqualsConst( metric, "cosine" ) ) {
+      param->metric = __METRIC_COSINE;
+    }
+    else if( CharsEqualsConst( metric, "adamicadar" ) ) {
+      param->metric = __METRIC_ADAMIC_ADAR;
+    }
+    else if( CharsEqualsConst( metric, "all" ) ) {
+      param->metric = __METRIC_ALL;
+    }
+    else {
+      PyErr_Format( PyExc_ValueError, "Invalid metric: %s", metric );
+      return NULL;
+    }
+  }
+
+  // -------
+  // timeout
+  // -------
+  if( vcargs.py_timeout ) {
+    if( (param->timeout_ms = PyLong_AsLong( vcargs.py_timeout )) < 0 ) {
+      if( !PyLong_Check( vcargs.py_timeout ) ) {
+        return NULL;
+      }
+    }
+  }
+
+  return param;
+}
+
+
+
+/******************************************************************************
+ *
+ *
+ ******************************************************************************
+ */
+static PyObject * _pyvgx_CommonNeighbors__new_score( __common_neighbors_metric metric, const vgx_CommonNeighbors_t *result ) {
+  switch( metric ) {
+  case __METRIC_COUNT:
+    return PyLong_FromLongLong( result->n_common );
+  case __METRIC_JACCARD:
+    return PyFloat_FromDouble( result->jaccard );
+  case __METRIC_COSINE:
+    return PyFloat_FromDouble( result->cosine );
+  case __METRIC_ADAMIC_ADAR:
+    return PyFloat_FromDouble( result->adamic_adar );
+  default:
+    return Py_BuildValue( "{sLsdsdsd}",
+                          "count",      result->n_common,
+                          "jaccard",    result->jaccard,
+                          "cosine",     result->cosine,
+                          "adamicadar", result->adamic_adar );
+  }
+}
+
+
+
+/******************************************************************************
+ * pyvgx_CommonNeighbors
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN PyObject * pyvgx_CommonNeighbors( PyObject *self, PyObject *const *args, Py_ssize_t nargs, PyObject *kwnames ) {
+  PyObject *py_result = NULL;
+  vgx_CommonNeighbors_t *result = NULL;
+
+  __common_neighbors_pyargs param = {0};
+
+  PyVGX_Graph *pygraph;
+  if( PyVGX_Vertex_CheckExact( self ) ) {
+    pygraph = ((PyVGX_Vertex*)self)->pygraph;
+  }
+  else if( PyVGX_Graph_Check( self ) ) {
+    pygraph = (PyVGX_Graph*)self;
+  }
+  else {
+    PyVGX_ReturnError( PyExc_TypeError, "graph or vertex required" );
+  }
+
+  if( (param.implied.graph = __PyVGX_Graph_as_vgx_Graph_t( pygraph )) != NULL ) {
+
+    // -------------------------
+    // Parse Parameters
+    // -------------------------
+    if( _pyvgx_CommonNeighbors__parse_params( self, args, nargs, kwnames, &param ) != NULL ) {
+
+      int64_t n = -1;
+      if( (result = calloc( param.implied.n_others + 1, sizeof( vgx_CommonNeighbors_t ) )) == NULL ) {
+        PyErr_SetNone( PyExc_MemoryError );
+      }
+      else {
+        BEGIN_PYVGX_THREADS {
+          vgx_Graph_t *graph = param.implied.graph;
+          n = CALLABLE( graph )->simple->CommonNeighbors( graph, param.implied.CSTR__vertex, param.implied.CSTR__others, param.implied.n_others, param.arc_condition_set, result, param.timeout_ms, &param.implied.reason, &param.implied.CSTR__error );
+        } END_PYVGX_THREADS;
+
+        if( n >= 0 ) {
+          if( param.implied.single ) {
+            py_result = _pyvgx_CommonNeighbors__new_score( param.metric, &result[0] );
+          }
+          else if( (py_result = PyList_New( n )) != NULL ) {
+            for( int64_t i=0; i<n; i++ ) {
+              PyObject *py_score = _pyvgx_CommonNeighbors__new_score( param.metric, &result[i] );
+              if( py_score == NULL ) {
+                PyVGX_DECREF( py_result );
+                py_result = NULL;
+                break;
+              }
+              PyList_SET_ITEM( py_result, i, py_score );
+            }
+          }
+        }
+        else if( !iPyVGXBuilder.SetPyErrorFromAccessReason( param.vertex.id, param.implied.reason, &param.implied.CSTR__error ) ) {
+          const char *errstr = param.implied.CSTR__error ? CStringValue( param.implied.CSTR__error ) : "internal error";
+          PyErr_SetString( PyVGX_QueryError, errstr );
+        }
+      }
+    }
+
+    // -------------------------
+    // Clean up
+    // -------------------------
+    free( result );
+    _pyvgx_CommonNeighbors__clear_params( &param );
+
+  }
+
+  return py_result;
+}
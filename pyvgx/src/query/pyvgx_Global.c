@@ -33,7 +33,7 @@ SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX );
  *
  ******************************************************************************
  */
-static PyObject * _pyvgx_Global__perform( __global_query_args *param, PyObject **py_timing );
+static PyObject * _pyvgx_Global__perform( PyVGX_Graph *pygraph, __global_query_args *param, PyObject **py_timing );
 static vgx_GlobalQuery_t * _pyvgx_Global__get_global_query( __global_query_args *param );
 static PyObject * _pyvgx_Global__get_result( vgx_SearchResult_t *search_result, vgx_collector_mode_t mode, PyObject **py_timing );
 
@@ -56,6 +56,9 @@ static void _pyvgx_Global__clear_params( __base_query_args *base ) {
     if( param->evalmem ) {
       iEvaluator.DiscardMemory( &param->evalmem );
     }
+    if( param->pagerank_condition ) {
+      iGraphQuery.DeletePageRankCondition( &param->pagerank_condition );
+    }
 
     iString.Discard( &param->implied.CSTR__error );
   }
@@ -64,25 +67,216 @@ static void _pyvgx_Global__clear_params( __base_query_args *base ) {
 
 
 PyVGX_DOC( pyvgx_Vertices__doc__,
-  "Vertices( condition=None, vector=[], result=R_STR, fields=F_ID, select=None, rank=None, sortby=S_NONE, memory=4, offset=0, hits=-1, timeout=0, limexec=False ) -> list\n"
+  "Vertices( condition=None, vector=[], result=R_STR, fields=F_ID, select=None, rank=None, sortby=S_NONE, memory=4, offset=0, hits=-1, timeout=0, limexec=False, lazy=False, cursor=None, pagerank=None ) -> list\n"
   "\n"
   "Perform a global search for vertices matching the given condition. By default all vertices are returned.\n"
   "\n"
 );
 PyVGX_DOC( pyvgx_Arcs__doc__,
-  "Arcs( condition=None, vector=[], result=R_STR, fields=F_ID, select=None, rank=None, sortby=S_NONE, memory=4, offset=0, hits=-1, timeout=0, limexec=False ) -> list\n"
+  "Arcs( condition=None, vector=[], result=R_STR, fields=F_ID, select=None, rank=None, sortby=S_NONE, memory=4, offset=0, hits=-1, timeout=0, limexec=False, lazy=False, cursor=None ) -> list\n"
   "\n"
   "Perform a global search for arcs matching the given condition. By default all arcs are returned.\n"
   "\n"
 );
 
+/**************************************************************************//**
+ * _pyvgx_Global__new_pagerank_condition
+ *
+ * Seeds only:  "A" | ["A", "B", ...] | {"A":1.0, "B":2.0, ...}
+ * Full:        { 'seeds':<seeds>, 'arc':<arc condition>, 'weights':{rel:w, ...},
+ *                'arcvalue':<bool>, 'alpha':<float>, 'epsilon':<float>,
+ *                'iterations':<int>, 'vertices':<int> }
+ ******************************************************************************
+ */
+static vgx_PageRankCondition_t * _pyvgx_Global__new_pagerank_condition( vgx_Graph_t *graph, PyObject *py_pagerank ) {
+  vgx_PageRankCondition_t *pagerank = NULL;
+
+  static const char *keys[] = { "seeds", "arc", "weights", "arcvalue", "alpha", "epsilon", "iterations", "vertices", NULL };
+
+  XTRY {
+    PyObject *py_seeds = py_pagerank;
+    PyObject *py_weights = NULL;
+    PyObject *py_params[8] = {0};
+
+    if( PyDict_Check( py_pagerank ) && PyDict_GetItemString( py_pagerank, "seeds" ) ) {
+      Py_ssize_t n_keys = 0;
+      for( int k=0; keys[k]; k++ ) {
+        if( (py_params[k] = PyDict_GetItemString( py_pagerank, keys[k] )) != NULL ) {
+          ++n_keys;
+        }
+      }
+      if( PyDict_Size( py_pagerank ) > n_keys ) {
+        PyErr_SetString( PyExc_ValueError, "pagerank dict keys must be 'seeds', 'arc', 'weights', 'arcvalue', 'alpha', 'epsilon', 'iterations' and 'vertices'" );
+        THROW_SILENT( CXLIB_ERR_API, 0x001 );
+      }
+      py_seeds = py_params[0];
+      py_weights = py_params[2];
+      if( py_weights == Py_None ) {
+        py_weights = NULL;
+      }
+      if( py_weights && !PyDict_Check( py_weights ) ) {
+        PyErr_SetString( PyExc_TypeError, "pagerank weights must be a dict mapping relationship to weight" );
+        THROW_SILENT( CXLIB_ERR_API, 0x002 );
+      }
+    }
+
+    // Seeds
+    PyObject *py_seedlist = NULL;
+    if( PyDict_Check( py_seeds ) ) {
+      py_seedlist = PyDict_Keys( py_seeds );
+    }
+    else if( PyList_Check( py_seeds ) || PyTuple_Check( py_seeds ) ) {
+      py_seedlist = PySequence_List( py_seeds );
+    }
+    else {
+      py_seedlist = PyList_New( 1 );
+      if( py_seedlist ) {
+        Py_INCREF( py_seeds );
+        PyList_SET_ITEM( py_seedlist, 0, py_seeds );
+      }
+    }
+    if( py_seedlist == NULL ) {
+      THROW_SILENT( CXLIB_ERR_MEMORY, 0x003 );
+    }
+
+    int n_seeds = (int)PyList_GET_SIZE( py_seedlist );
+    int n_weights = py_weights ? (int)PyDict_Size( py_weights ) : 0;
+    if( (pagerank = iGraphQuery.NewPageRankCondition( n_seeds, n_weights )) == NULL ) {
+      Py_DECREF( py_seedlist );
+      PyErr_SetNone( PyExc_MemoryError );
+      THROW_SILENT( CXLIB_ERR_MEMORY, 0x004 );
+    }
+
+    int err = 0;
+    for( int i=0; i<n_seeds && !err; i++ ) {
+      PyObject *py_seed = PyList_GET_ITEM( py_seedlist, i );
+      pyvgx_VertexIdentifier_t ident;
+      double weight = 1.0;
+      if( PyDict_Check( py_seeds ) ) {
+        PyObject *py_w = PyDict_GetItem( py_seeds, py_seed );
+        weight = PyFloat_AsDouble( py_w );
+        if( PyErr_Occurred() ) {
+          err = -1;
+          break;
+        }
+      }
+      if( !(weight > 0.0) ) {
+        PyErr_SetString( PyExc_ValueError, "pagerank seed weight must be positive" );
+        err = -1;
+      }
+      else if( iPyVGXParser.GetVertexID( NULL, py_seed, &ident, NULL, true, "Seed ID" ) < 0 ) {
+        err = -1;
+      }
+      else if( (pagerank->seeds[i].CSTR__id = NewEphemeralCString( graph, ident.id )) == NULL ) {
+        PyErr_SetNone( PyExc_MemoryError );
+        err = -1;
+      }
+      pagerank->seeds[i].weight = weight;
+    }
+    Py_DECREF( py_seedlist );
+    if( err < 0 ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x005 );
+    }
+    if( n_seeds == 0 ) {
+      PyErr_SetString( PyExc_ValueError, "pagerank requires at least one seed" );
+      THROW_SILENT( CXLIB_ERR_API, 0x006 );
+    }
+
+    // Relationship weights
+    if( py_weights ) {
+      Py_ssize_t pos = 0;
+      PyObject *py_rel;
+      PyObject *py_w;
+      int k = 0;
+      while( PyDict_Next( py_weights, &pos, &py_rel, &py_w ) ) {
+        const char *relationship = PyUnicode_Check( py_rel ) ? PyUnicode_AsUTF8( py_rel ) : NULL;
+        double weight = PyFloat_AsDouble( py_w );
+        if( relationship == NULL || PyErr_Occurred() ) {
+          PyErr_Clear();
+          PyErr_SetString( PyExc_TypeError, "pagerank weights must map relationship (str) to weight (number)" );
+          THROW_SILENT( CXLIB_ERR_API, 0x007 );
+        }
+        if( weight < 0.0 ) {
+          PyErr_SetString( PyExc_ValueError, "pagerank relationship weight cannot be negative" );
+          THROW_SILENT( CXLIB_ERR_API, 0x008 );
+        }
+        if( (pagerank->weights[k].CSTR__relationship = NewEphemeralCString( graph, relationship )) == NULL ) {
+          PyErr_SetNone( PyExc_MemoryError );
+          THROW_SILENT( CXLIB_ERR_MEMORY, 0x009 );
+        }
+        pagerank->weights[k++].weight = weight;
+      }
+    }
+
+    // Arc condition
+    if( py_params[1] && py_params[1] != Py_None ) {
+      if( (pagerank->arc_condition_set = iPyVGXParser.NewArcConditionSet( graph, py_params[1], VGX_ARCDIR_OUT )) == NULL ) {
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x00A );
+      }
+      if( pagerank->arc_condition_set->arcdir == VGX_ARCDIR_BOTH ) {
+        PyErr_SetString( PyExc_ValueError, "pagerank requires arc direction D_OUT, D_IN or D_ANY" );
+        THROW_SILENT( CXLIB_ERR_API, 0x00B );
+      }
+    }
+
+    // arcvalue
+    if( py_params[3] ) {
+      pagerank->arcvalue = PyObject_IsTrue( py_params[3] ) > 0;
+    }
+
+    // alpha, epsilon
+    if( py_params[4] ) {
+      pagerank->alpha = PyFloat_AsDouble( py_params[4] );
+    }
+    if( py_params[5] ) {
+      pagerank->epsilon = PyFloat_AsDouble( py_params[5] );
+    }
+    if( PyErr_Occurred() ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x00C );
+    }
+    if( !(pagerank->alpha > 0.0 && pagerank->alpha <= 1.0) ) {
+      PyErr_SetString( PyExc_ValueError, "pagerank alpha must be in range (0, 1]" );
+      THROW_SILENT( CXLIB_ERR_API, 0x00D );
+    }
+    if( !(pagerank->epsilon > 0.0) ) {
+      PyErr_SetString( PyExc_ValueError, "pagerank epsilon must be positive" );
+      THROW_SILENT( CXLIB_ERR_API, 0x00E );
+    }
+
+    // iterations, vertices
+    for( int k=6; k<8; k++ ) {
+      if( py_params[k] ) {
+        if( !PyLong_CheckExact( py_params[k] ) || PyLong_AsLongLong( py_params[k] ) < 1 ) {
+          PyErr_Format( PyExc_ValueError, "pagerank %s must be a positive integer", keys[k] );
+          THROW_SILENT( CXLIB_ERR_API, 0x00F );
+        }
+        if( k == 6 ) {
+          pagerank->max_iterations = PyLong_AsLongLong( py_params[k] );
+        }
+        else {
+          pagerank->max_vertices = PyLong_AsLongLong( py_params[k] );
+        }
+      }
+    }
+  }
+  XCATCH( errcode ) {
+    iGraphQuery.DeletePageRankCondition( &pagerank );
+  }
+  XFINALLY {
+  }
+
+  return pagerank;
+}
+
+
+
 /**************************************************************************//**
  * _pyvgx_Global__parse_params
  *
  ******************************************************************************
  */
 static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObject *kwds, __global_query_args *param, bool reusable ) {
-  static char *fmt_reusable = "|OOIIz#OIOi";
+  static char *fmt_reusable = "|OOIIz#OIOOi";
   static char *kwlist_reusable[] = {
     "condition",  //  O
     "vector",     //  O
@@ -92,11 +286,12 @@ static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObje
     "rank",       //  O
     "sortby",     //  I
     "memory",     //  O
+    "pagerank",   //  O
     "__debug",    //  i
     NULL
   };
 
-  static char *fmt = "|OOIIz#OIOiLiii";
+  static char *fmt = "|OOIIz#OIOiLiiizOi";
   static char *kwlist[] = {
     "condition",  //  O
     "vector",     //  O
@@ -110,6 +305,9 @@ static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObje
     "hits",       //  L
     "timeout",    //  i
     "limexec",    //  i
+    "lazy",       //  i
+    "cursor",     //  z
+    "pagerank",   //  O
     "__debug",    //  i
     NULL
   };
@@ -124,6 +322,7 @@ static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObje
   PyObject *py_rank_vector_object = NULL;
   PyObject *py_rankspec = NULL;
   PyObject *py_evalmem = NULL;
+  PyObject *py_pagerank = NULL;
 
   if( reusable ) {
     // Parser, reusable context
@@ -137,6 +336,7 @@ static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObje
       &py_rankspec,               //  O rank
       &param->sortspec,           //  I sortby
       &py_evalmem,                //  O memory
+      &py_pagerank,               //  O pagerank
       &param->implied.__debug )
     )
     {
@@ -159,6 +359,9 @@ static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObje
       &param->hits,               //  L hits
       &param->timeout_ms,         //  i timeout
       &param->limexec,            //  i limexec
+      &param->lazy,               //  i lazy
+      &param->cursor,             //  z cursor
+      &py_pagerank,               //  O pagerank
       &param->implied.__debug )
     )
     {
@@ -224,6 +427,25 @@ static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObje
       param->sortspec = VGX_SORTBY_MEMADDRESS; // we do this to force deep counts
     }
 
+    // --------
+    // pagerank
+    // --------
+    if( py_pagerank && py_pagerank != Py_None ) {
+      if( param->implied.collector_mode != VGX_COLLECTOR_MODE_COLLECT_VERTICES ) {
+        PyVGXError_SetString( PyVGX_QueryError, "pagerank not allowed in global arc search" );
+        THROW_SILENT( CXLIB_ERR_API, 0x006 );
+      }
+      if( (param->pagerank_condition = _pyvgx_Global__new_pagerank_condition( param->implied.graph, py_pagerank )) == NULL ) {
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x007 );
+      }
+      // Rank by pagerank score unless otherwise specified
+      if( py_rankspec == NULL || py_rankspec == Py_None ) {
+        if( param->sortspec == VGX_SORTBY_NONE ) {
+          param->sortspec = VGX_SORTBY_RANKING;
+        }
+      }
+    }
+
     // ----
     // rank
     // ----
@@ -233,7 +455,15 @@ static __global_query_args * _pyvgx_Global__parse_params( PyObject *args, PyObje
       THROW_SILENT( CXLIB_ERR_API, 0x003 );
     }
 
-    if( (param->ranking_condition = iPyVGXParser.NewRankingConditionEx( param->implied.graph, py_rankspec, NULL, param->sortspec, VGX_PREDICATOR_MOD_NONE, py_rank_vector_object, param->vertex_condition )) == NULL ) {
+    PyObject *py_default_rankspec = NULL;
+    if( param->pagerank_condition && (py_rankspec == NULL || py_rankspec == Py_None) ) {
+      if( (py_rankspec = py_default_rankspec = PyUnicode_FromString( "context.rank" )) == NULL ) {
+        THROW_SILENT( CXLIB_ERR_MEMORY, 0x008 );
+      }
+    }
+    param->ranking_condition = iPyVGXParser.NewRankingConditionEx( param->implied.graph, py_rankspec, NULL, param->sortspec, VGX_PREDICATOR_MOD_NONE, py_rank_vector_object, param->vertex_condition );
+    Py_XDECREF( py_default_rankspec );
+    if( param->ranking_condition == NULL ) {
       THROW_SILENT( CXLIB_ERR_GENERAL, 0x004 );
     }
 
@@ -282,7 +512,7 @@ static PyObject * _pyvgx_Global( PyVGX_Graph *pygraph, PyObject *args, PyObject
         // -------
         // Perform
         // -------
-        py_global = _pyvgx_Global__perform( &param, &py_timing );
+        py_global = _pyvgx_Global__perform( pygraph, &param, &py_timing );
       }
 
       // -------------------------
@@ -325,7 +555,7 @@ DLL_HIDDEN PyObject * pyvgx_Arcs( PyVGX_Graph *pygraph, PyObject *args, PyObject
  *
  ******************************************************************************
  */
-static PyObject * _pyvgx_Global__perform( __global_query_args *param, PyObject **py_timing ) {
+static PyObject * _pyvgx_Global__perform( PyVGX_Graph *pygraph, __global_query_args *param, PyObject **py_timing ) {
 
   PyObject *py_result = NULL;
 
@@ -366,10 +596,18 @@ static PyObject * _pyvgx_Global__perform( __global_query_args *param, PyObject *
   // Build Python response object from search result
   // -----------------------------------------------
   if( search_result ) {
-    py_result = _pyvgx_Global__get_result( search_result, param->implied.collector_mode, py_timing );
-    BEGIN_PYVGX_THREADS {
-      iGraphResponse.DeleteSearchResult( &search_result );
-    } END_PYVGX_THREADS;
+    // Keep result in native form until accessed
+    if( param->lazy > 0 && iPyVGXSearchResult.IsDeferrable( search_result, false ) ) {
+      py_result = __pyvgx_SearchResult_New( pygraph, &search_result );
+    }
+    else {
+      py_result = _pyvgx_Global__get_result( search_result, param->implied.collector_mode, py_timing );
+    }
+    if( search_result ) {
+      BEGIN_PYVGX_THREADS {
+        iGraphResponse.DeleteSearchResult( &search_result );
+      } END_PYVGX_THREADS;
+    }
   }
 
   // -------------------------
@@ -403,6 +641,9 @@ static vgx_GlobalQuery_t * _pyvgx_Global__get_global_query( __global_query_args
     query->hits = param->hits;
     query->offset = param->offset;
     CALLABLE( query )->SetTimeout( query, param->timeout_ms, param->limexec > 0 );
+    if( iGraphResponse.DecodeCursor( param->cursor, &query->cursor, &param->implied.CSTR__error ) < 0 ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x003 );
+    }
 
     CALLABLE( query )->SetDebug( query, param->implied.__debug );
 
@@ -428,6 +669,11 @@ static vgx_GlobalQuery_t * _pyvgx_Global__get_global_query( __global_query_args
       }
     }
 
+    // Assign pagerank condition (steal)
+    if( param->pagerank_condition ) {
+      CALLABLE( query )->SetPageRankCondition( query, &param->pagerank_condition );
+    }
+
     // Debug pre
     if( query->debug & VGX_QUERY_DEBUG_QUERY_PRE ) {
       PRINT( query );
@@ -499,6 +745,10 @@ static PyObject * _pyvgx_Global__get_result( vgx_SearchResult_t *search_result,
             }
           }
         }
+        // Add cursor
+        if( iPyVGXSearchResult.AddCursorMetas( py_global_result, SR ) < 0 ) {
+          PyErr_Clear();
+        }
       }
       else {
         PyVGX_DECREF( py_result_objects ); // error cleanup
@@ -34,7 +34,7 @@ SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX );
  *
  ******************************************************************************
  */
-static PyObject * _pyvgx_Neighborhood__perform( __neighborhood_query_args *param, PyObject **py_timing );
+static PyObject * _pyvgx_Neighborhood__perform( PyVGX_Graph *pygraph, __neighborhood_query_args *param, PyObject **py_timing );
 static vgx_NeighborhoodQuery_t * _pyvgx_Neighborhood__get_neighborhood_query( __neighborhood_query_args *param );
 static PyObject * _pyvgx_Neighborhood__get_neighborhood_result( vgx_SearchResult_t *search_result, bool nested, int64_t nested_hits, PyObject **py_timing );
 
@@ -216,6 +216,10 @@ static void _pyvgx_Neighborhood__clear_params( __base_query_args *base ) {
     if( param->collect_arc_condition_set ) {
       iArcConditionSet.Delete( &param->collect_arc_condition_set );
     }
+    for( int h=0; h<param->expand.n_hops; h++ ) {
+      iArcConditionSet.Delete( &param->expand.hop[h].arc_condition_set );
+    }
+    param->expand.n_hops = 0;
     if( param->evalmem ) {
       iEvaluator.DiscardMemory( &param->evalmem );
     }
@@ -227,7 +231,7 @@ static void _pyvgx_Neighborhood__clear_params( __base_query_args *base ) {
 
 
 PyVGX_DOC( pyvgx_Neighborhood__doc__,
-  "Neighborhood( id, arc=(None,D_OUT), pre=None, filter=None, post=None, neighbor=\"*\", vector=[], collect=C_COLLECT, result=R_STR, fields=F_ID, nest=0, nested_hits=-1, select=None, rank=None, sortby=S_NONE, aggregate=None, memory=4, offset=0, hits=-1, timeout=0, limexec=False ) -> list\n"
+  "Neighborhood( id, arc=(None,D_OUT), pre=None, filter=None, post=None, neighbor=\"*\", vector=[], collect=C_COLLECT, result=R_STR, fields=F_ID, nest=0, nested_hits=-1, select=None, rank=None, sortby=S_NONE, aggregate=None, memory=4, offset=0, hits=-1, timeout=0, limexec=False, lazy=False, cursor=None, expand=None ) -> list\n"
   "\n"
   "Perform a neighborhood search around vertex 'id'.\n"
   "\n"
@@ -239,7 +243,7 @@ PyVGX_DOC( pyvgx_Neighborhood__doc__,
  ******************************************************************************
  */
 static __neighborhood_query_args * _pyvgx_Neighborhood__parse_params( PyVGX_Graph *pygraph, PyObject *args, PyObject *kwds, __neighborhood_query_args *param, bool reusable ) {
-  static char *fmt = "|OOz#z#z#OOOIIiLz#OIOOiLiii";
+  static char *fmt = "|OOz#z#z#OOOIIiLz#OIOOiLiiizOi";
   static char *kwlist[] = {
     "id",         //  O
     "arc",        //  O
@@ -262,6 +266,9 @@ static __neighborhood_query_args * _pyvgx_Neighborhood__parse_params( PyVGX_Grap
     "hits",       //  L
     "timeout",    //  i
     "limexec",    //  i
+    "lazy",       //  i
+    "cursor",     //  z
+    "expand",     //  O
     "__debug",    //  i
     NULL
   };
@@ -307,6 +314,7 @@ static __neighborhood_query_args * _pyvgx_Neighborhood__parse_params( PyVGX_Grap
   PyObject *py_aggregate = NULL;
   PyObject *py_collect = NULL;
   PyObject *py_evalmem = NULL;
+  PyObject *py_expand = NULL;
 
   PyObject *py_filter = NULL;
   
@@ -368,6 +376,9 @@ static __neighborhood_query_args * _pyvgx_Neighborhood__parse_params( PyVGX_Grap
       &param->hits,                   // L hits
       &param->timeout_ms,             // i timeout
       &param->limexec,                // i limexec
+      &param->lazy,                   // i lazy
+      &param->cursor,                 // z cursor
+      &py_expand,                     // O expand
       &param->implied.__debug )
     )
     {
@@ -413,6 +424,48 @@ static __neighborhood_query_args * _pyvgx_Neighborhood__parse_params( PyVGX_Grap
     }
     param->modifier = iArcConditionSet.Modifier( param->arc_condition_set );
 
+    // ------
+    // expand
+    // ------
+    if( py_expand && py_expand != Py_None ) {
+      if( !PyList_Check( py_expand ) ) {
+        PyErr_SetString( PyExc_TypeError, "expand must be a list of arc conditions" );
+        THROW_SILENT( CXLIB_ERR_API, 0x00A );
+      }
+      Py_ssize_t n_hops = PyList_Size( py_expand );
+      if( n_hops > VGX_EXPAND_MAX_HOPS ) {
+        PyErr_Format( PyExc_ValueError, "expand supports at most %d hops, got %lld", VGX_EXPAND_MAX_HOPS, (int64_t)n_hops );
+        THROW_SILENT( CXLIB_ERR_API, 0x00B );
+      }
+      for( Py_ssize_t h=0; h<n_hops; h++ ) {
+        PyObject *py_hop = PyList_GET_ITEM( py_expand, h );
+        PyObject *py_hop_arc = py_hop;
+        int64_t fanout = -1;
+        // { 'arc':<arc condition>, 'fanout':<max new vertices per frontier vertex> }
+        if( PyDict_Check( py_hop ) ) {
+          PyObject *py_fanout = PyDict_GetItemString( py_hop, "fanout" );
+          py_hop_arc = PyDict_GetItemString( py_hop, "arc" );
+          if( PyDict_Size( py_hop ) > (py_hop_arc != NULL) + (py_fanout != NULL) ) {
+            PyErr_SetString( PyExc_ValueError, "expand hop dict keys must be 'arc' and 'fanout'" );
+            THROW_SILENT( CXLIB_ERR_API, 0x00C );
+          }
+          if( py_fanout && py_fanout != Py_None ) {
+            if( !PyLong_CheckExact( py_fanout ) ) {
+              PyErr_SetString( PyExc_TypeError, "expand hop fanout must be an integer" );
+              THROW_SILENT( CXLIB_ERR_API, 0x00D );
+            }
+            fanout = PyLong_AsLongLong( py_fanout );
+          }
+        }
+        vgx_ExpandHop_t *hop = &param->expand.hop[ param->expand.n_hops ];
+        if( (hop->arc_condition_set = iPyVGXParser.NewArcConditionSet( param->implied.graph, py_hop_arc, param->implied.default_arcdir )) == NULL ) {
+          THROW_SILENT( CXLIB_ERR_GENERAL, 0x00E );
+        }
+        hop->fanout = fanout < 0 ? -1 : fanout;
+        param->expand.n_hops++;
+      }
+    }
+
     // --------
     // neighbor
     // --------
@@ -728,7 +781,7 @@ DLL_HIDDEN PyObject * pyvgx_Neighborhood( PyVGX_Graph *pygraph, PyObject *args,
         // -------
         // Perform
         // -------
-        py_neighborhood = _pyvgx_Neighborhood__perform( &param, &py_timing );
+        py_neighborhood = _pyvgx_Neighborhood__perform( pygraph, &param, &py_timing );
       }
 
       // -------------------------
@@ -767,7 +820,7 @@ DLL_HIDDEN PyObject * pyvgx_Initials( PyVGX_Graph *pygraph, PyObject *args, PyOb
       // -------
       // Perform
       // -------
-      py_initials = _pyvgx_Neighborhood__perform( &param, NULL );
+      py_initials = _pyvgx_Neighborhood__perform( pygraph, &param, NULL );
     }
 
     // -------------------------
@@ -805,7 +858,7 @@ DLL_HIDDEN PyObject * pyvgx_Terminals( PyVGX_Graph *pygraph, PyObject *args, PyO
       // -------
       // Perform
       // -------
-      py_terminals = _pyvgx_Neighborhood__perform( &param, NULL );
+      py_terminals = _pyvgx_Neighborhood__perform( pygraph, &param, NULL );
     }
 
     // -------------------------
@@ -843,7 +896,7 @@ DLL_HIDDEN PyObject * pyvgx_Inarcs( PyVGX_Graph *pygraph, PyObject *args, PyObje
       // -------
       // Perform
       // -------
-      py_inarcs = _pyvgx_Neighborhood__perform( &param, NULL );
+      py_inarcs = _pyvgx_Neighborhood__perform( pygraph, &param, NULL );
     }
 
     // -------------------------
@@ -881,7 +934,7 @@ DLL_HIDDEN PyObject * pyvgx_Outarcs( PyVGX_Graph *pygraph, PyObject *args, PyObj
       // -------
       // Perform
       // -------
-      py_outarcs = _pyvgx_Neighborhood__perform( &param, NULL );
+      py_outarcs = _pyvgx_Neighborhood__perform( pygraph, &param, NULL );
     }
 
     // -------------------------
@@ -901,7 +954,7 @@ DLL_HIDDEN PyObject * pyvgx_Outarcs( PyVGX_Graph *pygraph, PyObject *args, PyObj
  *
  ******************************************************************************
  */
-static PyObject * _pyvgx_Neighborhood__perform( __neighborhood_query_args *param, PyObject **py_timing ) {
+static PyObject * _pyvgx_Neighborhood__perform( PyVGX_Graph *pygraph, __neighborhood_query_args *param, PyObject **py_timing ) {
 
   PyObject *py_result = NULL;
 
@@ -931,10 +984,18 @@ static PyObject * _pyvgx_Neighborhood__perform( __neighborhood_query_args *param
   // -----------------------------------------------
   if( search_result ) {
     bool nested = param->nest > 0;
-    py_result = _pyvgx_Neighborhood__get_neighborhood_result( search_result, nested, param->nested_hits, py_timing );
-    BEGIN_PYVGX_THREADS {
-      iGraphResponse.DeleteSearchResult( &search_result );
-    } END_PYVGX_THREADS;
+    // Keep result in native form until accessed
+    if( param->lazy > 0 && iPyVGXSearchResult.IsDeferrable( search_result, nested ) ) {
+      py_result = __pyvgx_SearchResult_New( pygraph, &search_result );
+    }
+    else {
+      py_result = _pyvgx_Neighborhood__get_neighborhood_result( search_result, nested, param->nested_hits, py_timing );
+    }
+    if( search_result ) {
+      BEGIN_PYVGX_THREADS {
+        iGraphResponse.DeleteSearchResult( &search_result );
+      } END_PYVGX_THREADS;
+    }
   }
 
   // -------------------------
@@ -968,6 +1029,9 @@ static vgx_NeighborhoodQuery_t * _pyvgx_Neighborhood__get_neighborhood_query( __
     query->hits = param->hits;
     query->offset = param->offset;
     CALLABLE( query )->SetTimeout( query, param->timeout_ms, param->limexec > 0 );
+    if( iGraphResponse.DecodeCursor( param->cursor, &query->cursor, &param->implied.CSTR__error ) < 0 ) {
+      THROW_SILENT( CXLIB_ERR_API, 0xC83 );
+    }
 
     CALLABLE( query )->SetDebug( query, param->implied.__debug );
 
@@ -1008,6 +1072,14 @@ static vgx_NeighborhoodQuery_t * _pyvgx_Neighborhood__get_neighborhood_query( __
       CALLABLE( query )->AddVertexCondition( query, &param->vertex_condition );
     }
 
+    // Assign expand hops (steal)
+    for( int h=0; h<param->expand.n_hops; h++ ) {
+      if( CALLABLE( query )->AddExpandHop( query, &param->expand.hop[h].arc_condition_set, param->expand.hop[h].fanout ) < 0 ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0xC89 );
+      }
+    }
+    param->expand.n_hops = 0;
+
     // Assign ranking condition (steal)
     if( param->ranking_condition ) {
       CALLABLE( query )->AddRankingCondition( query, &param->ranking_condition );
@@ -1071,6 +1143,16 @@ static PyObject * _pyvgx_Neighborhood__get_neighborhood_result( vgx_SearchResult
             }
             iPyVGXBuilder.DictMapStringToPyObject( py_neighborhood, "counts", &py_counts );
           }
+          // Add execution plan for neighbor conditions requiring adjacency to terminal(s)
+          PyObject *py_plan;
+          if( SR->plan.planned && (py_plan = PyDict_New()) != NULL ) {
+            iPyVGXBuilder.DictMapStringToString( py_plan, "iterate", SR->plan.iterate == VGX_NEIGHBORHOOD_PLAN_ITERATE_TERMINAL ? "terminal" : "anchor" );
+            iPyVGXBuilder.DictMapStringToString( py_plan, "intersect", SR->plan.intersect == VGX_NEIGHBORHOOD_PLAN_INTERSECT_MERGE ? "merge" : "probe" );
+            iPyVGXBuilder.DictMapStringToLongLong( py_plan, "anchor_degree", SR->plan.anchor_degree );
+            iPyVGXBuilder.DictMapStringToLongLong( py_plan, "terminal_degree", SR->plan.terminal_degree );
+            iPyVGXBuilder.DictMapStringToLongLong( py_plan, "candidates", SR->plan.candidates );
+            iPyVGXBuilder.DictMapStringToPyObject( py_neighborhood, "plan", &py_plan );
+          }
         }
         // Add timing
         if( py_timing && SR->list_fields.fastmask & VGX_RESPONSE_SHOW_WITH_TIMING ) {
@@ -1084,6 +1166,10 @@ static PyObject * _pyvgx_Neighborhood__get_neighborhood_result( vgx_SearchResult
             }
           }
         }
+        // Add cursor
+        if( iPyVGXSearchResult.AddCursorMetas( py_neighborhood, SR ) < 0 ) {
+          PyErr_Clear();
+        }
       }
       else {
         PyVGX_DECREF( py_result_objects ); // error cleanup
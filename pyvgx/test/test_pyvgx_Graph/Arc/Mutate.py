@@ -0,0 +1,348 @@
+﻿###############################################################################
+# 
+# VGX Server
+# Distributed engine for plugin-based graph and vector search
+# 
+# Module:  pyvgx.test
+# File:    Mutate.py
+# Author:  Stian Lysne slysne.dev@gmail.com
+# 
+# Copyright © 2025 Rakuten, Inc.
+# 
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#     http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# 
+###############################################################################
+
+from pyvgxtest.pyvgxtest import RunTests, Expect, TestFailed
+from pyvgxtest.threads import Worker
+from pyvgx import *
+import pyvgx
+
+graph = None
+
+# Distinct vertices acquired atomically per chunk by Graph.Mutate()
+MAX_ATOMIC_BATCH_SIZE = 1 << 15
+
+
+
+
+###############################################################################
+# open_vertex
+#
+###############################################################################
+V = {}
+def open_vertex( g, name, mode ):
+    V[name] = g.OpenVertex( name, mode=mode )
+    return name
+
+
+
+
+###############################################################################
+# close_vertex
+#
+###############################################################################
+def close_vertex( g, name ):
+    try:
+        g.CloseVertex( V.pop( name ) )
+        return name
+    except KeyError:
+        return None
+
+
+
+
+###############################################################################
+# TEST_Mutate_grouping
+#
+###############################################################################
+def TEST_Mutate_grouping():
+    """
+    pyvgx.Graph.Mutate() groups items by vertex
+    test_level=3101
+    t_nominal=1
+    """
+    graph.Truncate()
+
+    # Items for the same vertex are interleaved with other vertices
+    ids = ["A", "B", "A", "C", "A", "B"]
+    terminals = ["T1", "T2", "T3", None, "T1", None]
+    properties = [{'a1':1}, {'b1':1}, {'a2':2}, {'c1':"c"}, {'a1':3}, None]
+    vectors = [None, None, None, None, None, None]
+    R = graph.Mutate( ids, arcs=("to", M_INT, 7), terminals=terminals, properties=properties, vectors=vectors )
+    Expect( len( R ) == len( ids ),                                 "one result per id" )
+    Expect( R == [1, 1, 1, 0, 0, 0],                                "unexpected results %s" % R )
+
+    # Mutations of the same vertex are applied in batch order
+    Expect( graph["A"]['a1'] == 3,                                  "last value for a1 wins" )
+    Expect( graph["A"]['a2'] == 2,                                  "a2 set" )
+    Expect( graph["B"]['b1'] == 1,                                  "b1 set" )
+    Expect( graph["C"]['c1'] == "c",                                "c1 set" )
+    Expect( sorted( graph.Neighborhood( "A" ) ) == ["T1", "T3"],    "A->T1, A->T3" )
+    Expect( graph.Neighborhood( "B" ) == ["T2"],                    "B->T2" )
+    Expect( graph.Size() == 3,                                      "3 arcs, got %d" % graph.Size() )
+
+    # Atomic acquisition: one vertex held by another thread fails the batch
+    owner = Worker( "owner" )
+    try:
+        owner.perform_sync( 10.0, open_vertex, graph, "B", "a" )
+        Expect( owner.collect() == "B",                             "should open B" )
+        R = graph.Mutate( ["A", "B", "D"], properties=[{'x':1}, {'x':2}, {'x':3}], timeout=100 )
+        for r in R:
+            Expect( isinstance( r, AccessError ),                   "all items fail with AccessError, got %s" % R )
+        Expect( 'x' not in graph["A"].properties,                   "A should not be modified" )
+        Expect( not graph.HasVertex( "D" ) or 'x' not in graph["D"].properties, "D should not be modified" )
+        owner.perform_sync( 10.0, close_vertex, graph, "B" )
+        Expect( owner.collect() == "B",                             "should close B" )
+    finally:
+        owner.terminate_sync( 10.0 )
+
+    # Retry succeeds once B is released
+    R = graph.Mutate( ["A", "B", "D"], properties=[{'x':1}, {'x':2}, {'x':3}], timeout=100 )
+    Expect( R == [0, 0, 0],                                         "unexpected results %s" % R )
+    Expect( [graph[x]['x'] for x in "ABD"] == [1, 2, 3],            "x set on all" )
+
+    # No vertices are left acquired
+    Expect( graph.GetOpenVertices() == [],                          "no open vertices" )
+
+
+
+
+###############################################################################
+# TEST_Mutate_item_errors
+#
+###############################################################################
+def TEST_Mutate_item_errors():
+    """
+    pyvgx.Graph.Mutate() reports errors per item
+    test_level=3101
+    t_nominal=1
+    """
+    graph.Truncate()
+    graph.CreateVertex( "locked" )
+
+    owner = Worker( "owner" )
+    try:
+        owner.perform_sync( 10.0, open_vertex, graph, "locked", "a" )
+        Expect( owner.collect() == "locked",                        "should open locked" )
+        # The locked vertex is only a terminal, so only its connection fails
+        R = graph.Mutate( ["A", "B", "C"], arcs="to", terminals=["X", "locked", "Y"], properties=[{'p':1}, {'p':2}, {'p':3}], timeout=100 )
+        Expect( R[0] == 1,                                          "A->X created, got %s" % R[0] )
+        Expect( isinstance( R[1], AccessError ),                    "B->locked fails with AccessError, got %s" % R[1] )
+        Expect( R[2] == 1,                                          "C->Y created, got %s" % R[2] )
+        owner.perform_sync( 10.0, close_vertex, graph, "locked" )
+        Expect( owner.collect() == "locked",                        "should close locked" )
+    finally:
+        owner.terminate_sync( 10.0 )
+
+    # The other mutations are committed, including those of the failed vertex
+    Expect( [graph[x]['p'] for x in "ABC"] == [1, 2, 3],            "properties committed" )
+    Expect( graph.Neighborhood( "A" ) == ["X"],                     "A->X" )
+    Expect( graph.Neighborhood( "B" ) == [],                        "B has no arcs" )
+    Expect( graph.Neighborhood( "C" ) == ["Y"],                     "C->Y" )
+    Expect( graph.GetOpenVertices() == [],                          "no open vertices" )
+
+    # Invalid arguments raise before anything is applied
+    try:
+        graph.Mutate( ["E", "F"], properties=[{'p':1}, {'p':1<<60}] )
+        Expect( False,                                              "out of range value should raise" )
+    except ValueError:
+        pass
+    Expect( not graph.HasVertex( "E" ),                             "E should not be created" )
+    try:
+        graph.Mutate( ["E", "F"], terminals=["G"] )
+        Expect( False,                                              "length mismatch should raise" )
+    except ValueError:
+        pass
+
+
+
+
+###############################################################################
+# TEST_Mutate_implicit_terminals
+#
+###############################################################################
+def TEST_Mutate_implicit_terminals():
+    """
+    pyvgx.Graph.Mutate() creates terminals implicitly
+    test_level=3101
+    t_nominal=1
+    """
+    graph.Truncate()
+    graph.CreateVertex( "real_terminal" )
+
+    R = graph.Mutate( ["A", "A", "B"], arcs=[("to", M_INT, 1), ("to", M_INT, 2), ("to", M_FLT, 0.5)], terminals=["virtual_terminal", "real_terminal", "virtual_terminal"] )
+    Expect( R == [1, 1, 1],                                         "unexpected results %s" % R )
+
+    # Initials are REAL, new terminals are VIRTUAL, existing terminals unchanged
+    Expect( not graph["A"].virtual,                                 "A is REAL" )
+    Expect( not graph["B"].virtual,                                 "B is REAL" )
+    Expect( graph["virtual_terminal"].virtual,                      "implicit terminal is VIRTUAL" )
+    Expect( not graph["real_terminal"].virtual,                     "existing terminal stays REAL" )
+    Expect( graph.Degree( "virtual_terminal", D_IN ) == 2,          "two inarcs to implicit terminal" )
+
+    # Implicit terminal becomes REAL when it is mutated itself
+    R = graph.Mutate( ["virtual_terminal"], properties=[{'p':1}] )
+    Expect( R == [0],                                               "unexpected results %s" % R )
+    Expect( not graph["virtual_terminal"].virtual,                  "terminal is now REAL" )
+
+    # Implicit terminal is removed with its last inarc
+    graph.Mutate( ["C"], arcs="to", terminals=["gone"] )
+    Expect( graph["gone"].virtual,                                  "gone is VIRTUAL" )
+    graph.Disconnect( "C", "to", "gone" )
+    Expect( not graph.HasVertex( "gone" ),                          "virtual terminal removed with last inarc" )
+
+
+
+
+###############################################################################
+# TEST_Mutate_self_loop
+#
+###############################################################################
+def TEST_Mutate_self_loop():
+    """
+    pyvgx.Graph.Mutate() with self-loops
+    test_level=3101
+    t_nominal=1
+    """
+    graph.Truncate()
+
+    R = graph.Mutate( ["A", "A", "B"], arcs=[("self", M_INT, 1), ("other", M_INT, 2), ("self", M_INT, 3)], terminals=["A", "B", "B"], properties=[{'p':1}, None, None] )
+    Expect( R == [1, 1, 1],                                         "unexpected results %s" % R )
+    Expect( graph.ArcValue( "A", ("self", D_OUT, M_INT), "A" ) == 1, "A->A" )
+    Expect( graph.ArcValue( "A", ("other", D_OUT, M_INT), "B" ) == 2, "A->B" )
+    Expect( graph.ArcValue( "B", ("self", D_OUT, M_INT), "B" ) == 3, "B->B" )
+    Expect( graph["A"]['p'] == 1,                                   "p set on A" )
+    Expect( graph.Degree( "A", D_OUT ) == 2,                        "A outdegree 2" )
+    Expect( graph.Degree( "A", D_IN ) == 1,                         "A indegree 1" )
+    Expect( graph.GetOpenVertices() == [],                          "no open vertices" )
+
+    # Same self-loop again creates no new arc
+    R = graph.Mutate( ["A"], arcs=("self", M_INT, 10), terminals=["A"] )
+    Expect( R == [0],                                               "unexpected results %s" % R )
+    Expect( graph.ArcValue( "A", ("self", D_OUT, M_INT), "A" ) == 10, "A->A updated" )
+
+
+
+
+###############################################################################
+# TEST_Mutate_large_batch
+#
+###############################################################################
+def TEST_Mutate_large_batch():
+    """
+    pyvgx.Graph.Mutate() with more distinct vertices than one atomic acquisition
+    test_level=3102
+    t_nominal=10
+    """
+    graph.Truncate()
+
+    N = MAX_ATOMIC_BATCH_SIZE + 1000
+    ids = ["large_%d" % i for i in range( N )]
+    terminals = ["large_%d" % ((i+1) % N) for i in range( N )]
+    properties = [{'i':i} for i in range( N )]
+    R = graph.Mutate( ids, arcs=("next", M_INT, 1), terminals=terminals, properties=properties, timeout=5000 )
+    Expect( len( R ) == N,                                          "one result per id" )
+    Expect( R.count( 1 ) == N,                                      "all arcs created" )
+    Expect( graph.Order() == N,                                     "order %d, got %d" % (N, graph.Order()) )
+    Expect( graph.Size() == N,                                      "size %d, got %d" % (N, graph.Size()) )
+    for i in [0, MAX_ATOMIC_BATCH_SIZE-1, MAX_ATOMIC_BATCH_SIZE, N-1]:
+        Expect( graph[ids[i]]['i'] == i,                            "property of %s" % ids[i] )
+        Expect( not graph[ids[i]].virtual,                          "%s is REAL" % ids[i] )
+        Expect( graph.Neighborhood( ids[i] ) == [terminals[i]],     "arc from %s" % ids[i] )
+    Expect( graph.GetOpenVertices() == [],                          "no open vertices" )
+
+
+
+
+###############################################################################
+# TEST_Mutate_properties
+#
+###############################################################################
+def TEST_Mutate_properties():
+    """
+    pyvgx.Graph.Mutate() property values match pyvgx.Vertex.SetProperty()
+    test_level=3101
+    t_nominal=1
+    """
+    graph.Truncate()
+
+    values = {
+        'none'  : None,
+        'int'   : 123,
+        'neg'   : -(1<<55),
+        'max'   : (1<<55)-1,
+        'float' : 3.25,
+        'str'   : "hello",
+        'bytes' : b"\x00\x01",
+        'list'  : [1, 2.5, "x"],
+        'dict'  : {'a':[1,2]},
+        '*virt' : "virtual string"
+    }
+
+    graph.Mutate( ["batch"], properties=[values] )
+    single = graph.NewVertex( "single" )
+    for k,v in values.items():
+        single.SetProperty( k, v )
+    graph.CloseVertex( single )
+
+    for k in values:
+        key = k.lstrip( '*' )
+        B = graph["batch"][key]
+        S = graph["single"][key]
+        Expect( B == S and type(B) is type(S),                      "%s: batch %s should equal single %s" % (key, B, S) )
+    Expect( graph["batch"].HasProperty( 'none' ),                  "None sets an exists property" )
+    Expect( graph["batch"]['virt'] == "virtual string",             "virtual property value" )
+
+    # Same validation errors as SetProperty()
+    for bad in [ {'big':1<<55}, {'small':-(1<<56)-1} ]:
+        V = graph.NewVertex( "single" )
+        single_error = None
+        try:
+            for k,v in bad.items():
+                V.SetProperty( k, v )
+        except Exception as err:
+            single_error = (type(err), str(err))
+        finally:
+            graph.CloseVertex( V )
+        batch_error = None
+        try:
+            graph.Mutate( ["batch"], properties=[bad] )
+        except Exception as err:
+            batch_error = (type(err), str(err))
+        Expect( single_error is not None,                           "SetProperty( %s ) should fail" % bad )
+        Expect( batch_error == single_error,                        "Mutate error %s should equal SetProperty error %s" % (batch_error, single_error) )
+
+    # Non-string key
+    try:
+        graph.Mutate( ["batch"], properties=[{1:1}] )
+        Expect( False,                                              "non-string key should raise" )
+    except TypeError:
+        pass
+
+
+
+
+###############################################################################
+# Run
+#
+###############################################################################
+def Run( name ):
+    """
+    """
+    global graph
+    graph = pyvgx.Graph( name )
+    RunTests( [__name__] )
+    graph.Truncate()
+    graph.Close()
+    del graph
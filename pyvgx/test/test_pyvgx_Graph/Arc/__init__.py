@@ -34,6 +34,7 @@ from . import Connect
 from . import Disconnect
 from . import Count
 from . import Accumulate
+from . import Mutate
 
 
 modules = [
@@ -41,7 +42,8 @@ modules = [
   Connect,
   Disconnect,
   Count,
-  Accumulate
+  Accumulate,
+  Mutate
 ]
 
 
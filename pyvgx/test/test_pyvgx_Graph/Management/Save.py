@@ -404,6 +404,81 @@ def TEST_Save_large_data():
 
 
 
+###############################################################################
+# TEST_Save_background
+#
+###############################################################################
+def TEST_Save_background():
+    """
+    pyvgx.Graph.Save( background=True )
+    Background save while writers are active
+    t_nominal=20
+    test_level=3101
+    """
+    import threading
+
+    if not system.IsInitialized():
+        system.Initialize( SYSROOT, euclidean=False )
+
+    g = Graph( "persisted_background" )
+    g.Truncate()
+
+    N = 20000
+    for n in range( N ):
+        V = g.NewVertex( "node_%d" % n, type="node" )
+        V["name"] = "node_%d" % n
+        V["value"] = n
+        g.CloseVertex( V )
+        g.Connect( "node_%d" % n, ("to",M_INT,n), "node_%d" % ((n+1) % N) )
+
+    # Writers keep allocators busy while snapshots are taken
+    stop = threading.Event()
+    def writer( w ):
+        n = 0
+        while not stop.is_set():
+            try:
+                V = g.NewVertex( "writer_%d_%d" % (w,n), type="extra", timeout=5000 )
+                V["text"] = rstr( random.randint( 1, 200 ) )
+                g.CloseVertex( V )
+                g.Connect( "writer_%d_%d" % (w,n), "rel_%d" % (n % 50), "node_%d" % (n % N), timeout=5000 )
+                n += 1
+            except AccessError:
+                # Graph is briefly readonly while a snapshot is taken
+                pass
+
+    writers = [ threading.Thread( target=writer, args=(w,) ) for w in range( 4 ) ]
+    for W in writers:
+        W.start()
+    try:
+        for i in range( 5 ):
+            nqwords = g.Save( 60000, background=True )
+            Expect( nqwords > 0,                    "background save %d wrote data" % i )
+    finally:
+        stop.set()
+        for W in writers:
+            W.join()
+
+    g.Close()
+    del g
+
+    # Unload and restore last snapshot
+    system.Unload()
+    system.Initialize( SYSROOT, attach=None, euclidean=False )
+
+    g = Graph( "persisted_background" )
+    Expect( g.order >= N,                           "all vertices from before the snapshots restored" )
+    for n in range( 0, N, 97 ):
+        name = "node_%d" % n
+        Expect( name in g,                          "%s restored" % name )
+        Expect( g[name]["value"] == n,              "%s property restored" % name )
+        Expect( g.ArcValue( name, ("to",D_OUT,M_INT), "node_%d" % ((n+1) % N) ) == n, "%s arc restored" % name )
+
+    g.Erase()
+    system.Unload()
+
+
+
+
 ###############################################################################
 # TEST_Reinit
 #
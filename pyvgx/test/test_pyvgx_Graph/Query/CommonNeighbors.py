@@ -0,0 +1,224 @@
+﻿###############################################################################
+#
+# VGX Server
+# Distributed engine for plugin-based graph and vector search
+#
+# Module:  pyvgx.test
+# File:    CommonNeighbors.py
+# Author:  Stian Lysne slysne.dev@gmail.com
+#
+# Copyright © 2025 Rakuten, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+###############################################################################
+
+from pyvgxtest.pyvgxtest import RunTests, Expect, TestFailed
+from pyvgx import *
+import pyvgx
+from math import *
+import random
+
+graph = None
+
+
+
+
+###############################################################################
+# __build
+#
+###############################################################################
+def __build( g ):
+    """
+    Sources s_0..s_19 with random arcs to targets t_0..t_299, and a hub
+    connected to all targets. Returns the expected adjacency.
+    """
+    random.seed( 1050 )
+    adj = {}
+    for i in range( 300 ):
+        g.CreateVertex( "t_%d" % i )
+    for s in range( 20 ):
+        a = adj[ "s_%d" % s ] = {}
+        g.CreateVertex( "s_%d" % s )
+        for t in random.sample( range( 300 ), random.randint( 0, 150 ) ):
+            rel = "odd" if t % 2 else "even"
+            g.Connect( "s_%d" % s, (rel, M_INT, t), "t_%d" % t )
+            a[ "t_%d" % t ] = rel
+    a = adj[ "hub" ] = {}
+    for t in range( 300 ):
+        g.Connect( "hub", "odd", "t_%d" % t )
+        a[ "t_%d" % t ] = "odd"
+    return adj
+
+
+
+###############################################################################
+# __expected
+#
+###############################################################################
+def __expected( adj, x, y, rel=None ):
+    """
+    """
+    A = set( t for t, r in adj.get( x, {} ).items() if rel is None or r == rel )
+    B = set( t for t, r in adj.get( y, {} ).items() if rel is None or r == rel )
+    C = A & B
+    indegree = lambda t: sum( 1 for a in adj.values() if t in a )
+    return {
+      'count':      len( C ),
+      'jaccard':    len( C ) / len( A | B ) if A | B else 0.0,
+      'cosine':     len( C ) / sqrt( len( A ) * len( B ) ) if C else 0.0,
+      'adamicadar': sum( 1 / log( max( indegree( t ), 2 ) ) for t in C )
+    }
+
+
+
+###############################################################################
+# __match
+#
+###############################################################################
+def __match( result, expected ):
+    """
+    """
+    return result['count'] == expected['count'] and all( abs( result[k] - expected[k] ) < 1e-9 for k in ['jaccard', 'cosine', 'adamicadar'] )
+
+
+
+###############################################################################
+# TEST_common_neighbors
+#
+###############################################################################
+def TEST_common_neighbors():
+    """
+    pyvgx.Graph.CommonNeighbors()
+    t_nominal=2
+    test_level=3101
+    """
+    g = pyvgx.Graph( "common_neighbors" )
+    g.Truncate()
+    adj = __build( g )
+    sources = sorted( adj.keys() )
+
+    for readonly in [False, True]:
+        if readonly:
+            g.SetGraphReadonly( 60000 )
+        for x in sources:
+            # One call per list of other vertices
+            results = g.CommonNeighbors( x, sources, metric='all' )
+            Expect( len( results ) == len( sources ) )
+            for y, result in zip( sources, results ):
+                Expect( __match( result, __expected( adj, x, y ) ), "%s/%s: %s" % (x, y, result) )
+            # Single scores
+            y = random.choice( sources )
+            E = __expected( adj, x, y )
+            Expect( g.CommonNeighbors( x, y ) == E['count'] )
+            Expect( abs( g.CommonNeighbors( x, y, metric='jaccard' ) - E['jaccard'] ) < 1e-9 )
+            Expect( abs( g.CommonNeighbors( x, y, metric='cosine' ) - E['cosine'] ) < 1e-9 )
+            Expect( abs( g.CommonNeighbors( x, y, metric='adamicadar' ) - E['adamicadar'] ) < 1e-9 )
+            # Arc condition
+            Expect( g.CommonNeighbors( x, y, arc=("odd", D_OUT) ) == __expected( adj, x, y, "odd" )['count'] )
+            if x != "hub" and y != "hub":
+                high = lambda v: set( t for t, r in adj[v].items() if r == "odd" and int( t[2:] ) > 150 )
+                Expect( g.CommonNeighbors( x, y, arc=("odd", D_OUT, M_INT, V_GT, 150) ) == len( high( x ) & high( y ) ) )
+        if readonly:
+            g.ClearGraphReadonly()
+
+    # Common inarc neighbors
+    Expect( g.CommonNeighbors( "t_1", "t_3", arc=D_IN ) == len( set( s for s, a in adj.items() if "t_1" in a ) & set( s for s, a in adj.items() if "t_3" in a ) ) )
+    Expect( g.CommonNeighbors( "t_1", "t_3" ) == 0 )
+
+    # Missing other vertex has no common neighbors
+    Expect( g.CommonNeighbors( "s_0", ["s_1", "nope"] )[1] == 0 )
+
+    # Vertex method
+    V = g.OpenVertex( "s_0", "r" )
+    Expect( V.CommonNeighbors( "s_1", metric='all' ) == g.CommonNeighbors( "s_0", "s_1", metric='all' ) )
+    g.CloseVertex( V )
+
+    # Errors
+    try:
+        g.CommonNeighbors( "nope", "s_1" )
+        Expect( False, "missing vertex should raise" )
+    except KeyError:
+        pass
+    try:
+        g.CommonNeighbors( "s_0", "s_1", arc=D_BOTH )
+        Expect( False, "D_BOTH should raise" )
+    except pyvgx.QueryError:
+        pass
+    try:
+        g.CommonNeighbors( "s_0", "s_1", metric='nope' )
+        Expect( False, "invalid metric should raise" )
+    except ValueError:
+        pass
+
+    g.Erase()
+
+
+
+###############################################################################
+# TEST_common_neighbors_evaluator
+#
+###############################################################################
+def TEST_common_neighbors_evaluator():
+    """
+    commonneighbors(), neighborjaccard(), neighborcosine(), adamicadar()
+    t_nominal=1
+    test_level=3101
+    """
+    g = pyvgx.Graph( "common_neighbors_evaluator" )
+    g.Truncate()
+    adj = __build( g )
+    sources = sorted( s for s in adj.keys() if s != "s_0" )
+    for s in sources:
+        g.Connect( "s_0", "peer", s )
+
+    select = "cn:commonneighbors(); odd:commonneighbors(relenc('odd')); j:neighborjaccard(relenc('odd'), D_OUT); c:neighborcosine(); aa:adamicadar()"
+    for readonly in [False, True]:
+        if readonly:
+            g.SetGraphReadonly( 60000 )
+        result = g.Neighborhood( "s_0", arc=("peer", D_OUT), select=select, result=R_DICT, fields=F_ID )
+        Expect( len( result ) == len( sources ) )
+        # Neighbor sets include the peer arcs of s_0
+        adj[ "s_0" ].update( { s:"peer" for s in sources } )
+        for item in result:
+            y = item['id']
+            P = item['properties']
+            E = __expected( adj, "s_0", y )
+            Expect( P['cn'] == E['count'] )
+            Expect( P['odd'] == __expected( adj, "s_0", y, "odd" )['count'] )
+            Expect( abs( P['j'] - __expected( adj, "s_0", y, "odd" )['jaccard'] ) < 1e-9 )
+            Expect( abs( P['c'] - E['cosine'] ) < 1e-9 )
+            Expect( abs( P['aa'] - E['adamicadar'] ) < 1e-9 )
+        for s in sources:
+            del adj[ "s_0" ][ s ]
+        if readonly:
+            g.ClearGraphReadonly()
+
+    # Rank by Adamic-Adar
+    result = g.Neighborhood( "s_0", arc=("peer", D_OUT), rank="adamicadar()", sortby=S_RANK, result=R_LIST, fields=F_ID|F_RANK )
+    ranks = [ rank for id, rank in result ]
+    Expect( ranks == sorted( ranks, reverse=True ) )
+
+    g.Erase()
+
+
+
+
+###############################################################################
+# Run
+#
+###############################################################################
+def Run( name ):
+    """
+    """
+    RunTests( [__name__] )
@@ -650,6 +650,84 @@ def TEST_FilterExpressions_collect():
 
 
 
+###############################################################################
+# TEST_FilterExpressions_columnar
+#
+###############################################################################
+def TEST_FilterExpressions_columnar():
+    """
+    Filters evaluated in columnar blocks give the same result as the
+    equivalent scalar filters
+    t_nominal=6
+    test_level=3202
+    """
+    g = graph
+    g.Truncate()
+    root = "columnar_root"
+    for i in range( 1000 ):
+        head = "columnar_%d" % i
+        g.Connect( root, ("to", M_INT, i % 50 - 10), head )
+        if i % 3 == 0:
+            g.Connect( root, ("to", M_FLT, (i % 17) * 0.75), head )
+        if i % 5 == 0:
+            g.Connect( root, ("other", M_INT, i), head )
+        V = g.NewVertex( head )
+        if i % 7 == 0:
+            V['s'] = "str"
+        elif i % 7 != 1:
+            V['s'] = i % 11
+        V['x'] = i % 5
+        V['f'] = (i % 9) * 0.5
+        V['big'] = 2**54 if i % 13 == 0 else i
+        g.CloseVertex( V )
+
+    expressions = [
+        "next.arc.value > 5",
+        "next.arc.value >= 5 && next.arc.value <= 20",
+        "next.arc.value - 3 == 7 || next.arc.value * 2 < -4",
+        "!(next.arc.value > 0)",
+        "next.arc.value + 0.25 > 10",
+        "next.arc.value * -1",
+        "next['x'] >= 2 && next.arc.value < 30",
+        "next['x'] * 3 - next.arc.value == 0 || !next.deg",
+        "next['s'] > 2",
+        "next['s'] != 3",
+        "next['f'] + next['x'] > 2.5",
+        "next['big'] + next['big'] > 0",
+        "next['missing'] > 0",
+        "next.deg > 1 && next.odeg == 0",
+        "(next.arc.value > 1) + (next['x'] > 1) + (next['f'] > 1) > 1",
+        "next.arc.value && next['x']",
+        "next.arc.value || next['x']",
+        "-0.0 * next['x'] || 0",
+        "pi < next.arc.value"
+    ]
+
+    def compare():
+        for expr in expressions:
+            # String operand disqualifies columnar evaluation without changing the result
+            scalar = "(%s) * ('a' == 'a')" % expr
+            for params in [ {}, {'hits':17}, {'hits':100, 'sortby':S_VAL|S_DESC} ]:
+                r1 = g.Neighborhood( root, filter=expr, fields=F_AARC, result=R_STR|R_COUNTS, **params )
+                r2 = g.Neighborhood( root, filter=scalar, fields=F_AARC, result=R_STR|R_COUNTS, **params )
+                Expect( r1 == r2, "columnar %s == scalar %s, got %s and %s" % (expr, scalar, r1, r2) )
+            Expect( g.Adjacent( root, filter=expr ) == g.Adjacent( root, filter=scalar ), expr )
+            Expect( g.Aggregate( root, filter=expr ) == g.Aggregate( root, filter=scalar ), expr )
+
+    compare()
+
+    # Head dereference without locks
+    g.SetGraphReadonly( 60000 )
+    try:
+        compare()
+    finally:
+        g.ClearGraphReadonly()
+
+    g.Truncate()
+
+
+
+
 ###############################################################################
 # Run
 #
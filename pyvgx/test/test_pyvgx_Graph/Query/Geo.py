@@ -358,6 +358,146 @@ def TEST_geo():
 
 
 
+###############################################################################
+# TEST_geo_index
+#
+###############################################################################
+def TEST_geo_index():
+    """
+    pyvgx.Graph.CreateGeoIndex() and 'geo' vertex condition
+    t_nominal=5
+    test_level=3101
+    """
+    g = pyvgx.Graph( "geo_index" )
+    g.Truncate()
+
+    R = 6371001.0
+    def haversine( lat1, lon1, lat2, lon2 ):
+        rlat1, rlat2 = radians(lat1), radians(lat2)
+        a = sin( (rlat2-rlat1)/2 )**2 + cos(rlat1) * cos(rlat2) * sin( (radians(lon2)-radians(lon1))/2 )**2
+        return R * 2 * atan2( sqrt(a), sqrt(1-a) )
+
+    random.seed( 1041 )
+    POS = {}
+    # Clusters (including the antimeridian and near a pole) plus global scatter
+    for n, (clat, clon, spread) in enumerate( [(35.68, 139.77, 1.0), (0.0, 179.9, 0.5), (89.5, 0.0, 0.4), (-33.9, 151.2, 0.05)] ):
+        for i in range( 500 ):
+            lat = max( -90.0, min( 90.0, clat + random.uniform( -spread, spread ) ) )
+            lon = clon + random.uniform( -spread, spread )
+            if lon > 180.0:
+                lon -= 360.0
+            POS[ "c%d_%d" % (n,i) ] = (lat, lon)
+    for i in range( 1000 ):
+        POS[ "r%d" % i ] = (random.uniform( -90, 90 ), random.uniform( -180, 180 ))
+
+    for name, (lat, lon) in POS.items():
+        V = g.NewVertex( name, type="place" )
+        V['lat'] = lat
+        V['lon'] = lon
+        g.CloseVertex( V )
+    # Vertices without a valid position are not indexed
+    V = g.NewVertex( "nowhere", type="place" )
+    V['lat'] = "north"
+    V['lon'] = 10.0
+    g.CloseVertex( V )
+    V = g.NewVertex( "outside", type="place" )
+    V['lat'] = 91.0
+    V['lon'] = 10.0
+    g.CloseVertex( V )
+
+    # Condition requires index
+    try:
+        g.Vertices( condition={ 'geo':(0.0, 0.0, 1000) } )
+        Expect( False, "geo condition without index should fail" )
+    except SearchError:
+        pass
+
+    Expect( g.CreateGeoIndex() == len(POS), "all positioned vertices indexed" )
+
+    def check( lat, lon, radius, positive=True ):
+        if positive:
+            cond = { 'geo':(lat, lon, radius) }
+        else:
+            cond = { 'geo':(False, (lat, lon, radius)) }
+        result = set( g.Vertices( condition=cond ) )
+        expect = set()
+        for name, (plat, plon) in POS.items():
+            d = haversine( lat, lon, plat, plon )
+            if abs( d - radius ) < 1e-3:
+                result.discard( name )
+                continue
+            if (d <= radius) == positive:
+                expect.add( name )
+        if not positive:
+            result.discard( "nowhere" )
+            result.discard( "outside" )
+        Expect( result == expect, "geo (%f, %f, %f, %s): %d results, expected %d" % (lat, lon, radius, positive, len(result), len(expect)) )
+        return len( expect )
+
+    n = 0
+    for lat, lon, radius in [ (35.68, 139.77, 50000), (35.68, 139.77, 1000), (0.0, 180.0, 30000), (0.0, -179.95, 20000),
+                              (89.9, 90.0, 60000), (-33.9, 151.2, 3000), (10.0, 10.0, 2000000), (0.0, 0.0, 10), (0.0, 0.0, 25000000) ]:
+        n += check( lat, lon, radius )
+    Expect( n > 0, "some hits" )
+    check( 35.68, 139.77, 50000, positive=False )
+
+    # Dict syntax and combination with other conditions
+    Expect( len( g.Vertices( condition={ 'type':'place', 'geo':{'lat':35.68, 'lon':139.77, 'radius':50000} } ) ) == check( 35.68, 139.77, 50000 ), "dict syntax" )
+    Expect( len( g.Vertices( condition={ 'type':'nope', 'geo':(35.68, 139.77, 50000) } ) ) == 0, "type mismatch" )
+
+    # Index follows property updates and deletes
+    V = g.OpenVertex( "r0" )
+    V['lat'] = 35.68
+    V['lon'] = 139.77
+    g.CloseVertex( V )
+    POS[ "r0" ] = (35.68, 139.77)
+    V = g.OpenVertex( "c0_0" )
+    del V['lat']
+    g.CloseVertex( V )
+    del POS[ "c0_0" ]
+    V = g.OpenVertex( "c0_1" )
+    V.RemoveProperties()
+    g.CloseVertex( V )
+    del POS[ "c0_1" ]
+    g.DeleteVertex( "c0_2" )
+    del POS[ "c0_2" ]
+    V = g.NewVertex( "added", type="place", properties={ 'lat':35.7, 'lon':139.7 } )
+    g.CloseVertex( V )
+    POS[ "added" ] = (35.7, 139.7)
+    check( 35.68, 139.77, 100000 )
+    Expect( "r0" in g.Vertices( condition={ 'geo':(35.68, 139.77, 1) } ), "moved vertex found" )
+
+    # Invalid conditions
+    for bad in [ (95.0, 0.0, 100), (0.0, 0.0, -1), (0.0, 0.0), "x" ]:
+        try:
+            g.Vertices( condition={ 'geo':bad } )
+            Expect( False, "invalid geo condition %s should fail" % (bad,) )
+        except (QueryError, TypeError):
+            pass
+
+    # Truncate rebuilds, drop removes
+    for i in range( 20 ):
+        name = "other_%d" % i
+        POS[ name ] = (35.68 + i * 0.01, 139.77)
+        V = g.NewVertex( name, type="other", properties={ 'lat':POS[name][0], 'lon':POS[name][1] } )
+        g.CloseVertex( V )
+    check( 35.68, 139.77, 100000 )
+    Expect( g.Truncate( "other" ) == 20, "truncated" )
+    for i in range( 20 ):
+        del POS[ "other_%d" % i ]
+    check( 35.68, 139.77, 100000 )
+    Expect( g.DropGeoIndex() is True, "index dropped" )
+    Expect( g.DropGeoIndex() is False, "no index to drop" )
+    try:
+        g.Vertices( condition={ 'geo':(0.0, 0.0, 1000) } )
+        Expect( False, "geo condition without index should fail" )
+    except SearchError:
+        pass
+
+    g.Erase()
+
+
+
 
 ###############################################################################
 # Run
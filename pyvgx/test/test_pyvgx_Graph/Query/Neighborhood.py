@@ -30,6 +30,8 @@ import pyvgx
 from math import *
 import operator
 from functools import reduce
+import random
+import threading
 
 graph = None
 
@@ -942,6 +944,459 @@ def TEST_ExecuteNeighborhoodQuery():
 
 
 
+###############################################################################
+# TEST_Neighborhood_top_k_floor
+#
+###############################################################################
+def TEST_Neighborhood_top_k_floor():
+    """
+    pyvgx.Graph.Neighborhood()
+    pyvgx.Graph.Vertices()
+    Top-k collection with heap floor rejection
+    test_level=3101
+    """
+    graph.Truncate()
+    N = 2000
+    A = graph.NewVertex( "A" )
+    fvalues = []
+    ivalues = []
+    for n in range( N ):
+        # Plenty of duplicates to exercise ties with the heap floor
+        f = ((n * 7919) % 331) / 16.0
+        i = (n * 104729) % 503 - 250
+        fvalues.append( f )
+        ivalues.append( i )
+        graph.Connect( A, ("flt", M_FLT, f), "topk_%d" % n )
+        graph.Connect( A, ("int", M_INT, i), "topk_%d" % n )
+        V = graph.OpenVertex( "topk_%d" % n, "w" )
+        V['w'] = i
+        graph.CloseVertex( V )
+
+    for hits in [1, 2, 10, 100, 1999, 2000, 5000]:
+        for direction, reverse in [(S_DESC, True), (S_ASC, False)]:
+            # Double sort values
+            expected = sorted( fvalues, reverse=reverse )[:hits]
+            result = graph.Neighborhood( A, arc=("flt", D_OUT), fields=F_VAL, result=R_LIST, sortby=S_VAL|direction, hits=hits )
+            Expect( [r[0] for r in result] == expected, "S_VAL float top %d" % hits )
+
+            # Integer sort values
+            expected = sorted( ivalues, reverse=reverse )[:hits]
+            result = graph.Neighborhood( A, arc=("int", D_OUT), fields=F_VAL, result=R_LIST, sortby=S_VAL|direction, hits=hits )
+            Expect( [r[0] for r in result] == expected, "S_VAL int top %d" % hits )
+
+            # Composite rank
+            expected = sorted( [2.0*f for f in fvalues], reverse=reverse )[:hits]
+            result = graph.Neighborhood( A, arc=("flt", D_OUT), fields=F_RANK, result=R_LIST, sortby=S_RANK|direction, rank="2.0 * next.arc.value", hits=hits )
+            Expect( [r[0] for r in result] == expected, "S_RANK top %d" % hits )
+
+            # Vertex collector
+            expected = sorted( [float(i) for i in ivalues if i >= 0], reverse=reverse )[:hits]
+            result = graph.Vertices( condition={'property':{'w':(V_GTE, 0)}}, fields=F_RANK, result=R_LIST, sortby=S_RANK|direction, rank="vertex['w']", hits=hits )
+            Expect( [r[0] for r in result] == expected, "Vertices S_RANK top %d" % hits )
+
+        # Early exit against the current floor
+        expected = sorted( fvalues, reverse=True )[:hits]
+        result = graph.Neighborhood( A, arc=("flt", D_OUT), fields=F_RANK, result=R_LIST, sortby=S_RANK|S_DESC, rank="next.arc.value > collectable.real ? next.arc.value : -1", hits=hits )
+        Expect( [r[0] for r in result] == expected, "collectable.real early exit top %d" % hits )
+
+        # Paging through the same top-k
+        if hits <= 100:
+            full = graph.Neighborhood( A, arc=("flt", D_OUT), fields=F_VAL, result=R_LIST, sortby=S_VAL|S_DESC, hits=hits+50 )
+            page = graph.Neighborhood( A, arc=("flt", D_OUT), fields=F_VAL, result=R_LIST, sortby=S_VAL|S_DESC, hits=hits, offset=50 )
+            Expect( [r[0] for r in page] == [r[0] for r in full[50:]], "offset page top %d" % hits )
+
+    graph.CloseVertex( A )
+    graph.Truncate()
+
+
+
+
+###############################################################################
+# TEST_Neighborhood_cursor
+#
+###############################################################################
+def TEST_Neighborhood_cursor():
+    """
+    pyvgx.Graph.Neighborhood()
+    pyvgx.Graph.Vertices()
+    Keyset pagination with cursor
+    test_level=3101
+    """
+    graph.Truncate()
+    N = 500
+    A = graph.NewVertex( "A" )
+    for n in range( N ):
+        # Few distinct values to exercise ties across page boundaries
+        graph.Connect( A, ("int", M_INT, n % 7), "cursor_%d" % n )
+        graph.Connect( A, ("flt", M_FLT, (n % 11) / 4.0), "cursor_%d" % n )
+        V = graph.OpenVertex( "cursor_%d" % n, "w" )
+        V['w'] = n % 13
+        graph.CloseVertex( V )
+
+    def all_pages( query, hits, **kwargs ):
+        items = []
+        cursor = ""
+        while cursor is not None:
+            page = query( hits=hits, cursor=cursor, result=R_LIST|R_METAS, **kwargs )
+            listed = page.get( 'neighborhood', page.get( 'vertices' ) )
+            Expect( len( page['cursors'] ) == len( listed ), "one cursor per item" )
+            Expect( len( listed ) <= hits, "page size at most hits" )
+            items.extend( listed )
+            cursor = page['cursor']
+        return items
+
+    for hits in [1, 3, 64, 499, 500, 1000]:
+        for direction, reverse in [(S_DESC, True), (S_ASC, False)]:
+            # Integer arc values
+            items = all_pages( lambda **kw: graph.Neighborhood( A, arc=("int", D_OUT), fields=F_ID|F_VAL, sortby=S_VAL|direction, **kw ), hits )
+            Expect( len( items ) == N, "all arcs paged, hits=%d" % hits )
+            Expect( len( set( r[1] for r in items ) ) == N, "no duplicates, hits=%d" % hits )
+            values = [r[0] for r in items]
+            Expect( values == sorted( values, reverse=reverse ), "arcs in sort order, hits=%d" % hits )
+
+            # Real arc values
+            items = all_pages( lambda **kw: graph.Neighborhood( A, arc=("flt", D_OUT), fields=F_ID|F_VAL, sortby=S_VAL|direction, **kw ), hits )
+            Expect( len( set( r[1] for r in items ) ) == N, "no duplicates (real), hits=%d" % hits )
+            values = [r[0] for r in items]
+            Expect( values == sorted( values, reverse=reverse ), "arcs in sort order (real), hits=%d" % hits )
+
+            # Global vertex query with rank expression
+            items = all_pages( lambda **kw: graph.Vertices( condition={'property':{'w':(V_GTE, 0)}}, fields=F_ID|F_RANK, sortby=S_RANK|direction, rank="vertex['w']", **kw ), hits )
+            Expect( len( set( r[0] for r in items ) ) == N, "all vertices paged, hits=%d" % hits )
+            values = [r[1] for r in items]
+            Expect( values == sorted( values, reverse=reverse ), "vertices in sort order, hits=%d" % hits )
+
+    # Unsupported combinations
+    for kwargs in [ {'sortby':S_NONE}, {'sortby':S_ID}, {'sortby':S_RANDOM}, {'sortby':S_VAL, 'offset':10} ]:
+        try:
+            graph.Neighborhood( A, cursor="", **kwargs )
+            Expect( False, "cursor should not be accepted with %s" % kwargs )
+        except SearchError:
+            pass
+
+    # Invalid or mismatched cursor
+    try:
+        graph.Neighborhood( A, sortby=S_VAL, cursor="nonsense" )
+        Expect( False, "invalid cursor" )
+    except QueryError:
+        pass
+    token = graph.Neighborhood( A, arc=("int", D_OUT), sortby=S_VAL, hits=5, cursor="", result=R_METAS )['cursor']
+    try:
+        graph.Neighborhood( A, arc=("int", D_OUT), sortby=S_ODEG, hits=5, cursor=token )
+        Expect( False, "cursor from a different sort key" )
+    except SearchError:
+        pass
+
+    graph.CloseVertex( A )
+    graph.Truncate()
+
+
+
+
+
+###############################################################################
+# TEST_Neighborhood_expand
+#
+###############################################################################
+def TEST_Neighborhood_expand():
+    """
+    pyvgx.Graph.Neighborhood()
+    Multi-hop expansion
+    test_level=3101
+    """
+    graph.Truncate()
+    random.seed( 1046 )
+    N = 400
+    for n in range( N ):
+        graph.CreateVertex( "expand_%d" % n, type="node" )
+    for i in range( 3000 ):
+        a, b = random.randrange( N ), random.randrange( N )
+        rel = "friend" if random.random() < 0.7 else "other"
+        graph.Connect( "expand_%d" % a, (rel, M_INT, random.randint( 0, 100 )), "expand_%d" % b )
+
+    def adjacent( vertex, rel, arcdir ):
+        return graph.Neighborhood( vertex, arc=(rel, arcdir), hits=-1 )
+
+    def bfs( anchor, hops, final_rel=None, final_dir=D_OUT ):
+        visited = set( [anchor] )
+        frontier = [anchor]
+        for rel, arcdir, fanout in hops:
+            following = []
+            for vertex in frontier:
+                n = 0
+                for head in adjacent( vertex, rel, arcdir ):
+                    if fanout == n:
+                        break
+                    if head not in visited:
+                        visited.add( head )
+                        following.append( head )
+                        n += 1
+            frontier = following
+        neighbors = set()
+        for vertex in frontier:
+            neighbors.update( head for head in adjacent( vertex, final_rel, final_dir ) if head not in visited )
+        return neighbors, visited, frontier
+
+    for anchor in [ "expand_%d" % n for n in range( 0, N, 37 ) ]:
+        # Friends of friends
+        result = graph.Neighborhood( anchor, expand=["friend"], arc=("friend", D_OUT), hits=-1 )
+        expect, visited, frontier = bfs( anchor, [("friend", D_OUT, -1)], "friend" )
+        Expect( len( result ) == len( set( result ) ), "each neighbor once" )
+        Expect( set( result ) == expect, "friends of friends of %s" % anchor )
+        # Two hops with different conditions and directions
+        result = graph.Neighborhood( anchor, expand=[("friend", D_OUT), ("other", D_IN)], hits=-1 )
+        expect, visited, frontier = bfs( anchor, [("friend", D_OUT, -1), ("other", D_IN, -1)] )
+        Expect( set( result ) == expect and len( result ) == len( expect ), "two hops from %s" % anchor )
+        # Any direction
+        result = graph.Neighborhood( anchor, expand=[(None, D_ANY)], arc=(None, D_ANY), hits=-1 )
+        expect, visited, frontier = bfs( anchor, [(None, D_ANY, -1)], None, D_ANY )
+        Expect( set( result ) == expect and len( result ) == len( expect ), "any direction from %s" % anchor )
+        # Fanout bounds the frontier
+        result = graph.Neighborhood( anchor, expand=[{'arc':"friend", 'fanout':1}, {'arc':"friend", 'fanout':2}], hits=-1, fields=F_AARC )
+        expect, visited, frontier = bfs( anchor, [("friend", D_OUT, 1), ("friend", D_OUT, 2)] )
+        Expect( len( frontier ) <= 2, "fanout limits frontier" )
+        Expect( len( result ) == len( expect ), "fanout from %s: %d, expected %d" % (anchor, len( result ), len( expect )) )
+        # Ranked with hits and offset
+        full = graph.Neighborhood( anchor, expand=["friend", "friend"], hits=-1, rank="next.deg", sortby=S_RANK, fields=F_ID|F_RANK, result=R_LIST )
+        expect, visited, frontier = bfs( anchor, [("friend", D_OUT, -1), ("friend", D_OUT, -1)] )
+        Expect( set( r[0] for r in full ) == expect, "ranked expansion from %s" % anchor )
+        scores = [ r[1] for r in full ]
+        Expect( scores == sorted( scores, reverse=True ), "sorted by rank" )
+        page = graph.Neighborhood( anchor, expand=["friend", "friend"], offset=3, hits=5, rank="next.deg", sortby=S_RANK, fields=F_RANK, result=R_LIST )
+        Expect( [ r[0] for r in page ] == scores[3:8], "offset and hits" )
+        # Vertex condition applies to final neighbors
+        result = graph.Neighborhood( anchor, expand=["friend"], neighbor={'degree':(V_GT, 15)}, hits=-1 )
+        expect, visited, frontier = bfs( anchor, [("friend", D_OUT, -1)] )
+        Expect( set( result ) == set( v for v in expect if graph[v].deg > 15 ), "neighbor condition from %s" % anchor )
+
+    # Expanded vertices are released
+    result = graph.Neighborhood( "expand_0", expand=["friend", "friend"], hits=-1 )
+    expect, visited, frontier = bfs( "expand_0", [("friend", D_OUT, -1), ("friend", D_OUT, -1)] )
+    for vertex in visited:
+        V = graph.OpenVertex( vertex, "w", timeout=0 )
+        graph.CloseVertex( V )
+
+    # Expanded vertex locked by writer in another thread
+    if frontier:
+        opened = threading.Event()
+        done = threading.Event()
+        def writer():
+            V = graph.OpenVertex( frontier[0], "w" )
+            opened.set()
+            done.wait( 10 )
+            graph.CloseVertex( V )
+        W = threading.Thread( target=writer )
+        W.start()
+        opened.wait( 10 )
+        try:
+            graph.Neighborhood( "expand_0", expand=["friend", "friend"], hits=-1 )
+            Expect( False, "locked frontier vertex" )
+        except AccessError:
+            pass
+        finally:
+            done.set()
+            W.join()
+
+    # Readonly graph
+    graph.SetGraphReadonly( 60000 )
+    try:
+        result = graph.Neighborhood( "expand_0", expand=["friend", "friend"], hits=-1 )
+        Expect( set( result ) == bfs( "expand_0", [("friend", D_OUT, -1), ("friend", D_OUT, -1)] )[0], "readonly graph" )
+    finally:
+        graph.ClearGraphReadonly()
+
+    # Invalid expansions
+    for kwargs in [ {'expand':"friend"}, {'expand':["friend"]*9}, {'expand':[{'arcs':"friend"}]}, {'expand':[{'arc':"friend", 'fanout':"x"}]},
+                    {'expand':[("friend", D_BOTH)]}, {'expand':["friend"], 'arc':(None, D_BOTH)}, {'expand':["friend"], 'neighbor':{'arc':D_OUT, 'collect':C_COLLECT}} ]:
+        try:
+            graph.Neighborhood( "expand_0", **kwargs )
+            Expect( False, "invalid expansion %s" % kwargs )
+        except (TypeError, ValueError, QueryError, SearchError):
+            pass
+
+    graph.Truncate()
+
+
+
+
+
+###############################################################################
+# TEST_Neighborhood_parallel_traversal
+#
+###############################################################################
+def TEST_Neighborhood_parallel_traversal():
+    """
+    pyvgx.Graph.Neighborhood()
+    Parallel traversal of high degree anchor
+    test_level=3101
+    """
+    graph.Truncate()
+    N = 20000
+    for i in range( N ):
+        graph.Connect( "hub", ("to", M_INT, (i*7919) % 100003), "spoke_%d" % i )
+        if i % 3 == 0:
+            graph.Connect( "spoke_%d" % i, ("from", M_FLT, i/3.0), "hub" )
+
+    queries = [
+        { 'arc':("to", D_OUT), 'sortby':S_VAL|S_DESC, 'hits':50, 'fields':F_AARC },
+        { 'arc':("to", D_OUT), 'sortby':S_VAL|S_ASC, 'offset':10, 'hits':20, 'fields':F_AARC },
+        { 'arc':("to", D_OUT), 'rank':"next.arc.value * 2 + 1", 'sortby':S_RANK, 'hits':30, 'fields':F_AARC|F_RANK },
+        { 'arc':("to", D_OUT), 'filter':"next.arc.value > 50000", 'sortby':S_VAL, 'hits':100, 'fields':F_AARC },
+        { 'arc':("from", D_IN), 'sortby':S_VAL|S_DESC, 'hits':25, 'fields':F_AARC },
+        { 'arc':("to", D_OUT), 'sortby':S_VAL|S_DESC, 'hits':-1, 'fields':F_AARC },
+        { 'sortby':S_VAL|S_DESC, 'hits':40, 'fields':F_AARC },
+        { 'arc':("to", D_OUT), 'sortby':S_VAL|S_DESC, 'hits':10, 'result':R_LIST|R_COUNTS },
+        # Rank depends on visit order, must run serially
+        { 'arc':("to", D_OUT), 'rank':"inc(0)", 'sortby':S_RANK|S_DESC, 'hits':20, 'fields':F_AARC|F_RANK }
+    ]
+
+    default = graph.ParallelTraversal()
+    Expect( default[0] > 0 and default[1] > 1, "default settings" )
+    try:
+        graph.ParallelTraversal( workers=1000 )
+        Expect( False, "too many workers" )
+    except ValueError:
+        pass
+    Expect( graph.ParallelTraversal() == default, "settings unchanged" )
+
+    try:
+        for frozen in [False, True]:
+            if frozen:
+                graph.FreezeArcs( 1000 )
+            graph.SetGraphReadonly( 60000 )
+            try:
+                Expect( graph.ParallelTraversal( workers=0 )[1] == 0, "disabled" )
+                serial = [ graph.Neighborhood( "hub", **q ) for q in queries ]
+                for workers in [2, 4, 7]:
+                    Expect( graph.ParallelTraversal( min_degree=1000, workers=workers ) == (1000, workers), "enabled" )
+                    parallel = [ graph.Neighborhood( "hub", **q ) for q in queries ]
+                    for q, a, b in zip( queries, serial, parallel ):
+                        Expect( a == b, "parallel result equals serial result for %s, workers=%d, frozen=%s" % (q, workers, frozen) )
+                # Below threshold
+                graph.ParallelTraversal( min_degree=N+1 )
+                Expect( [ graph.Neighborhood( "hub", **q ) for q in queries ] == serial, "serial below min_degree" )
+            finally:
+                graph.ClearGraphReadonly()
+            # Writable graph is always traversed serially
+            graph.ParallelTraversal( min_degree=1000, workers=4 )
+            Expect( graph.Neighborhood( "hub", **queries[0] ) == serial[0], "writable graph" )
+    finally:
+        graph.ParallelTraversal( *default )
+
+    graph.Truncate()
+
+
+
+def TEST_Neighborhood_frozen_oversized():
+    """
+    pyvgx.Graph.FreezeArcs()
+    Arc arrays exceeding frozen capacity are reported and left unchanged
+    test_level=3101
+    """
+    graph.Truncate()
+    # Frozen form supports at most 256 distinct relationship/modifier keys
+    for i in range( 300 ):
+        graph.Connect( "wide", ("rel_%d" % i, M_INT, i), "w_%d" % i )
+    for i in range( 300 ):
+        graph.Connect( "narrow", ("to", M_INT, i), "n_%d" % i )
+
+    before = graph.Neighborhood( "wide", sortby=S_VAL, fields=F_AARC )
+    n_frozen, n_bytes, n_oversized = graph.FreezeArcs( 100 )
+    Expect( n_frozen == 1 and n_bytes > 0,      "narrow frozen, got %d (%d bytes)" % (n_frozen, n_bytes) )
+    Expect( n_oversized == 1,                   "wide oversized, got %d" % n_oversized )
+    Expect( graph.Neighborhood( "wide", sortby=S_VAL, fields=F_AARC ) == before, "oversized arcs unchanged" )
+    Expect( graph.ThawArcs() == 1,              "only narrow was frozen" )
+
+    graph.Truncate()
+
+
+
+def TEST_Neighborhood_adaptive_plan():
+    """
+    pyvgx.Graph.Neighborhood()
+    Degree-aware planning of neighbor adjacency conditions
+    test_level=3101
+    """
+    graph.Truncate()
+    N = 5000
+    for i in range( N ):
+        graph.Connect( "A", ("r", M_INT, i), "n%d" % i )
+    for i in range( 0, N, 250 ):
+        graph.Connect( "n%d" % i, "to", "C" )
+        graph.Connect( "n%d" % (i+1), "to", "C" )
+        graph.Connect( "n%d" % (i+1), ("to", M_INT, 5), "C" )
+        graph.Connect( "C", "back", "n%d" % (i+2) )
+        graph.Connect( "n%d" % (i+3), "to", "D" )
+    for i in range( 0, N, 4 ):
+        graph.Connect( "n%d" % i, "to", "E" )
+    for i in range( 6000 ):
+        graph.Connect( "n%d" % (i % N), ("to", M_INT, i), "BIG" )
+
+    def expected( nodes ):
+        return sorted( ["n%d" % i for i in nodes], key=lambda x: int(x[1:]) )
+
+    c_out = [i for i in range( 0, N, 250 )] + [i+1 for i in range( 0, N, 250 )]
+    c_in = [i+2 for i in range( 0, N, 250 )]
+    d_out = [i+3 for i in range( 0, N, 250 )]
+
+    cases = [
+        ( {'arc':("to", D_OUT), 'neighbor':"C"},               c_out,                  'terminal' ),
+        ( {'arc':D_IN, 'neighbor':"C"},                        c_in,                   'terminal' ),
+        ( {'neighbor':"C"},                                    c_out + c_in,           'terminal' ),
+        ( {'arc':D_OUT, 'neighbor':["C", "D"]},                c_out + d_out,          'terminal' ),
+        ( {'arc':("to", D_OUT, M_INT, V_EQ, 5), 'neighbor':"C"}, c_out[len(c_out)//2:], 'terminal' ),
+        ( {'arc':D_OUT, 'neighbor':"E"},                       range( 0, N, 4 ),       'terminal' ),
+        ( {'arc':D_OUT, 'neighbor':"BIG"},                     range( N ),             'anchor' ),
+        ( {'arc':D_OUT, 'neighbor':"nonexist"},                [],                     None )
+    ]
+
+    for frozen in [False, True]:
+        if frozen:
+            graph.FreezeArcs( 100 )
+        for adjacent, nodes, iterate in cases:
+            R = graph.Neighborhood( "A", arc=("r", D_OUT), neighbor={'adjacent':adjacent}, sortby=S_VAL, result=R_DICT|R_COUNTS )
+            Expect( [x['id'] for x in R['neighborhood']] == expected( nodes )[::-1], "%s frozen=%s" % (adjacent, frozen) )
+            Expect( R['counts']['arcs'] == len( R['neighborhood'] ) )
+            if iterate is None:
+                continue
+            plan = R['plan']
+            Expect( plan['iterate'] == iterate, "%s, got %s" % (iterate, plan) )
+            Expect( plan['anchor_degree'] == N )
+            if iterate == 'terminal':
+                Expect( plan['terminal_degree'] < N )
+                Expect( plan['candidates'] >= len( R['neighborhood'] ) )
+                # Large candidate set is merged with frozen array of arcs
+                Expect( plan['intersect'] == ('merge' if frozen and plan['candidates'] > 1000 else 'probe'), "%s" % plan )
+            # Unsorted and limited
+            L = graph.Neighborhood( "A", arc=("r", D_OUT), neighbor={'adjacent':adjacent}, hits=5 )
+            Expect( len( L ) == min( 5, len( nodes ) ) and set( L ) <= set( expected( nodes ) ) )
+
+    # Readonly graph with parallel traversal enabled runs planned traversal serially
+    default = graph.ParallelTraversal()
+    graph.SetGraphReadonly( 60000 )
+    try:
+        graph.ParallelTraversal( min_degree=1000, workers=4 )
+        for adjacent, nodes, iterate in cases:
+            R = graph.Neighborhood( "A", arc=("r", D_OUT), neighbor={'adjacent':adjacent}, sortby=S_VAL, hits=10, result=R_DICT|R_COUNTS )
+            Expect( [x['id'] for x in R['neighborhood']] == expected( nodes )[::-1][:10], "%s readonly" % adjacent )
+            if iterate is not None:
+                Expect( R['plan']['iterate'] == iterate )
+    finally:
+        graph.ParallelTraversal( *default )
+        graph.ClearGraphReadonly()
+
+    # Small anchor is always iterated
+    graph.Connect( "small", "r", "n0" )
+    R = graph.Neighborhood( "small", arc=("r", D_OUT), neighbor={'adjacent':{'arc':D_OUT, 'neighbor':"C"}}, result=R_DICT|R_COUNTS )
+    Expect( R['neighborhood'] == [{'id':"n0"}] and R['plan']['iterate'] == 'anchor' )
+
+    # No plan without terminal adjacency condition
+    R = graph.Neighborhood( "A", arc=("r", D_OUT), neighbor={'adjacent':{'arc':D_OUT}}, hits=1, result=R_DICT|R_COUNTS )
+    Expect( 'plan' not in R )
+
+    graph.Truncate()
+
+
 
 ###############################################################################
 # Run
@@ -0,0 +1,249 @@
+﻿###############################################################################
+#
+# VGX Server
+# Distributed engine for plugin-based graph and vector search
+#
+# Module:  pyvgx.test
+# File:    Text.py
+# Author:  Stian Lysne slysne.dev@gmail.com
+#
+# Copyright © 2025 Rakuten, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+###############################################################################
+
+from pyvgxtest.pyvgxtest import RunTests, Expect, TestFailed
+from pyvgx import *
+import pyvgx
+from math import *
+import random
+
+graph = None
+
+
+
+WORDS = [ "quick", "brown", "fox", "jumps", "over", "lazy", "dog", "red", "green", "blue",
+          "graph", "vertex", "arc", "query", "index", "text", "search", "rank", "score", "term" ]
+
+
+
+###############################################################################
+# TEST_text_index
+#
+###############################################################################
+def TEST_text_index():
+    """
+    pyvgx.Graph.CreateTextIndex() and 'text' vertex condition
+    t_nominal=6
+    test_level=3101
+    """
+    g = pyvgx.Graph( "text_index" )
+    g.Truncate()
+
+    random.seed( 1045 )
+    TEXT = {}
+    for i in range( 3000 ):
+        TEXT[ "doc_%d" % i ] = " ".join( random.choice( WORDS ) for n in range( random.randint( 1, 12 ) ) )
+    # Case is normalized
+    TEXT[ "shout" ] = "QUICK Brown FOX"
+
+    for name, text in TEXT.items():
+        V = g.NewVertex( name, type="doc" )
+        V['title'] = text
+        V['n'] = len( text )
+        g.CloseVertex( V )
+    # Vertices without string title are not indexed
+    V = g.NewVertex( "number", type="doc" )
+    V['title'] = 123
+    g.CloseVertex( V )
+    V = g.NewVertex( "untitled", type="doc" )
+    g.CloseVertex( V )
+
+    # Condition requires index
+    try:
+        g.Vertices( condition={ 'text':('title', 'fox') } )
+        Expect( False, "text condition without index should fail" )
+    except SearchError:
+        pass
+
+    Expect( g.CreateTextIndex( 'title' ) == len(TEXT), "all titled vertices indexed" )
+
+    def matches( text, terms, mode ):
+        words = text.lower().split()
+        q = terms.lower().split()
+        if not q:
+            return False
+        if mode == 'all':
+            return all( t in words for t in q )
+        if mode == 'any':
+            return any( t in words for t in q )
+        return any( words[i:i+len(q)] == q for i in range( len(words) - len(q) + 1 ) )
+
+    def check( terms, mode='all', positive=True ):
+        cond = ('title', terms, mode)
+        if not positive:
+            cond = (False, cond)
+        result = set( g.Vertices( condition={ 'text':cond }, hits=-1 ) )
+        expect = set( name for name, text in TEXT.items() if matches( text, terms, mode ) == positive )
+        if not positive:
+            result.discard( "number" )
+            result.discard( "untitled" )
+        Expect( result == expect, "text (%s, %s, %s): %d results, expected %d" % (terms, mode, positive, len(result), len(expect)) )
+        return len( expect )
+
+    def check_all():
+        n = 0
+        for terms in [ "fox", "quick fox", "quick brown fox", "graph query index", "nothing", "fox nothing", "dog dog" ]:
+            for mode in [ 'all', 'any', 'phrase' ]:
+                n += check( terms, mode )
+        return n
+
+    Expect( check_all() > 0, "some hits" )
+    check( "fox", positive=False )
+    check( "lazy dog", 'phrase', positive=False )
+
+    # Dict syntax and combination with other conditions
+    Expect( len( g.Vertices( condition={ 'type':'doc', 'text':{'key':'title', 'terms':'lazy dog', 'mode':'phrase'} }, hits=-1 ) ) == check( "lazy dog", 'phrase' ), "dict syntax" )
+    Expect( len( g.Vertices( condition={ 'type':'nope', 'text':('title', 'fox') } ) ) == 0, "type mismatch" )
+    n_long = len( [ 1 for text in TEXT.values() if matches( text, "fox", 'all' ) and len(text) > 40 ] )
+    Expect( len( g.Vertices( condition={ 'text':('title', 'fox'), 'property':{'n':(V_GT, 40)} }, hits=-1 ) ) == n_long, "combined with property" )
+
+    # Index follows property updates and deletes (many updates to merge pending postings)
+    for i in range( 2000 ):
+        name = "doc_%d" % random.randint( 0, 2999 )
+        V = g.OpenVertex( name )
+        r = random.random()
+        if r < 0.1 and 'title' in V:
+            del V['title']
+            del TEXT[ name ]
+        else:
+            TEXT[ name ] = " ".join( random.choice( WORDS ) for n in range( random.randint( 1, 12 ) ) )
+            V['title'] = TEXT[ name ]
+        g.CloseVertex( V )
+    V = g.OpenVertex( "doc_1" )
+    V.RemoveProperties()
+    g.CloseVertex( V )
+    TEXT.pop( "doc_1", None )
+    g.DeleteVertex( "doc_2" )
+    TEXT.pop( "doc_2", None )
+    V = g.NewVertex( "added", type="doc", properties={ 'title':"unique words here" } )
+    g.CloseVertex( V )
+    TEXT[ "added" ] = "unique words here"
+    check_all()
+    Expect( g.Vertices( condition={ 'text':('title', 'Unique') } ) == [ "added" ], "new vertex found" )
+
+    # Invalid conditions
+    for bad in [ ('title',), (1, 'fox'), ('title', 'fox', 'some'), "x", ('title', " ".join( ["w%d" % i for i in range(33)] )) ]:
+        try:
+            g.Vertices( condition={ 'text':bad } )
+            Expect( False, "invalid text condition %s should fail" % (bad,) )
+        except (QueryError, SearchError):
+            pass
+
+    # Text index for other key required
+    try:
+        g.Vertices( condition={ 'text':('body', 'fox') } )
+        Expect( False, "text condition without index for key should fail" )
+    except SearchError:
+        pass
+
+    # Truncate rebuilds, drop removes
+    for i in range( 20 ):
+        name = "other_%d" % i
+        TEXT[ name ] = "quick fox %d" % i
+        V = g.NewVertex( name, type="other", properties={ 'title':TEXT[name] } )
+        g.CloseVertex( V )
+    check( "quick fox" )
+    Expect( g.Truncate( "other" ) == 20, "truncated" )
+    for i in range( 20 ):
+        del TEXT[ "other_%d" % i ]
+    check( "quick fox" )
+    Expect( g.DropTextIndex( 'body' ) is False, "no index to drop for key" )
+    Expect( g.DropTextIndex( 'title' ) is True, "index dropped" )
+    Expect( g.DropTextIndex() is False, "no index to drop" )
+    try:
+        g.Vertices( condition={ 'text':('title', 'fox') } )
+        Expect( False, "text condition without index should fail" )
+    except SearchError:
+        pass
+
+    g.Erase()
+
+
+
+###############################################################################
+# TEST_text_bm25
+#
+###############################################################################
+def TEST_text_bm25():
+    """
+    pyvgx.Graph.CreateTextIndex() and bm25() ranking
+    t_nominal=2
+    test_level=3101
+    """
+    g = pyvgx.Graph( "text_bm25" )
+    g.Truncate()
+
+    random.seed( 1046 )
+    TEXT = {}
+    for i in range( 500 ):
+        TEXT[ "doc_%d" % i ] = " ".join( random.choice( WORDS ) for n in range( random.randint( 1, 20 ) ) )
+    for name, text in TEXT.items():
+        V = g.NewVertex( name, type="doc" )
+        V['title'] = text
+        g.CloseVertex( V )
+
+    # No index, no score
+    Expect( g.Evaluate( "bm25( 'title', 'fox' )", head="doc_0" ) == 0.0, "no index" )
+
+    g.CreateTextIndex( 'title' )
+
+    N = len( TEXT )
+    avgdl = sum( len( t.split() ) for t in TEXT.values() ) / N
+    def bm25( text, terms ):
+        words = text.split()
+        score = 0.0
+        for t in terms.split():
+            df = len( [ 1 for x in TEXT.values() if t in x.split() ] )
+            tf = words.count( t )
+            idf = log( 1 + (N - df + 0.5) / (df + 0.5) )
+            score += idf * tf * 2.2 / (tf + 1.2 * (0.25 + 0.75 * len(words) / avgdl))
+        return score
+
+    for terms in [ "fox", "quick fox", "lazy dog graph" ]:
+        result = g.Vertices( condition={ 'text':('title', terms, 'any') }, rank="bm25( 'title', '%s' )" % terms, sortby=S_RANK, fields=F_ID|F_RANK, result=R_LIST, hits=-1 )
+        Expect( len( result ) > 0, "hits for %s" % terms )
+        prev = None
+        for name, score in result:
+            Expect( abs( score - bm25( TEXT[name], terms ) ) < 1e-6, "bm25 %s %s: %f, expected %f" % (terms, name, score, bm25( TEXT[name], terms )) )
+            Expect( prev is None or score <= prev, "sorted by score" )
+            prev = score
+
+    # Non-string arguments score zero
+    Expect( g.Evaluate( "bm25( 'title', 1 )", head="doc_0" ) == 0.0, "non-string terms" )
+    Expect( g.Evaluate( "bm25( 'body', 'fox' )", head="doc_0" ) == 0.0, "no index for key" )
+
+    g.DropTextIndex()
+    g.Erase()
+
+
+
+###############################################################################
+# Run
+#
+###############################################################################
+def Run( name ):
+    """
+    """
+    RunTests( [__name__] )
@@ -650,6 +650,134 @@ def TEST_Vertices_all_name_lengths():
 
 
 
+###############################################################################
+# TEST_Vertices_pagerank
+#
+###############################################################################
+def TEST_Vertices_pagerank():
+    """
+    pyvgx.Graph.Vertices()
+    Personalized PageRank
+    t_nominal=5
+    test_level=3101
+    """
+    QuerySupport.AssertCleanStart()
+    graph_name = "vertices_pagerank"
+    g = pyvgx.Graph( graph_name )
+    g.Truncate()
+
+    # Reference power iteration
+    def reference( edges, N, seeds, alpha=0.15, weights={}, arcvalue=False ):
+        total = sum( seeds.values() )
+        P = dict( (k, v/total) for k,v in seeds.items() )
+        R = [0.0] * N
+        for it in range( 1000 ):
+            NR = [0.0] * N
+            for k,v in P.items():
+                NR[k] += alpha * v
+            for i in range( N ):
+                out = [(j, weights.get(rel,1.0) * (val if arcvalue else 1)) for j,rel,val in edges.get(i,[])]
+                out = [(j,w) for j,w in out if w > 0]
+                tw = sum( w for j,w in out )
+                if tw > 0:
+                    for j,w in out:
+                        NR[j] += (1-alpha) * R[i] * w / tw
+                else:
+                    for k,v in P.items():
+                        NR[k] += (1-alpha) * R[i] * v
+            R = NR
+        return R
+
+    N = 50
+    edges = {}
+    for i in range( N ):
+        g.CreateVertex( "pr_%d" % i, type="even" if i % 2 == 0 else "odd" )
+    for i in range( N ):
+        for k in range( 1 + i % 4 ):
+            j = (i * 7 + k * 13 + 1) % N
+            if j == i:
+                continue
+            rel = "a" if (i+k) % 2 else "b"
+            val = 1 + (i+j) % 5
+            if g.Connect( "pr_%d" % i, (rel, M_INT, val), "pr_%d" % j ) > 0:
+                edges.setdefault( i, [] ).append( (j, rel, val) )
+
+    def check( result, R ):
+        Expect( len(result) > 0,                                "non-empty result" )
+        prev = None
+        for name, score in result:
+            expected = R[ int(name.split("_")[1]) ]
+            Expect( abs( score - expected ) < 1e-6,             "%s score %f, expected %f" % (name, score, expected) )
+            if prev is not None:
+                Expect( score <= prev,                          "descending scores" )
+            prev = score
+
+    for READONLY in [False, True]:
+        if READONLY:
+            g.SetGraphReadonly( 60 )
+
+        # Single seed
+        result = g.Vertices( pagerank={'seeds':"pr_0", 'epsilon':1e-10}, fields=F_ID|F_RANK, result=R_LIST )
+        check( result, reference( edges, N, {0:1.0} ) )
+
+        # Weighted seeds, relationship weights, arc values, alpha
+        pr = { 'seeds':{"pr_1":1.0, "pr_6":3.0}, 'weights':{'a':2.0, 'b':0.5}, 'arcvalue':True, 'alpha':0.3, 'epsilon':1e-10 }
+        result = g.Vertices( pagerank=pr, fields=F_ID|F_RANK, result=R_LIST )
+        check( result, reference( edges, N, {1:1.0, 6:3.0}, alpha=0.3, weights={'a':2.0, 'b':0.5}, arcvalue=True ) )
+
+        # Zero weight excludes relationship
+        result = g.Vertices( pagerank={'seeds':"pr_0", 'weights':{'a':0.0}, 'epsilon':1e-10}, fields=F_ID|F_RANK, result=R_LIST )
+        check( result, reference( edges, N, {0:1.0}, weights={'a':0.0} ) )
+
+        # Vertex condition filters the scored vertices
+        result = g.Vertices( condition={'type':"odd"}, pagerank="pr_0", result=R_DICT, fields=F_ID|F_TYPE )
+        Expect( len(result) > 0,                                "odd vertices" )
+        for item in result:
+            Expect( item['type'] == "odd",                      "odd, got %s" % item['type'] )
+
+        # Hits
+        result = g.Vertices( pagerank="pr_0", hits=3 )
+        Expect( len(result) == 3,                               "3 hits, got %d" % len(result) )
+
+        # Bounded vertex set
+        result = g.Vertices( pagerank={'seeds':"pr_0", 'vertices':4} )
+        Expect( len(result) <= 4,                               "max 4 vertices, got %d" % len(result) )
+
+        # Custom rank uses pagerank score via context.rank
+        result = g.Vertices( pagerank="pr_0", rank="1 - context.rank", sortby=S_RANK|S_ASC, hits=1 )
+        Expect( result == g.Vertices( pagerank="pr_0", hits=1 ), "same top vertex" )
+
+        # Missing seeds are ignored
+        Expect( len( g.Vertices( pagerank="nonexistent" ) ) == 0, "no result" )
+
+        # Reusable query
+        q = g.NewVerticesQuery( pagerank="pr_0", fields=F_ID|F_RANK, result=R_LIST )
+        Expect( q.Execute() == q.Execute(),                     "repeatable" )
+
+        if READONLY:
+            g.ClearGraphReadonly()
+
+    # Invalid
+    for bad in [ [], {'seeds':"pr_0", 'x':1}, {'seeds':"pr_0", 'alpha':0}, {'seeds':"pr_0", 'epsilon':-1}, {'seeds':"pr_0", 'vertices':0}, {"pr_0":-1.0} ]:
+        try:
+            g.Vertices( pagerank=bad )
+            Expect( False,                                      "invalid pagerank %s" % bad )
+        except ValueError:
+            pass
+
+    try:
+        g.Arcs( pagerank="pr_0" )
+        Expect( False,                                          "pagerank not allowed for Arcs()" )
+    except pyvgx.QueryError:
+        pass
+
+    del q
+    g.Erase()
+
+
+
+
+
 ###############################################################################
 # Run
 #
@@ -49,6 +49,8 @@ from . import Initials
 from . import Terminals
 from . import Search
 from . import Geo
+from . import Text
+from . import CommonNeighbors
 from . import Cull
 
 
@@ -73,6 +75,8 @@ modules = [
   Terminals,
   Search,
   Geo,
+  Text,
+  CommonNeighbors,
   Cull
 ]
 
@@ -663,6 +663,59 @@ def TEST_R_DICT():
 
 
 
+###############################################################################
+# TEST_lazy_result
+#
+###############################################################################
+def TEST_lazy_result():
+    """
+    Test Neighborhood() and Vertices() with lazy=True
+    test_level=3101
+    """
+    if ROOT_ID not in graph:
+        TEST_SmallSetup()
+
+    for R_x in [R_STR, R_LIST, R_DICT, R_SIMPLE]:
+        for F_x in FIELDS + [F_ALL]:
+            for hits in [-1, 0, 5]:
+                eager = graph.Neighborhood( ROOT_ID, arc=("to", D_OUT, M_INT), sortby=S_VAL|S_ASC, result=R_x, fields=F_x, hits=hits )
+                lazy = graph.Neighborhood( ROOT_ID, arc=("to", D_OUT, M_INT), sortby=S_VAL|S_ASC, result=R_x, fields=F_x, hits=hits, lazy=True )
+                if F_x & (F_VEC|F_PROP|F_RAW):
+                    Expect( type(lazy) is list )
+                else:
+                    Expect( type(lazy) is SearchResult,     "SearchResult, got %s" % type(lazy) )
+                    Expect( lazy.List() == eager )
+                Expect( len(lazy) == len(eager) )
+                Expect( lazy == eager )
+                Expect( list(lazy) == eager )
+                if len(eager) > 0:
+                    Expect( lazy[0] == eager[0] )
+                    Expect( lazy[-1] == eager[-1] )
+
+    # Results that cannot be deferred are returned as usual
+    eager = graph.Neighborhood( ROOT_ID, arc=("to", D_OUT, M_INT), sortby=S_VAL|S_ASC, result=R_DICT|R_METAS, fields=F_AARC )
+    lazy = graph.Neighborhood( ROOT_ID, arc=("to", D_OUT, M_INT), sortby=S_VAL|S_ASC, result=R_DICT|R_METAS, fields=F_AARC, lazy=True )
+    Expect( type(lazy) is dict )
+    Expect( lazy['neighborhood'] == eager['neighborhood'] )
+
+    # Global
+    eager = graph.Vertices( result=R_STR, sortby=S_ID )
+    lazy = graph.Vertices( result=R_STR, sortby=S_ID, lazy=True )
+    Expect( type(lazy) is SearchResult )
+    Expect( lazy == eager )
+
+    # Not instantiable
+    try:
+        SearchResult()
+        Expect( False, "SearchResult() should fail" )
+    except TypeError:
+        pass
+
+    graph.DebugCheckAllocators()
+
+
+
+
 ###############################################################################
 # TEST_random_fields_and_modes
 #
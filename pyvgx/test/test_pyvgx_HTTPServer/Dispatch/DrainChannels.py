@@ -0,0 +1,142 @@
+﻿###############################################################################
+# 
+# VGX Server
+# Distributed engine for plugin-based graph and vector search
+# 
+# Module:  pyvgx.test
+# File:    DrainChannels.py
+# Author:  Stian Lysne slysne.dev@gmail.com
+# 
+# Copyright © 2025 Rakuten, Inc.
+# 
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#     http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# 
+###############################################################################
+
+from pyvgxtest.pyvgxtest import RunTests, Expect, TestFailed
+from .. import _http_support as Support
+from pyvgx import *
+import pyvgx
+from . import engines
+import time
+
+
+
+
+###############################################################################
+# get_status
+#
+###############################################################################
+def get_status( conn, url ):
+    """
+    """
+    conn.request( "GET", url, headers={'accept': 'application/json'} )
+    data = conn.getresponse()
+    data.read()
+    return data.status
+
+
+
+
+###############################################################################
+# wait_until_ok
+#
+###############################################################################
+def wait_until_ok( conn, url, timeout=30.0 ):
+    """
+    Retry request until all partitions are up
+    """
+    deadline = time.time() + timeout
+    while get_status( conn, url ) != 200:
+        Expect( time.time() < deadline,             "all partitions should be up" )
+        time.sleep( 0.5 )
+
+
+
+
+###############################################################################
+# TEST_DrainAbortedPartial
+#
+###############################################################################
+def TEST_DrainAbortedPartial():
+    """
+    Aborted partial request drains its channel and reuses the connection
+    test_level=4101
+    t_nominal=20
+    """
+
+    D_PORT = 9747
+    E_HOST = "127.0.0.1"
+    E_PORTS = [ 9610, 9620 ]
+    E_FAIL, E_SLOW = E_PORTS
+
+    # Set up backends
+    ENGINES = engines.StartServerEngines( E_HOST, E_PORTS, prefill=False )
+
+    try:
+        # Start local dispatcher with two partitions
+        disp_cf = engines.GetMatrixConfig( width=2, height=1, host=E_HOST, ports=E_PORTS )
+        system.StartHTTP( D_PORT, dispatcher=disp_cf )
+        local_host, local_port = Support.get_server_host_port()
+        conn = engines.GetNewConnection( local_host, local_port )
+
+        try:
+            # Connect both partitions
+            wait_until_ok( conn, "/vgx/plugin/sleep" )
+            connects_0, drained_0, closed_0 = engines.GetDispatcherMatrixCounters( local_host, local_port )
+            Expect( connects_0 == 2,                                        "one connection per partition, got {}".format( connects_0 ) )
+
+            # One engine answers 503 while the other is still executing
+            engines.EngineServiceIn( E_HOST, E_FAIL, False )
+            t0 = time.time()
+            Expect( get_status( conn, "/vgx/plugin/sleep?ms=2000" ) == 503, "503" )
+            Expect( time.time() - t0 < 1.5,                                 "abort should not wait for slow partition" )
+
+            # Slow partition response is drained in the background
+            deadline = time.time() + 8.0
+            drained = drained_0
+            while drained == drained_0 and time.time() < deadline:
+                time.sleep( 0.25 )
+                connects, drained, closed = engines.GetDispatcherMatrixCounters( local_host, local_port )
+            Expect( drained == drained_0 + 1,                               "drained {}, got {}".format( drained_0 + 1, drained ) )
+            Expect( closed == closed_0,                                     "drain-closed {}, got {}".format( closed_0, closed ) )
+            Expect( connects == connects_0,                                 "no new connections, got {}".format( connects - connects_0 ) )
+
+            # Bring failed engine back
+            engines.EngineServiceIn( E_HOST, E_FAIL, True )
+            wait_until_ok( conn, "/vgx/plugin/sleep" )
+
+            # Only the failed partition reconnects, the drained channel is reused
+            connects, drained, closed = engines.GetDispatcherMatrixCounters( local_host, local_port )
+            Expect( connects == connects_0 + 1,                             "one new connection, got {}".format( connects - connects_0 ) )
+            Expect( closed == closed_0,                                     "drain-closed {}, got {}".format( closed_0, closed ) )
+
+        finally:
+            conn.close()
+            # Local shutdown
+            system.StopHTTP()
+
+    finally:
+        engines.StopEngines( ENGINES )
+
+
+
+
+###############################################################################
+# Run
+#
+###############################################################################
+def Run( name ):
+    """
+    """
+    RunTests( [__name__] )
@@ -32,11 +32,13 @@ import pyvgx
 from . import SimpleProxy
 from . import TopDispatcher
 from . import FeedPartials
+from . import DrainChannels
 
 modules = [
     SimpleProxy,
     TopDispatcher,
-    FeedPartials
+    FeedPartials,
+    DrainChannels
 ]
 
 
@@ -87,6 +87,21 @@ def EngineShutdown( host, port ):
 
 
 
+###############################################################################
+# EngineServiceIn
+#
+###############################################################################
+def EngineServiceIn( host, port, service_in ):
+    """
+    Send service in or service out request
+    """
+    token = get_authtoken( host, port )
+    action = "ADMIN_ServiceIn" if service_in else "ADMIN_ServiceOut"
+    Support.send_request( "vgx/builtin/{}?authtoken={}".format( action, token ), json=True, admin=True, address=(host,port) )
+
+
+
+
 ###############################################################################
 # WaitUntilEngineReady
 #
@@ -208,6 +223,17 @@ def ServerSearchPlugin( request:PluginRequest, graph, init:int, hits:int, synloa
 
 
 
+def ServerSleepPlugin( request:PluginRequest, graph, ms:int=0 ) -> PluginResponse:
+    """
+    Backend server engine plugin responding after ms milliseconds
+    """
+    time.sleep( ms / 1000.0 )
+    response = PluginResponse()
+    response.hitcount = 1
+    return response
+
+
+
 def DispatchSearchPre( request:PluginRequest ) -> PluginRequest:
     """
     Dispatcher search pre-processor
@@ -247,6 +273,7 @@ def ServerEntrypoint( port, prefill ):
     # Add engine plugins
     system.AddPlugin( plugin=ServerFeedPlugin, name="feed", graph=g )
     system.AddPlugin( plugin=ServerSearchPlugin, name="search", graph=g )
+    system.AddPlugin( plugin=ServerSleepPlugin, name="sleep", graph=g )
 
     # Start server
     system.StartHTTP( port )
@@ -303,6 +330,22 @@ def GetDispatcherMatrixDimensions( host, port ):
 
 
 
+###############################################################################
+# GetDispatcherMatrixCounters
+#
+###############################################################################
+def GetDispatcherMatrixCounters( host, port ):
+    """
+    Returns: (connects, drained, drain-closed)
+    """
+    bytes, headers = Support.send_request( "vgx/dispatch", json=True, address=(host,port) )
+    R = json.loads( bytes )
+    m = R['response']['A']['matrix']
+    return m['connects'], m['drained'], m['drain-closed']
+
+
+
+
 ###############################################################################
 # GetMatrixConfig
 #
@@ -715,11 +715,48 @@ def TEST_endpoint__vgx_dispatch():
                 "30": [1, 12.3],
                 "31": [1, 12.3]
             },
+            "executor-queue": {
+                "0": [0, 1, 1],
+                "1": [0, 1, 1],
+                "2": [0, 1, 1],
+                "3": [0, 1, 1],
+                "4": [0, 1, 1],
+                "5": [0, 1, 1],
+                "6": [0, 1, 1],
+                "7": [0, 1, 1],
+                "8": [0, 1, 1],
+                "9": [0, 1, 1],
+                "10": [0, 1, 1],
+                "11": [0, 1, 1],
+                "12": [0, 1, 1],
+                "13": [0, 1, 1],
+                "14": [0, 1, 1],
+                "15": [0, 1, 1],
+                "16": [0, 1, 1],
+                "17": [0, 1, 1],
+                "18": [0, 1, 1],
+                "19": [0, 1, 1],
+                "20": [0, 1, 1],
+                "21": [0, 1, 1],
+                "22": [0, 1, 1],
+                "23": [0, 1, 1],
+                "24": [0, 1, 1],
+                "25": [0, 1, 1],
+                "26": [0, 1, 1],
+                "27": [0, 1, 1],
+                "28": [0, 1, 1],
+                "29": [0, 1, 1],
+                "30": [0, 1, 1],
+                "31": [0, 1, 1]
+            },
             "?matrix": {
                 "width": 2,
                 "height": 2,
                 "active-channels": 19,
                 "total-channels": 96,
+                "connects": 24,
+                "drained": 3,
+                "drain-closed": 0,
                 "allow-incomplete": false,
                 "proxy": false,
                 "partitions": [
@@ -752,6 +789,16 @@ def TEST_endpoint__vgx_dispatch():
                 "5": [1, 12.3],
                 "6": [1, 12.3],
                 "7": [1, 12.3]
+            },
+            "executor-queue": {
+                "0": [0, 1, 1],
+                "1": [0, 1, 1],
+                "2": [0, 1, 1],
+                "3": [0, 1, 1],
+                "4": [0, 1, 1],
+                "5": [0, 1, 1],
+                "6": [0, 1, 1],
+                "7": [0, 1, 1]
             }
         }
     }
@@ -30,6 +30,7 @@ import pyvgx
 import urllib.request
 import re
 import json
+import time
 
 graph = None
 
@@ -188,6 +189,101 @@ def TEST_custom_plugin():
 
 
 
+###############################################################################
+# plugin_sleep
+#
+###############################################################################
+def plugin_sleep( request, ms:int=0 ):
+    """
+    Sleep for ms milliseconds
+    """
+    time.sleep( ms / 1000.0 )
+    return ms
+
+
+
+
+###############################################################################
+# count_rejected
+#
+###############################################################################
+def count_rejected( headers ):
+    """
+    """
+    host, port = Support.get_server_host_port()
+    rejected = 0
+    for n in range( 20 ):
+        # Observed service time 50ms (high priority is always admitted)
+        W = urllib.request.Request( "http://%s:%d/vgx/plugin/plugin_sleep?ms=50" % (host, port) )
+        W.add_header( 'X-Vgx-Priority', 'high' )
+        urllib.request.urlopen( W ).read()
+        R = urllib.request.Request( "http://%s:%d/vgx/plugin/plugin_sleep?ms=50" % (host, port) )
+        for k,v in headers.items():
+            R.add_header( k, v )
+        try:
+            urllib.request.urlopen( R ).read()
+        except urllib.error.HTTPError as http_err:
+            Expect( http_err.status == 503,             "status should be 503, got %s" % http_err.status )
+            rejected += 1
+    return rejected
+
+
+
+
+###############################################################################
+# TEST_plugin_admission
+#
+###############################################################################
+def TEST_plugin_admission():
+    """
+    test_level=4101
+    t_nominal=1
+    """
+
+    # Invalid priority
+    try:
+        system.AddPlugin( plugin_sleep, priority='urgent' )
+        Expect( False,                                  "Should not be able to add plugin with invalid priority" )
+    except ValueError:
+        pass
+
+    # Invalid deadline
+    try:
+        system.AddPlugin( plugin_sleep, deadline=-1 )
+        Expect( False,                                  "Should not be able to add plugin with negative deadline" )
+    except ValueError:
+        pass
+
+    system.AddPlugin( plugin_sleep )
+
+    # Invalid priority header
+    Support.send_request( "vgx/plugin/plugin_sleep", headers={'X-Vgx-Priority':'urgent'}, expect_status=400 )
+
+    # Priorities and generous deadline are accepted
+    for priority in ['low', 'normal', 'high']:
+        bytes, headers = Support.send_request( "vgx/plugin/plugin_sleep", headers={'X-Vgx-Priority':priority, 'X-Vgx-Deadline':'10000'}, json=True )
+        Expect( json.loads( bytes ).get('status') == 'OK', "status should be 'OK'" )
+
+    # Deadline shorter than observed service time is rejected up front
+    rejected = count_rejected( {'X-Vgx-Deadline':'10'} )
+    Expect( rejected > 0,                               "requests with deadline shorter than service time should be rejected" )
+
+    # Plugin default deadline applies when request has no deadline header
+    system.AddPlugin( plugin_sleep, deadline=10 )
+    default_rejected = count_rejected( {} )
+    Expect( default_rejected > 0,                       "requests exceeding plugin default deadline should be rejected" )
+
+    # Rejections are counted
+    dispatch = json.loads( Support.send_request( "vgx/dispatch", json=True )[0] )['response']['A']['dispatch']
+    n_rejected = dispatch['rejected']
+    Expect( n_rejected >= rejected + default_rejected,  "rejected counter should be at least %d, got %d" % (rejected + default_rejected, n_rejected) )
+
+    system.RemovePlugin( 'plugin_sleep' )
+
+
+
+
+
 ###############################################################################
 # Run
 #
@@ -0,0 +1,322 @@
+﻿###############################################################################
+# 
+# VGX Server
+# Distributed engine for plugin-based graph and vector search
+# 
+# Module:  pyvgx.test
+# File:    JsonContent.py
+# Author:  Stian Lysne slysne.dev@gmail.com
+# 
+# Copyright © 2025 Rakuten, Inc.
+# 
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#     http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# 
+###############################################################################
+
+from pyvgxtest.pyvgxtest import RunTests, Expect, TestFailed
+from .. import _http_support as Support
+from pyvgx import *
+import pyvgx
+import http.client
+import urllib.parse
+import json
+
+graph = None
+
+# Nesting depth handled by the native parser before falling back to json.loads()
+NATIVE_MAX_DEPTH = 512
+
+
+
+
+###############################################################################
+# json_content
+#
+###############################################################################
+def json_content( request, content:json ):
+    """
+    Return type and repr of request content decoded as JSON
+    """
+    return { 'type':type( content ).__name__, 'repr':repr( content ) }
+
+
+
+
+###############################################################################
+# json_param
+#
+###############################################################################
+def json_param( request, x:json ):
+    """
+    Return type and repr of query parameter decoded as JSON
+    """
+    return { 'type':type( x ).__name__, 'repr':repr( x ) }
+
+
+
+
+###############################################################################
+# expected
+#
+###############################################################################
+def expected( body ):
+    """
+    Outcome of json.loads() applied to body decoded as UTF-8
+    """
+    try:
+        obj = json.loads( body.decode() )
+        return { 'type':type( obj ).__name__, 'repr':repr( obj ) }
+    except Exception as err:
+        return ( str( type( err ) ), str( err ) )
+
+
+
+
+###############################################################################
+# post_json
+#
+###############################################################################
+def post_json( body ):
+    """
+    Outcome of native JSON decoding of body as plugin request content
+    """
+    host, port = Support.get_server_host_port()
+    conn = http.client.HTTPConnection( host, port )
+    try:
+        conn.request( "POST", "/vgx/plugin/json_content", body=body, headers={'Content-Type':'application/json', 'Accept':'application/json'} )
+        data = conn.getresponse()
+        R = json.loads( data.read() )
+    finally:
+        conn.close()
+    if data.status == 200:
+        return R['response']
+    system = R['message']['system']
+    return ( system['exception'], system['value'] )
+
+
+
+
+###############################################################################
+# check
+#
+###############################################################################
+def check( *bodies ):
+    """
+    """
+    for body in bodies:
+        if type( body ) is str:
+            body = body.encode()
+        exp = expected( body )
+        got = post_json( body )
+        Expect( got == exp,                         "%.80r: expected %.200s, got %.200s" % (body, exp, got) )
+
+
+
+
+###############################################################################
+# TEST_json_content_strings
+#
+###############################################################################
+def TEST_json_content_strings():
+    """
+    Native JSON decoding of strings
+    test_level=4101
+    t_nominal=1
+    """
+    system.AddPlugin( json_content )
+
+    # Plain ASCII of lengths around the eight byte scan width
+    check( *['"%s"' % ("abcdefghijklmnopqrstuvwxyz"[:n]) for n in range( 0, 27 )] )
+    check( '"' + "x" * 100000 + '"' )
+
+    # Escapes at every offset within a word
+    for n in range( 0, 9 ):
+        check( '"' + "a" * n + '\\n\\t\\r\\b\\f\\/\\\\\\"' + "b" * n + '"' )
+    check( r'"\u0000\u001fA\u00e9\u20ac\uffff"' )
+
+    # Paired surrogate escapes
+    check( r'"\ud83d\ude00"', r'"abc\ud83d\ude00def"', r'"\udbff\udfff"', r'"\ud800\udc00"' )
+
+    # Lone and misordered surrogate escapes
+    check( r'"\ud800"', r'"\udc00"', r'"x\ud83dy"', r'"\ude00\ud83d"', r'"\ud800\ud800"', r'"\ud800A"', r'"\ud800\n"' )
+
+    # Truncated and invalid escapes
+    check( r'"\ud83d\ude0"', r'"\ud83d\u"', r'"\u12"', r'"\u12g4"', r'"\x41"', r'"\'"', '"abc\\', '"abc' )
+
+    # Raw UTF-8
+    check( '"æøå €   😀"', "[\"" + "ÿ" * 33 + "\"]" )
+
+    # Raw UTF-8 encoded surrogates and invalid UTF-8
+    check( b'"\xed\xa0\x80"', b'"\xed\xa0\xbd\xed\xb8\x80"', b'"abcdefgh\xed\xbf\xbf"' )
+    check( b'"\xff"', b'"\xc3"', b'"\xe2\x82"', b'"\xf0\x9f\x98"', b'"\xc0\xaf"', b'"\x80abc"' )
+
+    # Raw control characters are rejected
+    check( b'"a\x01b"', b'"abcdefgh\x1f"', b'"tab\there"', b'"line\nfeed"' )
+
+    # Strings as keys
+    check( r'{"\ud83d\ude00": 1, "\u00e6": 2, "\u0000": 3, "plain": 4}' )
+
+    system.RemovePlugin( 'json_content' )
+
+
+
+
+###############################################################################
+# TEST_json_content_numbers
+#
+###############################################################################
+def TEST_json_content_numbers():
+    """
+    Native JSON decoding of numbers
+    test_level=4101
+    t_nominal=1
+    """
+    system.AddPlugin( json_content )
+
+    # Non-finite values
+    check( 'NaN', 'Infinity', '-Infinity', '[NaN, Infinity, -Infinity]', '{"a": NaN, "b": -Infinity}' )
+    check( 'nan', 'inf', '-Inf', 'Infinit', '-Infinityx', '+Infinity', 'NaNa' )
+
+    # Integers around and beyond 64 bits
+    for x in [ 0, 1, -1, 2**53, 2**63-1, 2**63, 2**64-1, 2**64, -2**63, -2**63-1, -2**64, 10**18, 10**19, 10**40, -10**40, 7**200 ]:
+        check( str( x ), "[%d]" % x, '{"x": %d}' % x )
+    check( '-0', '00', '01', '-01', '-', '+1', '1_000' )
+
+    # Floats with short and long mantissas
+    check( '0.0', '-0.0', '0.1', '0.5', '1.5', '-2.25', '3.141592653589793', '2.718281828459045' )
+    check( '123456789012345.6', '1234567890123456.7', '0.123456789012345', '0.1234567890123456', '0.12345678901234567' )
+    check( '1.00000000000000000000001', '9007199254740993.0', '123456789012345678901234567890.5', '0.30000000000000004' )
+
+    # Exponents
+    check( '1e0', '1E+10', '1e-7', '1.5e-7', '-2.5E-3', '1e22', '1e23', '1e-22', '1e-23', '4.35e15' )
+    check( '1e308', '1.7976931348623157e308', '1e309', '-1e309', '2.2250738585072014e-308', '5e-324', '1e-400', '-1e-400' )
+    check( '123456789012345e-20', '123456789012345e20', '1234567890123456e-3', '0e999', '1e-0', '1e+0' )
+
+    # Malformed numbers
+    check( '1.', '.5', '1e', '1e+', '1.e5', '-.5', '1.5.5', '0x10', '1ee5', '- 1' )
+
+    system.RemovePlugin( 'json_content' )
+
+
+
+
+###############################################################################
+# TEST_json_content_containers
+#
+###############################################################################
+def TEST_json_content_containers():
+    """
+    Native JSON decoding of arrays and objects
+    test_level=4101
+    t_nominal=1
+    """
+    system.AddPlugin( json_content )
+
+    # Literals
+    check( 'null', 'true', 'false', '[null, true, false]', ' \t\r\n true \t\r\n ' )
+
+    # Duplicate keys, last value wins in the position of the first
+    check( '{"a": 1, "a": 2}', '{"a": 1, "b": 2, "a": 3}', '{"a": {"x": 1}, "a": [2]}', '{"a": 1, "a": 2, "a": 3, "b": {"c": 1, "c": 2}}' )
+
+    # Homogeneous numeric arrays
+    check( '[]', '[ ]', '[1]', '[1.5]', '[ 1 , 2 , 3 ]', '[\n1,\n2\n]' )
+    check( json.dumps( list( range( 10000 ) ) ) )
+    check( json.dumps( [ x/7 for x in range( 10000 ) ] ) )
+    check( json.dumps( [ -x*1e-300 for x in range( 1000 ) ] ) )
+    check( json.dumps( [ 2**70 + x for x in range( 1000 ) ] ) )
+    check( '[1, 2.5, 3, 4.75, -5, 6e3]', '[1, 2, NaN, 3, Infinity]', '[1, 2, -Infinity]' )
+
+    # Numeric arrays interrupted by other values
+    check( '[1, 2, "3"]', '[1, 2, [3]]', '[1, 2, {"x": 3}]', '[1, 2, null, 3]', '[1, true]', '[[1, 2], [3.5, 4.5], []]' )
+
+    # Malformed arrays
+    check( '[1, 2,]', '[1 2]', '[1,,2]', '[,1]', '[1, 2', '[1, 2.', '[1, -', '[', ']', '[1, 2]]' )
+
+    # Objects
+    check( '{}', '{ }', '{"a": 1}', '{"a": [1, 2], "b": {"c": null}}', '{ "a" : 1 , "b" : 2 }' )
+
+    # Malformed objects
+    check( '{"a": 1,}', '{"a" 1}', '{"a":}', '{a: 1}', "{'a': 1}", '{1: 2}', '{"a": 1', '{"a"', '{', '}' )
+
+    # Other malformed or truncated input
+    check( ' ', 'tru', 'nul', 'f', 'True', 'None', '[1] x', '1 2', '"a" "b"', '{"a": 1}}', "'a'", '/* */ 1' )
+
+    system.RemovePlugin( 'json_content' )
+
+
+
+
+###############################################################################
+# TEST_json_content_nesting
+#
+###############################################################################
+def TEST_json_content_nesting():
+    """
+    Native JSON decoding of deeply nested input
+    test_level=4101
+    t_nominal=1
+    """
+    system.AddPlugin( json_content )
+
+    for depth in [ 1, 64, NATIVE_MAX_DEPTH-1, NATIVE_MAX_DEPTH, NATIVE_MAX_DEPTH+1, 2*NATIVE_MAX_DEPTH, 100000 ]:
+        check( "[" * depth + "]" * depth )
+        check( '{"a": ' * depth + "1" + "}" * depth )
+        check( "[" * depth + "1, 2.5" + "]" * depth )
+        # Truncated deep nesting
+        check( "[" * depth + "]" * (depth-1) )
+
+    system.RemovePlugin( 'json_content' )
+
+
+
+
+###############################################################################
+# TEST_json_param
+#
+###############################################################################
+def TEST_json_param():
+    """
+    Native JSON decoding of query parameters
+    test_level=4101
+    t_nominal=1
+    """
+    system.AddPlugin( json_param )
+
+    for value in [ '[1, 2.5, "x"]', '{"a": 1, "a": 2}', r'"\ud83d\ude00"', r'"\ud800"', '"æøå"', '[NaN, -Infinity]', str( 2**100 ), '1.2345678901234567e-300' ]:
+        path = "vgx/plugin/json_param?x=%s" % urllib.parse.quote( value )
+        bytes, headers = Support.send_request( path, json=True )
+        got = json.loads( bytes )['response']
+        exp = expected( value.encode() )
+        Expect( got == exp,                         "%r: expected %s, got %s" % (value, exp, got) )
+
+    # Invalid JSON is rejected
+    Support.send_request( "vgx/plugin/json_param?x=%s" % urllib.parse.quote( '[1,' ), expect_status=400 )
+
+    system.RemovePlugin( 'json_param' )
+
+
+
+
+
+###############################################################################
+# Run
+#
+###############################################################################
+def Run( name ):
+    """
+    """
+    global graph
+    graph = pyvgx.Graph( name )
+    RunTests( [__name__] )
+    graph.Close()
+    del graph
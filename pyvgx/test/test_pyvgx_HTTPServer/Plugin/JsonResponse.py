@@ -30,9 +30,29 @@ import pyvgx
 import urllib.request
 import re
 import json
+import struct
 
 graph = None
 
+# Float bit patterns with non-trivial shortest repr: powers of two,
+# subnormals, extremes and exponent notation boundaries
+FLOAT_BITS = [
+    "4580000000000000",
+    "2d70000000000000",
+    "0000000000000001",
+    "000fffffffffffff",
+    "0010000000000000",
+    "7fefffffffffffff",
+    "3fb999999999999a",
+    "4340000000000000",
+    "3ee4f8b588e368f1",
+    "3f1a36e2eb1c432d",
+    "8000000000000000",
+    "c3e0000000000000"
+]
+
+FLOAT_VALUES = [ struct.unpack( ">d", bytes.fromhex( bits ) )[0] for bits in FLOAT_BITS ]
+
 
 
 
@@ -68,6 +88,71 @@ def TEST_json_format():
 
 
 
+###############################################################################
+# json_float_values
+#
+###############################################################################
+def json_float_values( request ):
+    """
+    Float values
+    """
+    return FLOAT_VALUES
+
+
+
+
+###############################################################################
+# json_float_neighbors
+#
+###############################################################################
+def json_float_neighbors( request, lazy:int=1 ):
+    """
+    Neighborhood with float arc values and rank scores
+    """
+    return graph.Neighborhood( "float_root", fields=F_AARC|F_RANK, result=R_DICT, rank="next.arc.value / 7", lazy=lazy > 0 )
+
+
+
+
+###############################################################################
+# TEST_json_float_repr
+#
+###############################################################################
+def TEST_json_float_repr():
+    """
+    Native JSON float rendering matches json.dumps()
+    test_level=4101
+    t_nominal=1
+    """
+    system.AddPlugin( json_float_values )
+    bytes, headers = Support.send_request( "vgx/plugin/json_float_values", json=True )
+    Support.assert_headers( headers, bytes, "application/json" )
+    expected = json.dumps( FLOAT_VALUES ).encode()
+    Expect( expected in bytes,              "float reprs should match json.dumps(), expected %s in %s" % (expected, bytes) )
+    Expect( json.loads( bytes )['response'] == FLOAT_VALUES )
+
+    # Native search result, with and without the GIL held. Arc values
+    # are single precision powers of two (down to subnormal) and fractions.
+    graph.Truncate()
+    for n in range( 100 ):
+        graph.Connect( "float_root", ("to", M_FLT, 2.0 ** -(n+50) if n % 2 else (n+1) / 3.0), "float_%d" % n )
+    system.AddPlugin( json_float_neighbors )
+    expected = json.dumps( { 'response': json_float_neighbors( None, lazy=0 ) } )[1:-1].encode()
+    try:
+        for nogil in [False, True]:
+            pyvgx.RenderWithoutGIL( nogil )
+            bytes, headers = Support.send_request( "vgx/plugin/json_float_neighbors", json=True )
+            Support.assert_headers( headers, bytes, "application/json" )
+            Expect( expected in bytes,      "search result reprs should match json.dumps() (nogil=%s)" % nogil )
+    finally:
+        pyvgx.RenderWithoutGIL( False )
+        system.RemovePlugin( "json_float_values" )
+        system.RemovePlugin( "json_float_neighbors" )
+        graph.Truncate()
+
+
+
+
 ###############################################################################
 # Run
 #
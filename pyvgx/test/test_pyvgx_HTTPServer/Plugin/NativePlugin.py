@@ -0,0 +1,245 @@
+﻿###############################################################################
+# 
+# VGX Server
+# Distributed engine for plugin-based graph and vector search
+# 
+# Module:  pyvgx.test
+# File:    NativePlugin.py
+# Author:  Stian Lysne slysne.dev@gmail.com
+# 
+# Copyright © 2025 Rakuten, Inc.
+# 
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#     http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# 
+###############################################################################
+
+from pyvgxtest.pyvgxtest import RunTests, Expect, TestFailed
+from .. import _http_support as Support
+from pyvgx import *
+import pyvgx
+import os
+import platform
+import shlex
+import shutil
+import subprocess
+import sysconfig
+import tempfile
+import json
+
+graph = None
+
+
+
+
+NATIVE_PLUGIN_SOURCE = r"""
+#include "_vgx.h"
+#include <stdio.h>
+
+static int plugin_a( vgx_Graph_t *graph, vgx_URIQueryParameters_t *params, vgx_VGXServerRequest_t *request, vgx_VGXServerResponse_t *response, CString_t **CSTR__error ) {
+  char buf[128];
+  int n = snprintf( buf, sizeof( buf ), "{\"nparams\": %d, \"graph\": %s}", params ? params->sz : 0, graph ? "true" : "false" );
+  iStreamBuffer.Write( response->buffers.content, buf, n );
+  return 0;
+}
+
+static int plugin_b( vgx_Graph_t *graph, vgx_URIQueryParameters_t *params, vgx_VGXServerRequest_t *request, vgx_VGXServerResponse_t *response, CString_t **CSTR__error ) {
+  response->info.http_errcode = HTTP_STATUS__BadRequest;
+  *CSTR__error = CStringNew( "plugin_b always fails" );
+  return -1;
+}
+
+static const vgx_NativePlugin_t defs[] = {
+  { PLUGIN_A, "Native plugin A", plugin_a },
+  { PLUGIN_B, "Native plugin B", plugin_b },
+  { NULL, NULL, NULL }
+};
+
+const vgx_NativePlugin_t * vgx_native_plugin_init( int abi_version ) {
+  return abi_version == VGX_NATIVE_PLUGIN_ABI_VERSION ? defs : NULL;
+}
+"""
+
+
+
+
+###############################################################################
+# build_native_library
+#
+###############################################################################
+def build_native_library( name, plugin_a, plugin_b ):
+    """
+    Compile NATIVE_PLUGIN_SOURCE into a shared library defining plugins
+    plugin_a and plugin_b. Returns the library path, or None if the library
+    cannot be built in this environment (requires the source tree and a
+    C compiler.)
+    """
+    root = os.path.abspath( os.path.join( os.path.dirname( __file__ ), "..", "..", "..", ".." ) )
+    includes = [ os.path.join( root, "vgx", "src", "include" ), os.path.join( root, "cxlib", "src", "include" ) ]
+    if os.name != "posix" or not all( os.path.isdir( d ) for d in includes ):
+        return None
+
+    # Plugin library resolves VGX symbols from the loaded libvgx
+    libvgx = None
+    try:
+        with open( "/proc/self/maps" ) as maps:
+            for line in maps:
+                path = line.split()[-1]
+                if os.path.basename( path ).startswith( "libvgx" ):
+                    libvgx = path
+                    break
+    except OSError:
+        pass
+    if libvgx is None:
+        return None
+
+    cc = shlex.split( sysconfig.get_config_var( "CC" ) or "cc" )
+    tmpdir = tempfile.mkdtemp( prefix="pyvgx_native_" )
+    source = os.path.join( tmpdir, "%s.c" % name )
+    library = os.path.join( tmpdir, "%s.so" % name )
+    with open( source, "w" ) as f:
+        f.write( NATIVE_PLUGIN_SOURCE )
+    cmd = cc + [ "-shared", "-fPIC", "-std=gnu99", "-w" ]
+    if platform.machine() in ( "x86_64", "AMD64" ):
+        cmd += [ "-mavx2", "-mfma" ]
+    cmd += [ "-I%s" % d for d in includes ]
+    cmd += [ '-DPLUGIN_A="%s"' % plugin_a, '-DPLUGIN_B="%s"' % plugin_b ]
+    cmd += [ source, "-o", library, libvgx, "-Wl,-rpath,%s" % os.path.dirname( libvgx ) ]
+    try:
+        subprocess.run( cmd, check=True, capture_output=True )
+    except (OSError, subprocess.CalledProcessError):
+        return None
+    return library
+
+
+
+
+###############################################################################
+# python_plugin
+#
+###############################################################################
+def python_plugin( request ):
+    """
+    Python plugin with the same name as a native plugin
+    """
+    return 0
+
+
+
+
+###############################################################################
+# TEST_native_plugin
+#
+###############################################################################
+def TEST_native_plugin():
+    """
+    pyvgx.system.AddNativePlugin()
+    test_level=4101
+    t_nominal=1
+    """
+    library = build_native_library( "native_plugin", "native_a", "native_b" )
+    if library is None:
+        print( "native plugin library cannot be built in this environment" )
+        return
+    dup_library = None
+
+    # Missing library
+    try:
+        system.AddNativePlugin( library + ".missing" )
+        Expect( False,                                  "Should not be able to load missing library" )
+    except Exception as err:
+        Expect( "cannot load native plugin" in str( err ), "unexpected error: %s" % err )
+
+    # ---------------
+    # Add plugins
+    # ---------------
+    names = system.AddNativePlugin( library )
+    Expect( sorted( names ) == ["native_a", "native_b"], "should register native_a and native_b, got %s" % names )
+
+    # Listed as plugins
+    plugins = system.GetPlugins()
+    paths = [ P.get( 'path' ) for P in plugins ]
+    for name in names:
+        Expect( "/vgx/plugin/%s" % name in paths,       "%s should be listed" % name )
+
+    # --
+    # OK
+    # --
+    bytes, headers = Support.send_request( "vgx/plugin/native_a?x=1&y=2", json=True )
+    R = json.loads( bytes )
+    status = R.get( 'status' )
+    Expect( status == 'OK',                             "status should be 'OK', got '%s'" % status )
+    value = R.get( 'response' )
+    Expect( value == {'nparams':2, 'graph':False},      "unexpected response %s" % value )
+
+    # --
+    # ERROR
+    # --
+    Support.send_request( "vgx/plugin/native_b", expect_status=400 )
+
+    # ---------------
+    # Duplicate names
+    # ---------------
+
+    # Python plugin cannot use name of native plugin
+    python_plugin.__name__ = "native_a"
+    try:
+        system.AddPlugin( python_plugin )
+        Expect( False,                                  "Should not be able to add python plugin with native plugin name" )
+    except ValueError as err:
+        Expect( "already used by native plugin" in str( err ), "unexpected error: %s" % err )
+
+    # Native plugin cannot use name of python plugin, and no plugins
+    # from the failed library are registered
+    python_plugin.__name__ = "native_python"
+    system.AddPlugin( python_plugin )
+    try:
+        dup_library = build_native_library( "native_plugin_dup", "native_c", "native_python" )
+        Expect( dup_library is not None,                "failed to build library" )
+        try:
+            system.AddNativePlugin( dup_library )
+            Expect( False,                              "Should not be able to load native plugin with python plugin name" )
+        except Exception as err:
+            Expect( "already in use" in str( err ),     "unexpected error: %s" % err )
+        Support.send_request( "vgx/plugin/native_c", expect_status=404 )
+        bytes, headers = Support.send_request( "vgx/plugin/native_python", json=True )
+        Expect( json.loads( bytes ).get( 'response' ) == 0, "python plugin should be unaffected" )
+    finally:
+        system.RemovePlugin( "native_python" )
+
+    # -----------------
+    # Remove the plugins
+    # -----------------
+    for name in names:
+        system.RemovePlugin( name )
+        Support.send_request( "vgx/plugin/%s" % name, expect_status=404 )
+
+    # Libraries stay loaded, only the files are removed
+    for lib in [library, dup_library]:
+        if lib:
+            shutil.rmtree( os.path.dirname( lib ), ignore_errors=True )
+
+
+
+
+###############################################################################
+# Run
+#
+###############################################################################
+def Run( name ):
+    """
+    """
+    global graph
+    graph = pyvgx.Graph( name )
+    RunTests( [__name__] )
+    graph.Close()
+    del graph
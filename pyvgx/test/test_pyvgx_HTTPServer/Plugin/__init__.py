@@ -33,6 +33,8 @@ from . import JsonResponse
 from . import BuiltinPlugin
 from . import BuiltinADMIN
 from . import CustomPlugin
+from . import NativePlugin
+from . import JsonContent
 
 PORT = 9747
 
@@ -40,7 +42,9 @@ modules = [
     JsonResponse,
     BuiltinPlugin,
     BuiltinADMIN,
-    CustomPlugin
+    CustomPlugin,
+    NativePlugin,
+    JsonContent
 ]
 
 
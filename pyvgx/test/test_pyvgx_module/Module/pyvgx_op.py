@@ -1077,6 +1077,150 @@ def TEST_pyvgx_op_Produce_random():
 
 
 
+###############################################################################
+# snapshot_subscriber
+#
+###############################################################################
+def snapshot_subscriber( sysroot, tx_port, provider_port, name, inq, outq ):
+    """
+    Subscriber process for TEST_pyvgx_op_Subscribe_snapshot
+    """
+    system.Initialize( sysroot, euclidean=False )
+    try:
+        op.Bind( tx_port )
+        op.Subscribe( ("127.0.0.1", provider_port), timeout=30000, snapshot=True )
+        outq.put( "subscribed" )
+
+        # Wait for graph restored and operations following the snapshot applied
+        expected = inq.get()
+        deadline = time.time() + 120
+        while name not in system.Registry() and time.time() < deadline:
+            time.sleep( 0.1 )
+        g = Graph( name )
+        deadline = time.time() + 120
+        while True:
+            missing = [ id for id, x in expected.items() if id not in g or g[id]['x'] != x ]
+            if not missing and g.order == len(expected) or time.time() > deadline:
+                break
+            time.sleep( 0.5 )
+        outq.put( (g.order, len(missing), g.IsGraphReadonly()) )
+        g.Close()
+        inq.get()
+    finally:
+        system.Unload()
+
+
+
+
+###############################################################################
+# TEST_pyvgx_op_Subscribe_snapshot
+#
+###############################################################################
+def TEST_pyvgx_op_Subscribe_snapshot():
+    """
+    pyvgx.op.Subscribe( snapshot=True ) while provider graph is written
+    t_nominal=30
+    test_level=1102
+    """
+    import multiprocessing
+    import threading
+
+    PROVIDER_PORT = 9740
+    SUBSCRIBER_TX_PORT = 9750
+    name = "snapshot_sync"
+
+    g = Graph( name )
+    g.Truncate()
+
+    N = 2000
+    for n in range( N ):
+        V = g.NewVertex( "node_%d" % n )
+        V['x'] = n
+        g.CloseVertex( V )
+        g.Connect( "node_%d" % n, ("to",M_INT,n), "node_%d" % ((n+1) % N) )
+
+    # Writers modify the graph right up to the point where the snapshot sync
+    # makes it readonly, then stop. Attaching and detaching subscribers requires
+    # no writable vertices, so writers are held back until the subscriber is
+    # attached and do not resume after the snapshot.
+    running = threading.Event()
+    stop = threading.Event()
+    written = [0] * 4
+    def writer( w ):
+        n = 0
+        while not stop.is_set():
+            if not running.wait( 0.1 ):
+                continue
+            try:
+                V = g.NewVertex( "writer_%d_%d" % (w,n), timeout=0 )
+                V['x'] = n
+                g.CloseVertex( V )
+                n += 1
+                written[w] = n
+                U = g.OpenVertex( "node_%d" % random.randint( 0, N-1 ), timeout=0 )
+                U['x'] += 1
+                g.CloseVertex( U )
+            except (AccessError, VertexError):
+                # Graph is readonly while the snapshot is taken
+                if g.IsGraphReadonly():
+                    return
+
+    try:
+        multiprocessing.set_start_method( "spawn" )
+    except RuntimeError:
+        pass
+
+    system.StartHTTP( PROVIDER_PORT )
+    ctx = multiprocessing.get_context( "spawn" )
+    inq = ctx.Queue()
+    outq = ctx.Queue()
+    subscriber = ctx.Process( target=snapshot_subscriber, args=( SYSROOT+"_snapshot_subscriber", SUBSCRIBER_TX_PORT, PROVIDER_PORT, name, inq, outq ) )
+    writers = [ threading.Thread( target=writer, args=(w,) ) for w in range( 4 ) ]
+    try:
+        for W in writers:
+            W.start()
+        subscriber.start()
+        subscribed = outq.get( timeout=180 )
+        Expect( subscribed == "subscribed",         "subscriber attached" )
+        running.set()
+
+        # All writers run until the graph is made readonly for the snapshot
+        for W in writers:
+            W.join( timeout=120 )
+            Expect( not W.is_alive(),               "writer stopped by readonly snapshot" )
+        Expect( sum( written ) > 0,                 "writes before snapshot" )
+        deadline = time.time() + 120
+        while g.IsGraphReadonly() and time.time() < deadline:
+            time.sleep( 0.1 )
+        Expect( g.IsGraphReadonly() is False,       "provider graph writable after snapshot sync" )
+
+        # Let subscriber catch up and compare
+        op.Fence()
+        expected = {}
+        for id in g.Vertices():
+            expected[id] = g[id]['x']
+        inq.put( expected )
+        order, n_missing, readonly = outq.get( timeout=180 )
+        Expect( order == len(expected),             "subscriber order %d, expected %d" % (order, len(expected)) )
+        Expect( n_missing == 0,                     "%d vertices differ on subscriber" % n_missing )
+        Expect( readonly is False,                  "subscriber graph writable" )
+    finally:
+        stop.set()
+        for W in writers:
+            if W.is_alive():
+                W.join()
+        op.Detach( force=True )
+        inq.put( None )
+        subscriber.join( timeout=60 )
+        if subscriber.exitcode is None:
+            subscriber.kill()
+        system.StopHTTP()
+
+    g.Erase()
+
+
+
+
 ###############################################################################
 # Run
 #
@@ -115,6 +115,11 @@ static                   int cxmalloc_api__set_readonly( cxmalloc_family_t *fami
 static                   int cxmalloc_api__is_readonly( cxmalloc_family_t *family );
 static                   int cxmalloc_api__clear_readonly( cxmalloc_family_t *family );
 
+/* Fork support */
+static                   int cxmalloc_api__fork_prepare( cxmalloc_family_t *family );
+static                  void cxmalloc_api__fork_parent( cxmalloc_family_t *family );
+static                  void cxmalloc_api__fork_child( cxmalloc_family_t *family );
+
 /* Serialization */
 static               int64_t cxmalloc_api__bulk_serialize( cxmalloc_family_t *family, bool force );
 static               int64_t cxmalloc_api__restore_objects( cxmalloc_family_t *family );
@@ -188,6 +193,10 @@ DLL_HIDDEN cxmalloc_family_vtable_t cxmalloc_family_Methods = {
   .SetReadonly            = cxmalloc_api__set_readonly,
   .IsReadonly             = cxmalloc_api__is_readonly,
   .ClearReadonly          = cxmalloc_api__clear_readonly,
+  /* Fork support */
+  .ForkPrepare            = cxmalloc_api__fork_prepare,
+  .ForkParent             = cxmalloc_api__fork_parent,
+  .ForkChild              = cxmalloc_api__fork_child,
   /* Serialization */
   .BulkSerialize          = cxmalloc_api__bulk_serialize,
   .RestoreObjects         = cxmalloc_api__restore_objects,
@@ -1164,6 +1173,76 @@ RESUME_WARNINGS
 
 
 
+/*******************************************************************//**
+ * Acquire the family lock and all allocator locks before fork() without
+ * blocking. The caller holds the locks across fork() so that no other
+ * thread is inside the family when the child's image is taken.
+ *
+ * Returns:    1 : All locks held, release with ForkParent()/ForkChild()
+ *             0 : A lock is busy, no locks held
+ ***********************************************************************
+ */
+static int cxmalloc_api__fork_prepare( cxmalloc_family_t *family ) {
+  if( !TRY_CRITICAL_SECTION( &family->lock.lock ) ) {
+    return 0;
+  }
+  cxmalloc_allocator_t **allocators = family->allocators;
+  for( int aidx=0; aidx<family->size; aidx++ ) {
+    cxmalloc_allocator_t *allocator = allocators[aidx];
+    if( allocator && !TRY_CRITICAL_SECTION( &allocator->alock.lock ) ) {
+      // Busy, back out
+      while( --aidx >= 0 ) {
+        if( (allocator = allocators[aidx]) != NULL ) {
+          LEAVE_CRITICAL_SECTION( &allocator->alock.lock );
+        }
+      }
+      LEAVE_CRITICAL_SECTION( &family->lock.lock );
+      return 0;
+    }
+  }
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ * Release locks acquired by ForkPrepare() in the parent after fork()
+ *
+ ***********************************************************************
+ */
+static void cxmalloc_api__fork_parent( cxmalloc_family_t *family ) {
+  cxmalloc_allocator_t **allocators = family->allocators;
+  for( int aidx=family->size-1; aidx>=0; aidx-- ) {
+    cxmalloc_allocator_t *allocator = allocators[aidx];
+    if( allocator ) {
+      LEAVE_CRITICAL_SECTION( &allocator->alock.lock );
+    }
+  }
+  LEAVE_CRITICAL_SECTION( &family->lock.lock );
+}
+
+
+
+/*******************************************************************//**
+ * Reinitialize locks acquired by ForkPrepare() in the child after fork().
+ * The child's thread is not the owner of the locks taken in the parent,
+ * so they cannot be released normally.
+ *
+ ***********************************************************************
+ */
+static void cxmalloc_api__fork_child( cxmalloc_family_t *family ) {
+  cxmalloc_allocator_t **allocators = family->allocators;
+  for( int aidx=0; aidx<family->size; aidx++ ) {
+    cxmalloc_allocator_t *allocator = allocators[aidx];
+    if( allocator ) {
+      INIT_CRITICAL_SECTION( &allocator->alock.lock );
+    }
+  }
+  INIT_CRITICAL_SECTION( &family->lock.lock );
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
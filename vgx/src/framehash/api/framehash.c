@@ -157,6 +157,7 @@ DLL_EXPORT IFramehash_t iFramehash = {
     .MathCellProcessors         = &_framehash_framemath__iMathCellProcessors,
     .ProcessNolockNocache       = _framehash_processor__process_nolock_nocache,
     .ProcessNolock              = _framehash_processor__process_nolock,
+    .ProcessPartitionNolock     = _framehash_processor__process_partition_nolock_nocache,
   },
   // DYNAMIC
   .dynamic = {
@@ -50,6 +50,7 @@ static const f_process_level PROCESS[8] = {
 
 
 static int64_t __cache_process_partial( framehash_processing_context_t * const processor, int64_t *nproc, uint64_t selector );
+static int64_t __internal_process_partition( framehash_processing_context_t * const processor, int64_t *nproc, int part, int nparts );
 
 
 #define __PUSH_FRAME( ContextPtr, Frame )                               \
@@ -421,6 +422,77 @@ static int64_t __internal_process( framehash_processing_context_t * const proces
 
 
 
+/*******************************************************************//**
+ * __internal_process_partition
+ * Same traversal order as __internal_process, but only the regions whose
+ * running unit number maps to the given partition are processed. Each
+ * leaf zone, each leaf slot and each chain cell in the chain zone is one
+ * unit, i.e. a chain cell partition covers an entire top level subtree.
+ ***********************************************************************
+ */
+static int64_t __internal_process_partition( framehash_processing_context_t * const processor, int64_t *nproc, int part, int nparts ) {
+
+  framehash_cell_t * const intern = processor->instance.frame;
+
+  framehash_cell_t * const start = CELL_GET_FRAME_SLOTS(intern)->cells;
+  const framehash_cell_t *end;
+  framehash_cell_t *cursor;
+  framehash_metas_t *internal_metas = CELL_GET_FRAME_METAS(intern);
+  int p = internal_metas->order;
+  int nchainslots = _FRAME_NCHAINSLOTS( p );
+  int unit = 0;
+
+  XDO {
+    cursor = start;
+    // All zones
+    for( int k=p-1; k >= 0; k-- ) {
+      // Chain zone
+      if( k == _FRAME_CHAINZONE(p) ) {
+        for( int q=0; q<nchainslots; q++ ) {
+          end = cursor + FRAMEHASH_CELLS_PER_SLOT;
+          // Chain slot: one unit per subtree
+          if( _framehash_radix__is_chain( internal_metas, _SLOT_Q_GET_CHAININDEX(q) ) ) {
+            do {
+              if( unit++ % nparts == part ) {
+                if( __follow_chain( processor, cursor, nproc ) != 0 ) {
+                  XBREAK;
+                }
+              }
+            } while( ++cursor < end );
+          }
+          // Leaf slot
+          else if( unit++ % nparts == part ) {
+            if( __process_cell_region( processor, &cursor, end, nproc ) != 0 ) {
+              XBREAK;
+            }
+          }
+          else {
+            cursor = (framehash_cell_t*)end;
+          }
+        }
+      }
+      // Leaf zone
+      else {
+        end = cursor + _FRAME_ZONESLOTS(k) * (int)FRAMEHASH_CELLS_PER_SLOT;
+        if( unit++ % nparts == part ) {
+          if( __process_cell_region( processor, &cursor, end, nproc ) != 0 ) {
+            XBREAK;
+          }
+        }
+        else {
+          cursor = (framehash_cell_t*)end;
+        }
+      }
+    }
+  }
+  XFINALLY {
+  }
+
+  return *nproc;
+}
+
+
+
 /*******************************************************************//**
  * __basement_process
  *
@@ -946,6 +1018,37 @@ DLL_HIDDEN int64_t _framehash_processor__process_cache_partial_nolock_nocache( f
 
 
 
+/*******************************************************************//**
+ * _framehash_processor__process_partition_nolock_nocache
+ * Process the top level subtrees assigned to partition part (0 <= part <
+ * nparts). Running all partitions processes every item exactly once, so
+ * disjoint partitions may be processed concurrently by readonly processors.
+ * Any other top frame type (leaf, basement, cache) belongs to partition 0.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _framehash_processor__process_partition_nolock_nocache( framehash_processing_context_t * const processor, int part, int nparts ) {
+  int64_t nproc = 0;
+  if( nparts < 2 ) {
+    return _framehash_processor__process_nolock_nocache( processor );
+  }
+  if( part < 0 || part >= nparts ) {
+    return -1;
+  }
+  switch( CELL_GET_FRAME_TYPE( processor->instance.frame ) ) {
+  case FRAME_TYPE_INTERNAL:
+    __internal_process_partition( processor, &nproc, part, nparts );
+    break;
+  default:
+    if( part == 0 ) {
+      nproc = _framehash_processor__process_nolock_nocache( processor );
+    }
+  }
+  return nproc;
+}
+
+
+
 /*******************************************************************//**
  * _framehash_processor__process
  *
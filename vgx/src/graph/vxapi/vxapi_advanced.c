@@ -83,6 +83,8 @@ static int Graph_connect_M_FLT( vgx_Graph_t *self, const char *initial, const ch
 
 static int64_t Graph_disconnect_WL( vgx_Graph_t *self, vgx_Arc_t *arc_WL );
 
+static int64_t Graph_mutate_batch( vgx_Graph_t *self, vgx_Mutation_t *items, int64_t n, int timeout_ms, CString_t **CSTR__error );
+
 static void Graph_delete_collector( vgx_BaseCollector_context_t **collector );
 
 static int Graph_get_open_vertices( vgx_Graph_t *self, int64_t thread_id_filter, Key64Value56List_t **readonly, Key64Value56List_t **writable );
@@ -94,6 +96,14 @@ static vgx_MemoryInfo_t Graph_get_memory_info( vgx_Graph_t *self );
 
 static int64_t Graph_reset_serial( vgx_Graph_t *self, int64_t sn );
 
+static int64_t Graph_freeze_arcs( vgx_Graph_t *self, int64_t min_degree, int64_t *ret_bytes, int64_t *ret_oversized );
+static int64_t Graph_thaw_arcs( vgx_Graph_t *self );
+static int64_t Graph_create_geo_index( vgx_Graph_t *self, const char *lat_key, const char *lon_key, CString_t **CSTR__error );
+static int Graph_drop_geo_index( vgx_Graph_t *self );
+static int64_t Graph_create_text_index( vgx_Graph_t *self, const char *key, CString_t **CSTR__error );
+static int Graph_drop_text_index( vgx_Graph_t *self, const char *key );
+static int Graph_parallel_traversal( vgx_Graph_t *self, int min_degree, int workers, int *ret_min_degree, int *ret_workers );
+
 static void DebugGraph_print_vertex_acquisition_maps( vgx_Graph_t *self );
 static void DebugGraph_print_allocators( vgx_Graph_t *self, const char *alloc_name );
 static int DebugGraph_check_allocators( vgx_Graph_t *self, const char *alloc_name );
@@ -155,6 +165,8 @@ static vgx_IGraphAdvanced_t AdvancedMethods = {
 
   .Disconnect_WL                          = Graph_disconnect_WL,
 
+  .MutateBatch                            = Graph_mutate_batch,
+
   .DeleteCollector                        = Graph_delete_collector,
 
   .GetOpenVertices                        = Graph_get_open_vertices,
@@ -166,6 +178,16 @@ static vgx_IGraphAdvanced_t AdvancedMethods = {
 
   .ResetSerial                            = Graph_reset_serial,
 
+  .FreezeArcs                             = Graph_freeze_arcs,
+  .ThawArcs                               = Graph_thaw_arcs,
+
+  .CreateGeoIndex                         = Graph_create_geo_index,
+  .DropGeoIndex                           = Graph_drop_geo_index,
+
+  .CreateTextIndex                        = Graph_create_text_index,
+  .DropTextIndex                          = Graph_drop_text_index,
+  .ParallelTraversal                      = Graph_parallel_traversal,
+
   .DebugPrintVertexAcquisitionMaps        = DebugGraph_print_vertex_acquisition_maps,
   .DebugPrintAllocators                   = DebugGraph_print_allocators,
   .DebugCheckAllocators                   = DebugGraph_check_allocators,
@@ -1348,6 +1370,386 @@ static int64_t Graph_disconnect_WL( vgx_Graph_t *self, vgx_Arc_t *arc_WL ) {
 
 
 
+typedef struct s_mutation_key_t {
+  objectid_t obid;
+  int64_t index;
+} mutation_key_t;
+
+
+
+typedef struct s_mutation_group_t {
+  int64_t k0;
+  int64_t k1;
+  int64_t slot;
+  vgx_Vertex_t *vertex_WL;
+} mutation_group_t;
+
+
+
+/*******************************************************************//**
+ * Order by vertex, then by position in batch
+ *
+ ***********************************************************************
+ */
+static int __compare_mutation_key( const void *a, const void *b ) {
+  const mutation_key_t *ka = (const mutation_key_t*)a;
+  const mutation_key_t *kb = (const mutation_key_t*)b;
+  int c = idcmp( &ka->obid, &kb->obid );
+  if( c == 0 ) {
+    return (ka->index > kb->index) - (ka->index < kb->index);
+  }
+  return c;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static const CString_t * __mutation_vertex_idstr( const vgx_Mutation_t *item ) {
+  if( item->type == VGX_MUTATION_CONNECT ) {
+    return item->relation ? item->relation->initial.CSTR__name : NULL;
+  }
+  return item->CSTR__idstr;
+}
+
+
+
+/*******************************************************************//**
+ * Release terminals held by a batch group. The vertex is committed first
+ * (if attached) so that its arcs to the terminals are captured before any
+ * terminal can be deleted. The vertex itself remains acquired.
+ *
+ ***********************************************************************
+ */
+static int64_t __mutation_release_terminals( vgx_Graph_t *self, vgx_Vertex_t *vertex_WL, vgx_Vertex_t **terminals_WL, int64_t *n_held ) {
+  int64_t n_err = 0;
+  if( *n_held > 0 && iSystem.IsAttached() ) {
+    GRAPH_LOCK( self ) {
+      _vxdurable_commit__commit_vertex_CS_WL( self, vertex_WL, false );
+    } GRAPH_RELEASE;
+  }
+  for( int64_t i=0; i<*n_held; i++ ) {
+    vgx_Vertex_t *initial_WL = vertex_WL;
+    if( _vxgraph_state__release_initial_and_terminal_OPEN_LCK( self, &initial_WL, &terminals_WL[i] ) == false ) {
+      CRITICAL( 0xA31, "Failed to release writable initial and terminal atomically" );
+      ++n_err;
+    }
+  }
+  *n_held = 0;
+  return n_err;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __mutation_connect_WL( vgx_Graph_t *self, vgx_Vertex_t *initial_WL, vgx_Vertex_t *terminal_WL, vgx_Mutation_t *item ) {
+  vgx_Arc_t arc = {0};
+  arc.tail = initial_WL;
+  arc.head.vertex = terminal_WL;
+  int ret = Graph_connect_WL( self, &item->relation->relationship, &arc, item->lifespan, NULL, &item->reason, &item->CSTR__error );
+  // Implicitly created terminal. Capture virtualization operation.
+  if( ret >= 0 && initial_WL != terminal_WL && iSystem.IsAttached() && __vertex_is_manifestation_virtual( terminal_WL ) ) {
+    iOperation.Vertex_WL.Convert( terminal_WL, VERTEX_STATE_CONTEXT_MAN_VIRTUAL );
+  }
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Fail all items in a batch group with the same reason and error.
+ *
+ ***********************************************************************
+ */
+static int64_t __mutation_fail_group( vgx_Mutation_t *items, const mutation_key_t *keys, const mutation_group_t *group, vgx_AccessReason_t reason, const CString_t *CSTR__error ) {
+  if( !__has_access_reason( &reason ) || reason == VGX_ACCESS_REASON_OBJECT_ACQUIRED ) {
+    reason = VGX_ACCESS_REASON_ERROR;
+  }
+  for( int64_t k=group->k0; k<group->k1; k++ ) {
+    vgx_Mutation_t *item = &items[ keys[k].index ];
+    item->reason = reason;
+    if( CSTR__error && item->CSTR__error == NULL ) {
+      item->CSTR__error = CStringClone( CSTR__error );
+    }
+  }
+  return group->k1 - group->k0;
+}
+
+
+
+/*******************************************************************//**
+ * Acquire the vertices of groups [g0, g1) writable in one atomic
+ * acquisition. Vertices that do not exist are first created as REAL.
+ * Groups whose vertex cannot be created or acquired have all their
+ * items failed and are left with vertex_WL set to NULL.
+ *
+ * Returns: List of acquired vertices (to be released with
+ *          Graph_atomic_release_vertices()), or NULL if none acquired.
+ ***********************************************************************
+ */
+static vgx_VertexList_t * __mutation_acquire_vertices( vgx_Graph_t *self, vgx_Mutation_t *items, const mutation_key_t *keys, mutation_group_t *groups, int64_t g0, int64_t g1, int timeout_ms, int64_t *n_failed ) {
+  vgx_VertexList_t *vertices = NULL;
+  vgx_VertexIdentifiers_t *identifiers = NULL;
+  vgx_AccessReason_t reason = VGX_ACCESS_REASON_NONE;
+  CString_t *CSTR__error = NULL;
+  int64_t n_ids = 0;
+
+  if( (identifiers = iVertex.Identifiers.New( self, g1 - g0 )) == NULL ) {
+    __set_error_string( &CSTR__error, "out of memory" );
+  }
+  else {
+    // Make sure all vertices exist
+    GRAPH_LOCK( self ) {
+      for( int64_t g=g0; g<g1; g++ ) {
+        mutation_group_t *group = &groups[g];
+        const CString_t *CSTR__idstr = __mutation_vertex_idstr( &items[ keys[group->k0].index ] );
+        group->slot = -1;
+        group->vertex_WL = NULL;
+        reason = VGX_ACCESS_REASON_NONE;
+        if( _vxgraph_state__create_vertex_CS( self, CSTR__idstr, &keys[group->k0].obid, NULL, NULL, timeout_ms, &reason, &CSTR__error ) < 0
+            ||
+            iVertex.Identifiers.SetIdLen( identifiers, n_ids, CStringValue( CSTR__idstr ), CStringLength( CSTR__idstr ) ) == NULL )
+        {
+          *n_failed += __mutation_fail_group( items, keys, group, reason, CSTR__error );
+          iString.Discard( &CSTR__error );
+        }
+        else {
+          group->slot = n_ids++;
+        }
+      }
+    } GRAPH_RELEASE;
+  }
+
+  // Acquire all vertices, retrying transient failures with partial timeouts
+  if( n_ids > 0 && iVertex.Identifiers.Truncate( identifiers, n_ids ) == n_ids ) {
+    int partial_timeout_ms = 250;
+    int remain_timeout_ms = timeout_ms;
+    int retry;
+    do {
+      retry = 0;
+      if( partial_timeout_ms > remain_timeout_ms ) {
+        partial_timeout_ms = remain_timeout_ms;
+      }
+      vertices = Graph_atomic_acquire_vertices_writable( self, identifiers, partial_timeout_ms, &reason, &CSTR__error );
+      if( vertices == NULL && remain_timeout_ms > 0 && __is_access_reason_transient( reason ) ) {
+        retry = 1;
+        if( reason == VGX_ACCESS_REASON_OPFAIL ) {
+          sleep_milliseconds( 20 );
+          remain_timeout_ms -= 20;
+        }
+        else {
+          remain_timeout_ms -= partial_timeout_ms;
+        }
+      }
+    } while( retry );
+  }
+
+  for( int64_t g=g0; g<g1; g++ ) {
+    mutation_group_t *group = &groups[g];
+    if( vertices ) {
+      if( group->slot >= 0 ) {
+        group->vertex_WL = iVertex.List.Get( vertices, group->slot );
+      }
+    }
+    else if( group->slot >= 0 || identifiers == NULL ) {
+      *n_failed += __mutation_fail_group( items, keys, group, reason, CSTR__error );
+    }
+  }
+
+  iString.Discard( &CSTR__error );
+  iVertex.Identifiers.Delete( &identifiers );
+
+  return vertices;
+}
+
+
+
+/*******************************************************************//**
+ * Apply a batch of mutations.
+ *
+ * Items are grouped by vertex. Vertices that do not exist are created
+ * as REAL, and then all vertices of the batch are acquired writable in
+ * one atomic acquisition (in chunks of at most MAX_ATOMIC_BATCH_SIZE
+ * vertices). All mutations of a vertex are applied in batch order, and
+ * the vertices are released together so their captured operations are
+ * committed once. Terminals of CONNECT items are created as VIRTUAL if
+ * needed and held until the vertex group is done.
+ *
+ * Each item gets its own result, access reason and error string. The
+ * caller owns any item->CSTR__error returned.
+ *
+ * Returns: Number of failed items, or -1 if the batch could not be
+ *          processed at all.
+ ***********************************************************************
+ */
+static int64_t Graph_mutate_batch( vgx_Graph_t *self, vgx_Mutation_t *items, int64_t n, int timeout_ms, CString_t **CSTR__error ) {
+#define __MAX_HELD_TERMINALS 64
+  int64_t n_failed = 0;
+  int64_t n_keys = 0;
+  int64_t n_groups = 0;
+  mutation_key_t *keys = NULL;
+  mutation_group_t *groups = NULL;
+  vgx_Vertex_t *terminals_WL[ __MAX_HELD_TERMINALS ];
+
+  if( n <= 0 ) {
+    return 0;
+  }
+
+  if( _vxgraph_tracker__has_readonly_locks_OPEN( self ) ) {
+    __set_error_string( CSTR__error, "mutation not allowed while holding readonly vertices" );
+    return -1;
+  }
+
+  if( (keys = calloc( n, sizeof( mutation_key_t ) )) == NULL || (groups = calloc( n, sizeof( mutation_group_t ) )) == NULL ) {
+    free( keys );
+    __set_error_string( CSTR__error, "out of memory" );
+    return -1;
+  }
+
+  for( int64_t i=0; i<n; i++ ) {
+    vgx_Mutation_t *item = &items[i];
+    const CString_t *CSTR__idstr = __mutation_vertex_idstr( item );
+    item->result = -1;
+    item->reason = VGX_ACCESS_REASON_NONE;
+    if( CSTR__idstr ) {
+      keys[n_keys].index = i;
+      idcpy( &keys[n_keys].obid, CStringObid( CSTR__idstr ) );
+      ++n_keys;
+    }
+    else {
+      item->reason = VGX_ACCESS_REASON_ERROR;
+      __set_error_string( &item->CSTR__error, "missing vertex identifier" );
+      ++n_failed;
+    }
+  }
+
+  qsort( keys, n_keys, sizeof( mutation_key_t ), __compare_mutation_key );
+
+  // One group per vertex
+  for( int64_t k=0; k<n_keys; k++ ) {
+    if( k == 0 || !idmatch( &keys[k].obid, &keys[k-1].obid ) ) {
+      if( n_groups > 0 ) {
+        groups[n_groups-1].k1 = k;
+      }
+      groups[n_groups++].k0 = k;
+    }
+  }
+  if( n_groups > 0 ) {
+    groups[n_groups-1].k1 = n_keys;
+  }
+
+  int64_t c0 = 0;
+  while( c0 < n_groups ) {
+    int64_t c1 = c0 + (int64_t)MAX_ATOMIC_BATCH_SIZE;
+    if( c1 > n_groups ) {
+      c1 = n_groups;
+    }
+
+    vgx_VertexList_t *vertices = __mutation_acquire_vertices( self, items, keys, groups, c0, c1, timeout_ms, &n_failed );
+
+    for( int64_t g=c0; g<c1; g++ ) {
+      const mutation_group_t *group = &groups[g];
+      vgx_Vertex_t *vertex_WL = group->vertex_WL;
+      if( vertex_WL == NULL ) {
+        continue;
+      }
+
+      int64_t n_held = 0;
+      for( int64_t k=group->k0; k<group->k1; k++ ) {
+        vgx_Mutation_t *item = &items[ keys[k].index ];
+        switch( item->type ) {
+        case VGX_MUTATION_CONNECT:
+          {
+            vgx_Relation_t *relation = item->relation;
+            const objectid_t *terminal_obid = relation->terminal.CSTR__name ? CStringObid( relation->terminal.CSTR__name ) : NULL;
+            if( terminal_obid == NULL ) {
+              __set_access_reason( &item->reason, VGX_ACCESS_REASON_ERROR );
+              __set_error_string( &item->CSTR__error, "missing terminal identifier" );
+            }
+            // Loop
+            else if( idmatch( terminal_obid, &keys[group->k0].obid ) ) {
+              item->result = __mutation_connect_WL( self, vertex_WL, vertex_WL, item );
+            }
+            // Acquire terminal (vertex is already ours, its lock recursion is incremented)
+            else {
+              // Each held terminal adds one level of lock recursion on the vertex
+              if( n_held == __MAX_HELD_TERMINALS || !__vertex_is_semaphore_writer_reentrant( vertex_WL ) ) {
+                n_failed += __mutation_release_terminals( self, vertex_WL, terminals_WL, &n_held );
+              }
+              vgx_Vertex_t *initial_WL = NULL;
+              vgx_Vertex_t *terminal_WL = NULL;
+              vgx_ExecutionTimingBudget_t timing_budget = _vgx_get_execution_timing_budget( 0, timeout_ms );
+              if( _vxgraph_state__acquire_writable_initial_and_terminal_OPEN( self, &initial_WL, relation->initial.CSTR__name, &keys[group->k0].obid, &terminal_WL, relation->terminal.CSTR__name, terminal_obid, VERTEX_STATE_CONTEXT_MAN_VIRTUAL, &timing_budget, &item->CSTR__error ) == 2 ) {
+                terminals_WL[ n_held++ ] = terminal_WL;
+                item->result = __mutation_connect_WL( self, vertex_WL, terminal_WL, item );
+              }
+              else {
+                __set_access_reason( &item->reason, timing_budget.reason );
+              }
+            }
+          }
+          break;
+        case VGX_MUTATION_SET_PROPERTY:
+          if( item->property ) {
+            item->result = CALLABLE( vertex_WL )->SetProperty( vertex_WL, item->property );
+          }
+          else {
+            __set_error_string( &item->CSTR__error, "missing property" );
+          }
+          break;
+        case VGX_MUTATION_SET_VECTOR:
+          if( item->vector ) {
+            item->result = CALLABLE( vertex_WL )->SetVector( vertex_WL, &item->vector );
+          }
+          else {
+            __set_error_string( &item->CSTR__error, "missing vector" );
+          }
+          break;
+        default:
+          __set_error_string( &item->CSTR__error, "invalid mutation" );
+          break;
+        }
+
+        if( item->result < 0 ) {
+          if( !__has_access_reason( &item->reason ) || item->reason == VGX_ACCESS_REASON_OBJECT_ACQUIRED ) {
+            item->reason = VGX_ACCESS_REASON_ERROR;
+          }
+          ++n_failed;
+        }
+        else {
+          item->reason = VGX_ACCESS_REASON_NONE;
+        }
+      }
+
+      // Release terminals (commits the vertex first, vertex remains acquired)
+      n_failed += __mutation_release_terminals( self, vertex_WL, terminals_WL, &n_held );
+    }
+
+    // Release all vertices (commits all their operations)
+    if( vertices && Graph_atomic_release_vertices( self, &vertices ) < 0 ) {
+      CRITICAL( 0xA32, "Failed to release writable vertices after batch mutation" );
+      ++n_failed;
+    }
+
+    c0 = c1;
+  }
+
+  free( groups );
+  free( keys );
+
+  return n_failed;
+#undef __MAX_HELD_TERMINALS
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1606,6 +2008,123 @@ static int64_t Graph_reset_serial( vgx_Graph_t *self, int64_t sn ) {
 
 
 
+/*******************************************************************//**
+ * Convert arc arrays with at least min_degree arcs to frozen compact form.
+ * Frozen arrays are thawed automatically on the next modification.
+ * Arrays exceeding frozen capacity are left unchanged and counted in
+ * ret_oversized.
+ *
+ ***********************************************************************
+ */
+static int64_t Graph_freeze_arcs( vgx_Graph_t *self, int64_t min_degree, int64_t *ret_bytes, int64_t *ret_oversized ) {
+  int64_t n_oversized = 0;
+  int64_t n_frozen = _vxgraph_vxtable__freeze_arcs_OPEN( self, min_degree, ret_bytes, &n_oversized );
+  if( n_frozen > 0 ) {
+    VERBOSE( 0x001, "Froze %lld arc arrays in graph '%s'", n_frozen, CALLABLE( self )->FullPath( self ) );
+  }
+  if( n_oversized > 0 ) {
+    VERBOSE( 0x002, "Skipped %lld arc arrays too large for frozen form in graph '%s'", n_oversized, CALLABLE( self )->FullPath( self ) );
+  }
+  if( ret_oversized ) {
+    *ret_oversized = n_oversized;
+  }
+  return n_frozen;
+}
+
+
+
+/*******************************************************************//**
+ * Convert all frozen arc arrays back to mutable form.
+ *
+ ***********************************************************************
+ */
+static int64_t Graph_thaw_arcs( vgx_Graph_t *self ) {
+  return _vxgraph_vxtable__thaw_arcs_OPEN( self );
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t Graph_create_geo_index( vgx_Graph_t *self, const char *lat_key, const char *lon_key, CString_t **CSTR__error ) {
+  return _vxgraph_geoindex__create_OPEN( self, lat_key, lon_key, CSTR__error );
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int Graph_drop_geo_index( vgx_Graph_t *self ) {
+  return _vxgraph_geoindex__drop_OPEN( self );
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t Graph_create_text_index( vgx_Graph_t *self, const char *key, CString_t **CSTR__error ) {
+  return _vxgraph_textindex__create_OPEN( self, key, CSTR__error );
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int Graph_drop_text_index( vgx_Graph_t *self, const char *key ) {
+  return _vxgraph_textindex__drop_OPEN( self, key );
+}
+
+
+
+/*******************************************************************//**
+ * Configure parallel traversal of high degree vertices. Neighborhood
+ * queries in a readonly graph split the arcs of an anchor with degree
+ * >= min_degree across workers threads. A negative value leaves the
+ * corresponding setting unchanged, and workers < 2 disables parallel
+ * traversal. Current settings are returned in ret_min_degree and
+ * ret_workers (if not NULL).
+ *
+ * Returns: 0 on success, -1 if the new settings are out of range
+ ***********************************************************************
+ */
+static int Graph_parallel_traversal( vgx_Graph_t *self, int min_degree, int workers, int *ret_min_degree, int *ret_workers ) {
+  int ret = 0;
+  GRAPH_LOCK( self ) {
+    if( workers > VGX_PARALLEL_TRAVERSAL_MAX_WORKERS ) {
+      ret = -1;
+    }
+    else {
+      if( min_degree >= 0 ) {
+        self->parallel_traversal.min_degree = min_degree;
+      }
+      if( workers >= 0 ) {
+        self->parallel_traversal.workers = workers;
+      }
+    }
+    if( ret_min_degree ) {
+      *ret_min_degree = self->parallel_traversal.min_degree;
+    }
+    if( ret_workers ) {
+      *ret_workers = self->parallel_traversal.workers;
+    }
+  } GRAPH_RELEASE;
+  return ret;
+}
+
+
+
 /*******************************************************************//**
  *
  *
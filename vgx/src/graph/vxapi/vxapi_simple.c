@@ -57,6 +57,7 @@ static int64_t Graph_degree( vgx_Graph_t *self, const CString_t *CSTR__vertex_na
 static int64_t Graph_vertex_degree( vgx_Graph_t *self, const CString_t *CSTR__vertex_name, vgx_AccessReason_t *reason );
 static int64_t Graph_vertex_indegree( vgx_Graph_t *self, const CString_t *CSTR__vertex_name, vgx_AccessReason_t *reason );
 static int64_t Graph_vertex_outdegree( vgx_Graph_t *self, const CString_t *CSTR__vertex_name, vgx_AccessReason_t *reason );
+static int64_t Graph_common_neighbors( vgx_Graph_t *self, const CString_t *CSTR__vertex_name, CString_t **CSTR__others, int64_t n_others, vgx_ArcConditionSet_t *arc_condition_set, vgx_CommonNeighbors_t *result, int timeout_ms, vgx_AccessReason_t *reason, CString_t **CSTR__error );
 
 static vgx_vertex_type_t Graph_vertex_set_type( vgx_Graph_t *self, const CString_t *CSTR__vertex_name, const CString_t *CSTR__vertex_type, int timeout_ms, vgx_AccessReason_t *reason );
 static const CString_t * Graph_vertex_get_type( vgx_Graph_t *self, const CString_t *CSTR__vertex_name, int timeout_ms, vgx_AccessReason_t *reason );
@@ -100,6 +101,7 @@ static vgx_IGraphSimple_t SimpleMethods = {
   .VertexDegree         = Graph_vertex_degree,      // DEPRECATED
   .VertexInDegree       = Graph_vertex_indegree,    // DEPRECATED
   .VertexOutDegree      = Graph_vertex_outdegree,   // DEPRECATED
+  .CommonNeighbors      = Graph_common_neighbors,
   .VertexSetType        = Graph_vertex_set_type,
   .VertexGetType        = Graph_vertex_get_type,
   .HasAdjacency         = Graph_has_adjacency,
@@ -1270,6 +1272,112 @@ static int64_t Graph_degree( vgx_Graph_t *self, const CString_t *CSTR__vertex_na
 
 
 
+/*******************************************************************//**
+ * Compute common neighbors of vertex and each of n_others other
+ * vertices into result[0..n_others-1]. Neighbor sets contain arcs in
+ * the direction of arc_condition_set (default VGX_ARCDIR_OUT) matching
+ * its conditions. The vertex's set is extracted once. Other vertices
+ * that do not exist have no common neighbors.
+ *
+ * Returns: n_others, or -1 on error
+ ***********************************************************************
+ */
+static int64_t Graph_common_neighbors( vgx_Graph_t *self, const CString_t *CSTR__vertex_name, CString_t **CSTR__others, int64_t n_others, vgx_ArcConditionSet_t *arc_condition_set, vgx_CommonNeighbors_t *result, int timeout_ms, vgx_AccessReason_t *reason, CString_t **CSTR__error ) {
+  int64_t n_scored = -1;
+  vgx_ExecutionTimingBudget_t timing_budget = _vgx_get_graph_execution_timing_budget( self, timeout_ms );
+  vgx_virtual_ArcFilter_context_t *filter = NULL;
+  vgx_NeighborSet_t *A = NULL;
+  vgx_NeighborSet_t *B = NULL;
+  vgx_Vertex_t *vertex_RO = NULL;
+  int ro_frozen = 0;
+
+  XTRY {
+    vgx_arc_direction arcdir = arc_condition_set ? arc_condition_set->arcdir : VGX_ARCDIR_OUT;
+    if( arcdir != VGX_ARCDIR_OUT && arcdir != VGX_ARCDIR_IN && arcdir != VGX_ARCDIR_ANY ) {
+      __set_error_string( CSTR__error, "common neighbors require arc direction D_OUT, D_IN or D_ANY" );
+      THROW_SILENT( CXLIB_ERR_API, 0xA91 );
+    }
+
+    // Freeze readonly if needed
+    if( (ro_frozen = CALLABLE( self )->advanced->FreezeGraphReadonly_OPEN( self, CSTR__error )) < 0 ) {
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0xA92 );
+    }
+    bool readonly_graph = ro_frozen > 0;
+
+    if( (A = _vxgraph_neighbors__new_set()) == NULL || (B = _vxgraph_neighbors__new_set()) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xA93 );
+    }
+
+    // Arc filter
+    if( arc_condition_set ) {
+      if( (filter = iArcFilter.New( self, readonly_graph, arc_condition_set, NULL, NULL, &timing_budget )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0xA94 );
+      }
+    }
+
+    // Neighbors of vertex
+    if( (vertex_RO = _vxgraph_state__acquire_readonly_vertex_OPEN( self, CStringObid( CSTR__vertex_name ), &timing_budget )) == NULL ) {
+      __set_access_reason( reason, timing_budget.reason );
+      __set_error_string_from_reason( CSTR__error, CSTR__vertex_name, timing_budget.reason );
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0xA95 );
+    }
+    if( _vxgraph_neighbors__extract( vertex_RO, arcdir, filter, VGX_PREDICATOR_REL_WILDCARD, A ) < 0 ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0xA96 );
+    }
+
+    // Intersect with neighbors of each other vertex
+    for( int64_t i=0; i<n_others; i++ ) {
+      vgx_Vertex_t *other_RO;
+      memset( &result[i], 0, sizeof( vgx_CommonNeighbors_t ) );
+      if( (other_RO = _vxgraph_state__acquire_readonly_vertex_OPEN( self, CStringObid( CSTR__others[i] ), &timing_budget )) == NULL ) {
+        if( timing_budget.reason == VGX_ACCESS_REASON_NOEXIST ) {
+          result[i].n_A = A->n;
+          timing_budget.reason = VGX_ACCESS_REASON_NONE;
+          continue;
+        }
+        __set_access_reason( reason, timing_budget.reason );
+        __set_error_string_from_reason( CSTR__error, CSTR__others[i], timing_budget.reason );
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0xA97 );
+      }
+      int64_t n = _vxgraph_neighbors__extract( other_RO, arcdir, filter, VGX_PREDICATOR_REL_WILDCARD, B );
+      if( n >= 0 ) {
+        _vxgraph_neighbors__intersect( A, B, true, readonly_graph, &result[i] );
+      }
+      _vxgraph_state__release_vertex_OPEN_LCK( self, &other_RO );
+      if( n < 0 ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0xA98 );
+      }
+    }
+
+    n_scored = n_others;
+  }
+  XCATCH( errcode ) {
+    if( CSTR__error && *CSTR__error == NULL ) {
+      __set_error_string( CSTR__error, "common neighbors error" );
+    }
+    n_scored = -1;
+  }
+  XFINALLY {
+    iArcFilter.Delete( &filter );
+    _vxgraph_neighbors__delete_set( &A );
+    _vxgraph_neighbors__delete_set( &B );
+    if( vertex_RO || ro_frozen > 0 ) {
+      GRAPH_LOCK( self ) {
+        if( vertex_RO ) {
+          _vxgraph_state__release_vertex_CS_LCK( self, &vertex_RO );
+        }
+        if( ro_frozen > 0 ) {
+          CALLABLE( self )->advanced->UnfreezeGraphReadonly_CS( self );
+        }
+      } GRAPH_RELEASE;
+    }
+  }
+
+  return n_scored;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1646,6 +1754,7 @@ static int64_t Graph_neighborhood( vgx_Graph_t *self, vgx_NeighborhoodQuery_t *q
   vgx_Vertex_t *vertex_RO = NULL;
   int ro_frozen = 0;
   vgx_neighborhood_search_context_t *search = NULL;
+  vgx_neighborhood_expansion_t *expansion = NULL;
 
   int64_t qt_ns = 0;
   BEGIN_QUERY( query, &qt_ns ) {
@@ -1678,8 +1787,14 @@ static int64_t Graph_neighborhood( vgx_Graph_t *self, vgx_NeighborhoodQuery_t *q
         THROW_SILENT( CXLIB_ERR_GENERAL, 0xA62 );
       }
 
+      // Expand neighborhood from anchor before searching (also resolves hit counts)
+      if( query->expand_condition ) {
+        if( (expansion = iGraphTraverse.NewNeighborhoodExpansion( self, readonly_graph, query, vertex_RO )) == NULL ) {
+          THROW_SILENT( CXLIB_ERR_API, 0xA6D );
+        }
+      }
       // Validate neighborhood hit counts
-      if( iGraphTraverse.ValidateNeighborhoodCollectableCounts( self, readonly_graph, query, vertex_RO ) < 0 ) {
+      else if( iGraphTraverse.ValidateNeighborhoodCollectableCounts( self, readonly_graph, query, vertex_RO ) < 0 ) {
         THROW_SILENT( CXLIB_ERR_API, 0xA63 );
       }
 
@@ -1690,6 +1805,7 @@ static int64_t Graph_neighborhood( vgx_Graph_t *self, vgx_NeighborhoodQuery_t *q
 
       // Pick the appropriate traversal routine (collect arcs or vertices)
       int (*traverse_neighborhood)( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search );
+      bool parallel_arcs = false;
       if( _vgx_collector_mode_type( query->collector_mode ) == VGX_COLLECTOR_MODE_COLLECT_VERTICES ) {
         traverse_neighborhood = iGraphTraverse.TraverseNeighborVertices;
         hit_counter = &search->n_vertices;
@@ -1697,6 +1813,8 @@ static int64_t Graph_neighborhood( vgx_Graph_t *self, vgx_NeighborhoodQuery_t *q
       else if( _vgx_collector_mode_type( query->collector_mode ) == VGX_COLLECTOR_MODE_COLLECT_ARCS ) {
         traverse_neighborhood = iGraphTraverse.TraverseNeighborArcs;
         hit_counter = &search->n_arcs;
+        // High degree anchor in readonly graph may be traversed by multiple workers
+        parallel_arcs = readonly_graph;
       }
       else {
         THROW_ERROR( CXLIB_ERR_API, 0xA65 );
@@ -1707,23 +1825,29 @@ static int64_t Graph_neighborhood( vgx_Graph_t *self, vgx_NeighborhoodQuery_t *q
         search->result = query->collector; // append to existing list rather than creating new one to return
       }
       
+      // Expanded: Search from the final expansion frontier
+      if( expansion ) {
+        if( iGraphTraverse.TraverseExpandedNeighborhood( expansion, search ) < 0 ) {
+          THROW_SILENT( CXLIB_ERR_GENERAL, 0xA6E );
+        }
+      }
       // Bi-directional: Arcs can be either in or out
-      if( query->arc_condition_set == NULL || query->arc_condition_set->arcdir == VGX_ARCDIR_ANY ) {
+      else if( query->arc_condition_set == NULL || query->arc_condition_set->arcdir == VGX_ARCDIR_ANY ) {
         // 1: search the outarcs
         search->probe->traversing.arcdir = VGX_ARCDIR_OUT;
-        if( traverse_neighborhood( vertex_RO, search ) < 0 ) {
+        if( (parallel_arcs ? iGraphTraverse.TraverseNeighborArcsParallel( query, vertex_RO, search ) : traverse_neighborhood( vertex_RO, search )) < 0 ) {
           THROW_SILENT( CXLIB_ERR_GENERAL, 0xA66 );
         }
 
         // 2: search the inarcs
         search->probe->traversing.arcdir = VGX_ARCDIR_IN;
-        if( traverse_neighborhood( vertex_RO, search ) < 0 ) {
+        if( (parallel_arcs ? iGraphTraverse.TraverseNeighborArcsParallel( query, vertex_RO, search ) : traverse_neighborhood( vertex_RO, search )) < 0 ) {
           THROW_SILENT( CXLIB_ERR_GENERAL, 0xA67 );
         }
       }
       // Search IN, OUT or BOTH
       else {
-        if( traverse_neighborhood( vertex_RO, search ) < 0 ) {
+        if( (parallel_arcs ? iGraphTraverse.TraverseNeighborArcsParallel( query, vertex_RO, search ) : traverse_neighborhood( vertex_RO, search )) < 0 ) {
           THROW_SILENT( CXLIB_ERR_GENERAL, 0xA68 );
         }
       }
@@ -1790,6 +1914,7 @@ static int64_t Graph_neighborhood( vgx_Graph_t *self, vgx_NeighborhoodQuery_t *q
 
       query->n_arcs = search->n_arcs;
       query->n_neighbors = search->n_neighbors;
+      query->plan = search->plan;
       if( iGraphResponse.BuildSearchResult( self, &response_fields, NULL, (vgx_BaseQuery_t*)query ) < 0 ) {
         THROW_ERROR( CXLIB_ERR_GENERAL, 0xA6C );
       }
@@ -1821,6 +1946,8 @@ static int64_t Graph_neighborhood( vgx_Graph_t *self, vgx_NeighborhoodQuery_t *q
       }
       // Delete the search object
       iGraphProbe.DeleteSearch( (vgx_base_search_context_t**)&search );
+      // Delete the expansion (releases expanded frontier)
+      iGraphTraverse.DeleteNeighborhoodExpansion( &expansion );
       
     }
 
@@ -0,0 +1,260 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    __utest_vxarcvector_api__bloom.h
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#ifndef __UTEST_VXARCVECTOR_API__BLOOM_H
+#define __UTEST_VXARCVECTOR_API__BLOOM_H
+
+#include "__vxtest_macro.h"
+
+#define __UTEST_BLOOM_N_TERMINALS 200
+#define __UTEST_BLOOM_MIN_DEGREE  64
+
+BEGIN_UNIT_TEST( __utest_vxarcvector_api__bloom ) {
+
+  const CString_t *CSTR__graph_path = CStringNew( TestName );
+  const CString_t *CSTR__graph_name = CStringNew( "VGX_Graph" );
+
+  TEST_ASSERTION( CSTR__graph_path && CSTR__graph_name, "graph_path and graph_name created" );
+
+  bool INITIALIZED = __INITIALIZE_GRAPH_FACTORY( GetCurrentTestDirectory(), false );
+
+  const CString_t *CSTR___V = NULL;
+  const CString_t *CSTR___X = NULL;
+  const CString_t *CSTR___T[ __UTEST_BLOOM_N_TERMINALS ] = {0};
+
+  vgx_Graph_t *graph = NULL;
+  vgx_Graph_vtable_t *igraph = NULL;
+  framehash_dynamic_t *dyn = NULL;
+  vgx_Vertex_t *V = NULL;
+  vgx_Vertex_t *X = NULL;
+  vgx_Vertex_t *T[ __UTEST_BLOOM_N_TERMINALS ] = {0};
+  vgx_ArcVector_cell_t *Vout = NULL;
+
+  f_Vertex_connect_event connect_event = _vxgraph_arc__connect_WL_reverse_WL;
+  f_Vertex_disconnect_event disconnect_REV = _vxgraph_arc__disconnect_WL_reverse_WL;
+
+  vgx_predicator_mod_t M_INT = { .bits = VGX_PREDICATOR_MOD_INTEGER };
+
+  int64_t prev_min_degree = _vxarcvector_bloom__set_min_degree( __UTEST_BLOOM_MIN_DEGREE );
+
+  /*******************************************************************//**
+   * CREATE A TEST GRAPH
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Create Test Graph" ) {
+    vgx_Graph_constructor_args_t graph_args = {
+      .CSTR__graph_path     = CSTR__graph_path,
+      .CSTR__graph_name     = CSTR__graph_name,
+      .vertex_block_order   = 16,
+      .graph_t0             = __SECONDS_SINCE_1970(),
+      .start_opcount        = 1000,
+      .simconfig            = NULL,
+      .with_event_processor = true,
+      .idle_event_processor = false,
+      .force_readonly       = false,
+      .force_writable       = true,
+      .local_only           = true
+    };
+    objectid_t obid = *CStringObid( graph_args.CSTR__graph_name );
+    graph = COMLIB_OBJECT_NEW( vgx_Graph_t, &obid, &graph_args );
+    TEST_ASSERTION( graph != NULL, "graph constructed, graph=%llp", graph );
+    igraph = CALLABLE(graph);
+    dyn = &graph->arcvector_fhdyn;
+
+    CSTR___V = NewEphemeralCString( graph, "V" );
+    CSTR___X = NewEphemeralCString( graph, "X" );
+    for( int i=0; i<__UTEST_BLOOM_N_TERMINALS; i++ ) {
+      char name[32];
+      snprintf( name, 31, "T_%d", i );
+      CSTR___T[i] = NewEphemeralCString( graph, name );
+    }
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * FILTER IS ATTACHED AT THRESHOLD
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Attach At Threshold" ) {
+    vgx_Arc_t arc;
+
+    TEST_ASSERTION( (V = igraph->simple->OpenVertex( graph, CSTR___V, VGX_VERTEX_ACCESS_WRITABLE, 0, NULL, NULL )) != NULL, "Acquired V" );
+    TEST_ASSERTION( (X = igraph->simple->OpenVertex( graph, CSTR___X, VGX_VERTEX_ACCESS_WRITABLE, 0, NULL, NULL )) != NULL, "Acquired X" );
+    Vout = _vxvertex__get_vertex_outarcs( V );
+
+    for( int i=0; i<__UTEST_BLOOM_N_TERMINALS; i++ ) {
+      TEST_ASSERTION( (T[i] = igraph->simple->OpenVertex( graph, CSTR___T[i], VGX_VERTEX_ACCESS_WRITABLE, 0, NULL, NULL )) != NULL, "Acquired T_%d", i );
+      vgx_predicator_val_t val = { .integer = i };
+      SET_ARC( &arc, V, T[i], 101, M_INT, val, VGX_ARCDIR_OUT );
+      TEST_ASSERTION( iarcvector.Add( dyn, &arc, connect_event ) == 1, "Added V-(101)->T_%d", i );
+      if( i + 1 < __UTEST_BLOOM_MIN_DEGREE ) {
+        TEST_ASSERTION( !__arcvector_cell_has_bloom( Vout ), "no filter at degree %d", i + 1 );
+      }
+      else {
+        TEST_ASSERTION( __arcvector_cell_has_bloom( Vout ), "filter at degree %d", i + 1 );
+      }
+    }
+
+    TEST_ASSERTION( iarcvector.CellType( Vout ) == VGX_ARCVECTOR_ARRAY_OF_ARCS, "V has array of arcs" );
+    TEST_ASSERTION( iarcvector.Degree( Vout ) == __UTEST_BLOOM_N_TERMINALS, "V has %d outarcs", __UTEST_BLOOM_N_TERMINALS );
+    TEST_ASSERTION( _vxarcvector_bloom__bytes( Vout ) > 0, "filter bytes reported" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * LOOKUP WITH FILTER
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Lookup" ) {
+    vgx_ArcVector_cell_t arc_cell;
+    for( int i=0; i<__UTEST_BLOOM_N_TERMINALS; i++ ) {
+      TEST_ASSERTION( __arcvector_bloom_may_contain( Vout, T[i] ), "T_%d in filter", i );
+      iarcvector.GetArcCell( dyn, Vout, T[i], &arc_cell );
+      TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_SIMPLE_ARC, "T_%d found", i );
+      TEST_ASSERTION( __arcvector_get_vertex( &arc_cell ) == T[i], "head is T_%d", i );
+    }
+    iarcvector.GetArcCell( dyn, Vout, X, &arc_cell );
+    TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_NO_ARCS, "X not found" );
+    // Inarcs of the terminals never reach the threshold
+    TEST_ASSERTION( !__arcvector_cell_has_bloom( _vxvertex__get_vertex_inarcs( T[0] ) ), "T_0 inarcs have no filter" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * MULTIPLE ARC
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Multiple Arc" ) {
+    vgx_Arc_t arc;
+    vgx_ArcVector_cell_t arc_cell;
+    vgx_predicator_val_t val = { .integer = 2 };
+    SET_ARC( &arc, V, X, 200, M_INT, val, VGX_ARCDIR_OUT );
+    TEST_ASSERTION( iarcvector.Add( dyn, &arc, connect_event ) == 1, "Added V-(200)->X" );
+    SET_ARC( &arc, V, X, 201, M_INT, val, VGX_ARCDIR_OUT );
+    TEST_ASSERTION( iarcvector.Add( dyn, &arc, connect_event ) == 1, "Added V-(201)->X" );
+    TEST_ASSERTION( __arcvector_bloom_may_contain( Vout, X ), "X in filter" );
+    iarcvector.GetArcCell( dyn, Vout, X, &arc_cell );
+    TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_MULTIPLE_ARC, "X found as multiple arc" );
+    vgx_ExecutionTimingBudget_t zero_timeout = _vgx_get_zero_execution_timing_budget();
+    TEST_ASSERTION( iarcvector.Remove( dyn, SET_ARC_REL_QUERY( &arc, V, X, VGX_PREDICATOR_REL_WILDCARD, VGX_ARCDIR_OUT ), &zero_timeout, disconnect_REV ) == 2, "Removed V=>X" );
+    iarcvector.GetArcCell( dyn, Vout, X, &arc_cell );
+    TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_NO_ARCS, "X not found" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * REBUILD AFTER HEAVY DELETION
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Rebuild After Removal" ) {
+    vgx_Arc_t arc;
+    vgx_ArcVector_cell_t arc_cell;
+    vgx_ExecutionTimingBudget_t zero_timeout = _vgx_get_zero_execution_timing_budget();
+    int n_remove = __UTEST_BLOOM_N_TERMINALS - __UTEST_BLOOM_MIN_DEGREE;
+    for( int i=0; i<n_remove; i++ ) {
+      TEST_ASSERTION( iarcvector.Remove( dyn, SET_ARC_REL_QUERY( &arc, V, T[i], 101, VGX_ARCDIR_OUT ), &zero_timeout, disconnect_REV ) == 1, "Removed V->T_%d", i );
+      TEST_ASSERTION( __arcvector_cell_has_bloom( Vout ), "filter kept at degree %lld", iarcvector.Degree( Vout ) );
+    }
+    vgx_ArcVector_bloom_t *bloom = __arcvector_as_bloom( Vout );
+    TEST_ASSERTION( bloom->n_removed <= bloom->n_keys / 2, "filter was rebuilt" );
+    for( int i=0; i<__UTEST_BLOOM_N_TERMINALS; i++ ) {
+      iarcvector.GetArcCell( dyn, Vout, T[i], &arc_cell );
+      if( i < n_remove ) {
+        TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_NO_ARCS, "T_%d not found", i );
+      }
+      else {
+        TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_SIMPLE_ARC, "T_%d found", i );
+        TEST_ASSERTION( __arcvector_bloom_may_contain( Vout, T[i] ), "T_%d in filter", i );
+      }
+    }
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * FREEZE AND THAW
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Freeze And Thaw" ) {
+    TEST_ASSERTION( iarcvector.Freeze( dyn, Vout ) == 1, "V outarcs frozen" );
+    TEST_ASSERTION( !__arcvector_cell_has_bloom( Vout ), "no filter when frozen" );
+    TEST_ASSERTION( iarcvector.Thaw( dyn, Vout ) == 1, "V outarcs thawed" );
+    TEST_ASSERTION( __arcvector_cell_has_bloom( Vout ), "filter rebuilt after thaw" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * DETACH BELOW THRESHOLD
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Detach Below Threshold" ) {
+    vgx_Arc_t arc;
+    vgx_ExecutionTimingBudget_t zero_timeout = _vgx_get_zero_execution_timing_budget();
+    int i = __UTEST_BLOOM_N_TERMINALS - __UTEST_BLOOM_MIN_DEGREE;
+    while( iarcvector.Degree( Vout ) >= __UTEST_BLOOM_MIN_DEGREE / 2 ) {
+      TEST_ASSERTION( __arcvector_cell_has_bloom( Vout ), "filter kept at degree %lld", iarcvector.Degree( Vout ) );
+      TEST_ASSERTION( iarcvector.Remove( dyn, SET_ARC_REL_QUERY( &arc, V, T[i], 101, VGX_ARCDIR_OUT ), &zero_timeout, disconnect_REV ) == 1, "Removed V->T_%d", i );
+      ++i;
+    }
+    TEST_ASSERTION( !__arcvector_cell_has_bloom( Vout ), "filter removed at degree %lld", iarcvector.Degree( Vout ) );
+    TEST_ASSERTION( _vxarcvector_bloom__bytes( Vout ) == 0, "no filter bytes" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * CLOSE AND DESTROY ALL THE TEST VERTICES
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Destroy Test Vertices" ) {
+    TEST_ASSERTION( igraph->simple->CloseVertex( graph, &V ) == true, "" );
+    TEST_ASSERTION( igraph->simple->CloseVertex( graph, &X ) == true, "" );
+    for( int i=0; i<__UTEST_BLOOM_N_TERMINALS; i++ ) {
+      TEST_ASSERTION( igraph->simple->CloseVertex( graph, &T[i] ) == true, "" );
+    }
+    igraph->simple->DeleteVertex( graph, CSTR___V, 0, NULL, NULL );
+    igraph->simple->DeleteVertex( graph, CSTR___X, 0, NULL, NULL );
+    for( int i=0; i<__UTEST_BLOOM_N_TERMINALS; i++ ) {
+      igraph->simple->DeleteVertex( graph, CSTR___T[i], 0, NULL, NULL );
+    }
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * DESTROY THE TEST GRAPH
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Destroy Test Graph" ) {
+    CStringDelete( CSTR___V );
+    CStringDelete( CSTR___X );
+    for( int i=0; i<__UTEST_BLOOM_N_TERMINALS; i++ ) {
+      CStringDelete( CSTR___T[i] );
+    }
+    CALLABLE( graph )->advanced->CloseOpenVertices( graph );
+    CALLABLE( graph )->simple->Truncate( graph, NULL );
+    COMLIB_OBJECT_DESTROY(graph);
+  } END_TEST_SCENARIO
+
+  _vxarcvector_bloom__set_min_degree( prev_min_degree );
+
+  CStringDelete( CSTR__graph_name );
+  CStringDelete( CSTR__graph_path );
+
+  __DESTROY_GRAPH_FACTORY( INITIALIZED );
+
+} END_UNIT_TEST
+
+
+#endif
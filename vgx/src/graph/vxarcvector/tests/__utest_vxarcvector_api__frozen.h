@@ -0,0 +1,240 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    __utest_vxarcvector_api__frozen.h
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#ifndef __UTEST_VXARCVECTOR_API__FROZEN_H
+#define __UTEST_VXARCVECTOR_API__FROZEN_H
+
+#include "__vxtest_macro.h"
+
+#define __UTEST_FROZEN_N_TERMINALS 200
+
+BEGIN_UNIT_TEST( __utest_vxarcvector_api__frozen ) {
+
+  const CString_t *CSTR__graph_path = CStringNew( TestName );
+  const CString_t *CSTR__graph_name = CStringNew( "VGX_Graph" );
+
+  TEST_ASSERTION( CSTR__graph_path && CSTR__graph_name, "graph_path and graph_name created" );
+
+  bool INITIALIZED = __INITIALIZE_GRAPH_FACTORY( GetCurrentTestDirectory(), false );
+
+  const CString_t *CSTR___V = NULL;
+  const CString_t *CSTR___X = NULL;
+  const CString_t *CSTR___T[ __UTEST_FROZEN_N_TERMINALS ] = {0};
+
+  vgx_Graph_t *graph = NULL;
+  vgx_Graph_vtable_t *igraph = NULL;
+  framehash_dynamic_t *dyn = NULL;
+  vgx_Vertex_t *V = NULL;
+  vgx_Vertex_t *X = NULL;
+  vgx_Vertex_t *T[ __UTEST_FROZEN_N_TERMINALS ] = {0};
+  vgx_ArcVector_cell_t *Vout = NULL;
+
+  f_Vertex_connect_event connect_event = _vxgraph_arc__connect_WL_reverse_WL;
+  f_Vertex_disconnect_event disconnect_REV = _vxgraph_arc__disconnect_WL_reverse_WL;
+
+  vgx_predicator_mod_t M_INT = { .bits = VGX_PREDICATOR_MOD_INTEGER };
+
+  /*******************************************************************//**
+   * CREATE A TEST GRAPH
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Create Test Graph" ) {
+    vgx_Graph_constructor_args_t graph_args = {
+      .CSTR__graph_path     = CSTR__graph_path,
+      .CSTR__graph_name     = CSTR__graph_name,
+      .vertex_block_order   = 16,
+      .graph_t0             = __SECONDS_SINCE_1970(),
+      .start_opcount        = 1000,
+      .simconfig            = NULL,
+      .with_event_processor = true,
+      .idle_event_processor = false,
+      .force_readonly       = false,
+      .force_writable       = true,
+      .local_only           = true
+    };
+    objectid_t obid = *CStringObid( graph_args.CSTR__graph_name );
+    graph = COMLIB_OBJECT_NEW( vgx_Graph_t, &obid, &graph_args );
+    TEST_ASSERTION( graph != NULL, "graph constructed, graph=%llp", graph );
+    igraph = CALLABLE(graph);
+    dyn = &graph->arcvector_fhdyn;
+
+    CSTR___V = NewEphemeralCString( graph, "V" );
+    CSTR___X = NewEphemeralCString( graph, "X" );
+    for( int i=0; i<__UTEST_FROZEN_N_TERMINALS; i++ ) {
+      char name[32];
+      snprintf( name, 31, "T_%d", i );
+      CSTR___T[i] = NewEphemeralCString( graph, name );
+    }
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * CONNECT V TO ALL TERMINALS
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Connect Vertices" ) {
+    vgx_Arc_t arc;
+
+    TEST_ASSERTION( (V = igraph->simple->OpenVertex( graph, CSTR___V, VGX_VERTEX_ACCESS_WRITABLE, 0, NULL, NULL )) != NULL, "Acquired V" );
+    TEST_ASSERTION( (X = igraph->simple->OpenVertex( graph, CSTR___X, VGX_VERTEX_ACCESS_WRITABLE, 0, NULL, NULL )) != NULL, "Acquired X" );
+    Vout = _vxvertex__get_vertex_outarcs( V );
+
+    for( int i=0; i<__UTEST_FROZEN_N_TERMINALS; i++ ) {
+      TEST_ASSERTION( (T[i] = igraph->simple->OpenVertex( graph, CSTR___T[i], VGX_VERTEX_ACCESS_WRITABLE, 0, NULL, NULL )) != NULL, "Acquired T_%d", i );
+      vgx_predicator_val_t val = { .integer = 1000 + 7*i };
+      SET_ARC( &arc, V, T[i], 101 + (i % 3), M_INT, val, VGX_ARCDIR_OUT );
+      TEST_ASSERTION( iarcvector.Add( dyn, &arc, connect_event ) == 1, "Added V-(%d)->T_%d", 101 + (i % 3), i );
+    }
+
+    TEST_ASSERTION( iarcvector.CellType( Vout ) == VGX_ARCVECTOR_ARRAY_OF_ARCS, "V has array of arcs" );
+    TEST_ASSERTION( iarcvector.Degree( Vout ) == __UTEST_FROZEN_N_TERMINALS, "V has %d outarcs", __UTEST_FROZEN_N_TERMINALS );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * FREEZE
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Freeze" ) {
+    // Not eligible: simple arc
+    TEST_ASSERTION( iarcvector.Freeze( dyn, _vxvertex__get_vertex_inarcs( T[0] ) ) == 0, "simple arc not frozen" );
+
+    TEST_ASSERTION( iarcvector.FrozenBytes( Vout ) == 0, "no frozen bytes before freeze" );
+    TEST_ASSERTION( iarcvector.Freeze( dyn, Vout ) == 1, "V outarcs frozen" );
+    TEST_ASSERTION( iarcvector.CellType( Vout ) == VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS, "V has frozen array of arcs" );
+    TEST_ASSERTION( iarcvector.Degree( Vout ) == __UTEST_FROZEN_N_TERMINALS, "V still has %d outarcs", __UTEST_FROZEN_N_TERMINALS );
+    TEST_ASSERTION( iarcvector.FrozenBytes( Vout ) > 0, "frozen bytes reported" );
+    TEST_ASSERTION( iarcvector.Freeze( dyn, Vout ) == 0, "already frozen" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * LOOKUP IN FROZEN ARRAY
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Frozen Lookup" ) {
+    vgx_ArcVector_cell_t arc_cell;
+    for( int i=0; i<__UTEST_FROZEN_N_TERMINALS; i++ ) {
+      TEST_ASSERTION( iarcvector.GetArcCell( dyn, Vout, T[i], &arc_cell ) == &arc_cell, "T_%d found", i );
+      TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_SIMPLE_ARC, "simple arc cell" );
+      TEST_ASSERTION( __arcvector_get_vertex( &arc_cell ) == T[i], "head is T_%d", i );
+      vgx_predicator_t pred = { .data = __arcvector_as_predicator_bits( &arc_cell ) };
+      TEST_ASSERTION( pred.rel.enc == 101 + (i % 3), "relationship preserved" );
+      TEST_ASSERTION( pred.mod.bits == VGX_PREDICATOR_MOD_INTEGER, "modifier preserved" );
+      TEST_ASSERTION( pred.val.integer == 1000 + 7*i, "value preserved" );
+    }
+    // Not connected
+    TEST_ASSERTION( iarcvector.GetArcCell( dyn, Vout, X, &arc_cell ) == &arc_cell, "" );
+    TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_NO_ARCS, "X not found" );
+    TEST_ASSERTION( iarcvector.GetArcCell( dyn, Vout, V, &arc_cell ) == &arc_cell, "" );
+    TEST_ASSERTION( __arcvector_cell_type( &arc_cell ) == VGX_ARCVECTOR_NO_ARCS, "V not found" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * ADD THAWS
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Add Thaws" ) {
+    vgx_Arc_t arc;
+    vgx_ArcVector_cell_t arc_cell;
+    vgx_predicator_val_t val = { .integer = 1 };
+    SET_ARC( &arc, V, X, 101, M_INT, val, VGX_ARCDIR_OUT );
+    TEST_ASSERTION( iarcvector.Add( dyn, &arc, connect_event ) == 1, "Added V-(101)->X" );
+    TEST_ASSERTION( iarcvector.CellType( Vout ) == VGX_ARCVECTOR_ARRAY_OF_ARCS, "V thawed" );
+    TEST_ASSERTION( iarcvector.Degree( Vout ) == __UTEST_FROZEN_N_TERMINALS + 1, "V has %d outarcs", __UTEST_FROZEN_N_TERMINALS + 1 );
+    for( int i=0; i<__UTEST_FROZEN_N_TERMINALS; i++ ) {
+      iarcvector.GetArcCell( dyn, Vout, T[i], &arc_cell );
+      vgx_predicator_t pred = { .data = __arcvector_as_predicator_bits( &arc_cell ) };
+      TEST_ASSERTION( __arcvector_get_vertex( &arc_cell ) == T[i] && pred.val.integer == 1000 + 7*i, "T_%d intact after thaw", i );
+    }
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * REMOVE THAWS
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Remove Thaws" ) {
+    vgx_Arc_t arc;
+    vgx_ExecutionTimingBudget_t zero_timeout = _vgx_get_zero_execution_timing_budget();
+    TEST_ASSERTION( iarcvector.Freeze( dyn, Vout ) == 1, "V outarcs frozen again" );
+    TEST_ASSERTION( iarcvector.Remove( dyn, SET_ARC_REL_QUERY( &arc, V, X, 101, VGX_ARCDIR_OUT ), &zero_timeout, disconnect_REV ) == 1, "Removed V-(101)->X" );
+    TEST_ASSERTION( iarcvector.CellType( Vout ) == VGX_ARCVECTOR_ARRAY_OF_ARCS, "V thawed" );
+    TEST_ASSERTION( iarcvector.Degree( Vout ) == __UTEST_FROZEN_N_TERMINALS, "V has %d outarcs", __UTEST_FROZEN_N_TERMINALS );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * MULTIPLE ARCS ARE NOT FROZEN
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Multiple Arcs Not Frozen" ) {
+    vgx_Arc_t arc;
+    vgx_predicator_val_t val = { .integer = 2 };
+    SET_ARC( &arc, V, T[0], 200, M_INT, val, VGX_ARCDIR_OUT );
+    TEST_ASSERTION( iarcvector.Add( dyn, &arc, connect_event ) == 1, "Added V-(200)->T_0" );
+    TEST_ASSERTION( iarcvector.Freeze( dyn, Vout ) == 0, "V outarcs not frozen" );
+    TEST_ASSERTION( iarcvector.CellType( Vout ) == VGX_ARCVECTOR_ARRAY_OF_ARCS, "V has array of arcs" );
+    TEST_ASSERTION( iarcvector.Thaw( dyn, Vout ) == 0, "nothing to thaw" );
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * CLOSE AND DESTROY ALL THE TEST VERTICES
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Destroy Test Vertices" ) {
+    TEST_ASSERTION( iarcvector.Freeze( dyn, Vout ) == 0, "" );
+    TEST_ASSERTION( igraph->simple->CloseVertex( graph, &V ) == true, "" );
+    TEST_ASSERTION( igraph->simple->CloseVertex( graph, &X ) == true, "" );
+    for( int i=0; i<__UTEST_FROZEN_N_TERMINALS; i++ ) {
+      TEST_ASSERTION( igraph->simple->CloseVertex( graph, &T[i] ) == true, "" );
+    }
+    igraph->simple->DeleteVertex( graph, CSTR___V, 0, NULL, NULL );
+    igraph->simple->DeleteVertex( graph, CSTR___X, 0, NULL, NULL );
+    for( int i=0; i<__UTEST_FROZEN_N_TERMINALS; i++ ) {
+      igraph->simple->DeleteVertex( graph, CSTR___T[i], 0, NULL, NULL );
+    }
+  } END_TEST_SCENARIO
+
+  /*******************************************************************//**
+   * DESTROY THE TEST GRAPH
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Destroy Test Graph" ) {
+    CStringDelete( CSTR___V );
+    CStringDelete( CSTR___X );
+    for( int i=0; i<__UTEST_FROZEN_N_TERMINALS; i++ ) {
+      CStringDelete( CSTR___T[i] );
+    }
+    CALLABLE( graph )->advanced->CloseOpenVertices( graph );
+    CALLABLE( graph )->simple->Truncate( graph, NULL );
+    COMLIB_OBJECT_DESTROY(graph);
+  } END_TEST_SCENARIO
+
+
+  CStringDelete( CSTR__graph_name );
+  CStringDelete( CSTR__graph_path );
+
+  __DESTROY_GRAPH_FACTORY( INITIALIZED );
+
+} END_UNIT_TEST
+
+
+#endif
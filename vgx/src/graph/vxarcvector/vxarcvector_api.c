@@ -36,6 +36,9 @@ static int64_t __api_arcvector_degree( const vgx_ArcVector_cell_t *V );
 static int     __api_arcvector_add_arc( framehash_dynamic_t *dynamic, vgx_Arc_t *arc, f_Vertex_connect_event connect_event );
 static int64_t __api_arcvector_remove_arc( framehash_dynamic_t *dynamic, vgx_Arc_t *arc, vgx_ExecutionTimingBudget_t *timing_budget, f_Vertex_disconnect_event disconnect );
 static int64_t __api_arcvector_expire_arcs( framehash_dynamic_t *dynamic, vgx_Vertex_t *vertex_WL, uint32_t now_ts, uint32_t *next_ts );
+#define        __api_arcvector_freeze _vxarcvector_frozen__freeze
+#define        __api_arcvector_thaw _vxarcvector_frozen__thaw
+#define        __api_arcvector_frozen_bytes _vxarcvector_frozen__bytes
 #define        __api_arcvector_get_arc_cell _vxarcvector_fhash__get_arc_cell
 static vgx_predicator_t __api_arcvector_get_arc_value( framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, vgx_ArcHead_t *arc_head );
 static vgx_ArcFilter_match __api_arcvector_get_arcs( const vgx_ArcVector_cell_t *V, vgx_neighborhood_probe_t *neighborhood_probe );
@@ -44,6 +47,7 @@ static vgx_ArcFilter_match __api_arcvector_get_vertices( const vgx_ArcVector_cel
 static vgx_ArcFilter_match __api_arcvector_get_vertices_bidirectional( const vgx_ArcVector_cell_t *V_IN, const vgx_ArcVector_cell_t *V_OUT, vgx_neighborhood_probe_t *neighborhood_probe );
 static vgx_ArcFilter_match __api_arcvector_has_arc( const vgx_ArcVector_cell_t *V, vgx_recursive_probe_t *recursive, vgx_neighborhood_probe_t *neighborhood_probe, vgx_Arc_t *first_match );
 static vgx_ArcFilter_match __api_arcvector_has_arc_bidirectional( const vgx_ArcVector_cell_t *V_IN, const vgx_ArcVector_cell_t *V_OUT, vgx_neighborhood_probe_t *neighborhood_probe );
+static int64_t __api_arcvector_visit( vgx_Vertex_t *tail_RO, const vgx_ArcVector_cell_t *V, vgx_virtual_ArcFilter_context_t *filter, f_vgx_ArcVisitor visitor, void *context );
 static int64_t __api_arcvector_serialize( const vgx_ArcVector_cell_t *V, CQwordQueue_t *output );
 static int64_t __api_arcvector_deserialize( vgx_Vertex_t *tail, framehash_dynamic_t *dynamic, cxmalloc_family_t *vertex_allocator, vgx_ArcVector_cell_t *V, CQwordQueue_t *input );
 static void    __api_arcvector_print_debug_dump( const vgx_ArcVector_cell_t *V, const char *message );
@@ -57,6 +61,9 @@ DLL_EXPORT vgx_IArcVector_t iarcvector = {
   .Add                      = __api_arcvector_add_arc,
   .Remove                   = __api_arcvector_remove_arc,
   .Expire                   = __api_arcvector_expire_arcs,
+  .Freeze                   = __api_arcvector_freeze,
+  .Thaw                     = __api_arcvector_thaw,
+  .FrozenBytes              = __api_arcvector_frozen_bytes,
   .GetArcCell               = __api_arcvector_get_arc_cell,
   .GetArcValue              = __api_arcvector_get_arc_value,
   .GetArcs                  = __api_arcvector_get_arcs,
@@ -65,6 +72,7 @@ DLL_EXPORT vgx_IArcVector_t iarcvector = {
   .GetVerticesBidirectional = __api_arcvector_get_vertices_bidirectional,
   .HasArc                   = __api_arcvector_has_arc,
   .HasArcBidirectional      = __api_arcvector_has_arc_bidirectional,
+  .Visit                    = __api_arcvector_visit,
   .Serialize                = __api_arcvector_serialize,
   .Deserialize              = __api_arcvector_deserialize,
   .PrintDebugDump           = __api_arcvector_print_debug_dump
@@ -136,6 +144,11 @@ static int __api_arcvector_add_arc( framehash_dynamic_t *dynamic, vgx_Arc_t *arc
         return __ARCVECTOR_ERROR( arc, NULL, NULL, NULL );
       }
       
+      // Frozen array of arcs must be thawed before modification
+      if( __arcvector_cell_is_frozen( V ) && _vxarcvector_frozen__thaw( dynamic, V ) < 0 ) {
+        return __ARCVECTOR_ERROR( arc, NULL, V, NULL );
+      }
+
 #ifndef NDEBUG
       vgx_Vertex_t *tail = arc->tail;
       int64_t refcnt_pre = Vertex_REFCNT_WL( tail );
@@ -299,6 +312,12 @@ static int64_t __api_arcvector_remove_arc( framehash_dynamic_t *dynamic, vgx_Arc
 
   __assert_inarcs_stable( vertex );
 
+  // Frozen array of arcs must be thawed before modification
+  if( __arcvector_cell_is_frozen( V ) && _vxarcvector_frozen__thaw( dynamic, V ) < 0 ) {
+    timing_budget->reason = VGX_ACCESS_REASON_VERTEX_ARC_ERROR;
+    return -1;
+  }
+
   switch( __arcvector_cell_type( V ) ) {
 
   // No arcs exist, so no arcs removed
@@ -314,6 +333,10 @@ static int64_t __api_arcvector_remove_arc( framehash_dynamic_t *dynamic, vgx_Arc
   case VGX_ARCVECTOR_ARRAY_OF_ARCS:
     // Disconnect
     del = _vxarcvector_dispatch__array_remove( dynamic, V, probe, timing_budget, disconnect_event, &n_removed );
+    // Keep Bloom filter up to date
+    if( n_removed > 0 ) {
+      _vxarcvector_bloom__removed( dynamic, V, n_removed );
+    }
     break;
 
   // Indegree Counter - no action
@@ -385,6 +408,11 @@ static int64_t __api_arcvector_expire_arcs( framehash_dynamic_t *dynamic, vgx_Ve
   vgx_predicator_t pred;
   uint32_t arc_min_tmx = TIME_EXPIRES_NEVER;
 
+  // Frozen array of arcs must be thawed before modification
+  if( __arcvector_cell_is_frozen( V ) && _vxarcvector_frozen__thaw( dynamic, V ) < 0 ) {
+    return __ARCVECTOR_ERROR( NULL, vertex_WL, V, NULL );
+  }
+
   switch( __arcvector_cell_type( V ) ) {
 
   // No arcs exist, so no arcs removed
@@ -424,6 +452,10 @@ static int64_t __api_arcvector_expire_arcs( framehash_dynamic_t *dynamic, vgx_Ve
   // Remove matching arc from array of arcs
   case VGX_ARCVECTOR_ARRAY_OF_ARCS:
     _vxarcvector_expire__expire_arcs( dynamic, V, vertex_WL, now_ts, &arc_min_tmx, &n_expired );
+    // Keep Bloom filter up to date
+    if( n_expired > 0 ) {
+      _vxarcvector_bloom__removed( dynamic, V, n_expired );
+    }
     break;
 
   case VGX_ARCVECTOR_INDEGREE_COUNTER_ONLY:
@@ -488,6 +520,9 @@ static vgx_predicator_t __api_arcvector_get_arc_value( framehash_dynamic_t *dyna
 
   // GREEN: Array of arcs
   case VGX_ARCVECTOR_ARRAY_OF_ARCS:
+    /* FALLTHRU */
+  // ICE: Frozen array of arcs
+  case VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS:
     _vxarcvector_dispatch__get_arc( dynamic, V, arc_head, &match );
     break;
 
@@ -587,6 +622,7 @@ static vgx_ArcFilter_match __api_arcvector_get_arcs( const vgx_ArcVector_cell_t
     return __arcfilter_THRU( recursive, filter_match );
   }
   // GREEN: Array of arcs
+  // ICE: Frozen array of arcs
   else {
     return _vxarcvector_traverse__traverse_arcarray( V, neighborhood_probe );
   }
@@ -716,6 +752,9 @@ static vgx_ArcFilter_match __api_arcvector_get_arcs_bidirectional( const vgx_Arc
 
     // GREEN: First arcvector Array of arcs
     case VGX_ARCVECTOR_ARRAY_OF_ARCS:
+      /* FALLTHRU */
+    // ICE: First arcvector Frozen array of arcs
+    case VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS:
       filter_match = _vxarcvector_traverse__traverse_arcarray_bidirectional( V1, V2, neighborhood_probe );
       break;
 
@@ -799,7 +838,8 @@ static vgx_ArcFilter_match __api_arcvector_get_vertices( const vgx_ArcVector_cel
     return __arcfilter_THRU( recursive, filter_match );
   }
   // GREEN: Array of arcs
-  else if( ctype == VGX_ARCVECTOR_ARRAY_OF_ARCS ) {
+  // ICE: Frozen array of arcs
+  else if( ctype == VGX_ARCVECTOR_ARRAY_OF_ARCS || ctype == VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS ) {
     __begin_lockable_arc_context( LARC, VGX_ARCVECTOR_ARRAY_OF_ARCS, readonly, neighborhood_probe->current_tail_RO, VGX_PREDICATOR_NONE, neighborhood_probe->current_tail_RO, traverse_filter->timing_budget, &filter_match ) {
       const vgx_virtual_ArcFilter_context_t *previous = traverse_filter->previous_context ? traverse_filter->previous_context : traverse_filter;
       vgx_Vector_t *vector = __simprobe_vector( recursive->vertex_probe );
@@ -908,6 +948,9 @@ static vgx_ArcFilter_match __api_arcvector_get_vertices_bidirectional( const vgx
 
     // GREEN: First arcvector Array of arcs
     case VGX_ARCVECTOR_ARRAY_OF_ARCS:
+      /* FALLTHRU */
+    // ICE: First arcvector Frozen array of arcs
+    case VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS:
       __begin_lockable_arc_context( LARC, VGX_ARCVECTOR_ARRAY_OF_ARCS, readonly, neighborhood_probe->current_tail_RO, VGX_PREDICATOR_NONE, neighborhood_probe->current_tail_RO, traverse_filter->timing_budget, &filter_match ) {
         const vgx_virtual_ArcFilter_context_t *previous = traverse_filter->previous_context ? traverse_filter->previous_context : traverse_filter;
         vgx_Vector_t *vector = __simprobe_vector( recursive->vertex_probe );
@@ -980,7 +1023,8 @@ static vgx_ArcFilter_match __api_arcvector_has_arc( const vgx_ArcVector_cell_t *
     return __arcfilter_MISS( recursive );
   }
   // GREEN: Array of arcs
-  else if( ctype == VGX_ARCVECTOR_ARRAY_OF_ARCS ) {
+  // ICE: Frozen array of arcs
+  else if( ctype == VGX_ARCVECTOR_ARRAY_OF_ARCS || ctype == VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS ) {
     return _vxarcvector_exists__has_arc( V, recursive, neighborhood_probe, first_match ); // first_match gets populated if hit
   }
 
@@ -1089,6 +1133,172 @@ static vgx_ArcFilter_match __api_arcvector_has_arc_bidirectional( const vgx_ArcV
 
 
 
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+typedef struct s___arcvector_visit_context_t {
+  vgx_Vertex_t *tail;
+  vgx_Vertex_t *head;
+  vgx_virtual_ArcFilter_context_t *filter;
+  f_vgx_ArcVisitor visitor;
+  void *context;
+  int64_t n_visited;
+  bool stopped;
+} __arcvector_visit_context_t;
+
+
+
+/*******************************************************************//**
+ * Pass one arc through the filter and on to the visitor.
+ * Returns 0 to continue, 1 to stop, -1 on error
+ ***********************************************************************
+ */
+static int __visit_arc( __arcvector_visit_context_t *visit, vgx_Vertex_t *head, vgx_predicator_t predicator ) {
+  vgx_LockableArc_t larc = VGX_LOCKABLE_ARC_INIT( visit->tail, 0, predicator, head, 0 );
+  if( visit->filter ) {
+    vgx_ArcFilter_match match = VGX_ARC_FILTER_MATCH_MISS;
+    if( !visit->filter->filter( visit->filter, &larc, &match ) ) {
+      return __is_arcfilter_error( match ) ? -1 : 0;
+    }
+  }
+  int ret = visit->visitor( visit->context, (vgx_Arc_t*)&larc );
+  if( ret < 0 ) {
+    return -1;
+  }
+  visit->n_visited++;
+  if( ret > 0 ) {
+    visit->stopped = true;
+    return 1;
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+static int64_t __visit_predicator( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell ) {
+  __arcvector_visit_context_t *visit = (__arcvector_visit_context_t*)processor->processor.output;
+  vgx_predicator_t predicator = { .data = APTR_AS_UNSIGNED( fh_cell ) };
+  int ret = __visit_arc( visit, visit->head, predicator );
+  if( ret > 0 ) {
+    FRAMEHASH_PROCESSOR_SET_COMPLETED( processor );
+  }
+  return ret < 0 ? -1 : 0;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+static int64_t __visit_arcarray_cell( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell ) {
+  __arcvector_visit_context_t *visit = (__arcvector_visit_context_t*)processor->processor.output;
+  vgx_Vertex_t *vertex = (vgx_Vertex_t*)fh_cell->annotation;
+  int ret;
+
+  switch( APTR_AS_DTYPE( fh_cell ) ) {
+  // Multiple Arc: visit all predicators in the secondary framehash
+  case TAGGED_DTYPE_PTR56:
+    {
+      vgx_ArcVector_cell_t arc_cell;
+      framehash_cell_t eph_top;
+      __arcvector_cell_set_multiple_arc( &arc_cell, vertex, (framehash_cell_t*)APTR_GET_PTR56( fh_cell ) );
+      __arcvector_set_ephemeral_top( &arc_cell, &eph_top );
+      framehash_processing_context_t visit_predicator = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top, NULL, __visit_predicator );
+      FRAMEHASH_PROCESSOR_SET_IO( &visit_predicator, NULL, visit );
+      visit->head = vertex;
+      if( iFramehash.processing.ProcessNolock( &visit_predicator ) < 0 ) {
+        return -1;
+      }
+      FRAMEHASH_PROCESSOR_INHERIT_COMPLETION( processor, &visit_predicator );
+      return 0;
+    }
+  // Simple Arc
+  case TAGGED_DTYPE_UINT56:
+    {
+      vgx_predicator_t predicator = { .data = APTR_AS_UNSIGNED( fh_cell ) };
+      if( (ret = __visit_arc( visit, vertex, predicator )) > 0 ) {
+        FRAMEHASH_PROCESSOR_SET_COMPLETED( processor );
+      }
+      return ret < 0 ? -1 : 0;
+    }
+  default:
+    FRAMEHASH_PROCESSOR_SET_FAILED( processor );
+    return __ARCVECTOR_ERROR( NULL, vertex, NULL, NULL );
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Call visitor for every arc in arcvector accepted by filter (if any),
+ * until the visitor requests a stop.
+ *
+ * Returns the number of arcs passed to the visitor, or -1 on error.
+ ***********************************************************************
+ */
+static int64_t __api_arcvector_visit( vgx_Vertex_t *tail_RO, const vgx_ArcVector_cell_t *V, vgx_virtual_ArcFilter_context_t *filter, f_vgx_ArcVisitor visitor, void *context ) {
+  __arcvector_visit_context_t visit = {
+    .tail       = tail_RO,
+    .head       = NULL,
+    .filter     = filter,
+    .visitor    = visitor,
+    .context    = context,
+    .n_visited  = 0,
+    .stopped    = false
+  };
+
+  if( filter ) {
+    filter->current_tail = tail_RO;
+  }
+
+  switch( __arcvector_cell_type( V ) ) {
+  // WHITE: Empty
+  // GRAY: Indegree Counter
+  case VGX_ARCVECTOR_NO_ARCS:
+  case VGX_ARCVECTOR_INDEGREE_COUNTER_ONLY:
+    return 0;
+
+  // BLUE: Simple arc
+  case VGX_ARCVECTOR_SIMPLE_ARC:
+    {
+      vgx_ArcHead_t archead = __arcvector_init_archead_from_cell( V );
+      if( __visit_arc( &visit, archead.vertex, archead.predicator ) < 0 ) {
+        return -1;
+      }
+      return visit.n_visited;
+    }
+
+  // GREEN: Array of arcs
+  // ICE: Frozen array of arcs
+  case VGX_ARCVECTOR_ARRAY_OF_ARCS:
+  case VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS:
+    {
+      framehash_cell_t eph_top;
+      __arcvector_set_ephemeral_top( V, &eph_top );
+      framehash_processing_context_t visit_arc = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top, NULL, __visit_arcarray_cell );
+      FRAMEHASH_PROCESSOR_SET_IO( &visit_arc, NULL, &visit );
+      if( __arcvector_process_arcarray( V, &visit_arc ) < 0 ) {
+        return -1;
+      }
+      return visit.n_visited;
+    }
+
+  default:
+    return __ARCVECTOR_ERROR( NULL, NULL, V, NULL );
+  }
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -1287,12 +1497,16 @@ DLL_HIDDEN int __arcvector_error( const char *funcname, int line, const vgx_Arc_
 #include "tests/__utest_vxarcvector_api__basic_get.h"
 #include "tests/__utest_vxarcvector_api__complete_add_remove.h"
 #include "tests/__utest_vxarcvector_api__chaotic_add_remove.h" 
+#include "tests/__utest_vxarcvector_api__frozen.h"
+#include "tests/__utest_vxarcvector_api__bloom.h"
 
 
 test_descriptor_t _vgx_vxarcvector_api_tests[] = {
   { "VGX Arcvector API Test",   __utest_vxarcvector_api },
   { "Basic Add/Remove",         __utest_vxarcvector_api__basic_add_remove },
   { "Basic Get",                __utest_vxarcvector_api__basic_get },
+  { "Frozen Array of Arcs",     __utest_vxarcvector_api__frozen },
+  { "Bloom Filter",             __utest_vxarcvector_api__bloom },
   { "Advanced Add/Remove",      __utest_vxarcvector_api__advanced_add_remove },
   { "Complete Add/Remove",      __utest_vxarcvector_api__complete_add_remove },
   { "Chaotic Add/Remove",       __utest_vxarcvector_api__chaotic_add_remove },
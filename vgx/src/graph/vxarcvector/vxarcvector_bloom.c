@@ -0,0 +1,278 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    vxarcvector_bloom.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#include "_vxarcvector.h"
+
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
+
+
+
+/*******************************************************************//**
+ *
+ * ==== BLOOM FILTER FOR ARRAY OF ARCS ====
+ *
+ * Arrays of arcs with degree at or above a threshold carry a blocked
+ * Bloom filter over their head vertices. Lookups of a specific head that
+ * is not in the array are answered from a single cacheline instead of
+ * walking the framehash frames.
+ *
+ * The filter is attached by swapping the array's FxP frame pointer for a
+ * pointer to the filter (tag BLOOM). The filter holds the frametop, and
+ * all framehash access resolves the frametop through it.
+ *
+ * Arcs added to the array are added to the filter. Removed arcs cannot be
+ * cleared from the filter, so removals are counted and the filter is
+ * rebuilt from the framehash once enough removals have accumulated. The
+ * filter is also rebuilt when it fills up, and dropped when the degree
+ * falls well below the threshold. Filters are never persisted. They are
+ * rebuilt when arcs are restored.
+ *
+ ***********************************************************************
+ */
+
+
+
+#ifndef VGX_ARCVECTOR_BLOOM_MIN_DEGREE
+#define VGX_ARCVECTOR_BLOOM_MIN_DEGREE  256   /* 0 disables Bloom filters */
+#endif
+
+#define __BLOOM_BITS_PER_KEY            16
+#define __BLOOM_KEYS_PER_BLOCK          ((int64_t)(sizeof( cacheline_t ) * 8 / __BLOOM_BITS_PER_KEY))
+
+
+
+static int64_t g_min_degree = VGX_ARCVECTOR_BLOOM_MIN_DEGREE;
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static cacheline_t * __bloom_blocks( vgx_ArcVector_bloom_t *bloom ) {
+  return (cacheline_t*)(bloom + 1);
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static void __bloom_add_key( vgx_ArcVector_bloom_t *bloom, QWORD key ) {
+  uint64_t h = ihash64( key );
+  uint64_t *q = __bloom_blocks( bloom )[ h & bloom->mask ].qwords;
+  uint64_t b[4];
+  __arcvector_bloom_bits( h, b );
+  for( int i=0; i<4; i++ ) {
+    q[ b[i] >> 6 ] |= 1ULL << (b[i] & 63);
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __bloom_add_arc( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell ) {
+  vgx_ArcVector_bloom_t *bloom = (vgx_ArcVector_bloom_t*)processor->processor.output;
+  __bloom_add_key( bloom, APTR_AS_ANNOTATION( fh_cell ) );
+  bloom->n_keys++;
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ * Remove the Bloom filter from V and restore the plain frame pointer.
+ *
+ ***********************************************************************
+ */
+static void __bloom_detach( vgx_ArcVector_cell_t *V ) {
+  vgx_ArcVector_bloom_t *bloom = __arcvector_as_bloom( V );
+  framehash_cell_t *frametop = bloom->frametop;
+  ALIGNED_FREE( bloom );
+  TPTR_SET_POINTER_AND_TAG( &V->FxP, frametop, VGX_ARCVECTOR_FxP_FRAME );
+}
+
+
+
+/*******************************************************************//**
+ * Set the degree at which arrays of arcs get a Bloom filter. Zero disables
+ * new filters. Existing filters are adjusted the next time their array
+ * is modified.
+ *
+ * Returns the previous setting.
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxarcvector_bloom__set_min_degree( int64_t min_degree ) {
+  int64_t prev = g_min_degree;
+  g_min_degree = min_degree > 0 ? min_degree : 0;
+  return prev;
+}
+
+
+
+/*******************************************************************//**
+ * Build a new Bloom filter for array of arcs V from its current arcs,
+ * replacing any existing filter. If V is below the degree threshold any
+ * existing filter is removed and no new filter is built.
+ *
+ * Returns:  1 : V has a new Bloom filter
+ *           0 : V has no Bloom filter
+ *          -1 : error, V has no Bloom filter
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxarcvector_bloom__rebuild( framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V ) {
+  if( __arcvector_cell_type( V ) != VGX_ARCVECTOR_ARRAY_OF_ARCS ) {
+    return 0;
+  }
+
+  if( __arcvector_cell_has_bloom( V ) ) {
+    __bloom_detach( V );
+  }
+
+  int64_t degree = __arcvector_get_degree( V );
+  if( g_min_degree == 0 || degree < g_min_degree ) {
+    return 0;
+  }
+
+  // Size for twice the current degree, power of 2 number of blocks
+  int64_t n_blocks = 1;
+  while( n_blocks * __BLOOM_KEYS_PER_BLOCK < 2 * degree ) {
+    n_blocks <<= 1;
+  }
+
+  vgx_ArcVector_bloom_t *bloom = NULL;
+  if( CALIGNED_ARRAY( bloom, vgx_ArcVector_bloom_t, 1 + n_blocks ) == NULL ) {
+    return -1;
+  }
+  memset( bloom, 0, sizeof( vgx_ArcVector_bloom_t ) * (1 + n_blocks) );
+  bloom->frametop = __arcvector_as_frametop( V );
+  bloom->capacity = n_blocks * __BLOOM_KEYS_PER_BLOCK;
+  bloom->mask = n_blocks - 1;
+
+  // Add all heads
+  framehash_cell_t eph_top;
+  __arcvector_set_ephemeral_top( V, &eph_top );
+  framehash_processing_context_t add_arcs = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top, dynamic, __bloom_add_arc );
+  FRAMEHASH_PROCESSOR_SET_IO( &add_arcs, NULL, bloom );
+  if( iFramehash.processing.ProcessNolock( &add_arcs ) < 0 ) {
+    ALIGNED_FREE( bloom );
+    return -1;
+  }
+
+  TPTR_SET_POINTER_AND_TAG( &V->FxP, bloom, VGX_ARCVECTOR_FxP_BLOOM );
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ * Register arc to head added to array of arcs V. The filter is created
+ * when V reaches the degree threshold and rebuilt when it fills up.
+ *
+ * Returns:  1 : V has a Bloom filter
+ *           0 : V has no Bloom filter
+ *          -1 : error, V has no Bloom filter
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxarcvector_bloom__added( framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, const vgx_Vertex_t *head ) {
+  if( __arcvector_cell_has_bloom( V ) ) {
+    vgx_ArcVector_bloom_t *bloom = __arcvector_as_bloom( V );
+    if( bloom->n_keys < bloom->capacity ) {
+      __bloom_add_key( bloom, (QWORD)head );
+      bloom->n_keys++;
+      return 1;
+    }
+    return _vxarcvector_bloom__rebuild( dynamic, V );
+  }
+  else if( g_min_degree > 0 && __arcvector_get_degree( V ) >= g_min_degree ) {
+    return _vxarcvector_bloom__rebuild( dynamic, V );
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Register n_removed arcs removed from array of arcs V. The filter is
+ * rebuilt after heavy deletion and dropped when V's degree falls below
+ * half the threshold.
+ *
+ * Returns:  1 : V has a Bloom filter
+ *           0 : V has no Bloom filter
+ *          -1 : error, V has no Bloom filter
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxarcvector_bloom__removed( framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, int64_t n_removed ) {
+  if( !__arcvector_cell_has_bloom( V ) ) {
+    return 0;
+  }
+  vgx_ArcVector_bloom_t *bloom = __arcvector_as_bloom( V );
+  bloom->n_removed += n_removed;
+  if( g_min_degree == 0 || __arcvector_get_degree( V ) < g_min_degree / 2 ) {
+    __bloom_detach( V );
+    return 0;
+  }
+  if( bloom->n_removed > bloom->n_keys / 2 ) {
+    return _vxarcvector_bloom__rebuild( dynamic, V );
+  }
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ * Free V's Bloom filter, if any. V's FxP is left dangling and must be
+ * overwritten by the caller.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void _vxarcvector_bloom__discard( const vgx_ArcVector_cell_t *V ) {
+  if( __arcvector_cell_has_bloom( V ) ) {
+    vgx_ArcVector_bloom_t *bloom = __arcvector_as_bloom( V );
+    ALIGNED_FREE( bloom );
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxarcvector_bloom__bytes( const vgx_ArcVector_cell_t *V ) {
+  if( __arcvector_cell_has_bloom( V ) ) {
+    const vgx_ArcVector_bloom_t *bloom = __arcvector_as_bloom( V );
+    return (int64_t)(sizeof( vgx_ArcVector_bloom_t ) + (bloom->mask + 1) * sizeof( cacheline_t ));
+  }
+  return 0;
+}
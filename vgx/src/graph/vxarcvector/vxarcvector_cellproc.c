@@ -283,7 +283,13 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_cellproc__collect_vertices( const vg
   framehash_processing_context_t collect_as_vertex = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top, NULL, __collect_as_vertex );
   FRAMEHASH_PROCESSOR_SET_IO( &collect_as_vertex, neighborhood_probe, &at_least_one_match );
 
-  if( iFramehash.processing.ProcessNolock( &collect_as_vertex ) < 0 ) {
+  // Planned execution: only arcs to candidate heads
+  if( neighborhood_probe->candidates.heads ) {
+    if( __arcvector_process_arcarray_heads( &neighborhood_probe->graph->arcvector_fhdyn, V, &collect_as_vertex, neighborhood_probe->candidates.heads, neighborhood_probe->candidates.n, neighborhood_probe->candidates.merge ) < 0 ) {
+      return __arcfilter_error();
+    }
+  }
+  else if( __arcvector_process_arcarray( V, &collect_as_vertex ) < 0 ) {
     return __arcfilter_error();
   }
 
@@ -408,7 +414,7 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_cellproc__collect_vertices_bidirecti
   framehash_processing_context_t collect_as_vertex_bidirectional = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top_V1, NULL, __collect_as_vertex_bidirectional );
   FRAMEHASH_PROCESSOR_SET_IO( &collect_as_vertex_bidirectional, &cell_filter, neighborhood_probe );
 
-  int64_t n_proc = iFramehash.processing.ProcessNolock( &collect_as_vertex_bidirectional );
+  int64_t n_proc = __arcvector_process_arcarray( V1, &collect_as_vertex_bidirectional );
   iArcFilter.Delete( &cell_filter.filter );
   if( n_proc < 0 || __is_arcfilter_error( cell_filter.match ) ) {
     return __arcfilter_error();
@@ -503,6 +509,7 @@ DLL_HIDDEN int64_t _vxarcvector_cellproc__operation_sync_outarcs_CS_NT( vgx_Vert
         n_arcs = iOperation.Arc_WL.Connect( &arc );
       }
       // GREEN: Array of arcs
+      // ICE: Frozen array of arcs
       else {
         framehash_cell_t eph_top;
         __arcvector_set_ephemeral_top( V, &eph_top );
@@ -510,7 +517,7 @@ DLL_HIDDEN int64_t _vxarcvector_cellproc__operation_sync_outarcs_CS_NT( vgx_Vert
         framehash_processing_context_t sync_arcs = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top, NULL, __operation_sync_arcs_CS_NT );
         FRAMEHASH_PROCESSOR_SET_IO( &sync_arcs, tail_WL, NULL );
 
-        n_arcs = iFramehash.processing.ProcessNolock( &sync_arcs );
+        n_arcs = __arcvector_process_arcarray( V, &sync_arcs );
       }
 
       iOperation.Close_CS( graph, &tail_WL->operation, true );
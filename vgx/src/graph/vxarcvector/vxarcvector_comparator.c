@@ -165,6 +165,25 @@ DLL_HIDDEN vgx_VertexComparator_t _iVertexMinComparator = {
 
 
 
+/*******************************************************************//**
+ * Keyset cursor comparators
+ ***********************************************************************
+ */
+static int __cmp_cursor_key(            vgx_CollectorFloorGate_t key,     const vgx_VertexSortValue_t *a, const vgx_VertexSortValue_t *b );
+static int __cmp_cursor_position(       vgx_CollectorFloorGate_t key,     const vgx_CollectorItem_t *item, const vgx_CollectorCursor_t *cursor );
+static int __cmp_cursor_item(           vgx_CollectorFloorGate_t key,     const vgx_CollectorItem_t *a, const vgx_CollectorItem_t *b );
+static int __cmp_cursor_double_desc(    const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static int __cmp_cursor_double_asc(     const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static int __cmp_cursor_int64_desc(     const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static int __cmp_cursor_int64_asc(      const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static int __cmp_cursor_uint64_desc(    const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static int __cmp_cursor_uint64_asc(     const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static int __cmp_cursor_uint32_desc(    const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static int __cmp_cursor_uint32_asc(     const vgx_CollectorItem_t *item1, const vgx_CollectorItem_t *item2 );
+static bool __cursor_rejects(           const vgx_BaseCollector_context_t *collector, const vgx_CollectorItem_t *item );
+
+
+
 /*******************************************************************//**
  * Rank score from sort value
  ***********************************************************************
@@ -918,11 +937,30 @@ __inline static int __arc_collect_into_aggregating_product_map( vgx_ArcCollector
 
 
 
+/*******************************************************************//**
+ * __refresh_floor
+ * Cache the sort value of the heap root after the heap has changed
+ ***********************************************************************
+ */
+__inline static void __refresh_floor( vgx_BaseCollector_context_t *collector, Cm256iHeap_t *heap ) {
+  vgx_CollectorItem_t top;
+  if( CALLABLE(heap)->HeapTop( heap, &top.item ) ) {
+    collector->floor = top.sort;
+  }
+}
+
+
+
 /*******************************************************************//**
  * __push_arc
  ***********************************************************************
  */
 __inline static int __push_arc( vgx_ArcCollector_context_t *collector, vgx_LockableArc_t *larc, vgx_VertexSortValue_t sort ) {
+  // Item cannot beat the current top-k floor
+  if( _vgx_collector_below_floor( (vgx_BaseCollector_context_t*)collector, sort ) ) {
+    return 0;
+  }
+
   Cm256iHeap_t *heap = collector->container.sequence.heap;
   
   vgx_VertexRef_t sort_tailref = { .vertex = larc->tail };
@@ -936,11 +974,17 @@ __inline static int __push_arc( vgx_ArcCollector_context_t *collector, vgx_Locka
   vgx_CollectorItem_t discarded;
   vgx_CollectorItem_t *push_location;
 
+  // Item is not past the cursor position, or cannot beat the current top-k floor under cursor ordering
+  if( collector->cursor.enabled && __cursor_rejects( (vgx_BaseCollector_context_t*)collector, &collected ) ) {
+    return 0;
+  }
+
   // Collect item into heap
   if( (push_location = (vgx_CollectorItem_t*)CALLABLE(heap)->HeapPushTopK( heap, &collected.item, &discarded.item )) == NULL ) {
     // Item not sorted high enough, nothing collected
     return 0;
   }
+  __refresh_floor( (vgx_BaseCollector_context_t*)collector, heap );
 
   // New item pushed, lower sorting item discarded
   return __update_refmap_head_tail( (vgx_BaseCollector_context_t*)collector, push_location, &discarded, larc, NULL );
@@ -1296,8 +1340,12 @@ DLL_HIDDEN int _vxarcvector_comparator__commit( vgx_BaseCollector_context_t *col
     if( _vgx_collector_is_sorted( collector ) ) {
       vgx_CollectorItem_t discarded;
       Cm256iHeap_t *heap = collector->container.sequence.heap;
-      // Collect item into heap
-      if( CALLABLE(heap)->HeapPushTopK( heap, &stage->item, &discarded.item ) != NULL ) {
+      // Collect item into heap unless it cannot beat the current top-k floor or is not past the cursor position
+      if( !_vgx_collector_below_floor( collector, stage->sort )
+          && !(collector->cursor.enabled && __cursor_rejects( collector, stage ))
+          && CALLABLE(heap)->HeapPushTopK( heap, &stage->item, &discarded.item ) != NULL )
+      {
+        __refresh_floor( collector, heap );
         // Staged item already in refmap pushed, remove discarded item from refmap
         __update_refmap_head_tail( collector, NULL, &discarded, NULL, NULL );
         committed = 1;
@@ -1397,6 +1445,11 @@ __inline static int __vertex_no_stage( vgx_VertexCollector_context_t *collector,
  ***********************************************************************
  */
 __inline static int __push_vertex( vgx_VertexCollector_context_t *collector, vgx_LockableArc_t *larc, vgx_VertexSortValue_t sort ) {
+  // Item cannot beat the current top-k floor
+  if( _vgx_collector_below_floor( (vgx_BaseCollector_context_t*)collector, sort ) ) {
+    return 0;
+  }
+
   Cm256iHeap_t *heap = collector->container.sequence.heap;
   
   vgx_VertexRef_t sort_tailref = { .vertex = larc->head.vertex };
@@ -1410,11 +1463,17 @@ __inline static int __push_vertex( vgx_VertexCollector_context_t *collector, vgx
   vgx_CollectorItem_t discarded;
   vgx_CollectorItem_t *push_location;
 
+  // Item is not past the cursor position, or cannot beat the current top-k floor under cursor ordering
+  if( collector->cursor.enabled && __cursor_rejects( (vgx_BaseCollector_context_t*)collector, &collected ) ) {
+    return 0;
+  }
+
   // Collect item into heap
   if( (push_location = (vgx_CollectorItem_t*)CALLABLE(heap)->HeapPushTopK( heap, &collected.item, &discarded.item )) == NULL ) {
     // Item not sorted high enough, nothing collected
     return 0;
   }
+  __refresh_floor( (vgx_BaseCollector_context_t*)collector, heap );
 
   // New item pushed, lower sorting item discarded
   return __update_refmap_vertex( (vgx_BaseCollector_context_t*)collector, push_location, &discarded, larc );
@@ -1951,6 +2010,178 @@ __inline static double __rank_score_from_qword(       const vgx_CollectorItem_t
 
 
 
+/*******************************************************************//**
+ * __cmp_cursor_key
+ * Compare sort values according to the cursor key. Returns a positive
+ * number if a is ordered after b in the result, i.e. the same sense as
+ * the heap comparator for the key's sort direction.
+ ***********************************************************************
+ */
+__inline static int __cmp_cursor_key( vgx_CollectorFloorGate_t key, const vgx_VertexSortValue_t *a, const vgx_VertexSortValue_t *b ) {
+  switch( key ) {
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC:
+    return __cmp_double( b->flt64.value, a->flt64.value );
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC:
+    return __cmp_double( a->flt64.value, b->flt64.value );
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_DESC:
+    return __cmp_int64( b->int64.value, a->int64.value );
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_ASC:
+    return __cmp_int64( a->int64.value, b->int64.value );
+  case VGX_COLLECTOR_FLOOR_GATE_UINT64_DESC:
+    return __cmp_uint64( b->uint64.value, a->uint64.value );
+  case VGX_COLLECTOR_FLOOR_GATE_UINT64_ASC:
+    return __cmp_uint64( a->uint64.value, b->uint64.value );
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC:
+    return __cmp_uint32( b->uint32.value, a->uint32.value );
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC:
+    return __cmp_uint32( a->uint32.value, b->uint32.value );
+  default:
+    return 0;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * __cmp_cursor_ids
+ * Tie breaker for equal sort values: head id, tail id, then arc
+ * predicator. Follows the sort direction of the key so the complete
+ * ordering is a single total order in either direction.
+ ***********************************************************************
+ */
+__inline static int __cmp_cursor_ids( vgx_CollectorFloorGate_t key, const objectid_t *head_a, const objectid_t *tail_a, uint64_t pred_a, const objectid_t *head_b, const objectid_t *tail_b, uint64_t pred_b ) {
+  int cmp;
+  if( (cmp = idcmp( head_a, head_b )) == 0 && (cmp = idcmp( tail_a, tail_b )) == 0 ) {
+    cmp = __cmp_uint64( pred_a, pred_b );
+  }
+  // Even gate values are ascending
+  return (key & 1) ? -cmp : cmp;
+}
+
+
+
+/*******************************************************************//**
+ * __cursor_predicator_data
+ * Stable part of the predicator (excluding ephemeral bits)
+ ***********************************************************************
+ */
+__inline static uint64_t __cursor_predicator_data( const vgx_predicator_t predicator ) {
+  return predicator.__data56;
+}
+
+
+
+/*******************************************************************//**
+ * __cursor_tail
+ ***********************************************************************
+ */
+__inline static const objectid_t * __cursor_tail( const vgx_CollectorItem_t *item ) {
+  return __vertex_internalid( (item->tailref ? item->tailref : item->headref)->vertex );
+}
+
+
+
+/*******************************************************************//**
+ * __cmp_cursor_item
+ ***********************************************************************
+ */
+__inline static int __cmp_cursor_item( vgx_CollectorFloorGate_t key, const vgx_CollectorItem_t *a, const vgx_CollectorItem_t *b ) {
+  int cmp = __cmp_cursor_key( key, &a->sort, &b->sort );
+  if( cmp != 0 ) {
+    return cmp;
+  }
+  return __cmp_cursor_ids( key, __vertex_internalid( a->headref->vertex ), __cursor_tail( a ), __cursor_predicator_data( a->predicator ),
+                                __vertex_internalid( b->headref->vertex ), __cursor_tail( b ), __cursor_predicator_data( b->predicator ) );
+}
+
+
+
+/*******************************************************************//**
+ * __cmp_cursor_position
+ * Positive if item is ordered after the cursor position
+ ***********************************************************************
+ */
+__inline static int __cmp_cursor_position( vgx_CollectorFloorGate_t key, const vgx_CollectorItem_t *item, const vgx_CollectorCursor_t *cursor ) {
+  int cmp = __cmp_cursor_key( key, &item->sort, &cursor->sort );
+  if( cmp != 0 ) {
+    return cmp;
+  }
+  return __cmp_cursor_ids( key, __vertex_internalid( item->headref->vertex ), __cursor_tail( item ), __cursor_predicator_data( item->predicator ),
+                                &cursor->head, &cursor->tail, cursor->predicator_data );
+}
+
+
+
+/*******************************************************************//**
+ * __cursor_rejects
+ * Return true if the item is not strictly after the cursor position, or
+ * if it is ordered strictly after the current heap floor. Items tying
+ * the floor value are left for the heap comparator to resolve.
+ ***********************************************************************
+ */
+__inline static bool __cursor_rejects( const vgx_BaseCollector_context_t *collector, const vgx_CollectorItem_t *item ) {
+  const vgx_CollectorCursor_t *cursor = &collector->cursor;
+  if( __cmp_cursor_key( cursor->key, &item->sort, &collector->floor ) > 0 ) {
+    return true;
+  }
+  return cursor->positioned && __cmp_cursor_position( cursor->key, item, cursor ) <= 0;
+}
+
+
+
+/*******************************************************************//**
+ * Keyset cursor heap comparators
+ ***********************************************************************
+ */
+__inline static int __cmp_cursor_double_desc( const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC, x1, x2 ); }
+__inline static int __cmp_cursor_double_asc(  const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC, x1, x2 ); }
+__inline static int __cmp_cursor_int64_desc(  const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_INT64_DESC, x1, x2 ); }
+__inline static int __cmp_cursor_int64_asc(   const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_INT64_ASC, x1, x2 ); }
+__inline static int __cmp_cursor_uint64_desc( const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_UINT64_DESC, x1, x2 ); }
+__inline static int __cmp_cursor_uint64_asc(  const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_UINT64_ASC, x1, x2 ); }
+__inline static int __cmp_cursor_uint32_desc( const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC, x1, x2 ); }
+__inline static int __cmp_cursor_uint32_asc(  const vgx_CollectorItem_t *x1, const vgx_CollectorItem_t *x2 ) { return __cmp_cursor_item( VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC, x1, x2 ); }
+
+
+
+/*******************************************************************//**
+ * Return the heap comparator imposing a total order (sort value, then
+ * object ids) for the given cursor key, or NULL if the key is invalid.
+ ***********************************************************************
+ */
+DLL_HIDDEN f_vgx_ArcComparator _vxarcvector_comparator__get_cursor_comparator( vgx_CollectorFloorGate_t key ) {
+  switch( key ) {
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC:  return __cmp_cursor_double_desc;
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC:   return __cmp_cursor_double_asc;
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_DESC:   return __cmp_cursor_int64_desc;
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_ASC:    return __cmp_cursor_int64_asc;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT64_DESC:  return __cmp_cursor_uint64_desc;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT64_ASC:   return __cmp_cursor_uint64_asc;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC:  return __cmp_cursor_uint32_desc;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC:   return __cmp_cursor_uint32_asc;
+  default:
+    return NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Capture the position of a collected item into a cursor
+ ***********************************************************************
+ */
+DLL_HIDDEN void _vxarcvector_comparator__set_cursor_position( vgx_CollectorCursor_t *cursor, vgx_CollectorFloorGate_t key, const vgx_CollectorItem_t *item ) {
+  cursor->enabled = true;
+  cursor->positioned = true;
+  cursor->key = key;
+  cursor->sort = item->sort;
+  idcpy( &cursor->head, __vertex_internalid( item->headref->vertex ) );
+  idcpy( &cursor->tail, __cursor_tail( item ) );
+  cursor->predicator_data = __cursor_predicator_data( item->predicator );
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -431,6 +431,10 @@ DLL_HIDDEN int _vxarcvector_dispatch__array_add( framehash_dynamic_t *dynamic, v
 
   // The only valid result is overwrite existing (n=0) or add one arc (n=1)
   if( (n_added == 1 || n_added == 0) && connect_event( dynamic, arc, n_added ) == n_added ) {
+    // Keep Bloom filter up to date
+    if( n_added == 1 ) {
+      _vxarcvector_bloom__added( dynamic, V, arc->head.vertex );
+    }
     return n_added;
   }
   else {
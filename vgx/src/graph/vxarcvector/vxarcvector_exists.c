@@ -300,7 +300,7 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_exists__has_arc( const vgx_ArcVector
         FRAMEHASH_PROCESSOR_SET_IO( &input.multipred_proc_traverse, &input, &output );
 
         // Execute
-        if( iFramehash.processing.ProcessNolock( &input.arcarray_proc ) < 0 ) {
+        if( __arcvector_process_arcarray( V, &input.arcarray_proc ) < 0 ) {
           filter_match = __arcfilter_error();
         }
         else if( output.match_arc != NULL ) {
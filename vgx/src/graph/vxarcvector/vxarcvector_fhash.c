@@ -331,7 +331,13 @@ __inline static void __framehash_update_arc_from_context( framehash_context_t *c
   if( is_modified ) {
     framehash_slot_t *slots = CELL_GET_FRAME_SLOTS( context->frame );
     framehash_cell_t *topcell = iFramehash.access.TopCell( slots );
-    TPTR_SET_POINTER_AND_TAG( &V->FxP, topcell, VGX_ARCVECTOR_FxP_FRAME );
+    // Array of arcs with Bloom filter keeps its frametop in the filter
+    if( __arcvector_cell_has_bloom( V ) ) {
+      __arcvector_as_bloom( V )->frametop = topcell;
+    }
+    else {
+      TPTR_SET_POINTER_AND_TAG( &V->FxP, topcell, VGX_ARCVECTOR_FxP_FRAME );
+    }
   }
 #ifdef VGX_CONSISTENCY_CHECK
   _vxarcvector_fhash__trap_bad_frame_reference( V );
@@ -519,6 +525,16 @@ static int __framehash_get( framehash_context_t *context, const vgx_ArcVector_ce
  */
 DLL_HIDDEN vgx_ArcVector_cell_t * _vxarcvector_fhash__get_arc_cell( framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, const vgx_Vertex_t *KEY_vertex, vgx_ArcVector_cell_t *ret_arc_cell ) {
 
+  // ICE: Frozen array of arcs has its own lookup
+  if( __arcvector_cell_is_frozen( V ) ) {
+    return _vxarcvector_frozen__get_arc_cell( V, KEY_vertex, ret_arc_cell );
+  }
+
+  // RED+: Bloom filter says there is no arc to this vertex
+  if( !__arcvector_bloom_may_contain( V, KEY_vertex ) ) {
+    return __arcvector_cell_set_no_arc( ret_arc_cell );
+  }
+
   framehash_cell_t eph_top; //
   
   // Prepare the framehash context for retrieval
@@ -575,6 +591,48 @@ DLL_HIDDEN vgx_ArcVector_cell_t * _vxarcvector_fhash__get_arc_cell( framehash_dy
 
 
 
+/*******************************************************************//**
+ * Run processor on the arcs whose head is one of the n heads, looking
+ * up each head in the array of arcs. Heads must not contain duplicates.
+ * Return semantics follow framehash processing.
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxarcvector_fhash__process_heads( framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, const vgx_Vertex_t **heads, int64_t n ) {
+  const f_framehash_cell_processor_t proc = processor->processor.function;
+  const int64_t limit = processor->processor.limit;
+  int64_t nproc = 0;
+  vgx_ArcVector_cell_t arc_cell;
+  framehash_cell_t fh_cell;
+
+  for( int64_t i=0; i<n; i++ ) {
+    APTR_INIT( &fh_cell );
+    switch( __arcvector_cell_type( _vxarcvector_fhash__get_arc_cell( dynamic, V, heads[i], &arc_cell ) ) ) {
+    case VGX_ARCVECTOR_SIMPLE_ARC:
+      APTR_AS_ANNOTATION( &fh_cell ) = (QWORD)heads[i];
+      APTR_SET_UNSIGNED( &fh_cell, __arcvector_as_predicator_bits( &arc_cell ) );
+      break;
+    case VGX_ARCVECTOR_MULTIPLE_ARC:
+      APTR_AS_ANNOTATION( &fh_cell ) = (QWORD)heads[i];
+      APTR_SET_PTR56( &fh_cell, __arcvector_get_frametop( &arc_cell ) );
+      break;
+    default:
+      continue;
+    }
+    int64_t prstate;
+    if( (prstate = proc( processor, &fh_cell )) < 0 ) {
+      processor->flags.failed = true;
+      return -1;
+    }
+    if( (nproc += prstate) >= limit || processor->flags.completed ) {
+      return nproc;
+    }
+  }
+
+  return nproc;
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -915,7 +973,12 @@ DLL_HIDDEN int64_t _vxarcvector_fhash__discard( framehash_dynamic_t *dynamic, co
   };
 
   // Discard
-  return iFramehash.memory.DiscardFrame( &discard_context );
+  int64_t n_discarded = iFramehash.memory.DiscardFrame( &discard_context );
+
+  // Discard Bloom filter if array of arcs has one
+  _vxarcvector_bloom__discard( V );
+
+  return n_discarded;
 }
 
 
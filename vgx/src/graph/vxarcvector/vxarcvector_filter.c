@@ -101,6 +101,8 @@ static int __arcvector_predicator_match_generic( const vgx_predicator_t probe, c
 static int __arcvector_vertex_condition_match_type( const vgx_vertex_probe_spec spec, const vgx_vertex_type_t type_probe, const vgx_Vertex_t *vertex_RO );
 static int __arcvector_vertex_condition_match_degree( const vgx_vertex_probe_t *vertex_probe, const vgx_Vertex_t *vertex_RO );
 static int __arcvector_vertex_condition_match_timestamps( const vgx_timestamp_probe_t *timestamp_probe, const vgx_Vertex_t *vertex_RO );
+static int __arcvector_vertex_condition_match_geo( const vgx_geo_probe_t *geo_probe, const vgx_Vertex_t *vertex_RO );
+static int __arcvector_vertex_condition_match_text( const vgx_text_probe_t *text_probe, const vgx_Vertex_t *vertex_RO );
 static int __arcvector_vertex_condition_match_similarity( const vgx_similarity_probe_t *similarity_probe, const vgx_Vector_t *vertex_vector );
 static int __arcvector_vertex_condition_match_single_identifier( vgx_vertex_probe_spec spec, const CString_t *CSTR__probe, const vgx_VertexIdentifier_t *vertex_identifier, const objectid_t *vertex_internalid );
 static int __arcvector_vertex_condition_match_identifier_list( vgx_vertex_probe_spec spec, const vgx_StringList_t *CSTR__probe, const vgx_VertexIdentifier_t *vertex_identifier, const objectid_t *vertex_internalid );
@@ -803,6 +805,38 @@ static __inline int __arcvector_vertex_condition_match_timestamps( const vgx_tim
 
 
 
+/*******************************************************************//**
+ * Match vertex geo position only
+ ***********************************************************************
+ */
+static __inline int __arcvector_vertex_condition_match_geo( const vgx_geo_probe_t *geo_probe, const vgx_Vertex_t *vertex_RO ) {
+  double lat, lon;
+  int hit = geo_probe->positive ? 1 : 0;
+  if( !_vxgraph_geoindex__vertex_position( vertex_RO, geo_probe->lat_keyhash, geo_probe->lon_keyhash, &lat, &lon ) ) {
+    return !hit;
+  }
+  if( _vxgraph_geoindex__distance( geo_probe->lat, geo_probe->lon, lat, lon ) > geo_probe->radius ) {
+    return !hit;
+  }
+  return hit;
+}
+
+
+
+/*******************************************************************//**
+ * Match vertex text terms only
+ ***********************************************************************
+ */
+static __inline int __arcvector_vertex_condition_match_text( const vgx_text_probe_t *text_probe, const vgx_Vertex_t *vertex_RO ) {
+  int hit = text_probe->positive ? 1 : 0;
+  if( !_vxgraph_textindex__match_vertex( vertex_RO, text_probe ) ) {
+    return !hit;
+  }
+  return hit;
+}
+
+
+
 /*******************************************************************//**
  * Match vertex similarity only
  ***********************************************************************
@@ -1090,6 +1124,24 @@ static int __arcvector_vertex_condition_match_details( const vgx_virtual_ArcFilt
     }
   }
 
+  // GEO PROBE
+  const vgx_geo_probe_t *geo_probe;
+  if( (geo_probe = vertex_probe->advanced.geo_probe) != NULL ) {
+    if( !__arcvector_vertex_condition_match_geo( geo_probe, vertex_RO ) ) {
+      *match = VGX_ARC_FILTER_MATCH_MISS;
+      return 0;
+    }
+  }
+
+  // TEXT PROBE
+  const vgx_text_probe_t *text_probe;
+  if( (text_probe = vertex_probe->advanced.text_probe) != NULL ) {
+    if( !__arcvector_vertex_condition_match_text( text_probe, vertex_RO ) ) {
+      *match = VGX_ARC_FILTER_MATCH_MISS;
+      return 0;
+    }
+  }
+
   // SIMILARITY PROBE
   const vgx_similarity_probe_t *sim_probe;
   if( (sim_probe = vertex_probe->advanced.similarity_probe) != NULL ) {
@@ -1147,6 +1199,8 @@ static int __arcvector_vertex_condition_match_generic( const vgx_virtual_ArcFilt
     // If details becomes non-zero we will check each probe
     uint64_t details =  (uintptr_t)vertex_probe->advanced.degree_probe      |
                         (uintptr_t)vertex_probe->advanced.timestamp_probe   |
+                        (uintptr_t)vertex_probe->advanced.geo_probe         |
+                        (uintptr_t)vertex_probe->advanced.text_probe        |
                         (uintptr_t)vertex_probe->advanced.similarity_probe  |
                         (uintptr_t)vertex_probe->advanced.property_probe;
 
@@ -2544,7 +2598,7 @@ static vgx_VertexFilter_context_t * __new_vertex_filter( vgx_vertex_probe_t *ver
     }
   }
   else {
-    // Only advanced filter without degree, property, timestamp or similarity.
+    // Only advanced filter without degree, property, timestamp, geo, text or similarity.
     // I.e. possibly an evaluator and/or recursive traversal
     if( ((vertex_probe->spec & _VERTEX_PROBE_ANY_ENA) == _VERTEX_PROBE_ADVANCED_ENA)
         &&
@@ -2554,6 +2608,10 @@ static vgx_VertexFilter_context_t * __new_vertex_filter( vgx_vertex_probe_t *ver
         &&
         vertex_probe->advanced.timestamp_probe == NULL
         &&
+        vertex_probe->advanced.geo_probe == NULL
+        &&
+        vertex_probe->advanced.text_probe == NULL
+        &&
         vertex_probe->advanced.similarity_probe == NULL
         &&
         vertex_probe->manifestation == VERTEX_STATE_CONTEXT_MAN_ANY
@@ -0,0 +1,902 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    vxarcvector_frozen.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#include "_vxarcvector.h"
+
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
+
+
+
+/*******************************************************************//**
+ *
+ * ==== FROZEN ARRAY OF ARCS ====
+ *
+ * A read-mostly array of arcs can be converted from its framehash form
+ * into a compact, immutable form. All arcs are sorted by head vertex
+ * address and split into blocks. Each block stores head addresses as
+ * fixed-width offsets from the block's first head (frame of reference),
+ * scaled down by the common alignment of all head addresses. Offset
+ * widths are 1, 2, 4 or 8 bytes per block, chosen to fit the block.
+ *
+ * Predicator keys (rel/mod/dir) are stored once in a dictionary in the
+ * header and referenced by one byte per arc when more than one key
+ * exists. Predicator values are stored as 32-bit columns unless all
+ * values are identical, in which case the value lives in the header.
+ *
+ * Header line:
+ * [ __frozen_header_t ][ base[n_blocks] ][ block[n_blocks] ][ keys[n_keys] ]
+ *
+ * Block line:
+ * [ __frozen_block_t ][ offsets[n] ][ values[n] ][ keyidx[n] ]
+ *
+ * Lines are allocated from the arcvector frame allocator. Offsets are
+ * monotonic within each block, so lookup is a binary search over the
+ * block bases followed by a binary search in one block. Scans decode
+ * one fixed-width column at a time in tight loops.
+ *
+ * Frozen arrays never contain multiple arcs. Any modification of a
+ * frozen array must thaw it back into framehash form first.
+ *
+ * Capacity is bounded by the header line (at most 63 slots of block
+ * bases and pointers) and by 256 distinct predicator keys. Depending on
+ * offset width and columns this allows roughly 75k to 1M arcs. Larger
+ * arrays are left in framehash form and reported as oversized.
+ *
+ ***********************************************************************
+ */
+
+
+
+#define __FROZEN_LINE_MAX_SLOTS       63
+#define __FROZEN_LINE_MAX_BYTES       (__FROZEN_LINE_MAX_SLOTS * sizeof( framehash_slot_t ))
+#define __FROZEN_MAX_KEYS             256
+#define __FROZEN_BLOCK_MAX_ARCS       0xFFFF
+#define __FROZEN_WIDEN_MIN_ARCS       16
+#define __FROZEN_DECODE_CHUNK         256
+
+
+
+typedef struct s_frozen_block_t {
+  uintptr_t base;       // head vertex address of the first arc in block
+  uint16_t n;           // number of arcs in block
+  uint8_t ow;           // offset width in bytes (1, 2, 4 or 8)
+  uint8_t __rsv[5];
+} __frozen_block_t;
+
+
+
+typedef struct s_frozen_header_t {
+  int64_t n_arcs;       // total number of arcs
+  uint16_t n_blocks;    // number of blocks
+  uint16_t n_keys;      // number of distinct predicator keys
+  uint8_t shift;        // head address offsets are scaled down by this many bits
+  uint8_t vw;           // value width in bytes (0 = all values equal header value, 4 = value column)
+  uint16_t __rsv;
+  DWORD value;          // common value when vw == 0
+  DWORD __rsv2;
+  QWORD __rsv3;
+} __frozen_header_t;
+
+
+
+typedef struct s_frozen_collector_t {
+  framehash_cell_t *cells;
+  int64_t capacity;
+  int64_t n;
+  bool multiple;
+} __frozen_collector_t;
+
+
+
+typedef struct s_frozen_block_plan_t {
+  int64_t start;
+  int n;
+  int ow;
+} __frozen_block_plan_t;
+
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static uintptr_t * __header_bases( const __frozen_header_t *H ) {
+  return (uintptr_t*)(H + 1);
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static __frozen_block_t ** __header_blocks( const __frozen_header_t *H ) {
+  return (__frozen_block_t**)(__header_bases( H ) + H->n_blocks);
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static DWORD * __header_keys( const __frozen_header_t *H ) {
+  return (DWORD*)(__header_blocks( H ) + H->n_blocks);
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static size_t __header_bytes( int n_blocks, int n_keys ) {
+  return sizeof( __frozen_header_t ) + n_blocks * (sizeof( uintptr_t ) + sizeof( __frozen_block_t* )) + n_keys * sizeof( DWORD );
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static size_t __block_values_offset( int n, int ow ) {
+  size_t sz = sizeof( __frozen_block_t ) + (size_t)n * ow;
+  return (sz + 3) & ~(size_t)3;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static size_t __block_keyidx_offset( int n, int ow, int vw ) {
+  if( vw ) {
+    return __block_values_offset( n, ow ) + (size_t)n * vw;
+  }
+  else {
+    return sizeof( __frozen_block_t ) + (size_t)n * ow;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static size_t __block_bytes( int n, int ow, int vw, int kw ) {
+  return __block_keyidx_offset( n, ow, vw ) + (size_t)n * kw;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static const BYTE * __block_offsets( const __frozen_block_t *B ) {
+  return (const BYTE*)(B + 1);
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static const DWORD * __block_values( const __frozen_block_t *B ) {
+  return (const DWORD*)((const BYTE*)B + __block_values_offset( B->n, B->ow ));
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static const BYTE * __block_keyidx( const __frozen_block_t *B, int vw ) {
+  return (const BYTE*)B + __block_keyidx_offset( B->n, B->ow, vw );
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static int __offset_width( uint64_t offset ) {
+  if( offset <= 0xFF ) {
+    return 1;
+  }
+  else if( offset <= 0xFFFF ) {
+    return 2;
+  }
+  else if( offset <= 0xFFFFFFFF ) {
+    return 4;
+  }
+  else {
+    return 8;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static uint64_t __block_get_offset( const __frozen_block_t *B, int i ) {
+  const BYTE *offsets = __block_offsets( B );
+  switch( B->ow ) {
+  case 1:
+    return offsets[i];
+  case 2:
+    return ((const uint16_t*)offsets)[i];
+  case 4:
+    return ((const uint32_t*)offsets)[i];
+  default:
+    return ((const uint64_t*)offsets)[i];
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Decode head addresses for arcs [i, i+n) in block into heads[]
+ *
+ ***********************************************************************
+ */
+static void __block_decode_heads( const __frozen_block_t *B, int shift, int i, int n, uintptr_t *heads ) {
+  const uintptr_t base = B->base;
+  const BYTE *offsets = __block_offsets( B );
+  switch( B->ow ) {
+  case 1:
+    {
+      const uint8_t *o = offsets + i;
+      for( int k=0; k<n; k++ ) {
+        heads[k] = base + ((uintptr_t)o[k] << shift);
+      }
+    }
+    return;
+  case 2:
+    {
+      const uint16_t *o = (const uint16_t*)offsets + i;
+      for( int k=0; k<n; k++ ) {
+        heads[k] = base + ((uintptr_t)o[k] << shift);
+      }
+    }
+    return;
+  case 4:
+    {
+      const uint32_t *o = (const uint32_t*)offsets + i;
+      for( int k=0; k<n; k++ ) {
+        heads[k] = base + ((uintptr_t)o[k] << shift);
+      }
+    }
+    return;
+  default:
+    {
+      const uint64_t *o = (const uint64_t*)offsets + i;
+      for( int k=0; k<n; k++ ) {
+        heads[k] = base + ((uintptr_t)o[k] << shift);
+      }
+    }
+    return;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static uint64_t __arc_predicator_bits( const __frozen_header_t *H, const __frozen_block_t *B, int i ) {
+  const DWORD *keys = __header_keys( H );
+  DWORD key = H->n_keys > 1 ? keys[ __block_keyidx( B, H->vw )[i] ] : keys[0];
+  DWORD value = H->vw ? __block_values( B )[i] : H->value;
+  return ((uint64_t)key << 32) | value;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __collect_arc( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell ) {
+  __frozen_collector_t *collector = (__frozen_collector_t*)processor->processor.output;
+  if( __arcvector_fhash_is_multiple_arc( fh_cell ) ) {
+    collector->multiple = true;
+    FRAMEHASH_PROCESSOR_SET_COMPLETED( processor );
+    return 0;
+  }
+  if( collector->n >= collector->capacity ) {
+    return -1;
+  }
+  framehash_cell_t *dest = &collector->cells[ collector->n++ ];
+  APTR_COPY( dest, fh_cell );
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __compare_arc_head( const void *a, const void *b ) {
+  uintptr_t ha = (uintptr_t)APTR_AS_ANNOTATION( (const framehash_cell_t*)a );
+  uintptr_t hb = (uintptr_t)APTR_AS_ANNOTATION( (const framehash_cell_t*)b );
+  return (ha > hb) - (ha < hb);
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __discard_lines( framehash_dynamic_t *dynamic, __frozen_header_t *H ) {
+  cxmalloc_family_t *falloc = dynamic->falloc;
+  __frozen_block_t **blocks = __header_blocks( H );
+  for( int b=0; b<H->n_blocks; b++ ) {
+    if( blocks[b] ) {
+      CALLABLE( falloc )->Discard( falloc, blocks[b] );
+    }
+  }
+  CALLABLE( falloc )->Discard( falloc, H );
+}
+
+
+
+/*******************************************************************//**
+ * Convert an array of arcs to frozen form.
+ *
+ * Returns:  1 : V is now frozen
+ *           2 : V was left unchanged (exceeds frozen capacity)
+ *           0 : V was left unchanged (not eligible)
+ *          -1 : error, V was left unchanged
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxarcvector_frozen__freeze( framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V ) {
+  if( __arcvector_cell_type( V ) != VGX_ARCVECTOR_ARRAY_OF_ARCS ) {
+    return 0;
+  }
+
+  int ret = 0;
+  int64_t degree = __arcvector_get_degree( V );
+  cxmalloc_family_t *falloc = dynamic->falloc;
+
+  __frozen_collector_t collector = {
+    .cells    = NULL,
+    .capacity = degree,
+    .n        = 0,
+    .multiple = false
+  };
+  __frozen_block_plan_t *plan = NULL;
+  __frozen_header_t *H = NULL;
+  DWORD keys[ __FROZEN_MAX_KEYS ];
+  BYTE *keyidx = NULL;
+
+  XTRY {
+    if( degree < 2 ) {
+      XBREAK;
+    }
+
+    // Collect all arcs from framehash
+    TALIGNED_ARRAY_THROWS( collector.cells, framehash_cell_t, degree, 0x2F1 );
+    framehash_cell_t eph_top;
+    __arcvector_set_ephemeral_top( V, &eph_top );
+    framehash_processing_context_t collect_arcs = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top, NULL, __collect_arc );
+    FRAMEHASH_PROCESSOR_SET_IO( &collect_arcs, NULL, &collector );
+    if( iFramehash.processing.ProcessNolock( &collect_arcs ) < 0 ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x2F2 );
+    }
+
+    // Multiple arcs are not supported in frozen form
+    if( collector.multiple ) {
+      XBREAK;
+    }
+
+    // Degree must match the number of simple arcs
+    if( collector.n != degree ) {
+      __ARCVECTOR_ERROR( NULL, NULL, V, NULL );
+      THROW_ERROR( CXLIB_ERR_CORRUPTION, 0x2F3 );
+    }
+
+    int64_t n_arcs = collector.n;
+    framehash_cell_t *cells = collector.cells;
+
+    // Sort by head address
+    qsort( cells, n_arcs, sizeof( framehash_cell_t ), __compare_arc_head );
+
+    // Build key dictionary, value width and alignment shift
+    if( (keyidx = malloc( n_arcs )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x2F4 );
+    }
+    int n_keys = 0;
+    int vw = 0;
+    DWORD value = (DWORD)(APTR_AS_UNSIGNED( &cells[0] ) & 0xFFFFFFFF);
+    uintptr_t align_bits = 0;
+    for( int64_t i=0; i<n_arcs; i++ ) {
+      uint64_t data = APTR_AS_UNSIGNED( &cells[i] );
+      DWORD key = (DWORD)(data >> 32);
+      int k = 0;
+      while( k < n_keys && keys[k] != key ) {
+        ++k;
+      }
+      if( k == n_keys ) {
+        if( n_keys == __FROZEN_MAX_KEYS ) {
+          ret = 2;
+          XBREAK; // too many distinct keys
+        }
+        keys[ n_keys++ ] = key;
+      }
+      keyidx[i] = (BYTE)k;
+      if( (DWORD)(data & 0xFFFFFFFF) != value ) {
+        vw = sizeof( DWORD );
+      }
+      align_bits |= (uintptr_t)APTR_AS_ANNOTATION( &cells[i] );
+    }
+    int shift = 0;
+    while( shift < 63 && (align_bits & 1) == 0 ) {
+      align_bits >>= 1;
+      ++shift;
+    }
+    int kw = n_keys > 1 ? 1 : 0;
+
+    // Plan blocks
+    int64_t max_blocks = (__FROZEN_LINE_MAX_BYTES - __header_bytes( 0, n_keys )) / (sizeof( uintptr_t ) + sizeof( __frozen_block_t* ));
+    TALIGNED_ARRAY_THROWS( plan, __frozen_block_plan_t, max_blocks, 0x2F5 );
+    int n_blocks = 0;
+    int64_t i = 0;
+    while( i < n_arcs ) {
+      if( n_blocks == max_blocks ) {
+        ret = 2;
+        XBREAK; // too large for frozen form
+      }
+      __frozen_block_plan_t *P = &plan[ n_blocks++ ];
+      uintptr_t base = (uintptr_t)APTR_AS_ANNOTATION( &cells[i] );
+      P->start = i;
+      P->n = 1;
+      P->ow = 1;
+      while( ++i < n_arcs ) {
+        uint64_t offset = ((uintptr_t)APTR_AS_ANNOTATION( &cells[i] ) - base) >> shift;
+        int ow = __offset_width( offset );
+        if( ow < P->ow ) {
+          ow = P->ow;
+        }
+        // Start a new block instead of widening an established block
+        if( ow > P->ow && P->n >= __FROZEN_WIDEN_MIN_ARCS ) {
+          break;
+        }
+        if( P->n >= __FROZEN_BLOCK_MAX_ARCS || __block_bytes( P->n + 1, ow, vw, kw ) > __FROZEN_LINE_MAX_BYTES ) {
+          break;
+        }
+        P->ow = ow;
+        P->n++;
+      }
+    }
+
+    // Allocate header
+    size_t header_bytes = __header_bytes( n_blocks, n_keys );
+    uint32_t header_slots = (uint32_t)((header_bytes + sizeof( framehash_slot_t ) - 1) / sizeof( framehash_slot_t ));
+    if( (H = CALLABLE( falloc )->New( falloc, header_slots )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x2F6 );
+    }
+    memset( H, 0, header_bytes );
+    H->n_arcs = n_arcs;
+    H->n_blocks = (uint16_t)n_blocks;
+    H->n_keys = (uint16_t)n_keys;
+    H->shift = (uint8_t)shift;
+    H->vw = (uint8_t)vw;
+    H->value = vw ? 0 : value;
+    memcpy( __header_keys( H ), keys, n_keys * sizeof( DWORD ) );
+
+    // Encode blocks
+    uintptr_t *bases = __header_bases( H );
+    __frozen_block_t **blocks = __header_blocks( H );
+    for( int b=0; b<n_blocks; b++ ) {
+      __frozen_block_plan_t *P = &plan[b];
+      size_t block_bytes = __block_bytes( P->n, P->ow, vw, kw );
+      uint32_t block_slots = (uint32_t)((block_bytes + sizeof( framehash_slot_t ) - 1) / sizeof( framehash_slot_t ));
+      __frozen_block_t *B;
+      if( (B = blocks[b] = CALLABLE( falloc )->New( falloc, block_slots )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x2F7 );
+      }
+      const framehash_cell_t *cell = &cells[ P->start ];
+      B->base = bases[b] = (uintptr_t)APTR_AS_ANNOTATION( cell );
+      B->n = (uint16_t)P->n;
+      B->ow = (uint8_t)P->ow;
+      BYTE *offsets = (BYTE*)__block_offsets( B );
+      for( int k=0; k<P->n; k++, cell++ ) {
+        uint64_t offset = ((uintptr_t)APTR_AS_ANNOTATION( cell ) - B->base) >> shift;
+        switch( P->ow ) {
+        case 1:
+          offsets[k] = (uint8_t)offset;
+          break;
+        case 2:
+          ((uint16_t*)offsets)[k] = (uint16_t)offset;
+          break;
+        case 4:
+          ((uint32_t*)offsets)[k] = (uint32_t)offset;
+          break;
+        default:
+          ((uint64_t*)offsets)[k] = offset;
+        }
+      }
+      if( vw ) {
+        DWORD *values = (DWORD*)__block_values( B );
+        cell = &cells[ P->start ];
+        for( int k=0; k<P->n; k++, cell++ ) {
+          values[k] = (DWORD)(APTR_AS_UNSIGNED( cell ) & 0xFFFFFFFF);
+        }
+      }
+      if( kw ) {
+        memcpy( (BYTE*)__block_keyidx( B, vw ), keyidx + P->start, P->n );
+      }
+    }
+
+    // Discard the framehash and make V frozen
+    _vxarcvector_fhash__discard( dynamic, V );
+    __arcvector_cell_set_frozen_array_of_arcs( V, n_arcs, H );
+    H = NULL;
+    ret = 1;
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+  }
+  XFINALLY {
+    if( H ) {
+      __discard_lines( dynamic, H );
+    }
+    if( collector.cells ) {
+      ALIGNED_FREE( collector.cells );
+    }
+    if( plan ) {
+      ALIGNED_FREE( plan );
+    }
+    free( keyidx );
+  }
+
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __thaw_arc( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell ) {
+  framehash_dynamic_t *dynamic = (framehash_dynamic_t*)processor->processor.input;
+  vgx_ArcVector_cell_t *T = (vgx_ArcVector_cell_t*)processor->processor.output;
+  vgx_Arc_t arc = {
+    .tail = NULL,
+    .head = {
+      .vertex     = (vgx_Vertex_t*)APTR_AS_ANNOTATION( fh_cell ),
+      .predicator = { .data = APTR_AS_UNSIGNED( fh_cell ) }
+    }
+  };
+  return _vxarcvector_fhash__set_simple_arc( dynamic, T, &arc );
+}
+
+
+
+/*******************************************************************//**
+ * Convert a frozen array of arcs back to framehash form.
+ *
+ * Returns:  1 : V is now a regular array of arcs
+ *           0 : V was not frozen
+ *          -1 : error, V was left frozen
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxarcvector_frozen__thaw( framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V ) {
+  if( !__arcvector_cell_is_frozen( V ) ) {
+    return 0;
+  }
+
+  int ret = 0;
+  __frozen_header_t *H = __arcvector_as_frozen( V );
+
+  framehash_slot_t *frame_slots = NULL;
+  framehash_cell_t top;
+  framehash_context_t context = CONTEXT_INIT_TOP_FRAME( &top, dynamic );
+  vgx_ArcVector_cell_t T;
+
+  XTRY {
+    // Create top frame as LEAF
+    if( (frame_slots = iFramehash.memory.NewFrame( &context, 0, 1, FRAME_TYPE_LEAF )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x2F8 );
+    }
+    framehash_cell_t *frametop = iFramehash.access.TopCell( frame_slots );
+    __arcvector_cell_set_array_of_arcs( &T, 0, frametop );
+
+    // Re-insert all arcs
+    framehash_processing_context_t thaw_arcs = FRAMEHASH_PROCESSOR_NEW_CONTEXT( NULL, NULL, __thaw_arc );
+    FRAMEHASH_PROCESSOR_SET_IO( &thaw_arcs, dynamic, &T );
+    int64_t n_arcs = _vxarcvector_frozen__process( V, &thaw_arcs );
+    if( n_arcs != H->n_arcs ) {
+      __ARCVECTOR_ERROR( NULL, NULL, V, NULL );
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x2F9 );
+    }
+
+    // Replace frozen form
+    __discard_lines( dynamic, H );
+    __arcvector_cell_set_array_of_arcs( V, n_arcs, __arcvector_as_frametop( &T ) );
+
+    // Build Bloom filter if degree is high enough
+    _vxarcvector_bloom__rebuild( dynamic, V );
+    ret = 1;
+  }
+  XCATCH( errcode ) {
+    if( frame_slots ) {
+      _vxarcvector_fhash__discard( dynamic, &T );
+    }
+    ret = -1;
+  }
+  XFINALLY {
+  }
+
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Run processor on all arcs in frozen array, presenting each arc as an
+ * ephemeral framehash cell (annotation=head vertex, value=predicator).
+ * Return semantics follow framehash processing.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxarcvector_frozen__process( const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor ) {
+  return _vxarcvector_frozen__process_partition( V, processor, 0, 1 );
+}
+
+
+
+/*******************************************************************//**
+ * Run processor on the arcs in blocks assigned to partition part, i.e.
+ * blocks b where b % nparts == part.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxarcvector_frozen__process_partition( const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, int part, int nparts ) {
+  const __frozen_header_t *H = __arcvector_as_frozen( V );
+  const __frozen_block_t * const *blocks = (const __frozen_block_t * const *)__header_blocks( H );
+  const f_framehash_cell_processor_t proc = processor->processor.function;
+  const int64_t limit = processor->processor.limit;
+  const int shift = H->shift;
+  int64_t nproc = 0;
+  uintptr_t heads[ __FROZEN_DECODE_CHUNK ];
+  framehash_cell_t fh_cell;
+  APTR_INIT( &fh_cell );
+
+  if( nparts < 1 || part < 0 || part >= nparts ) {
+    return -1;
+  }
+
+  for( int b=part; b<H->n_blocks; b += nparts ) {
+    const __frozen_block_t *B = blocks[b];
+    for( int i=0; i<B->n; i += __FROZEN_DECODE_CHUNK ) {
+      int n = B->n - i;
+      if( n > __FROZEN_DECODE_CHUNK ) {
+        n = __FROZEN_DECODE_CHUNK;
+      }
+      __block_decode_heads( B, shift, i, n, heads );
+      for( int k=0; k<n; k++ ) {
+        APTR_AS_ANNOTATION( &fh_cell ) = heads[k];
+        APTR_SET_UNSIGNED( &fh_cell, __arc_predicator_bits( H, B, i+k ) );
+        int64_t prstate;
+        if( (prstate = proc( processor, &fh_cell )) < 0 ) {
+          processor->flags.failed = true;
+          return -1;
+        }
+        if( (nproc += prstate) >= limit || processor->flags.completed ) {
+          return nproc;
+        }
+      }
+    }
+  }
+
+  return nproc;
+}
+
+
+
+/*******************************************************************//**
+ * Run processor on the arcs whose head is one of the n heads, which
+ * must be sorted by address without duplicates. Heads and arcs are
+ * merged in ascending order, skipping blocks with no candidate heads.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxarcvector_frozen__process_heads( const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, const vgx_Vertex_t **heads, int64_t n ) {
+  const __frozen_header_t *H = __arcvector_as_frozen( V );
+  const uintptr_t *bases = __header_bases( H );
+  const __frozen_block_t * const *blocks = (const __frozen_block_t * const *)__header_blocks( H );
+  const f_framehash_cell_processor_t proc = processor->processor.function;
+  const int64_t limit = processor->processor.limit;
+  const int shift = H->shift;
+  int64_t nproc = 0;
+  int64_t c = 0;
+  uintptr_t decoded[ __FROZEN_DECODE_CHUNK ];
+  framehash_cell_t fh_cell;
+  APTR_INIT( &fh_cell );
+
+  for( int b=0; b<H->n_blocks && c<n; b++ ) {
+    // Skip candidates before this block
+    while( c < n && (uintptr_t)heads[c] < bases[b] ) {
+      ++c;
+    }
+    // Skip block if next candidate is beyond it
+    if( c == n || (b+1 < H->n_blocks && (uintptr_t)heads[c] >= bases[b+1]) ) {
+      continue;
+    }
+    const __frozen_block_t *B = blocks[b];
+    for( int i=0; i<B->n && c<n; i += __FROZEN_DECODE_CHUNK ) {
+      int m = B->n - i;
+      if( m > __FROZEN_DECODE_CHUNK ) {
+        m = __FROZEN_DECODE_CHUNK;
+      }
+      __block_decode_heads( B, shift, i, m, decoded );
+      int k = 0;
+      while( k < m && c < n ) {
+        uintptr_t head = (uintptr_t)heads[c];
+        if( decoded[k] < head ) {
+          ++k;
+        }
+        else if( decoded[k] > head ) {
+          ++c;
+        }
+        else {
+          APTR_AS_ANNOTATION( &fh_cell ) = head;
+          APTR_SET_UNSIGNED( &fh_cell, __arc_predicator_bits( H, B, i+k ) );
+          int64_t prstate;
+          if( (prstate = proc( processor, &fh_cell )) < 0 ) {
+            processor->flags.failed = true;
+            return -1;
+          }
+          if( (nproc += prstate) >= limit || processor->flags.completed ) {
+            return nproc;
+          }
+          ++k;
+          ++c;
+        }
+      }
+    }
+  }
+
+  return nproc;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN vgx_ArcVector_cell_t * _vxarcvector_frozen__get_arc_cell( const vgx_ArcVector_cell_t *V, const vgx_Vertex_t *KEY_vertex, vgx_ArcVector_cell_t *ret_arc_cell ) {
+  const __frozen_header_t *H = __arcvector_as_frozen( V );
+  const uintptr_t *bases = __header_bases( H );
+  uintptr_t key = (uintptr_t)KEY_vertex;
+
+  __arcvector_cell_set_no_arc( ret_arc_cell );
+
+  // Find last block with base <= key
+  int lo = 0;
+  int hi = H->n_blocks;
+  while( lo < hi ) {
+    int mid = (lo + hi) >> 1;
+    if( bases[mid] <= key ) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+  if( lo == 0 ) {
+    return ret_arc_cell;
+  }
+  const __frozen_block_t *B = __header_blocks( H )[ lo-1 ];
+
+  // Key must be aligned to the common head alignment
+  uintptr_t delta = key - B->base;
+  if( delta & ((1ULL << H->shift) - 1) ) {
+    return ret_arc_cell;
+  }
+  uint64_t target = delta >> H->shift;
+
+  // Binary search in block
+  lo = 0;
+  hi = B->n;
+  while( lo < hi ) {
+    int mid = (lo + hi) >> 1;
+    uint64_t offset = __block_get_offset( B, mid );
+    if( offset < target ) {
+      lo = mid + 1;
+    }
+    else if( offset > target ) {
+      hi = mid;
+    }
+    else {
+      vgx_Arc_t arc = {
+        .tail = NULL,
+        .head = {
+          .vertex     = (vgx_Vertex_t*)KEY_vertex,
+          .predicator = { .data = __arc_predicator_bits( H, B, mid ) }
+        }
+      };
+      return __arcvector_cell_set_simple_arc( ret_arc_cell, &arc );
+    }
+  }
+
+  return ret_arc_cell;
+}
+
+
+
+/*******************************************************************//**
+ * Return the number of bytes allocated for the frozen array
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxarcvector_frozen__bytes( const vgx_ArcVector_cell_t *V ) {
+  if( !__arcvector_cell_is_frozen( V ) ) {
+    return 0;
+  }
+  const __frozen_header_t *H = __arcvector_as_frozen( V );
+  const __frozen_block_t * const *blocks = (const __frozen_block_t * const *)__header_blocks( H );
+  int kw = H->n_keys > 1 ? 1 : 0;
+  int64_t bytes = __header_bytes( H->n_blocks, H->n_keys );
+  for( int b=0; b<H->n_blocks; b++ ) {
+    bytes += __block_bytes( blocks[b]->n, blocks[b]->ow, H->vw, kw );
+  }
+  return bytes;
+}
+
@@ -151,10 +151,12 @@ static int64_t __serialize_arc( framehash_processing_context_t * const processor
  * 
  ***********************************************************************
  */
-static int64_t __serialize_array_of_arcs( framehash_cell_t *top, CQwordQueue_t *__OUTPUT ) {
-  framehash_processing_context_t serialize_arc = FRAMEHASH_PROCESSOR_NEW_CONTEXT( top, NULL, __serialize_arc );
+static int64_t __serialize_array_of_arcs( const vgx_ArcVector_cell_t *V, CQwordQueue_t *__OUTPUT ) {
+  framehash_cell_t eph_top;
+  __arcvector_set_ephemeral_top( V, &eph_top );
+  framehash_processing_context_t serialize_arc = FRAMEHASH_PROCESSOR_NEW_CONTEXT( &eph_top, NULL, __serialize_arc );
   FRAMEHASH_PROCESSOR_SET_IO( &serialize_arc, NULL, __OUTPUT );
-  return iFramehash.processing.ProcessNolock( &serialize_arc );
+  return __arcvector_process_arcarray( V, &serialize_arc );
 }
 
 
@@ -370,6 +372,9 @@ static int64_t __deserialize_array_of_arcs( vgx_Vertex_t *tail, vgx_ArcVector_ce
 
     // Update the degree
     __arcvector_set_degree( V, degree );
+
+    // Build Bloom filter if degree is high enough
+    _vxarcvector_bloom__rebuild( dynamic, V );
   }
   XCATCH( errcode ) {
     if( frame_slots ) {
@@ -415,8 +420,6 @@ static int64_t __deserialize_indegree_counter( vgx_ArcVector_cell_t *V, CQwordQu
 DLL_HIDDEN int64_t _vxarcvector_serialization__serialize( const vgx_ArcVector_cell_t *V, CQwordQueue_t *__OUTPUT ) {
   int64_t __QWORDS = 0;
 
-  framehash_cell_t eph_top;
-
   switch( __arcvector_cell_type( V ) ) {
 
   // WHITE: Empty
@@ -450,6 +453,9 @@ DLL_HIDDEN int64_t _vxarcvector_serialization__serialize( const vgx_ArcVector_ce
 
   // GREEN: Array of arcs
   case VGX_ARCVECTOR_ARRAY_OF_ARCS:
+    /* FALLTHRU */
+  // ICE: Frozen array of arcs (serialized as a regular array of arcs)
+  case VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS:
     // [ ARRAY_OF_ARCS ]
     {
       QWORD __array_of_arcs[1] = {
@@ -457,9 +463,8 @@ DLL_HIDDEN int64_t _vxarcvector_serialization__serialize( const vgx_ArcVector_ce
       };
       WRITE_OR_FAIL( __array_of_arcs );
 
-      __arcvector_set_ephemeral_top( V, &eph_top );
       int64_t n;
-      if( (n = __serialize_array_of_arcs( &eph_top, __OUTPUT )) < 0 ) {
+      if( (n = __serialize_array_of_arcs( V, __OUTPUT )) < 0 ) {
         return -1;
       }
       __QWORDS += n;
@@ -47,6 +47,9 @@ static int64_t __traverse_arc_collect_conditional( framehash_processing_context_
 static int64_t __collect_arc_conditional( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
 static int64_t __traverse_arcarray_collect_conditional( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
 
+static int64_t __gather_arc_block( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
+static int64_t __gather_arcarray_block( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
+
 static int64_t __traverse_bidirectional_arc_and_collect( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
 static int64_t __traverse_bidirectional_arcarray_collect_all( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
 
@@ -523,6 +526,146 @@ static int64_t __traverse_arcarray_collect_conditional( framehash_processing_con
 
 
 
+/*******************************************************************//**
+ * Return the traversing evaluator if arcs accepted by filter can be
+ * evaluated in columnar blocks, otherwise NULL.
+ *
+ * This requires a pure expression filter with no head locking and no
+ * synthetic arcs, whose program has a batch plan.
+ ***********************************************************************
+ */
+static vgx_Evaluator_t * __get_block_evaluator( const vgx_virtual_ArcFilter_context_t *filter ) {
+  if( filter->type == VGX_ARC_FILTER_TYPE_EVALUATOR && !filter->arcfilter_locked_head_access && !filter->eval_synarc ) {
+    vgx_Evaluator_t *evaluator = filter->traversing_evaluator;
+    if( evaluator && CALLABLE( evaluator )->HasBatch( evaluator ) ) {
+      return evaluator;
+    }
+  }
+  return NULL;
+}
+
+
+
+/*******************************************************************//**
+ * Evaluate all buffered arcs in one block, then traverse (and collect)
+ * the arcs accepted by the filter in their original order.
+ *
+ * Returns number of arcs traversed, or -1 on error
+ ***********************************************************************
+ */
+static int64_t __flush_arc_block( __arcvector_virtual_input_context_t *context, __arcvector_arc_block_t *block ) {
+  int64_t n_traversed = 0;
+  int n = block->n;
+  if( n == 0 ) {
+    return 0;
+  }
+  block->n = 0;
+
+  __arcvector_traversal_output_context_t *output = block->output;
+  framehash_processing_context_t *processor = &context->arcarray_proc;
+  vgx_Evaluator_t *evaluator = block->evaluator;
+
+  uint64_t hits = CALLABLE( evaluator )->EvalArcBlock( evaluator, context->larc, block->arcs, n );
+  if( !block->positive ) {
+    hits = ~hits;
+  }
+
+  vgx_ArcHeadHeapItem_t *cursor = block->arcs;
+  vgx_ArcHeadHeapItem_t *end = cursor + n;
+  for( ; cursor < end && !FRAMEHASH_PROCESSOR_IS_COMPLETED( processor ); ++cursor, hits >>= 1 ) {
+    if( !(hits & 1) ) {
+      continue;
+    }
+    begin_direct_recursion_context( context, cursor ) {
+      output->arc_match = VGX_ARC_FILTER_MATCH_HIT;
+      if( block->collect && __arcvector_collect_arc( output->collector, context->larc, 0.0, processor ) < 0 ) {
+        output->arc_match = __arcfilter_error();
+        n_traversed = -1;
+      }
+      else {
+        ++n_traversed;
+        // Inc neighbor vertex count once per head
+        if( cursor->vertex != block->counted ) {
+          block->counted = cursor->vertex;
+          output->n_vertices++;
+        }
+        if( output->neighborhood_match == VGX_ARC_FILTER_MATCH_MISS ) {
+          output->neighborhood_match = VGX_ARC_FILTER_MATCH_HIT;
+        }
+      }
+    } end_direct_recursion_context;
+    if( n_traversed < 0 ) {
+      return -1;
+    }
+  }
+
+  // Halted during traversal
+  if( context->flags->is_halted ) {
+    FRAMEHASH_PROCESSOR_SET_COMPLETED( &context->arcarray_proc );
+    FRAMEHASH_PROCESSOR_SET_COMPLETED( &context->multipred_proc_traverse );
+    if( !context->flags->explicit_halt ) {
+      return -1;
+    }
+  }
+
+  return n_traversed;
+}
+
+
+
+/*******************************************************************//**
+ * Append arc to block, flushing the block when full
+ ***********************************************************************
+ */
+static int64_t __gather_arc_block( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell ) {
+  __arcvector_virtual_input_context_t *context = processor->processor.input;
+  __arcvector_arc_block_t *block = processor->processor.output;
+  PROCESS_ARCVECTOR_INPUT_CONTEXT( context ) {
+    // Block flush completed the traversal
+    if( FRAMEHASH_PROCESSOR_IS_COMPLETED( &context->arcarray_proc ) ) {
+      FRAMEHASH_PROCESSOR_SET_COMPLETED( processor );
+      return 0;
+    }
+    vgx_ArcHeadHeapItem_t *item = &block->arcs[ block->n++ ];
+    item->score = 0.0;
+    item->vertex = block->head;
+    item->predicator.data = APTR_AS_UNSIGNED( fh_cell );
+    // Distance from anchor (as _vgx_arc_set_distance)
+    _vgx_predicator_eph_set_distance( &item->predicator, context->distance == 1 && block->head == context->larc->tail ? 0 : context->distance );
+    if( block->n == VGX_EXPRESS_EVAL_BATCH_SIZE && __flush_arc_block( context, block ) < 0 ) {
+      block->output->neighborhood_match = __arcfilter_error();
+      return -1;
+    }
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Array of arcs cell processor for columnar filter evaluation
+ ***********************************************************************
+ */
+static int64_t __gather_arcarray_block( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell ) {
+  __arcvector_virtual_input_context_t *context = processor->processor.input;
+  __arcvector_arc_block_t *block = processor->processor.output;
+  block->head = (vgx_Vertex_t*)APTR_AS_ANNOTATION( fh_cell );
+  // Multiple Arc: SECONDARY FRAMEHASH
+  if( __arcvector_fhash_is_multiple_arc( fh_cell ) ) {
+    __arcvector_context_prepare_multipred( context, fh_cell );
+    int64_t n = iFramehash.processing.ProcessNolock( &context->multipred_proc_traverse );
+    // Inherit completion
+    FRAMEHASH_PROCESSOR_INHERIT_COMPLETION( processor, &context->multipred_proc_traverse );
+    return n < 0 ? -1 : 0;
+  }
+  // Simple Arc: PREDICATOR
+  else {
+    return __gather_arc_block( processor, fh_cell );
+  }
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -632,6 +775,23 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_traverse__traverse_arcarray( const v
     .n_vertices         = 0
   };
 
+  // Columnar filter evaluation when traversing or collecting all filter matches
+  __arcvector_arc_block_t block;
+  block.evaluator = NULL;
+  if( culleval == NULL && (arcarray_proc == __traverse_arcarray_no_collect || arcarray_proc == __traverse_arcarray_collect_all) ) {
+    if( (block.evaluator = __get_block_evaluator( current )) != NULL ) {
+      block.output = &output;
+      block.positive = current->positive_match;
+      block.collect = arcarray_proc == __traverse_arcarray_collect_all;
+      block.n = 0;
+      block.head = NULL;
+      block.counted = NULL;
+      arcarray_proc = __gather_arcarray_block;
+      multipred_proc_traverse = __gather_arc_block;
+      multipred_proc_collect = __no_op;
+    }
+  }
+
   // Readonly ?
   bool readonly = neighborhood_probe->readonly_graph;
 
@@ -653,6 +813,12 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_traverse__traverse_arcarray( const v
       FRAMEHASH_PROCESSOR_SET_IO( &input.multipred_proc_traverse, &input, &output );
       FRAMEHASH_PROCESSOR_SET_IO( &input.multipred_proc_collect, &input, &output );
 
+      // Block processors buffer arcs for columnar evaluation
+      if( block.evaluator ) {
+        FRAMEHASH_PROCESSOR_SET_IO( &input.arcarray_proc, &input, &block );
+        FRAMEHASH_PROCESSOR_SET_IO( &input.multipred_proc_traverse, &input, &block );
+      }
+
       // Execution with cull
       if( culleval ) {
         // Reset cull heap array
@@ -667,7 +833,7 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_traverse__traverse_arcarray( const v
 
 
         // Execute without collection
-        if( iFramehash.processing.ProcessNolock( &input.arcarray_proc ) < 0 ) {
+        if( __arcvector_process_arcarray( V, &input.arcarray_proc ) < 0 ) {
           output.neighborhood_match = __arcfilter_error();
         }
 
@@ -698,9 +864,23 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_traverse__traverse_arcarray( const v
 
 
       }
-      // Normal execution
+      // Planned execution (only arcs to candidate heads found by iterating the terminals of the head condition)
+      else if( neighborhood_probe->candidates.heads ) {
+        if( __arcvector_process_arcarray_heads( &neighborhood_probe->graph->arcvector_fhdyn, V, &input.arcarray_proc, neighborhood_probe->candidates.heads, neighborhood_probe->candidates.n, neighborhood_probe->candidates.merge ) < 0 ) {
+          output.neighborhood_match = __arcfilter_error();
+        }
+        // Evaluate arcs remaining in last partial block
+        else if( block.evaluator && __flush_arc_block( (__arcvector_virtual_input_context_t*)&input, &block ) < 0 ) {
+          output.neighborhood_match = __arcfilter_error();
+        }
+      }
+      // Normal execution (only this probe's partition of the array when traversal is partitioned)
       else {
-        if( iFramehash.processing.ProcessNolock( &input.arcarray_proc ) < 0 ) {
+        if( __arcvector_process_arcarray_partition( V, &input.arcarray_proc, neighborhood_probe->partition.part, neighborhood_probe->partition.nparts ) < 0 ) {
+          output.neighborhood_match = __arcfilter_error();
+        }
+        // Evaluate arcs remaining in last partial block
+        else if( block.evaluator && __flush_arc_block( (__arcvector_virtual_input_context_t*)&input, &block ) < 0 ) {
           output.neighborhood_match = __arcfilter_error();
         }
       }
@@ -902,7 +1082,7 @@ DLL_HIDDEN vgx_ArcFilter_match _vxarcvector_traverse__traverse_arcarray_bidirect
         FRAMEHASH_PROCESSOR_SET_IO( &input.multipred_proc_collect, &input, &output );
 
         // Execute
-        int64_t n_proc = iFramehash.processing.ProcessNolock( &input.arcarray_proc );
+        int64_t n_proc = __arcvector_process_arcarray( V1, &input.arcarray_proc );
         
         iArcFilter.Delete( &input.reverse.traverse_filter );
 
@@ -34,7 +34,7 @@
  ***********************************************************************
  */
 __inline static op_arc_disconnect get__op_arc_disconnect( const vgx_Arc_t *arc, int64_t n_removed ) {
-  int eventexec = arc->tail->descriptor.writer.threadid == iGraphEvent.ExecutorThreadId( arc->tail->graph );
+  int eventexec = iGraphEvent.IsExecutorThread( arc->tail->graph, arc->tail->descriptor.writer.threadid );
   op_arc_disconnect opdata = {
     .op        = OPERATOR_ARC_DISCONNECT,
     .eventexec = eventexec,
@@ -130,6 +130,152 @@ static int __parse_op_system_send_raw_data( vgx_OperationParser_t *parser ) {
 
 
 
+/*******************************************************************//**
+ * Snapshot paths are relative to system root and must refer to user
+ * graph data
+ *
+ ***********************************************************************
+ */
+static bool __snapshot_path_valid( const char *path ) {
+  if( path == NULL || *path == '\0' || *path == '/' || *path == '\\' ) {
+    return false;
+  }
+  if( strstr( path, ".." ) != NULL || strchr( path, ':' ) != NULL ) {
+    return false;
+  }
+  if( CharsStartsWithConst( path, VGX_PATHDEF_SYSTEM ) || CharsStartsWithConst( path, VGX_PATHDEF_REGISTRY ) ) {
+    return false;
+  }
+  return true;
+}
+
+
+
+/*******************************************************************//**
+ * Apply one part of a snapshot transfer command.
+ *
+ * OPAUX_SNAPSHOT_BEGIN: Prepare for restore of graph at path, which must
+ *                       not be registered. Previous files are removed.
+ * OPAUX_SNAPSHOT_FILE:  Part 0 is the file path relative to system root,
+ *                       remaining parts are file data written as they
+ *                       arrive.
+ *
+ * The graph is restored from the received files when the create graph
+ * operation that follows the snapshot is executed.
+ *
+ ***********************************************************************
+ */
+static int __execute_snapshot_part_SYS_CS( vgx_OperationParser_t *parser, vgx_Graph_t *SYSTEM_CS, op_system_send_raw_data *op ) {
+  // Single execution thread, parts of one file arrive in order
+  static objectid_t file_id = {0};
+  static FILE *file = NULL;
+  static int64_t next_part = 0;
+
+  const CString_t *CSTR__sysroot = igraphfactory.SystemRoot();
+  const char *data = CStringValue( op->CSTR__datapart );
+  int64_t sz_data = CStringLength( op->CSTR__datapart );
+  char fullpath[MAX_PATH+1] = {0};
+
+  if( CSTR__sysroot == NULL ) {
+    OPEXEC_REASON( parser, "No system root" );
+    return -1;
+  }
+
+  // ---------------------------------
+  // Begin restore of graph at path
+  // ---------------------------------
+  if( (op->cmd & __OPAUX_MASK__SNAP_BEGIN) ) {
+    if( !__snapshot_path_valid( data ) ) {
+      OPEXEC_REASON( parser, "Invalid snapshot graph path: %s", data );
+      return -1;
+    }
+    bool exists = false;
+    GRAPH_SUSPEND_LOCK( SYSTEM_CS ) {
+      vgx_Graph_t **graphs = (vgx_Graph_t**)igraphfactory.ListGraphs( NULL );
+      if( graphs ) {
+        vgx_Graph_t **cursor = graphs;
+        vgx_Graph_t *graph;
+        while( (graph = *cursor++) != NULL ) {
+          if( graph->CSTR__path && CStringEqualsChars( graph->CSTR__path, data ) ) {
+            exists = true;
+          }
+        }
+        free( (void*)graphs );
+      }
+    } GRAPH_RESUME_LOCK;
+    if( exists ) {
+      OPEXEC_REASON( parser, "Cannot restore snapshot into existing graph: %s", data );
+      return -1;
+    }
+    snprintf( fullpath, MAX_PATH, "%s/%s", CStringValue( CSTR__sysroot ), data );
+    if( dir_exists( fullpath ) && delete_dir( fullpath ) < 0 ) {
+      OPEXEC_REASON( parser, "Failed to remove previous graph data: %s", fullpath );
+      return -1;
+    }
+    OPEXEC_INFO( parser, "Restoring graph snapshot: %s", data );
+    return 0;
+  }
+
+  // ---------------------------------
+  // File part
+  // ---------------------------------
+  if( op->part_id == 0 ) {
+    if( file != NULL ) {
+      OPEXEC_WARNING( parser, "Incomplete snapshot file discarded" );
+      CX_FCLOSE( file );
+      file = NULL;
+    }
+    if( !__snapshot_path_valid( data ) ) {
+      OPEXEC_REASON( parser, "Invalid snapshot file path: %s", data );
+      return -1;
+    }
+    snprintf( fullpath, MAX_PATH, "%s/%s", CStringValue( CSTR__sysroot ), data );
+    char *sep = strrchr( fullpath, '/' );
+    if( sep ) {
+      *sep = '\0';
+      if( create_dirs( fullpath ) < 0 ) {
+        OPEXEC_REASON( parser, "Failed to create directory: %s", fullpath );
+        return -1;
+      }
+      *sep = '/';
+    }
+    if( (file = CX_FOPEN( fullpath, "wb" )) == NULL ) {
+      OPEXEC_REASON( parser, "Failed to create snapshot file: %s", fullpath );
+      return -1;
+    }
+    idcpy( &file_id, &op->obid );
+    next_part = 1;
+  }
+  else {
+    if( file == NULL || !idmatch( &file_id, &op->obid ) || op->part_id != next_part ) {
+      OPEXEC_REASON( parser, "Unexpected snapshot file part: %lld", op->part_id );
+      if( file ) {
+        CX_FCLOSE( file );
+        file = NULL;
+      }
+      return -1;
+    }
+    if( (int64_t)CX_FWRITE( data, 1, sz_data, file ) != sz_data ) {
+      OPEXEC_REASON( parser, "Snapshot file write error" );
+      CX_FCLOSE( file );
+      file = NULL;
+      return -1;
+    }
+    ++next_part;
+  }
+
+  // Last part
+  if( op->part_id == op->n_parts - 1 ) {
+    CX_FCLOSE( file );
+    file = NULL;
+    idunset( &file_id );
+  }
+
+  return 0;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -153,8 +299,14 @@ static int __execute_op_system_send_raw_data( vgx_OperationParser_t *parser ) {
       char idbuf1[33];
       char idbuf2[33];
 
+      // Snapshot parts are applied immediately
+      if( (op->cmd & __OPAUX_MASK__SNAPSHOT) ) {
+        if( __execute_snapshot_part_SYS_CS( parser, SYSTEM_CS, op ) < 0 ) {
+          OPERATOR_ERROR( op );
+        }
+      }
       // First part
-      if( op->part_id == 0 ) {
+      else if( op->part_id == 0 ) {
         // Assert no other command in progress
         if( cmd_data != NULL || !idnone( &cmd_id ) ) {
           idunset( &cmd_id );
@@ -190,7 +342,7 @@ static int __execute_op_system_send_raw_data( vgx_OperationParser_t *parser ) {
       }
 
       // We have all dataparts
-      if( op->part_id == op->n_parts-1 ) {
+      if( !(op->cmd & __OPAUX_MASK__SNAPSHOT) && op->part_id == op->n_parts-1 ) {
         // Execute
         int ret = SYSTEM_CS->sysaux_cmd_callback( SYSTEM_CS, op->cmd, cmd_data, &parser->CSTR__error );
         if( (op->cmd & __OPAUX_MASK__FORWARD) ) {
@@ -35,7 +35,7 @@
  */
 __inline static op_vertex_delete get__op_vertex_delete( const vgx_Vertex_t *vertex ) {
 
-  int eventexec = vertex->descriptor.writer.threadid == iGraphEvent.ExecutorThreadId( vertex->graph );
+  int eventexec = iGraphEvent.IsExecutorThread( vertex->graph, vertex->descriptor.writer.threadid );
 
   op_vertex_delete opdata = {
     .op         = OPERATOR_VERTEX_DELETE,
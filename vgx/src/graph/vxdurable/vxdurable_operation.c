@@ -49,6 +49,7 @@ static int _vxdurable_operation__assert_state( void );
 
 static int _vxdurable_operation__sync_CS( vgx_Graph_t *graph, bool hard, int timeout_ms, CString_t **CSTR__error );
 static int _vxdurable_operation__sync( vgx_Graph_t *graph, bool hard, int timeout_ms, CString_t **CSTR__error );
+static int _vxdurable_operation__sync_snapshot( vgx_Graph_t *graph, int timeout_ms, CString_t **CSTR__error );
 
 static int _vxdurable_operation__enter_readonly_CS( vgx_Graph_t *graph );
 static int _vxdurable_operation__leave_readonly_CS( vgx_Graph_t *graph );
@@ -221,6 +222,7 @@ DLL_EXPORT vgx_IOperation_t iOperation = {
     .SendSimpleAuxCommand   = _vxdurable_operation_capture__system_send_simple_aux_command_SYS_CS,
     .ForwardAuxCommand      = _vxdurable_operation_capture__system_forward_aux_command_SYS_CS,
     .SendRawData            = _vxdurable_operation_capture__system_send_raw_data_SYS_CS,
+    .SendSnapshotPart       = _vxdurable_operation_capture__system_send_snapshot_part_SYS_CS,
     .CloneGraph             = _vxdurable_operation_capture__system_clone_graph_SYS_CS
   },
 
@@ -253,7 +255,8 @@ DLL_EXPORT vgx_IOperation_t iOperation = {
   },
 
   .Graph_OPEN = {
-    .Sync               = _vxdurable_operation__sync
+    .Sync               = _vxdurable_operation__sync,
+    .SyncSnapshot       = _vxdurable_operation__sync_snapshot
   },
 
   .Graph_ROG = {
@@ -1601,6 +1604,357 @@ static int _vxdurable_operation__sync( vgx_Graph_t *graph, bool hard, int timeou
 
 
 
+/*******************************************************************//**
+ * Snapshot transfer state
+ *
+ ***********************************************************************
+ */
+typedef struct s___snapshot_transfer_t {
+  vgx_Graph_t *SYSTEM;
+  const char *sysroot;
+  int timeout_ms;
+  int64_t n_files;
+  int64_t n_bytes;
+  int64_t n_uncommitted;
+  char *buffer;
+  CString_t **CSTR__error;
+} __snapshot_transfer_t;
+
+#define __SNAPSHOT_PART_SIZE      (1 << 15)
+#define __SNAPSHOT_COMMIT_PARTS   32
+
+
+
+/*******************************************************************//**
+ * Commit captured snapshot parts and hold until system output has
+ * drained below its limits (or to zero if drain is true.)
+ *
+ * Returns:  0 : OK
+ *          -1 : Output not draining, or sync was cancelled
+ ***********************************************************************
+ */
+static int __snapshot_commit_and_throttle( __snapshot_transfer_t *xfer, bool drain ) {
+  vgx_Graph_t *SYSTEM = xfer->SYSTEM;
+  int64_t emitter_oplim = drain ? 0 : 1LL << 12;
+  int64_t output_szlim = drain ? 0 : __TX_MAX_SIZE;
+  int64_t pending_ops = LLONG_MAX;
+  int64_t pending_bytes = LLONG_MAX;
+  int64_t t0 = __GET_CURRENT_MILLISECOND_TICK();
+  int64_t t_max_idle = xfer->timeout_ms > 60000 ? xfer->timeout_ms : 60000;
+  bool cancel = false;
+
+  GRAPH_LOCK( SYSTEM ) {
+    iOperation.Graph_CS.SetModified( SYSTEM );
+    COMMIT_GRAPH_OPERATION_CS( SYSTEM );
+    pending_ops = iOperation.Emitter_CS.GetPending( SYSTEM );
+    cancel = SYSTEM->OP.system.state_CS.flags.request_cancel_sync;
+  } GRAPH_RELEASE;
+  xfer->n_uncommitted = 0;
+
+  pending_bytes = iOperation.System_OPEN.BytesPending( SYSTEM );
+  while( !cancel && (pending_ops > emitter_oplim || pending_bytes > output_szlim) ) {
+    int64_t ops_0 = pending_ops;
+    int64_t bytes_0 = pending_bytes;
+    sleep_milliseconds( drain ? 100 : 10 );
+    pending_bytes = iOperation.System_OPEN.BytesPending( SYSTEM );
+    GRAPH_LOCK( SYSTEM ) {
+      pending_ops = iOperation.Emitter_CS.GetPending( SYSTEM );
+      cancel = SYSTEM->OP.system.state_CS.flags.request_cancel_sync;
+    } GRAPH_RELEASE;
+    if( pending_ops != ops_0 || pending_bytes != bytes_0 ) {
+      t0 = __GET_CURRENT_MILLISECOND_TICK();
+    }
+    else if( __GET_CURRENT_MILLISECOND_TICK() - t0 > t_max_idle ) {
+      __format_error_string( xfer->CSTR__error, "Snapshot output not draining (%lld emitter ops, %lld system output bytes)", pending_ops, pending_bytes );
+      return -1;
+    }
+  }
+
+  if( cancel ) {
+    __set_error_string( xfer->CSTR__error, "Synchronize operation cancelled" );
+    return -1;
+  }
+
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Send a single file as one snapshot file command. Part 0 is the file
+ * path relative to the system root, remaining parts are file data.
+ *
+ ***********************************************************************
+ */
+static int __snapshot_send_file( __snapshot_transfer_t *xfer, const char *relpath ) {
+  int ret = 0;
+  vgx_Graph_t *SYSTEM = xfer->SYSTEM;
+  FILE *file = NULL;
+  char fullpath[MAX_PATH+1] = {0};
+
+  XTRY {
+    snprintf( fullpath, MAX_PATH, "%s/%s", xfer->sysroot, relpath );
+    if( (file = CX_FOPEN( fullpath, "rb" )) == NULL ) {
+      __format_error_string( xfer->CSTR__error, "Could not open snapshot file: %s", fullpath );
+      THROW_SILENT( CXLIB_ERR_FILESYSTEM, 0x001 );
+    }
+
+    CX_FSEEK( file, 0, SEEK_END );
+    int64_t fsize = CX_FTELL( file );
+    CX_FSEEK( file, 0, SEEK_SET );
+    if( fsize < 0 ) {
+      __format_error_string( xfer->CSTR__error, "Could not determine size of snapshot file: %s", fullpath );
+      THROW_SILENT( CXLIB_ERR_FILESYSTEM, 0x002 );
+    }
+
+    objectid_t cmd_id = obid_from_string( relpath );
+    int64_t n_parts = 1 + (fsize + __SNAPSHOT_PART_SIZE - 1) / __SNAPSHOT_PART_SIZE;
+    int64_t part_id = 0;
+
+    // Part 0: relative path
+    GRAPH_LOCK( SYSTEM ) {
+      ret = iOperation.System_SYS_CS.SendSnapshotPart( SYSTEM, OPAUX_SNAPSHOT_FILE, cmd_id, n_parts, part_id++, relpath, strlen( relpath ) );
+    } GRAPH_RELEASE;
+    if( ret < 0 ) {
+      __format_error_string( xfer->CSTR__error, "Failed to capture snapshot file: %s", relpath );
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0x003 );
+    }
+
+    // Parts 1 - N: data
+    while( part_id < n_parts ) {
+      size_t n = CX_FREAD( xfer->buffer, 1, __SNAPSHOT_PART_SIZE, file );
+      if( n == 0 ) {
+        __format_error_string( xfer->CSTR__error, "Unexpected end of snapshot file: %s", fullpath );
+        THROW_SILENT( CXLIB_ERR_FILESYSTEM, 0x004 );
+      }
+      GRAPH_LOCK( SYSTEM ) {
+        ret = iOperation.System_SYS_CS.SendSnapshotPart( SYSTEM, OPAUX_SNAPSHOT_FILE, cmd_id, n_parts, part_id++, xfer->buffer, n );
+      } GRAPH_RELEASE;
+      if( ret < 0 ) {
+        __format_error_string( xfer->CSTR__error, "Failed to capture snapshot data: %s", relpath );
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x005 );
+      }
+      xfer->n_bytes += n;
+      if( ++xfer->n_uncommitted >= __SNAPSHOT_COMMIT_PARTS ) {
+        if( __snapshot_commit_and_throttle( xfer, false ) < 0 ) {
+          THROW_SILENT( CXLIB_ERR_GENERAL, 0x006 );
+        }
+      }
+    }
+
+    ++xfer->n_files;
+    ++xfer->n_uncommitted;
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+  }
+  XFINALLY {
+    if( file ) {
+      CX_FCLOSE( file );
+    }
+  }
+
+  return ret < 0 ? -1 : 0;
+}
+
+
+
+/*******************************************************************//**
+ * Send all files below directory (relative to system root)
+ *
+ ***********************************************************************
+ */
+static int __snapshot_send_dir( __snapshot_transfer_t *xfer, const char *reldir ) {
+  int ret = 0;
+  vgx_StringList_t *entries = NULL;
+  char fullpath[MAX_PATH+1] = {0};
+  char relpath[MAX_PATH+1] = {0};
+
+  snprintf( fullpath, MAX_PATH, "%s/%s", xfer->sysroot, reldir );
+  if( iString.Utility.ListDir( fullpath, "*", &entries ) < 0 ) {
+    __format_error_string( xfer->CSTR__error, "Could not list snapshot directory: %s", fullpath );
+    return -1;
+  }
+
+  int64_t sz = iString.List.Size( entries );
+  for( int64_t i=0; i<sz && ret == 0; i++ ) {
+    const char *name = iString.List.GetChars( entries, i );
+    if( CharsEqualsConst( name, "." ) || CharsEqualsConst( name, ".." ) ) {
+      continue;
+    }
+    snprintf( relpath, MAX_PATH, "%s/%s", reldir, name );
+    snprintf( fullpath, MAX_PATH, "%s/%s", xfer->sysroot, relpath );
+    if( dir_exists( fullpath ) ) {
+      ret = __snapshot_send_dir( xfer, relpath );
+    }
+    else {
+      ret = __snapshot_send_file( xfer, relpath );
+    }
+  }
+
+  iString.List.Discard( &entries );
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Synchronize graph to attached subscriber(s) by transferring the graph's
+ * persisted snapshot files instead of replaying all graph objects as
+ * individual operations.
+ *
+ * The graph is held readonly while it is persisted and its files are
+ * captured as snapshot file commands. A create graph operation follows,
+ * at which point the subscriber restores the graph from the received
+ * files. Operations captured after this point continue from the
+ * transaction position recorded in the snapshot.
+ *
+ ***********************************************************************
+ */
+static int _vxdurable_operation__sync_snapshot( vgx_Graph_t *graph, int timeout_ms, CString_t **CSTR__error ) {
+  int ret = 0;
+  vgx_Graph_t *SYSTEM = iSystem.GetSystemGraph();
+  const CString_t *CSTR__sysroot = igraphfactory.SystemRoot();
+  vgx_AccessReason_t reason = VGX_ACCESS_REASON_NONE;
+  bool readonly_here = false;
+
+  if( SYSTEM == NULL || CSTR__sysroot == NULL ) {
+    __set_error_string( CSTR__error, "System not initialized" );
+    return -1;
+  }
+
+  if( timeout_ms < 5000 ) {
+    timeout_ms = 5000;
+  }
+
+  __snapshot_transfer_t xfer = {
+    .SYSTEM         = SYSTEM,
+    .sysroot        = CStringValue( CSTR__sysroot ),
+    .timeout_ms     = timeout_ms,
+    .n_files        = 0,
+    .n_bytes        = 0,
+    .n_uncommitted  = 0,
+    .buffer         = NULL,
+    .CSTR__error    = CSTR__error
+  };
+
+  XTRY {
+    if( (xfer.buffer = malloc( __SNAPSHOT_PART_SIZE )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x001 );
+    }
+
+    GRAPH_LOCK( SYSTEM ) {
+      SYSTEM->OP.system.progress_CS->state = VGX_OPERATION_SYSTEM_STATE__SYNC_Begin;
+    } GRAPH_RELEASE;
+
+    // Hold graph readonly from before persist until the create graph
+    // operation is captured, so the transferred files and the recorded
+    // transaction position describe the same graph state
+    VXDURABLE_OPERATION_INFO( graph, 0x002, "Synchronize graph (snapshot)" );
+    if( CALLABLE( graph )->advanced->AcquireGraphReadonly( graph, timeout_ms, false, &reason ) < 1 ) {
+      __set_error_string_from_reason( CSTR__error, graph->CSTR__name, reason );
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0x003 );
+    }
+    readonly_here = true;
+    GRAPH_LOCK( graph ) {
+      _vgx_set_syncing_CS( &graph->readonly );
+    } GRAPH_RELEASE;
+
+    // Persist
+    if( CALLABLE( graph )->BulkSerialize( graph, timeout_ms, true, false, &reason, CSTR__error ) < 0 ) {
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0x004 );
+    }
+
+    objectid_t obid;
+    const char *name;
+    const char *path;
+    int block_order;
+    uint32_t t_incept;
+    int64_t opid;
+    vgx_Similarity_config_t *simconfig;
+    GRAPH_LOCK( graph ) {
+      idcpy( &obid, &graph->obid );
+      name = CStringValue( graph->CSTR__name );
+      path = CStringValue( graph->CSTR__path );
+      block_order = ivertexalloc.BlockOrder( graph->vertex_allocator );
+      t_incept = _vgx_graph_inception( graph );
+      opid = iOperation.GetId_LCK( &graph->operation );
+      simconfig = graph->similarity ? &graph->similarity->params : NULL;
+    } GRAPH_RELEASE;
+
+    // Begin: subscriber discards any previous files for this graph
+    GRAPH_LOCK( SYSTEM ) {
+      if( (ret = iOperation.System_SYS_CS.ResumeAgent( SYSTEM, timeout_ms )) < 0 ) {
+        __set_error_string( CSTR__error, "SYSTEM Output agent is suspended" );
+      }
+      else if( (ret = iOperation.System_SYS_CS.SendSnapshotPart( SYSTEM, OPAUX_SNAPSHOT_BEGIN, obid, 1, 0, path, strlen( path ) )) < 0 ) {
+        __set_error_string( CSTR__error, "Failed to capture snapshot begin" );
+      }
+    } GRAPH_RELEASE;
+    if( ret < 0 ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x005 );
+    }
+
+    // Graph files
+    if( __snapshot_send_dir( &xfer, path ) < 0 || __snapshot_commit_and_throttle( &xfer, false ) < 0 ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x006 );
+    }
+    VXDURABLE_OPERATION_INFO( graph, 0x007, "Snapshot transfer: %lld files, %lld bytes", xfer.n_files, xfer.n_bytes );
+
+    // Create graph: subscriber restores graph from transferred files
+    GRAPH_LOCK( SYSTEM ) {
+      if( (ret = iOperation.System_SYS_CS.CreateGraph( SYSTEM, &obid, name, path, block_order, t_incept, opid, simconfig )) < 0 ) {
+        __set_error_string( CSTR__error, "Failed to capture sync graph instance" );
+      }
+    } GRAPH_RELEASE;
+    if( ret < 0 ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x008 );
+    }
+
+    // Hold while output is draining
+    GRAPH_LOCK( SYSTEM ) {
+      SYSTEM->OP.system.progress_CS->state = VGX_OPERATION_SYSTEM_STATE__SYNC_Emit0;
+    } GRAPH_RELEASE;
+    if( __snapshot_commit_and_throttle( &xfer, true ) < 0 ) {
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0x009 );
+    }
+
+    // Graph writable before fence (fence resumes all emitters)
+    GRAPH_LOCK( graph ) {
+      _vgx_clear_syncing_CS( &graph->readonly );
+    } GRAPH_RELEASE;
+    CALLABLE( graph )->advanced->ReleaseGraphReadonly( graph );
+    readonly_here = false;
+
+    if( iOperation.Fence( timeout_ms ) != 1 ) {
+      VXDURABLE_OPERATION_REASON( graph, 0x00A, "Operation fence timeout after graph snapshot synchronization" );
+    }
+
+    GRAPH_LOCK( SYSTEM ) {
+      SYSTEM->OP.system.progress_CS->state = VGX_OPERATION_SYSTEM_STATE__SYNC_Emit100;
+    } GRAPH_RELEASE;
+
+    ret = 0;
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+  }
+  XFINALLY {
+    if( readonly_here ) {
+      GRAPH_LOCK( graph ) {
+        _vgx_clear_syncing_CS( &graph->readonly );
+      } GRAPH_RELEASE;
+      CALLABLE( graph )->advanced->ReleaseGraphReadonly( graph );
+    }
+    free( xfer.buffer );
+  }
+
+  return ret;
+}
+
+
+
+
 #ifdef INCLUDE_UNIT_TESTS
 #include "tests/__utest_vxdurable_operation.h"
   
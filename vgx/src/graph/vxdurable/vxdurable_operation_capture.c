@@ -1109,6 +1109,42 @@ DLL_HIDDEN int _vxdurable_operation_capture__system_send_raw_data_SYS_CS( vgx_Gr
 
 
 
+/*******************************************************************//**
+ * Capture one part of a snapshot transfer command. Unlike raw data the
+ * parts are not reassembled by the receiver, each part is applied as it
+ * arrives so that graph files of any size can be streamed.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxdurable_operation_capture__system_send_snapshot_part_SYS_CS( vgx_Graph_t *SYSTEM, OperationProcessorAuxCommand cmd, objectid_t cmd_id, int64_t n_parts, int64_t part_id, const char *data, int64_t dlen ) {
+  CAPTURE_SYSTEM_OPERATION_SYS_CS( SYSTEM, false ) {
+    vgx_Operation_t *operation = &SYSTEM->operation;
+
+    if( dlen > (1 << 15) ) {
+      return -1;
+    }
+
+    CString_t *CSTR__datapart = NewEphemeralCStringLen( SYSTEM, data, (int)dlen, 0 ); // new instance
+    if( CSTR__datapart == NULL ) {
+      return -1;
+    }
+    op_system_send_raw_data opdata = get__op_system_send_raw_data( SYSTEM, cmd, cmd_id, n_parts, part_id, CSTR__datapart );
+    iString.Discard( &CSTR__datapart ); // decref (opdata has its own ref)
+    if( opdata.CSTR__datapart == NULL ) {
+      return -1;
+    }
+
+    if( CAPTURE_CLEAN( operation, opdata ) < 0 ) {
+      CStringDelete( opdata.CSTR__datapart );
+      return -1;
+    }
+
+    return 1;
+  }
+}
+
+
+
 /*******************************************************************//**
  *
  *
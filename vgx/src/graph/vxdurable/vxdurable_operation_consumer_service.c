@@ -5443,7 +5443,7 @@ DLL_HIDDEN int _vxdurable_operation_consumer_service__is_durable_OPEN( vgx_Graph
  ***********************************************************************
  */
 SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
-DLL_HIDDEN int _vxdurable_operation_consumer_service__subscribe_OPEN( vgx_Graph_t *SYSTEM, const char *host, uint16_t port, bool hardsync, int timeout_ms, CString_t **CSTR__error ) {
+DLL_HIDDEN int _vxdurable_operation_consumer_service__subscribe_OPEN( vgx_Graph_t *SYSTEM, const char *host, uint16_t port, bool hardsync, bool snapshot, int timeout_ms, CString_t **CSTR__error ) {
   int ret = 0;
   char request_query[512] = {0};
   CString_t *CSTR__subscriber = NULL;
@@ -5466,7 +5466,7 @@ DLL_HIDDEN int _vxdurable_operation_consumer_service__subscribe_OPEN( vgx_Graph_
 
     // Build subscribe request
     const char *subscriber = CStringValue( CSTR__subscriber );
-    snprintf( request_query, 511, "uri=%s&timeout=%d", subscriber, timeout_ms );
+    snprintf( request_query, 511, "uri=%s&timeout=%d&hardsync=%d&snapshot=%d", subscriber, timeout_ms, hardsync ? 1 : 0, snapshot ? 1 : 0 );
 
     // Get subscriber uri
     if( (provider_URI = iURI.NewElements( "http", NULL, host, port, "/vgx/subscribe", request_query, NULL, CSTR__error )) == NULL ) {
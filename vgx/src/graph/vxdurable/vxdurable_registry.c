@@ -153,6 +153,7 @@ static int GraphFactory_delete_graph( const CString_t *CSTR__graph_path, const C
 static int GraphFactory_size( void );
 static const vgx_Graph_t ** GraphFactory_list_graphs( int64_t *n_graphs );
 static int GraphFactory_sync_all_graphs( bool hard, int timeout_ms, CString_t **CSTR__error );
+static int GraphFactory_sync_all_graphs_snapshot( int timeout_ms, CString_t **CSTR__error );
 static int GraphFactory_cancel_sync( void );
 static bool GraphFactory_is_sync_active( void );
 static objectid_t GraphFactory_unique_label( void );
@@ -205,6 +206,7 @@ DLL_EXPORT vgx_IGraphFactory_t igraphfactory = {
   .Size                     = GraphFactory_size,
   .ListGraphs               = GraphFactory_list_graphs,
   .SyncAllGraphs            = GraphFactory_sync_all_graphs,
+  .SyncAllGraphsSnapshot    = GraphFactory_sync_all_graphs_snapshot,
   .CancelSync               = GraphFactory_cancel_sync,
   .IsSyncActive             = GraphFactory_is_sync_active,
   .UniqueLabel              = GraphFactory_unique_label,
@@ -1654,7 +1656,7 @@ static const vgx_Graph_t ** GraphFactory_list_graphs( int64_t *n_graphs ) {
  *
  ***********************************************************************
  */
-static int GraphFactory_sync_all_graphs( bool hard, int timeout_ms, CString_t **CSTR__error ) {
+static int __sync_all_graphs( bool hard, bool snapshot, int timeout_ms, CString_t **CSTR__error ) {
   if( !GraphFactory_is_initialized() ) {
     return -1;
   }
@@ -1701,7 +1703,7 @@ static int GraphFactory_sync_all_graphs( bool hard, int timeout_ms, CString_t **
     // Hard sync: Clear Registry
     // -------------------------
     if( hard ) {
-      VXDURABLE_REGISTRY_INFO( 0x002, "SYSTEM HARD SYNC: Start" );
+      VXDURABLE_REGISTRY_INFO( 0x002, "SYSTEM HARD SYNC%s: Start", snapshot ? " (SNAPSHOT)" : "" );
       if( iOperation.System_SYS_CS.ClearRegistry( SYSTEM ) < 1 ) {
         __set_error_string( CSTR__error, "Failed to initiate hard sync: Clear Registry could not be performed" );
         THROW_SILENT( CXLIB_ERR_GENERAL, 0x002 );
@@ -1744,7 +1746,12 @@ static int GraphFactory_sync_all_graphs( bool hard, int timeout_ms, CString_t **
         cursor = (vgx_Graph_t**)graphs;
         while( err == 0 && (graph = *cursor++) != NULL ) {
           // Perform sync
-          if( iOperation.Graph_OPEN.Sync( graph, hard, timeout_ms, CSTR__error ) != 0 ) {
+          if( snapshot ) {
+            if( iOperation.Graph_OPEN.SyncSnapshot( graph, timeout_ms, CSTR__error ) != 0 ) {
+              --err;
+            }
+          }
+          else if( iOperation.Graph_OPEN.Sync( graph, hard, timeout_ms, CSTR__error ) != 0 ) {
             --err;
           }
         }
@@ -1786,6 +1793,29 @@ static int GraphFactory_sync_all_graphs( bool hard, int timeout_ms, CString_t **
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int GraphFactory_sync_all_graphs( bool hard, int timeout_ms, CString_t **CSTR__error ) {
+  return __sync_all_graphs( hard, false, timeout_ms, CSTR__error );
+}
+
+
+
+/*******************************************************************//**
+ * Synchronize by transferring each graph's persisted snapshot. Snapshot
+ * sync replaces all subscriber graphs and therefore implies hard sync.
+ *
+ ***********************************************************************
+ */
+static int GraphFactory_sync_all_graphs_snapshot( int timeout_ms, CString_t **CSTR__error ) {
+  return __sync_all_graphs( true, true, timeout_ms, CSTR__error );
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -2007,7 +2037,7 @@ static int GraphFactory_earliest_durable_transaction( objectid_t *txid, int64_t
               }
             }
             // Count number of serializing graphs
-            if( n_serializing && _vgx_is_serializing_CS( &graph->readonly ) ) {
+            if( n_serializing && (_vgx_is_serializing_CS( &graph->readonly ) || _vgx_is_snapshotting_CS( &graph->readonly )) ) {
               ++(*n_serializing);
             }
           } GRAPH_RELEASE;
@@ -25,6 +25,12 @@
 
 #include "_vgx_serialization.h"
 
+#ifndef CXPLAT_WINDOWS_X64
+#include <sys/wait.h>
+#include <poll.h>
+#include <signal.h>
+#endif
+
 /* exception module */
 SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
 
@@ -49,6 +55,7 @@ static int64_t _vxdurable_serialization__expect_end_section( CQwordQueue_t *__IN
 
 static void _vxdurable_serialization__print_graph_counts_ROG( vgx_Graph_t *self, const char *message );
 static int64_t _vxdurable_serialization__bulk_serialize( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, bool force, bool remote, CString_t **CSTR__error );
+static int64_t _vxdurable_serialization__bulk_serialize_background( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, bool remote, CString_t **CSTR__error );
 static graph_state_t * _vxdurable_serialization__load_state( vgx_Graph_t *self );
 
 
@@ -95,6 +102,7 @@ DLL_HIDDEN vgx_ISerialization_t iSerialization = {
 
   .PrintGraphCounts_ROG     = _vxdurable_serialization__print_graph_counts_ROG,
   .BulkSerialize            = _vxdurable_serialization__bulk_serialize,
+  .BulkSerializeBackground  = _vxdurable_serialization__bulk_serialize_background,
   .LoadState                = _vxdurable_serialization__load_state
 };
 
@@ -1358,91 +1366,206 @@ static void _vxdurable_serialization__print_graph_counts_ROG( vgx_Graph_t *self,
 
 
 /*******************************************************************//**
+ * Write all graph data to disk. The graph must be readonly.
  *
- *
+ * Returns the number of qwords written, or -1 on error.
  ***********************************************************************
  */
-static int64_t _vxdurable_serialization__bulk_serialize( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, bool force, bool remote, CString_t **CSTR__error ) {
-
+static int64_t __serialize_graph_data( vgx_Graph_t *self, uint32_t ts_start, int readonly, bool force, CString_t **CSTR__error ) {
   int64_t __NQWORDS = 0;
   int64_t value;
-  uint32_t ts_start = __SECONDS_SINCE_1970(); 
-  int64_t t0 = __GET_CURRENT_MILLISECOND_TICK(); 
+
+  const char *path = CALLABLE( self )->FullPath( self );
+
+  XTRY {
+    // TODO: Create a persistent metas file within the graph structure (not the registry)
+    //       that will hold important graph information to be restored, such as opcount and
+    //       maybe other things. Right now it is in the REGISTRY and the opcount doesn't get
+    //       saved when we save a graph because the registry doesn't get saved here.
+
+    // [11] similarity
+    EVAL_OR_THROW( CALLABLE( self->similarity )->BulkSerialize( self->similarity, force ), 0xB28 );
+    
+    // [17] property_allocator_context allocator
+    cxmalloc_family_t *property_allocator = (cxmalloc_family_t*)self->property_allocator_context->allocator;
+    value = CALLABLE( property_allocator )->Bytes( property_allocator );
+    VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB29, "Serializing: properties (%lld bytes)", value );
+    EVAL_OR_THROW( CALLABLE( property_allocator )->BulkSerialize( property_allocator, force ), 0xB2A );
+
+    // [18 - 23] enumerators
+    int64_t enum_qwords = __serialize_enumerators( self, path, force, CSTR__error );
+    if( enum_qwords < 0 ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0xB2B );
+    }
+    __NQWORDS += enum_qwords;
+
+    // [24] vertex_allocator
+    value = CALLABLE( self->vertex_allocator )->Bytes( self->vertex_allocator );
+    VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB2C, "Serializing: vertices and arcs (%lld bytes)", value );
+    EVAL_OR_THROW( CALLABLE( self->vertex_allocator )->BulkSerialize( self->vertex_allocator, force ), 0xB2D );
+
+    // [25] vxtable
+    value = CALLABLE( self->vxtable )->Items( self->vxtable );
+    VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB2E, "Serializing: global vertex index (%lld vertices)", value );
+    EVAL_OR_THROW( CALLABLE( self->vxtable )->BulkSerialize( self->vxtable, force ), 0xB2F );
+
+    // [26] vxtypeidx
+    for( vgx_vertex_type_t vxtype = __VERTEX_TYPE_ENUMERATION_START_SYS_RANGE; vxtype <= __VERTEX_TYPE_ENUMERATION_END_USER_RANGE; vxtype++ ) {
+      framehash_t *index = self->vxtypeidx[ vxtype ];
+      if( index ) {
+        int64_t n_items = CALLABLE( index )->Items( index );
+        // Empty, delete file from disk
+        if( n_items == 0 ) {
+          if( CALLABLE( index )->Erase( index ) < 0 ) {
+            VXDURABLE_SERIALIZATION_WARNING( self, 0xB30, "Failed to remove type index [%02x] from disk", vxtype );
+          }
+        }
+        // Non-empty, serialize memory to file
+        else if( iEnumerator_CS.VertexType.ExistsEnum( self, vxtype ) ) {
+#ifdef HASVERBOSE
+          const CString_t *CSTR__vxtype = iEnumerator_CS.VertexType.Decode( self, vxtype );
+          VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB31, "Serializing: vertex index type '%s' (%lld vertices)", (CSTR__vxtype ? CStringValue( CSTR__vxtype ) : "?"), n_items );
+#endif
+          EVAL_OR_THROW( CALLABLE( index )->BulkSerialize( index, force ), 0xB32 );
+        }
+        //
+        else {
+          VXDURABLE_SERIALIZATION_REASON( self, 0xB33, "Type index [%02x] maps %lld vertices but no type enumeration exists", vxtype, n_items );
+        }
+      }
+    }
+
+    // Graph state
+    int64_t summary_qwords = __serialize_state( self, ts_start, readonly );
+    if( summary_qwords < 0 ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0xB34 );
+    }
+    __NQWORDS += summary_qwords;
+
+#ifdef VGX_CONSISTENCY_CHECK
+    if( CALLABLE( self )->advanced->DebugCheckAllocators( self, NULL ) < 0 ) {
+      THROW_CRITICAL_MESSAGE( CXLIB_ERR_CORRUPTION, 0xB35, "Allocators corrupted after persist" );
+    }
+#endif
+  }
+  XCATCH( errcode ) {
+    __NQWORDS = -1;
+  }
+  XFINALLY {
+  }
+
+  return __NQWORDS;
+}
+
+
+
+/*******************************************************************//**
+ * Check that serialization can proceed and acquire the graph readonly.
+ * On success the graph is readonly and marked as serializing, and the
+ * previous readonly state of the graph is returned in *readonly.
+ *
+ * Returns true if serialization can proceed, false otherwise with
+ * error set in CSTR__error.
+ ***********************************************************************
+ */
+static bool __begin_serialization_CS( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, int *readonly, CString_t **CSTR__error ) {
 
   // Optimistic start
   bool serialization_can_proceed = true;
-  bool dirty = true;
 
   const char *path = CALLABLE( self )->FullPath( self );
 
-  int readonly = 0;
-  vgx_graph_base_counts_t counts = {0};
+  // Check if another thread is already running serialization, or a background snapshot is in progress
+  if( _vgx_is_serializing_CS( &self->readonly ) || _vgx_is_snapshotting_CS( &self->readonly ) ) {
+    __set_error_string( CSTR__error, "Serialization already running" );
+    // Sorry, another thread already running serialization.
+    serialization_can_proceed = false;
+  }
 
-  _vgx_start_graph_execution_timing_budget( self, timing_budget );
-  GRAPH_LOCK( self ) {
+  // PROCEED - no other thread serializing
+  if( serialization_can_proceed ) {
 
-    // Check if another thread is already running serialization
-    if( _vgx_is_serializing_CS( &self->readonly ) ) {
-      __set_error_string( CSTR__error, "Serialization already running" );
-      // Sorry, another thread already running serialization.
+    // Check if current thread holds any vertex locks
+    if( _vxgraph_tracker__has_writable_locks_CS( self ) || _vxgraph_tracker__has_readonly_locks_CS( self ) ) {
+      int64_t nw = 0;
+      int64_t nr = 0;
+      CString_t *CSTR__writable = _vxgraph_tracker__writable_vertices_as_cstring_CS( self, &nw );
+      CString_t *CSTR__readonly = _vxgraph_tracker__readonly_vertices_as_cstring_CS( self, &nr );
+      if( CSTR__writable || CSTR__readonly ) {
+        __format_error_string( CSTR__error, "Cannot serialize when current thread holds %lld vertex locks ( writable:[%s]  readonly:[%s] )",
+          nw + nr,
+          CSTR__writable ? CStringValue( CSTR__writable ) : "",
+          CSTR__readonly ? CStringValue( CSTR__readonly ) : ""
+        );
+        if( CSTR__writable ) {
+          CStringDelete( CSTR__writable );
+        }
+        if( CSTR__readonly ) {
+          CStringDelete( CSTR__readonly );
+        }
+      }
+      else {
+        __set_error_string( CSTR__error, "Cannot serialize when current thread holds vertex locks. (Failed to gather vertex information.)" );
+      }
+      // Sorry, current thread holds vertex locks
+      serialization_can_proceed = false;
+    }
+    // Check if this is SYSTEM graph and if consumer service is running
+    else if( iSystem.IsSystemGraph( self ) && iOperation.System_OPEN.ConsumerService.BoundPort( iSystem.GetSystemGraph() ) ) {
+      __set_error_string( CSTR__error, "Cannot serialize SYSTEM graph while consumer service is running" );
       serialization_can_proceed = false;
     }
 
-    // PROCEED - no other thread serializing
+    // PROCEED - no vertex locks held by current thread
     if( serialization_can_proceed ) {
-
-      // Check if current thread holds any vertex locks
-      if( _vxgraph_tracker__has_writable_locks_CS( self ) || _vxgraph_tracker__has_readonly_locks_CS( self ) ) {
-        int64_t nw = 0;
-        int64_t nr = 0;
-        CString_t *CSTR__writable = _vxgraph_tracker__writable_vertices_as_cstring_CS( self, &nw );
-        CString_t *CSTR__readonly = _vxgraph_tracker__readonly_vertices_as_cstring_CS( self, &nr );
-        if( CSTR__writable || CSTR__readonly ) {
-          __format_error_string( CSTR__error, "Cannot serialize when current thread holds %lld vertex locks ( writable:[%s]  readonly:[%s] )",
-            nw + nr,
-            CSTR__writable ? CStringValue( CSTR__writable ) : "",
-            CSTR__readonly ? CStringValue( CSTR__readonly ) : ""
-          );
-          if( CSTR__writable ) {
-            CStringDelete( CSTR__writable );
-          }
-          if( CSTR__readonly ) {
-            CStringDelete( CSTR__readonly );
-          }
-        }
-        else {
-          __set_error_string( CSTR__error, "Cannot serialize when current thread holds vertex locks. (Failed to gather vertex information.)" );
-        }
-        // Sorry, current thread holds vertex locks
-        serialization_can_proceed = false;
-      }
-      // Check if this is SYSTEM graph and if consumer service is running
-      else if( iSystem.IsSystemGraph( self ) && iOperation.System_OPEN.ConsumerService.BoundPort( iSystem.GetSystemGraph() ) ) {
-        __set_error_string( CSTR__error, "Cannot serialize SYSTEM graph while consumer service is running" );
+      // Already readonly? Will be recorded in the save state. Readonly held
+      // only by snapshot sync is not recorded.
+      *readonly = _vgx_is_readonly_CS( &self->readonly ) && !_vgx_is_readonly_by_sync_only_CS( &self->readonly );
+
+      // Acquire the graph readonly during serialization
+      if( _vxgraph_state__acquire_graph_readonly_CS( self, false, timing_budget ) < 1 ) {
+        int rodis = _vgx_get_disallow_readonly_recursion_CS( &self->readonly );
+        int64_t wlc = _vgx_graph_get_vertex_WL_count_CS( self );
+        __format_error_string( CSTR__error, "Cannot serialize, unable to acquire graph '%s' readonly (%03X). (WL vertices: %lld, RO disallowed: %d)", path, timing_budget->reason, wlc, rodis );
+        // Sorry, write locks exist by other threads.
         serialization_can_proceed = false;
       }
 
-      // PROCEED - no vertex locks held by current thread
+      // PROCEED - we have the graph readonly and ready to serialize!
       if( serialization_can_proceed ) {
-        // Already readonly? Will be recorded in the save state
-        readonly = _vgx_is_readonly_CS( &self->readonly );
-
-        // Acquire the graph readonly during serialization
-        if( _vxgraph_state__acquire_graph_readonly_CS( self, false, timing_budget ) < 1 ) {
-          int rodis = _vgx_get_disallow_readonly_recursion_CS( &self->readonly );
-          int64_t wlc = _vgx_graph_get_vertex_WL_count_CS( self );
-          __format_error_string( CSTR__error, "Cannot serialize, unable to acquire graph '%s' readonly (%03X). (WL vertices: %lld, RO disallowed: %d)", path, timing_budget->reason, wlc, rodis );
-          // Sorry, write locks exist by other threads.
-          serialization_can_proceed = false;
-        }
-
-        // PROCEED - we have the graph readonly and ready to serialize!
-        if( serialization_can_proceed ) {
-          // Mark graph as being serialized
-          _vgx_set_serializing_CS( &self->readonly );
-        }
+        // Mark graph as being serialized
+        _vgx_set_serializing_CS( &self->readonly );
       }
     }
+  }
+
+  return serialization_can_proceed;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t _vxdurable_serialization__bulk_serialize( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, bool force, bool remote, CString_t **CSTR__error ) {
+
+  int64_t __NQWORDS = 0;
+  uint32_t ts_start = __SECONDS_SINCE_1970(); 
+  int64_t t0 = __GET_CURRENT_MILLISECOND_TICK(); 
+
+  bool serialization_can_proceed = false;
+  bool dirty = true;
+
+  const char *path = CALLABLE( self )->FullPath( self );
+
+  int readonly = 0;
+  vgx_graph_base_counts_t counts = {0};
+
+  _vgx_start_graph_execution_timing_budget( self, timing_budget );
+  GRAPH_LOCK( self ) {
+    serialization_can_proceed = __begin_serialization_CS( self, timing_budget, &readonly, CSTR__error );
   } GRAPH_RELEASE;
 
   // We are ready to serialize!
@@ -1472,75 +1595,12 @@ static int64_t _vxdurable_serialization__bulk_serialize( vgx_Graph_t *self, vgx_
           }
         }
 
-        // TODO: Create a persistent metas file within the graph structure (not the registry)
-        //       that will hold important graph information to be restored, such as opcount and
-        //       maybe other things. Right now it is in the REGISTRY and the opcount doesn't get
-        //       saved when we save a graph because the registry doesn't get saved here.
-
-        // [11] similarity
-        EVAL_OR_THROW( CALLABLE( self->similarity )->BulkSerialize( self->similarity, force ), 0xB28 );
-        
-        // [17] property_allocator_context allocator
-        cxmalloc_family_t *property_allocator = (cxmalloc_family_t*)self->property_allocator_context->allocator;
-        value = CALLABLE( property_allocator )->Bytes( property_allocator );
-        VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB29, "Serializing: properties (%lld bytes)", value );
-        EVAL_OR_THROW( CALLABLE( property_allocator )->BulkSerialize( property_allocator, force ), 0xB2A );
-
-        // [18 - 23] enumerators
-        int64_t enum_qwords = __serialize_enumerators( self, path, force, CSTR__error );
-        if( enum_qwords < 0 ) {
-          THROW_ERROR( CXLIB_ERR_GENERAL, 0xB2B );
-        }
-        __NQWORDS += enum_qwords;
-
-        // [24] vertex_allocator
-        value = CALLABLE( self->vertex_allocator )->Bytes( self->vertex_allocator );
-        VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB2C, "Serializing: vertices and arcs (%lld bytes)", value );
-        EVAL_OR_THROW( CALLABLE( self->vertex_allocator )->BulkSerialize( self->vertex_allocator, force ), 0xB2D );
-
-        // [25] vxtable
-        value = CALLABLE( self->vxtable )->Items( self->vxtable );
-        VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB2E, "Serializing: global vertex index (%lld vertices)", value );
-        EVAL_OR_THROW( CALLABLE( self->vxtable )->BulkSerialize( self->vxtable, force ), 0xB2F );
-
-        // [26] vxtypeidx
-        for( vgx_vertex_type_t vxtype = __VERTEX_TYPE_ENUMERATION_START_SYS_RANGE; vxtype <= __VERTEX_TYPE_ENUMERATION_END_USER_RANGE; vxtype++ ) {
-          framehash_t *index = self->vxtypeidx[ vxtype ];
-          if( index ) {
-            int64_t n_items = CALLABLE( index )->Items( index );
-            // Empty, delete file from disk
-            if( n_items == 0 ) {
-              if( CALLABLE( index )->Erase( index ) < 0 ) {
-                VXDURABLE_SERIALIZATION_WARNING( self, 0xB30, "Failed to remove type index [%02x] from disk", vxtype );
-              }
-            }
-            // Non-empty, serialize memory to file
-            else if( iEnumerator_CS.VertexType.ExistsEnum( self, vxtype ) ) {
-#ifdef HASVERBOSE
-              const CString_t *CSTR__vxtype = iEnumerator_CS.VertexType.Decode( self, vxtype );
-              VXDURABLE_SERIALIZATION_VERBOSE( self, 0xB31, "Serializing: vertex index type '%s' (%lld vertices)", (CSTR__vxtype ? CStringValue( CSTR__vxtype ) : "?"), n_items );
-#endif
-              EVAL_OR_THROW( CALLABLE( index )->BulkSerialize( index, force ), 0xB32 );
-            }
-            //
-            else {
-              VXDURABLE_SERIALIZATION_REASON( self, 0xB33, "Type index [%02x] maps %lld vertices but no type enumeration exists", vxtype, n_items );
-            }
-          }
-        }
-
-        // Graph state
-        int64_t summary_qwords = __serialize_state( self, ts_start, readonly );
-        if( summary_qwords < 0 ) {
-          THROW_ERROR( CXLIB_ERR_GENERAL, 0xB34 );
+        // Graph data
+        int64_t data_qwords = __serialize_graph_data( self, ts_start, readonly, force, CSTR__error );
+        if( data_qwords < 0 ) {
+          THROW_ERROR( CXLIB_ERR_GENERAL, 0xB40 );
         }
-        __NQWORDS += summary_qwords;
-
-#ifdef VGX_CONSISTENCY_CHECK
-        if( CALLABLE( self )->advanced->DebugCheckAllocators( self, NULL ) < 0 ) {
-          THROW_CRITICAL_MESSAGE( CXLIB_ERR_CORRUPTION, 0xB35, "Allocators corrupted after persist" );
-        }
-#endif
+        __NQWORDS += data_qwords;
 
         // Virtual properties commit point
         if( _vxvertex_property__virtual_properties_commit( self ) < 0 ) {
@@ -1641,6 +1701,517 @@ static int64_t _vxdurable_serialization__bulk_serialize( vgx_Graph_t *self, vgx_
 
 
 
+#ifndef CXPLAT_WINDOWS_X64
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+typedef struct s_snapshot_result_t {
+  int64_t nqwords;
+  int64_t persisted_ts;
+} snapshot_result_t;
+
+
+
+/*******************************************************************//**
+ * Allocator and index locks that must be quiescent across fork()
+ *
+ ***********************************************************************
+ */
+typedef struct s_snapshot_fork_locks_t {
+  int n_families;
+  int n_locks;
+  int max_families;
+  int max_locks;
+  cxmalloc_family_t **families;
+  CS_LOCK **locks;
+} snapshot_fork_locks_t;
+
+
+#define VXDURABLE_SNAPSHOT_FORK_LOCK_TIMEOUT_MS 10000
+#define VXDURABLE_SNAPSHOT_CHILD_TIMEOUT_MS     (6 * 3600 * 1000)
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __snapshot_fork_locks_add_family( snapshot_fork_locks_t *fork_locks, cxmalloc_family_t *family ) {
+  if( family == NULL || fork_locks->n_families >= fork_locks->max_families ) {
+    return;
+  }
+  for( int i=0; i<fork_locks->n_families; i++ ) {
+    if( fork_locks->families[i] == family ) {
+      return;
+    }
+  }
+  fork_locks->families[ fork_locks->n_families++ ] = family;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __snapshot_fork_locks_add_lock( snapshot_fork_locks_t *fork_locks, CS_LOCK *lock ) {
+  if( lock == NULL || fork_locks->n_locks >= fork_locks->max_locks ) {
+    return;
+  }
+  for( int i=0; i<fork_locks->n_locks; i++ ) {
+    if( fork_locks->locks[i] == lock ) {
+      return;
+    }
+  }
+  fork_locks->locks[ fork_locks->n_locks++ ] = lock;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __snapshot_fork_locks_add_dynamic( snapshot_fork_locks_t *fork_locks, framehash_dynamic_t *dynamic ) {
+  __snapshot_fork_locks_add_lock( fork_locks, &dynamic->lock );
+  __snapshot_fork_locks_add_family( fork_locks, dynamic->falloc );
+  __snapshot_fork_locks_add_family( fork_locks, dynamic->balloc );
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __snapshot_fork_locks_add_framehash( snapshot_fork_locks_t *fork_locks, framehash_t *framehash ) {
+  if( framehash ) {
+    __snapshot_fork_locks_add_lock( fork_locks, framehash->_plock );
+    __snapshot_fork_locks_add_family( fork_locks, framehash->_dynamic.falloc );
+    __snapshot_fork_locks_add_family( fork_locks, framehash->_dynamic.balloc );
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __snapshot_fork_locks_clear( snapshot_fork_locks_t *fork_locks ) {
+  free( fork_locks->families );
+  free( fork_locks->locks );
+  memset( fork_locks, 0, sizeof( snapshot_fork_locks_t ) );
+}
+
+
+
+/*******************************************************************//**
+ * Collect the locks of all allocators and indexes used by the snapshot
+ * writer. Any thread inside one of these at the fork point would leave
+ * the lock held forever in the child.
+ *
+ ***********************************************************************
+ */
+static int __snapshot_fork_locks_collect_CS( vgx_Graph_t *self, snapshot_fork_locks_t *fork_locks ) {
+  memset( fork_locks, 0, sizeof( snapshot_fork_locks_t ) );
+
+  int max_framehash = 16 + __VERTEX_TYPE_ENUMERATION_END_USER_RANGE + 1;
+  fork_locks->max_families = 16 + 2 * max_framehash;
+  fork_locks->max_locks = 4 + max_framehash;
+  if( (fork_locks->families = calloc( fork_locks->max_families, sizeof( cxmalloc_family_t* ) )) == NULL ||
+      (fork_locks->locks = calloc( fork_locks->max_locks, sizeof( CS_LOCK* ) )) == NULL )
+  {
+    __snapshot_fork_locks_clear( fork_locks );
+    return -1;
+  }
+
+  // Index locks first, they are taken before allocator locks in normal operation
+  __snapshot_fork_locks_add_dynamic( fork_locks, &self->arcvector_fhdyn );
+  __snapshot_fork_locks_add_dynamic( fork_locks, &self->property_fhdyn );
+  __snapshot_fork_locks_add_dynamic( fork_locks, &self->vtxmap_fhdyn );
+  __snapshot_fork_locks_add_framehash( fork_locks, self->vxtype_encoder );
+  __snapshot_fork_locks_add_framehash( fork_locks, self->vxtype_decoder );
+  __snapshot_fork_locks_add_framehash( fork_locks, self->rel_encoder );
+  __snapshot_fork_locks_add_framehash( fork_locks, self->rel_decoder );
+  __snapshot_fork_locks_add_framehash( fork_locks, self->vxprop_keymap );
+  __snapshot_fork_locks_add_framehash( fork_locks, self->vxprop_valmap );
+  __snapshot_fork_locks_add_framehash( fork_locks, self->vxtable );
+  if( self->vxtypeidx ) {
+    for( vgx_vertex_type_t vxtype = __VERTEX_TYPE_ENUMERATION_START_SYS_RANGE; vxtype <= __VERTEX_TYPE_ENUMERATION_END_USER_RANGE; vxtype++ ) {
+      __snapshot_fork_locks_add_framehash( fork_locks, self->vxtypeidx[ vxtype ] );
+    }
+  }
+  if( self->similarity ) {
+    vgx_Similarity_t *sim = self->similarity;
+    __snapshot_fork_locks_add_framehash( fork_locks, sim->dim_encoder );
+    __snapshot_fork_locks_add_framehash( fork_locks, sim->dim_decoder );
+    if( sim->dimension_allocator_context ) {
+      __snapshot_fork_locks_add_family( fork_locks, (cxmalloc_family_t*)sim->dimension_allocator_context->allocator );
+    }
+    __snapshot_fork_locks_add_family( fork_locks, sim->int_vector_allocator );
+    __snapshot_fork_locks_add_family( fork_locks, sim->ext_vector_allocator );
+  }
+  if( self->ephemeral_string_allocator_context ) {
+    __snapshot_fork_locks_add_family( fork_locks, (cxmalloc_family_t*)self->ephemeral_string_allocator_context->allocator );
+  }
+  if( self->property_allocator_context ) {
+    __snapshot_fork_locks_add_family( fork_locks, (cxmalloc_family_t*)self->property_allocator_context->allocator );
+  }
+  __snapshot_fork_locks_add_family( fork_locks, self->vertex_allocator );
+
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __snapshot_fork_locks_release( snapshot_fork_locks_t *fork_locks, int n_families, int n_locks ) {
+  cxmalloc_family_vtable_t *iFamily = (cxmalloc_family_vtable_t*)COMLIB_CLASS_VTABLE( cxmalloc_family_t );
+  while( --n_families >= 0 ) {
+    iFamily->ForkParent( fork_locks->families[ n_families ] );
+  }
+  while( --n_locks >= 0 ) {
+    LEAVE_CRITICAL_SECTION( &fork_locks->locks[ n_locks ]->lock );
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Take all collected locks without blocking while holding the graph lock.
+ * When a lock is busy everything is released and the attempt is repeated
+ * with the graph lock suspended, until the timeout expires.
+ *
+ * Returns:  1 : All locks held
+ *           0 : Timeout
+ ***********************************************************************
+ */
+static int __snapshot_fork_locks_acquire_CS( vgx_Graph_t *self, snapshot_fork_locks_t *fork_locks ) {
+  cxmalloc_family_vtable_t *iFamily = (cxmalloc_family_vtable_t*)COMLIB_CLASS_VTABLE( cxmalloc_family_t );
+  int64_t deadline = __GET_CURRENT_MILLISECOND_TICK() + VXDURABLE_SNAPSHOT_FORK_LOCK_TIMEOUT_MS;
+  for(;;) {
+    int n_locks = 0;
+    int n_families = 0;
+    while( n_locks < fork_locks->n_locks && TRY_CRITICAL_SECTION( &fork_locks->locks[ n_locks ]->lock ) ) {
+      ++n_locks;
+    }
+    if( n_locks == fork_locks->n_locks ) {
+      while( n_families < fork_locks->n_families && iFamily->ForkPrepare( fork_locks->families[ n_families ] ) ) {
+        ++n_families;
+      }
+      if( n_families == fork_locks->n_families ) {
+        return 1;
+      }
+    }
+    __snapshot_fork_locks_release( fork_locks, n_families, n_locks );
+    if( __GET_CURRENT_MILLISECOND_TICK() > deadline ) {
+      return 0;
+    }
+    GRAPH_SUSPEND_LOCK( self ) {
+      sleep_milliseconds( 1 );
+    } GRAPH_RESUME_LOCK;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Reinitialize collected locks in the child after fork(). They were held
+ * by the forking thread in the parent and cannot be released here.
+ *
+ ***********************************************************************
+ */
+static void __snapshot_fork_locks_reset_after_fork( snapshot_fork_locks_t *fork_locks ) {
+  cxmalloc_family_vtable_t *iFamily = (cxmalloc_family_vtable_t*)COMLIB_CLASS_VTABLE( cxmalloc_family_t );
+  for( int i=0; i<fork_locks->n_families; i++ ) {
+    iFamily->ForkChild( fork_locks->families[i] );
+  }
+  for( int i=0; i<fork_locks->n_locks; i++ ) {
+    INIT_CRITICAL_SECTION( &fork_locks->locks[i]->lock );
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Snapshot process entry point. Runs in the child after fork() and
+ * never returns.
+ *
+ * The child is a point-in-time copy of the parent. Only the forking
+ * thread exists in the child, so locks held by other parent threads at
+ * the fork point would never be released. The fork point is inside the
+ * graph lock with the graph readonly, which means no writers are active,
+ * and the forking thread holds all allocator and index locks used by the
+ * snapshot writer, which means no other thread is inside them. These locks
+ * and the output stream lock are owned by the forking thread and must be
+ * reset before they can be used in the child.
+ ***********************************************************************
+ */
+static void __serialize_snapshot_child( vgx_Graph_t *self, snapshot_fork_locks_t *fork_locks, int fd, uint32_t ts_start, int readonly ) {
+  INIT_CRITICAL_SECTION( &self->state_lock.lock );
+  self->__state_lock_count = 0;
+  __snapshot_fork_locks_reset_after_fork( fork_locks );
+  cxlib_ostream_reset_after_fork();
+
+  snapshot_result_t result = {
+    .nqwords      = __serialize_graph_data( self, ts_start, readonly, false, NULL ),
+    .persisted_ts = self->persisted_ts
+  };
+
+  if( write( fd, &result, sizeof( result ) ) != sizeof( result ) ) {
+    result.nqwords = -1;
+  }
+  close( fd );
+
+  _exit( result.nqwords < 0 ? 1 : 0 );
+}
+
+
+
+/*******************************************************************//**
+ * Wait for snapshot process to complete and return its result.
+ *
+ * The child is killed if it has not completed within timeout_ms.
+ ***********************************************************************
+ */
+static snapshot_result_t __wait_snapshot_child( pid_t pid, int fd, int64_t timeout_ms, bool *timed_out ) {
+  snapshot_result_t result = {
+    .nqwords      = -1,
+    .persisted_ts = 0
+  };
+  char *p = (char*)&result;
+  size_t remain = sizeof( result );
+  bool eof = false;
+  bool exited = false;
+  int status = 0;
+  int64_t deadline = __GET_CURRENT_MILLISECOND_TICK() + timeout_ms;
+
+  *timed_out = false;
+
+  while( !exited ) {
+    // Collect result as it becomes available
+    if( !eof ) {
+      struct pollfd pfd = { .fd = fd, .events = POLLIN, .revents = 0 };
+      int n_ready = poll( &pfd, 1, 100 );
+      if( n_ready > 0 ) {
+        ssize_t n = read( fd, p, remain );
+        if( n > 0 ) {
+          p += n;
+          remain -= n;
+          eof = remain == 0;
+        }
+        else if( n == 0 || errno != EINTR ) {
+          eof = true;
+        }
+      }
+      else if( n_ready < 0 && errno != EINTR ) {
+        eof = true;
+      }
+    }
+    else {
+      sleep_milliseconds( 100 );
+    }
+
+    // Check child
+    pid_t w = waitpid( pid, &status, WNOHANG );
+    if( w == pid ) {
+      exited = true;
+    }
+    else if( w < 0 && errno != EINTR ) {
+      status = -1;
+      exited = true;
+    }
+    else if( __GET_CURRENT_MILLISECOND_TICK() > deadline ) {
+      *timed_out = true;
+      kill( pid, SIGKILL );
+      while( waitpid( pid, &status, 0 ) < 0 && errno == EINTR );
+      status = -1;
+      exited = true;
+    }
+  }
+
+  // Child has exited, drain remaining result
+  while( !*timed_out && remain > 0 ) {
+    ssize_t n = read( fd, p, remain );
+    if( n > 0 ) {
+      p += n;
+      remain -= n;
+    }
+    else if( n == 0 || errno != EINTR ) {
+      break;
+    }
+  }
+
+  if( remain > 0 || status == -1 || !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ) {
+    result.nqwords = -1;
+  }
+
+  return result;
+}
+#endif
+
+
+
+/*******************************************************************//**
+ * Persist a point-in-time snapshot of the graph without blocking writers.
+ *
+ * The graph is made readonly only for the duration of fork(). The child
+ * process writes the snapshot from its copy-on-write image while the
+ * graph remains writable in this process. The calling thread waits for
+ * the snapshot to complete.
+ *
+ * The snapshot includes all transactions consumed up to the fork point.
+ * On success this becomes the graph's durability point, and transactions
+ * after it are replayed from the transaction log on restore.
+ *
+ * Incremental only. Blocks already clean on disk are skipped as usual,
+ * but modification tracking in this process is not cleared, so the next
+ * persist rewrites blocks written by the snapshot.
+ *
+ ***********************************************************************
+ */
+static int64_t _vxdurable_serialization__bulk_serialize_background( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, bool remote, CString_t **CSTR__error ) {
+#ifdef CXPLAT_WINDOWS_X64
+  __set_error_string( CSTR__error, "Background serialization not supported on this platform" );
+  return -1;
+#else
+
+  int64_t __NQWORDS = -1;
+  uint32_t ts_start = __SECONDS_SINCE_1970(); 
+  int64_t t0 = __GET_CURRENT_MILLISECOND_TICK(); 
+
+  const char *path = CALLABLE( self )->FullPath( self );
+
+  int readonly = 0;
+  vgx_graph_base_counts_t counts = {0};
+
+  objectid_t snapshot_tx_id = {0};
+  int64_t snapshot_tx_serial = 0;
+  pid_t pid = -1;
+  bool timed_out = false;
+  snapshot_fork_locks_t fork_locks = {0};
+  int fd[2];
+
+  if( pipe( fd ) != 0 ) {
+    __format_error_string( CSTR__error, "Cannot serialize '%s' in background: %s", path, strerror( errno ) );
+    return -1;
+  }
+
+  _vgx_start_graph_execution_timing_budget( self, timing_budget );
+  GRAPH_LOCK( self ) {
+    if( __begin_serialization_CS( self, timing_budget, &readonly, CSTR__error ) ) {
+      // Virtual properties appended so far belong to the snapshot
+      if( _vxvertex_property__virtual_properties_commit( self ) < 0 ) {
+        __format_error_string( CSTR__error, "Cannot serialize '%s' in background: failed to commit virtual properties", path );
+      }
+      else if( __snapshot_fork_locks_collect_CS( self, &fork_locks ) < 0 ) {
+        __format_error_string( CSTR__error, "Cannot serialize '%s' in background: out of memory", path );
+      }
+      else if( !__snapshot_fork_locks_acquire_CS( self, &fork_locks ) ) {
+        __format_error_string( CSTR__error, "Cannot serialize '%s' in background: allocators busy", path );
+      }
+      else {
+        // Snapshot point
+        idcpy( &snapshot_tx_id, &self->tx_id_in );
+        snapshot_tx_serial = self->tx_serial_in;
+        cxlib_ostream_lock();
+        if( (pid = fork()) == 0 ) {
+          __serialize_snapshot_child( self, &fork_locks, fd[1], ts_start, readonly );
+        }
+        cxlib_ostream_release();
+        __snapshot_fork_locks_release( &fork_locks, fork_locks.n_families, fork_locks.n_locks );
+        if( pid < 0 ) {
+          __format_error_string( CSTR__error, "Cannot serialize '%s' in background: %s", path, strerror( errno ) );
+        }
+      }
+      __snapshot_fork_locks_clear( &fork_locks );
+
+      // Graph is writable again while the snapshot is written
+      _vxgraph_state__release_graph_readonly_CS( self );
+      _vgx_clear_serializing_CS( &self->readonly );
+      if( pid > 0 ) {
+        _vgx_set_snapshotting_CS( &self->readonly );
+      }
+      SIGNAL_VERTEX_AVAILABLE( self );
+    }
+  } GRAPH_RELEASE;
+
+  close( fd[1] );
+
+  if( pid > 0 ) {
+    char idbuf[33];
+    VXDURABLE_SERIALIZATION_INFO( self, 0xB41, "Background serialization started (pid=%d tx=%s sn=%lld)", (int)pid, idtostr( idbuf, &snapshot_tx_id ), snapshot_tx_serial );
+
+    snapshot_result_t result = __wait_snapshot_child( pid, fd[0], VXDURABLE_SNAPSHOT_CHILD_TIMEOUT_MS, &timed_out );
+
+    GRAPH_LOCK( self ) {
+      _vgx_clear_snapshotting_CS( &self->readonly );
+
+      if( result.nqwords >= 0 ) {
+        __NQWORDS = result.nqwords;
+
+        // Capture durability point
+        idcpy( &self->durable_tx_id, &snapshot_tx_id );
+        self->durable_tx_serial = snapshot_tx_serial;
+        self->persisted_ts = result.persisted_ts;
+
+        // Capture and transmit save operation to remote attached instances, if requested
+        if( remote && _vgx_is_writable_CS( &self->readonly ) ) {
+          if( iOperation.Graph_CS.Persist( self, &counts, false ) < 0 ) {
+            VXDURABLE_SERIALIZATION_CRITICAL( self, 0xB42, "Failed to capture persist operation" );
+          }
+          if( iOperation.Graph_CS.State( self, &counts ) < 0 ) {
+            VXDURABLE_SERIALIZATION_CRITICAL( self, 0xB43, "Failed to capture state operation" );
+          }
+          iOperation.Graph_CS.SetModified( self );
+          if( COMMIT_GRAPH_OPERATION_CS( self ) < 0 ) {
+            VXDURABLE_SERIALIZATION_CRITICAL( self, 0xB44, "Failed to capture persist operation" );
+          }
+        }
+      }
+
+      SIGNAL_VERTEX_AVAILABLE( self );
+    } GRAPH_RELEASE;
+
+    if( __NQWORDS >= 0 ) {
+      double tp = (__GET_CURRENT_MILLISECOND_TICK() - t0) / 1000.0;
+      VXDURABLE_SERIALIZATION_INFO( self, 0xB45, "Background serialization complete (%.1f seconds)", tp );
+      if( !iSystem.IsSystemGraph( self ) ) {
+        vgx_Graph_t *SYSTEM = iSystem.GetSystemGraph();
+        if( SYSTEM ) {
+          _vxdurable_operation_consumer_service__perform_disk_cleanup_OPEN( SYSTEM );
+        }
+      }
+    }
+    else if( timed_out ) {
+      VXDURABLE_SERIALIZATION_CRITICAL( self, 0xB46, "Background serialization timed out after %d seconds, terminated pid=%d", VXDURABLE_SNAPSHOT_CHILD_TIMEOUT_MS / 1000, (int)pid );
+      __format_error_string( CSTR__error, "Background serialization of '%s' timed out (pid=%d)", path, (int)pid );
+    }
+    else {
+      __format_error_string( CSTR__error, "Error during background serialization of '%s' (pid=%d)", path, (int)pid );
+    }
+  }
+
+  close( fd[0] );
+
+  return __NQWORDS;
+#endif
+}
+
+
+
 #ifdef INCLUDE_UNIT_TESTS
 #include "tests/__utest_vxdurable_serialization.h"
 
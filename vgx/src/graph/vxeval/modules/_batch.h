@@ -0,0 +1,594 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    _batch.h
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#ifndef _VGX_VXEVAL_MODULES_BATCH_H
+#define _VGX_VXEVAL_MODULES_BATCH_H
+
+
+/*******************************************************************//**
+ * Columnar (batch) evaluation
+ *
+ * A program qualifies for batch mode when it is a pure numeric expression
+ * over arc and head attributes. Operands are materialized into columns of
+ * doubles, one lane per candidate, and operators run over whole columns.
+ * Integers are carried exactly as doubles as long as their magnitude does
+ * not exceed 2^53. Any lane whose operand or intermediate result cannot be
+ * represented this way is flagged for scalar re-evaluation.
+ *
+ ***********************************************************************
+ */
+static vgx_ExpressEvalBatchStep_t * __batch_compile_program( const vgx_ExpressEvalProgram_t *program );
+
+
+
+#define __BATCH_INTEGER_LIMIT 9007199254740992.0  /* 2^53 */
+
+#define __BATCH_NLANES VGX_EXPRESS_EVAL_BATCH_SIZE
+
+typedef double __batch_column[ __BATCH_NLANES ];
+
+#if (VGX_EXPRESS_EVAL_BATCH_SIZE % 4) != 0 || VGX_EXPRESS_EVAL_BATCH_SIZE > 32
+#error "Batch size must be a multiple of 4 and fit in a 32-bit lane mask"
+#endif
+
+
+
+typedef enum __e_batch_operand {
+  __BATCH_OPERAND_INVALID = 0,
+  __BATCH_OPERAND_CONSTANT,       // numeric, identical for all lanes
+  __BATCH_OPERAND_LANE,           // numeric, per lane
+  __BATCH_OPERAND_COLUMN,         // result of a column operator
+  __BATCH_OPERAND_VECTOR_CONSTANT,
+  __BATCH_OPERAND_VECTOR_LANE,
+  __BATCH_OPERAND_SUBSCRIPT,      // head property lookup, consumes constant key
+  __BATCH_OPERAND_SIMILARITY,     // vector x vector -> real
+  __BATCH_OPERAND_UNARY,
+  __BATCH_OPERAND_BINARY
+} __batch_operand;
+
+
+
+/*******************************************************************//**
+ * Classify a program operation for batch mode
+ ***********************************************************************
+ */
+static __batch_operand __batch_classify( f_evaluator f, vgx_ExpressEvalBatchStepKind *kind ) {
+  // Lane invariant numeric constants
+  if( f == __stack_push_constant_integer ||
+      f == __stack_push_constant_real ||
+      f == __stack_push_constant_true ||
+      f == __stack_push_constant_false ||
+      f == __stack_push_constant_pi ||
+      f == __stack_push_constant_e )
+  {
+    *kind = VGX_EXPRESS_EVAL_BATCH_BROADCAST;
+    return __BATCH_OPERAND_CONSTANT;
+  }
+
+  // Per lane arc and head attributes
+  if( f == __stack_push_exit_value ||
+      f == __stack_push_exit_distance ||
+      f == __stack_push_exit_relcode ||
+      f == __stack_push_exit_direction ||
+      f == __stack_push_exit_modifier ||
+      f == __stack_push_exit_isfwdonly ||
+      f == __stack_push_HEAD_c1 ||
+      f == __stack_push_HEAD_c0 ||
+      f == __stack_push_HEAD_virtual ||
+      f == __stack_push_HEAD_typ ||
+      f == __stack_push_HEAD_deg ||
+      f == __stack_push_HEAD_ideg ||
+      f == __stack_push_HEAD_odeg ||
+      f == __stack_push_HEAD_tmc ||
+      f == __stack_push_HEAD_tmm ||
+      f == __stack_push_HEAD_tmx )
+  {
+    *kind = VGX_EXPRESS_EVAL_BATCH_GATHER;
+    return __BATCH_OPERAND_LANE;
+  }
+
+  // Vectors (only valid as similarity operands)
+  if( f == __stack_push_constant_vector ) {
+    *kind = VGX_EXPRESS_EVAL_BATCH_BROADCAST;
+    return __BATCH_OPERAND_VECTOR_CONSTANT;
+  }
+  if( f == __stack_push_HEAD_vec ) {
+    *kind = VGX_EXPRESS_EVAL_BATCH_GATHER;
+    return __BATCH_OPERAND_VECTOR_LANE;
+  }
+
+  // next[ key ]
+  if( f == __stack_push_HEAD_prop ) {
+    *kind = VGX_EXPRESS_EVAL_BATCH_GATHER;
+    return __BATCH_OPERAND_SUBSCRIPT;
+  }
+
+  // sim( a, b ), cosine( a, b )
+  if( f == __eval_binary_sim || f == __eval_binary_cosine ) {
+    *kind = VGX_EXPRESS_EVAL_BATCH_GATHER;
+    return __BATCH_OPERAND_SIMILARITY;
+  }
+
+  // Column operators
+  if( f == __eval_unary_not ) {
+    *kind = VGX_EXPRESS_EVAL_BATCH_NOT;
+    return __BATCH_OPERAND_UNARY;
+  }
+
+  if(      f == __eval_binary_add )   { *kind = VGX_EXPRESS_EVAL_BATCH_ADD; }
+  else if( f == __eval_binary_sub )   { *kind = VGX_EXPRESS_EVAL_BATCH_SUB; }
+  else if( f == __eval_binary_mul )   { *kind = VGX_EXPRESS_EVAL_BATCH_MUL; }
+  else if( f == __eval_binary_equ )   { *kind = VGX_EXPRESS_EVAL_BATCH_EQU; }
+  else if( f == __eval_binary_neq )   { *kind = VGX_EXPRESS_EVAL_BATCH_NEQ; }
+  else if( f == __eval_binary_gt )    { *kind = VGX_EXPRESS_EVAL_BATCH_GT; }
+  else if( f == __eval_binary_gte )   { *kind = VGX_EXPRESS_EVAL_BATCH_GTE; }
+  else if( f == __eval_binary_lt )    { *kind = VGX_EXPRESS_EVAL_BATCH_LT; }
+  else if( f == __eval_binary_lte )   { *kind = VGX_EXPRESS_EVAL_BATCH_LTE; }
+  else if( f == __eval_logical_and )  { *kind = VGX_EXPRESS_EVAL_BATCH_AND; }
+  else if( f == __eval_logical_or )   { *kind = VGX_EXPRESS_EVAL_BATCH_OR; }
+  else {
+    return __BATCH_OPERAND_INVALID;
+  }
+  return __BATCH_OPERAND_BINARY;
+}
+
+
+
+/*******************************************************************//**
+ * Compile a columnar execution plan for program.
+ *
+ * Returns a plan terminated by VGX_EXPRESS_EVAL_BATCH_END, or NULL if
+ * the program cannot run in batch mode.
+ *
+ * Operands are pushed in program order. A head subscript is merged with
+ * its constant key operand, and a similarity operator is merged with its
+ * two vector operands, so that each of these becomes a single gathered
+ * operand executed by the scalar machinery once per lane.
+ ***********************************************************************
+ */
+static vgx_ExpressEvalBatchStep_t * __batch_compile_program( const vgx_ExpressEvalProgram_t *program ) {
+  // Programs with side effects or control flow are not batchable
+  if( program->n_passthru > 0 || program->synarc_ops > 0 || program->cull || program->n_wreg > 0 ) {
+    return NULL;
+  }
+
+  int length = program->length;
+  if( length < 1 ) {
+    return NULL;
+  }
+
+  vgx_ExpressEvalBatchStep_t *plan = calloc( length + 1LL, sizeof( vgx_ExpressEvalBatchStep_t ) );
+  if( plan == NULL ) {
+    return NULL;
+  }
+
+  struct {
+    __batch_operand operand;
+    int step;
+  } stack[ VGX_EXPRESS_EVAL_BATCH_MAX_DEPTH ], *top = NULL;
+  int depth = 0;
+  int n = 0;
+
+  for( int i=0; i<length; i++ ) {
+    vgx_ExpressEvalBatchStepKind kind = VGX_EXPRESS_EVAL_BATCH_END;
+    __batch_operand operand = __batch_classify( program->operations[i].func, &kind );
+    vgx_ExpressEvalBatchStep_t *step;
+
+    switch( operand ) {
+    case __BATCH_OPERAND_CONSTANT:
+    case __BATCH_OPERAND_LANE:
+    case __BATCH_OPERAND_VECTOR_CONSTANT:
+    case __BATCH_OPERAND_VECTOR_LANE:
+      if( depth >= VGX_EXPRESS_EVAL_BATCH_MAX_DEPTH ) {
+        goto reject;
+      }
+      step = &plan[n];
+      step->kind = kind;
+      step->offset = i;
+      step->count = 1;
+      top = &stack[ depth++ ];
+      top->operand = operand;
+      top->step = n++;
+      break;
+
+    case __BATCH_OPERAND_SUBSCRIPT:
+      // Key must be the constant operand emitted immediately before
+      if( depth < 1 || top->operand != __BATCH_OPERAND_CONSTANT || top->step != n-1 || plan[n-1].offset + plan[n-1].count != i ) {
+        goto reject;
+      }
+      step = &plan[n-1];
+      step->kind = kind;
+      step->count++;
+      top->operand = __BATCH_OPERAND_LANE;
+      break;
+
+    case __BATCH_OPERAND_SIMILARITY:
+      // Both vector operands must be the two operands emitted immediately before
+      if( depth < 2 ) {
+        goto reject;
+      }
+      else {
+        __batch_operand a = stack[depth-2].operand;
+        __batch_operand b = top->operand;
+        if( (a != __BATCH_OPERAND_VECTOR_CONSTANT && a != __BATCH_OPERAND_VECTOR_LANE) ||
+            (b != __BATCH_OPERAND_VECTOR_CONSTANT && b != __BATCH_OPERAND_VECTOR_LANE) ||
+            stack[depth-2].step != n-2 || top->step != n-1 )
+        {
+          goto reject;
+        }
+        step = &plan[n-2];
+        step->count += plan[n-1].count + 1;
+        if( step->offset + step->count != i + 1 ) {
+          goto reject;
+        }
+        memset( &plan[--n], 0, sizeof( vgx_ExpressEvalBatchStep_t ) );
+        if( a == __BATCH_OPERAND_VECTOR_LANE || b == __BATCH_OPERAND_VECTOR_LANE ) {
+          step->kind = VGX_EXPRESS_EVAL_BATCH_GATHER;
+          operand = __BATCH_OPERAND_LANE;
+        }
+        else {
+          step->kind = VGX_EXPRESS_EVAL_BATCH_BROADCAST;
+          operand = __BATCH_OPERAND_CONSTANT;
+        }
+        top = &stack[ --depth - 1 ];
+        top->operand = operand;
+        top->step = n-1;
+      }
+      break;
+
+    case __BATCH_OPERAND_UNARY:
+      if( depth < 1 || top->operand > __BATCH_OPERAND_COLUMN ) {
+        goto reject;
+      }
+      plan[n++].kind = kind;
+      top->operand = __BATCH_OPERAND_COLUMN;
+      top->step = -1;
+      break;
+
+    case __BATCH_OPERAND_BINARY:
+      if( depth < 2 || top->operand > __BATCH_OPERAND_COLUMN || stack[depth-2].operand > __BATCH_OPERAND_COLUMN ) {
+        goto reject;
+      }
+      plan[n++].kind = kind;
+      top = &stack[ --depth - 1 ];
+      top->operand = __BATCH_OPERAND_COLUMN;
+      top->step = -1;
+      break;
+
+    default:
+      goto reject;
+    }
+  }
+
+  // Program must leave exactly one numeric item
+  if( depth != 1 || top->operand > __BATCH_OPERAND_COLUMN ) {
+    goto reject;
+  }
+
+  // Terminate
+  plan[n].kind = VGX_EXPRESS_EVAL_BATCH_END;
+
+  return plan;
+
+reject:
+  free( plan );
+  return NULL;
+}
+
+
+
+/*******************************************************************//**
+ * Convert a scalar stack item to a column value
+ *
+ * Returns 1 for integer, 0 for real, or -1 if the item cannot be
+ * represented in a column.
+ ***********************************************************************
+ */
+__inline static int __batch_item_as_double( const vgx_EvalStackItem_t *item, double *value ) {
+  switch( item->type ) {
+  case STACK_ITEM_TYPE_INTEGER:
+    if( item->integer > (int64_t)__BATCH_INTEGER_LIMIT || item->integer < -(int64_t)__BATCH_INTEGER_LIMIT ) {
+      return -1;
+    }
+    *value = (double)item->integer;
+    return 1;
+  case STACK_ITEM_TYPE_REAL:
+    if( !isfinite( item->real ) ) {
+      return -1;
+    }
+    *value = item->real;
+    return 0;
+  default:
+    return -1;
+  }
+}
+
+
+
+#ifdef __AVX2__
+/*******************************************************************//**
+ * Expand four lane bits into a lane mask
+ ***********************************************************************
+ */
+__inline static __m256d __batch_lanemask_avx2( uint32_t bits ) {
+  const __m256i sel = _mm256_setr_epi64x( 1, 2, 4, 8 );
+  __m256i b = _mm256_set1_epi64x( bits & 0xF );
+  return _mm256_castsi256_pd( _mm256_cmpeq_epi64( _mm256_and_si256( b, sel ), sel ) );
+}
+
+
+
+/*******************************************************************//**
+ * Lanes whose bit pattern is non-zero (i.e. true for && || !)
+ ***********************************************************************
+ */
+__inline static __m256d __batch_nonzero_avx2( __m256d x ) {
+  __m256i z = _mm256_cmpeq_epi64( _mm256_castpd_si256( x ), _mm256_setzero_si256() );
+  return _mm256_castsi256_pd( _mm256_xor_si256( z, _mm256_set1_epi64x( -1 ) ) );
+}
+#endif
+
+
+
+/*******************************************************************//**
+ * x = x <op> y  for arithmetic operators
+ *
+ * Integer lanes are flagged for fallback when the result exceeds 2^53,
+ * and any lane is flagged when the result is not finite.
+ ***********************************************************************
+ */
+static void __batch_column_arithmetic( vgx_ExpressEvalBatchStepKind kind, double *x, const double *y, uint32_t *xint, uint32_t yint, uint32_t *fallback ) {
+  uint32_t rint = *xint & yint;
+  uint32_t overflow = 0;
+#ifdef __AVX2__
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d absmask = _mm256_castsi256_pd( _mm256_set1_epi64x( 0x7FFFFFFFFFFFFFFFLL ) );
+  const __m256d ilimit = _mm256_set1_pd( __BATCH_INTEGER_LIMIT );
+  const __m256d rlimit = _mm256_set1_pd( DBL_MAX );
+  for( int k=0; k<__BATCH_NLANES; k += 4 ) {
+    __m256d a = _mm256_loadu_pd( x + k );
+    __m256d b = _mm256_loadu_pd( y + k );
+    __m256d r;
+    __m256d imask = __batch_lanemask_avx2( rint >> k );
+    switch( kind ) {
+    case VGX_EXPRESS_EVAL_BATCH_ADD:
+      r = _mm256_add_pd( a, b );
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_SUB:
+      r = _mm256_sub_pd( a, b );
+      break;
+    default:
+      r = _mm256_mul_pd( a, b );
+      // Integer product has no negative zero
+      r = _mm256_blendv_pd( r, _mm256_add_pd( r, zero ), imask );
+      break;
+    }
+    __m256d limit = _mm256_blendv_pd( rlimit, ilimit, imask );
+    __m256d ok = _mm256_cmp_pd( _mm256_and_pd( r, absmask ), limit, _CMP_LE_OQ );
+    overflow |= (uint32_t)(~_mm256_movemask_pd( ok ) & 0xF) << k;
+    _mm256_storeu_pd( x + k, r );
+  }
+#else
+  for( int k=0; k<__BATCH_NLANES; k++ ) {
+    double r;
+    uint32_t bit = 1U << k;
+    switch( kind ) {
+    case VGX_EXPRESS_EVAL_BATCH_ADD:
+      r = x[k] + y[k];
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_SUB:
+      r = x[k] - y[k];
+      break;
+    default:
+      r = x[k] * y[k];
+      if( (rint & bit) && r == 0.0 ) {
+        r = 0.0;
+      }
+      break;
+    }
+    if( !(fabs( r ) <= ((rint & bit) ? __BATCH_INTEGER_LIMIT : DBL_MAX)) ) {
+      overflow |= bit;
+    }
+    x[k] = r;
+  }
+#endif
+  *xint = rint;
+  *fallback |= overflow;
+}
+
+
+
+/*******************************************************************//**
+ * x = x <cmp> y  -> integer 1 or 0
+ ***********************************************************************
+ */
+static void __batch_column_compare( vgx_ExpressEvalBatchStepKind kind, double *x, const double *y, uint32_t *xint ) {
+#ifdef __AVX2__
+  const __m256d one = _mm256_set1_pd( 1.0 );
+  const __m256d absmask = _mm256_castsi256_pd( _mm256_set1_epi64x( 0x7FFFFFFFFFFFFFFFLL ) );
+  const __m256d epsilon = _mm256_set1_pd( FLT_EPSILON );
+  for( int k=0; k<__BATCH_NLANES; k += 4 ) {
+    __m256d a = _mm256_loadu_pd( x + k );
+    __m256d b = _mm256_loadu_pd( y + k );
+    __m256d c;
+    switch( kind ) {
+    case VGX_EXPRESS_EVAL_BATCH_EQU:
+      c = _mm256_cmp_pd( _mm256_and_pd( _mm256_sub_pd( a, b ), absmask ), epsilon, _CMP_LT_OQ );
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_NEQ:
+      c = _mm256_cmp_pd( _mm256_and_pd( _mm256_sub_pd( a, b ), absmask ), epsilon, _CMP_NLT_UQ );
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_GT:
+      c = _mm256_cmp_pd( a, b, _CMP_GT_OQ );
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_GTE:
+      c = _mm256_cmp_pd( a, b, _CMP_GE_OQ );
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_LT:
+      c = _mm256_cmp_pd( a, b, _CMP_LT_OQ );
+      break;
+    default:
+      c = _mm256_cmp_pd( a, b, _CMP_LE_OQ );
+      break;
+    }
+    _mm256_storeu_pd( x + k, _mm256_and_pd( c, one ) );
+  }
+#else
+  for( int k=0; k<__BATCH_NLANES; k++ ) {
+    int c;
+    switch( kind ) {
+    case VGX_EXPRESS_EVAL_BATCH_EQU:
+      c = fabs( x[k] - y[k] ) < FLT_EPSILON;
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_NEQ:
+      c = !(fabs( x[k] - y[k] ) < FLT_EPSILON);
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_GT:
+      c = x[k] > y[k];
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_GTE:
+      c = x[k] >= y[k];
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_LT:
+      c = x[k] < y[k];
+      break;
+    default:
+      c = x[k] <= y[k];
+      break;
+    }
+    x[k] = c ? 1.0 : 0.0;
+  }
+#endif
+  *xint = 0xFFFFFFFFU;
+}
+
+
+
+/*******************************************************************//**
+ * x = x && y,  x = x || y,  x = !x
+ *
+ * Truth is the non-zero bit pattern, as in the scalar operators, and the
+ * selected operand keeps its integer/real lane type.
+ ***********************************************************************
+ */
+static void __batch_column_logical( vgx_ExpressEvalBatchStepKind kind, double *x, const double *y, uint32_t *xint, uint32_t yint ) {
+  uint32_t rint = 0;
+#ifdef __AVX2__
+  const __m256d one = _mm256_set1_pd( 1.0 );
+  for( int k=0; k<__BATCH_NLANES; k += 4 ) {
+    __m256d a = _mm256_loadu_pd( x + k );
+    __m256d ta = __batch_nonzero_avx2( a );
+    __m256d r;
+    uint32_t m;
+    if( kind == VGX_EXPRESS_EVAL_BATCH_NOT ) {
+      r = _mm256_andnot_pd( ta, one );
+      m = 0xF;
+    }
+    else {
+      __m256d b = _mm256_loadu_pd( y + k );
+      __m256d tb = __batch_nonzero_avx2( b );
+      uint32_t bi = (yint >> k) & 0xF;
+      if( kind == VGX_EXPRESS_EVAL_BATCH_AND ) {
+        __m256d t = _mm256_and_pd( ta, tb );
+        uint32_t tm = (uint32_t)_mm256_movemask_pd( t );
+        r = _mm256_and_pd( t, b );
+        m = (tm & bi) | (~tm & 0xF);
+      }
+      else {
+        __m256d t = _mm256_andnot_pd( ta, tb );
+        uint32_t tm = (uint32_t)_mm256_movemask_pd( t );
+        r = _mm256_blendv_pd( a, b, t );
+        m = (tm & bi) | (~tm & (*xint >> k) & 0xF);
+      }
+    }
+    rint |= m << k;
+    _mm256_storeu_pd( x + k, r );
+  }
+#else
+  for( int k=0; k<__BATCH_NLANES; k++ ) {
+    uint32_t bit = 1U << k;
+    uint64_t xbits, ybits = 0;
+    memcpy( &xbits, &x[k], sizeof( double ) );
+    if( y ) {
+      memcpy( &ybits, &y[k], sizeof( double ) );
+    }
+    switch( kind ) {
+    case VGX_EXPRESS_EVAL_BATCH_NOT:
+      x[k] = xbits == 0 ? 1.0 : 0.0;
+      rint |= bit;
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_AND:
+      if( xbits && ybits ) {
+        x[k] = y[k];
+        rint |= yint & bit;
+      }
+      else {
+        x[k] = 0.0;
+        rint |= bit;
+      }
+      break;
+    default:
+      if( xbits == 0 && ybits ) {
+        x[k] = y[k];
+        rint |= yint & bit;
+      }
+      else {
+        rint |= *xint & bit;
+      }
+      break;
+    }
+  }
+#endif
+  *xint = rint;
+}
+
+
+
+/*******************************************************************//**
+ * Lanes with value > 0
+ ***********************************************************************
+ */
+__inline static uint32_t __batch_column_positive( const double *x ) {
+  uint32_t mask = 0;
+#ifdef __AVX2__
+  const __m256d zero = _mm256_setzero_pd();
+  for( int k=0; k<__BATCH_NLANES; k += 4 ) {
+    __m256d c = _mm256_cmp_pd( _mm256_loadu_pd( x + k ), zero, _CMP_GT_OQ );
+    mask |= (uint32_t)_mm256_movemask_pd( c ) << k;
+  }
+#else
+  for( int k=0; k<__BATCH_NLANES; k++ ) {
+    if( x[k] > 0.0 ) {
+      mask |= 1U << k;
+    }
+  }
+#endif
+  return mask;
+}
+
+
+
+
+#endif
@@ -413,12 +413,11 @@ static void __eval_collectif_var1_2( vgx_Evaluator_t *self ) {
  ***********************************************************************
  */
 static QWORD __collectable_sort_value( vgx_Evaluator_t *self ) {
-  vgx_CollectorItem_t top = {0};
+  // The collector caches its heap floor whenever the heap changes
   if( self->context.collector && _vgx_collector_is_sorted( self->context.collector ) ) {
-    Cm256iHeap_t *heap = self->context.collector->container.sequence.heap;
-    CALLABLE(heap)->HeapTop(heap, &top.item);
+    return self->context.collector->floor.qword;
   }
-  return top.sort.qword;
+  return 0;
 }
 
 
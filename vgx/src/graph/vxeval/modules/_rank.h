@@ -33,6 +33,11 @@
  */
 static void __eval_variadic_rank( vgx_Evaluator_t *self );
 static void __eval_variadic_georank( vgx_Evaluator_t *self );
+static void __eval_variadic_bm25( vgx_Evaluator_t *self );
+static void __eval_variadic_commonneighbors( vgx_Evaluator_t *self );
+static void __eval_variadic_neighborjaccard( vgx_Evaluator_t *self );
+static void __eval_variadic_neighborcosine( vgx_Evaluator_t *self );
+static void __eval_variadic_adamicadar( vgx_Evaluator_t *self );
 static void __stack_push_context_rank( vgx_Evaluator_t *self );
 
 
@@ -125,6 +130,144 @@ static void __eval_variadic_georank( vgx_Evaluator_t *self ) {
 
 
 
+/*******************************************************************//**
+ * bm25( key, terms )
+ *
+ * BM25 score of the text in string property key for terms, using the
+ * term statistics of the graph's text index for key. Score is 0.0 if
+ * key has no text index.
+ *
+ ***********************************************************************
+ */
+static void __eval_variadic_bm25( vgx_Evaluator_t *self ) {
+  vgx_EvalStackItem_t x_terms = POP_ITEM( self );
+  vgx_EvalStackItem_t x_key = POP_ITEM( self );
+  double score = 0.0;
+  if( x_key.type == STACK_ITEM_TYPE_CSTRING && x_key.CSTR__str && x_terms.type == STACK_ITEM_TYPE_CSTRING && x_terms.CSTR__str ) {
+    score = _vxgraph_textindex__bm25( self->graph, &self->cache.textscorer, x_key.CSTR__str, x_terms.CSTR__str, self->context.HEAD );
+  }
+  vgx_EvalStackItem_t *px = NEXT_PITEM( self );
+  SET_REAL_PITEM_VALUE( px, score );
+}
+
+
+
+/*******************************************************************//**
+ * Pop the optional ( [rel [, dir]] ) arguments of the common neighbor
+ * functions and intersect the neighbor sets of the current vertex and
+ * the arc's head vertex. Relationship defaults to any, direction
+ * defaults to D_OUT. Invalid arguments give no common neighbors.
+ * Outside an arc context the next vertex has no neighbors.
+ *
+ ***********************************************************************
+ */
+static void __common_neighbors( vgx_Evaluator_t *self, bool adamic_adar, vgx_CommonNeighbors_t *result ) {
+  int64_t nargs = self->op->arg.integer;
+  vgx_predicator_rel_enum rel = VGX_PREDICATOR_REL_WILDCARD;
+  vgx_arc_direction arcdir = VGX_ARCDIR_OUT;
+  bool valid = true;
+
+  if( nargs > 1 ) {
+    vgx_EvalStackItem_t x_dir = POP_ITEM( self );
+    if( x_dir.type == STACK_ITEM_TYPE_INTEGER ) {
+      arcdir = (vgx_arc_direction)x_dir.integer;
+    }
+    valid = x_dir.type == STACK_ITEM_TYPE_INTEGER && (arcdir == VGX_ARCDIR_OUT || arcdir == VGX_ARCDIR_IN || arcdir == VGX_ARCDIR_ANY);
+  }
+  if( nargs > 0 ) {
+    vgx_EvalStackItem_t x_rel = POP_ITEM( self );
+    switch( x_rel.type ) {
+    case STACK_ITEM_TYPE_INTEGER:
+      rel = (vgx_predicator_rel_enum)x_rel.integer;
+      break;
+    case STACK_ITEM_TYPE_CSTRING:
+      rel = __encode_relationship( self, x_rel.CSTR__str, &self->cache.relationship );
+      break;
+    case STACK_ITEM_TYPE_NONE:
+      break;
+    default:
+      valid = false;
+    }
+  }
+
+  memset( result, 0, sizeof( vgx_CommonNeighbors_t ) );
+  if( valid ) {
+    if( _vxgraph_neighbors__common( self->cache.neighbors, self->context.VERTEX, self->context.HEAD, rel, arcdir, adamic_adar, result ) < 0 ) {
+      memset( result, 0, sizeof( vgx_CommonNeighbors_t ) );
+    }
+  }
+}
+
+
+
+/*******************************************************************//**
+ * commonneighbors( [rel [, dir]] )
+ *
+ * Number of vertices adjacent to both the current vertex and the next
+ * vertex via arcs of relationship rel in direction dir.
+ *
+ ***********************************************************************
+ */
+static void __eval_variadic_commonneighbors( vgx_Evaluator_t *self ) {
+  vgx_CommonNeighbors_t result;
+  __common_neighbors( self, false, &result );
+  vgx_EvalStackItem_t *px = NEXT_PITEM( self );
+  SET_INTEGER_PITEM_VALUE( px, result.n_common );
+}
+
+
+
+/*******************************************************************//**
+ * neighborjaccard( [rel [, dir]] )
+ *
+ * Jaccard index of the neighbor sets of the current vertex and the
+ * next vertex.
+ *
+ ***********************************************************************
+ */
+static void __eval_variadic_neighborjaccard( vgx_Evaluator_t *self ) {
+  vgx_CommonNeighbors_t result;
+  __common_neighbors( self, false, &result );
+  vgx_EvalStackItem_t *px = NEXT_PITEM( self );
+  SET_REAL_PITEM_VALUE( px, result.jaccard );
+}
+
+
+
+/*******************************************************************//**
+ * neighborcosine( [rel [, dir]] )
+ *
+ * Cosine similarity of the neighbor sets of the current vertex and the
+ * next vertex.
+ *
+ ***********************************************************************
+ */
+static void __eval_variadic_neighborcosine( vgx_Evaluator_t *self ) {
+  vgx_CommonNeighbors_t result;
+  __common_neighbors( self, false, &result );
+  vgx_EvalStackItem_t *px = NEXT_PITEM( self );
+  SET_REAL_PITEM_VALUE( px, result.cosine );
+}
+
+
+
+/*******************************************************************//**
+ * adamicadar( [rel [, dir]] )
+ *
+ * Adamic-Adar index of the current vertex and the next vertex, i.e.
+ * the sum of 1/log(degree) over their common neighbors.
+ *
+ ***********************************************************************
+ */
+static void __eval_variadic_adamicadar( vgx_Evaluator_t *self ) {
+  vgx_CommonNeighbors_t result;
+  __common_neighbors( self, true, &result );
+  vgx_EvalStackItem_t *px = NEXT_PITEM( self );
+  SET_REAL_PITEM_VALUE( px, result.adamic_adar );
+}
+
+
+
 /*******************************************************************//**
  * context.rank
  ***********************************************************************
@@ -154,6 +154,7 @@ __inline static vgx_EvalStackItem_t * vgx_evaluator_next_wreg( vgx_Evaluator_t *
 #include "_stack.h"
 #include "_object.h"
 #include "_maps.h"
+#include "_batch.h"
 
 
 
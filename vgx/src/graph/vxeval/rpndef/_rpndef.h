@@ -36,6 +36,7 @@ static express_eval_map * __rpndef__opmap_new( const char *name );
 static void               __rpndef__opmap_delete( express_eval_map **operators );
 static __rpn_operation *  __rpndef__opmap_get( express_eval_map *operations, const char *name );
 static int                __rpndef__is_property_lookup( const __rpn_operation *op );
+static int                __rpndef__is_memory_operation( const __rpn_operation *op );
 
 
 /******************************************************************************
@@ -571,6 +572,16 @@ static __rpn_operation RpnVarLastValue       = { .surface.token="lastval",
 static __rpn_operation RpnSet                = { .surface.token=NULL,               .function.eval = __eval_variadic_set,             .type = OP_VARIADIC_PREFIX,       .precedence = OPP_NONE };
 static __rpn_operation RpnVarRank            = { .surface.token="rank",             .function.eval = __eval_variadic_rank,            .type = OP_VARIADIC_HEAD_PREFIX,  .precedence = OPP_CALL };
 static __rpn_operation RpnVarGeoRank         = { .surface.token="georank",          .function.eval = __eval_variadic_georank,         .type = OP_VARIADIC_HEAD_PREFIX,  .precedence = OPP_CALL };
+static __rpn_operation RpnVarBM25            = { .surface.token="bm25",             .function.eval = __eval_variadic_bm25,            .type = ENCODE_VARIADIC_ARG_COUNTS(
+                                                                                                                                              OP_VARIADIC_HEAD_PREFIX, 2, 2 ),  .precedence = OPP_CALL };
+static __rpn_operation RpnVarCommonNeighbors = { .surface.token="commonneighbors",  .function.eval = __eval_variadic_commonneighbors, .type = ENCODE_VARIADIC_ARG_COUNTS(
+                                                                                                                                              OP_VARIADIC_HEAD_PREFIX, 0, 2 ),  .precedence = OPP_CALL };
+static __rpn_operation RpnVarNeighborJaccard = { .surface.token="neighborjaccard",  .function.eval = __eval_variadic_neighborjaccard, .type = ENCODE_VARIADIC_ARG_COUNTS(
+                                                                                                                                              OP_VARIADIC_HEAD_PREFIX, 0, 2 ),  .precedence = OPP_CALL };
+static __rpn_operation RpnVarNeighborCosine  = { .surface.token="neighborcosine",   .function.eval = __eval_variadic_neighborcosine,  .type = ENCODE_VARIADIC_ARG_COUNTS(
+                                                                                                                                              OP_VARIADIC_HEAD_PREFIX, 0, 2 ),  .precedence = OPP_CALL };
+static __rpn_operation RpnVarAdamicAdar      = { .surface.token="adamicadar",       .function.eval = __eval_variadic_adamicadar,      .type = ENCODE_VARIADIC_ARG_COUNTS(
+                                                                                                                                              OP_VARIADIC_HEAD_PREFIX, 0, 2 ),  .precedence = OPP_CALL };
 static __rpn_operation RpnVarSum             = { .surface.token="sum",              .function.eval = __eval_variadic_sum,             .type = OP_VARIADIC_PREFIX,       .precedence = OPP_CALL };
 static __rpn_operation RpnVarSumSquare       = { .surface.token="sumsqr",           .function.eval = __eval_variadic_sumsqr,          .type = OP_VARIADIC_PREFIX,       .precedence = OPP_CALL };
 static __rpn_operation RpnVarStdev           = { .surface.token="stdev",            .function.eval = __eval_variadic_stdev,           .type = OP_VARIADIC_PREFIX,       .precedence = OPP_CALL };
@@ -609,6 +620,298 @@ static __rpn_operation RpnCollectIf          = { .surface.token="collectif",
                                                                                                                                               OP_VARIADIC_COLLECT, 1, 2 ),  .precedence = OPP_CALL };
 
 
+static __rpn_operation *__rpn_memory_definitions[] = {
+      // Memory registers
+      &RpnPushReg1,
+      &RpnPushReg2,
+      &RpnPushReg3,
+      &RpnPushReg4,
+
+      &RpnPushMemX,
+
+      // Memory single register
+      &RpnMemoryStore,
+      &RpnMemoryRefStore,
+      &RpnMemoryStoreIf,
+      &RpnMemoryRefStoreIf,
+      &RpnMemoryWrite,
+      &RpnMemoryRWrite,
+      &RpnMemoryWriteIf,
+      &RpnMemoryRWriteIf,
+
+      &RpnMemoryLoad,
+      &RpnMemoryRefLoad,
+
+      &RpnMemoryPush,
+      &RpnMemoryPushIf,
+      &RpnMemoryPop,
+      &RpnMemoryPopIf,
+      &RpnMemoryGet,
+
+      &RpnMemoryMov,
+      &RpnMemoryRefMov,
+      &RpnMemoryMovIf,
+      &RpnMemoryRefMovIf,
+
+      &RpnMemoryXchg,
+      &RpnMemoryRefXchg,
+      &RpnMemoryXchgIf,
+      &RpnMemoryRefXchgIf,
+
+      &RpnMemoryInc,
+      &RpnMemoryRefInc,
+      &RpnMemoryIncIf,
+      &RpnMemoryRefIncIf,
+      &RpnMemoryDec,
+      &RpnMemoryRefDec,
+      &RpnMemoryDecIf,
+      &RpnMemoryRefDecIf,
+
+      &RpnMemoryEqu,
+      &RpnMemoryRefEqu,
+      &RpnMemoryNeq,
+      &RpnMemoryRefNeq,
+
+      &RpnMemoryGt,
+      &RpnMemoryRefGt,
+      &RpnMemoryGte,
+      &RpnMemoryRefGte,
+
+      &RpnMemoryLt,
+      &RpnMemoryRefLt,
+      &RpnMemoryLte,
+      &RpnMemoryRefLte,
+
+      &RpnMemoryAdd,
+      &RpnMemoryAddIf,
+      &RpnMemorySub,
+      &RpnMemorySubIf,
+      &RpnMemoryMul,
+      &RpnMemoryMulIf,
+      &RpnMemoryDiv,
+      &RpnMemoryDivIf,
+      &RpnMemoryMod,
+      &RpnMemoryModIf,
+
+      &RpnMemoryShr,
+      &RpnMemoryShrIf,
+      &RpnMemoryShl,
+      &RpnMemoryShlIf,
+      &RpnMemoryAnd,
+      &RpnMemoryAndIf,
+      &RpnMemoryOr,
+      &RpnMemoryOrIf,
+      &RpnMemoryXor,
+      &RpnMemoryXorIf,
+
+      &RpnMemorySmooth,
+      &RpnMemoryCount,
+      &RpnMemoryCountIf,
+
+      &RpnMemoryModIndex,
+      &RpnMemoryIndex,
+      &RpnMemoryIndexed,
+      &RpnMemoryUnindex,
+
+
+      // Memory multi register
+      &RpnMemoryMSet,
+      &RpnMemoryMReset,
+      &RpnMemoryMRandomize,
+      &RpnMemoryMRandbits,
+      &RpnMemoryMCopy,
+      &RpnMemoryMPWrite,
+      &RpnMemoryMCopyObj,
+
+      &RpnMemoryMTerm,
+      &RpnMemoryMLen,
+
+      &RpnMemoryHeapInit,
+      &RpnMemoryHeapPushMin,
+      &RpnMemoryHeapPushMax,
+      &RpnMemoryHeapWriteMin,
+      &RpnMemoryHeapWriteMax,
+      &RpnMemoryHeapifyMin,
+      &RpnMemoryHeapifyMax,
+
+      &RpnMemoryHeapSiftMin,
+      &RpnMemoryHeapSiftMax,
+
+      &RpnMemoryMSort,
+      &RpnMemoryMSortRev,
+      &RpnMemoryMRSort,
+      &RpnMemoryMRSortRev,
+      &RpnMemoryMReverse,
+
+      &RpnMemoryMInt,
+      &RpnMemoryMIntR,
+      &RpnMemoryMReal,
+      &RpnMemoryMBits,
+
+      &RpnMemoryMInc,
+      &RpnMemoryMIInc,
+      &RpnMemoryMRInc,
+      &RpnMemoryMDec,
+      &RpnMemoryMIDec,
+      &RpnMemoryMRDec,
+
+      &RpnMemoryMAdd,
+      &RpnMemoryMIAdd,
+      &RpnMemoryMRAdd,
+      &RpnMemoryMVAdd,
+
+      &RpnMemoryMSub,
+      &RpnMemoryMISub,
+      &RpnMemoryMRSub,
+      &RpnMemoryMVSub,
+
+      &RpnMemoryMMul,
+      &RpnMemoryMIMul,
+      &RpnMemoryMRMul,
+      &RpnMemoryMVMul,
+
+      &RpnMemoryMDiv,
+      &RpnMemoryMIDiv,
+      &RpnMemoryMRDiv,
+      &RpnMemoryMVDiv,
+
+      &RpnMemoryMMod,
+      &RpnMemoryMIMod,
+      &RpnMemoryMRMod,
+      &RpnMemoryMVMod,
+
+      &RpnMemoryMInv,
+      &RpnMemoryMRInv,
+
+      &RpnMemoryMPow,
+      &RpnMemoryMRPow,
+      &RpnMemoryMSq,
+      &RpnMemoryMRSq,
+      &RpnMemoryMSqrt,
+      &RpnMemoryMRSqrt,
+
+      &RpnMemoryMCeil,
+      &RpnMemoryMRCeil,
+      &RpnMemoryMFloor,
+      &RpnMemoryMRFloor,
+      &RpnMemoryMRound,
+      &RpnMemoryMRRound,
+      &RpnMemoryMAbs,
+      &RpnMemoryMRAbs,
+      &RpnMemoryMSign,
+      &RpnMemoryMRSign,
+
+      &RpnMemoryMLog2,
+      &RpnMemoryMRLog2,
+      &RpnMemoryMLog,
+      &RpnMemoryMRLog,
+      &RpnMemoryMLog10,
+      &RpnMemoryMRLog10,
+      &RpnMemoryMExp2,
+      &RpnMemoryMRExp2,
+      &RpnMemoryMExp,
+      &RpnMemoryMRExp,
+      &RpnMemoryMExp10,
+      &RpnMemoryMRExp10,
+
+
+      &RpnMemoryMRad,
+      &RpnMemoryMRRad,
+      &RpnMemoryMDeg,
+      &RpnMemoryMRDeg,
+      &RpnMemoryMSin,
+      &RpnMemoryMRSin,
+      &RpnMemoryMCos,
+      &RpnMemoryMRCos,
+      &RpnMemoryMTan,
+      &RpnMemoryMRTan,
+      &RpnMemoryMASin,
+      &RpnMemoryMRASin,
+      &RpnMemoryMACos,
+      &RpnMemoryMRACos,
+      &RpnMemoryMATan,
+      &RpnMemoryMRATan,
+      &RpnMemoryMSinh,
+      &RpnMemoryMRSinh,
+      &RpnMemoryMCosh,
+      &RpnMemoryMRCosh,
+      &RpnMemoryMTanh,
+      &RpnMemoryMRTanh,
+      &RpnMemoryMASinh,
+      &RpnMemoryMRASinh,
+      &RpnMemoryMACosh,
+      &RpnMemoryMRACosh,
+      &RpnMemoryMATanh,
+      &RpnMemoryMRATanh,
+      &RpnMemoryMSinc,
+      &RpnMemoryMRSinc,
+
+      &RpnMemoryMShr,
+      &RpnMemoryMVShr,
+      &RpnMemoryMShl,
+      &RpnMemoryMVShl,
+
+      &RpnMemoryMAnd,
+      &RpnMemoryMVAnd,
+      &RpnMemoryMOr,
+      &RpnMemoryMVOr,
+      &RpnMemoryMXor,
+      &RpnMemoryMVXor,
+      &RpnMemoryMPopcnt,
+
+      &RpnMemoryMHash,
+
+      &RpnMemoryMSum,
+      &RpnMemoryMRSum,
+      &RpnMemoryMSumSqr,
+      &RpnMemoryMRSumSqr,
+      &RpnMemoryMInvSum,
+      &RpnMemoryMRInvSum,
+      &RpnMemoryMProd,
+      &RpnMemoryMRProd,
+      &RpnMemoryMMean,
+      &RpnMemoryMRMean,
+      &RpnMemoryMHarmMean,
+      &RpnMemoryMRHarmMean,
+      &RpnMemoryMGeoMean,
+      &RpnMemoryMRGeoMean,
+      &RpnMemoryMStdev,
+      &RpnMemoryMRStdev,
+      &RpnMemoryMGeoStdev,
+      &RpnMemoryMRGeoStdev,
+
+      &RpnMemoryMMax,
+      &RpnMemoryMMin,
+      &RpnMemoryMContains,
+      &RpnMemoryMCount,
+      &RpnMemoryMIndex,
+      &RpnMemoryMCmp,
+      &RpnMemoryMCmpA,
+      &RpnMemoryMSubset,
+      &RpnMemoryMSubsetObj,
+      &RpnMemoryMSumProdObj,
+
+      // QWORD Set
+      &RpnISetAdd,
+      &RpnISetDel,
+      &RpnISetClr,
+      &RpnISetHas,
+      &RpnISetLen,
+      &RpnISetIni,
+
+      // Vertex Set
+      &RpnVSetAdd,
+      &RpnVSetDel,
+      &RpnVSetClr,
+      &RpnVSetHas,
+      &RpnVSetLen,
+      &RpnVSetIni,
+
+      NULL
+    };
+
+
+
 static __rpn_operation *__rpn_definitions[] = {
       &RpnDebugTokenizer,
       &RpnDebugStack,
@@ -844,13 +1147,6 @@ static __rpn_operation *__rpn_definitions[] = {
       &RpnPush_C3,
       &RpnPush_C4,
 
-      &RpnPushReg1,
-      &RpnPushReg2,
-      &RpnPushReg3,
-      &RpnPushReg4,
-
-      &RpnPushMemX,
-
       /*
       &RpnPushEnumRelEnc,
       &RpnPushEnumVtxType,
@@ -931,134 +1227,56 @@ static __rpn_operation *__rpn_definitions[] = {
       &RpnBinaryAdd,
       &RpnBinarySub,
       &RpnBinaryMul,
-      &RpnBinaryDiv,
-      &RpnBinaryMod,
-      &RpnBinaryPow,
-      &RpnBinaryATan2,
-      &RpnBinaryMax,
-      &RpnBinaryMin,
-      &RpnBinaryProx,
-      &RpnBinaryApprox,
-      &RpnBinaryRange,
-      &RpnBinaryHamDist,
-      &RpnBinaryEuclidean,
-      &RpnBinarySimilarity,
-      &RpnBinaryCosine,
-      &RpnBinaryJaccard,
-      &RpnBinaryComb,
-      &RpnBinaryEqu,
-      &RpnBinaryNeq,
-      &RpnBinaryGt,
-      &RpnBinaryGte,
-      &RpnBinaryLt,
-      &RpnBinaryLte,
-      &RpnBinaryElementOf,
-      &RpnBinaryNotElementOf,
-      // Logical
-      &RpnLogicalOr,
-      &RpnLogicalAnd,
-      // Ternary
-      &RpnTernaryCondition,
-      &RpnTernaryColon,
-      // Quaternary
-      &RpnQuaternaryHavDist,
-      &RpnQuaternaryGeoProx,
-      // Bitwise
-      &RpnBitwiseShiftLeft,
-      &RpnBitwiseShiftRight,
-      &RpnBitwiseOr,
-      &RpnBitwiseAnd,
-      &RpnBitwiseXor,
-      // Assignment
-      &RpnAssign,
-      &RpnAssignVariable,
-      // Enum
-      &RpnEnumRelEnc,
-      &RpnEnumTypeEnc,
-      &RpnEnumRelDec,
-      &RpnEnumTypeDec,
-      &RpnEnumModToStr,
-      &RpnEnumDirToStr,
-
-      // Memory single register
-      &RpnMemoryStore,
-      &RpnMemoryRefStore,
-      &RpnMemoryStoreIf,
-      &RpnMemoryRefStoreIf,
-      &RpnMemoryWrite,
-      &RpnMemoryRWrite,
-      &RpnMemoryWriteIf,
-      &RpnMemoryRWriteIf,
-
-      &RpnMemoryLoad,
-      &RpnMemoryRefLoad,
-
-      &RpnMemoryPush,
-      &RpnMemoryPushIf,
-      &RpnMemoryPop,
-      &RpnMemoryPopIf,
-      &RpnMemoryGet,
-
-      &RpnMemoryMov,
-      &RpnMemoryRefMov,
-      &RpnMemoryMovIf,
-      &RpnMemoryRefMovIf,
-
-      &RpnMemoryXchg,
-      &RpnMemoryRefXchg,
-      &RpnMemoryXchgIf,
-      &RpnMemoryRefXchgIf,
-
-      &RpnMemoryInc,
-      &RpnMemoryRefInc,
-      &RpnMemoryIncIf,
-      &RpnMemoryRefIncIf,
-      &RpnMemoryDec,
-      &RpnMemoryRefDec,
-      &RpnMemoryDecIf,
-      &RpnMemoryRefDecIf,
-
-      &RpnMemoryEqu,
-      &RpnMemoryRefEqu,
-      &RpnMemoryNeq,
-      &RpnMemoryRefNeq,
-
-      &RpnMemoryGt,
-      &RpnMemoryRefGt,
-      &RpnMemoryGte,
-      &RpnMemoryRefGte,
-
-      &RpnMemoryLt,
-      &RpnMemoryRefLt,
-      &RpnMemoryLte,
-      &RpnMemoryRefLte,
-
-      &RpnMemoryAdd,
-      &RpnMemoryAddIf,
-      &RpnMemorySub,
-      &RpnMemorySubIf,
-      &RpnMemoryMul,
-      &RpnMemoryMulIf,
-      &RpnMemoryDiv,
-      &RpnMemoryDivIf,
-      &RpnMemoryMod,
-      &RpnMemoryModIf,
-
-      &RpnMemoryShr,
-      &RpnMemoryShrIf,
-      &RpnMemoryShl,
-      &RpnMemoryShlIf,
-      &RpnMemoryAnd,
-      &RpnMemoryAndIf,
-      &RpnMemoryOr,
-      &RpnMemoryOrIf,
-      &RpnMemoryXor,
-      &RpnMemoryXorIf,
-
-      &RpnMemorySmooth,
-      &RpnMemoryCount,
-      &RpnMemoryCountIf,
+      &RpnBinaryDiv,
+      &RpnBinaryMod,
+      &RpnBinaryPow,
+      &RpnBinaryATan2,
+      &RpnBinaryMax,
+      &RpnBinaryMin,
+      &RpnBinaryProx,
+      &RpnBinaryApprox,
+      &RpnBinaryRange,
+      &RpnBinaryHamDist,
+      &RpnBinaryEuclidean,
+      &RpnBinarySimilarity,
+      &RpnBinaryCosine,
+      &RpnBinaryJaccard,
+      &RpnBinaryComb,
+      &RpnBinaryEqu,
+      &RpnBinaryNeq,
+      &RpnBinaryGt,
+      &RpnBinaryGte,
+      &RpnBinaryLt,
+      &RpnBinaryLte,
+      &RpnBinaryElementOf,
+      &RpnBinaryNotElementOf,
+      // Logical
+      &RpnLogicalOr,
+      &RpnLogicalAnd,
+      // Ternary
+      &RpnTernaryCondition,
+      &RpnTernaryColon,
+      // Quaternary
+      &RpnQuaternaryHavDist,
+      &RpnQuaternaryGeoProx,
+      // Bitwise
+      &RpnBitwiseShiftLeft,
+      &RpnBitwiseShiftRight,
+      &RpnBitwiseOr,
+      &RpnBitwiseAnd,
+      &RpnBitwiseXor,
+      // Assignment
+      &RpnAssign,
+      &RpnAssignVariable,
+      // Enum
+      &RpnEnumRelEnc,
+      &RpnEnumTypeEnc,
+      &RpnEnumRelDec,
+      &RpnEnumTypeDec,
+      &RpnEnumModToStr,
+      &RpnEnumDirToStr,
 
+      // Packed int8
       &RpnMemory_ecld_pi8_512,
       &RpnMemory_ssq_pi8_512,
       &RpnMemory_rsqrtssq_pi8_512,
@@ -1077,208 +1295,11 @@ static __rpn_operation *__rpn_definitions[] = {
       &RpnMemory_cos_pi8,
       &RpnMemory_ham_pi8,
 
-      &RpnMemoryModIndex,
-      &RpnMemoryIndex,
-      &RpnMemoryIndexed,
-      &RpnMemoryUnindex,
-
-
-      // Memory multi register
-      &RpnMemoryMSet,
-      &RpnMemoryMReset,
-      &RpnMemoryMRandomize,
-      &RpnMemoryMRandbits,
-      &RpnMemoryMCopy,
-      &RpnMemoryMPWrite,
-      &RpnMemoryMCopyObj,
-
-      &RpnMemoryMTerm,
-      &RpnMemoryMLen,
-
-      &RpnMemoryHeapInit,
-      &RpnMemoryHeapPushMin,
-      &RpnMemoryHeapPushMax,
-      &RpnMemoryHeapWriteMin,
-      &RpnMemoryHeapWriteMax,
-      &RpnMemoryHeapifyMin,
-      &RpnMemoryHeapifyMax,
-
-      &RpnMemoryHeapSiftMin,
-      &RpnMemoryHeapSiftMax,
-
-      &RpnMemoryMSort,
-      &RpnMemoryMSortRev,
-      &RpnMemoryMRSort,
-      &RpnMemoryMRSortRev,
-      &RpnMemoryMReverse,
-
-      &RpnMemoryMInt,
-      &RpnMemoryMIntR,
-      &RpnMemoryMReal,
-      &RpnMemoryMBits,
-
-      &RpnMemoryMInc,
-      &RpnMemoryMIInc,
-      &RpnMemoryMRInc,
-      &RpnMemoryMDec,
-      &RpnMemoryMIDec,
-      &RpnMemoryMRDec,
-
-      &RpnMemoryMAdd,
-      &RpnMemoryMIAdd,
-      &RpnMemoryMRAdd,
-      &RpnMemoryMVAdd,
-
-      &RpnMemoryMSub,
-      &RpnMemoryMISub,
-      &RpnMemoryMRSub,
-      &RpnMemoryMVSub,
-
-      &RpnMemoryMMul,
-      &RpnMemoryMIMul,
-      &RpnMemoryMRMul,
-      &RpnMemoryMVMul,
-
-      &RpnMemoryMDiv,
-      &RpnMemoryMIDiv,
-      &RpnMemoryMRDiv,
-      &RpnMemoryMVDiv,
-
-      &RpnMemoryMMod,
-      &RpnMemoryMIMod,
-      &RpnMemoryMRMod,
-      &RpnMemoryMVMod,
-
-      &RpnMemoryMInv,
-      &RpnMemoryMRInv,
-
-      &RpnMemoryMPow,
-      &RpnMemoryMRPow,
-      &RpnMemoryMSq,
-      &RpnMemoryMRSq,
-      &RpnMemoryMSqrt,
-      &RpnMemoryMRSqrt,
-
-      &RpnMemoryMCeil,
-      &RpnMemoryMRCeil,
-      &RpnMemoryMFloor,
-      &RpnMemoryMRFloor,
-      &RpnMemoryMRound,
-      &RpnMemoryMRRound,
-      &RpnMemoryMAbs,
-      &RpnMemoryMRAbs,
-      &RpnMemoryMSign,
-      &RpnMemoryMRSign,
-
-      &RpnMemoryMLog2,
-      &RpnMemoryMRLog2,
-      &RpnMemoryMLog,
-      &RpnMemoryMRLog,
-      &RpnMemoryMLog10,
-      &RpnMemoryMRLog10,
-      &RpnMemoryMExp2,
-      &RpnMemoryMRExp2,
-      &RpnMemoryMExp,
-      &RpnMemoryMRExp,
-      &RpnMemoryMExp10,
-      &RpnMemoryMRExp10,
-
-
-      &RpnMemoryMRad,
-      &RpnMemoryMRRad,
-      &RpnMemoryMDeg,
-      &RpnMemoryMRDeg,
-      &RpnMemoryMSin,
-      &RpnMemoryMRSin,
-      &RpnMemoryMCos,
-      &RpnMemoryMRCos,
-      &RpnMemoryMTan,
-      &RpnMemoryMRTan,
-      &RpnMemoryMASin,
-      &RpnMemoryMRASin,
-      &RpnMemoryMACos,
-      &RpnMemoryMRACos,
-      &RpnMemoryMATan,
-      &RpnMemoryMRATan,
-      &RpnMemoryMSinh,
-      &RpnMemoryMRSinh,
-      &RpnMemoryMCosh,
-      &RpnMemoryMRCosh,
-      &RpnMemoryMTanh,
-      &RpnMemoryMRTanh,
-      &RpnMemoryMASinh,
-      &RpnMemoryMRASinh,
-      &RpnMemoryMACosh,
-      &RpnMemoryMRACosh,
-      &RpnMemoryMATanh,
-      &RpnMemoryMRATanh,
-      &RpnMemoryMSinc,
-      &RpnMemoryMRSinc,
-
-      &RpnMemoryMShr,
-      &RpnMemoryMVShr,
-      &RpnMemoryMShl,
-      &RpnMemoryMVShl,
-
-      &RpnMemoryMAnd,
-      &RpnMemoryMVAnd,
-      &RpnMemoryMOr,
-      &RpnMemoryMVOr,
-      &RpnMemoryMXor,
-      &RpnMemoryMVXor,
-      &RpnMemoryMPopcnt,
-
-      &RpnMemoryMHash,
-
-      &RpnMemoryMSum,
-      &RpnMemoryMRSum,
-      &RpnMemoryMSumSqr,
-      &RpnMemoryMRSumSqr,
-      &RpnMemoryMInvSum,
-      &RpnMemoryMRInvSum,
-      &RpnMemoryMProd,
-      &RpnMemoryMRProd,
-      &RpnMemoryMMean,
-      &RpnMemoryMRMean,
-      &RpnMemoryMHarmMean,
-      &RpnMemoryMRHarmMean,
-      &RpnMemoryMGeoMean,
-      &RpnMemoryMRGeoMean,
-      &RpnMemoryMStdev,
-      &RpnMemoryMRStdev,
-      &RpnMemoryMGeoStdev,
-      &RpnMemoryMRGeoStdev,
-
-      &RpnMemoryMMax,
-      &RpnMemoryMMin,
-      &RpnMemoryMContains,
-      &RpnMemoryMCount,
-      &RpnMemoryMIndex,
-      &RpnMemoryMCmp,
-      &RpnMemoryMCmpA,
-      &RpnMemoryMSubset,
-      &RpnMemoryMSubsetObj,
-      &RpnMemoryMSumProdObj,
+      // Probe
       &RpnMemoryProbeArray,
       &RpnMemoryProbeAltArr,
       &RpnMemoryProbeSuperArr,
 
-      // QWORD Set
-      &RpnISetAdd,
-      &RpnISetDel,
-      &RpnISetClr,
-      &RpnISetHas,
-      &RpnISetLen,
-      &RpnISetIni,
-
-      // Vertex Set
-      &RpnVSetAdd,
-      &RpnVSetDel,
-      &RpnVSetClr,
-      &RpnVSetHas,
-      &RpnVSetLen,
-      &RpnVSetIni,
-
       // Object
       &RpnObjectLen,
       &RpnObjectStrlen,
@@ -1288,6 +1309,11 @@ static __rpn_operation *__rpn_definitions[] = {
       &RpnVarLastValue,
       &RpnVarRank,
       &RpnVarGeoRank,
+      &RpnVarBM25,
+      &RpnVarCommonNeighbors,
+      &RpnVarNeighborJaccard,
+      &RpnVarNeighborCosine,
+      &RpnVarAdamicAdar,
       &RpnVarSum,
       &RpnVarSumSquare,
       &RpnVarStdev,
@@ -1332,13 +1358,17 @@ static express_eval_map * __rpndef__opmap_new( const char *name ) {
   if( (rpn_operations = calloc( 1, sizeof( express_eval_map ) )) != NULL ) {
     if( (rpn_operations->map = iMapping.NewIntegerMap( &rpn_operations->dyn, name )) != NULL ) {
 #define ADD_RPN_OPERATION( Name, RpnOperation ) iMapping.IntegerMapAdd( &rpn_operations->map, &rpn_operations->dyn, Name, (intptr_t)(RpnOperation) )
-      __rpn_operation **cursor = __rpn_definitions;
+      __rpn_operation **tables[] = { __rpn_definitions, __rpn_memory_definitions, NULL };
+      __rpn_operation ***table = tables;
+      __rpn_operation **cursor;
       __rpn_operation *op;
       int64_t sz = 0;
-      while( (op = *cursor++) != NULL ) {
-        if( op->surface.token ) {
-          ADD_RPN_OPERATION( op->surface.token, op );
-          sz++;
+      while( (cursor = *table++) != NULL ) {
+        while( (op = *cursor++) != NULL ) {
+          if( op->surface.token ) {
+            ADD_RPN_OPERATION( op->surface.token, op );
+            sz++;
+          }
         }
       }
       // Check that all mappings exist
@@ -1402,6 +1432,24 @@ static int __rpndef__is_property_lookup( const __rpn_operation *op ) {
 
 
 
+/*******************************************************************//**
+ * Return 1 if operation reads or writes evaluator memory
+ ***********************************************************************
+ */
+static int __rpndef__is_memory_operation( const __rpn_operation *op ) {
+  f_evaluator f = op->function.eval;
+  __rpn_operation **cursor = __rpn_memory_definitions;
+  const __rpn_operation *mem_op;
+  while( (mem_op = *cursor++) != NULL ) {
+    if( f == mem_op->function.eval ) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+
 
 
 
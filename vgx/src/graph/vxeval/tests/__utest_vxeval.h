@@ -7647,7 +7647,7 @@ BEGIN_UNIT_TEST( __utest_vxeval ) {
       "relenc", "typeenc", "reldec", "typedec", "modtostr", "dirtostr",
       "len",
       "range", "range", "range", "range", "range",
-      "rank", "georank",
+      "rank", "georank", "bm25", "commonneighbors", "neighborjaccard", "neighborcosine", "adamicadar",
       "sum", "sumsqr", "invsum", "prod", "mean", "harmmean", "geomean",
       "sum", "sumsqr", "invsum", "prod", "mean", "harmmean", "geomean",
       "sum", "sumsqr", "invsum", "prod", "mean", "harmmean", "geomean",
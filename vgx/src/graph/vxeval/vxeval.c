@@ -161,6 +161,8 @@ static void                   Evaluator__set_timing_budget( vgx_Evaluator_t *sel
 static vgx_EvalStackItem_t *  Evaluator__eval( vgx_Evaluator_t *self );
 static vgx_EvalStackItem_t *  Evaluator__eval_vertex( vgx_Evaluator_t *self, const vgx_Vertex_t *vertex );
 static vgx_EvalStackItem_t *  Evaluator__eval_arc( vgx_Evaluator_t *self, vgx_LockableArc_t *next );
+static uint64_t               Evaluator__eval_arc_block( vgx_Evaluator_t *self, vgx_LockableArc_t *next, const vgx_ArcHeadHeapItem_t *block, int n );
+static bool                   Evaluator__has_batch( const vgx_Evaluator_t *self );
 static int                    Evaluator__n_this_deref( const vgx_Evaluator_t *self );
 static int                    Evaluator__n_head_deref( const vgx_Evaluator_t *self );
 static int                    Evaluator__n_traversals( const vgx_Evaluator_t *self );
@@ -170,6 +172,7 @@ static int                    Evaluator__n_identifiers( const vgx_Evaluator_t *s
 static bool                   Evaluator__has_cull( const vgx_Evaluator_t *self );
 static int                    Evaluator__n_synarc_ops( const vgx_Evaluator_t *self );
 static int                    Evaluator__n_wreg_ops( const vgx_Evaluator_t *self );
+static int                    Evaluator__n_memory_ops( const vgx_Evaluator_t *self );
 static int64_t                Evaluator__get_wreg_ncall( const vgx_Evaluator_t *self );
 static int                    Evaluator__clear_wreg( vgx_Evaluator_t *self );
 static void                   Evaluator__clear_mcull_heap_array( vgx_Evaluator_t *self );
@@ -205,6 +208,8 @@ static vgx_Evaluator_vtable_t Evaluator_Methods = {
   .Eval             = Evaluator__eval,
   .EvalVertex       = Evaluator__eval_vertex,
   .EvalArc          = Evaluator__eval_arc,
+  .EvalArcBlock     = Evaluator__eval_arc_block,
+  .HasBatch         = Evaluator__has_batch,
   .PrevDeref        = Evaluator__n_lookbacks,
   .ThisDeref        = Evaluator__n_this_deref,
   .HeadDeref        = Evaluator__n_head_deref,
@@ -214,6 +219,7 @@ static vgx_Evaluator_vtable_t Evaluator_Methods = {
   .HasCull          = Evaluator__has_cull,
   .SynArcOps        = Evaluator__n_synarc_ops,
   .WRegOps          = Evaluator__n_wreg_ops,
+  .MemoryOps        = Evaluator__n_memory_ops,
   .ClearWReg        = Evaluator__clear_wreg,
   .GetWRegNCall     = Evaluator__get_wreg_ncall,
   .ClearMCull       = Evaluator__clear_mcull_heap_array,
@@ -239,6 +245,7 @@ static void __Evaluator_deconstruct( vgx_Evaluator_t *self );
  */
 static void              __reset_runtime_stack( vgx_Evaluator_t *self );
 static vgx_EvalStackItem_t * __evaluator__run( vgx_Evaluator_t *self );
+static vgx_EvalStackItem_t * __evaluator__run_segment( vgx_Evaluator_t *self, const vgx_ExpressEvalBatchStep_t *step );
 
 
 
@@ -2059,6 +2066,9 @@ static vgx_Evaluator_t * Evaluator__constructor( void const *__ign_identifier, v
     }
 
     self->cache.CSTR__tmp_prop = NULL;
+    self->cache.textscorer = NULL;
+    self->cache.neighbors[0] = NULL;
+    self->cache.neighbors[1] = NULL;
 
     // Ready
     if( Evaluator__reset( self ) < 0 ) {
@@ -2163,6 +2173,10 @@ __inline static void __clear_eval_caches( vgx_ExpressEvalCache_t *ec ) {
   ec->vertextype.CSTR__type = NULL;
   ec->vertextype.typehash = 0;
   ec->vertextype.vtx = VERTEX_TYPE_ENUMERATION_NONE;
+
+  if( ec->neighbors[0] ) {
+    ec->neighbors[0]->vertex = NULL;
+  }
 }
 
 
@@ -2229,6 +2243,10 @@ static int Evaluator__reset( vgx_Evaluator_t *self ) {
 static void Evaluator__set_context( vgx_Evaluator_t *self, const vgx_Vertex_t *tail, const vgx_ArcHead_t *arc, vgx_Vector_t *vector, double rankscore ) {
   // Reset tail property cache
   self->cache.TAIL.vertex = NULL;
+  // Reset neighbor set cache
+  if( self->cache.neighbors[0] ) {
+    self->cache.neighbors[0]->vertex = NULL;
+  }
 
   self->context.VERTEX = self->context.TAIL = tail;
   self->context.rankscore = rankscore;
@@ -2406,6 +2424,130 @@ static vgx_EvalStackItem_t * Evaluator__eval_arc( vgx_Evaluator_t *self, vgx_Loc
 
 
 
+/*******************************************************************//**
+ * 
+ * Evaluate a block of n next arcs sharing the same tail.
+ * The head of each arc is given by block[i], and next is used as the
+ * arc context for all of them (its head is overwritten.)
+ *
+ * Returns a mask with bit i set if the program result for arc i is
+ * positive.
+ *
+ * Operands are gathered per arc and operators run over whole columns.
+ * Arcs whose operands or intermediate results are not representable as
+ * exact columnar numbers are re-evaluated by the scalar program.
+ ***********************************************************************
+ */
+static uint64_t Evaluator__eval_arc_block( vgx_Evaluator_t *self, vgx_LockableArc_t *next, const vgx_ArcHeadHeapItem_t *block, int n ) {
+  __batch_column col[ VGX_EXPRESS_EVAL_BATCH_MAX_DEPTH ];
+  uint32_t integer[ VGX_EXPRESS_EVAL_BATCH_MAX_DEPTH ];
+  const vgx_ExpressEvalBatchStep_t *step = self->rpn_program.batch;
+  uint32_t lanes = n < 32 ? (1U << n) - 1 : 0xFFFFFFFFU;
+  uint32_t fallback = 0;
+  uint32_t match = 0;
+  double value;
+  int d = 0;
+  int t;
+
+  // Program not batchable
+  if( step == NULL || n > VGX_EXPRESS_EVAL_BATCH_SIZE ) {
+    fallback = lanes;
+    goto scalar;
+  }
+
+  // Shared arc context
+  self->context.VERTEX = next->tail;
+  self->context.larc = next;
+
+  for( ; step->kind != VGX_EXPRESS_EVAL_BATCH_END; step++ ) {
+    double *x = col[d];
+    switch( step->kind ) {
+    // Same value for all arcs
+    case VGX_EXPRESS_EVAL_BATCH_BROADCAST:
+      if( (t = __batch_item_as_double( __evaluator__run_segment( self, step ), &value )) < 0 ) {
+        fallback = lanes;
+        goto scalar;
+      }
+      for( int k=0; k<VGX_EXPRESS_EVAL_BATCH_SIZE; k++ ) {
+        x[k] = value;
+      }
+      integer[d++] = t ? 0xFFFFFFFFU : 0;
+      continue;
+    // Value depends on arc
+    case VGX_EXPRESS_EVAL_BATCH_GATHER:
+      integer[d] = 0;
+      for( int i=0; i<n; i++ ) {
+        next->head.vertex = (vgx_Vertex_t*)block[i].vertex;
+        next->head.predicator = block[i].predicator;
+        self->cache.HEAD.vertex = NULL;
+        self->context.exit = next->head.predicator;
+        self->context.HEAD = next->head.vertex;
+        if( (t = __batch_item_as_double( __evaluator__run_segment( self, step ), &value )) < 0 ) {
+          fallback |= 1U << i;
+          value = 0.0;
+        }
+        else if( t ) {
+          integer[d] |= 1U << i;
+        }
+        x[i] = value;
+      }
+      for( int k=n; k<VGX_EXPRESS_EVAL_BATCH_SIZE; k++ ) {
+        x[k] = 0.0;
+      }
+      d++;
+      continue;
+    // Unary column operator
+    case VGX_EXPRESS_EVAL_BATCH_NOT:
+      __batch_column_logical( step->kind, col[d-1], NULL, &integer[d-1], 0 );
+      continue;
+    // Binary column operators
+    case VGX_EXPRESS_EVAL_BATCH_AND:
+    case VGX_EXPRESS_EVAL_BATCH_OR:
+      __batch_column_logical( step->kind, col[d-2], col[d-1], &integer[d-2], integer[d-1] );
+      break;
+    case VGX_EXPRESS_EVAL_BATCH_ADD:
+    case VGX_EXPRESS_EVAL_BATCH_SUB:
+    case VGX_EXPRESS_EVAL_BATCH_MUL:
+      __batch_column_arithmetic( step->kind, col[d-2], col[d-1], &integer[d-2], integer[d-1], &fallback );
+      break;
+    default:
+      __batch_column_compare( step->kind, col[d-2], col[d-1], &integer[d-2] );
+      break;
+    }
+    --d;
+  }
+
+  match = __batch_column_positive( col[0] ) & lanes & ~fallback;
+
+scalar:
+  // Arcs not representable in batch mode are evaluated one by one
+  fallback &= lanes;
+  for( int i=0; fallback; i++, fallback >>= 1 ) {
+    if( fallback & 1 ) {
+      next->head.vertex = (vgx_Vertex_t*)block[i].vertex;
+      next->head.predicator = block[i].predicator;
+      if( iEvaluator.IsPositive( Evaluator__eval_arc( self, next ) ) ) {
+        match |= 1U << i;
+      }
+    }
+  }
+
+  return match;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+static bool Evaluator__has_batch( const vgx_Evaluator_t *self ) {
+  return self->rpn_program.batch != NULL;
+}
+
+
+
 /*******************************************************************//*
  * 
  * 
@@ -2505,6 +2647,17 @@ static int Evaluator__n_wreg_ops( const vgx_Evaluator_t *self ) {
 
 
 
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+static int Evaluator__n_memory_ops( const vgx_Evaluator_t *self ) {
+  return self->rpn_program.memory_ops;
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -2619,6 +2772,16 @@ static vgx_Evaluator_t * Evaluator__clone( vgx_Evaluator_t *self, vgx_Vector_t *
         clone->rpn_program.cull = orig->cull;
         clone->rpn_program.synarc_ops = orig->synarc_ops;
         clone->rpn_program.n_wreg = orig->n_wreg;
+        clone->rpn_program.memory_ops = orig->memory_ops;
+        if( orig->batch ) {
+          const vgx_ExpressEvalBatchStep_t *step = orig->batch;
+          while( step++->kind != VGX_EXPRESS_EVAL_BATCH_END );
+          size_t n_steps = step - orig->batch;
+          if( (clone->rpn_program.batch = calloc( n_steps, sizeof( vgx_ExpressEvalBatchStep_t ) )) == NULL ) {
+            THROW_ERROR( CXLIB_ERR_MEMORY, 0x007 );
+          }
+          memcpy( clone->rpn_program.batch, orig->batch, n_steps * sizeof( vgx_ExpressEvalBatchStep_t ) );
+        }
         int opcount = orig->length + orig->n_passthru;
         CALIGNED_ARRAY_THROWS( clone->rpn_program.operations, vgx_ExpressEvalOperation_t, opcount + 1LL, 0x001 );
         clone->rpn_program.parser._cursor = clone->rpn_program.operations;
@@ -2670,6 +2833,9 @@ static vgx_Evaluator_t * Evaluator__clone( vgx_Evaluator_t *self, vgx_Vector_t *
         }
 
         clone->cache.CSTR__tmp_prop = NULL;
+        clone->cache.textscorer = NULL;
+        clone->cache.neighbors[0] = NULL;
+        clone->cache.neighbors[1] = NULL;
 
         // Ready
         if( Evaluator__reset( clone ) < 0 ) {
@@ -2730,10 +2896,17 @@ static void __Evaluator_deconstruct( vgx_Evaluator_t *self ) {
   iEvaluator.DeleteLocalScope( self );
   // Cache temp
   iString.Discard( &self->cache.CSTR__tmp_prop );
+  _vxgraph_textindex__delete_scorer( &self->cache.textscorer );
+  _vxgraph_neighbors__delete_set( &self->cache.neighbors[0] );
+  _vxgraph_neighbors__delete_set( &self->cache.neighbors[1] );
   // Program
   if( self->rpn_program.operations ) {
     ALIGNED_FREE( self->rpn_program.operations );
   }
+  // Batch plan
+  if( self->rpn_program.batch ) {
+    free( self->rpn_program.batch );
+  }
   // Info
   if( self->rpn_program.debug.info ) {
     COMLIB_OBJECT_DESTROY( self->rpn_program.debug.info );
@@ -2814,6 +2987,32 @@ __inline static vgx_EvalStackItem_t * __evaluator__run( vgx_Evaluator_t *self )
 
 
 
+/*******************************************************************//**
+ * 
+ * Run the program operations of a single batch operand on a fresh stack
+ ***********************************************************************
+ */
+__inline static vgx_EvalStackItem_t * __evaluator__run_segment( vgx_Evaluator_t *self, const vgx_ExpressEvalBatchStep_t *step ) {
+  // Reset stack
+  __reset_runtime_stack( self );
+
+  // Reset local scope
+  if( self->context.local_scope.objects ) {
+    iEvaluator.ClearLocalScope( self );
+  }
+
+  // Run segment
+  const vgx_ExpressEvalOperation_t *end = self->rpn_program.operations + step->offset + step->count;
+  for( self->op = self->rpn_program.operations + step->offset; self->op < end; ++self->op ) {
+    self->op->func( self );
+  }
+
+  // Return top of stack after completion
+  return GET_PITEM( self );
+}
+
+
+
 /*******************************************************************//**
  *
  ***********************************************************************
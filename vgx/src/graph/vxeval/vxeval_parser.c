@@ -229,6 +229,7 @@ DLL_HIDDEN int _vxeval_parser__create_rpn_from_infix( vgx_ExpressEvalProgram_t *
     program->cull = 0;
     program->synarc_ops = 0;
     program->n_wreg = 0;
+    program->memory_ops = 0;
 
     __rpn_operation *mapped_rpn_operation = NULL;
     __rpn_operation *shunt_op = NULL;
@@ -473,6 +474,7 @@ DLL_HIDDEN int _vxeval_parser__create_rpn_from_infix( vgx_ExpressEvalProgram_t *
               program->deref.head += __is_head_deref_operand( current_op );
               program->deref.arc += __is_traverse_operand( current_op );
               program->synarc_ops += __is_synarc_operand( current_op );
+              program->memory_ops += __rpndef__is_memory_operation( current_op );
 
               // Variable
               // Symbolic or Literal Operand goes straight to output because it is fully defined without further parsing ( e.g. vertex.deg, next.type, next.arc.type, pi, etc. )
@@ -1362,6 +1364,8 @@ DLL_HIDDEN int _vxeval_parser__create_rpn_from_infix( vgx_ExpressEvalProgram_t *
       program_cur++->arg.type &= __STACK_ITEM_TYPE_MASK;
     }
 
+    // Columnar execution plan, if program qualifies
+    program->batch = __batch_compile_program( program );
 
     // New rpn created
     ret = 1;
@@ -42,6 +42,92 @@ BEGIN_UNIT_TEST( __utest_vxevent_eventexec ) {
   } END_TEST_SCENARIO
 
 
+  /*******************************************************************//**
+   * EXECUTOR POOL
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Executor pool" ) {
+    vgx_EventExecutorPool_t *executors;
+
+    executors = __eventexec_new_executor_pool( 0 );
+    TEST_ASSERTION( executors != NULL,                          "pool created" );
+    TEST_ASSERTION( executors->n_shards == 1,                   "at least one shard" );
+    TEST_ASSERTION( executors->throttle.max_rate == 0,          "no rate limit by default" );
+    __eventexec_delete_executor_pool( &executors );
+    TEST_ASSERTION( executors == NULL,                          "pool deleted" );
+
+    executors = __eventexec_new_executor_pool( 1000 );
+    TEST_ASSERTION( executors != NULL,                          "pool created" );
+    TEST_ASSERTION( executors->n_shards == VGX_EVENT_EXECUTOR_MAX_SHARDS, "shards capped" );
+    for( int shard=0; shard < executors->n_shards; shard++ ) {
+      TEST_ASSERTION( executors->shard[shard] == NULL,          "shards started on demand" );
+    }
+    __eventexec_delete_executor_pool( &executors );
+  } END_TEST_SCENARIO
+
+
+  /*******************************************************************//**
+   * SHARD PARTITIONING
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Shard partitioning" ) {
+    int n_shards = 4;
+    int64_t count[4] = {0};
+    vgx_VertexStorableEvent_t ev = {0};
+    for( QWORD k=1; k<=10000; k++ ) {
+      ev.event_key.allocdata = k;
+      ev.event_val.ts_exec = (uint32_t)k;
+      int shard = __eventexec_shard_of( &ev, n_shards );
+      TEST_ASSERTION( shard >= 0 && shard < n_shards,           "shard in range" );
+      // Same vertex always maps to same shard regardless of event value
+      ev.event_val.ts_exec = 0;
+      TEST_ASSERTION( __eventexec_shard_of( &ev, n_shards ) == shard, "stable shard" );
+      count[shard]++;
+    }
+    for( int i=0; i<n_shards; i++ ) {
+      TEST_ASSERTION( count[i] > 2000,                          "balanced shards" );
+    }
+    TEST_ASSERTION( __eventexec_shard_of( &ev, 1 ) == 0,        "single shard" );
+  } END_TEST_SCENARIO
+
+
+  /*******************************************************************//**
+   * THROTTLE REFUND
+   ***********************************************************************
+   */
+  NEXT_TEST_SCENARIO( true, "Throttle refund" ) {
+    vgx_EventExecutorPool_t *executors = __eventexec_new_executor_pool( 0 );
+    TEST_ASSERTION( executors != NULL,                          "pool created" );
+    vgx_ExecutionJobDescriptor_t job = {0};
+    job.throttle = &executors->throttle;
+    executors->throttle.max_rate = 1000;
+    executors->throttle.tms_window = 12345;
+    executors->throttle.n_window = 100;
+
+    // Unused grant returned to current window
+    __executor_refund_batch( &job, 12345, 30 );
+    TEST_ASSERTION( executors->throttle.n_window == 70,         "unused grant refunded" );
+
+    // Nothing to refund
+    __executor_refund_batch( &job, 12345, 0 );
+    TEST_ASSERTION( executors->throttle.n_window == 70,         "no refund" );
+
+    // Grant was charged to a previous window
+    __executor_refund_batch( &job, 12344, 30 );
+    TEST_ASSERTION( executors->throttle.n_window == 70,         "stale window not refunded" );
+
+    // Never below zero
+    __executor_refund_batch( &job, 12345, 500 );
+    TEST_ASSERTION( executors->throttle.n_window == 0,          "refund capped" );
+
+    // No throttle
+    job.throttle = NULL;
+    __executor_refund_batch( &job, 12345, 10 );
+
+    __eventexec_delete_executor_pool( &executors );
+  } END_TEST_SCENARIO
+
+
 
 } END_UNIT_TEST
 
@@ -58,7 +58,8 @@ static void _vxevent_eventapi__drop_vertex_event_CS_WL_NT( vgx_Graph_t *self, vg
 
 static int _vxevent_eventapi__exists_in_schedule_WL_NT( vgx_Graph_t *self, vgx_Vertex_t *vertex_WL );
 
-static uint32_t _vxevent_eventapi__executor_thread_id( vgx_Graph_t *self );
+static bool _vxevent_eventapi__is_executor_thread( vgx_Graph_t *self, uint32_t threadid );
+static int64_t _vxevent_eventapi__set_executor_throttle( vgx_Graph_t *self, int64_t max_rate );
 
 
 DLL_EXPORT vgx_IGraphEvent_t iGraphEvent = {
@@ -91,7 +92,8 @@ DLL_EXPORT vgx_IGraphEvent_t iGraphEvent = {
   },
 
   .ExistsInSchedule_WL_NT         = _vxevent_eventapi__exists_in_schedule_WL_NT,
-  .ExecutorThreadId               = _vxevent_eventapi__executor_thread_id
+  .IsExecutorThread               = _vxevent_eventapi__is_executor_thread,
+  .SetExecutorThrottle            = _vxevent_eventapi__set_executor_throttle
 
 };
 
@@ -203,11 +205,13 @@ static int _vxevent_eventapi__initialize( vgx_Graph_t *self, bool run_daemon ) {
           THROW_ERROR( CXLIB_ERR_GENERAL, 0x111 );
         }
 
-        // [Q1.3] Execution job descriptor
-        processor->EXECUTOR = NULL;
+        // [Q1.3] Execution job descriptors (one per shard, started on demand)
+        if( (processor->EXECUTORS = __eventexec_new_executor_pool( g_pevent_param->Executor.partials )) == NULL ) {
+          THROW_ERROR( CXLIB_ERR_MEMORY, 0x117 );
+        }
 
-        // [Q1.4.1] Executor thread ID
-        processor->executor_thread_id = 0;
+        // [Q1.4.1]
+        processor->__rsv_1_4_1 = 0;
 
         // [Q1.5] Parameters
         __init_eventproc_parameters( &processor->params );
@@ -679,17 +683,38 @@ static vgx_EventBacklogInfo_t _vxevent_eventapi__backlog_info( vgx_Graph_t *self
       backlog.flags.is_running = task != NULL && COMLIB_TASK__IsAlive( task );
       backlog.flags.is_paused = COMLIB_TASK__IsSuspended( task );
 
-      if( processor_WL->EXECUTOR && processor_WL->EXECUTOR->TASK ) {
-        COMLIB_TASK_LOCK( processor_WL->EXECUTOR->TASK ) {
-          backlog.n_exec = processor_WL->EXECUTOR->n_exec;
-          backlog.ontime_rate = processor_WL->EXECUTOR->ontime_rate;
-          backlog.n_current = processor_WL->EXECUTOR->n_current;
-        } COMLIB_TASK_RELEASE;
-      }
-      else {
-        backlog.n_exec = 0;
-        backlog.ontime_rate = 0.0f;
-        backlog.n_current = (int)LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue );
+      // Events not yet handed to an executor shard
+      backlog.n_current = (int)LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue );
+      backlog.n_exec = 0;
+      backlog.ontime_rate = 0.0f;
+
+      vgx_EventExecutorPool_t *executors = processor_WL->EXECUTORS;
+      if( executors ) {
+        backlog.executor.n_shards = executors->n_shards;
+        SYNCHRONIZE_ON( executors->throttle.lock ) {
+          backlog.executor.max_rate = executors->throttle.max_rate;
+          backlog.executor.n_throttled = executors->throttle.n_throttled;
+        } RELEASE;
+        int n_running = 0;
+        for( int shard=0; shard < executors->n_shards; shard++ ) {
+          vgx_ExecutionJobDescriptor_t *executor = executors->shard[ shard ];
+          vgx_EventShardInfo_t *info = &backlog.executor.shard[ shard ];
+          if( executor && executor->TASK ) {
+            COMLIB_TASK_LOCK( executor->TASK ) {
+              info->n_current = executor->n_current;
+              info->n_exec = executor->n_exec;
+              info->n_transient = executor->n_transient;
+              info->n_yield = executor->n_yield;
+              info->is_running = COMLIB_TASK__IsAlive( executor->TASK );
+              // Overall ontime rate is that of the least punctual shard
+              if( n_running++ == 0 || executor->ontime_rate < backlog.ontime_rate ) {
+                backlog.ontime_rate = executor->ontime_rate;
+              }
+            } COMLIB_TASK_RELEASE;
+            backlog.n_current += info->n_current;
+            backlog.n_exec += info->n_exec;
+          }
+        }
       }
 
       backlog.n_input = LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Monitor.Queue );
@@ -909,16 +934,52 @@ static int _vxevent_eventapi__exists_in_schedule_WL_NT( vgx_Graph_t *self, vgx_V
  * 
  ***********************************************************************
  */
-static uint32_t _vxevent_eventapi__executor_thread_id( vgx_Graph_t *self ) {
-  uint32_t tid = 0;
+static bool _vxevent_eventapi__is_executor_thread( vgx_Graph_t *self, uint32_t threadid ) {
+  bool is_executor = false;
 
-  if( _vxevent_eventapi__is_ready( self ) ) {
+  if( threadid != 0 && _vxevent_eventapi__is_ready( self ) ) {
     GRAPH_LOCK( self ) {
-      tid = self->EVP.executor_thread_id;
+      vgx_EventExecutorPool_t *executors = self->EVP.EXECUTORS;
+      if( executors ) {
+        for( int shard=0; shard < executors->n_shards; shard++ ) {
+          if( executors->thread_id[ shard ] == threadid ) {
+            is_executor = true;
+            break;
+          }
+        }
+      }
     } GRAPH_RELEASE;
   }
 
-  return tid;
+  return is_executor;
+}
+
+
+
+/*******************************************************************//**
+ * Set the max number of events per second executed across all executor
+ * shards. A max_rate of 0 removes the limit.
+ *
+ * Returns the previous max rate, or -1 if the graph has no event
+ * processor.
+ * 
+ ***********************************************************************
+ */
+static int64_t _vxevent_eventapi__set_executor_throttle( vgx_Graph_t *self, int64_t max_rate ) {
+  int64_t prev = -1;
+
+  if( _vxevent_eventapi__is_ready( self ) ) {
+    vgx_EventExecutorPool_t *executors = self->EVP.EXECUTORS;
+    if( executors ) {
+      SYNCHRONIZE_ON( executors->throttle.lock ) {
+        prev = executors->throttle.max_rate;
+        executors->throttle.max_rate = max_rate > 0 ? max_rate : 0;
+        executors->throttle.n_window = 0;
+      } RELEASE;
+    }
+  }
+
+  return prev;
 }
 
 
@@ -29,6 +29,7 @@
 SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
 
 #define LATE_EVENT_THRESHOLD 30 // 30 seconds overdue is considered late
+#define EXECUTOR_YIELD_BATCH_SIZE 32 // max events per batch while foreground readers are active
 
 __inline static const char *__full_path( vgx_Graph_t *graph ) {
   return graph ? CALLABLE( graph )->FullPath( graph ) : "";
@@ -232,20 +233,92 @@ static int __execute_vertex_expiration_event( vgx_Graph_t *graph, vgx_Vertex_t *
 
 
 /*******************************************************************//**
+ * Return the number of events this executor shard may execute in its
+ * next batch.
  *
+ * The batch is reduced to a small slice while the graph has readonly
+ * vertex acquisitions (i.e. foreground queries are running), and the
+ * total execution rate across all shards is capped by the shared
+ * throttle when a max rate is set. The throttle window the grant was
+ * charged to is returned in tms_window.
  *
  ***********************************************************************
  */
-static int64_t __executor_get_due_batch( vgx_ExecutionJobDescriptor_t *job, uint32_t ts_now ) {
+static int64_t __executor_grant_batch( vgx_ExecutionJobDescriptor_t *job, bool *yielded, int64_t *tms_window ) {
+  vgx_Graph_t *graph = job->graph;
+  vgx_EventExecutionThrottle_t *throttle = job->throttle;
+  int64_t n_grant = job->batch_size;
+
+  // Give way to foreground readers
+  int64_t n_readers;
+  GRAPH_LOCK( graph ) {
+    n_readers = _vgx_graph_get_vertex_RO_count_CS( graph );
+  } GRAPH_RELEASE;
+  if( n_readers > 0 ) {
+    n_grant = minimum_value( n_grant, EXECUTOR_YIELD_BATCH_SIZE );
+    *yielded = true;
+  }
+
+  // Shared rate limit
+  if( throttle ) {
+    SYNCHRONIZE_ON( throttle->lock ) {
+      if( throttle->max_rate > 0 ) {
+        int64_t tms_now = __MILLISECONDS_SINCE_1970();
+        if( tms_now - throttle->tms_window >= 1000 ) {
+          throttle->tms_window = tms_now;
+          throttle->n_window = 0;
+        }
+        int64_t n_avail = throttle->max_rate - throttle->n_window;
+        if( n_avail < n_grant ) {
+          n_grant = n_avail > 0 ? n_avail : 0;
+          ++throttle->n_throttled;
+        }
+        throttle->n_window += n_grant;
+        *tms_window = throttle->tms_window;
+      }
+    } RELEASE;
+  }
+
+  return n_grant;
+}
+
+
+
+/*******************************************************************//**
+ * Return unused part of a grant to the shared throttle, so the rate
+ * limit counts events actually executed. Nothing is returned if the
+ * throttle has moved on to a new window since the grant.
+ *
+ ***********************************************************************
+ */
+static void __executor_refund_batch( vgx_ExecutionJobDescriptor_t *job, int64_t tms_window, int64_t n_unused ) {
+  vgx_EventExecutionThrottle_t *throttle = job->throttle;
+  if( throttle && n_unused > 0 ) {
+    SYNCHRONIZE_ON( throttle->lock ) {
+      if( throttle->tms_window == tms_window ) {
+        throttle->n_window -= minimum_value( n_unused, throttle->n_window );
+      }
+    } RELEASE;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __executor_get_due_batch( vgx_ExecutionJobDescriptor_t *job, uint32_t ts_now, int64_t max_batch ) {
   int64_t sz_batch = 0;
   COMLIB_TASK_LOCK( job->TASK ) {
     // Transfer any almost-due events from before back into the input queue
     ABSORB_QUEUE_TO_HEAP_VERTEX_EVENTS_NOLOCK( job->Queue.pri_inp, job->Queue.lin_imm, -1 );
     // Transfer due events from input queue into the new execution batch
-    // Batch now includes all events that are due immediately (up to a max batch size)
+    // Batch now includes all events that are due immediately (up to the granted batch size)
     int64_t sz_input = LENGTH_HEAP_VERTEX_EVENTS( job->Queue.pri_inp );
-    if( sz_input > 0 ) {
-      sz_batch = ENQUEUE_DUE_VERTEX_EVENTS_NOLOCK( job->Queue.lin_bat, job->Queue.pri_inp, ts_now, job->batch_size );
+    if( sz_input > 0 && max_batch > 0 ) {
+      sz_batch = ENQUEUE_DUE_VERTEX_EVENTS_NOLOCK( job->Queue.lin_bat, job->Queue.pri_inp, ts_now, max_batch );
     }
     // Set the number of events currently managed by the executor
     job->n_current = (int)sz_input;
@@ -347,13 +420,17 @@ static int __executor_process_event( vgx_ExecutionJobDescriptor_t *job, vgx_Vert
  *
  ***********************************************************************
  */
-static int64_t __executor_update( vgx_ExecutionJobDescriptor_t *job, int n_batch_exec ) {
+static int64_t __executor_update( vgx_ExecutionJobDescriptor_t *job, int n_batch_exec, int n_transients, bool yielded ) {
   int64_t n_pending = 0;
   COMLIB_TASK_LOCK( job->TASK ) {
     if( n_batch_exec > 0 ) {
       int64_t n = job->n_exec + n_batch_exec;
       job->n_exec = n;
     }
+    job->n_transient += n_transients;
+    if( yielded ) {
+      ++job->n_yield;
+    }
 
     if( COMLIB_TASK__IsStopping( job->TASK ) ) {
       // Pending executions still exist, transfer to failed queue so we can re-scheduled them
@@ -375,11 +452,15 @@ static int64_t __executor_update( vgx_ExecutionJobDescriptor_t *job, int n_batch
  *
  ***********************************************************************
  */
-static int64_t __executor_get_loop_delay( vgx_ExecutionJobDescriptor_t *job, int n_batch_exec, int64_t sz_batch, int n_transients ) {
+static int64_t __executor_get_loop_delay( vgx_ExecutionJobDescriptor_t *job, int n_batch_exec, int64_t sz_batch, int n_transients, int64_t n_granted, bool yielded ) {
   int64_t loop_delay = 0;
 
+  // Rate limit reached, wait for the next rate window
+  if( n_granted == 0 ) {
+    loop_delay = COMLIB_TASK_LOOP_DELAY( 10 );
+  }
   // We are not making progress
-  if( n_batch_exec == 0 ) {
+  else if( n_batch_exec == 0 ) {
     // Transient errors (typically locked vertices), ease off.
     if( n_transients > 0 ) {
       // Longer sleep if we are not making progress
@@ -405,6 +486,10 @@ static int64_t __executor_get_loop_delay( vgx_ExecutionJobDescriptor_t *job, int
       // Short sleep when we are making progress
       loop_delay = COMLIB_TASK_LOOP_DELAY( 1 );
     }
+    // Foreground readers active, short sleep between small batches
+    else if( yielded ) {
+      loop_delay = COMLIB_TASK_LOOP_DELAY( 1 );
+    }
     else {
       loop_delay = COMLIB_TASK_LOOP_DELAY( 0 );
     }
@@ -436,7 +521,7 @@ BEGIN_COMLIB_TASK( self,
   APPEND_THREAD_NAME( graph_name );
   COMLIB_TASK__AppendDescription( self, graph_name );
 
-  EXECUTOR_VERBOSE( graph, 0, "New execution thread created" );
+  EXECUTOR_VERBOSE( graph, 0, "New execution thread created for shard %d", job->shard );
 
   comlib_task_delay_t loop_delay = COMLIB_TASK_LOOP_DELAY( 0 );
 
@@ -451,9 +536,15 @@ BEGIN_COMLIB_TASK( self,
       int64_t sz_batch;
       // Flag if we should sleep a little before executing next batch
       int n_transients_occurred = 0;
+      // Flag if batch was reduced to give way to foreground readers
+      bool yielded = false;
+
+      // Number of events we are allowed to execute in this batch
+      int64_t tms_window = 0;
+      int64_t n_granted = __executor_grant_batch( job, &yielded, &tms_window );
 
       // Transfer a batch of due events into the job's batch queue, then execute those events
-      if( (sz_batch = __executor_get_due_batch( job, ts_now )) > 0 ) {
+      if( (sz_batch = __executor_get_due_batch( job, ts_now, n_granted )) > 0 ) {
         vgx_VertexStorableEvent_t ev;
         int proc;
         // Process batch
@@ -476,11 +567,14 @@ BEGIN_COMLIB_TASK( self,
         THROW_ERROR( CXLIB_ERR_GENERAL, 0x321 );
       }
 
+      // Only executed events count against the rate limit
+      __executor_refund_batch( job, tms_window, n_granted - n_batch_exec );
+
       // Update counts and check if execution job has been asked to terminate early
-      n_pending = __executor_update( job, n_batch_exec );
+      n_pending = __executor_update( job, n_batch_exec, n_transients_occurred, yielded );
 
       // Determine how fast executor should run based on processing results for last batch
-      loop_delay = __executor_get_loop_delay( job, n_batch_exec, sz_batch, n_transients_occurred );
+      loop_delay = __executor_get_loop_delay( job, n_batch_exec, sz_batch, n_transients_occurred, n_granted, yielded );
 
       // Input exhausted or controlled termination
       if( COMLIB_TASK__IsStopping( self ) ) {
@@ -574,6 +668,12 @@ BEGIN_COMLIB_TASK( self,
         COMLIB_OBJECT_DESTROY( executor->Queue.lin_pen );
       }
 
+      // Destroy the staging queue (any staged events are returned as pending)
+      if( executor->Queue.lin_stg ) {
+        ABSORB_QUEUE_VERTEX_EVENTS_NOLOCK( Qpen, executor->Queue.lin_stg, -1 );
+        COMLIB_OBJECT_DESTROY( executor->Queue.lin_stg );
+      }
+
       // Deallocate
       free( executor );
 
@@ -597,11 +697,12 @@ BEGIN_COMLIB_TASK( self,
  *
  ***********************************************************************
  */
-vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProcessor_t *processor_WL ) {
+vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProcessor_t *processor_WL, int shard ) {
   // Start a new execution thread
 
   vgx_ExecutionJobDescriptor_t *job = NULL;
   vgx_Graph_t *graph = processor_WL->graph;
+  vgx_EventExecutorPool_t *executors = processor_WL->EXECUTORS;
   
   XTRY {
     // Allocate the job descriptor
@@ -619,6 +720,10 @@ vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProces
     job->n_exec = 0;
     job->ontime_rate = 1.0;
     job->batch_size = 512;
+    job->shard = shard;
+    job->n_transient = 0;
+    job->n_yield = 0;
+    job->throttle = executors ? &executors->throttle : NULL;
 
     // Priority Queue Constructor args
     Cm128iHeap_constructor_args_t priority_queue_args = {
@@ -651,6 +756,11 @@ vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProces
     if( (job->Queue.lin_pen = COMLIB_OBJECT_NEW( Cm128iQueue_t, NULL, &linear_queue_args )) == NULL ) {
       THROW_ERROR( CXLIB_ERR_MEMORY, 0x345 );
     }
+
+    // Create queue for events staged by the event monitor before transfer into the input heap
+    if( (job->Queue.lin_stg = COMLIB_OBJECT_NEW( Cm128iQueue_t, NULL, &linear_queue_args )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x347 );
+    }
     
     // Parent graph of executor is parent graph of event processor
     job->graph = graph;
@@ -664,7 +774,10 @@ vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProces
 
   }
   XCATCH( errcode ) {
-    __eventexec_cancel_execution_job_WL( &job, -1 );
+    vgx_VertexEventQueue_t *Qpen = __eventexec_cancel_execution_job_WL( &job, -1 );
+    if( Qpen ) {
+      COMLIB_OBJECT_DESTROY( Qpen );
+    }
   }
   XFINALLY {
   }
@@ -674,6 +787,51 @@ vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProces
 
 
 
+/*******************************************************************//**
+ * Create a new executor pool with the given number of shards.
+ *
+ * Executor shards are started on demand by the event monitor.
+ *
+ ***********************************************************************
+ */
+vgx_EventExecutorPool_t * __eventexec_new_executor_pool( int n_shards ) {
+  vgx_EventExecutorPool_t *executors = calloc( 1, sizeof( vgx_EventExecutorPool_t ) );
+  if( executors ) {
+    if( n_shards < 1 ) {
+      n_shards = 1;
+    }
+    else if( n_shards > VGX_EVENT_EXECUTOR_MAX_SHARDS ) {
+      n_shards = VGX_EVENT_EXECUTOR_MAX_SHARDS;
+    }
+    executors->n_shards = n_shards;
+    INIT_CRITICAL_SECTION( &executors->throttle.lock.lock );
+    executors->throttle.max_rate = 0;
+    executors->throttle.tms_window = 0;
+    executors->throttle.n_window = 0;
+    executors->throttle.n_throttled = 0;
+  }
+  return executors;
+}
+
+
+
+/*******************************************************************//**
+ * Delete executor pool.
+ *
+ * All executor shards must have been cancelled before this is called.
+ *
+ ***********************************************************************
+ */
+void __eventexec_delete_executor_pool( vgx_EventExecutorPool_t **executors ) {
+  if( executors && *executors ) {
+    DEL_CRITICAL_SECTION( &(*executors)->throttle.lock.lock );
+    free( *executors );
+    *executors = NULL;
+  }
+}
+
+
+
 #ifdef INCLUDE_UNIT_TESTS
 #include "tests/__utest_vxevent_eventexec.h"
 
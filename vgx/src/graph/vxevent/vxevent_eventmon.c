@@ -85,6 +85,7 @@ static const int64_t short_migration_cycle_ms = SHORT_MIGRATION_CYCLE_MS;
 
 // EXECUTOR
 #define EXECUTOR_INSERTION_THRESHOLD_MS   EXE_INSERTION_THRESHOLD * 1000LL        //
+#define EXECUTOR_MAP_ORDER                2                                       // 2**2 = 4 executor shards
 
 
 static vgx_EventParamInfo_t default_event_param = {
@@ -116,8 +117,8 @@ static vgx_EventParamInfo_t default_event_param = {
     .insertion_threshold_tms = EXECUTOR_INSERTION_THRESHOLD_MS,
     .migration_cycle_tms     = 0,
     .migration_margin_tms    = 0,
-    .map_order               = 0,
-    .partials                = 1, 
+    .map_order               = EXECUTOR_MAP_ORDER,
+    .partials                = 1 << EXECUTOR_MAP_ORDER,
     .partial_interval_tms    = 0
   }
 };
@@ -162,9 +163,10 @@ static int64_t __has_executable_processor( framehash_processing_context_t * cons
 static int __has_executable_events( framehash_t *schedule, uint64_t selector );
 static int64_t __queue_execution_processor( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
 static int64_t __reschedule_pending_events_imminent_WL( vgx_EventProcessor_t *processor_WL, vgx_VertexEventQueue_t *Qpen );
-static int64_t __cancel_execution_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job, int timeout_ms );
-static int __transfer_scheduled_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job, uint64_t subtree_selector );
-static int __transfer_imminent_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job );
+static int64_t __cancel_execution_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors, int timeout_ms, bool dead_only );
+static int __ensure_execution_jobs_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors );
+static int __transfer_scheduled_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors, uint64_t subtree_selector );
+static int __transfer_imminent_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors );
 
 
 
@@ -345,11 +347,11 @@ static int __eventproc_action__MigrateMedium_WL( vgx_EventActionTrigger_t *trigg
  */
 static int __eventproc_action__Schedule_WL( vgx_EventActionTrigger_t *trigger ) {
   vgx_EventProcessor_t *processor_WL = (vgx_EventProcessor_t*)trigger->action.input;
-  vgx_ExecutionJobDescriptor_t **executor = (vgx_ExecutionJobDescriptor_t**)trigger->action.output;
+  vgx_EventExecutorPool_t *executors = (vgx_EventExecutorPool_t*)trigger->action.output;
 
   // Move events from the API input to the internal event schedule
   __update_eventproc_state_WL( processor_WL, VGX_EVENTPROC_STATE_SCHEDULE );
-  return __schedule_events_WL( processor_WL, executor );
+  return __schedule_events_WL( processor_WL, executors );
 }
 
 
@@ -362,12 +364,12 @@ static int __eventproc_action__Schedule_WL( vgx_EventActionTrigger_t *trigger )
 static int __eventproc_action__Execute_WL( vgx_EventActionTrigger_t *trigger ) {
   int ret = 1;
   vgx_EventProcessor_t *processor_WL = (vgx_EventProcessor_t*)trigger->action.input;
-  vgx_ExecutionJobDescriptor_t **executor = (vgx_ExecutionJobDescriptor_t**)trigger->action.output;
+  vgx_EventExecutorPool_t *executors = (vgx_EventExecutorPool_t*)trigger->action.output;
   // Transfer all events that are due to execute now from the short term schedule
-  // into the background execution job.
+  // into the background execution jobs.
   if( __has_executable_events( processor_WL->Schedule.ShortTerm, trigger->action.counter ) ) {
     __update_eventproc_state_WL( processor_WL, VGX_EVENTPROC_STATE_EXECUTE );
-    if( __transfer_scheduled_events_to_execution_job_WL( processor_WL, executor, trigger->action.counter ) < 0 ) {
+    if( __transfer_scheduled_events_to_execution_job_WL( processor_WL, executors, trigger->action.counter ) < 0 ) {
       EVENTMONITOR_CRITICAL( processor_WL->graph, 0x221, "Failed to transfer events to execution job" );
       ret = -1;
     }
@@ -579,7 +581,7 @@ static unsigned __event_initialize( comlib_task_t *self ) {
       },
       .action = {
         .input                = processor_WL,
-        .output               = &processor_WL->EXECUTOR,
+        .output               = processor_WL->EXECUTORS,
         .perform              = __eventproc_action__Schedule_WL,
         .counter              = 0
       },
@@ -603,7 +605,7 @@ static unsigned __event_initialize( comlib_task_t *self ) {
       },
       .action = {
         .input                = processor_WL,
-        .output               = &processor_WL->EXECUTOR,
+        .output               = processor_WL->EXECUTORS,
         .perform              = __eventproc_action__Execute_WL,
         .counter              = 0
       },
@@ -644,6 +646,8 @@ static unsigned __event_initialize( comlib_task_t *self ) {
                                                           g_pevent_param->ShortTerm.partials,
                                                                 g_pevent_param->ShortTerm.partial_interval_tms );
 
+    EVENTMONITOR_INFO( graph, 0, "Flow [%d executor shards] Execute", processor_WL->EXECUTORS ? processor_WL->EXECUTORS->n_shards : 0 );
+
     // ---------------------------------------------------
     // 7: Ready
     // ---------------------------------------------------
@@ -779,18 +783,19 @@ BEGIN_COMLIB_TASK( self,
         }
         // Processor will be disabled
         if( COMLIB_TASK__IsSuspending( self ) ) {
-          // Shut down executor and move any pending events into short term map (including Executor.Queue events)
-          if( processor_WL->EXECUTOR ) {
-            EVENTMONITOR_VERBOSE( graph, 0x234, "Stopping event executor" );
-            if( __cancel_execution_WL( processor_WL, &processor_WL->EXECUTOR, 60000 ) < 0 ) {
-              EVENTMONITOR_WARNING( graph, 0x235, "Failed to stop event executor" );
+          // Shut down executors and move any pending events into short term map (including Executor.Queue events)
+          int64_t n_resched = 0;
+          if( processor_WL->EXECUTORS ) {
+            EVENTMONITOR_VERBOSE( graph, 0x234, "Stopping event executors" );
+            if( (n_resched = __cancel_execution_WL( processor_WL, processor_WL->EXECUTORS, 60000, false )) < 0 ) {
+              EVENTMONITOR_WARNING( graph, 0x235, "Failed to stop event executors" );
             }
             else {
-              EVENTMONITOR_VERBOSE( graph, 0x236, "Event executor stopped" );
+              EVENTMONITOR_VERBOSE( graph, 0x236, "Event executors stopped" );
             }
           }
-          // Executor does not exist, execution queue should be empty (re-scheduled into)
-          if( processor_WL->EXECUTOR == NULL && LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue ) > 0 ) {
+          // Executors do not exist, execution queue should be empty (re-scheduled into)
+          if( n_resched >= 0 && LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue ) > 0 ) {
             EVENTMONITOR_CRITICAL( graph, 0x237, "Failed to re-schedule events Executor.Queue=%lld", LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue ) );
           }
           // Suspended
@@ -817,14 +822,12 @@ BEGIN_COMLIB_TASK( self,
 
 
       // --------------------------------------------------------------------------
-      // 6: Check if any background execution job is running and how it's doing
+      // 6: Check if any background execution jobs are running and how they're doing
       // --------------------------------------------------------------------------
-      if( processor_WL->EXECUTOR ) {
-        // A previously started execution thread has completed and should be joined and cleaned up
-        if( COMLIB_TASK__IsDead( processor_WL->EXECUTOR->TASK ) ) {
-          if( __cancel_execution_WL( processor_WL, &processor_WL->EXECUTOR, 60000 ) < 0 ) {
-            EVENTMONITOR_CRITICAL( graph, 0x238, "Failed to clean up event executor" );
-          }
+      if( processor_WL->EXECUTORS ) {
+        // Previously started execution threads that have completed should be joined and cleaned up
+        if( __cancel_execution_WL( processor_WL, processor_WL->EXECUTORS, 60000, true ) < 0 ) {
+          EVENTMONITOR_CRITICAL( graph, 0x238, "Failed to clean up event executor" );
         }
       }
 
@@ -853,7 +856,7 @@ BEGIN_COMLIB_TASK( self,
   // ----------------------------------------------------
 
   if( (processor_WL = __acquire_eventproc( EVP, 10000 )) != NULL ) {
-    if( processor_WL->EXECUTOR && __cancel_execution_WL( processor_WL, &processor_WL->EXECUTOR, 60000 ) < 0 ) {
+    if( processor_WL->EXECUTORS && __cancel_execution_WL( processor_WL, processor_WL->EXECUTORS, 60000, false ) < 0 ) {
       EVENTMONITOR_CRITICAL( graph, 0x239, "Failed to clean up event executor" );
     }
     __release_eventproc( &processor_WL );
@@ -920,18 +923,29 @@ static int64_t __reschedule_pending_events_imminent_WL( vgx_EventProcessor_t *pr
  *
  ***********************************************************************
  */
-static int64_t __cancel_execution_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job, int timeout_ms ) {
-  int64_t n_resched;
-  __update_eventproc_state_WL( processor_WL, VGX_EVENTPROC_STATE_CANCEL_EXECUTION );
-  vgx_VertexEventQueue_t *Qpen = __eventexec_cancel_execution_job_WL( job, timeout_ms );
-  // Terminated ok
-  if( Qpen ) {
-    n_resched = __reschedule_pending_events_imminent_WL( processor_WL, Qpen );
-    processor_WL->executor_thread_id = 0;
-  }
-  // Error
-  else {
-    n_resched = -1;
+static int64_t __cancel_execution_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors, int timeout_ms, bool dead_only ) {
+  int64_t n_resched = 0;
+  for( int shard=0; shard < executors->n_shards; shard++ ) {
+    vgx_ExecutionJobDescriptor_t **job = &executors->shard[ shard ];
+    if( *job == NULL || (dead_only && !COMLIB_TASK__IsDead( (*job)->TASK )) ) {
+      continue;
+    }
+    __update_eventproc_state_WL( processor_WL, VGX_EVENTPROC_STATE_CANCEL_EXECUTION );
+    vgx_VertexEventQueue_t *Qpen = __eventexec_cancel_execution_job_WL( job, timeout_ms );
+    // Terminated ok
+    if( Qpen ) {
+      if( n_resched >= 0 ) {
+        n_resched += __reschedule_pending_events_imminent_WL( processor_WL, Qpen );
+      }
+      else {
+        __reschedule_pending_events_imminent_WL( processor_WL, Qpen );
+      }
+      executors->thread_id[ shard ] = 0;
+    }
+    // Error
+    else {
+      n_resched = -1;
+    }
   }
   return n_resched;
 }
@@ -1173,7 +1187,7 @@ __inline static int64_t __swap_inputs_WL( vgx_EventProcessor_t *processor_WL ) {
  * 
  ***********************************************************************
  */
-int __schedule_events_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job ) {
+int __schedule_events_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors ) {
   vgx_Graph_t *graph = processor_WL->graph;
 
   int ret = 0;
@@ -1205,8 +1219,8 @@ int __schedule_events_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDe
   }
 
   // Immediately transfer imminent events to executor
-  if( job && LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue ) > 0 ) {
-    if( __transfer_imminent_events_to_execution_job_WL( processor_WL, job ) < 0 ) {
+  if( executors && LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue ) > 0 ) {
+    if( __transfer_imminent_events_to_execution_job_WL( processor_WL, executors ) < 0 ) {
       // Failed to transfer to executor job, put back into the current input queue
       // which will eventually be scanned again at some point in the future.
       // (Events will be late but not missed.)
@@ -1271,7 +1285,7 @@ static int64_t __queue_execution_processor( framehash_processing_context_t * con
   if( ev.event_val.ts_exec < T->cutoff_ts ) {
     // Insert item into destination queue
     ev.event_key.allocdata = APTR_AS_ANNOTATION( fh_cell );
-    if( PUSH_HEAP_VERTEX_EVENT_NOLOCK( (vgx_VertexEventHeap_t*)processor->processor.output, &ev ) ) {
+    if( APPEND_QUEUE_VERTEX_EVENT_NOLOCK( (vgx_VertexEventQueue_t*)processor->processor.output, &ev ) ) {
       // Mark item as deleted in the processed map
       FRAMEHASH_PROCESSOR_DELETE_CELL( processor, fh_cell );
 #ifndef NDEBUG
@@ -1288,52 +1302,73 @@ static int64_t __queue_execution_processor( framehash_processing_context_t * con
 
 
 /*******************************************************************//**
- *
+ * Make sure all executor shards are running, starting any that are not.
  *
  ***********************************************************************
  */
-static int __transfer_scheduled_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job, uint64_t subtree_selector ) {
-  int ret = 0;
-  vgx_ExecutionJobDescriptor_t *executor = *job;
-
-  // Create new background job if it does not exist
-  if( executor == NULL ) {
-    if( (*job = executor = __eventexec_new_execution_job_WL( processor_WL )) == NULL ) {
-      return -1;
+static int __ensure_execution_jobs_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors ) {
+  for( int shard=0; shard < executors->n_shards; shard++ ) {
+    // Create new background job if it does not exist
+    if( executors->shard[ shard ] == NULL ) {
+      vgx_ExecutionJobDescriptor_t *executor;
+      if( (executor = __eventexec_new_execution_job_WL( processor_WL, shard )) == NULL ) {
+        return -1;
+      }
+      executors->shard[ shard ] = executor;
+      executors->thread_id[ shard ] = COMLIB_TASK__ThreadId( executor->TASK );
     }
-
-    processor_WL->executor_thread_id = COMLIB_TASK__ThreadId( executor->TASK );
   }
+  return 0;
+}
 
-  COMLIB_TASK_LOCK( executor->TASK ) {
-    // Events due for execution will be found in the short term map.
-    framehash_t *schedule = processor_WL->Schedule.ShortTerm;
 
-    // Get the cutoff timestamp used to determine which events are soon due for execution.
-    // Events that are imminent will be transferred to the execution job.
-    __cutoff_timespec T = __get_executable_cutoff();
 
-    // Configure the framehash processor that will scan for due events and populate the job execution queue.
-    framehash_processing_context_t queue_execution_processing_context = FRAMEHASH_PROCESSOR_NEW_CONTEXT( NULL, NULL, __queue_execution_processor );
-    FRAMEHASH_PROCESSOR_MAY_MODIFY( &queue_execution_processing_context );
-    FRAMEHASH_PROCESSOR_SET_IO( &queue_execution_processing_context, &T, executor->Queue.pri_inp );
+/*******************************************************************//**
+ * Partition all events in the monitor's execution queue across executor
+ * shards by vertex and transfer them into each shard's input heap.
+ *
+ * Returns the number of events transferred, or -1 on error. Events that
+ * could not be transferred remain in the monitor's execution queue.
+ *
+ ***********************************************************************
+ */
+static int64_t __distribute_execution_queue_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors ) {
+  int64_t n_transferred = 0;
+  vgx_VertexStorableEvent_t ev;
 
-    // Run timestamp scan, collect vertices into execution queue
-    int64_t n_events = 0;
+  if( __ensure_execution_jobs_WL( processor_WL, executors ) < 0 ) {
+    return -1;
+  }
 
-    if( (n_events = CALLABLE( schedule )->ProcessPartial( schedule, &queue_execution_processing_context, subtree_selector )) < 0 ) {
-      EVENTMONITOR_CRITICAL( processor_WL->graph, 0x281, "Processor failed to collect events for execution" );
-      ret = -1;
+  // Stage events per shard (monitor owned queues, no executor locks needed)
+  while( NEXT_QUEUE_VERTEX_EVENT_NOLOCK( processor_WL->Executor.Queue, &ev ) == 1 ) {
+    vgx_ExecutionJobDescriptor_t *executor = executors->shard[ __eventexec_shard_of( &ev, executors->n_shards ) ];
+    if( !APPEND_QUEUE_VERTEX_EVENT_NOLOCK( executor->Queue.lin_stg, &ev ) ) {
+      APPEND_QUEUE_VERTEX_EVENT_NOLOCK( processor_WL->Executor.Queue, &ev );
+      break;
     }
-    // At least one event submitted for execution
-    else if( n_events > 0 ) {
-#ifndef NDEBUG
-#endif
-      CALLABLE( schedule )->CompactifyPartial( schedule, subtree_selector );
+  }
+
+  // Hand staged events to each shard
+  for( int shard=0; shard < executors->n_shards; shard++ ) {
+    vgx_ExecutionJobDescriptor_t *executor = executors->shard[ shard ];
+    int64_t n = 0;
+    COMLIB_TASK_LOCK( executor->TASK ) {
+      if( (n = ABSORB_QUEUE_TO_HEAP_VERTEX_EVENTS_NOLOCK( executor->Queue.pri_inp, executor->Queue.lin_stg, -1 )) >= 0 ) {
+        executor->n_current = (int)LENGTH_HEAP_VERTEX_EVENTS( executor->Queue.pri_inp );
+      }
+    } COMLIB_TASK_RELEASE;
+    if( n < 0 ) {
+      // Return anything left in staging to the monitor's execution queue
+      ABSORB_QUEUE_VERTEX_EVENTS_NOLOCK( processor_WL->Executor.Queue, executor->Queue.lin_stg, -1 );
+      n_transferred = -1;
+    }
+    else if( n_transferred >= 0 ) {
+      n_transferred += n;
     }
-  } COMLIB_TASK_RELEASE;
+  }
 
-  return ret;
+  return n_transferred;
 }
 
 
@@ -1343,33 +1378,58 @@ static int __transfer_scheduled_events_to_execution_job_WL( vgx_EventProcessor_t
  *
  ***********************************************************************
  */
-static int __transfer_imminent_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job ) {
+static int __transfer_scheduled_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors, uint64_t subtree_selector ) {
   int ret = 0;
-  vgx_ExecutionJobDescriptor_t *executor = *job;
 
-  // Create new background job if it does not exist
-  if( executor == NULL ) {
-    if( (*job = executor = __eventexec_new_execution_job_WL( processor_WL )) == NULL ) {
-      return -1;
-    }
+  // Events due for execution will be found in the short term map.
+  framehash_t *schedule = processor_WL->Schedule.ShortTerm;
 
-    processor_WL->executor_thread_id = COMLIB_TASK__ThreadId( executor->TASK );
+  // Get the cutoff timestamp used to determine which events are soon due for execution.
+  // Events that are imminent will be transferred to the execution jobs.
+  __cutoff_timespec T = __get_executable_cutoff();
+
+  // Configure the framehash processor that will scan for due events and populate the monitor's execution queue.
+  framehash_processing_context_t queue_execution_processing_context = FRAMEHASH_PROCESSOR_NEW_CONTEXT( NULL, NULL, __queue_execution_processor );
+  FRAMEHASH_PROCESSOR_MAY_MODIFY( &queue_execution_processing_context );
+  FRAMEHASH_PROCESSOR_SET_IO( &queue_execution_processing_context, &T, processor_WL->Executor.Queue );
+
+  // Run timestamp scan, collect vertices into execution queue
+  int64_t n_events = 0;
+
+  if( (n_events = CALLABLE( schedule )->ProcessPartial( schedule, &queue_execution_processing_context, subtree_selector )) < 0 ) {
+    EVENTMONITOR_CRITICAL( processor_WL->graph, 0x281, "Processor failed to collect events for execution" );
+    ret = -1;
+  }
+  // At least one event submitted for execution
+  else if( n_events > 0 ) {
+    CALLABLE( schedule )->CompactifyPartial( schedule, subtree_selector );
   }
 
-  COMLIB_TASK_LOCK( executor->TASK ) {
-    if( !ABSORB_QUEUE_TO_HEAP_VERTEX_EVENTS_NOLOCK( executor->Queue.pri_inp, processor_WL->Executor.Queue, -1 ) ) {
-      ret = -1;
-    }
-    else {
-      executor->n_current = (int)LENGTH_HEAP_VERTEX_EVENTS( executor->Queue.pri_inp );
-    }
-  } COMLIB_TASK_RELEASE;
+  // Partition across executor shards
+  if( __transfer_imminent_events_to_execution_job_WL( processor_WL, executors ) < 0 ) {
+    // Events left behind in the execution queue are picked up by the next transfer
+    ret = -1;
+  }
 
   return ret;
 }
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __transfer_imminent_events_to_execution_job_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors ) {
+  if( LENGTH_QUEUE_VERTEX_EVENTS( processor_WL->Executor.Queue ) == 0 ) {
+    return 0;
+  }
+  return __distribute_execution_queue_WL( processor_WL, executors ) < 0 ? -1 : 0;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1537,6 +1597,9 @@ int __stop_delete_eventproc( vgx_EventProcessor_t *processor ) {
           // [11]
           __delete_action_triggers_WL( processor_WL );
 
+          // [10b] All executor shards were cancelled when the monitor terminated
+          __eventexec_delete_executor_pool( &processor_WL->EXECUTORS );
+
           // [10]
           if( processor_WL->Executor.Queue ) {
             COMLIB_OBJECT_DESTROY( processor_WL->Executor.Queue );
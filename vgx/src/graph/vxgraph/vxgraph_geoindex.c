@@ -0,0 +1,759 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    vxgraph_geoindex.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#include "_vgx.h"
+
+/* exception module */
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
+
+
+
+/*******************************************************************//**
+ *
+ * Hierarchical lat/lon cell index
+ * -------------------------------
+ * The earth is divided into a quadtree of cells over the equirectangular
+ * lat/lon plane. Level 0 is the whole earth and level GEO_LEAF_LEVEL has
+ * 2^GEO_LEAF_LEVEL x 2^GEO_LEAF_LEVEL cells (about 300m x 600m at the
+ * equator.) Every level holds a vertex count per non-empty cell, used to
+ * prune the search. Leaf cells hold a bucket of vertex addresses.
+ *
+ * The index holds no vertex references. It is maintained under CS by
+ * property updates and vertex unindexing, and is never persisted.
+ *
+ ***********************************************************************
+ */
+#define GEO_LEAF_LEVEL          16
+#define GEO_LEAF_SIDE           (1LL << GEO_LEAF_LEVEL)
+#define GEO_LEAF_MASK           (GEO_LEAF_SIDE - 1)
+#define GEO_CELL_TAG            (1ULL << 48)
+#define GEO_BUCKET_MAX_SLOT     ((1LL << 23) - 1)
+#define GEO_EARTH_RADIUS        6371001.0
+#define GEO_RADIANS( Deg )      ((M_PI / 180.0) * (Deg))
+#define GEO_DEGREES( Rad )      ((180.0 / M_PI) * (Rad))
+
+
+
+/*******************************************************************//**
+ * Cell key for cell (y,x) at level
+ ***********************************************************************
+ */
+#define __GEO_CELL_KEY( Level, Y, X )   (GEO_CELL_TAG | ((QWORD)(Level) << 40) | ((QWORD)(Y) << 20) | (QWORD)(X))
+
+
+
+/*******************************************************************//**
+ * Member value: (slot in leaf bucket << 32) | (leaf y << 16) | leaf x
+ ***********************************************************************
+ */
+#define __GEO_MEMBER( Slot, XY )        ((int64_t)(((QWORD)(Slot) << 32) | (QWORD)(XY)))
+#define __GEO_MEMBER_SLOT( Member )     ((int64_t)((QWORD)(Member) >> 32))
+#define __GEO_MEMBER_XY( Member )       ((QWORD)(Member) & 0xFFFFFFFFULL)
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_geo_bucket_t {
+  int64_t sz;
+  int64_t cap;
+  vgx_Vertex_t *vertices[];
+} __geo_bucket_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct s_vgx_GeoIndex_t {
+  // Indexed property keys
+  CString_t *CSTR__lat_key;
+  CString_t *CSTR__lon_key;
+  shortid_t lat_keyhash;
+  shortid_t lon_keyhash;
+
+  // Number of indexed vertices
+  int64_t n_vertices;
+
+  // Cell key -> number of vertices in cell (all levels)
+  framehash_cell_t *cells;
+
+  // Leaf cell key -> bucket address
+  framehash_cell_t *leaves;
+
+  // Vertex address -> member value
+  framehash_cell_t *members;
+
+  framehash_dynamic_t fhdyn;
+} vgx_GeoIndex_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_geo_region_t {
+  double lat_min;
+  double lat_max;
+  double lon_min;
+  double lon_max;
+  bool all_lon;
+} __geo_region_t;
+
+
+
+static vgx_GeoIndex_t * __new_geoindex( vgx_Graph_t *graph, const char *lat_key, const char *lon_key );
+static void __delete_geoindex( vgx_GeoIndex_t **geoindex );
+static int64_t __free_bucket( framehash_processing_context_t * const processor, framehash_cell_t * const cell );
+static QWORD __leaf_xy( double lat, double lon );
+static int __geoindex_insert_CS( vgx_GeoIndex_t *G, vgx_Vertex_t *vertex, QWORD xy );
+static int __geoindex_remove_CS( vgx_GeoIndex_t *G, vgx_Vertex_t *vertex );
+static int __geoindex_update_CS( vgx_GeoIndex_t *G, vgx_Vertex_t *vertex );
+static int64_t __cxmalloc_geoindex_add_vertex_CS( cxmalloc_object_processing_context_t *context, vgx_Vertex_t *vertex );
+static int64_t __geoindex_populate_CS( vgx_Graph_t *self, vgx_GeoIndex_t *G );
+static void __geo_region( double lat, double lon, double radius, __geo_region_t *R );
+static bool __geo_region_overlap( const __geo_region_t *R, double lat0, double lat1, double lon0, double lon1 );
+static int64_t __geo_descend( const vgx_GeoIndex_t *G, const __geo_region_t *R, int level, QWORD y, QWORD x, cxmalloc_object_processing_context_t *scan_context );
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static vgx_GeoIndex_t * __new_geoindex( vgx_Graph_t *graph, const char *lat_key, const char *lon_key ) {
+  vgx_GeoIndex_t *G = NULL;
+  XTRY {
+    if( (G = calloc( 1, sizeof( vgx_GeoIndex_t ) )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xE61 );
+    }
+    if( (G->CSTR__lat_key = CStringNew( lat_key )) == NULL || (G->CSTR__lon_key = CStringNew( lon_key )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xE62 );
+    }
+    G->lat_keyhash = _vxenum_propkey__get_enum_CS( graph, G->CSTR__lat_key );
+    G->lon_keyhash = _vxenum_propkey__get_enum_CS( graph, G->CSTR__lon_key );
+
+    if( iFramehash.dynamic.InitDynamicSimple( &G->fhdyn, "Geo Index Framehash Dynamic", 21 ) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0xE63 );
+    }
+    if( (G->cells = iFramehash.simple.New( &G->fhdyn )) == NULL ||
+        (G->leaves = iFramehash.simple.New( &G->fhdyn )) == NULL ||
+        (G->members = iFramehash.simple.New( &G->fhdyn )) == NULL )
+    {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xE64 );
+    }
+  }
+  XCATCH( errcode ) {
+    __delete_geoindex( &G );
+  }
+  XFINALLY {
+  }
+  return G;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __free_bucket( framehash_processing_context_t * const processor, framehash_cell_t * const cell ) {
+  __geo_bucket_t *bucket = (__geo_bucket_t*)(intptr_t)APTR_AS_INTEGER( cell );
+  free( bucket );
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_geoindex( vgx_GeoIndex_t **geoindex ) {
+  if( geoindex && *geoindex ) {
+    vgx_GeoIndex_t *G = *geoindex;
+    if( G->leaves ) {
+      iFramehash.simple.Process( G->leaves, __free_bucket, NULL, NULL );
+      iFramehash.simple.Destroy( &G->leaves, &G->fhdyn );
+    }
+    if( G->cells ) {
+      iFramehash.simple.Destroy( &G->cells, &G->fhdyn );
+    }
+    if( G->members ) {
+      iFramehash.simple.Destroy( &G->members, &G->fhdyn );
+    }
+    iFramehash.dynamic.ClearDynamic( &G->fhdyn );
+    iString.Discard( &G->CSTR__lat_key );
+    iString.Discard( &G->CSTR__lon_key );
+    free( G );
+    *geoindex = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Return the vertex position if it has numeric lat/lon properties within
+ * valid range.
+ ***********************************************************************
+ */
+DLL_HIDDEN bool _vxgraph_geoindex__vertex_position( const vgx_Vertex_t *vertex, shortid_t lat_keyhash, shortid_t lon_keyhash, double *lat, double *lon ) {
+  if( vertex->properties == NULL ) {
+    return false;
+  }
+  shortid_t keys[2] = { lat_keyhash, lon_keyhash };
+  double *coords[2] = { lat, lon };
+  for( int i=0; i<2; i++ ) {
+    framehash_value_t fvalue = 0;
+    switch( iFramehash.simple.GetHash64( vertex->properties, keys[i], &fvalue ) ) {
+    case CELL_VALUE_TYPE_INTEGER:
+      *coords[i] = (double)(int64_t)fvalue;
+      break;
+    case CELL_VALUE_TYPE_REAL:
+      *coords[i] = *(double*)&fvalue;
+      break;
+    default:
+      return false;
+    }
+  }
+  return *lat >= -90.0 && *lat <= 90.0 && *lon >= -180.0 && *lon <= 180.0;
+}
+
+
+
+/*******************************************************************//**
+ * Haversine distance in meters (same as evaluator geodist)
+ ***********************************************************************
+ */
+DLL_HIDDEN double _vxgraph_geoindex__distance( double lat1, double lon1, double lat2, double lon2 ) {
+  double r_lat1 = GEO_RADIANS( lat1 );
+  double r_lat2 = GEO_RADIANS( lat2 );
+  double sdlat2 = sin( ( r_lat2 - r_lat1 ) / 2.0 );
+  double sdlon2 = sin( ( GEO_RADIANS( lon2 ) - GEO_RADIANS( lon1 ) ) / 2.0 );
+  double a = sdlat2 * sdlat2 + cos( r_lat1 ) * cos( r_lat2 ) * sdlon2 * sdlon2;
+  double distance = GEO_EARTH_RADIUS * 2.0 * atan2( sqrt( a ), sqrt( 1.0 - a ) );
+  if( isnan( distance ) ) {
+    return GEO_EARTH_RADIUS * M_PI;
+  }
+  return distance;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static QWORD __leaf_xy( double lat, double lon ) {
+  int64_t y = (int64_t)( (lat + 90.0) / 180.0 * GEO_LEAF_SIDE );
+  int64_t x = (int64_t)( (lon + 180.0) / 360.0 * GEO_LEAF_SIDE );
+  if( y > GEO_LEAF_MASK ) {
+    y = GEO_LEAF_MASK;
+  }
+  if( x > GEO_LEAF_MASK ) {
+    x = GEO_LEAF_MASK;
+  }
+  return ((QWORD)y << GEO_LEAF_LEVEL) | (QWORD)x;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  1 : Vertex inserted
+ *         -1 : Error
+ ***********************************************************************
+ */
+static int __geoindex_insert_CS( vgx_GeoIndex_t *G, vgx_Vertex_t *vertex, QWORD xy ) {
+  QWORD y = xy >> GEO_LEAF_LEVEL;
+  QWORD x = xy & GEO_LEAF_MASK;
+  QWORD leafkey = __GEO_CELL_KEY( GEO_LEAF_LEVEL, y, x );
+
+  // Get leaf bucket
+  __geo_bucket_t *bucket = NULL;
+  int64_t addr = 0;
+  if( iFramehash.simple.GetInt( G->leaves, &G->fhdyn, leafkey, &addr ) == 1 ) {
+    bucket = (__geo_bucket_t*)addr;
+  }
+
+  // Create or grow bucket
+  if( bucket == NULL || bucket->sz == bucket->cap ) {
+    int64_t cap = bucket ? 2 * bucket->cap : 4;
+    if( cap > GEO_BUCKET_MAX_SLOT ) {
+      return -1;
+    }
+    // Map the new bucket before freeing the old one so the map never holds a freed bucket
+    __geo_bucket_t *resized = malloc( sizeof( __geo_bucket_t ) + cap * sizeof( vgx_Vertex_t* ) );
+    if( resized == NULL ) {
+      return -1;
+    }
+    resized->sz = bucket ? bucket->sz : 0;
+    resized->cap = cap;
+    if( bucket ) {
+      memcpy( resized->vertices, bucket->vertices, bucket->sz * sizeof( vgx_Vertex_t* ) );
+    }
+    if( iFramehash.simple.SetInt( &G->leaves, &G->fhdyn, leafkey, (int64_t)resized ) < 0 ) {
+      free( resized );
+      return -1;
+    }
+    free( bucket );
+    bucket = resized;
+  }
+
+  // Add vertex to bucket and register membership
+  int64_t slot = bucket->sz;
+  if( iFramehash.simple.SetInt( &G->members, &G->fhdyn, (QWORD)vertex, __GEO_MEMBER( slot, xy ) ) < 0 ) {
+    return -1;
+  }
+  bucket->vertices[ slot ] = vertex;
+  bucket->sz++;
+
+  // Count vertex in all cells containing it
+  for( int level=0; level<=GEO_LEAF_LEVEL; level++ ) {
+    int shift = GEO_LEAF_LEVEL - level;
+    iFramehash.simple.IncInt( &G->cells, &G->fhdyn, __GEO_CELL_KEY( level, y >> shift, x >> shift ), 1, NULL );
+  }
+
+  G->n_vertices++;
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  1 : Vertex removed
+ *          0 : Vertex not indexed
+ ***********************************************************************
+ */
+static int __geoindex_remove_CS( vgx_GeoIndex_t *G, vgx_Vertex_t *vertex ) {
+  int64_t member = 0;
+  if( iFramehash.simple.GetInt( G->members, &G->fhdyn, (QWORD)vertex, &member ) != 1 ) {
+    return 0;
+  }
+  iFramehash.simple.DelInt( &G->members, &G->fhdyn, (QWORD)vertex );
+
+  QWORD xy = __GEO_MEMBER_XY( member );
+  int64_t slot = __GEO_MEMBER_SLOT( member );
+  QWORD y = xy >> GEO_LEAF_LEVEL;
+  QWORD x = xy & GEO_LEAF_MASK;
+  QWORD leafkey = __GEO_CELL_KEY( GEO_LEAF_LEVEL, y, x );
+
+  // Swap-remove from leaf bucket
+  int64_t addr = 0;
+  if( iFramehash.simple.GetInt( G->leaves, &G->fhdyn, leafkey, &addr ) == 1 ) {
+    __geo_bucket_t *bucket = (__geo_bucket_t*)addr;
+    int64_t last = --bucket->sz;
+    if( slot != last ) {
+      vgx_Vertex_t *moved = bucket->vertices[ last ];
+      bucket->vertices[ slot ] = moved;
+      iFramehash.simple.SetInt( &G->members, &G->fhdyn, (QWORD)moved, __GEO_MEMBER( slot, xy ) );
+    }
+    if( bucket->sz == 0 ) {
+      iFramehash.simple.DelInt( &G->leaves, &G->fhdyn, leafkey );
+      free( bucket );
+    }
+  }
+
+  // Uncount vertex in all cells containing it
+  for( int level=0; level<=GEO_LEAF_LEVEL; level++ ) {
+    int shift = GEO_LEAF_LEVEL - level;
+    iFramehash.simple.DecInt( &G->cells, &G->fhdyn, __GEO_CELL_KEY( level, y >> shift, x >> shift ), 1, NULL, true, NULL );
+  }
+
+  G->n_vertices--;
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ * Place vertex in the leaf cell for its current position, or remove it
+ * from the index if it no longer has a valid position.
+ *
+ * Return:  1 : Vertex moved, inserted or removed
+ *          0 : No change
+ *         -1 : Error
+ ***********************************************************************
+ */
+static int __geoindex_update_CS( vgx_GeoIndex_t *G, vgx_Vertex_t *vertex ) {
+  double lat, lon;
+  int64_t member = 0;
+  bool indexed = iFramehash.simple.GetInt( G->members, &G->fhdyn, (QWORD)vertex, &member ) == 1;
+
+  if( _vxgraph_geoindex__vertex_position( vertex, G->lat_keyhash, G->lon_keyhash, &lat, &lon ) ) {
+    QWORD xy = __leaf_xy( lat, lon );
+    if( indexed ) {
+      // Same cell, nothing to do
+      if( __GEO_MEMBER_XY( member ) == xy ) {
+        return 0;
+      }
+      __geoindex_remove_CS( G, vertex );
+    }
+    return __geoindex_insert_CS( G, vertex, xy );
+  }
+  else if( indexed ) {
+    return __geoindex_remove_CS( G, vertex );
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __cxmalloc_geoindex_add_vertex_CS( cxmalloc_object_processing_context_t *context, vgx_Vertex_t *vertex ) {
+  if( vertex && __vertex_is_manifestation_null( vertex ) == false && __vertex_is_indexed_main( vertex ) ) {
+    vgx_GeoIndex_t *G = (vgx_GeoIndex_t*)context->input;
+    if( __geoindex_update_CS( G, vertex ) < 0 ) {
+      context->completed = true;
+      context->error = true;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __geoindex_populate_CS( vgx_Graph_t *self, vgx_GeoIndex_t *G ) {
+  cxmalloc_object_processing_context_t populate = {0};
+  populate.object_class = COMLIB_CLASS( vgx_Vertex_t );
+  populate.process_object = (f_cxmalloc_object_processor)__cxmalloc_geoindex_add_vertex_CS;
+  populate.input = G;
+  CALLABLE( self->vertex_allocator )->ProcessObjects( self->vertex_allocator, &populate );
+  if( populate.error ) {
+    return -1;
+  }
+  return G->n_vertices;
+}
+
+
+
+/*******************************************************************//**
+ * Declare a geo index over numeric properties lat_key and lon_key and
+ * populate it with all vertices. Any previous geo index is replaced.
+ *
+ * Return: Number of vertices indexed, or -1 on error
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_geoindex__create_OPEN( vgx_Graph_t *self, const char *lat_key, const char *lon_key, CString_t **CSTR__error ) {
+  int64_t n_indexed = -1;
+  vgx_GeoIndex_t *G = NULL;
+
+  if( lat_key == NULL || lon_key == NULL || *lat_key == '\0' || *lon_key == '\0' ) {
+    __set_error_string( CSTR__error, "lat/lon property keys required" );
+    return -1;
+  }
+
+  GRAPH_LOCK( self ) {
+    if( !_vgx_is_writable_CS( &self->readonly ) ) {
+      __set_error_string( CSTR__error, "graph is readonly" );
+    }
+    else {
+      BEGIN_DISALLOW_READONLY_CS( &self->readonly ) {
+        vgx_ExecutionTimingBudget_t timing_budget = _vgx_get_graph_execution_timing_budget( self, 30000 );
+        // Hold until no other threads have writable vertices, since we read their properties
+        BEGIN_STATIC_GRAPH_CS( self, &timing_budget ) {
+          if( (G = __new_geoindex( self, lat_key, lon_key )) == NULL ) {
+            __set_error_string( CSTR__error, "out of memory" );
+          }
+          else if( (n_indexed = __geoindex_populate_CS( self, G )) < 0 ) {
+            __set_error_string( CSTR__error, "internal error" );
+            __delete_geoindex( &G );
+          }
+          else {
+            // Replace any previous index
+            __delete_geoindex( &self->geoindex );
+            self->geoindex = G;
+          }
+        } END_STATIC_GRAPH_CS;
+        if( timing_budget.reason != VGX_ACCESS_REASON_NONE && n_indexed < 0 ) {
+          __set_error_string( CSTR__error, "timeout waiting for writable vertices to be released" );
+        }
+      } END_DISALLOW_READONLY_CS;
+    }
+  } GRAPH_RELEASE;
+
+  return n_indexed;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  1 : Geo index dropped
+ *          0 : No geo index
+ *         -1 : Graph is readonly
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_geoindex__drop_OPEN( vgx_Graph_t *self ) {
+  int ret = 0;
+  GRAPH_LOCK( self ) {
+    // Readonly queries use the index without CS
+    if( !_vgx_is_writable_CS( &self->readonly ) ) {
+      ret = -1;
+    }
+    else if( self->geoindex ) {
+      __delete_geoindex( &self->geoindex );
+      ret = 1;
+    }
+  } GRAPH_RELEASE;
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void _vxgraph_geoindex__destroy_CS( vgx_Graph_t *self ) {
+  __delete_geoindex( &self->geoindex );
+}
+
+
+
+/*******************************************************************//**
+ * Repopulate geo index from scratch (after bulk vertex removal)
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_geoindex__rebuild_CS( vgx_Graph_t *self ) {
+  vgx_GeoIndex_t *G = self->geoindex;
+  if( G == NULL ) {
+    return 0;
+  }
+  vgx_GeoIndex_t *R = __new_geoindex( self, CStringValue( G->CSTR__lat_key ), CStringValue( G->CSTR__lon_key ) );
+  if( R == NULL || __geoindex_populate_CS( self, R ) < 0 ) {
+    // Never leave a stale index behind
+    __delete_geoindex( &R );
+    __delete_geoindex( &self->geoindex );
+    CRITICAL( 0xE65, "Geo index dropped after failed rebuild" );
+    return -1;
+  }
+  __delete_geoindex( &self->geoindex );
+  self->geoindex = R;
+  return R->n_vertices;
+}
+
+
+
+/*******************************************************************//**
+ * Update the vertex position in the geo index after a property change.
+ * keyhash 0 means any property may have changed.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_geoindex__update_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK, shortid_t keyhash ) {
+  vgx_GeoIndex_t *G = self->geoindex;
+  if( G == NULL ) {
+    return 0;
+  }
+  if( keyhash != 0 && keyhash != G->lat_keyhash && keyhash != G->lon_keyhash ) {
+    return 0;
+  }
+  // Only vertices in the main index are visible to queries
+  if( !__vertex_is_indexed_main( vertex_LCK ) ) {
+    return 0;
+  }
+  int ret = __geoindex_update_CS( G, vertex_LCK );
+  if( ret < 0 ) {
+    const char *prefix = CALLABLE( vertex_LCK )->IDPrefix( vertex_LCK );
+    REASON( 0xE66, "Failed to update geo index for vertex '%s'", prefix );
+  }
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_geoindex__remove_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK ) {
+  if( self->geoindex == NULL ) {
+    return 0;
+  }
+  return __geoindex_remove_CS( self->geoindex, vertex_LCK );
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  0 : Keys assigned
+ *         -1 : No geo index
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_geoindex__get_keys_OPEN( vgx_Graph_t *self, shortid_t *lat_keyhash, shortid_t *lon_keyhash ) {
+  int ret = -1;
+  GRAPH_LOCK( self ) {
+    if( self->geoindex ) {
+      *lat_keyhash = self->geoindex->lat_keyhash;
+      *lon_keyhash = self->geoindex->lon_keyhash;
+      ret = 0;
+    }
+  } GRAPH_RELEASE;
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Bounding lat/lon region for a spherical cap
+ *
+ ***********************************************************************
+ */
+static void __geo_region( double lat, double lon, double radius, __geo_region_t *R ) {
+  double d = radius / GEO_EARTH_RADIUS;
+  double dlat = GEO_DEGREES( d );
+  R->lat_min = lat - dlat;
+  R->lat_max = lat + dlat;
+  R->lon_min = -180.0;
+  R->lon_max = 180.0;
+  R->all_lon = true;
+  // Cap does not contain a pole
+  if( R->lat_min > -90.0 && R->lat_max < 90.0 ) {
+    double s = sin( d ) / cos( GEO_RADIANS( lat ) );
+    if( s < 1.0 ) {
+      double dlon = GEO_DEGREES( asin( s ) );
+      R->lon_min = lon - dlon;
+      R->lon_max = lon + dlon;
+      R->all_lon = false;
+    }
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Longitude range of region may extend past +/-180 and is tested
+ * with wrap-around.
+ ***********************************************************************
+ */
+static bool __geo_region_overlap( const __geo_region_t *R, double lat0, double lat1, double lon0, double lon1 ) {
+  if( lat1 < R->lat_min || lat0 > R->lat_max ) {
+    return false;
+  }
+  if( R->all_lon ) {
+    return true;
+  }
+  for( double shift = -360.0; shift <= 360.0; shift += 360.0 ) {
+    if( lon0 <= R->lon_max + shift && lon1 >= R->lon_min + shift ) {
+      return true;
+    }
+  }
+  return false;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  1 : Processing completed (stop)
+ *          0 : Continue
+ ***********************************************************************
+ */
+static int64_t __geo_descend( const vgx_GeoIndex_t *G, const __geo_region_t *R, int level, QWORD y, QWORD x, cxmalloc_object_processing_context_t *scan_context ) {
+  double h = 180.0 / (double)(1LL << level);
+  double w = 360.0 / (double)(1LL << level);
+  double lat0 = -90.0 + y * h;
+  double lon0 = -180.0 + x * w;
+  if( !__geo_region_overlap( R, lat0, lat0 + h, lon0, lon0 + w ) ) {
+    return 0;
+  }
+
+  int64_t count = 0;
+  if( iFramehash.simple.GetInt( G->cells, &G->fhdyn, __GEO_CELL_KEY( level, y, x ), &count ) != 1 || count <= 0 ) {
+    return 0;
+  }
+
+  // Leaf: process all candidates
+  if( level == GEO_LEAF_LEVEL ) {
+    int64_t addr = 0;
+    if( iFramehash.simple.GetInt( G->leaves, &G->fhdyn, __GEO_CELL_KEY( level, y, x ), &addr ) == 1 ) {
+      __geo_bucket_t *bucket = (__geo_bucket_t*)addr;
+      for( int64_t i=0; i<bucket->sz; i++ ) {
+        scan_context->process_object( scan_context, COMLIB_OBJECT( bucket->vertices[i] ) );
+        scan_context->n_objects_processed++;
+        if( scan_context->completed ) {
+          return 1;
+        }
+      }
+    }
+    return 0;
+  }
+
+  // Descend into the four sub-cells
+  for( QWORD dy=0; dy<2; dy++ ) {
+    for( QWORD dx=0; dx<2; dx++ ) {
+      if( __geo_descend( G, R, level+1, 2*y + dy, 2*x + dx, scan_context ) ) {
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Pass every indexed vertex in cells overlapping the geo probe region to
+ * scan_context->process_object. Candidates must still be checked with
+ * the exact distance by the vertex filter.
+ *
+ * Return: Number of candidates processed, or -1 if the geo index cannot
+ *         serve the probe (caller must scan)
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_geoindex__process_candidates_ROG_or_CS( vgx_Graph_t *self, const vgx_geo_probe_t *geo_probe, cxmalloc_object_processing_context_t *scan_context ) {
+  const vgx_GeoIndex_t *G = self->geoindex;
+  if( G == NULL || !geo_probe->positive || G->lat_keyhash != geo_probe->lat_keyhash || G->lon_keyhash != geo_probe->lon_keyhash ) {
+    return -1;
+  }
+  __geo_region_t R;
+  __geo_region( geo_probe->lat, geo_probe->lon, geo_probe->radius, &R );
+  __geo_descend( G, &R, 0, 0, 0, scan_context );
+  return scan_context->n_objects_processed;
+}
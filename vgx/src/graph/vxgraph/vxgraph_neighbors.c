@@ -0,0 +1,376 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    vxgraph_neighbors.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#include "_vgx.h"
+#include "_vxarcvector.h"
+
+/* exception module */
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
+
+
+
+/*******************************************************************//**
+ *
+ * Common Neighbors
+ * ----------------
+ * The neighbor set of a vertex is extracted from its arcvector(s) as
+ * a sorted array of distinct head vertex addresses. Frozen arc arrays
+ * are already ordered by head address and need no sorting. Two sets
+ * are intersected by a merge when their sizes are similar, or by
+ * galloping through the larger set when it is much larger than the
+ * smaller set.
+ *
+ * The caller holds readonly locks on the vertices whose sets are
+ * extracted (or the graph is readonly.) Common neighbors are heads of
+ * arcs from locked vertices and cannot be removed, so their degree can
+ * be read without locking them.
+ *
+ ***********************************************************************
+ */
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+static int __grow_set( vgx_NeighborSet_t *set, int64_t capacity ) {
+  if( capacity <= set->capacity ) {
+    return 0;
+  }
+  int64_t sz = set->capacity > 0 ? set->capacity : 16;
+  while( sz < capacity ) {
+    sz <<= 1;
+  }
+  vgx_Vertex_t **heads = realloc( set->heads, sz * sizeof( vgx_Vertex_t* ) );
+  if( heads == NULL ) {
+    return -1;
+  }
+  set->heads = heads;
+  set->capacity = sz;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+static int __visit_neighbor( void *context, const vgx_Arc_t *arc ) {
+  vgx_NeighborSet_t *set = context;
+  if( set->rel != VGX_PREDICATOR_REL_WILDCARD && arc->head.predicator.rel.enc != set->rel ) {
+    return 0;
+  }
+  if( set->n >= set->capacity && __grow_set( set, set->n + 1 ) < 0 ) {
+    return -1;
+  }
+  set->heads[ set->n++ ] = arc->head.vertex;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+static int __compare_head_address( const void *a, const void *b ) {
+  uintptr_t x = (uintptr_t)*(const vgx_Vertex_t**)a;
+  uintptr_t y = (uintptr_t)*(const vgx_Vertex_t**)b;
+  return (x > y) - (x < y);
+}
+
+
+
+/*******************************************************************//**
+ * Sort heads (unless already sorted) and remove duplicates left by
+ * multiple arcs to the same head.
+ ***********************************************************************
+ */
+static void __sort_unique( vgx_NeighborSet_t *set ) {
+  vgx_Vertex_t **heads = set->heads;
+  int64_t n = set->n;
+  if( n < 2 ) {
+    return;
+  }
+  for( int64_t i=1; i<n; i++ ) {
+    if( (uintptr_t)heads[i] < (uintptr_t)heads[i-1] ) {
+      qsort( (void*)heads, n, sizeof( vgx_Vertex_t* ), __compare_head_address );
+      break;
+    }
+  }
+  int64_t u = 1;
+  for( int64_t i=1; i<n; i++ ) {
+    if( heads[i] != heads[u-1] ) {
+      heads[u++] = heads[i];
+    }
+  }
+  set->n = u;
+}
+
+
+
+/*******************************************************************//**
+ * Return the index of the first head in heads[lo:n] not less than x,
+ * probing at exponentially increasing distances from lo before a
+ * binary search within the final interval.
+ ***********************************************************************
+ */
+__inline static int64_t __gallop( vgx_Vertex_t * const *heads, int64_t n, int64_t lo, uintptr_t x ) {
+  int64_t hi = lo;
+  int64_t step = 1;
+  while( hi < n && (uintptr_t)heads[hi] < x ) {
+    lo = hi + 1;
+    hi += step;
+    step <<= 1;
+  }
+  if( hi > n ) {
+    hi = n;
+  }
+  while( lo < hi ) {
+    int64_t mid = lo + ((hi - lo) >> 1);
+    if( (uintptr_t)heads[mid] < x ) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+
+
+/*******************************************************************//**
+ * Total degree of a common neighbor opposite to arcdir. A readonly
+ * graph is read exactly. Otherwise the degree word is read once,
+ * counting a single (possibly multiple) arc as one.
+ ***********************************************************************
+ */
+__inline static int64_t __neighbor_degree( const vgx_Vertex_t *neighbor, vgx_arc_direction arcdir, bool readonly_graph ) {
+  const vgx_ArcVector_cell_t *V[2] = {0};
+  switch( arcdir ) {
+  case VGX_ARCDIR_OUT:
+    V[0] = &neighbor->inarcs;
+    break;
+  case VGX_ARCDIR_IN:
+    V[0] = &neighbor->outarcs;
+    break;
+  default:
+    V[0] = &neighbor->inarcs;
+    V[1] = &neighbor->outarcs;
+  }
+  int64_t degree = 0;
+  for( int i=0; i<2 && V[i]; i++ ) {
+    if( readonly_graph ) {
+      degree += iarcvector.Degree( V[i] );
+    }
+    else {
+      vgx_ArcVector_cell_t snapshot = { .VxD = V[i]->VxD };
+      switch( TPTR_AS_TAG( &snapshot.VxD ) ) {
+      case VGX_ARCVECTOR_VxD_DEGREE:
+        degree += __arcvector_get_degree( &snapshot );
+        break;
+      case VGX_ARCVECTOR_VxD_VERTEX:
+        degree += 1;
+        break;
+      default:
+        break;
+      }
+    }
+  }
+  return degree;
+}
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN vgx_NeighborSet_t * _vxgraph_neighbors__new_set( void ) {
+  return calloc( 1, sizeof( vgx_NeighborSet_t ) );
+}
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void _vxgraph_neighbors__delete_set( vgx_NeighborSet_t **set ) {
+  if( set && *set ) {
+    free( (*set)->heads );
+    free( *set );
+    *set = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Extract the neighbor set of vertex_RO in direction arcdir (OUT, IN or
+ * ANY), including only arcs matching filter (if any) and relationship
+ * rel (unless wildcard.)
+ *
+ * Returns: Number of distinct neighbors, or -1 on error
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_neighbors__extract( const vgx_Vertex_t *vertex_RO, vgx_arc_direction arcdir, vgx_virtual_ArcFilter_context_t *filter, vgx_predicator_rel_enum rel, vgx_NeighborSet_t *set ) {
+  vgx_Vertex_t *tail = (vgx_Vertex_t*)vertex_RO;
+  bool outarcs = arcdir == VGX_ARCDIR_OUT || arcdir == VGX_ARCDIR_ANY;
+  bool inarcs = arcdir == VGX_ARCDIR_IN || arcdir == VGX_ARCDIR_ANY;
+
+  set->n = 0;
+  set->vertex = NULL;
+  set->rel = rel;
+  set->arcdir = arcdir;
+
+  if( !outarcs && !inarcs ) {
+    return -1;
+  }
+
+  int64_t degree = (outarcs ? iarcvector.Degree( &tail->outarcs ) : 0) + (inarcs ? iarcvector.Degree( &tail->inarcs ) : 0);
+  if( degree < 0 || __grow_set( set, degree ) < 0 ) {
+    return -1;
+  }
+
+  if( (outarcs && iarcvector.Visit( tail, &tail->outarcs, filter, __visit_neighbor, set ) < 0)
+      ||
+      (inarcs && iarcvector.Visit( tail, &tail->inarcs, filter, __visit_neighbor, set ) < 0) )
+  {
+    set->n = 0;
+    return -1;
+  }
+
+  __sort_unique( set );
+  set->vertex = vertex_RO;
+  return set->n;
+}
+
+
+
+/*******************************************************************//**
+ * Intersect neighbor sets A and B and compute scores into result.
+ * Adamic-Adar (which reads the degree of every common neighbor) is
+ * only computed when requested.
+ *
+ * Returns: Number of common neighbors
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_neighbors__intersect( const vgx_NeighborSet_t *A, const vgx_NeighborSet_t *B, bool adamic_adar, bool readonly_graph, vgx_CommonNeighbors_t *result ) {
+  // Iterate the smaller set
+  const vgx_NeighborSet_t *S = A->n <= B->n ? A : B;
+  const vgx_NeighborSet_t *L = S == A ? B : A;
+  vgx_Vertex_t * const *s = S->heads;
+  vgx_Vertex_t * const *l = L->heads;
+  int64_t ns = S->n;
+  int64_t nl = L->n;
+  int64_t n_common = 0;
+  double aa = 0.0;
+  vgx_arc_direction arcdir = A->arcdir;
+
+  // Gallop through the larger set
+  if( ns > 0 && nl / ns >= VGX_COMMON_NEIGHBORS_GALLOP_RATIO ) {
+    int64_t j = 0;
+    for( int64_t i=0; i<ns && j<nl; i++ ) {
+      uintptr_t x = (uintptr_t)s[i];
+      if( (j = __gallop( l, nl, j, x )) < nl && (uintptr_t)l[j] == x ) {
+        ++n_common;
+        if( adamic_adar ) {
+          aa += 1.0 / log( (double)maximum_value( __neighbor_degree( s[i], arcdir, readonly_graph ), 2 ) );
+        }
+        ++j;
+      }
+    }
+  }
+  // Merge
+  else {
+    int64_t i = 0;
+    int64_t j = 0;
+    while( i < ns && j < nl ) {
+      uintptr_t x = (uintptr_t)s[i];
+      uintptr_t y = (uintptr_t)l[j];
+      if( x == y ) {
+        ++n_common;
+        if( adamic_adar ) {
+          aa += 1.0 / log( (double)maximum_value( __neighbor_degree( s[i], arcdir, readonly_graph ), 2 ) );
+        }
+        ++i;
+        ++j;
+      }
+      else {
+        i += x < y;
+        j += y < x;
+      }
+    }
+  }
+
+  int64_t n_union = A->n + B->n - n_common;
+  result->n_common = n_common;
+  result->n_A = A->n;
+  result->n_B = B->n;
+  result->jaccard = n_union > 0 ? (double)n_common / (double)n_union : 0.0;
+  result->cosine = n_common > 0 ? (double)n_common / sqrt( (double)A->n * (double)B->n ) : 0.0;
+  result->adamic_adar = aa;
+
+  return n_common;
+}
+
+
+
+/*******************************************************************//**
+ * Common neighbors of vertex_RO and other_RO for the evaluator. Both
+ * vertices are locked readonly by the traversal (or the graph is
+ * readonly.) The first set is kept in sets[0] and reused while the
+ * same vertex, relationship and direction are requested, i.e. for all
+ * neighbors of the anchor. Callers must clear sets[0]->vertex when
+ * the locked vertex may change.
+ *
+ * Returns: 0 on success, -1 on error
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_neighbors__common( vgx_NeighborSet_t **sets, const vgx_Vertex_t *vertex_RO, const vgx_Vertex_t *other_RO, vgx_predicator_rel_enum rel, vgx_arc_direction arcdir, bool adamic_adar, vgx_CommonNeighbors_t *result ) {
+  for( int i=0; i<2; i++ ) {
+    if( sets[i] == NULL && (sets[i] = _vxgraph_neighbors__new_set()) == NULL ) {
+      return -1;
+    }
+  }
+  vgx_NeighborSet_t *A = sets[0];
+  vgx_NeighborSet_t *B = sets[1];
+  if( A->vertex != vertex_RO || A->rel != rel || A->arcdir != arcdir ) {
+    if( _vxgraph_neighbors__extract( vertex_RO, arcdir, NULL, rel, A ) < 0 ) {
+      return -1;
+    }
+  }
+  if( _vxgraph_neighbors__extract( other_RO, arcdir, NULL, rel, B ) < 0 ) {
+    return -1;
+  }
+  B->vertex = NULL;
+  bool readonly_graph = vertex_RO->graph && _vgx_is_readonly_CS( &vertex_RO->graph->readonly );
+  _vxgraph_neighbors__intersect( A, B, adamic_adar, readonly_graph, result );
+  return 0;
+}
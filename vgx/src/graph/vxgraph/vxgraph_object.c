@@ -67,6 +67,7 @@ static void Graph_clear_system_sync_callback( vgx_Graph_t *self );
 static const char * Graph_full_path( const vgx_Graph_t *self );
 
 static int64_t Graph_bulk_serialize( vgx_Graph_t *self, int timeout_ms, bool force, bool remote, vgx_AccessReason_t *reason, CString_t **CSTR__error );
+static int64_t Graph_bulk_serialize_background( vgx_Graph_t *self, int timeout_ms, bool remote, vgx_AccessReason_t *reason, CString_t **CSTR__error );
 
 static void Graph_dump( vgx_Graph_t *self );
 
@@ -127,6 +128,7 @@ static vgx_Graph_vtable_t Graph_Methods = {
   .ClearSystemSyncCallback        = Graph_clear_system_sync_callback,
   .FullPath                       = Graph_full_path,
   .BulkSerialize                  = Graph_bulk_serialize,
+  .BulkSerializeBackground        = Graph_bulk_serialize_background,
   .Dump                           = Graph_dump,
 
   /* PLACEHOLDER */
@@ -576,6 +578,9 @@ static vgx_Graph_t * Graph_constructor( const void *identifier, vgx_Graph_constr
       THROW_ERROR( CXLIB_ERR_GENERAL, 0x5C9 );
     }
 
+    // [Q2.8] Geo index is declared at runtime
+    self->geoindex = NULL;
+
     // [Q5-7] Graph's arcvector framehash dynamic
     iString.Discard( &CSTR__tmpstr );
     if( (CSTR__tmpstr = iString.NewFormat( NULL, "Arcvector Framehash Dynamic for Graph '%s'" , CStringValue(self->CSTR__name) )) == NULL ) {
@@ -597,11 +602,12 @@ static vgx_Graph_t * Graph_constructor( const void *identifier, vgx_Graph_constr
     // [Q8.4] Graph reverse size
     self->rev_size_atomic = 0;
 
-    // [Q8.5]
-    self->__rsv_8_5 = 0;
+    // [Q8.5] Text index is declared at runtime
+    self->textindex = NULL;
 
-    // [Q8.5]
-    self->__rsv_8_6 = 0;
+    // [Q8.6] Parallel traversal
+    self->parallel_traversal.min_degree = VGX_PARALLEL_TRAVERSAL_DEFAULT_MIN_DEGREE;
+    self->parallel_traversal.workers = VGX_PARALLEL_TRAVERSAL_DEFAULT_WORKERS;
 
     // [Q8.5]
     self->__rsv_8_7 = 0;
@@ -1173,7 +1179,7 @@ static void Graph_destructor( vgx_Graph_t *self ) {
     // Serialization in progress? If so wait until complete.
     GRAPH_LOCK( self ) {
       // Another thread is currently serializing this graph, we have to wait.
-      while( _vgx_is_serializing_CS( &self->readonly ) ) {
+      while( _vgx_is_serializing_CS( &self->readonly ) || _vgx_is_snapshotting_CS( &self->readonly ) ) {
         WAIT_FOR_VERTEX_AVAILABLE( self, 250 );
       }
 
@@ -1272,6 +1278,10 @@ static void Graph_destructor( vgx_Graph_t *self ) {
       // Evaluators
       iEvaluator.DestroyEvaluators( self );
 
+      // Geo and text indexes
+      _vxgraph_geoindex__destroy_CS( self );
+      _vxgraph_textindex__destroy_CS( self );
+
       // Vertex type index directory
       // Vertex index
       _vxgraph_vxtable__destroy_index_CS( self );
@@ -1566,6 +1576,22 @@ static int64_t Graph_bulk_serialize( vgx_Graph_t *self, int timeout_ms, bool for
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t Graph_bulk_serialize_background( vgx_Graph_t *self, int timeout_ms, bool remote, vgx_AccessReason_t *reason, CString_t **CSTR__error ) {
+  vgx_ExecutionTimingBudget_t timing_budget = _vgx_get_execution_timing_budget( 0, timeout_ms );
+  int64_t nqwords = iSerialization.BulkSerializeBackground( self, &timing_budget, remote, CSTR__error );
+  if( _vgx_is_execution_halted( &timing_budget ) ) {
+    __set_access_reason( reason, timing_budget.reason );
+  }
+  return nqwords;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1622,7 +1648,7 @@ static void Graph_dump( vgx_Graph_t *self ) {
       CXLIB_OSTREAM( "vtxmap_RO           : (framehash_cell_t*) %llp", self->vtxmap_RO, self->vtxmap_RO ? iFramehash.simple.Length( self->vtxmap_RO ) : 0 );
       CXLIB_OSTREAM( "evaluators          : (framehash_t*) %llp", self->evaluators );
       CXLIB_OSTREAM( "similarity          : (vgx_Similarity_t*) %llp", self->similarity );
-      CXLIB_OSTREAM( "__rsv_2_8           : %llu", self->__rsv_2_8 );
+      CXLIB_OSTREAM( "geoindex            : (vgx_GeoIndex_t*) %llp", self->geoindex );
 
 
       CXLIB_OSTREAM( " 3: -------- STATE LOCK -------" );
@@ -1665,8 +1691,8 @@ static void Graph_dump( vgx_Graph_t *self ) {
       CXLIB_OSTREAM( "      .TX_in_suspended  : %u", (unsigned)ro->__flags.bit.TX_in_suspended );
       CXLIB_OSTREAM( "      .__rsv4           : %u", (unsigned)ro->__flags.bit.__rsv4 );
       CXLIB_OSTREAM( "      .is_serializing   : %u", (unsigned)ro->__flags.bit.is_serializing );
-      CXLIB_OSTREAM( "      .__rsv6           : %u", (unsigned)ro->__flags.bit.__rsv6 );
-      CXLIB_OSTREAM( "      .__rsv7           : %u", (unsigned)ro->__flags.bit.__rsv7 );
+      CXLIB_OSTREAM( "      .is_snapshotting  : %u", (unsigned)ro->__flags.bit.is_snapshotting );
+      CXLIB_OSTREAM( "      .is_syncing       : %u", (unsigned)ro->__flags.bit.is_syncing );
       CXLIB_OSTREAM( "      .__rsv8           : %u", (unsigned)ro->__flags.bit.__rsv8 );
       CXLIB_OSTREAM( "operation               : (tptr_t) %016llx %lld 0x%x", self->operation.qword, TPTR_AS_INTEGER( &self->operation ), TPTR_AS_TAG( &self->operation ) );
       CXLIB_OSTREAM( "count_vtx_WL            : %lld", _vgx_graph_get_vertex_WL_count_CS( self ) );
@@ -1682,8 +1708,8 @@ static void Graph_dump( vgx_Graph_t *self ) {
       CXLIB_OSTREAM( "_nvectors_atomic    : %lld", GraphVectorCount( self ) );
       CXLIB_OSTREAM( "_nproperties_atomic : %lld", GraphPropCount( self ) );
       CXLIB_OSTREAM( "rev_size_atomic     : %lld", ATOMIC_READ_i64( &self->rev_size_atomic ) );
-      CXLIB_OSTREAM( "__rsv_8_5           : %llu", self->__rsv_8_5 );
-      CXLIB_OSTREAM( "__rsv_8_6           : %llu", self->__rsv_8_6 );
+      CXLIB_OSTREAM( "textindex           : (vgx_TextIndex_t*) %llp", self->textindex );
+      CXLIB_OSTREAM( "parallel_traversal  : min_degree=%d workers=%d", self->parallel_traversal.min_degree, self->parallel_traversal.workers );
       CXLIB_OSTREAM( "__rsv_8_7           : %llu", self->__rsv_8_7 );
       CXLIB_OSTREAM( "__rsv_8_8           : %llu", self->__rsv_8_8 );
 
@@ -1782,8 +1808,8 @@ static void Graph_dump( vgx_Graph_t *self ) {
       CXLIB_OSTREAM( "-- 1 -- (23)" );
       CXLIB_OSTREAM( "EVP.TASK                        : (comlib_task_t*) %llp", self->EVP.TASK );
       CXLIB_OSTREAM( "EVP.graph                       : (vgx_Graph_t*) %llp", self->EVP.graph );
-      CXLIB_OSTREAM( "EVP.EXECUTOR                    : (vgx_ExecutionJobDescriptor_t*) %llp", self->EVP.EXECUTOR );
-      CXLIB_OSTREAM( "EVP.executor_thread_id          : %u", (unsigned int)self->EVP.executor_thread_id );
+      CXLIB_OSTREAM( "EVP.EXECUTORS                   : (vgx_EventExecutorPool_t*) %llp", self->EVP.EXECUTORS );
+      CXLIB_OSTREAM( "EVP.EXECUTORS->n_shards         : %d", self->EVP.EXECUTORS ? self->EVP.EXECUTORS->n_shards : 0 );
       CXLIB_OSTREAM( "EVP.ready                       : %d", self->EVP.ready );
       CXLIB_OSTREAM( "EVP.params" );
       CXLIB_OSTREAM( "  .operation_timeout_ms         : %d", self->EVP.params.operation_timeout_ms );
@@ -0,0 +1,472 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    vxgraph_pagerank.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#include "_vgx.h"
+
+/* exception module */
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
+
+
+
+/*******************************************************************//**
+ *
+ * Personalized PageRank
+ * ---------------------
+ * Approximate personalized PageRank by residual push. Every tracked
+ * vertex has a score and a residual. Initially the residual of each
+ * seed is its normalized seed weight. Pushing a vertex moves alpha of
+ * its residual into its score and spreads the rest over its arcs in
+ * proportion to arc weights. Mass reaching a vertex without followable
+ * arcs restarts at the seeds. Vertices are queued for pushing while
+ * their residual is at least epsilon.
+ *
+ * The computation runs in the collector's context (readonly graph, or
+ * CS with no writable vertices held by other threads) and only reads
+ * vertex arcs. Vertices with a score are then passed to the vertex
+ * collector with their score as the evaluator's context.rank.
+ *
+ ***********************************************************************
+ */
+#define PAGERANK_TIMEOUT_CHECK_MASK 0x3F
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_pagerank_entry_t {
+  vgx_Vertex_t *vertex;
+  double score;
+  double residual;
+  bool queued;
+} __pagerank_entry_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_pagerank_arc_t {
+  vgx_Vertex_t *head;
+  double weight;
+} __pagerank_arc_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_pagerank_context_t {
+  const vgx_PageRankCondition_t *condition;
+
+  // Tracked vertices
+  __pagerank_entry_t *entries;
+  int64_t n_entries;
+  int64_t cap_entries;
+  int64_t *slots;   // entry index + 1 (0 is free)
+  int64_t mask;
+
+  // Push queue (ring of entry indices)
+  int64_t *queue;
+  int64_t q_head;
+  int64_t q_n;
+  int64_t q_cap;
+
+  // Weighted arcs of the vertex being pushed
+  __pagerank_arc_t *arcs;
+  int64_t n_arcs;
+  int64_t cap_arcs;
+  double total_weight;
+
+  // Resolved relationship weights
+  int *rel;
+
+  // Seed entries and normalized weights
+  int64_t *seed_index;
+  double *seed_weight;
+  int n_seeds;
+} __pagerank_context_t;
+
+
+
+/*******************************************************************//**
+ * Return the slot for vertex (occupied or first free)
+ ***********************************************************************
+ */
+static int64_t __pagerank_slot( const __pagerank_context_t *P, const vgx_Vertex_t *vertex ) {
+  uint64_t offset = __vertex_get_index( (vgx_AllocatedVertex_t*)_cxmalloc_linehead_from_object( (vgx_Vertex_t*)vertex ) );
+  int64_t i = ihash64( offset ) & P->mask;
+  int64_t e;
+  while( (e = P->slots[i]) != 0 && P->entries[e-1].vertex != vertex ) {
+    i = (i + 1) & P->mask;
+  }
+  return i;
+}
+
+
+
+/*******************************************************************//**
+ * Double the slot capacity
+ * Returns 0 on success, -1 on memory error
+ ***********************************************************************
+ */
+static int __pagerank_grow_slots( __pagerank_context_t *P ) {
+  int64_t sz = P->slots ? (P->mask + 1) * 2 : 256;
+  int64_t *slots = calloc( sz, sizeof( int64_t ) );
+  if( slots == NULL ) {
+    return -1;
+  }
+  free( P->slots );
+  P->slots = slots;
+  P->mask = sz - 1;
+  for( int64_t e=0; e<P->n_entries; e++ ) {
+    P->slots[ __pagerank_slot( P, P->entries[e].vertex ) ] = e + 1;
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Return entry index of vertex, adding a new entry if vertex is not
+ * tracked and the max_vertices bound allows it.
+ * Returns entry index, -1 if vertex cannot be tracked, or -2 on memory
+ * error
+ ***********************************************************************
+ */
+static int64_t __pagerank_entry( __pagerank_context_t *P, vgx_Vertex_t *vertex ) {
+  int64_t i = __pagerank_slot( P, vertex );
+  if( P->slots[i] ) {
+    return P->slots[i] - 1;
+  }
+  if( P->n_entries >= P->condition->max_vertices ) {
+    return -1;
+  }
+  // Keep load at or below 50%
+  if( 2 * (P->n_entries + 1) > P->mask + 1 ) {
+    if( __pagerank_grow_slots( P ) < 0 ) {
+      return -2;
+    }
+    i = __pagerank_slot( P, vertex );
+  }
+  if( P->n_entries == P->cap_entries ) {
+    int64_t cap = P->cap_entries > 0 ? P->cap_entries * 2 : 64;
+    __pagerank_entry_t *entries = realloc( P->entries, cap * sizeof( __pagerank_entry_t ) );
+    if( entries == NULL ) {
+      return -2;
+    }
+    P->entries = entries;
+    P->cap_entries = cap;
+  }
+  __pagerank_entry_t *entry = &P->entries[ P->n_entries ];
+  entry->vertex = vertex;
+  entry->score = 0.0;
+  entry->residual = 0.0;
+  entry->queued = false;
+  P->slots[i] = ++P->n_entries;
+  return P->n_entries - 1;
+}
+
+
+
+/*******************************************************************//**
+ * Add mass to the residual of entry, queueing the entry for push if
+ * its residual reaches epsilon
+ * Returns 0 on success, -1 on memory error
+ ***********************************************************************
+ */
+static int __pagerank_add_residual( __pagerank_context_t *P, int64_t e, double mass ) {
+  __pagerank_entry_t *entry = &P->entries[e];
+  entry->residual += mass;
+  if( !entry->queued && entry->residual >= P->condition->epsilon ) {
+    if( P->q_n == P->q_cap ) {
+      int64_t cap = P->q_cap > 0 ? P->q_cap * 2 : 64;
+      int64_t *queue = malloc( cap * sizeof( int64_t ) );
+      if( queue == NULL ) {
+        return -1;
+      }
+      // Unwrap ring into new buffer
+      for( int64_t k=0; k<P->q_n; k++ ) {
+        queue[k] = P->queue[ (P->q_head + k) % P->q_cap ];
+      }
+      free( P->queue );
+      P->queue = queue;
+      P->q_head = 0;
+      P->q_cap = cap;
+    }
+    P->queue[ (P->q_head + P->q_n++) % P->q_cap ] = e;
+    entry->queued = true;
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Restart mass at the seeds
+ * Returns 0 on success, -1 on memory error
+ ***********************************************************************
+ */
+static int __pagerank_restart( __pagerank_context_t *P, double mass ) {
+  for( int s=0; s<P->n_seeds; s++ ) {
+    if( __pagerank_add_residual( P, P->seed_index[s], mass * P->seed_weight[s] ) < 0 ) {
+      return -1;
+    }
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Arc visitor: keep arcs with positive weight
+ ***********************************************************************
+ */
+static int __pagerank_visit_arc( void *context, const vgx_Arc_t *arc ) {
+  __pagerank_context_t *P = context;
+  const vgx_PageRankCondition_t *condition = P->condition;
+  vgx_predicator_t pred = arc->head.predicator;
+  double weight = 1.0;
+  for( int k=0; k<condition->n_weights; k++ ) {
+    if( P->rel[k] == (int)pred.rel.enc ) {
+      weight = condition->weights[k].weight;
+      break;
+    }
+  }
+  if( condition->arcvalue ) {
+    weight *= _vgx_predicator_get_value_as_float( pred );
+  }
+  if( !(weight > 0.0) ) {
+    return 0;
+  }
+  if( P->n_arcs == P->cap_arcs ) {
+    int64_t cap = P->cap_arcs > 0 ? P->cap_arcs * 2 : 64;
+    __pagerank_arc_t *arcs = realloc( P->arcs, cap * sizeof( __pagerank_arc_t ) );
+    if( arcs == NULL ) {
+      return -1;
+    }
+    P->arcs = arcs;
+    P->cap_arcs = cap;
+  }
+  __pagerank_arc_t *A = &P->arcs[ P->n_arcs++ ];
+  A->head = arc->head.vertex;
+  A->weight = weight;
+  P->total_weight += weight;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Push entry e
+ * Returns 0 on success, -1 on error
+ ***********************************************************************
+ */
+static int __pagerank_push( __pagerank_context_t *P, int64_t e, vgx_arc_direction arcdir, vgx_virtual_ArcFilter_context_t *filter ) {
+  const vgx_PageRankCondition_t *condition = P->condition;
+  __pagerank_entry_t *entry = &P->entries[e];
+  vgx_Vertex_t *vertex = entry->vertex;
+  double residual = entry->residual;
+  entry->residual = 0.0;
+  entry->score += condition->alpha * residual;
+  double mass = (1.0 - condition->alpha) * residual;
+
+  // Collect weighted arcs
+  P->n_arcs = 0;
+  P->total_weight = 0.0;
+  if( arcdir != VGX_ARCDIR_IN && iarcvector.Visit( vertex, &vertex->outarcs, filter, __pagerank_visit_arc, P ) < 0 ) {
+    return -1;
+  }
+  if( arcdir != VGX_ARCDIR_OUT && iarcvector.Visit( vertex, &vertex->inarcs, filter, __pagerank_visit_arc, P ) < 0 ) {
+    return -1;
+  }
+
+  // Nowhere to go, restart
+  if( P->n_arcs == 0 ) {
+    return __pagerank_restart( P, mass );
+  }
+
+  // Spread mass over arcs (mass for untracked vertices is dropped)
+  for( int64_t a=0; a<P->n_arcs; a++ ) {
+    int64_t h = __pagerank_entry( P, P->arcs[a].head );
+    if( h == -2 ) {
+      return -1;
+    }
+    if( h >= 0 && __pagerank_add_residual( P, h, mass * P->arcs[a].weight / P->total_weight ) < 0 ) {
+      return -1;
+    }
+  }
+
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+static void __pagerank_clear( __pagerank_context_t *P ) {
+  free( P->entries );
+  free( P->slots );
+  free( P->queue );
+  free( P->arcs );
+  free( P->rel );
+  free( P->seed_index );
+  free( P->seed_weight );
+}
+
+
+
+/*******************************************************************//**
+ * Compute personalized pagerank for the condition and pass every vertex
+ * with a positive score to scan_context->process_object, with the score
+ * set as the vertex collector ranker's context.rank.
+ *
+ * Return: Number of scored vertices, or -1 on error
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_pagerank__process_candidates_ROG_or_CS( vgx_Graph_t *self, const vgx_PageRankCondition_t *pagerank, vgx_ExecutionTimingBudget_t *timing_budget, cxmalloc_object_processing_context_t *scan_context, CString_t **CSTR__error ) {
+  int64_t n_scored = 0;
+  vgx_virtual_ArcFilter_context_t *filter = NULL;
+
+  __pagerank_context_t P = {
+    .condition = pagerank
+  };
+
+  XTRY {
+    vgx_ArcConditionSet_t *acs = pagerank->arc_condition_set;
+    vgx_arc_direction arcdir = acs ? acs->arcdir : VGX_ARCDIR_OUT;
+    if( arcdir == VGX_ARCDIR_BOTH ) {
+      __set_error_string( CSTR__error, "pagerank requires arc direction D_OUT, D_IN or D_ANY" );
+      THROW_SILENT( CXLIB_ERR_API, 0x001 );
+    }
+    if( !(pagerank->alpha > 0.0 && pagerank->alpha <= 1.0) || !(pagerank->epsilon > 0.0) ) {
+      __set_error_string( CSTR__error, "pagerank requires 0 < alpha <= 1 and epsilon > 0" );
+      THROW_SILENT( CXLIB_ERR_API, 0x002 );
+    }
+
+    // Resolve relationship weights
+    if( pagerank->n_weights > 0 ) {
+      if( (P.rel = calloc( pagerank->n_weights, sizeof( int ) )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x003 );
+      }
+      for( int k=0; k<pagerank->n_weights; k++ ) {
+        int rel = (int)iEnumerator_CS.Relationship.GetEnum( self, pagerank->weights[k].CSTR__relationship );
+        P.rel[k] = __relationship_enumeration_valid( rel ) ? rel : -1;
+      }
+    }
+
+    // Resolve seeds (missing seeds are ignored)
+    if( pagerank->n_seeds > 0 ) {
+      if( (P.seed_index = calloc( pagerank->n_seeds, sizeof( int64_t ) )) == NULL ||
+          (P.seed_weight = calloc( pagerank->n_seeds, sizeof( double ) )) == NULL ||
+          __pagerank_grow_slots( &P ) < 0 )
+      {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x004 );
+      }
+    }
+    double total = 0.0;
+    for( int s=0; s<pagerank->n_seeds; s++ ) {
+      vgx_Vertex_t *seed = _vxgraph_vxtable__query_CS( self, pagerank->seeds[s].CSTR__id, NULL, VERTEX_TYPE_ENUMERATION_WILDCARD );
+      if( seed == NULL || __vertex_is_manifestation_null( seed ) || !(pagerank->seeds[s].weight > 0.0) ) {
+        continue;
+      }
+      int64_t e = __pagerank_entry( &P, seed );
+      if( e == -2 ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x005 );
+      }
+      if( e >= 0 ) {
+        P.seed_index[ P.n_seeds ] = e;
+        P.seed_weight[ P.n_seeds++ ] = pagerank->seeds[s].weight;
+        total += pagerank->seeds[s].weight;
+      }
+    }
+    if( P.n_seeds == 0 ) {
+      XBREAK;
+    }
+    for( int s=0; s<P.n_seeds; s++ ) {
+      P.seed_weight[s] /= total;
+    }
+
+    // Predicator filter for followed arcs
+    if( (filter = iArcFilter.New( self, true, acs, NULL, NULL, timing_budget )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x006 );
+    }
+
+    // Push
+    if( __pagerank_restart( &P, 1.0 ) < 0 ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x007 );
+    }
+    bool limited = _vgx_is_execution_limited( timing_budget );
+    int64_t tt = __GET_CURRENT_MILLISECOND_TICK() + timing_budget->t_remain_ms;
+    for( int64_t n=0; n<pagerank->max_iterations && P.q_n > 0; n++ ) {
+      int64_t e = P.queue[ P.q_head ];
+      P.q_head = (P.q_head + 1) % P.q_cap;
+      P.q_n--;
+      P.entries[e].queued = false;
+      if( __pagerank_push( &P, e, arcdir, filter ) < 0 ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x008 );
+      }
+      // Execution timeout!
+      if( limited && (n & PAGERANK_TIMEOUT_CHECK_MASK) == 0 && __GET_CURRENT_MILLISECOND_TICK() > tt ) {
+        _vgx_set_execution_halted( timing_budget, VGX_ACCESS_REASON_EXECUTION_TIMEOUT );
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x009 );
+      }
+    }
+
+    // Collect scored vertices
+    vgx_VertexCollector_context_t *collector = scan_context->output;
+    vgx_Evaluator_t *evaluator = collector->ranker ? collector->ranker->evaluator : NULL;
+    for( int64_t e=0; e<P.n_entries && !scan_context->completed; e++ ) {
+      __pagerank_entry_t *entry = &P.entries[e];
+      if( entry->score > 0.0 ) {
+        if( evaluator ) {
+          evaluator->context.rankscore = entry->score;
+        }
+        if( scan_context->process_object( scan_context, COMLIB_OBJECT( entry->vertex ) ) < 0 ) {
+          THROW_SILENT( CXLIB_ERR_GENERAL, 0x00A );
+        }
+        ++n_scored;
+      }
+    }
+  }
+  XCATCH( errcode ) {
+    // Timeout is reported by caller
+    if( !_vgx_is_execution_halted( timing_budget ) ) {
+      __set_error_string( CSTR__error, "pagerank error" );
+    }
+    n_scored = -1;
+  }
+  XFINALLY {
+    iArcFilter.Delete( &filter );
+    __pagerank_clear( &P );
+  }
+
+  return n_scored;
+}
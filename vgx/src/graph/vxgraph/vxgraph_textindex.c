@@ -0,0 +1,1397 @@
+/******************************************************************************
+ *
+ * VGX Server
+ * Distributed engine for plugin-based graph and vector search
+ *
+ * Module:  vgx
+ * File:    vxgraph_textindex.c
+ * Author:  Stian Lysne slysne.dev@gmail.com
+ *
+ * Copyright © 2025 Rakuten, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *****************************************************************************/
+
+#include "_vgx.h"
+#include "_vxeval.h"
+
+/* exception module */
+SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
+
+
+
+/*******************************************************************//**
+ *
+ * Inverted text index
+ * -------------------
+ * Each declared string property (field) has its own inverted index.
+ * Text is split into tokens by the same normalizer as the evaluator's
+ * normalize() function (lowercase, accents removed, punctuation splits)
+ * and every token is identified by its 64-bit hash.
+ *
+ * A posting list holds (vertex address, term frequency) for all vertices
+ * containing the term, ascending by address. The bulk of the list is
+ * packed as varint address deltas and frequencies. Recent changes go to
+ * a small sorted pending array which is merged into the packed list once
+ * it grows beyond a fraction of the list. A pending entry with frequency
+ * 0 hides a vertex that is still in the packed list.
+ *
+ * Every indexed vertex has a document record with its distinct terms,
+ * used to remove the vertex from the right posting lists when the text
+ * changes.
+ *
+ * The index holds no vertex references. It is maintained under CS by
+ * property updates and vertex unindexing, and is never persisted.
+ *
+ ***********************************************************************
+ */
+#define TEXT_PENDING_MIN        16
+#define TEXT_PENDING_FRACTION   8
+#define TEXT_BM25_K1            1.2
+#define TEXT_BM25_B             0.75
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_text_entry_t {
+  QWORD docid;
+  uint32_t tf;
+  uint32_t packed;
+} __text_entry_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_text_posting_t {
+  // Number of vertices containing term
+  int64_t n_docs;
+  // Packed (docid delta, tf) varint pairs
+  int64_t n_packed;
+  int64_t sz_packed;
+  int64_t cap_packed;
+  BYTE *packed;
+  // Sorted changes not yet merged into packed list
+  int64_t n_pending;
+  int64_t cap_pending;
+  __text_entry_t *pending;
+} __text_posting_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_text_term_t {
+  QWORD term;
+  int64_t tf;
+} __text_term_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_text_doc_t {
+  int64_t length;
+  int64_t n_terms;
+  __text_term_t terms[];
+} __text_doc_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct __s_text_field_t {
+  // Indexed property key
+  CString_t *CSTR__key;
+  shortid_t keyhash;
+
+  // Number of indexed vertices and their total number of tokens
+  int64_t n_docs;
+  int64_t n_tokens;
+
+  // Term -> posting list address
+  framehash_cell_t *postings;
+
+  // Vertex address -> document record address
+  framehash_cell_t *docs;
+} __text_field_t;
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+typedef struct s_vgx_TextIndex_t {
+  int n_fields;
+  __text_field_t *fields[ VGX_TEXT_INDEX_MAX_FIELDS ];
+  framehash_dynamic_t fhdyn;
+} vgx_TextIndex_t;
+
+
+
+/*******************************************************************//**
+ * BM25 parameters for one query, snapshot of index statistics
+ ***********************************************************************
+ */
+typedef struct s_vgx_TextScorer_t {
+  QWORD signature;
+  shortid_t keyhash;
+  double avgdl;
+  int n_terms;
+  QWORD terms[ VGX_TEXT_QUERY_MAX_TERMS ];
+  double idf[ VGX_TEXT_QUERY_MAX_TERMS ];
+} vgx_TextScorer_t;
+
+
+
+/*******************************************************************//**
+ * Merged read cursor over packed and pending entries of a posting list
+ ***********************************************************************
+ */
+typedef struct __s_text_cursor_t {
+  const __text_posting_t *P;
+  const BYTE *rp;
+  const BYTE *end;
+  int64_t ip;
+  QWORD packed_doc;
+  uint32_t packed_tf;
+  bool packed_valid;
+  QWORD doc;
+  uint32_t tf;
+  bool valid;
+} __text_cursor_t;
+
+
+
+static vgx_TextIndex_t * __new_textindex( void );
+static void __delete_textindex( vgx_TextIndex_t **textindex );
+static __text_field_t * __new_field( vgx_Graph_t *graph, vgx_TextIndex_t *T, const char *key );
+static void __delete_field( vgx_TextIndex_t *T, __text_field_t **field );
+static int64_t __free_posting( framehash_processing_context_t * const processor, framehash_cell_t * const cell );
+static int64_t __free_doc( framehash_processing_context_t * const processor, framehash_cell_t * const cell );
+static __text_field_t * __get_field( const vgx_TextIndex_t *T, shortid_t keyhash );
+static int __compare_term( const void *a, const void *b );
+static int __compare_qword( const void *a, const void *b );
+static const char * __vertex_text( const vgx_Vertex_t *vertex, shortid_t keyhash, CString_t **CSTR__owned );
+static __text_doc_t * __new_doc( const vgx_Vertex_t *vertex, shortid_t keyhash );
+static bool __equal_docs( const __text_doc_t *a, const __text_doc_t *b );
+
+static BYTE * __write_varint( BYTE *wp, QWORD x );
+static QWORD __read_varint( const BYTE **rp );
+static void __cursor_packed_next( __text_cursor_t *C );
+static void __cursor_init( __text_cursor_t *C, const __text_posting_t *P );
+static bool __cursor_next( __text_cursor_t *C );
+static bool __cursor_seek( __text_cursor_t *C, QWORD target );
+
+static bool __pending_find( const __text_posting_t *P, QWORD docid, int64_t *pos );
+static int __pending_insert( __text_posting_t *P, int64_t pos, QWORD docid, uint32_t tf, uint32_t packed );
+static int __posting_pack( __text_posting_t *P );
+static int __posting_add( __text_posting_t *P, QWORD docid, int64_t tf );
+static int __posting_remove( __text_posting_t *P, QWORD docid );
+
+static int __field_add_doc_CS( vgx_TextIndex_t *T, __text_field_t *F, vgx_Vertex_t *vertex, __text_doc_t *doc );
+static int __field_remove_doc_CS( vgx_TextIndex_t *T, __text_field_t *F, vgx_Vertex_t *vertex );
+static int __field_update_CS( vgx_TextIndex_t *T, __text_field_t *F, vgx_Vertex_t *vertex );
+static int64_t __cxmalloc_textindex_add_vertex_CS( cxmalloc_object_processing_context_t *context, vgx_Vertex_t *vertex );
+static int64_t __field_populate_CS( vgx_Graph_t *self, vgx_TextIndex_t *T, __text_field_t *F );
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static vgx_TextIndex_t * __new_textindex( void ) {
+  vgx_TextIndex_t *T = NULL;
+  XTRY {
+    if( (T = calloc( 1, sizeof( vgx_TextIndex_t ) )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xE71 );
+    }
+    if( iFramehash.dynamic.InitDynamicSimple( &T->fhdyn, "Text Index Framehash Dynamic", 21 ) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0xE72 );
+    }
+  }
+  XCATCH( errcode ) {
+    free( T );
+    T = NULL;
+  }
+  XFINALLY {
+  }
+  return T;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_textindex( vgx_TextIndex_t **textindex ) {
+  if( textindex && *textindex ) {
+    vgx_TextIndex_t *T = *textindex;
+    for( int i=0; i<T->n_fields; i++ ) {
+      __delete_field( T, &T->fields[i] );
+    }
+    iFramehash.dynamic.ClearDynamic( &T->fhdyn );
+    free( T );
+    *textindex = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static __text_field_t * __new_field( vgx_Graph_t *graph, vgx_TextIndex_t *T, const char *key ) {
+  __text_field_t *F = NULL;
+  XTRY {
+    if( (F = calloc( 1, sizeof( __text_field_t ) )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xE73 );
+    }
+    if( (F->CSTR__key = CStringNew( key )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xE74 );
+    }
+    F->keyhash = _vxenum_propkey__get_enum_CS( graph, F->CSTR__key );
+    if( (F->postings = iFramehash.simple.New( &T->fhdyn )) == NULL ||
+        (F->docs = iFramehash.simple.New( &T->fhdyn )) == NULL )
+    {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0xE75 );
+    }
+  }
+  XCATCH( errcode ) {
+    __delete_field( T, &F );
+  }
+  XFINALLY {
+  }
+  return F;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_field( vgx_TextIndex_t *T, __text_field_t **field ) {
+  if( field && *field ) {
+    __text_field_t *F = *field;
+    if( F->postings ) {
+      iFramehash.simple.Process( F->postings, __free_posting, NULL, NULL );
+      iFramehash.simple.Destroy( &F->postings, &T->fhdyn );
+    }
+    if( F->docs ) {
+      iFramehash.simple.Process( F->docs, __free_doc, NULL, NULL );
+      iFramehash.simple.Destroy( &F->docs, &T->fhdyn );
+    }
+    iString.Discard( &F->CSTR__key );
+    free( F );
+    *field = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
+static int64_t __free_posting( framehash_processing_context_t * const processor, framehash_cell_t * const cell ) {
+  __text_posting_t *P = (__text_posting_t*)(intptr_t)APTR_AS_INTEGER( cell );
+  free( P->packed );
+  free( P->pending );
+  free( P );
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
+static int64_t __free_doc( framehash_processing_context_t * const processor, framehash_cell_t * const cell ) {
+  __text_doc_t *doc = (__text_doc_t*)(intptr_t)APTR_AS_INTEGER( cell );
+  free( doc );
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static __text_field_t * __get_field( const vgx_TextIndex_t *T, shortid_t keyhash ) {
+  if( T ) {
+    for( int i=0; i<T->n_fields; i++ ) {
+      if( T->fields[i]->keyhash == keyhash ) {
+        return T->fields[i];
+      }
+    }
+  }
+  return NULL;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __compare_term( const void *a, const void *b ) {
+  QWORD ta = ((const __text_term_t*)a)->term;
+  QWORD tb = ((const __text_term_t*)b)->term;
+  return (ta > tb) - (ta < tb);
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __compare_qword( const void *a, const void *b ) {
+  QWORD qa = *(const QWORD*)a;
+  QWORD qb = *(const QWORD*)b;
+  return (qa > qb) - (qa < qb);
+}
+
+
+
+/*******************************************************************//**
+ * Return the plain string value of vertex property, or NULL if the
+ * property does not exist or is not a plain string. Virtual property
+ * values are read from disk into *CSTR__owned which caller must discard.
+ ***********************************************************************
+ */
+static const char * __vertex_text( const vgx_Vertex_t *vertex, shortid_t keyhash, CString_t **CSTR__owned ) {
+  if( vertex->properties == NULL ) {
+    return NULL;
+  }
+  const CString_t *CSTR__text = NULL;
+  framehash_value_t fvalue = 0;
+  switch( iFramehash.simple.GetHash64( vertex->properties, keyhash, &fvalue ) ) {
+  // Virtual property offset
+  case CELL_VALUE_TYPE_UNSIGNED:
+    CSTR__text = *CSTR__owned = _vxvertex_property__read_virtual_property( vertex->graph, (uint64_t)fvalue, NULL, NULL );
+    break;
+  // String
+  case CELL_VALUE_TYPE_OBJECT64:
+    CSTR__text = (const CString_t*)fvalue;
+    break;
+  default:
+    return NULL;
+  }
+  if( CSTR__text == NULL || CStringAttributes( CSTR__text ) != CSTRING_ATTR_NONE ) {
+    return NULL;
+  }
+  return CStringValue( CSTR__text );
+}
+
+
+
+/*******************************************************************//**
+ * Split text into normalized tokens and return their hashes in text
+ * order. Caller owns the returned array.
+ *
+ * Return: Token hash array (NULL if no tokens or error)
+ ***********************************************************************
+ */
+DLL_HIDDEN QWORD * _vxgraph_textindex__tokenize( const char *text, int64_t *n ) {
+  *n = 0;
+  if( text == NULL || _vxeval_parser__normalizer == NULL ) {
+    return NULL;
+  }
+  CTokenizer_vtable_t *iTokenizer = CALLABLE( _vxeval_parser__normalizer );
+  tokenmap_t *tokenmap = iTokenizer->Tokenize( _vxeval_parser__normalizer, (const BYTE*)text, NULL );
+  if( tokenmap == NULL ) {
+    return NULL;
+  }
+  QWORD *hashes = NULL;
+  int32_t ntok = iTokenizer->Count( _vxeval_parser__normalizer, tokenmap );
+  if( ntok > 0 && (hashes = malloc( ntok * sizeof( QWORD ) )) != NULL ) {
+    const BYTE *token;
+    int64_t k = 0;
+    while( k < ntok && (token = iTokenizer->GetToken( _vxeval_parser__normalizer, tokenmap )) != NULL ) {
+      hashes[ k++ ] = hash64( token, strlen( (const char*)token ) );
+    }
+    *n = k;
+  }
+  iTokenizer->DeleteTokenmap( _vxeval_parser__normalizer, &tokenmap );
+  return hashes;
+}
+
+
+
+/*******************************************************************//**
+ * Document record for the vertex text (distinct terms sorted by hash)
+ *
+ * Return: New document record, or NULL if vertex has no text tokens
+ ***********************************************************************
+ */
+static __text_doc_t * __new_doc( const vgx_Vertex_t *vertex, shortid_t keyhash ) {
+  __text_doc_t *doc = NULL;
+  CString_t *CSTR__owned = NULL;
+  int64_t n = 0;
+  QWORD *hashes = _vxgraph_textindex__tokenize( __vertex_text( vertex, keyhash, &CSTR__owned ), &n );
+  iString.Discard( &CSTR__owned );
+  if( hashes ) {
+    qsort( hashes, n, sizeof( QWORD ), __compare_qword );
+    int64_t n_terms = 0;
+    for( int64_t i=0; i<n; i++ ) {
+      if( i == 0 || hashes[i] != hashes[i-1] ) {
+        ++n_terms;
+      }
+    }
+    if( (doc = malloc( sizeof( __text_doc_t ) + n_terms * sizeof( __text_term_t ) )) != NULL ) {
+      doc->length = n;
+      doc->n_terms = 0;
+      for( int64_t i=0; i<n; i++ ) {
+        if( i == 0 || hashes[i] != hashes[i-1] ) {
+          __text_term_t *t = &doc->terms[ doc->n_terms++ ];
+          t->term = hashes[i];
+          t->tf = 1;
+        }
+        else {
+          doc->terms[ doc->n_terms - 1 ].tf++;
+        }
+      }
+    }
+    free( hashes );
+  }
+  return doc;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static bool __equal_docs( const __text_doc_t *a, const __text_doc_t *b ) {
+  if( a->length != b->length || a->n_terms != b->n_terms ) {
+    return false;
+  }
+  return memcmp( a->terms, b->terms, a->n_terms * sizeof( __text_term_t ) ) == 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static BYTE * __write_varint( BYTE *wp, QWORD x ) {
+  while( x >= 0x80 ) {
+    *wp++ = (BYTE)(x | 0x80);
+    x >>= 7;
+  }
+  *wp++ = (BYTE)x;
+  return wp;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static QWORD __read_varint( const BYTE **rp ) {
+  const BYTE *p = *rp;
+  QWORD x = 0;
+  int shift = 0;
+  BYTE b;
+  do {
+    b = *p++;
+    x |= (QWORD)(b & 0x7F) << shift;
+    shift += 7;
+  } while( b & 0x80 );
+  *rp = p;
+  return x;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __cursor_packed_next( __text_cursor_t *C ) {
+  if( C->rp < C->end ) {
+    C->packed_doc += __read_varint( &C->rp );
+    C->packed_tf = (uint32_t)__read_varint( &C->rp );
+    C->packed_valid = true;
+  }
+  else {
+    C->packed_valid = false;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __cursor_init( __text_cursor_t *C, const __text_posting_t *P ) {
+  C->P = P;
+  C->rp = P->packed;
+  C->end = P->packed + P->sz_packed;
+  C->ip = 0;
+  C->packed_doc = 0;
+  C->packed_tf = 0;
+  C->doc = 0;
+  C->tf = 0;
+  __cursor_packed_next( C );
+  C->valid = __cursor_next( C );
+}
+
+
+
+/*******************************************************************//**
+ * Advance cursor to next entry of the merged posting list
+ ***********************************************************************
+ */
+static bool __cursor_next( __text_cursor_t *C ) {
+  const __text_posting_t *P = C->P;
+  for(;;) {
+    // Pending entry comes first or overrides packed entry
+    if( C->ip < P->n_pending && (!C->packed_valid || P->pending[ C->ip ].docid <= C->packed_doc) ) {
+      const __text_entry_t *e = &P->pending[ C->ip++ ];
+      if( C->packed_valid && e->docid == C->packed_doc ) {
+        __cursor_packed_next( C );
+      }
+      // Removed
+      if( e->tf == 0 ) {
+        continue;
+      }
+      C->doc = e->docid;
+      C->tf = e->tf;
+      return C->valid = true;
+    }
+    else if( C->packed_valid ) {
+      C->doc = C->packed_doc;
+      C->tf = C->packed_tf;
+      __cursor_packed_next( C );
+      return C->valid = true;
+    }
+    return C->valid = false;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Advance cursor to first entry at or after target
+ ***********************************************************************
+ */
+static bool __cursor_seek( __text_cursor_t *C, QWORD target ) {
+  while( C->valid && C->doc < target ) {
+    __cursor_next( C );
+  }
+  return C->valid;
+}
+
+
+
+/*******************************************************************//**
+ * Binary search pending entries
+ ***********************************************************************
+ */
+static bool __pending_find( const __text_posting_t *P, QWORD docid, int64_t *pos ) {
+  int64_t lo = 0;
+  int64_t hi = P->n_pending;
+  while( lo < hi ) {
+    int64_t mid = (lo + hi) / 2;
+    if( P->pending[mid].docid < docid ) {
+      lo = mid + 1;
+    }
+    else {
+      hi = mid;
+    }
+  }
+  *pos = lo;
+  return lo < P->n_pending && P->pending[lo].docid == docid;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __pending_insert( __text_posting_t *P, int64_t pos, QWORD docid, uint32_t tf, uint32_t packed ) {
+  if( P->n_pending == P->cap_pending ) {
+    int64_t cap = P->cap_pending ? 2 * P->cap_pending : TEXT_PENDING_MIN;
+    __text_entry_t *resized = realloc( P->pending, cap * sizeof( __text_entry_t ) );
+    if( resized == NULL ) {
+      return -1;
+    }
+    P->pending = resized;
+    P->cap_pending = cap;
+  }
+  __text_entry_t *e = &P->pending[pos];
+  memmove( e + 1, e, (P->n_pending - pos) * sizeof( __text_entry_t ) );
+  e->docid = docid;
+  e->tf = tf;
+  e->packed = packed;
+  P->n_pending++;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Merge pending entries into the packed list
+ ***********************************************************************
+ */
+static int __posting_pack( __text_posting_t *P ) {
+  // Worst case 10 bytes docid delta and 5 bytes tf
+  int64_t cap = P->n_docs * 15 + 1;
+  BYTE *packed = malloc( cap );
+  if( packed == NULL ) {
+    return -1;
+  }
+  BYTE *wp = packed;
+  QWORD prev = 0;
+  int64_t n = 0;
+  __text_cursor_t C;
+  for( __cursor_init( &C, P ); C.valid; __cursor_next( &C ) ) {
+    wp = __write_varint( wp, C.doc - prev );
+    wp = __write_varint( wp, C.tf );
+    prev = C.doc;
+    ++n;
+  }
+  free( P->packed );
+  P->packed = packed;
+  P->cap_packed = cap;
+  P->sz_packed = wp - packed;
+  P->n_packed = n;
+  P->n_pending = 0;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Add vertex not currently in posting list
+ ***********************************************************************
+ */
+static int __posting_add( __text_posting_t *P, QWORD docid, int64_t tf ) {
+  int64_t pos;
+  uint32_t tf32 = tf > UINT_MAX ? UINT_MAX : (uint32_t)tf;
+  // Re-add vertex hidden in packed list
+  if( __pending_find( P, docid, &pos ) ) {
+    P->pending[pos].tf = tf32;
+  }
+  else if( __pending_insert( P, pos, docid, tf32, 0 ) < 0 ) {
+    return -1;
+  }
+  P->n_docs++;
+  if( P->n_pending > TEXT_PENDING_MIN + P->n_packed / TEXT_PENDING_FRACTION ) {
+    return __posting_pack( P );
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Remove vertex currently in posting list
+ ***********************************************************************
+ */
+static int __posting_remove( __text_posting_t *P, QWORD docid ) {
+  int64_t pos;
+  if( __pending_find( P, docid, &pos ) ) {
+    __text_entry_t *e = &P->pending[pos];
+    // Hide packed entry
+    if( e->packed ) {
+      e->tf = 0;
+    }
+    // Forget pending entry
+    else {
+      memmove( e, e + 1, (P->n_pending - pos - 1) * sizeof( __text_entry_t ) );
+      P->n_pending--;
+    }
+  }
+  // Hide packed entry
+  else if( __pending_insert( P, pos, docid, 0, 1 ) < 0 ) {
+    return -1;
+  }
+  P->n_docs--;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  1 : Vertex added
+ *         -1 : Error
+ ***********************************************************************
+ */
+static int __field_add_doc_CS( vgx_TextIndex_t *T, __text_field_t *F, vgx_Vertex_t *vertex, __text_doc_t *doc ) {
+  QWORD docid = (QWORD)vertex;
+  if( iFramehash.simple.SetInt( &F->docs, &T->fhdyn, docid, (int64_t)doc ) < 0 ) {
+    free( doc );
+    return -1;
+  }
+  for( int64_t i=0; i<doc->n_terms; i++ ) {
+    const __text_term_t *t = &doc->terms[i];
+    __text_posting_t *P = NULL;
+    int64_t addr = 0;
+    if( iFramehash.simple.GetInt( F->postings, &T->fhdyn, t->term, &addr ) == 1 ) {
+      P = (__text_posting_t*)addr;
+    }
+    else {
+      if( (P = calloc( 1, sizeof( __text_posting_t ) )) == NULL ) {
+        return -1;
+      }
+      if( iFramehash.simple.SetInt( &F->postings, &T->fhdyn, t->term, (int64_t)P ) < 0 ) {
+        free( P );
+        return -1;
+      }
+    }
+    if( __posting_add( P, docid, t->tf ) < 0 ) {
+      return -1;
+    }
+  }
+  F->n_docs++;
+  F->n_tokens += doc->length;
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  1 : Vertex removed
+ *          0 : Vertex not indexed
+ ***********************************************************************
+ */
+static int __field_remove_doc_CS( vgx_TextIndex_t *T, __text_field_t *F, vgx_Vertex_t *vertex ) {
+  QWORD docid = (QWORD)vertex;
+  int64_t addr = 0;
+  if( iFramehash.simple.GetInt( F->docs, &T->fhdyn, docid, &addr ) != 1 ) {
+    return 0;
+  }
+  iFramehash.simple.DelInt( &F->docs, &T->fhdyn, docid );
+  __text_doc_t *doc = (__text_doc_t*)addr;
+  for( int64_t i=0; i<doc->n_terms; i++ ) {
+    QWORD term = doc->terms[i].term;
+    int64_t paddr = 0;
+    if( iFramehash.simple.GetInt( F->postings, &T->fhdyn, term, &paddr ) == 1 ) {
+      __text_posting_t *P = (__text_posting_t*)paddr;
+      if( __posting_remove( P, docid ) < 0 ) {
+        CRITICAL( 0xE78, "Text index posting list out of memory" );
+      }
+      // Last vertex with term
+      else if( P->n_docs <= 0 ) {
+        iFramehash.simple.DelInt( &F->postings, &T->fhdyn, term );
+        free( P->packed );
+        free( P->pending );
+        free( P );
+      }
+    }
+  }
+  F->n_docs--;
+  F->n_tokens -= doc->length;
+  free( doc );
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ * Index vertex under its current text, or remove it from the index if
+ * it no longer has text.
+ *
+ * Return:  1 : Vertex updated, inserted or removed
+ *          0 : No change
+ *         -1 : Error
+ ***********************************************************************
+ */
+static int __field_update_CS( vgx_TextIndex_t *T, __text_field_t *F, vgx_Vertex_t *vertex ) {
+  __text_doc_t *doc = __new_doc( vertex, F->keyhash );
+  int64_t addr = 0;
+  if( iFramehash.simple.GetInt( F->docs, &T->fhdyn, (QWORD)vertex, &addr ) == 1 ) {
+    // Same text, nothing to do
+    if( doc && __equal_docs( doc, (__text_doc_t*)addr ) ) {
+      free( doc );
+      return 0;
+    }
+    __field_remove_doc_CS( T, F, vertex );
+  }
+  else if( doc == NULL ) {
+    return 0;
+  }
+  if( doc ) {
+    return __field_add_doc_CS( T, F, vertex, doc );
+  }
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __cxmalloc_textindex_add_vertex_CS( cxmalloc_object_processing_context_t *context, vgx_Vertex_t *vertex ) {
+  if( vertex && __vertex_is_manifestation_null( vertex ) == false && __vertex_is_indexed_main( vertex ) ) {
+    vgx_TextIndex_t *T = (vgx_TextIndex_t*)context->input;
+    __text_field_t *F = (__text_field_t*)context->output;
+    if( __field_update_CS( T, F, vertex ) < 0 ) {
+      context->completed = true;
+      context->error = true;
+      return -1;
+    }
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int64_t __field_populate_CS( vgx_Graph_t *self, vgx_TextIndex_t *T, __text_field_t *F ) {
+  cxmalloc_object_processing_context_t populate = {0};
+  populate.object_class = COMLIB_CLASS( vgx_Vertex_t );
+  populate.process_object = (f_cxmalloc_object_processor)__cxmalloc_textindex_add_vertex_CS;
+  populate.input = T;
+  populate.output = F;
+  CALLABLE( self->vertex_allocator )->ProcessObjects( self->vertex_allocator, &populate );
+  if( populate.error ) {
+    return -1;
+  }
+  return F->n_docs;
+}
+
+
+
+/*******************************************************************//**
+ * Declare a text index over string property key and populate it with
+ * all vertices. Any previous text index for the same key is replaced.
+ *
+ * Return: Number of vertices indexed, or -1 on error
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_textindex__create_OPEN( vgx_Graph_t *self, const char *key, CString_t **CSTR__error ) {
+  int64_t n_indexed = -1;
+  __text_field_t *F = NULL;
+
+  if( key == NULL || *key == '\0' ) {
+    __set_error_string( CSTR__error, "property key required" );
+    return -1;
+  }
+
+  if( !_vxenum__is_valid_storable_key( key ) ) {
+    __format_error_string( CSTR__error, "invalid property key: '%s'", key );
+    return -1;
+  }
+
+  GRAPH_LOCK( self ) {
+    if( !_vgx_is_writable_CS( &self->readonly ) ) {
+      __set_error_string( CSTR__error, "graph is readonly" );
+    }
+    else {
+      BEGIN_DISALLOW_READONLY_CS( &self->readonly ) {
+        vgx_ExecutionTimingBudget_t timing_budget = _vgx_get_graph_execution_timing_budget( self, 30000 );
+        // Hold until no other threads have writable vertices, since we read their properties
+        BEGIN_STATIC_GRAPH_CS( self, &timing_budget ) {
+          vgx_TextIndex_t *T = self->textindex;
+          if( T == NULL && (T = __new_textindex()) == NULL ) {
+            __set_error_string( CSTR__error, "out of memory" );
+          }
+          else if( (F = __new_field( self, T, key )) == NULL ) {
+            __set_error_string( CSTR__error, "out of memory" );
+          }
+          else if( (n_indexed = __field_populate_CS( self, T, F )) < 0 ) {
+            __set_error_string( CSTR__error, "internal error" );
+            __delete_field( T, &F );
+          }
+          else {
+            // Replace any previous field with same key
+            int i = 0;
+            while( i < T->n_fields && T->fields[i]->keyhash != F->keyhash ) {
+              ++i;
+            }
+            if( i < T->n_fields ) {
+              __delete_field( T, &T->fields[i] );
+              T->fields[i] = F;
+            }
+            else if( T->n_fields < VGX_TEXT_INDEX_MAX_FIELDS ) {
+              T->fields[ T->n_fields++ ] = F;
+            }
+            else {
+              __format_error_string( CSTR__error, "too many text indexes (max %d)", VGX_TEXT_INDEX_MAX_FIELDS );
+              __delete_field( T, &F );
+              n_indexed = -1;
+            }
+          }
+          // Install new index or discard unused
+          if( T && T != self->textindex ) {
+            if( T->n_fields > 0 ) {
+              self->textindex = T;
+            }
+            else {
+              __delete_textindex( &T );
+            }
+          }
+        } END_STATIC_GRAPH_CS;
+        if( timing_budget.reason != VGX_ACCESS_REASON_NONE && n_indexed < 0 ) {
+          __set_error_string( CSTR__error, "timeout waiting for writable vertices to be released" );
+        }
+      } END_DISALLOW_READONLY_CS;
+    }
+  } GRAPH_RELEASE;
+
+  return n_indexed;
+}
+
+
+
+/*******************************************************************//**
+ * Drop text index for key, or all text indexes if key is NULL
+ *
+ * Return:  1 : Text index dropped
+ *          0 : No text index
+ *         -1 : Graph is readonly
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_textindex__drop_OPEN( vgx_Graph_t *self, const char *key ) {
+  int ret = 0;
+  GRAPH_LOCK( self ) {
+    vgx_TextIndex_t *T = self->textindex;
+    // Readonly queries use the index without CS
+    if( !_vgx_is_writable_CS( &self->readonly ) ) {
+      ret = -1;
+    }
+    else if( T ) {
+      if( key == NULL ) {
+        ret = 1;
+      }
+      else {
+        shortid_t keyhash = CharsHash64( key );
+        for( int i=0; i<T->n_fields; i++ ) {
+          if( T->fields[i]->keyhash == keyhash ) {
+            __delete_field( T, &T->fields[i] );
+            T->fields[i] = T->fields[ --T->n_fields ];
+            T->fields[ T->n_fields ] = NULL;
+            ret = 1;
+            break;
+          }
+        }
+      }
+      if( key == NULL || T->n_fields == 0 ) {
+        __delete_textindex( &self->textindex );
+      }
+    }
+  } GRAPH_RELEASE;
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void _vxgraph_textindex__destroy_CS( vgx_Graph_t *self ) {
+  __delete_textindex( &self->textindex );
+}
+
+
+
+/*******************************************************************//**
+ * Repopulate text index from scratch (after bulk vertex removal)
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_textindex__rebuild_CS( vgx_Graph_t *self ) {
+  vgx_TextIndex_t *T = self->textindex;
+  if( T == NULL ) {
+    return 0;
+  }
+  int64_t n_indexed = 0;
+  vgx_TextIndex_t *R = __new_textindex();
+  if( R ) {
+    for( int i=0; i<T->n_fields; i++ ) {
+      __text_field_t *F = __new_field( self, R, CStringValue( T->fields[i]->CSTR__key ) );
+      if( F == NULL ) {
+        n_indexed = -1;
+        break;
+      }
+      R->fields[ R->n_fields++ ] = F;
+      if( __field_populate_CS( self, R, F ) < 0 ) {
+        n_indexed = -1;
+        break;
+      }
+      n_indexed += F->n_docs;
+    }
+  }
+  if( R == NULL || n_indexed < 0 ) {
+    // Never leave a stale index behind
+    __delete_textindex( &R );
+    __delete_textindex( &self->textindex );
+    CRITICAL( 0xE76, "Text index dropped after failed rebuild" );
+    return -1;
+  }
+  __delete_textindex( &self->textindex );
+  self->textindex = R;
+  return n_indexed;
+}
+
+
+
+/*******************************************************************//**
+ * Update the vertex text in the text index after a property change.
+ * keyhash 0 means any property may have changed.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_textindex__update_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK, shortid_t keyhash ) {
+  vgx_TextIndex_t *T = self->textindex;
+  if( T == NULL ) {
+    return 0;
+  }
+  // Only vertices in the main index are visible to queries
+  if( !__vertex_is_indexed_main( vertex_LCK ) ) {
+    return 0;
+  }
+  int ret = 0;
+  for( int i=0; i<T->n_fields && ret >= 0; i++ ) {
+    __text_field_t *F = T->fields[i];
+    if( keyhash == 0 || keyhash == F->keyhash ) {
+      ret = __field_update_CS( T, F, vertex_LCK );
+    }
+  }
+  if( ret < 0 ) {
+    const char *prefix = CALLABLE( vertex_LCK )->IDPrefix( vertex_LCK );
+    REASON( 0xE77, "Failed to update text index for vertex '%s'", prefix );
+  }
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_textindex__remove_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK ) {
+  vgx_TextIndex_t *T = self->textindex;
+  int n_removed = 0;
+  if( T ) {
+    for( int i=0; i<T->n_fields; i++ ) {
+      n_removed += __field_remove_doc_CS( T, T->fields[i], vertex_LCK );
+    }
+  }
+  return n_removed;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Return:  0 : Text index exists for key, keyhash assigned
+ *         -1 : No text index for key
+ ***********************************************************************
+ */
+DLL_HIDDEN int _vxgraph_textindex__get_keyhash_OPEN( vgx_Graph_t *self, const CString_t *CSTR__key, shortid_t *keyhash ) {
+  int ret = -1;
+  shortid_t h = CStringHash64( CSTR__key );
+  GRAPH_LOCK( self ) {
+    if( __get_field( self->textindex, h ) ) {
+      *keyhash = h;
+      ret = 0;
+    }
+  } GRAPH_RELEASE;
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Match vertex text against probe terms, ignoring probe sign
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN bool _vxgraph_textindex__match_vertex( const vgx_Vertex_t *vertex, const vgx_text_probe_t *text_probe ) {
+  if( text_probe->n_terms == 0 ) {
+    return false;
+  }
+  CString_t *CSTR__owned = NULL;
+  int64_t n = 0;
+  QWORD *hashes = _vxgraph_textindex__tokenize( __vertex_text( vertex, text_probe->keyhash, &CSTR__owned ), &n );
+  iString.Discard( &CSTR__owned );
+  if( hashes == NULL ) {
+    return false;
+  }
+
+  bool match = false;
+  const QWORD *terms = text_probe->terms;
+  int n_terms = text_probe->n_terms;
+
+  // Consecutive tokens
+  if( text_probe->mode == VGX_TEXT_MATCH_PHRASE ) {
+    for( int64_t i=0; i + n_terms <= n && !match; i++ ) {
+      int k = 0;
+      while( k < n_terms && hashes[i+k] == terms[k] ) {
+        ++k;
+      }
+      match = k == n_terms;
+    }
+  }
+  // All or any token
+  else {
+    qsort( hashes, n, sizeof( QWORD ), __compare_qword );
+    bool any = text_probe->mode == VGX_TEXT_MATCH_ANY;
+    match = !any;
+    for( int k=0; k<n_terms; k++ ) {
+      bool found = bsearch( &terms[k], hashes, n, sizeof( QWORD ), __compare_qword ) != NULL;
+      if( found == any ) {
+        match = any;
+        break;
+      }
+    }
+  }
+
+  free( hashes );
+  return match;
+}
+
+
+
+/*******************************************************************//**
+ * Pass every indexed vertex with the probe terms (all terms, or any
+ * term) to scan_context->process_object, in vertex address order.
+ * Candidates must still be checked by the vertex filter (e.g. phrase.)
+ *
+ * Return: Number of candidates processed, or -1 if the text index cannot
+ *         serve the probe (caller must scan)
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_textindex__process_candidates_ROG_or_CS( vgx_Graph_t *self, const vgx_text_probe_t *text_probe, cxmalloc_object_processing_context_t *scan_context ) {
+  const vgx_TextIndex_t *T = self->textindex;
+  const __text_field_t *F = __get_field( T, text_probe->keyhash );
+  if( F == NULL || !text_probe->positive ) {
+    return -1;
+  }
+
+  bool any = text_probe->mode == VGX_TEXT_MATCH_ANY;
+
+  // Cursors for distinct probe terms
+  __text_cursor_t cursors[ VGX_TEXT_QUERY_MAX_TERMS ];
+  int n_cursors = 0;
+  for( int k=0; k<text_probe->n_terms; k++ ) {
+    QWORD term = text_probe->terms[k];
+    bool dup = false;
+    for( int j=0; j<k && !dup; j++ ) {
+      dup = text_probe->terms[j] == term;
+    }
+    if( dup ) {
+      continue;
+    }
+    int64_t addr = 0;
+    if( iFramehash.simple.GetInt( F->postings, (framehash_dynamic_t*)&T->fhdyn, term, &addr ) == 1 ) {
+      __cursor_init( &cursors[ n_cursors++ ], (const __text_posting_t*)addr );
+    }
+    // No vertex has all terms
+    else if( !any ) {
+      return 0;
+    }
+  }
+
+  for(;;) {
+    QWORD doc = 0;
+    if( any ) {
+      // Lowest vertex among all terms
+      bool valid = false;
+      for( int i=0; i<n_cursors; i++ ) {
+        if( cursors[i].valid && (!valid || cursors[i].doc < doc) ) {
+          doc = cursors[i].doc;
+          valid = true;
+        }
+      }
+      if( !valid ) {
+        break;
+      }
+      for( int i=0; i<n_cursors; i++ ) {
+        if( cursors[i].valid && cursors[i].doc == doc ) {
+          __cursor_next( &cursors[i] );
+        }
+      }
+    }
+    else {
+      if( n_cursors == 0 || !cursors[0].valid ) {
+        break;
+      }
+      // Leapfrog until all terms agree on a vertex
+      doc = cursors[0].doc;
+      int agree = 1;
+      int i = 1;
+      while( agree < n_cursors ) {
+        if( !__cursor_seek( &cursors[i], doc ) ) {
+          return scan_context->n_objects_processed;
+        }
+        if( cursors[i].doc == doc ) {
+          ++agree;
+        }
+        else {
+          doc = cursors[i].doc;
+          agree = 1;
+        }
+        i = (i + 1) % n_cursors;
+      }
+      for( int c=0; c<n_cursors; c++ ) {
+        __cursor_seek( &cursors[c], doc );
+        __cursor_next( &cursors[c] );
+      }
+    }
+
+    scan_context->process_object( scan_context, COMLIB_OBJECT( (vgx_Vertex_t*)doc ) );
+    scan_context->n_objects_processed++;
+    if( scan_context->completed ) {
+      break;
+    }
+  }
+
+  return scan_context->n_objects_processed;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void _vxgraph_textindex__delete_scorer( vgx_TextScorer_t **scorer ) {
+  if( scorer && *scorer ) {
+    free( *scorer );
+    *scorer = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * BM25 score of vertex text in property key for query terms.
+ *
+ * IDF and average document length are taken from the text index when
+ * the scorer is first prepared for key and terms, and kept in *scorer
+ * for subsequent calls with the same key and terms. Score is 0.0 if
+ * key has no text index.
+ ***********************************************************************
+ */
+DLL_HIDDEN double _vxgraph_textindex__bm25( vgx_Graph_t *self, vgx_TextScorer_t **scorer, const CString_t *CSTR__key, const CString_t *CSTR__terms, const vgx_Vertex_t *vertex ) {
+  QWORD signature = CStringHash64( CSTR__key ) ^ (CStringHash64( CSTR__terms ) * 0x9E3779B97F4A7C15ULL);
+  vgx_TextScorer_t *S = *scorer;
+
+  // Prepare scorer for key and terms
+  if( S == NULL || S->signature != signature ) {
+    if( S == NULL && (S = *scorer = calloc( 1, sizeof( vgx_TextScorer_t ) )) == NULL ) {
+      return 0.0;
+    }
+    int64_t n = 0;
+    QWORD *hashes = _vxgraph_textindex__tokenize( CStringValue( CSTR__terms ), &n );
+    S->signature = signature;
+    S->keyhash = CStringHash64( CSTR__key );
+    S->n_terms = 0;
+    S->avgdl = 1.0;
+    GRAPH_LOCK( self ) {
+      const vgx_TextIndex_t *T = self->textindex;
+      const __text_field_t *F = __get_field( T, S->keyhash );
+      if( F && F->n_docs > 0 ) {
+        double N = (double)F->n_docs;
+        S->avgdl = (double)F->n_tokens / N;
+        for( int64_t i=0; i<n && S->n_terms < VGX_TEXT_QUERY_MAX_TERMS; i++ ) {
+          int64_t addr = 0;
+          double df = 0.0;
+          if( iFramehash.simple.GetInt( F->postings, (framehash_dynamic_t*)&T->fhdyn, hashes[i], &addr ) == 1 ) {
+            df = (double)((const __text_posting_t*)addr)->n_docs;
+          }
+          S->terms[ S->n_terms ] = hashes[i];
+          S->idf[ S->n_terms ] = log( 1.0 + (N - df + 0.5) / (df + 0.5) );
+          S->n_terms++;
+        }
+      }
+    } GRAPH_RELEASE;
+    free( hashes );
+  }
+
+  if( S->n_terms == 0 ) {
+    return 0.0;
+  }
+
+  CString_t *CSTR__owned = NULL;
+  int64_t dl = 0;
+  QWORD *hashes = _vxgraph_textindex__tokenize( __vertex_text( vertex, S->keyhash, &CSTR__owned ), &dl );
+  iString.Discard( &CSTR__owned );
+  if( hashes == NULL ) {
+    return 0.0;
+  }
+
+  double norm = TEXT_BM25_K1 * (1.0 - TEXT_BM25_B + TEXT_BM25_B * (double)dl / S->avgdl);
+  double score = 0.0;
+  for( int k=0; k<S->n_terms; k++ ) {
+    int64_t tf = 0;
+    for( int64_t i=0; i<dl; i++ ) {
+      tf += hashes[i] == S->terms[k];
+    }
+    if( tf > 0 ) {
+      score += S->idf[k] * (tf * (TEXT_BM25_K1 + 1.0)) / (tf + norm);
+    }
+  }
+  free( hashes );
+  return score;
+}
@@ -50,6 +50,8 @@ static int64_t __cxmalloc_erase_vertex_CS_WL_NT( cxmalloc_object_processing_cont
 static int64_t __cxmalloc_unlock_vertex_CS_NT( cxmalloc_object_processing_context_t *decref_context, vgx_Vertex_t *vertex );
 static int64_t __cxmalloc_count_vertex_properties_ROG( cxmalloc_object_processing_context_t *counter, vgx_Vertex_t *vertex );
 static int64_t __cxmalloc_count_vertex_tmx_ROG( cxmalloc_object_processing_context_t *counter, vgx_Vertex_t *vertex );
+static int64_t __cxmalloc_freeze_vertex_arcs_CS( cxmalloc_object_processing_context_t *freezer, vgx_Vertex_t *vertex );
+static int64_t __cxmalloc_thaw_vertex_arcs_CS( cxmalloc_object_processing_context_t *thawer, vgx_Vertex_t *vertex );
 static int64_t __initialize_vertices_CS_NT( vgx_Graph_t *self, vgx_vertex_type_t vxtype, bool *virtual_remain );
 static int64_t __FH_unindex_main_CS_NT( framehash_processing_context_t * const processor, framehash_cell_t * const fh_cell );
 static int64_t __discard_index_CS_NT( vgx_Graph_t *self, vgx_VertexTypeEnumeration_t vxtype );
@@ -873,6 +875,89 @@ static int64_t __cxmalloc_count_vertex_tmx_ROG( cxmalloc_object_processing_conte
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+typedef struct s___freeze_arcs_output_t {
+  int64_t n_bytes;
+  int64_t n_oversized;
+} __freeze_arcs_output_t;
+
+
+
+/*******************************************************************//**
+ * Replace large arc arrays of an unlocked vertex with frozen arrays.
+ * Vertices currently held by other threads are skipped. Arrays too
+ * large for frozen form are left unchanged and counted as oversized.
+ *
+ ***********************************************************************
+ */
+static int64_t __cxmalloc_freeze_vertex_arcs_CS( cxmalloc_object_processing_context_t *freezer, vgx_Vertex_t *vertex ) {
+  int64_t ret = 0;
+  if( vertex && !__vertex_is_defunct( vertex ) && __vertex_is_unlocked( vertex ) ) {
+    vgx_Graph_t *graph = vertex->graph;
+    int64_t min_degree = *(int64_t*)freezer->input;
+    vgx_ArcVector_cell_t *arcvectors[] = { &vertex->outarcs, &vertex->inarcs };
+    vgx_Vertex_t *vertex_WL = __vertex_lock_writable_CS( vertex );
+    Vertex_INCREF_WL( vertex_WL );
+    for( int i=0; i<2 && ret >= 0; i++ ) {
+      vgx_ArcVector_cell_t *V = arcvectors[i];
+      if( iarcvector.CellType( V ) == VGX_ARCVECTOR_ARRAY_OF_ARCS && iarcvector.Degree( V ) >= min_degree ) {
+        __freeze_arcs_output_t *output = (__freeze_arcs_output_t*)freezer->output;
+        int frozen = iarcvector.Freeze( &graph->arcvector_fhdyn, V );
+        if( frozen < 0 ) {
+          ret = -1;
+        }
+        else if( frozen == 1 ) {
+          output->n_bytes += iarcvector.FrozenBytes( V );
+          ret++;
+        }
+        else if( frozen == 2 ) {
+          output->n_oversized++;
+        }
+      }
+    }
+    __vertex_unlock_writable_CS( vertex_WL );
+    Vertex_DECREF_WL( vertex_WL );
+  }
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Restore all frozen arc arrays of an unlocked vertex to mutable form.
+ * Vertices currently held by other threads are skipped.
+ *
+ ***********************************************************************
+ */
+SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
+static int64_t __cxmalloc_thaw_vertex_arcs_CS( cxmalloc_object_processing_context_t *thawer, vgx_Vertex_t *vertex ) {
+  int64_t ret = 0;
+  if( vertex && !__vertex_is_defunct( vertex ) && __vertex_is_unlocked( vertex ) ) {
+    vgx_Graph_t *graph = vertex->graph;
+    vgx_ArcVector_cell_t *arcvectors[] = { &vertex->outarcs, &vertex->inarcs };
+    vgx_Vertex_t *vertex_WL = __vertex_lock_writable_CS( vertex );
+    Vertex_INCREF_WL( vertex_WL );
+    for( int i=0; i<2 && ret >= 0; i++ ) {
+      int thawed = iarcvector.Thaw( &graph->arcvector_fhdyn, arcvectors[i] );
+      if( thawed < 0 ) {
+        ret = -1;
+      }
+      else {
+        ret += thawed;
+      }
+    }
+    __vertex_unlock_writable_CS( vertex_WL );
+    Vertex_DECREF_WL( vertex_WL );
+  }
+  return ret;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1198,6 +1283,9 @@ DLL_HIDDEN int _vxgraph_vxtable__index_vertex_CS_WL( vgx_Graph_t *self, vgx_Vert
       indexed++;
       // Success, graph order +1
       IncGraphOrder( self );
+      // Vertex may already have a position or text
+      _vxgraph_geoindex__update_vertex_CS( self, vertex_WL, 0 );
+      _vxgraph_textindex__update_vertex_CS( self, vertex_WL, 0 );
     }
     // Error, roll back
     else{
@@ -1269,6 +1357,8 @@ DLL_HIDDEN int _vxgraph_vxtable__unindex_vertex_CS_WL( vgx_Graph_t *self, vgx_Ve
   // Remove vertex from generic index
   if( __remove_vertex_from_index_CS_WL( self, self->vxtable, vertex_WL, VERTEX_TYPE_ENUMERATION_NONE ) == 1 ) {
     __vertex_clear_indexed_main( vertex_WL );
+    _vxgraph_geoindex__remove_vertex_CS( self, vertex_WL );
+    _vxgraph_textindex__remove_vertex_CS( self, vertex_WL );
     unindexed++;
     // Remove vertex from type index
     vgx_vertex_type_t vertex_type = vertex_WL->descriptor.type.enumeration;
@@ -1525,6 +1615,8 @@ DLL_HIDDEN int64_t _vxgraph_vxtable__collect_items_ROG_or_CSNOWL( vgx_Graph_t *s
   int64_t n_collected = 0;
   framehash_t *index = NULL;
   const objectid_t *obid = NULL;
+  const vgx_geo_probe_t *geo_probe = NULL;
+  const vgx_text_probe_t *text_probe = NULL;
 
   // If graph is WRITABLE at this point no writable vertices exist (other than any writable
   // vertices held by current thread) It is safe to proceed with vertex scan since we are in
@@ -1537,13 +1629,21 @@ DLL_HIDDEN int64_t _vxgraph_vxtable__collect_items_ROG_or_CSNOWL( vgx_Graph_t *s
       if( filter->type != VGX_VERTEX_FILTER_TYPE_PASS ) {
         vgx_vertex_probe_t *probe = ((vgx_GenericVertexFilter_context_t*)filter)->vertex_probe;
         if( probe ) {
+          // Use geo index to produce candidates if vertex must be within a radius
+          if( filter->positive_match && probe->advanced.geo_probe && probe->advanced.geo_probe->positive ) {
+            geo_probe = probe->advanced.geo_probe;
+          }
+          // Use text index to produce candidates if vertex must contain terms
+          if( filter->positive_match && probe->advanced.text_probe && probe->advanced.text_probe->positive ) {
+            text_probe = probe->advanced.text_probe;
+          }
           // Try to use a specific index if vertex type is part of the filter
           index = __select_index( self, probe->vertex_type );
           if( index == NULL ) {
             XBREAK;
           }
-          // Does probe request a specific vertex?
-          if( (probe->spec & _VERTEX_PROBE_ID_MASK) == (_VERTEX_PROBE_ID_ENA | _VERTEX_PROBE_ID_EQU) ) {
+          // Does probe request a specific vertex? (Not when pagerank produces the candidates)
+          if( search->pagerank == NULL && (probe->spec & _VERTEX_PROBE_ID_MASK) == (_VERTEX_PROBE_ID_ENA | _VERTEX_PROBE_ID_EQU) ) {
             if( probe->CSTR__idlist && iString.List.Size( probe->CSTR__idlist ) == 1 ) {
               obid = CStringObid( iString.List.GetItem( probe->CSTR__idlist, 0 ) );
             }
@@ -1646,8 +1746,26 @@ DLL_HIDDEN int64_t _vxgraph_vxtable__collect_items_ROG_or_CSNOWL( vgx_Graph_t *s
 
       // Collect vertices
       if( search->collector.mode == VGX_COLLECTOR_MODE_COLLECT_VERTICES ) {
+        cxmalloc_object_processing_context_t candidate_context = {0};
+        candidate_context.process_object = (f_cxmalloc_object_processor)__cxmalloc_collect_vertex_ROG_or_CSNOWL;
+        candidate_context.filter = &control;
+        candidate_context.output = search->collector.vertex;
+        // Visit vertices scored by personalized pagerank
+        if( search->pagerank ) {
+          if( _vxgraph_pagerank__process_candidates_ROG_or_CS( self, search->pagerank, search->timing_budget, &candidate_context, &search->CSTR__error ) < 0 || candidate_context.error ) {
+            return -1;
+          }
+        }
+        // Visit vertices in geo cells overlapping the probe radius, or vertices in the posting lists of probe terms
+        else if( (geo_probe && _vxgraph_geoindex__process_candidates_ROG_or_CS( self, geo_probe, &candidate_context ) >= 0) ||
+            (text_probe && _vxgraph_textindex__process_candidates_ROG_or_CS( self, text_probe, &candidate_context ) >= 0) )
+        {
+          if( candidate_context.error ) {
+            return -1;
+          }
+        }
         // Scan Vertex Allocator
-        if( allocator_scan ) {
+        else if( allocator_scan ) {
           cxmalloc_object_processing_context_t scan_context = {0};
           scan_context.object_class = COMLIB_CLASS( vgx_Vertex_t );
           if( random ) {
@@ -1678,8 +1796,20 @@ DLL_HIDDEN int64_t _vxgraph_vxtable__collect_items_ROG_or_CSNOWL( vgx_Graph_t *s
       else if( search->collector.mode == VGX_COLLECTOR_MODE_COLLECT_ARCS ) {
         vgx_vertex_probe_t *probe = ((vgx_GenericVertexFilter_context_t*)filter)->vertex_probe;
         if( probe->advanced.next.neighborhood_probe ) {
+          cxmalloc_object_processing_context_t candidate_context = {0};
+          candidate_context.process_object = (f_cxmalloc_object_processor)__cxmalloc_collect_outarcs_ROG_or_CSNOWL;
+          candidate_context.filter = &control;
+          candidate_context.output = search->collector.arc;
+          // Visit vertices in geo cells overlapping the probe radius, or vertices in the posting lists of probe terms
+          if( (geo_probe && _vxgraph_geoindex__process_candidates_ROG_or_CS( self, geo_probe, &candidate_context ) >= 0) ||
+              (text_probe && _vxgraph_textindex__process_candidates_ROG_or_CS( self, text_probe, &candidate_context ) >= 0) )
+          {
+            if( candidate_context.error ) {
+              return -1;
+            }
+          }
           // Scan Vertex Allocator
-          if( allocator_scan ) {
+          else if( allocator_scan ) {
             cxmalloc_object_processing_context_t scan_context = {0};
             scan_context.object_class = COMLIB_CLASS( vgx_Vertex_t );
             scan_context.process_object = (f_cxmalloc_object_processor)__cxmalloc_collect_outarcs_ROG_or_CSNOWL;
@@ -1764,6 +1894,77 @@ DLL_HIDDEN int64_t _vxgraph_vxtable__count_vertex_tmx_ROG( vgx_Graph_t *self ) {
 
 
 
+/*******************************************************************//**
+ * Freeze all arc arrays with at least min_degree arcs into the compact
+ * read-only encoding. Returns the number of arc arrays frozen, or -1 on
+ * error. The optional ret_bytes receives the total frozen size.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_vxtable__freeze_arcs_OPEN( vgx_Graph_t *self, int64_t min_degree, int64_t *ret_bytes, int64_t *ret_oversized ) {
+  int64_t n_frozen = 0;
+  __freeze_arcs_output_t output = {0};
+  if( min_degree < 2 ) {
+    min_degree = 2;
+  }
+  GRAPH_LOCK( self ) {
+    if( !CALLABLE( self )->advanced->IsGraphReadonly( self ) ) {
+      cxmalloc_object_processing_context_t freezer = {0};
+      freezer.input = &min_degree;
+      freezer.output = &output;
+      freezer.process_object = (f_cxmalloc_object_processor)__cxmalloc_freeze_vertex_arcs_CS;
+      freezer.object_class = COMLIB_CLASS( vgx_Vertex_t );
+      if( CALLABLE( self->vertex_allocator )->ProcessObjects( self->vertex_allocator, &freezer ) < 0 ) {
+        n_frozen = -1;
+      }
+      else {
+        n_frozen = freezer.n_objects_active;
+      }
+    }
+    else {
+      n_frozen = -1;
+    }
+  } GRAPH_RELEASE;
+  if( ret_bytes ) {
+    *ret_bytes = output.n_bytes;
+  }
+  if( ret_oversized ) {
+    *ret_oversized = output.n_oversized;
+  }
+  return n_frozen;
+}
+
+
+
+/*******************************************************************//**
+ * Thaw all frozen arc arrays back to mutable form. Returns the number
+ * of arc arrays thawed, or -1 on error.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int64_t _vxgraph_vxtable__thaw_arcs_OPEN( vgx_Graph_t *self ) {
+  int64_t n_thawed = 0;
+  GRAPH_LOCK( self ) {
+    if( !CALLABLE( self )->advanced->IsGraphReadonly( self ) ) {
+      cxmalloc_object_processing_context_t thawer = {0};
+      thawer.process_object = (f_cxmalloc_object_processor)__cxmalloc_thaw_vertex_arcs_CS;
+      thawer.object_class = COMLIB_CLASS( vgx_Vertex_t );
+      if( CALLABLE( self->vertex_allocator )->ProcessObjects( self->vertex_allocator, &thawer ) < 0 ) {
+        n_thawed = -1;
+      }
+      else {
+        n_thawed = thawer.n_objects_active;
+      }
+    }
+    else {
+      n_thawed = -1;
+    }
+  } GRAPH_RELEASE;
+  return n_thawed;
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -2013,7 +2214,9 @@ DLL_HIDDEN int64_t _vxgraph_vxtable__truncate_noeventproc_CS( vgx_Graph_t *self,
     n_removed = -1;
   }
   XFINALLY {
-
+    // Geo and text indexes reference removed vertices
+    _vxgraph_geoindex__rebuild_CS( self );
+    _vxgraph_textindex__rebuild_CS( self );
   }
 
   return n_removed;
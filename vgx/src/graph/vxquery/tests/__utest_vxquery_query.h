@@ -662,6 +662,8 @@ BEGIN_UNIT_TEST( __utest_vxquery_query ) {
       TEST_ASSERTION( condition->CSTR__idlist == NULL,              "any id" );
       TEST_ASSERTION( condition->advanced.degree_condition == NULL,         "no advanced degree condition" );
       TEST_ASSERTION( condition->advanced.timestamp_condition == NULL,      "no timestamp condition" );
+      TEST_ASSERTION( condition->advanced.geo_condition == NULL,            "no geo condition" );
+      TEST_ASSERTION( condition->advanced.text_condition == NULL,           "no text condition" );
       TEST_ASSERTION( condition->advanced.similarity_condition == NULL,     "no similarity condition" );
       TEST_ASSERTION( condition->advanced.property_condition_set == NULL,       "no property condition" );
       TEST_ASSERTION( condition->advanced.recursive.conditional.vertex_condition == NULL,     "no conditional recursive neighborhood condition" );
@@ -30,6 +30,9 @@ SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
 
 static void __delete_search_ranker_context( vgx_Ranker_t **ranker );
 static vgx_Ranker_t * __new_search_ranker_context( const vgx_ranking_context_t *ranking_context );
+static void __bind_ranker_floor( vgx_Ranker_t *ranker, vgx_BaseCollector_context_t *collector );
+static int __resolve_collector_cursor( const vgx_ranking_context_t *ranking_context, vgx_BaseQuery_t *query, vgx_CollectorFloorGate_t key, vgx_CollectorCursor_t *cursor );
+static bool __cursor_unsupported( const vgx_ranking_context_t *ranking_context, vgx_BaseQuery_t *query );
 
 static vgx_VertexRef_t * __new_vertex_reference_map( int64_t collector_size, int64_t *mapsz );
 static int64_t __destroy_vertex_reference_map( vgx_Graph_t *graph, vgx_VertexRef_t **refmap, int64_t mapsz );
@@ -48,6 +51,7 @@ static vgx_VertexCollector_context_t * _vxquery_collector__new_vertex_collector(
 static vgx_BaseCollector_context_t * _vxquery_collector__convert_to_base_list_collector( vgx_BaseCollector_context_t *collector );
 static vgx_BaseCollector_context_t * _vxquery_collector__trim_base_list_collector( vgx_BaseCollector_context_t *collector, int64_t n_collected, int offset, int64_t hits );
 static int64_t _vxquery_collector__transfer_base_list( vgx_ranking_context_t *ranking_context, vgx_BaseCollector_context_t **src, vgx_BaseCollector_context_t **dest );
+static int64_t _vxquery_collector__merge_arc_collector( vgx_ArcCollector_context_t *collector, vgx_ArcCollector_context_t *other );
 
 
 
@@ -63,6 +67,7 @@ DLL_HIDDEN IGraphCollector_t iGraphCollector = {
   .ConvertToBaseListCollector         = _vxquery_collector__convert_to_base_list_collector,
   .TrimBaseListCollector              = _vxquery_collector__trim_base_list_collector,
   .TransferBaseList                   = _vxquery_collector__transfer_base_list,
+  .MergeArcCollector                  = _vxquery_collector__merge_arc_collector,
 };
 
 
@@ -114,6 +119,98 @@ static vgx_Ranker_t * __new_search_ranker_context( const vgx_ranking_context_t *
 
 
 
+/*******************************************************************//**
+ * Expose the collector's top-k heap floor to the rank evaluator so rank
+ * expressions can exit early via collectable.real / collectable.int.
+ * The evaluator is borrowed and will be re-bound by the next collector
+ * created for it.
+ *
+ ***********************************************************************
+ */
+static void __bind_ranker_floor( vgx_Ranker_t *ranker, vgx_BaseCollector_context_t *collector ) {
+  if( ranker->evaluator ) {
+    CALLABLE( ranker->evaluator )->SetCollector( ranker->evaluator, collector );
+  }
+}
+
+
+
+
+/*******************************************************************//**
+ * Resolve the query's keyset cursor (if any) for a sorted collector whose
+ * heap comparator maps to the given typed key. The key must be a plain
+ * numeric sort, and a positioned cursor must have been produced by a
+ * query with the same sort key and direction.
+ * Return 1 if the collector will page by cursor, 0 if not, or -1 on error
+ * with the query error string set.
+ *
+ ***********************************************************************
+ */
+static int __resolve_collector_cursor( const vgx_ranking_context_t *ranking_context, vgx_BaseQuery_t *query, vgx_CollectorFloorGate_t key, vgx_CollectorCursor_t *cursor ) {
+  const vgx_CollectorCursor_t *query_cursor = vgx_query_cursor( query );
+  if( query_cursor == NULL || !query_cursor->enabled ) {
+    return 0;
+  }
+
+  switch( _vgx_sortby( ranking_context->sortspec ) ) {
+  // Not stable across queries
+  case VGX_SORTBY_MEMADDRESS:
+  case VGX_SORTBY_NATIVE:
+  case VGX_SORTBY_RANDOM:
+    key = VGX_COLLECTOR_FLOOR_GATE_NONE;
+    break;
+  default:
+    break;
+  }
+
+  if( key == VGX_COLLECTOR_FLOOR_GATE_NONE ) {
+    __set_error_string( &query->CSTR__error, "cursor pagination requires a numeric sort key" );
+    return -1;
+  }
+
+  if( query_cursor->positioned && query_cursor->key != key ) {
+    __set_error_string( &query->CSTR__error, "cursor does not match sort key" );
+    return -1;
+  }
+
+  *cursor = *query_cursor;
+  cursor->key = key;
+  return 1;
+}
+
+
+
+/*******************************************************************//**
+ * Return true (and set the query error string) if the query has a
+ * keyset cursor that cannot be combined with the requested collection.
+ * Cursor pagination needs a plain top-k heap and no offset.
+ *
+ ***********************************************************************
+ */
+static bool __cursor_unsupported( const vgx_ranking_context_t *ranking_context, vgx_BaseQuery_t *query ) {
+  const vgx_CollectorCursor_t *query_cursor = vgx_query_cursor( query );
+  // Internal collectors without ranking ignore the cursor
+  if( query_cursor == NULL || !query_cursor->enabled || ranking_context == NULL ) {
+    return false;
+  }
+  if( ranking_context->sortspec == VGX_SORTBY_NONE ) {
+    __set_error_string( &query->CSTR__error, "cursor pagination requires sorted results" );
+    return true;
+  }
+  if( _vgx_aggregate( ranking_context->sortspec ) ) {
+    __set_error_string( &query->CSTR__error, "cursor pagination is not supported with aggregation" );
+    return true;
+  }
+  int offset = query->type == VGX_QUERY_TYPE_NEIGHBORHOOD ? ((vgx_NeighborhoodQuery_t*)query)->offset : ((vgx_GlobalQuery_t*)query)->offset;
+  if( offset > 0 ) {
+    __set_error_string( &query->CSTR__error, "cursor pagination cannot be combined with offset" );
+    return true;
+  }
+  return false;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -540,9 +637,23 @@ static vgx_ArcCollector_context_t * __new_sorted_list_arc_collector( vgx_Graph_t
     }
 
     // We will collect using a heap
+    f_vgx_ArcComparator comparator = __get_arc_comparator( ranking_context, &empty );
+    vgx_CollectorFloorGate_t floor_gate = __get_arc_floor_gate( comparator );
+
+    // Keyset cursor imposes a total order and admits floor ties
+    vgx_CollectorCursor_t cursor = {0};
+    int cursor_mode = __resolve_collector_cursor( ranking_context, query, floor_gate, &cursor );
+    if( cursor_mode < 0 ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x326 );
+    }
+    else if( cursor_mode > 0 ) {
+      comparator = _vxarcvector_comparator__get_cursor_comparator( cursor.key );
+      floor_gate = VGX_COLLECTOR_FLOOR_GATE_NONE;
+    }
+
     Cm256iHeap_constructor_args_t heap_args = {
       .element_capacity = size,
-      .comparator = (f_Cm256iHeap_comparator_t)__get_arc_comparator( ranking_context, &empty )
+      .comparator = (f_Cm256iHeap_comparator_t)comparator
     };
 
     // Create the new heap
@@ -578,6 +689,9 @@ static vgx_ArcCollector_context_t * __new_sorted_list_arc_collector( vgx_Graph_t
     top_k_collector->refmap                   = refmap;
     top_k_collector->stage                    = stage;
     top_k_collector->postheap                 = NULL,
+    top_k_collector->floor                    = empty.sort;
+    top_k_collector->floor_gate               = floor_gate;
+    top_k_collector->cursor                   = cursor;
     top_k_collector->size                     = size;
     top_k_collector->n_remain                 = LLONG_MAX;
     top_k_collector->n_collectable            = 0;
@@ -595,6 +709,9 @@ static vgx_ArcCollector_context_t * __new_sorted_list_arc_collector( vgx_Graph_t
     
     // Initialize the heap with "lowest" values
     CALLABLE(heap)->Initialize( heap, &empty.item, size );
+
+    // Rank expressions may consult the heap floor
+    __bind_ranker_floor( ranker, (vgx_BaseCollector_context_t*)top_k_collector );
   }
   XCATCH( errcode ) {
     iGraphCollector.DeleteCollector( (vgx_BaseCollector_context_t**)&top_k_collector );
@@ -682,6 +799,8 @@ static vgx_ArcCollector_context_t * __new_unsorted_list_arc_collector( vgx_Graph
     collector->n_neighbors              = 0;
     collector->counts_are_deep          = false;
 
+    // No heap floor, but rank expressions must not see a previous collector
+    __bind_ranker_floor( ranker, (vgx_BaseCollector_context_t*)collector );
   }
   XCATCH( errcode ) {
     iGraphCollector.DeleteCollector( (vgx_BaseCollector_context_t**)&collector );
@@ -739,13 +858,15 @@ static vgx_ArcCollector_context_t * __new_aggregation_arc_collector( vgx_Graph_t
     }
 
     vgx_CollectorType_t type;
+    vgx_CollectorItem_t empty = {0};
+    f_vgx_ArcComparator comparator = NULL;
     if( _vgx_sortby( ranking_context->sortspec ) ) {
       type = VGX_COLLECTOR_TYPE_SORTED_ARC_AGGREGATION;
-      vgx_CollectorItem_t empty = {0};
       // We will post-process using a heap, in order to extract the top hits from the aggregation map
+      comparator = __get_arc_comparator( ranking_context, &empty );
       Cm256iHeap_constructor_args_t heap_args = {
         .element_capacity = size,
-        .comparator = (f_Cm256iHeap_comparator_t)__get_arc_comparator( ranking_context, &empty )
+        .comparator = (f_Cm256iHeap_comparator_t)comparator
       };
 
       // Create the new heap for post-collection sorting
@@ -773,6 +894,8 @@ static vgx_ArcCollector_context_t * __new_aggregation_arc_collector( vgx_Graph_t
     map_collector->refmap                       = refmap;
     map_collector->stage                        = stage;
     map_collector->postheap                     = postheap;
+    map_collector->floor                        = empty.sort;
+    map_collector->floor_gate                   = __get_arc_floor_gate( comparator );
     map_collector->size                         = size;
     map_collector->n_remain                     = LLONG_MAX;
     map_collector->n_collectable                = 0;
@@ -787,7 +910,8 @@ static vgx_ArcCollector_context_t * __new_aggregation_arc_collector( vgx_Graph_t
     map_collector->n_neighbors                  = 0;
     map_collector->counts_are_deep              = true;
 
-    //
+    // Rank expressions may consult the (initial) postheap floor
+    __bind_ranker_floor( ranker, (vgx_BaseCollector_context_t*)map_collector );
 
   }
   XCATCH( errcode ) {
@@ -889,9 +1013,23 @@ static vgx_VertexCollector_context_t * __new_sorted_list_vertex_collector( vgx_G
     }
 
     // We will collect using a heap
+    f_vgx_VertexComparator comparator = __get_vertex_comparator( ranking_context, &empty );
+    vgx_CollectorFloorGate_t floor_gate = __get_vertex_floor_gate( comparator );
+
+    // Keyset cursor imposes a total order and admits floor ties
+    vgx_CollectorCursor_t cursor = {0};
+    int cursor_mode = __resolve_collector_cursor( ranking_context, query, floor_gate, &cursor );
+    if( cursor_mode < 0 ) {
+      THROW_SILENT( CXLIB_ERR_API, 0x367 );
+    }
+    else if( cursor_mode > 0 ) {
+      comparator = (f_vgx_VertexComparator)_vxarcvector_comparator__get_cursor_comparator( cursor.key );
+      floor_gate = VGX_COLLECTOR_FLOOR_GATE_NONE;
+    }
+
     Cm256iHeap_constructor_args_t heap_args = {
       .element_capacity = size,
-      .comparator = (f_Cm256iHeap_comparator_t)__get_vertex_comparator( ranking_context, &empty )
+      .comparator = (f_Cm256iHeap_comparator_t)comparator
     };
 
     // Create the new heap
@@ -926,6 +1064,9 @@ static vgx_VertexCollector_context_t * __new_sorted_list_vertex_collector( vgx_G
     top_k_collector->refmap                   = refmap;
     top_k_collector->stage                    = stage;
     top_k_collector->postheap                 = NULL;
+    top_k_collector->floor                    = empty.sort;
+    top_k_collector->floor_gate               = floor_gate;
+    top_k_collector->cursor                   = cursor;
     top_k_collector->size                     = size;
     top_k_collector->n_remain                 = LLONG_MAX;
     top_k_collector->n_collectable            = 0;
@@ -939,6 +1080,9 @@ static vgx_VertexCollector_context_t * __new_sorted_list_vertex_collector( vgx_G
     
     // Initialize the heap with "lowest" values
     CALLABLE(heap)->Initialize( heap, &empty.item, size );
+
+    // Rank expressions may consult the heap floor
+    __bind_ranker_floor( ranker, (vgx_BaseCollector_context_t*)top_k_collector );
   }
   XCATCH( errcode ) {
     iGraphCollector.DeleteCollector( (vgx_BaseCollector_context_t**)&top_k_collector );
@@ -1027,6 +1171,8 @@ static vgx_VertexCollector_context_t * __new_unsorted_list_vertex_collector( vgx
     collector->n_vertices               = 0;
     collector->counts_are_deep          = false;
 
+    // No heap floor, but rank expressions must not see a previous collector
+    __bind_ranker_floor( ranker, (vgx_BaseCollector_context_t*)collector );
   }
   XCATCH( errcode ) {
     iGraphCollector.DeleteCollector( (vgx_BaseCollector_context_t**)&collector );
@@ -1585,6 +1731,91 @@ static int64_t _vxquery_collector__transfer_base_list( vgx_ranking_context_t *ra
 
 
 
+/*******************************************************************//**
+ * Merge the top-k items of another sorted arc collector into collector.
+ * Both collectors must have been created for the same ranking and
+ * counts (e.g. partitioned traversals of the same query) in a readonly
+ * graph, i.e. no collected vertex references may hold vertex locks.
+ * The other collector's heap is drained and its counters are added to
+ * collector's counters.
+ *
+ * Returns: number of items pushed into collector's heap, or -1 on error
+ ***********************************************************************
+ */
+static int64_t _vxquery_collector__merge_arc_collector( vgx_ArcCollector_context_t *collector, vgx_ArcCollector_context_t *other ) {
+  if( collector->type != VGX_COLLECTOR_TYPE_SORTED_ARC_LIST || other->type != VGX_COLLECTOR_TYPE_SORTED_ARC_LIST ) {
+    return -1;
+  }
+
+  vgx_BaseCollector_context_t *base = (vgx_BaseCollector_context_t*)collector;
+  vgx_BaseCollector_context_t *other_base = (vgx_BaseCollector_context_t*)other;
+  Cm256iHeap_t *heap = collector->container.sequence.heap;
+  Cm256iHeap_t *other_heap = other->container.sequence.heap;
+  int64_t n_merged = 0;
+  vgx_VertexRefLock_t nolock = 0;
+  vgx_Graph_t *locked_graph = NULL;
+  vgx_CollectorItem_t item;
+
+  while( CALLABLE( other_heap )->HeapPop( other_heap, &item.item ) == 1 ) {
+    // Empty heap slot
+    if( item.headref == NULL ) {
+      continue;
+    }
+
+    // Vertex locks cannot be transferred between collectors
+    if( item.tailref->slot.locked > 0 || item.headref->slot.locked > 0 ) {
+      n_merged = -1;
+    }
+    // Item can beat the current top-k floor
+    else if( n_merged >= 0 && !_vgx_collector_below_floor( base, item.sort ) ) {
+      vgx_VertexRef_t sort_tailref = { .vertex = item.tailref->vertex };
+      vgx_VertexRef_t sort_headref = { .vertex = item.headref->vertex };
+      vgx_CollectorItem_t collected = {
+        .tailref    = &sort_tailref,
+        .headref    = &sort_headref,
+        .predicator = item.predicator,
+        .sort       = item.sort
+      };
+      vgx_CollectorItem_t discarded;
+      vgx_CollectorItem_t *push_location;
+      if( (push_location = (vgx_CollectorItem_t*)CALLABLE( heap )->HeapPushTopK( heap, &collected.item, &discarded.item )) != NULL ) {
+        vgx_CollectorItem_t *inserted = push_location;
+        inserted->tailref = _vxquery_collector__add_vertex_reference( base, sort_tailref.vertex, &nolock );
+        inserted->headref = _vxquery_collector__add_vertex_reference( base, sort_headref.vertex, &nolock );
+        if( inserted->tailref == NULL || inserted->headref == NULL ) {
+          n_merged = -1;
+        }
+        else {
+          ++n_merged;
+        }
+        _vxquery_collector__del_vertex_reference_ACQUIRE_CS( base, discarded.tailref, &locked_graph );
+        _vxquery_collector__del_vertex_reference_ACQUIRE_CS( base, discarded.headref, &locked_graph );
+        // Refresh the cached floor
+        vgx_CollectorItem_t top;
+        if( CALLABLE( heap )->HeapTop( heap, &top.item ) ) {
+          collector->floor = top.sort;
+        }
+      }
+    }
+
+    // Release the popped item from the other collector
+    _vxquery_collector__del_vertex_reference_ACQUIRE_CS( other_base, item.tailref, &locked_graph );
+    _vxquery_collector__del_vertex_reference_ACQUIRE_CS( other_base, item.headref, &locked_graph );
+  }
+
+  GRAPH_LEAVE_CRITICAL_SECTION( &locked_graph );
+
+  collector->n_collectable += other->n_collectable;
+  collector->n_arcs += other->n_arcs;
+  collector->n_neighbors += other->n_neighbors;
+  collector->counts_are_deep = collector->counts_are_deep && other->counts_are_deep;
+  other->n_collectable = 0;
+
+  return n_merged;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1592,6 +1823,10 @@ static int64_t _vxquery_collector__transfer_base_list( vgx_ranking_context_t *ra
  */
 static vgx_ArcCollector_context_t * _vxquery_collector__new_arc_collector( vgx_Graph_t *graph, vgx_ranking_context_t *ranking_context, vgx_BaseQuery_t *query, vgx_collect_counts_t *counts ) {
   vgx_ArcCollector_context_t *collector = NULL;
+
+  if( __cursor_unsupported( ranking_context, query ) ) {
+    return NULL;
+  }
   
   if( ranking_context ) {
 
@@ -1631,6 +1866,10 @@ static vgx_ArcCollector_context_t * _vxquery_collector__new_arc_collector( vgx_G
 static vgx_VertexCollector_context_t * _vxquery_collector__new_vertex_collector( vgx_Graph_t *graph, vgx_ranking_context_t *ranking_context, vgx_BaseQuery_t *query, vgx_collect_counts_t *counts ) {
   vgx_VertexCollector_context_t *collector = NULL ;
 
+  if( __cursor_unsupported( ranking_context, query ) ) {
+    return NULL;
+  }
+
   if( ranking_context ) {
 
     // Collector is SORTED
@@ -230,6 +230,8 @@ static void __dump_vertex_condition( const vgx_VertexCondition_t * const vertex_
 static void __dump_degree_condition( const vgx_DegreeCondition_t * const degree_condition, int recursion );
 static void __dump_similarity_condition( const vgx_SimilarityCondition_t * const similarity_condition, int recursion );
 static void __dump_timestamp_condition( const vgx_TimestampCondition_t * const timestamp_condition, int recursion );
+static void __dump_geo_condition( const vgx_GeoCondition_t * const geo_condition, int recursion );
+static void __dump_text_condition( const vgx_TextCondition_t * const text_condition, int recursion );
 static void __dump_property_condition_set( const vgx_PropertyConditionSet_t * const property_condition_set, int recursion );
 static void __dump_recursive_condition( const vgx_RecursiveCondition_t * const recursive_condition, int recursion );
 static void __dump_arc_condition_set( const vgx_ArcConditionSet_t * const arc_condition_set, int recursion );
@@ -265,6 +267,8 @@ static void __dump_vertex_identifiers( const vgx_StringList_t *list, int recursi
 static void __dump_vertex_type( const vgx_vertex_type_t vtype, int recursion );
 static void __dump_degree_probe( const vgx_degree_probe_t * const degree_probe, int recursion );
 static void __dump_timestamp_probe( const vgx_timestamp_probe_t * const timestamp_probe, int recursion );
+static void __dump_geo_probe( const vgx_geo_probe_t * const geo_probe, int recursion );
+static void __dump_text_probe( const vgx_text_probe_t * const text_probe, int recursion );
 static void __dump_similarity_probe( const vgx_similarity_probe_t * const similarity_probe, int recursion );
 static void __dump_property_probe( const vgx_property_probe_t * const property_probe, int recursion );
 static void __dump_vertex_property( const vgx_VertexProperty_t * const vertex_property, int recursion );
@@ -418,6 +422,29 @@ DLL_HIDDEN CStringQueue_t * _vxquery_dump__query( const vgx_BaseQuery_t *base, C
     __dump_arc_condition_set( neighborhood->collect_arc_condition_set, 1 );
     WRITE_CHARS(        0, ".collector_mode            : " );
     __dump_collector_mode( neighborhood->collector_mode, 1 );
+    if( neighborhood->expand_condition ) {
+      for( int i=0; i<neighborhood->expand_condition->n_hops; i++ ) {
+        const vgx_ExpandHop_t *hop = &neighborhood->expand_condition->hop[i];
+        WRITELINE_FORMAT( 0, ".expand[%d].fanout          : %lld", i, hop->fanout );
+        WRITE_FORMAT(     0, ".expand[%d].arc_condition_set : ", i );
+        __dump_arc_condition_set( hop->arc_condition_set, 1 );
+      }
+    }
+    break;
+  case VGX_QUERY_TYPE_GLOBAL:
+    if( ((vgx_GlobalQuery_t*)base)->pagerank_condition ) {
+      const vgx_PageRankCondition_t *pagerank = ((vgx_GlobalQuery_t*)base)->pagerank_condition;
+      WRITELINE_CHARS(    0, "__global__" );
+      WRITELINE_FORMAT(   0, ".pagerank.seeds            : %d", pagerank->n_seeds );
+      WRITELINE_FORMAT(   0, ".pagerank.weights          : %d", pagerank->n_weights );
+      WRITELINE_FORMAT(   0, ".pagerank.alpha            : %#g", pagerank->alpha );
+      WRITELINE_FORMAT(   0, ".pagerank.epsilon          : %#g", pagerank->epsilon );
+      WRITELINE_FORMAT(   0, ".pagerank.max_iterations   : %lld", pagerank->max_iterations );
+      WRITELINE_FORMAT(   0, ".pagerank.max_vertices     : %lld", pagerank->max_vertices );
+      WRITELINE_FORMAT(   0, ".pagerank.arcvalue         : %d", (int)pagerank->arcvalue );
+      WRITE_CHARS(        0, ".pagerank.arc_condition_set : " );
+      __dump_arc_condition_set( pagerank->arc_condition_set, 1 );
+    }
     break;
   case VGX_QUERY_TYPE_AGGREGATOR:
     aggregator = (vgx_AggregatorQuery_t*)base;
@@ -652,6 +679,10 @@ static void __dump_vertex_condition( const vgx_VertexCondition_t * const vertex_
     __dump_similarity_condition( VC->advanced.similarity_condition, next );
     WRITE_CHARS(        indent,  ".advanced.timestamp_condition     : " );
     __dump_timestamp_condition( VC->advanced.timestamp_condition, next );
+    WRITE_CHARS(        indent,  ".advanced.geo_condition           : " );
+    __dump_geo_condition( VC->advanced.geo_condition, next );
+    WRITE_CHARS(        indent,  ".advanced.text_condition          : " );
+    __dump_text_condition( VC->advanced.text_condition, next );
     WRITE_CHARS(        indent,  ".advanced.property_condition_set  : " );
     __dump_property_condition_set( VC->advanced.property_condition_set, next );
     WRITE_CHARS(        indent,  ".advanced.recursive.conditional   : " );
@@ -710,6 +741,40 @@ static void __dump_timestamp_condition( const vgx_TimestampCondition_t * const t
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __dump_geo_condition( const vgx_GeoCondition_t * const geo_condition, int recursion ) {
+  int indent = INDENT( recursion );
+  BEGIN_RECURSIVE_OBJECT( recursion, vgx_GeoCondition_t, GC, geo_condition ) {
+    WRITELINE_FORMAT( indent, ".positive : %d", GC->positive );
+    WRITELINE_FORMAT( indent, ".lat      : %f", GC->lat );
+    WRITELINE_FORMAT( indent, ".lon      : %f", GC->lon );
+    WRITELINE_FORMAT( indent, ".radius   : %f", GC->radius );
+  } END_RECURSIVE_OBJECT;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __dump_text_condition( const vgx_TextCondition_t * const text_condition, int recursion ) {
+  int indent = INDENT( recursion );
+  BEGIN_RECURSIVE_OBJECT( recursion, vgx_TextCondition_t, TC, text_condition ) {
+    WRITELINE_FORMAT( indent, ".positive : %d", TC->positive );
+    WRITELINE_FORMAT( indent, ".mode     : %d", TC->mode );
+    WRITELINE_FORMAT( indent, ".key      : %s", TC->CSTR__key ? CStringValue( TC->CSTR__key ) : "" );
+    WRITELINE_FORMAT( indent, ".terms    : %s", TC->CSTR__terms ? CStringValue( TC->CSTR__terms ) : "" );
+  } END_RECURSIVE_OBJECT;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -968,6 +1033,7 @@ static void __dump_collector( const vgx_BaseCollector_context_t * const collecto
     }
 
     WRITELINE_FORMAT( indent, ".length     : %lld", length );
+    WRITELINE_FORMAT( indent, ".floor      : %016llX (gate=%d)", C->floor.qword, (int)C->floor_gate );
 
   } END_RECURSIVE_OBJECT;
 }
@@ -1375,6 +1441,10 @@ static void __dump_vertex_probe( const vgx_vertex_probe_t * const vertex_probe,
     __dump_degree_probe( P->advanced.degree_probe, next );
     WRITE_CHARS(      indent, ".advanced.timestamp_probe         : " );
     __dump_timestamp_probe( P->advanced.timestamp_probe, next );
+    WRITE_CHARS(      indent, ".advanced.geo_probe               : " );
+    __dump_geo_probe( P->advanced.geo_probe, next );
+    WRITE_CHARS(      indent, ".advanced.text_probe              : " );
+    __dump_text_probe( P->advanced.text_probe, next );
     WRITE_CHARS(      indent, ".advanced.similarity_probe        : " );
     __dump_similarity_probe( P->advanced.similarity_probe, next );
     WRITE_CHARS(      indent, ".advanced.property_probe          : " );
@@ -1496,6 +1566,42 @@ static void __dump_timestamp_probe( const vgx_timestamp_probe_t * const timestam
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __dump_geo_probe( const vgx_geo_probe_t * const geo_probe, int recursion ) {
+  int indent = INDENT( recursion );
+  BEGIN_RECURSIVE_OBJECT( recursion, vgx_geo_probe_t, P, geo_probe ) {
+    WRITELINE_FORMAT( indent, ".positive    : %d", P->positive );
+    WRITELINE_FORMAT( indent, ".lat_keyhash : %016llX", P->lat_keyhash );
+    WRITELINE_FORMAT( indent, ".lon_keyhash : %016llX", P->lon_keyhash );
+    WRITELINE_FORMAT( indent, ".lat         : %f", P->lat );
+    WRITELINE_FORMAT( indent, ".lon         : %f", P->lon );
+    WRITELINE_FORMAT( indent, ".radius      : %f", P->radius );
+  } END_RECURSIVE_OBJECT;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __dump_text_probe( const vgx_text_probe_t * const text_probe, int recursion ) {
+  int indent = INDENT( recursion );
+  BEGIN_RECURSIVE_OBJECT( recursion, vgx_text_probe_t, P, text_probe ) {
+    WRITELINE_FORMAT( indent, ".positive : %d", P->positive );
+    WRITELINE_FORMAT( indent, ".mode     : %d", P->mode );
+    WRITELINE_FORMAT( indent, ".keyhash  : %016llX", P->keyhash );
+    WRITELINE_FORMAT( indent, ".n_terms  : %d", P->n_terms );
+  } END_RECURSIVE_OBJECT;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -49,6 +49,10 @@ static vgx_property_probe_t * __new_vertex_property_probe_from_condition_set( vg
 
 static void __delete_vertex_timestamp_probe( vgx_timestamp_probe_t **timestamp_probe );
 static vgx_timestamp_probe_t * __new_vertex_timestamp_probe_from_condition( const vgx_TimestampCondition_t *condition );
+static void __delete_vertex_geo_probe( vgx_geo_probe_t **geo_probe );
+static vgx_geo_probe_t * __new_vertex_geo_probe_from_condition( vgx_Graph_t *self, const vgx_GeoCondition_t *condition );
+static void __delete_vertex_text_probe( vgx_text_probe_t **text_probe );
+static vgx_text_probe_t * __new_vertex_text_probe_from_condition( vgx_Graph_t *self, const vgx_TextCondition_t *condition, CString_t **CSTR__error );
 
 static void __delete_vertex_similarity_probe( vgx_similarity_probe_t **similarity_probe );
 static vgx_similarity_probe_t * __new_vertex_similarity_probe_from_condition( const vgx_SimilarityCondition_t *condition, vgx_Similarity_t *simcontext_borrowed );
@@ -203,7 +207,7 @@ static void __delete_ranking_context( vgx_ranking_context_t **ranking_context )
  ***********************************************************************
  */
 static int __configure_new_ranking_context_from_condition( vgx_Graph_t *self, bool readonly_graph, vgx_BaseQuery_t *query, vgx_Similarity_t *simcontext_clone, vgx_ranking_context_t **ranking_context, CString_t **CSTR__error ) {
-  vgx_ExecutionTimingBudget_t *timing_budget = &query->timing_budget;
+  vgx_ExecutionTimingBudget_t *timing_budget = vgx_query_timing_budget( (vgx_BaseQuery_t*)query );
   vgx_RankingCondition_t *ranking_condition = query->ranking_condition;
   if( ranking_condition == NULL ) {
     return -1;
@@ -401,7 +405,7 @@ static int __configure_base_search_context( vgx_Graph_t *self, bool readonly_gra
 
   XTRY {
     // 1. Use shared timing budget from query
-    search->timing_budget = &query->timing_budget;
+    search->timing_budget = vgx_query_timing_budget( query );
 
     // 2. Initialize error string to empty
     search->CSTR__error = NULL;
@@ -584,6 +588,96 @@ static vgx_timestamp_probe_t * __new_vertex_timestamp_probe_from_condition( cons
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_vertex_geo_probe( vgx_geo_probe_t **geo_probe ) {
+  if( geo_probe && *geo_probe ) {
+    free( *geo_probe );
+    *geo_probe = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Geo probe matches the properties declared by the graph's geo index.
+ * Return NULL if graph has no geo index.
+ ***********************************************************************
+ */
+static vgx_geo_probe_t * __new_vertex_geo_probe_from_condition( vgx_Graph_t *self, const vgx_GeoCondition_t *condition ) {
+  vgx_geo_probe_t *geo_probe = NULL;
+  if( (geo_probe = calloc( 1, sizeof( vgx_geo_probe_t ) )) != NULL ) {
+    geo_probe->positive = condition->positive;
+    geo_probe->lat = condition->lat;
+    geo_probe->lon = condition->lon;
+    geo_probe->radius = condition->radius;
+    if( _vxgraph_geoindex__get_keys_OPEN( self, &geo_probe->lat_keyhash, &geo_probe->lon_keyhash ) < 0 ) {
+      __delete_vertex_geo_probe( &geo_probe );
+    }
+  }
+  return geo_probe;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_vertex_text_probe( vgx_text_probe_t **text_probe ) {
+  if( text_probe && *text_probe ) {
+    free( *text_probe );
+    *text_probe = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Text probe holds the hashed terms of the condition, normalized the
+ * same way as the text in the graph's text index for the key.
+ * Return NULL if graph has no text index for the key or too many terms.
+ ***********************************************************************
+ */
+static vgx_text_probe_t * __new_vertex_text_probe_from_condition( vgx_Graph_t *self, const vgx_TextCondition_t *condition, CString_t **CSTR__error ) {
+  vgx_text_probe_t *text_probe = NULL;
+  QWORD *terms = NULL;
+  XTRY {
+    if( (text_probe = calloc( 1, sizeof( vgx_text_probe_t ) )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x648 );
+    }
+    text_probe->positive = condition->positive;
+    text_probe->mode = condition->mode;
+    if( _vxgraph_textindex__get_keyhash_OPEN( self, condition->CSTR__key, &text_probe->keyhash ) < 0 ) {
+      __format_error_string( CSTR__error, "text condition requires a text index for '%s'", CStringValue( condition->CSTR__key ) );
+      THROW_SILENT( CXLIB_ERR_API, 0x649 );
+    }
+    int64_t n = 0;
+    terms = _vxgraph_textindex__tokenize( CStringValue( condition->CSTR__terms ), &n );
+    if( n > VGX_TEXT_QUERY_MAX_TERMS ) {
+      __format_error_string( CSTR__error, "too many terms in text condition (max %d)", VGX_TEXT_QUERY_MAX_TERMS );
+      THROW_SILENT( CXLIB_ERR_API, 0x64A );
+    }
+    if( n > 0 ) {
+      memcpy( text_probe->terms, terms, n * sizeof( QWORD ) );
+    }
+    text_probe->n_terms = (int)n;
+  }
+  XCATCH( errcode ) {
+    __delete_vertex_text_probe( &text_probe );
+  }
+  XFINALLY {
+    free( terms );
+  }
+  return text_probe;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -724,6 +818,12 @@ static void __delete_vertex_probe( vgx_vertex_probe_t **vertex_probe ) {
     // Delete timestamp probe
     __delete_vertex_timestamp_probe( &VP->advanced.timestamp_probe );
 
+    // Delete geo probe
+    __delete_vertex_geo_probe( &VP->advanced.geo_probe );
+
+    // Delete text probe
+    __delete_vertex_text_probe( &VP->advanced.text_probe );
+
     // Delete degree probe
     __delete_vertex_degree_probe( &VP->advanced.degree_probe );
 
@@ -772,7 +872,7 @@ static int __configure_new_vertex_probe_from_condition( vgx_Graph_t *self,
   }
   // We have vertex conditions, now set up the probe
   else {
-    vgx_ExecutionTimingBudget_t *timing_budget = &query->timing_budget;
+    vgx_ExecutionTimingBudget_t *timing_budget = vgx_query_timing_budget( (vgx_BaseQuery_t*)query );
     vgx_vertex_probe_spec spec = vertex_condition->spec;
     vgx_VertexStateContext_man_t manifestation = vertex_condition->manifestation;
     // Vertex conditions are equivalent to a full wildcard, so again no conditions and return empty probe
@@ -895,6 +995,21 @@ static int __configure_new_vertex_probe_from_condition( vgx_Graph_t *self,
             }
           }
 
+          // GEO condition
+          if( vertex_condition->advanced.geo_condition != NULL ) {
+            if( (VP->advanced.geo_probe = __new_vertex_geo_probe_from_condition( self, vertex_condition->advanced.geo_condition )) == NULL ) {
+              __set_error_string( &vertex_condition->CSTR__error, "geo condition requires a geo index" );
+              THROW_SILENT( CXLIB_ERR_API, 0x63E );
+            }
+          }
+
+          // TEXT condition
+          if( vertex_condition->advanced.text_condition != NULL ) {
+            if( (VP->advanced.text_probe = __new_vertex_text_probe_from_condition( self, vertex_condition->advanced.text_condition, &vertex_condition->CSTR__error )) == NULL ) {
+              THROW_SILENT( CXLIB_ERR_API, 0x63F );
+            }
+          }
+
           // SIMILARITY conditions(s)
           if( vertex_condition->advanced.similarity_condition != NULL ) {
             if( (VP->advanced.similarity_probe = __new_vertex_similarity_probe_from_condition( vertex_condition->advanced.similarity_condition, simcontext_borrowed )) == NULL ) {
@@ -1093,7 +1208,7 @@ static int __configure_new_neighborhood_probe(  vgx_Graph_t *self,
 {
   int retcode = 1;
   XTRY {
-    vgx_ExecutionTimingBudget_t *timing_budget = &query->timing_budget;
+    vgx_ExecutionTimingBudget_t *timing_budget = vgx_query_timing_budget( (vgx_BaseQuery_t*)query );
     vgx_neighborhood_probe_t *probe;
 
     // True if conditional and traversing conditions are different.
@@ -1663,7 +1778,7 @@ static vgx_aggregator_search_context_t * __clone_aggregator_search_context( vgx_
  */
 static int __configure_aggregator_search_context( vgx_Graph_t *self, bool readonly_graph, vgx_Vertex_t *anchor_RO, vgx_AggregatorQuery_t *query, vgx_aggregator_search_context_t *search ) {
   int retcode = 1;
-  vgx_ExecutionTimingBudget_t *timing_budget = &query->timing_budget;
+  vgx_ExecutionTimingBudget_t *timing_budget = vgx_query_timing_budget( (vgx_BaseQuery_t*)query );
   XTRY {
     // 1. BASE: Configure the aggregator context's base portion
     if( __configure_base_search_context( self, readonly_graph, (vgx_BaseQuery_t*)query, (vgx_base_search_context_t*)search ) != 0 ) {
@@ -1906,6 +2021,16 @@ static vgx_global_search_context_t * _vxquery_probe__new_global_search_context(
       }
     }
 
+    // -- PAGERANK --
+    // Personalized pagerank produces the candidate vertices (borrowed from query)
+    if( query->pagerank_condition ) {
+      if( search->collector.mode == VGX_COLLECTOR_MODE_COLLECT_ARCS ) {
+        __set_error_string( &query->CSTR__error, "pagerank not allowed in global arc search" );
+        THROW_SILENT( CXLIB_ERR_API, 0x6BD );
+      }
+      search->pagerank = query->pagerank_condition;
+    }
+
     // -- RESULT --
     // Initialize the result portion of the context
     search->offset      = counts.offset;
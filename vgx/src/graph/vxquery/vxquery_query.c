@@ -99,6 +99,10 @@ static vgx_NeighborhoodQuery_t * _vxquery_query__clone_neighborhood_query( const
 static vgx_GlobalQuery_t *       _vxquery_query__clone_global_query( const vgx_GlobalQuery_t *other, CString_t **CSTR__error );
 static vgx_AggregatorQuery_t *   _vxquery_query__clone_aggregator_query( const vgx_AggregatorQuery_t *other, CString_t **CSTR__error );
 
+//
+static vgx_PageRankCondition_t * _vxquery_query__new_pagerank_condition( int n_seeds, int n_weights );
+static void                      _vxquery_query__delete_pagerank_condition( vgx_PageRankCondition_t **pagerank_condition );
+
 
 DLL_EXPORT vgx_IGraphQuery_t iGraphQuery = {
 
@@ -134,6 +138,9 @@ DLL_EXPORT vgx_IGraphQuery_t iGraphQuery = {
   .CloneNeighborhoodQuery       = _vxquery_query__clone_neighborhood_query,
   .CloneGlobalQuery             = _vxquery_query__clone_global_query,
   .CloneAggregatorQuery         = _vxquery_query__clone_aggregator_query,
+
+  .NewPageRankCondition         = _vxquery_query__new_pagerank_condition,
+  .DeletePageRankCondition      = _vxquery_query__delete_pagerank_condition
 };
 
 
@@ -178,6 +185,16 @@ static int _vxquery_query__set_vertex_condition_require_TMC( vgx_VertexCondition
 static int _vxquery_query__set_vertex_condition_require_TMM( vgx_VertexCondition_t *vertex_condition, const vgx_value_condition_t tmm_condition ); 
 static int _vxquery_query__set_vertex_condition_require_TMX( vgx_VertexCondition_t *vertex_condition, const vgx_value_condition_t tmx_condition ); 
 
+// geo
+static vgx_GeoCondition_t * __new_geo_condition( bool positive, double lat, double lon, double radius );
+static void __delete_geo_condition( vgx_GeoCondition_t **geo_condition );
+static int _vxquery_query__set_vertex_condition_require_geo( vgx_VertexCondition_t *vertex_condition, bool positive, double lat, double lon, double radius );
+
+// text
+static vgx_TextCondition_t * __new_text_condition( bool positive, const char *key, const char *terms, vgx_TextMatchMode mode );
+static void __delete_text_condition( vgx_TextCondition_t **text_condition );
+static int _vxquery_query__set_vertex_condition_require_text( vgx_VertexCondition_t *vertex_condition, bool positive, const char *key, const char *terms, vgx_TextMatchMode mode );
+
 // recursive condition
 static void _vxquery_query__set_vertex_condition_require_recursive_condition( vgx_VertexCondition_t *vertex_condition, vgx_VertexCondition_t **neighbor_condition );
 static void _vxquery_query__set_vertex_condition_require_arc_condition( vgx_VertexCondition_t *vertex_condition, vgx_ArcConditionSet_t **arc_condition_set );
@@ -205,6 +222,8 @@ static int _vxquery_query__has_vertex_condition_property( const vgx_VertexCondit
 static int _vxquery_query__has_vertex_condition_TMC( const vgx_VertexCondition_t *vertex_condition );
 static int _vxquery_query__has_vertex_condition_TMM( const vgx_VertexCondition_t *vertex_condition );
 static int _vxquery_query__has_vertex_condition_TMX( const vgx_VertexCondition_t *vertex_condition );
+static int _vxquery_query__has_vertex_condition_geo( const vgx_VertexCondition_t *vertex_condition );
+static int _vxquery_query__has_vertex_condition_text( const vgx_VertexCondition_t *vertex_condition );
 static int _vxquery_query__has_vertex_condition_recursive_condition( const vgx_VertexCondition_t *vertex_condition );
 static int _vxquery_query__has_vertex_condition_arc_condition( const vgx_VertexCondition_t *vertex_condition );
 static int _vxquery_query__has_vertex_condition_condition_filter( const vgx_VertexCondition_t *vertex_condition );
@@ -243,6 +262,8 @@ DLL_EXPORT vgx_IVertexCondition_t iVertexCondition = {
   .RequireCreationTime        = _vxquery_query__set_vertex_condition_require_TMC,
   .RequireModificationTime    = _vxquery_query__set_vertex_condition_require_TMM,
   .RequireExpirationTime      = _vxquery_query__set_vertex_condition_require_TMX,
+  .RequireGeo                 = _vxquery_query__set_vertex_condition_require_geo,
+  .RequireText                = _vxquery_query__set_vertex_condition_require_text,
 
   .RequireRecursiveCondition  = _vxquery_query__set_vertex_condition_require_recursive_condition,
   .RequireArcCondition        = _vxquery_query__set_vertex_condition_require_arc_condition,
@@ -268,6 +289,8 @@ DLL_EXPORT vgx_IVertexCondition_t iVertexCondition = {
   .HasCreationTime            = _vxquery_query__has_vertex_condition_TMC,
   .HasModificationTime        = _vxquery_query__has_vertex_condition_TMM,
   .HasExpirationTime          = _vxquery_query__has_vertex_condition_TMX,
+  .HasGeo                     = _vxquery_query__has_vertex_condition_geo,
+  .HasText                    = _vxquery_query__has_vertex_condition_text,
   .HasRecursiveCondition      = _vxquery_query__has_vertex_condition_recursive_condition,
   .HasArcCondition            = _vxquery_query__has_vertex_condition_arc_condition,
   .HasConditionFilter         = _vxquery_query__has_vertex_condition_condition_filter,
@@ -719,6 +742,55 @@ static int SelectStatement_##Class( Class *self, vgx_Graph_t *graph, const char
 
 
 
+/*******************************************************************//**
+ * AddExpandHop
+ *
+ ***********************************************************************
+ */
+__inline static int __NeighborhoodQuery__AddExpandHop( vgx_NeighborhoodQuery_t *self, vgx_ArcConditionSet_t **arc_condition_set, int64_t fanout ) {
+  if( self->expand_condition == NULL ) {
+    if( (self->expand_condition = calloc( 1, sizeof( vgx_ExpandCondition_t ) )) == NULL ) {
+      return -1;
+    }
+  }
+  vgx_ExpandCondition_t *expand = self->expand_condition;
+  if( expand->n_hops >= VGX_EXPAND_MAX_HOPS ) {
+    return -1;
+  }
+  vgx_ExpandHop_t *hop = &expand->hop[ expand->n_hops++ ];
+  // Steal the arc condition set
+  hop->arc_condition_set = *arc_condition_set;
+  *arc_condition_set = NULL;
+  hop->fanout = fanout;
+  return expand->n_hops;
+}
+#define __Define__AddExpandHop( Class )                                                                       \
+static int AddExpandHop_##Class( Class *self, vgx_ArcConditionSet_t **arc_condition_set, int64_t fanout ) {  \
+  return __NeighborhoodQuery__AddExpandHop( (vgx_NeighborhoodQuery_t*)self, arc_condition_set, fanout );      \
+}
+#define __FunctionName__AddExpandHop( Class ) AddExpandHop_##Class
+
+
+
+/*******************************************************************//**
+ * SetPageRankCondition
+ *
+ ***********************************************************************
+ */
+__inline static void __GlobalQuery__SetPageRankCondition( vgx_GlobalQuery_t *self, vgx_PageRankCondition_t **pagerank_condition ) {
+  iGraphQuery.DeletePageRankCondition( &self->pagerank_condition );
+  // Steal the pagerank condition
+  self->pagerank_condition = *pagerank_condition;
+  *pagerank_condition = NULL;
+}
+#define __Define__SetPageRankCondition( Class )                                                                 \
+static void SetPageRankCondition_##Class( Class *self, vgx_PageRankCondition_t **pagerank_condition ) {        \
+  __GlobalQuery__SetPageRankCondition( (vgx_GlobalQuery_t*)self, pagerank_condition );                        \
+}
+#define __FunctionName__SetPageRankCondition( Class ) SetPageRankCondition_##Class
+
+
+
 
 
 
@@ -822,12 +894,14 @@ static vgx_aggregator_predicator_value_t AggregatePredicatorValue_##Class( Class
 #define __Define__NeighborhoodQuery_Methods( Class )  \
   __Define__AdjacencyQuery_Methods( Class )           \
   __Define__SetResponseFormat( Class )                \
-  __Define__SelectStatement( Class )
+  __Define__SelectStatement( Class )                  \
+  __Define__AddExpandHop( Class )
 
 #define __NeighborhoodQuery_vtable_entries( Class )                 \
   __AdjacencyQuery_vtable_entries( Class ),                         \
   .SetResponseFormat = __FunctionName__SetResponseFormat( Class ),  \
-  .SelectStatement = __FunctionName__SelectStatement( Class )
+  .SelectStatement = __FunctionName__SelectStatement( Class ),      \
+  .AddExpandHop = __FunctionName__AddExpandHop( Class )
 
 
 /*******************************************************************//**
@@ -837,12 +911,14 @@ static vgx_aggregator_predicator_value_t AggregatePredicatorValue_##Class( Class
 #define __Define__GlobalQuery_Methods( Class )  \
   __Define__BaseQuery_Methods( Class )          \
   __Define__SetResponseFormat( Class )          \
-  __Define__SelectStatement( Class )
+  __Define__SelectStatement( Class )            \
+  __Define__SetPageRankCondition( Class )
 
 #define __GlobalQuery_vtable_entries( Class )                       \
   __BaseQuery_vtable_entries( Class ),                              \
   .SetResponseFormat = __FunctionName__SetResponseFormat( Class ),  \
-  .SelectStatement = __FunctionName__SelectStatement( Class )
+  .SelectStatement = __FunctionName__SelectStatement( Class ),      \
+  .SetPageRankCondition = __FunctionName__SetPageRankCondition( Class )
 
 
 /*******************************************************************//**
@@ -1156,6 +1232,7 @@ static vgx_NeighborhoodQuery_t * NeighborhoodQuery_constructor( const void *iden
     self->selector = NULL;
     self->offset = 0;    // no offset
     self->hits   = -1;   // unlimited
+    memset( &self->cursor, 0, sizeof( vgx_CollectorCursor_t ) ); // no cursor
     self->collector = NULL; //
 
     // 7. Set the collector mode
@@ -1167,6 +1244,9 @@ static vgx_NeighborhoodQuery_t * NeighborhoodQuery_constructor( const void *iden
       *args->collect_arc_condition_set = NULL;
     }
 
+    // 9. No multi-hop expansion
+    self->expand_condition = NULL;
+
   }
   XCATCH( errcode ) {
     if( self ) {
@@ -1232,6 +1312,7 @@ static vgx_GlobalQuery_t * GlobalQuery_constructor( const void *identifier, vgx_
 
     self->collector_mode = args->collector_mode;
     self->evaluator_memory = NULL;
+    self->pagerank_condition = NULL;
 
     // 6. Set specific vertex if applicable
     const char *vertex_id = args->vertex_id ? args->vertex_id : "*";
@@ -1247,6 +1328,7 @@ static vgx_GlobalQuery_t * GlobalQuery_constructor( const void *identifier, vgx_
     self->selector  = NULL;
     self->offset    = 0;    // no offset
     self->hits      = -1;   // unlimited
+    memset( &self->cursor, 0, sizeof( vgx_CollectorCursor_t ) ); // no cursor
     self->collector = NULL; //
   }
   XCATCH( errcode ) {
@@ -1488,6 +1570,22 @@ static vgx_VertexCondition_t * _vxquery_query__clone_vertex_condition( const vgx
       iVertexProperty.CloneValueConditionInto( &self->advanced.timestamp_condition->tmx_valcond, &other->advanced.timestamp_condition->tmx_valcond );
     }
 
+    // geo
+    if( other->advanced.geo_condition ) {
+      const vgx_GeoCondition_t *geo = other->advanced.geo_condition;
+      if( (self->advanced.geo_condition = __new_geo_condition( geo->positive, geo->lat, geo->lon, geo->radius )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x754 );
+      }
+    }
+
+    // text
+    if( other->advanced.text_condition ) {
+      const vgx_TextCondition_t *text = other->advanced.text_condition;
+      if( (self->advanced.text_condition = __new_text_condition( text->positive, CStringValue( text->CSTR__key ), CStringValue( text->CSTR__terms ), text->mode )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x764 );
+      }
+    }
+
     // similarity
     if( other->advanced.similarity_condition ) {
       if( (self->advanced.similarity_condition = calloc( 1, sizeof( vgx_SimilarityCondition_t ) )) == NULL ) {
@@ -1680,6 +1778,12 @@ static void __clear_vertex_condition( vgx_VertexCondition_t *vertex_condition )
     // Discard any timestamp conditions
     __delete_timestamp_condition( &vertex_condition->advanced.timestamp_condition);
 
+    // Discard any geo condition
+    __delete_geo_condition( &vertex_condition->advanced.geo_condition );
+
+    // Discard any text condition
+    __delete_text_condition( &vertex_condition->advanced.text_condition );
+
     // Discard any conditional degree
     __delete_degree_condition( &vertex_condition->advanced.degree_condition );
 
@@ -2342,6 +2446,111 @@ static int _vxquery_query__set_vertex_condition_require_TMX( vgx_VertexCondition
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static vgx_GeoCondition_t * __new_geo_condition( bool positive, double lat, double lon, double radius ) {
+  vgx_GeoCondition_t *condition = NULL;
+  if( (condition = calloc( 1, sizeof( vgx_GeoCondition_t ) )) != NULL ) {
+    condition->positive = positive;
+    condition->lat = lat;
+    condition->lon = lon;
+    condition->radius = radius;
+  }
+  return condition;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_geo_condition( vgx_GeoCondition_t **geo_condition ) {
+  if( geo_condition && *geo_condition ) {
+    free( *geo_condition );
+    *geo_condition = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Require vertex position to be within radius meters of lat/lon.
+ * Replaces any previous geo condition.
+ ***********************************************************************
+ */
+static int _vxquery_query__set_vertex_condition_require_geo( vgx_VertexCondition_t *vertex_condition, bool positive, double lat, double lon, double radius ) {
+  if( lat < -90.0 || lat > 90.0 || lon < -180.0 || lon > 180.0 || !(radius >= 0.0) ) {
+    return -1;
+  }
+  __delete_geo_condition( &vertex_condition->advanced.geo_condition );
+  if( (vertex_condition->advanced.geo_condition = __new_geo_condition( positive, lat, lon, radius )) == NULL ) {
+    return -1;
+  }
+  _vgx_vertex_condition_add_advanced( &vertex_condition->spec );
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static vgx_TextCondition_t * __new_text_condition( bool positive, const char *key, const char *terms, vgx_TextMatchMode mode ) {
+  vgx_TextCondition_t *condition = NULL;
+  if( (condition = calloc( 1, sizeof( vgx_TextCondition_t ) )) != NULL ) {
+    condition->positive = positive;
+    condition->mode = mode;
+    if( (condition->CSTR__key = CStringNew( key )) == NULL || (condition->CSTR__terms = CStringNew( terms )) == NULL ) {
+      __delete_text_condition( &condition );
+    }
+  }
+  return condition;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_text_condition( vgx_TextCondition_t **text_condition ) {
+  if( text_condition && *text_condition ) {
+    iString.Discard( &(*text_condition)->CSTR__key );
+    iString.Discard( &(*text_condition)->CSTR__terms );
+    free( *text_condition );
+    *text_condition = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Require text in string property key to contain the terms according
+ * to mode. Replaces any previous text condition.
+ ***********************************************************************
+ */
+static int _vxquery_query__set_vertex_condition_require_text( vgx_VertexCondition_t *vertex_condition, bool positive, const char *key, const char *terms, vgx_TextMatchMode mode ) {
+  if( key == NULL || terms == NULL ) {
+    return -1;
+  }
+  __delete_text_condition( &vertex_condition->advanced.text_condition );
+  if( (vertex_condition->advanced.text_condition = __new_text_condition( positive, key, terms, mode )) == NULL ) {
+    return -1;
+  }
+  _vgx_vertex_condition_add_advanced( &vertex_condition->spec );
+  return 0;
+}
+
+
+
 /*******************************************************************//**
  *
  * STEALS the vertex condition if not NULL or pointer to NULL pointer
@@ -2624,6 +2833,28 @@ static int _vxquery_query__has_vertex_condition_TMX( const vgx_VertexCondition_t
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int _vxquery_query__has_vertex_condition_geo( const vgx_VertexCondition_t *vertex_condition ) {
+  return vertex_condition->advanced.geo_condition != NULL;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int _vxquery_query__has_vertex_condition_text( const vgx_VertexCondition_t *vertex_condition ) {
+  return vertex_condition->advanced.text_condition != NULL;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -3925,6 +4156,136 @@ static vgx_AdjacencyQuery_t * _vxquery_query__new_default_adjacency_query( vgx_G
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __delete_expand_condition( vgx_ExpandCondition_t **expand ) {
+  if( expand && *expand ) {
+    for( int i=0; i<(*expand)->n_hops; i++ ) {
+      iArcConditionSet.Delete( &(*expand)->hop[i].arc_condition_set );
+    }
+    free( *expand );
+    *expand = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static vgx_ExpandCondition_t * __clone_expand_condition( const vgx_ExpandCondition_t *other ) {
+  vgx_ExpandCondition_t *expand = calloc( 1, sizeof( vgx_ExpandCondition_t ) );
+  if( expand ) {
+    for( int i=0; i<other->n_hops; i++ ) {
+      const vgx_ExpandHop_t *src = &other->hop[i];
+      vgx_ExpandHop_t *dest = &expand->hop[i];
+      if( src->arc_condition_set && (dest->arc_condition_set = iArcConditionSet.Clone( src->arc_condition_set )) == NULL ) {
+        __delete_expand_condition( &expand );
+        return NULL;
+      }
+      dest->fanout = src->fanout;
+      expand->n_hops++;
+    }
+  }
+  return expand;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static vgx_PageRankCondition_t * _vxquery_query__new_pagerank_condition( int n_seeds, int n_weights ) {
+  vgx_PageRankCondition_t *pagerank = calloc( 1, sizeof( vgx_PageRankCondition_t ) );
+  if( pagerank ) {
+    if( (n_seeds > 0 && (pagerank->seeds = calloc( n_seeds, sizeof( vgx_PageRankSeed_t ) )) == NULL) ||
+        (n_weights > 0 && (pagerank->weights = calloc( n_weights, sizeof( vgx_PageRankWeight_t ) )) == NULL) )
+    {
+      _vxquery_query__delete_pagerank_condition( &pagerank );
+      return NULL;
+    }
+    pagerank->n_seeds = n_seeds;
+    pagerank->n_weights = n_weights;
+    pagerank->alpha = VGX_PAGERANK_DEFAULT_ALPHA;
+    pagerank->epsilon = VGX_PAGERANK_DEFAULT_EPSILON;
+    pagerank->max_iterations = VGX_PAGERANK_DEFAULT_MAX_ITERATIONS;
+    pagerank->max_vertices = VGX_PAGERANK_DEFAULT_MAX_VERTICES;
+  }
+  return pagerank;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void _vxquery_query__delete_pagerank_condition( vgx_PageRankCondition_t **pagerank_condition ) {
+  if( pagerank_condition && *pagerank_condition ) {
+    vgx_PageRankCondition_t *pagerank = *pagerank_condition;
+    if( pagerank->seeds ) {
+      for( int i=0; i<pagerank->n_seeds; i++ ) {
+        iString.Discard( &pagerank->seeds[i].CSTR__id );
+      }
+      free( pagerank->seeds );
+    }
+    if( pagerank->weights ) {
+      for( int i=0; i<pagerank->n_weights; i++ ) {
+        iString.Discard( &pagerank->weights[i].CSTR__relationship );
+      }
+      free( pagerank->weights );
+    }
+    iArcConditionSet.Delete( &pagerank->arc_condition_set );
+    free( pagerank );
+    *pagerank_condition = NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static vgx_PageRankCondition_t * __clone_pagerank_condition( const vgx_PageRankCondition_t *other ) {
+  vgx_PageRankCondition_t *pagerank = _vxquery_query__new_pagerank_condition( other->n_seeds, other->n_weights );
+  if( pagerank ) {
+    bool ok = true;
+    for( int i=0; i<other->n_seeds && ok; i++ ) {
+      ok = (pagerank->seeds[i].CSTR__id = CStringClone( other->seeds[i].CSTR__id )) != NULL;
+      pagerank->seeds[i].weight = other->seeds[i].weight;
+    }
+    for( int i=0; i<other->n_weights && ok; i++ ) {
+      ok = (pagerank->weights[i].CSTR__relationship = CStringClone( other->weights[i].CSTR__relationship )) != NULL;
+      pagerank->weights[i].weight = other->weights[i].weight;
+    }
+    if( ok && other->arc_condition_set ) {
+      ok = (pagerank->arc_condition_set = iArcConditionSet.Clone( other->arc_condition_set )) != NULL;
+    }
+    if( !ok ) {
+      _vxquery_query__delete_pagerank_condition( &pagerank );
+      return NULL;
+    }
+    pagerank->alpha = other->alpha;
+    pagerank->epsilon = other->epsilon;
+    pagerank->max_iterations = other->max_iterations;
+    pagerank->max_vertices = other->max_vertices;
+    pagerank->arcvalue = other->arcvalue;
+  }
+  return pagerank;
+}
+
+
+
 /*******************************************************************//**
  *
  * 
@@ -3963,6 +4324,7 @@ static void _vxquery_query__reset_neighborhood_query( vgx_NeighborhoodQuery_t *q
   // Reset parameters
   query->hits = -1;
   query->offset = 0;
+  memset( &query->cursor, 0, sizeof( vgx_CollectorCursor_t ) );
 
   // Discard selector
   if( query->selector ) {
@@ -3972,6 +4334,9 @@ static void _vxquery_query__reset_neighborhood_query( vgx_NeighborhoodQuery_t *q
   // Delete the collect condition
   iArcConditionSet.Delete( &query->collect_arc_condition_set );
 
+  // Delete the expansion hops
+  __delete_expand_condition( &query->expand_condition );
+
   // Clear and initialize the adjacency portion of the neighborhood query
   iGraphQuery.ResetAdjacencyQuery( (vgx_AdjacencyQuery_t*)query );
 
@@ -4077,6 +4442,7 @@ static void _vxquery_query__reset_global_query( vgx_GlobalQuery_t *query ) {
   // Reset parameters
   query->hits = -1;
   query->offset = 0;
+  memset( &query->cursor, 0, sizeof( vgx_CollectorCursor_t ) );
 
   // Discard selector
   if( query->selector ) {
@@ -4086,6 +4452,9 @@ static void _vxquery_query__reset_global_query( vgx_GlobalQuery_t *query ) {
   // Discard specific vertex id
   iString.Discard( (CString_t**)&query->CSTR__vertex_id );
 
+  // Delete the pagerank condition
+  _vxquery_query__delete_pagerank_condition( &query->pagerank_condition );
+
   // Clear and initialize the base query
   __clear_base_query( (vgx_BaseQuery_t*)query );
 }
@@ -4275,6 +4644,7 @@ static vgx_NeighborhoodQuery_t * _vxquery_query__clone_neighborhood_query( const
     self->fieldmask = other->fieldmask;
     self->offset = other->offset;
     self->hits = other->hits;
+    self->cursor = other->cursor;
 
     // 3. destroy previous result if any
     // a) Collector
@@ -4287,6 +4657,14 @@ static vgx_NeighborhoodQuery_t * _vxquery_query__clone_neighborhood_query( const
 
     // 4. collector mode
     self->collector_mode = other->collector_mode;
+
+    // 5. expansion hops
+    if( other->expand_condition ) {
+      if( (self->expand_condition = __clone_expand_condition( other->expand_condition )) == NULL ) {
+        iGraphQuery.DeleteNeighborhoodQuery( &self );
+        return NULL;
+      }
+    }
   }
   return self;
 }
@@ -4314,8 +4692,17 @@ static vgx_GlobalQuery_t * _vxquery_query__clone_global_query( const vgx_GlobalQ
     self->fieldmask = other->fieldmask;
     self->offset = other->offset;
     self->hits = other->hits;
+    self->cursor = other->cursor;
+
+    // 4. Copy pagerank condition
+    if( other->pagerank_condition ) {
+      if( (self->pagerank_condition = __clone_pagerank_condition( other->pagerank_condition )) == NULL ) {
+        iGraphQuery.DeleteGlobalQuery( &self );
+        return NULL;
+      }
+    }
 
-    // 4. destroy previous result if any
+    // 5. destroy previous result if any
     // a) Collector
     if( self->collector ) {
       // NOTE: SPECIAL CASE, DO NOT COPY THE RESULT OF A GLOBAL QUERY!!
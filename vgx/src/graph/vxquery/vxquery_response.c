@@ -102,6 +102,8 @@ static void _vxquery_response__delete_properties( vgx_Graph_t *self, vgx_SelectP
 static void _vxquery_response__format_results_to_stream( vgx_Graph_t *self, vgx_BaseQuery_t *query, FILE *output );
 static vgx_VertexProperty_t * _vxquery_response__select_property( vgx_Graph_t *graph, const char *name, vgx_VertexProperty_t *prop );
 static vgx_Evaluator_t * _vxquery_response__parse_select_properties( vgx_Graph_t *graph, const char *select_statement, vgx_Vector_t *vector, CString_t **CSTR__error );
+static const char * _vxquery_response__encode_cursor( const vgx_CollectorCursor_t *cursor, char *token );
+static int _vxquery_response__decode_cursor( const char *token, vgx_CollectorCursor_t *cursor, CString_t **CSTR__error );
 static char * __prepare_select_statement( const char *select_statement, CString_t **CSTR__error );
 
 /*******************************************************************//**
@@ -119,7 +121,9 @@ DLL_EXPORT vgx_IGraphResponse_t iGraphResponse = {
   .DeleteProperties         = _vxquery_response__delete_properties,
   .FormatResultsToStream    = _vxquery_response__format_results_to_stream,
   .SelectProperty           = _vxquery_response__select_property,
-  .ParseSelectProperties    = _vxquery_response__parse_select_properties
+  .ParseSelectProperties    = _vxquery_response__parse_select_properties,
+  .EncodeCursor             = _vxquery_response__encode_cursor,
+  .DecodeCursor             = _vxquery_response__decode_cursor
 };
 
 
@@ -1283,6 +1287,7 @@ static int64_t __build_response_list( vgx_SearchResult_t *search_result ) {
     CSTR__root_anchor = ((vgx_NeighborhoodQuery_t*)search_result->query)->CSTR__anchor_id;
     search_result->total_neighbors = ((vgx_NeighborhoodQuery_t*)search_result->query)->n_neighbors;
     search_result->total_arcs = ((vgx_NeighborhoodQuery_t*)search_result->query)->n_arcs;
+    search_result->plan = ((vgx_NeighborhoodQuery_t*)search_result->query)->plan;
     break;
   case VGX_QUERY_TYPE_GLOBAL:
     collector = ((vgx_GlobalQuery_t*)search_result->query)->collector;
@@ -1478,6 +1483,17 @@ if( SingleFieldBitmask & Remain )  {                                  \
     }
   }
 
+  // Keyset cursor positions are captured for each listed item
+  const vgx_CollectorCursor_t *collector_cursor = collector->cursor.enabled ? &collector->cursor : NULL;
+  vgx_CollectorCursor_t *pcur = NULL;
+  vgx_CollectorItem_t *last = end - 1;
+  if( collector_cursor ) {
+    if( (search_result->cursors = calloc( search_result->list_length, sizeof( vgx_CollectorCursor_t ) )) == NULL ) {
+      return -1;
+    }
+    pcur = search_result->cursors;
+  }
+
   static const vgx_VertexCompleteIdentifier_t zero_identifier = {0};
 
   static const vgx_ResponseAttrFastMask CS_REQUIRED_MASK = VGX_RESPONSE_ATTR_RELTYPE | VGX_RESPONSE_ATTR_TYPENAME | VGX_RESPONSE_ATTR_VECTOR | VGX_RESPONSE_ATTR_PROPERTY;
@@ -1485,6 +1501,11 @@ if( SingleFieldBitmask & Remain )  {                                  \
   int64_t n_dummy = 0;
 
   while( (collected=cursor++) < end ) {
+    // Next page resumes after the last collected item, whether rendered or not
+    if( collected == last && collector_cursor && collected->headref && collected->headref->refcnt > 0 ) {
+      _vxarcvector_comparator__set_cursor_position( &search_result->next_cursor, collector_cursor->key, collected );
+    }
+
     // Omit results with time-class modifiers unless time modifiers enabled
     vgx_predicator_t predicator = collected->predicator;
     if( !fields.include_mod_tm && _vgx_predicator_mod_is_time( predicator ) ) {
@@ -1539,6 +1560,11 @@ if( SingleFieldBitmask & Remain )  {                                  \
 
     // COUNT
     ++n_items;
+
+    // Keyset position of this item
+    if( pcur ) {
+      _vxarcvector_comparator__set_cursor_position( pcur++, collector_cursor->key, collected );
+    }
     
 
     if( single_pred_element ) {
@@ -1774,6 +1800,14 @@ if( SingleFieldBitmask & Remain )  {                                  \
     free( render_as_string_fieldmap );
   }
 
+  // A page shorter than requested hits is the last page
+  if( collector_cursor ) {
+    int64_t hits = search_result->query->type == VGX_QUERY_TYPE_NEIGHBORHOOD ? ((vgx_NeighborhoodQuery_t*)search_result->query)->hits : ((vgx_GlobalQuery_t*)search_result->query)->hits;
+    if( hits < 0 || search_result->list_length < hits ) {
+      search_result->next_cursor.positioned = false;
+    }
+  }
+
   // Some results were omitted
   if( search_result->list_length != n_items ) {
     // Account for omitted items
@@ -1822,6 +1856,11 @@ static int64_t _vxquery_response__build_search_result( vgx_Graph_t *self, const
 
     query->search_result->tail_identifiers = NULL;
     query->search_result->head_identifiers = NULL;
+    query->search_result->cursors = NULL;
+
+    // Cursor pagination is reported even when no items are listed
+    const vgx_CollectorCursor_t *query_cursor = vgx_query_cursor( query );
+    query->search_result->next_cursor.enabled = query_cursor && query_cursor->enabled;
 
     query->search_result->graph = self;
 
@@ -1858,6 +1897,145 @@ static int64_t _vxquery_response__build_default_search_result( vgx_Graph_t *self
 
 
 
+/*******************************************************************//**
+ * Cursor token key characters, indexed by vgx_CollectorFloorGate_t
+ ***********************************************************************
+ */
+static const char __cursor_key_chars[] = "-DdIiUuWw";
+
+
+
+/*******************************************************************//**
+ * Map a sort value to an unsigned integer with the same ordering so that
+ * lexical comparison of tokens follows the sort order of the values.
+ ***********************************************************************
+ */
+static uint64_t __cursor_sort_to_ordered( vgx_CollectorFloorGate_t key, vgx_VertexSortValue_t sort ) {
+  switch( key ) {
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC:
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC:
+    return (sort.uint64.value & 0x8000000000000000ULL) ? ~sort.uint64.value : sort.uint64.value | 0x8000000000000000ULL;
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_DESC:
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_ASC:
+    return sort.uint64.value ^ 0x8000000000000000ULL;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC:
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC:
+    return sort.uint32.value;
+  default:
+    return sort.uint64.value;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Inverse of __cursor_sort_to_ordered()
+ ***********************************************************************
+ */
+static vgx_VertexSortValue_t __cursor_sort_from_ordered( vgx_CollectorFloorGate_t key, uint64_t ordered ) {
+  vgx_VertexSortValue_t sort = {0};
+  switch( key ) {
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC:
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC:
+    sort.uint64.value = (ordered & 0x8000000000000000ULL) ? ordered & ~0x8000000000000000ULL : ~ordered;
+    break;
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_DESC:
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_ASC:
+    sort.uint64.value = ordered ^ 0x8000000000000000ULL;
+    break;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC:
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC:
+    sort.uint32.value = (uint32_t)ordered;
+    break;
+  default:
+    sort.uint64.value = ordered;
+  }
+  return sort;
+}
+
+
+
+/*******************************************************************//**
+ * Render a positioned cursor as an opaque token into a buffer of at least
+ * VGX_COLLECTOR_CURSOR_TOKEN_SIZE bytes. Tokens produced by the same query
+ * compare lexically in the same order as the items they identify, which
+ * allows tokens to be used as sort keys when merging partial results.
+ * Return the token, or NULL if the cursor is not positioned.
+ ***********************************************************************
+ */
+static const char * _vxquery_response__encode_cursor( const vgx_CollectorCursor_t *cursor, char *token ) {
+  if( cursor == NULL || !cursor->positioned || cursor->key <= VGX_COLLECTOR_FLOOR_GATE_NONE || cursor->key > VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC ) {
+    return NULL;
+  }
+  snprintf( token, VGX_COLLECTOR_CURSOR_TOKEN_SIZE, "%c%016llx%016llx%016llx%016llx%016llx%016llx",
+            __cursor_key_chars[ cursor->key ],
+            (unsigned long long)__cursor_sort_to_ordered( cursor->key, cursor->sort ),
+            (unsigned long long)cursor->head.H,
+            (unsigned long long)cursor->head.L,
+            (unsigned long long)cursor->tail.H,
+            (unsigned long long)cursor->tail.L,
+            (unsigned long long)cursor->predicator_data );
+  return token;
+}
+
+
+
+/*******************************************************************//**
+ * Parse an opaque cursor token. An empty token enables cursor pagination
+ * starting at the first page.
+ * Return 0 on success, -1 on error with the error string set.
+ ***********************************************************************
+ */
+static int _vxquery_response__decode_cursor( const char *token, vgx_CollectorCursor_t *cursor, CString_t **CSTR__error ) {
+  memset( cursor, 0, sizeof( vgx_CollectorCursor_t ) );
+  if( token == NULL ) {
+    return 0;
+  }
+
+  cursor->enabled = true;
+  if( *token == '\0' ) {
+    return 0;
+  }
+
+  const char *p = strchr( __cursor_key_chars + 1, *token );
+  if( p == NULL || strlen( token ) != VGX_COLLECTOR_CURSOR_TOKEN_SIZE - 1 ) {
+    __set_error_string( CSTR__error, "invalid cursor" );
+    return -1;
+  }
+  cursor->key = (vgx_CollectorFloorGate_t)(p - __cursor_key_chars);
+
+  QWORD fields[6];
+  const char *hex = token + 1;
+  for( int i=0; i<6; i++ ) {
+    QWORD q = 0;
+    for( int k=0; k<16; k++ ) {
+      char c = *hex++;
+      if( c >= '0' && c <= '9' ) {
+        q = (q << 4) | (QWORD)(c - '0');
+      }
+      else if( c >= 'a' && c <= 'f' ) {
+        q = (q << 4) | (QWORD)(c - 'a' + 10);
+      }
+      else {
+        __set_error_string( CSTR__error, "invalid cursor" );
+        return -1;
+      }
+    }
+    fields[i] = q;
+  }
+
+  cursor->sort = __cursor_sort_from_ordered( cursor->key, fields[0] );
+  cursor->head.H = fields[1];
+  cursor->head.L = fields[2];
+  cursor->tail.H = fields[3];
+  cursor->tail.L = fields[4];
+  cursor->predicator_data = fields[5];
+  cursor->positioned = true;
+  return 0;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1983,6 +2161,10 @@ static void _vxquery_response__delete_search_result( vgx_SearchResult_t **search
       ALIGNED_FREE( sr->head_identifiers );
     }
 
+    if( sr->cursors ) {
+      free( sr->cursors );
+    }
+
     // Delete the search_result structure
     free( *search_result );
 
@@ -24,6 +24,7 @@
  *****************************************************************************/
 
 #include "_vxtraverse.h"
+#include "_vxarcvector.h"
 
 /* exception module */
 SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
@@ -35,9 +36,13 @@ static vgx_collect_counts_t _vxquery_traverse__get_global_collectable_counts( vg
 static int64_t _vxquery_traverse__validate_neighborhood_collectable_counts( vgx_Graph_t *self, bool readonly_graph, vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO );
 static int64_t _vxquery_traverse__validate_global_collectable_counts( vgx_Graph_t *self, vgx_GlobalQuery_t *query );
 static int _vxquery_traverse__traverse_neighbor_arcs_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search );
+static int _vxquery_traverse__traverse_neighbor_arcs_parallel_OPEN_RO( vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search );
 static int _vxquery_traverse__traverse_neighbor_vertices_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search );
 static int _vxquery_traverse__traverse_global_items_OPEN( vgx_Graph_t *self, vgx_global_search_context_t *search, bool readonly_graph );
 static int _vxquery_traverse__aggregate_neighborhood_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_aggregator_search_context_t *search );
+static vgx_neighborhood_expansion_t * _vxquery_traverse__new_neighborhood_expansion_OPEN_RO( vgx_Graph_t *self, bool readonly_graph, vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO );
+static int _vxquery_traverse__traverse_expanded_neighborhood_OPEN( vgx_neighborhood_expansion_t *expansion, vgx_neighborhood_search_context_t *search );
+static void _vxquery_traverse__delete_neighborhood_expansion( vgx_neighborhood_expansion_t **expansion );
 
 
 
@@ -52,9 +57,13 @@ DLL_HIDDEN IGraphTraverse_t iGraphTraverse = {
   .ValidateNeighborhoodCollectableCounts  = _vxquery_traverse__validate_neighborhood_collectable_counts,
   .ValidateGlobalCollectableCounts        = _vxquery_traverse__validate_global_collectable_counts,
   .TraverseNeighborArcs                   = _vxquery_traverse__traverse_neighbor_arcs_OPEN_RO,
+  .TraverseNeighborArcsParallel           = _vxquery_traverse__traverse_neighbor_arcs_parallel_OPEN_RO,
   .TraverseNeighborVertices               = _vxquery_traverse__traverse_neighbor_vertices_OPEN_RO,
   .TraverseGlobalItems                    = _vxquery_traverse__traverse_global_items_OPEN,
   .AggregateNeighborhood                  = _vxquery_traverse__aggregate_neighborhood_OPEN_RO,
+  .NewNeighborhoodExpansion               = _vxquery_traverse__new_neighborhood_expansion_OPEN_RO,
+  .TraverseExpandedNeighborhood           = _vxquery_traverse__traverse_expanded_neighborhood_OPEN,
+  .DeleteNeighborhoodExpansion            = _vxquery_traverse__delete_neighborhood_expansion,
 };
 
 
@@ -317,12 +326,378 @@ static int64_t _vxquery_traverse__validate_global_collectable_counts( vgx_Graph_
 
 
 
+/*******************************************************************//**
+ * Evaluator result for an arc does not depend on which other arcs were
+ * visited, i.e. a pure expression without memory, lookback, culling or
+ * synthetic arcs. Such evaluators may run on any subset of arcs in any
+ * order.
+ ***********************************************************************
+ */
+__inline static bool __is_pure_evaluator( vgx_Evaluator_t *evaluator ) {
+  if( evaluator == NULL ) {
+    return true;
+  }
+  vgx_Evaluator_vtable_t *iEval = CALLABLE( evaluator );
+  return !iEval->HasCull( evaluator )
+         && iEval->SynArcOps( evaluator ) == 0
+         && iEval->WRegOps( evaluator ) == 0
+         && iEval->MemoryOps( evaluator ) == 0
+         && iEval->PrevDeref( evaluator ) == 0;
+}
+
+
+
+/*******************************************************************//**
+ * Pure evaluator that also does not access the current or next vertex,
+ * and may therefore run concurrently in parallel traversal workers.
+ ***********************************************************************
+ */
+__inline static bool __is_partitionable_evaluator( vgx_Evaluator_t *evaluator ) {
+  return __is_pure_evaluator( evaluator ) && (evaluator == NULL || CALLABLE( evaluator )->ThisNextAccess( evaluator ) == 0);
+}
+
+
+
+/*******************************************************************//**
+ * Return the neighbor condition evaluated by the traversing filter
+ ***********************************************************************
+ */
+static const vgx_vertex_probe_t * __get_neighbor_probe( vgx_neighborhood_probe_t *probe ) {
+  vgx_virtual_ArcFilter_context_t *traverse_filter = probe->traversing.arcfilter;
+  if( traverse_filter && _vgx_arcfilter_has_vertex_probe( traverse_filter->type ) ) {
+    return ((vgx_GenericArcFilter_context_t*)traverse_filter)->vertex_probe;
+  }
+  return probe->traversing.vertex_probe;
+}
+
+
+
 /*******************************************************************//**
  *
  *
  ***********************************************************************
  */
-static int _vxquery_traverse__traverse_neighbor_arcs_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
+static bool __has_evaluators( vgx_neighborhood_search_context_t *search, bool (*accept)( vgx_Evaluator_t *evaluator ) ) {
+  vgx_neighborhood_probe_t *probe = search->probe;
+  const vgx_vertex_probe_t *vertex_probe = __get_neighbor_probe( probe );
+  return accept( search->pre_evaluator )
+         && accept( search->vertex_evaluator )
+         && accept( search->post_evaluator )
+         && accept( search->ranking_context ? search->ranking_context->evaluator : NULL )
+         && accept( probe->traversing.evaluator )
+         && accept( probe->conditional.evaluator )
+         && (vertex_probe == NULL || (accept( vertex_probe->advanced.local_evaluator.filter ) && accept( vertex_probe->advanced.local_evaluator.post )));
+}
+
+
+
+#define __PLAN_MAX_TERMINALS 16
+
+
+
+/*******************************************************************//**
+ * Return the terminals a neighbor must be adjacent to for its arc from
+ * the anchor to match, or NULL if the neighbor condition has no such
+ * requirement or the traversal cannot be restricted to a subset of the
+ * anchor's arcs. The direction of the neighbor's arc to the terminal
+ * is returned in terminal_arcdir.
+ ***********************************************************************
+ */
+static const vgx_ArcFilterTerminal_t * __get_plannable_terminal( vgx_neighborhood_search_context_t *search, vgx_arc_direction *terminal_arcdir ) {
+  vgx_neighborhood_probe_t *probe = search->probe;
+
+  // Neighbor condition must be a positive match evaluated by the traversing filter
+  vgx_virtual_ArcFilter_context_t *traverse_filter = probe->traversing.arcfilter;
+  if( traverse_filter == NULL || !_vgx_arcfilter_has_vertex_probe( traverse_filter->type ) ) {
+    return NULL;
+  }
+  const vgx_vertex_probe_t *neighbor_probe = ((vgx_GenericArcFilter_context_t*)traverse_filter)->vertex_probe;
+  if( neighbor_probe == NULL || neighbor_probe->vertexfilter_context == NULL ) {
+    return NULL;
+  }
+  if( !traverse_filter->positive_match
+      || !neighbor_probe->vertexfilter_context->positive_match
+      || __arcfilter_get_cull_evaluator( traverse_filter ) )
+  {
+    return NULL;
+  }
+
+  // Neighbor must have at least one arc matching the adjacency condition
+  vgx_neighborhood_probe_t *next = neighbor_probe->advanced.next.neighborhood_probe;
+  if( next == NULL || next->conditional.override.enable ) {
+    return NULL;
+  }
+  switch( _vgx_collector_mode_type( next->collector_mode ) ) {
+  case VGX_COLLECTOR_MODE_NONE_CONTINUE:
+  case VGX_COLLECTOR_MODE_NONE_STOP_AT_FIRST:
+    break;
+  default:
+    return NULL;
+  }
+
+  // Adjacency condition has exact terminal(s)
+  vgx_virtual_ArcFilter_context_t *conditional_filter = next->conditional.arcfilter;
+  if( conditional_filter == NULL || !_vgx_arcfilter_has_vertex_probe( conditional_filter->type ) || !conditional_filter->positive_match ) {
+    return NULL;
+  }
+  const vgx_ArcFilterTerminal_t *terminal = &((vgx_GenericArcFilter_context_t*)conditional_filter)->terminal;
+  if( terminal->logic == VGX_LOGICAL_NO_LOGIC || (terminal->current == NULL && terminal->list == NULL) ) {
+    return NULL;
+  }
+  switch( (*terminal_arcdir = next->conditional.arcdir) ) {
+  case VGX_ARCDIR_ANY:
+  case VGX_ARCDIR_IN:
+  case VGX_ARCDIR_OUT:
+    break;
+  default:
+    return NULL;
+  }
+
+  // Only pure expressions
+  if( !__has_evaluators( search, __is_pure_evaluator ) || !__is_pure_evaluator( next->conditional.evaluator ) || !__is_pure_evaluator( next->traversing.evaluator ) ) {
+    return NULL;
+  }
+
+  return terminal;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+typedef struct s___plan_candidates_t {
+  const vgx_Vertex_t **heads;
+  int64_t n;
+  int64_t capacity;
+} __plan_candidates_t;
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __plan_visit_candidate( void *context, const vgx_Arc_t *arc ) {
+  __plan_candidates_t *candidates = context;
+  if( candidates->n >= candidates->capacity ) {
+    return -1;
+  }
+  candidates->heads[ candidates->n++ ] = arc->head.vertex;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __compare_vertex_address( const void *a, const void *b ) {
+  uintptr_t x = (uintptr_t)*(const vgx_Vertex_t**)a;
+  uintptr_t y = (uintptr_t)*(const vgx_Vertex_t**)b;
+  return (x > y) - (x < y);
+}
+
+
+
+/*******************************************************************//**
+ * Plan the traversal of the anchor's arcs when the neighbor condition
+ * requires adjacency to one or a few terminals. If the terminals have
+ * fewer arcs leading to candidate neighbors than the anchor has arcs,
+ * the candidates are gathered from the terminals and only the anchor's
+ * arcs to those candidates are traversed. Candidates are intersected
+ * with the anchor's arcs by lookup, or by merge with a frozen array of
+ * arcs when lookups would cost more than a merge.
+ *
+ * The plan is accumulated in search->plan across traversal directions.
+ *
+ * Returns: 1 if candidates were set in probe, 0 if the anchor's arcs
+ *          are to be iterated, -1 on error
+ ***********************************************************************
+ */
+static int __plan_neighborhood_traversal_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
+  int ret = 0;
+  vgx_neighborhood_probe_t *probe = search->probe;
+  vgx_Graph_t *graph = probe->graph;
+  vgx_arc_direction arcdir = probe->traversing.arcdir;
+  vgx_arc_direction terminal_arcdir = VGX_ARCDIR_ANY;
+  const vgx_ArcFilterTerminal_t *terminal;
+
+  if( probe->partition.nparts > 1 || probe->candidates.heads != NULL || (arcdir != VGX_ARCDIR_IN && arcdir != VGX_ARCDIR_OUT) ) {
+    return 0;
+  }
+  if( (terminal = __get_plannable_terminal( search, &terminal_arcdir )) == NULL ) {
+    return 0;
+  }
+
+  const vgx_Vertex_t *single[2] = { terminal->current, NULL };
+  const vgx_Vertex_t **list = terminal->current ? single : terminal->list;
+  int n_terminals = 0;
+  while( list[ n_terminals ] != NULL ) {
+    if( ++n_terminals > __PLAN_MAX_TERMINALS ) {
+      return 0;
+    }
+  }
+
+  vgx_NeighborhoodPlan_t *plan = &search->plan;
+  plan->planned = true;
+
+  // Iterate small anchors
+  const vgx_ArcVector_cell_t *V = arcdir == VGX_ARCDIR_IN ? &vertex_RO->inarcs : &vertex_RO->outarcs;
+  int64_t anchor_degree = iGraphTraverse.GetNeighborhoodCollectableCounts( graph, probe->readonly_graph, vertex_RO, arcdir, 0, -1 ).data_size;
+  if( anchor_degree < 0 ) {
+    return -1;
+  }
+  plan->anchor_degree += anchor_degree;
+  _vgx_ArcVector_cell_type ctype = __arcvector_cell_type( V );
+  if( anchor_degree < VGX_NEIGHBORHOOD_PLAN_MIN_DEGREE || (ctype != VGX_ARCVECTOR_ARRAY_OF_ARCS && ctype != VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS) ) {
+    return 0;
+  }
+
+  // Terminals must be available immediately, otherwise iterate anchor
+  vgx_Vertex_t *terminals_RO[ __PLAN_MAX_TERMINALS ];
+  int n_locked = 0;
+  vgx_ExecutionTimingBudget_t zero_timeout = _vgx_get_graph_zero_execution_timing_budget( graph );
+  GRAPH_LOCK( graph ) {
+    for( ; n_locked < n_terminals; n_locked++ ) {
+      if( (terminals_RO[ n_locked ] = _vxgraph_state__lock_vertex_readonly_CS( graph, (vgx_Vertex_t*)list[ n_locked ], &zero_timeout, VGX_VERTEX_RECORD_NONE )) == NULL ) {
+        break;
+      }
+    }
+  } GRAPH_RELEASE;
+
+  __plan_candidates_t candidates = {0};
+
+  XTRY {
+    if( n_locked < n_terminals ) {
+      XBREAK;
+    }
+
+    // Neighbor has arc to terminal in direction terminal_arcdir, i.e. terminal has reverse arc to neighbor
+    bool terminal_inarcs = terminal_arcdir != VGX_ARCDIR_IN;
+    bool terminal_outarcs = terminal_arcdir != VGX_ARCDIR_OUT;
+    int64_t terminal_degree = 0;
+    for( int i=0; i<n_terminals; i++ ) {
+      int64_t deg_in = terminal_inarcs ? iarcvector.Degree( &terminals_RO[i]->inarcs ) : 0;
+      int64_t deg_out = terminal_outarcs ? iarcvector.Degree( &terminals_RO[i]->outarcs ) : 0;
+      if( deg_in < 0 || deg_out < 0 ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x014 );
+      }
+      terminal_degree += deg_in + deg_out;
+    }
+    plan->terminal_degree += terminal_degree;
+
+    // Iterate anchor if it has fewer arcs than terminals
+    if( terminal_degree >= anchor_degree ) {
+      XBREAK;
+    }
+
+    // Gather candidate neighbors from terminals
+    candidates.capacity = terminal_degree;
+    if( (candidates.heads = calloc( terminal_degree + 1, sizeof( vgx_Vertex_t* ) )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x015 );
+    }
+    for( int i=0; i<n_terminals; i++ ) {
+      vgx_Vertex_t *terminal_RO = terminals_RO[i];
+      if( (terminal_inarcs && iarcvector.Visit( terminal_RO, &terminal_RO->inarcs, NULL, __plan_visit_candidate, &candidates ) < 0)
+          ||
+          (terminal_outarcs && iarcvector.Visit( terminal_RO, &terminal_RO->outarcs, NULL, __plan_visit_candidate, &candidates ) < 0) )
+      {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x016 );
+      }
+    }
+
+    // Sort and remove duplicates (multiple arcs and shared neighbors)
+    if( candidates.n > 1 ) {
+      qsort( (void*)candidates.heads, candidates.n, sizeof( vgx_Vertex_t* ), __compare_vertex_address );
+      int64_t n = 1;
+      for( int64_t i=1; i<candidates.n; i++ ) {
+        if( candidates.heads[i] != candidates.heads[n-1] ) {
+          candidates.heads[n++] = candidates.heads[i];
+        }
+      }
+      candidates.n = n;
+    }
+    plan->candidates += candidates.n;
+
+    // Merge sorted candidates with frozen array when more efficient than binary search per candidate
+    bool merge = ctype == VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS && candidates.n * ilog2( anchor_degree ) > anchor_degree;
+
+    probe->candidates.heads = candidates.heads;
+    probe->candidates.n = candidates.n;
+    probe->candidates.merge = merge;
+    candidates.heads = NULL;
+
+    plan->iterate = VGX_NEIGHBORHOOD_PLAN_ITERATE_TERMINAL;
+    if( merge ) {
+      plan->intersect = VGX_NEIGHBORHOOD_PLAN_INTERSECT_MERGE;
+    }
+    ret = 1;
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+  }
+  XFINALLY {
+    free( (void*)candidates.heads );
+    if( n_locked > 0 ) {
+      GRAPH_LOCK( graph ) {
+        for( int i=0; i<n_locked; i++ ) {
+          _vxgraph_state__unlock_vertex_CS_LCK( graph, &terminals_RO[i], VGX_VERTEX_RECORD_NONE );
+        }
+        SIGNAL_VERTEX_AVAILABLE( graph );
+      } GRAPH_RELEASE;
+    }
+  }
+
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __clear_neighborhood_traversal_plan( vgx_neighborhood_probe_t *probe ) {
+  free( (void*)probe->candidates.heads );
+  probe->candidates.heads = NULL;
+  probe->candidates.n = 0;
+  probe->candidates.merge = false;
+}
+
+
+
+/*******************************************************************//**
+ * Traverse the anchor's arcs according to plan
+ ***********************************************************************
+ */
+static int __traverse_planned_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search, int (*traverse)( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) ) {
+  int planned;
+  if( (planned = __plan_neighborhood_traversal_OPEN_RO( vertex_RO, search )) < 0 ) {
+    __set_error_string( &search->CSTR__error, "Neighborhood planner error" );
+    return -1;
+  }
+  int ret = traverse( vertex_RO, search );
+  if( planned > 0 ) {
+    __clear_neighborhood_traversal_plan( search->probe );
+  }
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int __traverse_neighbor_arcs_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
   __assert_vertex_lock( vertex_RO );
 
   int ret = 0;
@@ -347,43 +722,376 @@ static int _vxquery_traverse__traverse_neighbor_arcs_OPEN_RO( const vgx_Vertex_t
       match = iarcvector.GetArcs( V1, search->probe );
     }
 
-    if( __is_arcfilter_error( match ) ) {
-      if( _vgx_is_execution_halted( tb ) ) {
-        if( tb->reason == VGX_ACCESS_REASON_EXECUTION_TIMEOUT ) {
-          __format_error_string( &search->CSTR__error, "Execution timeout after %d ms", (tb->tt_ms - tb->t0_ms) );
-        }
-        else {
-          const char *timeout = blocking ? "Timeout: " : "";
-          const char *neighbor = arcdir == VGX_ARCDIR_OUT ? "terminal" : arcdir == VGX_ARCDIR_IN ? "initial" : "neighbor";
-          const void *obj = tb->resource;
-          const vgx_Vertex_t *locked = vgx_CheckVertex( obj );
-          const char *idprefix = locked ? locked->identifier.idprefix.data : "?";
-          __format_error_string( &search->CSTR__error, "%s%s <%s@%p> is locked", timeout, neighbor, idprefix, obj );
-        }
-        THROW_SILENT( CXLIB_ERR_GENERAL, 0x001 );
+    if( __is_arcfilter_error( match ) ) {
+      if( _vgx_is_execution_halted( tb ) ) {
+        if( tb->reason == VGX_ACCESS_REASON_EXECUTION_TIMEOUT ) {
+          __format_error_string( &search->CSTR__error, "Execution timeout after %d ms", (tb->tt_ms - tb->t0_ms) );
+        }
+        else {
+          const char *timeout = blocking ? "Timeout: " : "";
+          const char *neighbor = arcdir == VGX_ARCDIR_OUT ? "terminal" : arcdir == VGX_ARCDIR_IN ? "initial" : "neighbor";
+          const void *obj = tb->resource;
+          const vgx_Vertex_t *locked = vgx_CheckVertex( obj );
+          const char *idprefix = locked ? locked->identifier.idprefix.data : "?";
+          __format_error_string( &search->CSTR__error, "%s%s <%s@%p> is locked", timeout, neighbor, idprefix, obj );
+        }
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x001 );
+      }
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x002 );
+    }
+
+    // Update search context with collector's counts
+    vgx_ArcCollector_context_t *collector = (vgx_ArcCollector_context_t*)search->probe->common_collector;
+    search->n_neighbors = collector->n_neighbors;
+    search->n_arcs = collector->n_collectable;
+    search->counts_are_deep = collector->counts_are_deep;
+    
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+    __set_error_string( &search->CSTR__error, "Neighborhood collector error" );
+  }
+  XFINALLY {
+    if( neighborhood ) {
+      COMLIB_OBJECT_DESTROY( neighborhood );
+    }
+  }
+
+  return ret;
+
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+typedef struct s___parallel_traversal_worker_t {
+  struct s___parallel_traversal_t *parallel;
+  vgx_NeighborhoodQuery_t *query;
+  vgx_neighborhood_search_context_t *search;
+  cxlib_thread_t thread;
+  bool started;
+  int ret;
+} __parallel_traversal_worker_t;
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+typedef struct s___parallel_traversal_t {
+  CS_LOCK lock;
+  CS_COND done;
+  const vgx_Vertex_t *vertex_RO;
+  int n_workers;
+  int n_running;
+  __parallel_traversal_worker_t *failed;
+  bool halted_by_failure;
+  __parallel_traversal_worker_t workers[ VGX_PARALLEL_TRAVERSAL_MAX_WORKERS ];
+} __parallel_traversal_t;
+
+
+
+/*******************************************************************//**
+ * Return the array of arcs to split across workers, or NULL if the
+ * traversal must run serially.
+ ***********************************************************************
+ */
+static const vgx_ArcVector_cell_t * __get_partitionable_arcarray( vgx_Graph_t *graph, const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
+  vgx_neighborhood_probe_t *probe = search->probe;
+  if( !probe->readonly_graph || graph->parallel_traversal.workers < 2 ) {
+    return NULL;
+  }
+
+  // Single direction only
+  const vgx_ArcVector_cell_t *V;
+  switch( probe->traversing.arcdir ) {
+  case VGX_ARCDIR_IN:
+    V = &vertex_RO->inarcs;
+    break;
+  case VGX_ARCDIR_OUT:
+    V = &vertex_RO->outarcs;
+    break;
+  default:
+    return NULL;
+  }
+
+  // Large array of arcs
+  _vgx_ArcVector_cell_type ctype = __arcvector_cell_type( V );
+  if( ctype != VGX_ARCVECTOR_ARRAY_OF_ARCS && ctype != VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS ) {
+    return NULL;
+  }
+  if( __arcvector_get_degree( V ) < graph->parallel_traversal.min_degree ) {
+    return NULL;
+  }
+
+  // Top-k collector can be merged
+  if( search->collector == NULL || search->collector->type != VGX_COLLECTOR_TYPE_SORTED_ARC_LIST ) {
+    return NULL;
+  }
+
+  // No cull, and only pure expressions without vertex access
+  if( __arcfilter_get_cull_evaluator( probe->traversing.arcfilter ) || !__has_evaluators( search, __is_partitionable_evaluator ) ) {
+    return NULL;
+  }
+
+  return V;
+}
+
+
+
+/*******************************************************************//**
+ * Record the first failed worker and halt all other workers. Workers
+ * share the timing budget of the calling search, so a failure that did
+ * not already halt the budget halts it explicitly.
+ ***********************************************************************
+ */
+static void __parallel_traversal_fail( __parallel_traversal_t *parallel, __parallel_traversal_worker_t *worker ) {
+  SYNCHRONIZE_ON( parallel->lock ) {
+    if( parallel->failed == NULL ) {
+      parallel->failed = worker;
+      vgx_ExecutionTimingBudget_t *shared = worker->search->timing_budget;
+      if( !_vgx_is_execution_halted( shared ) ) {
+        _vgx_set_execution_explicit_halt( shared );
+        parallel->halted_by_failure = true;
+      }
+    }
+  } RELEASE;
+}
+
+
+
+/*******************************************************************//**
+ *
+ ***********************************************************************
+ */
+BEGIN_THREAD_FUNCTION( __parallel_traversal_worker, "parallel_traversal/", __parallel_traversal_worker_t, worker ) {
+  __parallel_traversal_t *parallel = worker->parallel;
+  if( (worker->ret = __traverse_neighbor_arcs_OPEN_RO( parallel->vertex_RO, worker->search )) < 0 ) {
+    __parallel_traversal_fail( parallel, worker );
+  }
+  SYNCHRONIZE_ON( parallel->lock ) {
+    if( --parallel->n_running == 0 ) {
+      SIGNAL_ALL_CONDITION( &parallel->done.cond );
+    }
+  } RELEASE;
+} END_THREAD_FUNCTION
+
+
+
+/*******************************************************************//**
+ * Traverse the arcs of a high degree vertex in a readonly graph by
+ * splitting its array of arcs into disjoint partitions processed by
+ * concurrent workers. Each worker runs the query (cloned) into its own
+ * top-k collector, which is merged into the search collector when all
+ * workers have completed. The calling thread processes partition 0.
+ * All workers run against the timing budget of the calling search, so
+ * timeout, halt and cancellation apply to every partition.
+ *
+ * NOTE: Worker threads are started and joined for each traversal, i.e.
+ * up to N-1 OS threads per query for N configured workers.
+ *
+ * Traversals that cannot be partitioned (writable graph, bidirectional,
+ * low degree, non-mergeable collector, cull or stateful expressions)
+ * run serially, as do traversals planned to iterate the terminals of
+ * the neighbor condition.
+ *
+ * Returns: 0 on success, -1 on error
+ ***********************************************************************
+ */
+static int _vxquery_traverse__traverse_neighbor_arcs_parallel_OPEN_RO( vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
+  vgx_Graph_t *graph = query->graph;
+
+  const vgx_ArcVector_cell_t *V = __get_partitionable_arcarray( graph, vertex_RO, search );
+  if( V == NULL ) {
+    return _vxquery_traverse__traverse_neighbor_arcs_OPEN_RO( vertex_RO, search );
+  }
+
+  // Planned to iterate the terminals of the neighbor condition: serial
+  int planned;
+  if( (planned = __plan_neighborhood_traversal_OPEN_RO( vertex_RO, search )) != 0 ) {
+    if( planned < 0 ) {
+      __set_error_string( &search->CSTR__error, "Neighborhood planner error" );
+      return -1;
+    }
+    int serial = __traverse_neighbor_arcs_OPEN_RO( vertex_RO, search );
+    __clear_neighborhood_traversal_plan( search->probe );
+    return serial;
+  }
+
+  int ret = 0;
+
+  // Clamp the configured worker count
+  int n_workers = graph->parallel_traversal.workers;
+  if( n_workers > VGX_PARALLEL_TRAVERSAL_MAX_WORKERS ) {
+    n_workers = VGX_PARALLEL_TRAVERSAL_MAX_WORKERS;
+  }
+
+  __parallel_traversal_t *parallel = calloc( 1, sizeof( __parallel_traversal_t ) );
+  if( parallel == NULL ) {
+    return __traverse_neighbor_arcs_OPEN_RO( vertex_RO, search );
+  }
+  INIT_CRITICAL_SECTION( &parallel->lock.lock );
+  INIT_CONDITION_VARIABLE( &parallel->done.cond );
+  parallel->vertex_RO = vertex_RO;
+
+  vgx_neighborhood_probe_t *probe = search->probe;
+
+  XTRY {
+    // Partition 0 is the calling thread's search
+    __parallel_traversal_worker_t *primary = &parallel->workers[0];
+    primary->parallel = parallel;
+    primary->query = query;
+    primary->search = search;
+
+    // Set up worker searches before starting any thread
+    for( int i=1; i<n_workers; i++ ) {
+      __parallel_traversal_worker_t *worker = &parallel->workers[i];
+      worker->parallel = parallel;
+      CString_t *CSTR__clone_error = NULL;
+      worker->query = iGraphQuery.CloneNeighborhoodQuery( query, &CSTR__clone_error );
+      iString.Discard( &CSTR__clone_error );
+      if( worker->query == NULL ) {
+        break;
+      }
+      worker->query->shared_timing_budget = search->timing_budget;
+      if( (worker->search = iGraphProbe.NewNeighborhoodSearch( graph, true, (vgx_Vertex_t*)vertex_RO, worker->query )) == NULL ) {
+        iGraphQuery.DeleteNeighborhoodQuery( &worker->query );
+        break;
+      }
+      worker->search->probe->traversing.arcdir = probe->traversing.arcdir;
+      parallel->n_workers = i + 1;
+    }
+
+    // Could not set up any extra workers
+    if( parallel->n_workers < 2 ) {
+      parallel->n_workers = 1;
+      probe->partition.part = 0;
+      probe->partition.nparts = 0;
+      if( (ret = __traverse_neighbor_arcs_OPEN_RO( vertex_RO, search )) < 0 ) {
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x011 );
+      }
+      XBREAK;
+    }
+
+    // Assign partitions
+    int nparts = parallel->n_workers;
+    for( int i=0; i<nparts; i++ ) {
+      parallel->workers[i].search->probe->partition.part = i;
+      parallel->workers[i].search->probe->partition.nparts = nparts;
+    }
+
+    // Start workers. A worker that cannot be started is run by the calling thread.
+    for( int i=1; i<nparts; i++ ) {
+      __parallel_traversal_worker_t *worker = &parallel->workers[i];
+      uint32_t thread_id;
+      SYNCHRONIZE_ON( parallel->lock ) {
+        ++parallel->n_running;
+      } RELEASE;
+      if( THREAD_START( &worker->thread, &thread_id, __parallel_traversal_worker, worker ) == 0 ) {
+        worker->started = true;
+      }
+      else {
+        SYNCHRONIZE_ON( parallel->lock ) {
+          --parallel->n_running;
+        } RELEASE;
+      }
+    }
+
+    // Partition 0
+    if( (primary->ret = __traverse_neighbor_arcs_OPEN_RO( vertex_RO, search )) < 0 ) {
+      __parallel_traversal_fail( parallel, primary );
+    }
+
+    // Partitions whose worker could not be started
+    for( int i=1; i<nparts; i++ ) {
+      __parallel_traversal_worker_t *worker = &parallel->workers[i];
+      if( !worker->started && parallel->failed == NULL ) {
+        if( (worker->ret = __traverse_neighbor_arcs_OPEN_RO( vertex_RO, worker->search )) < 0 ) {
+          __parallel_traversal_fail( parallel, worker );
+        }
+      }
+    }
+
+    // Wait for all workers
+    SYNCHRONIZE_ON( parallel->lock ) {
+      while( parallel->n_running > 0 ) {
+        WAIT_CONDITION( &parallel->done.cond, &parallel->lock.lock );
+      }
+    } RELEASE;
+    for( int i=1; i<nparts; i++ ) {
+      if( parallel->workers[i].started ) {
+        THREAD_JOIN( parallel->workers[i].thread, 10000 );
+      }
+    }
+
+    // Propagate first failure to the calling search
+    __parallel_traversal_worker_t *failed = parallel->failed;
+    if( failed ) {
+      // Halt was only used to stop the other workers
+      if( parallel->halted_by_failure ) {
+        _vgx_clear_execution_explicit_halt( search->timing_budget );
       }
-      THROW_ERROR( CXLIB_ERR_GENERAL, 0x002 );
+      if( failed != primary ) {
+        iString.Discard( &search->CSTR__error );
+        search->CSTR__error = failed->search->CSTR__error;
+        failed->search->CSTR__error = NULL;
+      }
+      THROW_SILENT( CXLIB_ERR_GENERAL, 0x012 );
     }
 
-    // Update search context with collector's counts
-    vgx_ArcCollector_context_t *collector = (vgx_ArcCollector_context_t*)search->probe->common_collector;
+    // Merge worker results into the search collector
+    vgx_ArcCollector_context_t *collector = (vgx_ArcCollector_context_t*)search->collector;
+    for( int i=1; i<nparts; i++ ) {
+      vgx_ArcCollector_context_t *other = (vgx_ArcCollector_context_t*)parallel->workers[i].search->collector;
+      if( iGraphCollector.MergeArcCollector( collector, other ) < 0 ) {
+        __set_error_string( &search->CSTR__error, "Parallel traversal merge error" );
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x013 );
+      }
+    }
+
+    // Update search context with merged counts
     search->n_neighbors = collector->n_neighbors;
     search->n_arcs = collector->n_collectable;
     search->counts_are_deep = collector->counts_are_deep;
-    
   }
   XCATCH( errcode ) {
     ret = -1;
-    __set_error_string( &search->CSTR__error, "Neighborhood collector error" );
   }
   XFINALLY {
-    if( neighborhood ) {
-      COMLIB_OBJECT_DESTROY( neighborhood );
+    probe->partition.part = 0;
+    probe->partition.nparts = 0;
+    for( int i=1; i<VGX_PARALLEL_TRAVERSAL_MAX_WORKERS; i++ ) {
+      __parallel_traversal_worker_t *worker = &parallel->workers[i];
+      if( worker->search ) {
+        iGraphProbe.DeleteSearch( (vgx_base_search_context_t**)&worker->search );
+      }
+      if( worker->query ) {
+        iGraphQuery.DeleteNeighborhoodQuery( &worker->query );
+      }
     }
+    DEL_CONDITION_VARIABLE( &parallel->done.cond );
+    DEL_CRITICAL_SECTION( &parallel->lock.lock );
+    free( parallel );
   }
 
   return ret;
+}
 
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int _vxquery_traverse__traverse_neighbor_arcs_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
+  return __traverse_planned_OPEN_RO( vertex_RO, search, __traverse_neighbor_arcs_OPEN_RO );
 }
 
 
@@ -393,7 +1101,7 @@ static int _vxquery_traverse__traverse_neighbor_arcs_OPEN_RO( const vgx_Vertex_t
  *
  ***********************************************************************
  */
-static int _vxquery_traverse__traverse_neighbor_vertices_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
+static int __traverse_neighbor_vertices_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
   int ret = 0;
 
   Cm256iList_t *unique = NULL;
@@ -452,6 +1160,17 @@ static int _vxquery_traverse__traverse_neighbor_vertices_OPEN_RO( const vgx_Vert
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static int _vxquery_traverse__traverse_neighbor_vertices_OPEN_RO( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search ) {
+  return __traverse_planned_OPEN_RO( vertex_RO, search, __traverse_neighbor_vertices_OPEN_RO );
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -572,6 +1291,528 @@ static int _vxquery_traverse__aggregate_neighborhood_OPEN_RO( const vgx_Vertex_t
 
 
 
+/*******************************************************************//**
+ * Visited set slot states
+ ***********************************************************************
+ */
+#define __EXPANSION_VISITED   1
+#define __EXPANSION_CANDIDATE 2
+#define __EXPANSION_CONSUMED  3
+
+
+
+/*******************************************************************//**
+ * Return the visited set slot for vertex (occupied or first free)
+ ***********************************************************************
+ */
+static int64_t __expansion_slot( const vgx_neighborhood_expansion_t *E, const vgx_Vertex_t *vertex ) {
+  uint64_t offset = __vertex_get_index( (vgx_AllocatedVertex_t*)_cxmalloc_linehead_from_object( (vgx_Vertex_t*)vertex ) );
+  int64_t mask = E->visited.mask;
+  int64_t i = ihash64( offset ) & mask; // scramble
+  vgx_Vertex_t **slots = E->visited.slots;
+  while( slots[i] != NULL && slots[i] != vertex ) {
+    i = (i + 1) & mask;
+  }
+  return i;
+}
+
+
+
+/*******************************************************************//**
+ * Double the visited set capacity
+ * Returns 0 on success, -1 on memory error
+ ***********************************************************************
+ */
+static int __expansion_grow_visited( vgx_neighborhood_expansion_t *E ) {
+  int64_t sz = E->visited.slots ? (E->visited.mask + 1) * 2 : 256;
+  vgx_Vertex_t **slots = calloc( sz, sizeof( vgx_Vertex_t* ) );
+  int8_t *state = calloc( sz, sizeof( int8_t ) );
+  if( slots == NULL || state == NULL ) {
+    free( slots );
+    free( state );
+    return -1;
+  }
+  vgx_Vertex_t **old_slots = E->visited.slots;
+  int8_t *old_state = E->visited.state;
+  int64_t old_sz = old_slots ? E->visited.mask + 1 : 0;
+  E->visited.slots = slots;
+  E->visited.state = state;
+  E->visited.mask = sz - 1;
+  for( int64_t i=0; i<old_sz; i++ ) {
+    if( old_slots[i] ) {
+      int64_t j = __expansion_slot( E, old_slots[i] );
+      slots[j] = old_slots[i];
+      state[j] = old_state[i];
+    }
+  }
+  free( old_slots );
+  free( old_state );
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Return the visited set state of vertex (0 if not in set)
+ ***********************************************************************
+ */
+static int __expansion_state( const vgx_neighborhood_expansion_t *E, const vgx_Vertex_t *vertex ) {
+  int64_t i = __expansion_slot( E, vertex );
+  return E->visited.slots[i] ? E->visited.state[i] : 0;
+}
+
+
+
+/*******************************************************************//**
+ * Set the visited set state of vertex, adding it if not in set
+ * Returns the previous state (0 if added), or -1 on memory error
+ ***********************************************************************
+ */
+static int __expansion_mark( vgx_neighborhood_expansion_t *E, const vgx_Vertex_t *vertex, int8_t state ) {
+  int64_t i = __expansion_slot( E, vertex );
+  if( E->visited.slots[i] ) {
+    int prev = E->visited.state[i];
+    E->visited.state[i] = state;
+    return prev;
+  }
+  // Keep load at or below 50%
+  if( 2 * (E->visited.n + 1) > E->visited.mask + 1 ) {
+    if( __expansion_grow_visited( E ) < 0 ) {
+      return -1;
+    }
+    i = __expansion_slot( E, vertex );
+  }
+  E->visited.slots[i] = (vgx_Vertex_t*)vertex;
+  E->visited.state[i] = state;
+  E->visited.n++;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Append vertex to the next frontier
+ * Returns 0 on success, -1 on memory error
+ ***********************************************************************
+ */
+static int __expansion_push_next( vgx_neighborhood_expansion_t *E, vgx_Vertex_t *vertex ) {
+  if( E->n_next == E->cap_next ) {
+    int64_t cap = E->cap_next > 0 ? E->cap_next * 2 : 64;
+    vgx_Vertex_t **next = realloc( E->next, cap * sizeof( vgx_Vertex_t* ) );
+    if( next == NULL ) {
+      return -1;
+    }
+    E->next = next;
+    E->cap_next = cap;
+  }
+  E->next[ E->n_next++ ] = vertex;
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Append arc to candidates
+ * Returns 0 on success, -1 on memory error
+ ***********************************************************************
+ */
+static int __expansion_push_candidate( vgx_neighborhood_expansion_t *E, const vgx_Arc_t *arc ) {
+  if( E->n_candidates == E->cap_candidates ) {
+    int64_t cap = E->cap_candidates > 0 ? E->cap_candidates * 2 : 64;
+    vgx_Arc_t *candidates = realloc( E->candidates, cap * sizeof( vgx_Arc_t ) );
+    if( candidates == NULL ) {
+      return -1;
+    }
+    E->candidates = candidates;
+    E->cap_candidates = cap;
+  }
+  VGX_COPY_ARC( &E->candidates[ E->n_candidates++ ], arc );
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Arc visitor for one expansion hop: add unvisited heads to the next
+ * frontier until the fanout of the current frontier vertex is reached.
+ ***********************************************************************
+ */
+static int __expansion_visit_hop( void *context, const vgx_Arc_t *arc ) {
+  vgx_neighborhood_expansion_t *E = context;
+  int prev = __expansion_mark( E, arc->head.vertex, __EXPANSION_VISITED );
+  if( prev < 0 ) {
+    return -1;
+  }
+  if( prev == 0 ) {
+    if( __expansion_push_next( E, arc->head.vertex ) < 0 ) {
+      return -1;
+    }
+    // Fanout reached
+    if( E->remain > 0 && --E->remain == 0 ) {
+      return 1;
+    }
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Arc visitor for the final frontier: keep arcs into vertices not
+ * visited by the expansion as candidates for the neighborhood query.
+ ***********************************************************************
+ */
+static int __expansion_visit_candidate( void *context, const vgx_Arc_t *arc ) {
+  vgx_neighborhood_expansion_t *E = context;
+  int state = __expansion_state( E, arc->head.vertex );
+  if( state == __EXPANSION_VISITED ) {
+    return 0;
+  }
+  if( __expansion_push_candidate( E, arc ) < 0 ) {
+    return -1;
+  }
+  if( state == 0 ) {
+    if( __expansion_mark( E, arc->head.vertex, __EXPANSION_CANDIDATE ) < 0 ) {
+      return -1;
+    }
+    E->n_candidate_heads++;
+  }
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ * Visit the arcs of vertex in direction arcdir (both arcvectors if
+ * VGX_ARCDIR_ANY), stopping early if the visitor requests it.
+ * Returns number of arcs visited, or -1 on error.
+ ***********************************************************************
+ */
+static int64_t __expansion_visit_vertex( vgx_neighborhood_expansion_t *E, vgx_Vertex_t *vertex_RO, vgx_arc_direction arcdir, vgx_virtual_ArcFilter_context_t *filter, f_vgx_ArcVisitor visitor ) {
+  int64_t n = 0;
+  int64_t n_in = 0;
+  if( arcdir != VGX_ARCDIR_IN ) {
+    if( (n = iarcvector.Visit( vertex_RO, &vertex_RO->outarcs, filter, visitor, E )) < 0 ) {
+      return -1;
+    }
+  }
+  if( arcdir != VGX_ARCDIR_OUT && E->remain != 0 ) {
+    if( (n_in = iarcvector.Visit( vertex_RO, &vertex_RO->inarcs, filter, visitor, E )) < 0 ) {
+      return -1;
+    }
+  }
+  return n + n_in;
+}
+
+
+
+/*******************************************************************//**
+ * Acquire readonly locks for all vertices in the next frontier.
+ * All or nothing: if any vertex cannot be locked, locks acquired so
+ * far are released and -1 is returned.
+ ***********************************************************************
+ */
+static int __expansion_lock_next_OPEN( vgx_neighborhood_expansion_t *E ) {
+  int64_t n_locked = 0;
+  vgx_Graph_t *graph = E->graph;
+  GRAPH_LOCK( graph ) {
+    for( ; n_locked < E->n_next; n_locked++ ) {
+      if( _vxgraph_state__lock_vertex_readonly_CS( graph, E->next[ n_locked ], E->timing_budget, VGX_VERTEX_RECORD_NONE ) == NULL ) {
+        E->timing_budget->resource = E->next[ n_locked ];
+        break;
+      }
+    }
+    if( n_locked < E->n_next ) {
+      for( int64_t i=0; i<n_locked; i++ ) {
+        vgx_Vertex_t *vertex_LCK = E->next[i];
+        _vxgraph_state__unlock_vertex_CS_LCK( graph, &vertex_LCK, VGX_VERTEX_RECORD_OPERATION );
+      }
+    }
+  } GRAPH_RELEASE;
+  return n_locked < E->n_next ? -1 : 0;
+}
+
+
+
+/*******************************************************************//**
+ * Release readonly locks held for the current frontier
+ ***********************************************************************
+ */
+static void __expansion_unlock_frontier_OPEN( vgx_neighborhood_expansion_t *E ) {
+  if( E->frontier_locked ) {
+    vgx_Graph_t *graph = E->graph;
+    GRAPH_LOCK( graph ) {
+      for( int64_t i=0; i<E->n_frontier; i++ ) {
+        vgx_Vertex_t *vertex_LCK = E->frontier[i];
+        _vxgraph_state__unlock_vertex_CS_LCK( graph, &vertex_LCK, VGX_VERTEX_RECORD_OPERATION );
+      }
+      SIGNAL_VERTEX_AVAILABLE( graph );
+    } GRAPH_RELEASE;
+    E->frontier_locked = false;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Expand the neighborhood of anchor vertex along the query's expand
+ * hops, keeping each new frontier readonly locked until the next one
+ * has been locked. The arcs from the final frontier into vertices not
+ * visited by the expansion are kept as candidates for the neighborhood
+ * query, and the query's hit count is resolved against them.
+ *
+ * The final frontier remains locked until the expansion is deleted.
+ *
+ * Returns expansion, or NULL on error with query->CSTR__error set.
+ ***********************************************************************
+ */
+static vgx_neighborhood_expansion_t * _vxquery_traverse__new_neighborhood_expansion_OPEN_RO( vgx_Graph_t *self, bool readonly_graph, vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO ) {
+  vgx_neighborhood_expansion_t *E = NULL;
+  vgx_virtual_ArcFilter_context_t *filter = NULL;
+  vgx_ExpandCondition_t *expand = query->expand_condition;
+  int64_t system_limit = Comlib_Cm256iList_t_ElementCapacity();
+
+  XTRY {
+    vgx_ArcConditionSet_t *acs = query->arc_condition_set;
+    vgx_arc_direction arcdir = acs ? acs->arcdir : VGX_ARCDIR_ANY;
+
+    if( expand == NULL || expand->n_hops < 1 ) {
+      THROW_ERROR( CXLIB_ERR_API, 0x391 );
+    }
+
+    // Neighbor collection is defined relative to the anchor
+    if( query->vertex_condition && _vgx_collector_mode_collect( query->vertex_condition->advanced.recursive.collector_mode ) ) {
+      __set_error_string( &query->CSTR__error, "expand cannot be combined with neighbor collect" );
+      THROW_SILENT( CXLIB_ERR_API, 0x392 );
+    }
+
+    if( arcdir == VGX_ARCDIR_BOTH ) {
+      __set_error_string( &query->CSTR__error, "expand requires arc direction D_OUT, D_IN or D_ANY" );
+      THROW_SILENT( CXLIB_ERR_API, 0x393 );
+    }
+
+    for( int h=0; h<expand->n_hops; h++ ) {
+      vgx_ArcConditionSet_t *hop_acs = expand->hop[h].arc_condition_set;
+      if( hop_acs && hop_acs->arcdir == VGX_ARCDIR_BOTH ) {
+        __set_error_string( &query->CSTR__error, "expand hop requires arc direction D_OUT, D_IN or D_ANY" );
+        THROW_SILENT( CXLIB_ERR_API, 0x394 );
+      }
+    }
+
+    if( (E = calloc( 1, sizeof( vgx_neighborhood_expansion_t ) )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x395 );
+    }
+    E->graph = self;
+    E->readonly_graph = readonly_graph;
+    E->timing_budget = &query->timing_budget;
+    E->anchor_RO = vertex_RO;
+
+    if( __expansion_grow_visited( E ) < 0 || __expansion_mark( E, vertex_RO, __EXPANSION_VISITED ) < 0 ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x396 );
+    }
+
+    // Initial frontier is the anchor (locked by caller)
+    if( __expansion_push_next( E, (vgx_Vertex_t*)vertex_RO ) < 0 ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x397 );
+    }
+
+    // Expand one hop at a time
+    for( int h=0; h<expand->n_hops; h++ ) {
+      vgx_ExpandHop_t *hop = &expand->hop[h];
+      vgx_arc_direction hop_arcdir = hop->arc_condition_set ? hop->arc_condition_set->arcdir : VGX_ARCDIR_ANY;
+
+      // Next becomes the current frontier
+      vgx_Vertex_t **swap = E->frontier;
+      int64_t swap_cap = E->cap_frontier;
+      E->frontier = E->next;
+      E->n_frontier = E->n_next;
+      E->cap_frontier = E->cap_next;
+      E->frontier_locked = h > 0 && !readonly_graph;
+      E->next = swap;
+      E->n_next = 0;
+      E->cap_next = swap_cap;
+
+      if( (filter = iArcFilter.New( self, readonly_graph, hop->arc_condition_set, NULL, NULL, E->timing_budget )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x398 );
+      }
+
+      for( int64_t i=0; i<E->n_frontier; i++ ) {
+        if( (E->remain = hop->fanout) == 0 ) {
+          break;
+        }
+        if( __expansion_visit_vertex( E, E->frontier[i], hop_arcdir, filter, __expansion_visit_hop ) < 0 ) {
+          THROW_ERROR( CXLIB_ERR_GENERAL, 0x399 );
+        }
+      }
+
+      iArcFilter.Delete( &filter );
+
+      // Lock the new frontier before releasing the current one
+      if( !readonly_graph && __expansion_lock_next_OPEN( E ) < 0 ) {
+        const vgx_Vertex_t *locked = vgx_CheckVertex( E->timing_budget->resource );
+        const char *idprefix = locked ? locked->identifier.idprefix.data : "?";
+        __format_error_string( &query->CSTR__error, "expanded neighbor <%s@%p> is locked", idprefix, E->timing_budget->resource );
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x39A );
+      }
+      __expansion_unlock_frontier_OPEN( E );
+    }
+
+    // Final frontier
+    vgx_Vertex_t **swap = E->frontier;
+    int64_t swap_cap = E->cap_frontier;
+    E->frontier = E->next;
+    E->n_frontier = E->n_next;
+    E->cap_frontier = E->cap_next;
+    E->frontier_locked = !readonly_graph;
+    E->next = swap;
+    E->n_next = 0;
+    E->cap_next = swap_cap;
+    E->distance = expand->n_hops + 1;
+
+    // Collect candidate arcs from final frontier into unvisited vertices
+    if( (filter = iArcFilter.New( self, readonly_graph, acs, NULL, NULL, E->timing_budget )) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_GENERAL, 0x39B );
+    }
+    for( int64_t i=0; i<E->n_frontier; i++ ) {
+      E->remain = -1;
+      if( __expansion_visit_vertex( E, E->frontier[i], arcdir, filter, __expansion_visit_candidate ) < 0 ) {
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x39C );
+      }
+    }
+
+    // Resolve hit count from the number of candidate neighbors
+    if( query->hits < 0 || query->hits > system_limit ) {
+      int64_t hits = E->n_candidate_heads - (query->offset > 0 ? query->offset : 0);
+      query->hits = hits > 0 ? hits : 0;
+    }
+    int64_t n_collect = query->hits + (query->offset > 0 ? query->offset : 0);
+    if( n_collect > system_limit ) {
+      __format_error_string( &query->CSTR__error, "Maximum hit count exceeded: %lld > %lld", n_collect, system_limit );
+      THROW_SILENT( CXLIB_ERR_API, 0x39D );
+    }
+  }
+  XCATCH( errcode ) {
+    if( _vgx_is_execution_halted( &query->timing_budget ) && query->timing_budget.reason == VGX_ACCESS_REASON_EXECUTION_TIMEOUT ) {
+      __format_error_string( &query->CSTR__error, "Execution timeout after %d ms", (query->timing_budget.tt_ms - query->timing_budget.t0_ms) );
+    }
+    __set_error_string( &query->CSTR__error, "Neighborhood expansion error" );
+    _vxquery_traverse__delete_neighborhood_expansion( &E );
+  }
+  XFINALLY {
+    iArcFilter.Delete( &filter );
+  }
+
+  return E;
+}
+
+
+
+/*******************************************************************//**
+ * Run the neighborhood search from the expanded frontier. Each candidate
+ * neighbor is passed through the full search filter as if it were
+ * adjacent to its frontier vertex, and is collected at most once via
+ * the first of its arcs accepted by the filter.
+ *
+ * Returns 0 on success, -1 on error.
+ ***********************************************************************
+ */
+static int _vxquery_traverse__traverse_expanded_neighborhood_OPEN( vgx_neighborhood_expansion_t *expansion, vgx_neighborhood_search_context_t *search ) {
+  vgx_neighborhood_expansion_t *E = expansion;
+  vgx_neighborhood_probe_t *probe = search->probe;
+  int ret = 0;
+
+  XTRY {
+    vgx_ExecutionTimingBudget_t *tb = search->timing_budget;
+    bool collect_arcs = _vgx_collector_mode_type( search->collector_mode ) == VGX_COLLECTOR_MODE_COLLECT_ARCS;
+    probe->distance = E->distance;
+
+    const vgx_Arc_t *cursor = E->candidates;
+    const vgx_Arc_t *end = cursor + E->n_candidates;
+    for( ; cursor < end; ++cursor ) {
+      int64_t slot = __expansion_slot( E, cursor->head.vertex );
+      if( E->visited.state[ slot ] == __EXPANSION_CONSUMED ) {
+        continue;
+      }
+      // Re-anchor the probe at the frontier vertex
+      probe->current_tail_RO = cursor->tail;
+      probe->traversing.arcfilter->current_tail = cursor->tail;
+      if( probe->conditional.arcfilter ) {
+        probe->conditional.arcfilter->current_tail = cursor->tail;
+      }
+      if( probe->collect_filter_context ) {
+        probe->collect_filter_context->current_tail = cursor->tail;
+      }
+      vgx_ArcVector_cell_t cell;
+      __arcvector_cell_set_simple_arc( &cell, cursor );
+      vgx_ArcFilter_match match = collect_arcs ? iarcvector.GetArcs( &cell, probe ) : iarcvector.GetVertices( &cell, probe );
+      if( __is_arcfilter_error( match ) ) {
+        if( _vgx_is_execution_halted( tb ) ) {
+          if( tb->reason == VGX_ACCESS_REASON_EXECUTION_TIMEOUT ) {
+            __format_error_string( &search->CSTR__error, "Execution timeout after %d ms", (tb->tt_ms - tb->t0_ms) );
+          }
+          else {
+            const char *timeout = _vgx_is_execution_blocking( tb ) ? "Timeout: " : "";
+            const void *obj = tb->resource;
+            const vgx_Vertex_t *locked = vgx_CheckVertex( obj );
+            const char *idprefix = locked ? locked->identifier.idprefix.data : "?";
+            __format_error_string( &search->CSTR__error, "%sneighbor <%s@%p> is locked", timeout, idprefix, obj );
+          }
+          THROW_SILENT( CXLIB_ERR_GENERAL, 0x3A1 );
+        }
+        THROW_ERROR( CXLIB_ERR_GENERAL, 0x3A2 );
+      }
+      if( match == VGX_ARC_FILTER_MATCH_HIT ) {
+        E->visited.state[ slot ] = __EXPANSION_CONSUMED;
+      }
+    }
+
+    // Update search context with collector's counts
+    if( collect_arcs ) {
+      vgx_ArcCollector_context_t *collector = (vgx_ArcCollector_context_t*)probe->common_collector;
+      search->n_neighbors = collector->n_neighbors;
+      search->n_arcs = collector->n_collectable;
+      search->counts_are_deep = collector->counts_are_deep;
+    }
+    else {
+      vgx_VertexCollector_context_t *collector = (vgx_VertexCollector_context_t*)probe->common_collector;
+      search->n_neighbors = collector->n_vertices;
+      search->n_vertices = collector->n_collectable;
+      search->counts_are_deep = collector->counts_are_deep;
+    }
+  }
+  XCATCH( errcode ) {
+    ret = -1;
+    __set_error_string( &search->CSTR__error, "Expanded neighborhood collector error" );
+  }
+  XFINALLY {
+  }
+
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Release the final frontier locks and free the expansion
+ ***********************************************************************
+ */
+static void _vxquery_traverse__delete_neighborhood_expansion( vgx_neighborhood_expansion_t **expansion ) {
+  if( expansion && *expansion ) {
+    vgx_neighborhood_expansion_t *E = *expansion;
+    __expansion_unlock_frontier_OPEN( E );
+    free( E->visited.slots );
+    free( E->visited.state );
+    free( E->frontier );
+    free( E->next );
+    free( E->candidates );
+    free( E );
+    *expansion = NULL;
+  }
+}
+
+
+
+
 #ifdef INCLUDE_UNIT_TESTS
 #include "tests/__utest_vxquery_traverse.h"
 
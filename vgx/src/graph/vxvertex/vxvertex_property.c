@@ -1402,6 +1402,10 @@ DLL_HIDDEN int _vxvertex_property__set_property_WL( vgx_Vertex_t *self_WL, vgx_V
     // Insert or update property
     GRAPH_LOCK( self_WL->graph ) {
       n_inserted = __insert_or_update_property_WL_CS( self_WL, dynamic, prop );
+      if( n_inserted >= 0 ) {
+        _vxgraph_geoindex__update_vertex_CS( self_WL->graph, self_WL, prop->keyhash );
+        _vxgraph_textindex__update_vertex_CS( self_WL->graph, self_WL, prop->keyhash );
+      }
     } GRAPH_RELEASE;
   }
   XCATCH( errcode ) {
@@ -1446,6 +1450,10 @@ DLL_HIDDEN vgx_VertexProperty_t * _vxvertex_property__inc_property_WL( vgx_Verte
     // Increment numeric property
     GRAPH_LOCK( self_WL->graph ) {
       ret_prop = __insert_or_increment_numeric_property_WL_CS( self_WL, dynamic, prop );
+      if( ret_prop ) {
+        _vxgraph_geoindex__update_vertex_CS( self_WL->graph, self_WL, prop->keyhash );
+        _vxgraph_textindex__update_vertex_CS( self_WL->graph, self_WL, prop->keyhash );
+      }
     } GRAPH_RELEASE;
   }
   XCATCH( errcode ) {
@@ -1646,6 +1654,10 @@ DLL_HIDDEN int _vxvertex_property__del_property_WL( vgx_Vertex_t *self_WL, vgx_V
     // Try to delete the property
     GRAPH_LOCK( self_WL->graph ) {
       n_deleted = __del_property_WL_CS( self_WL, dynamic, prop );
+      if( n_deleted == 1 ) {
+        _vxgraph_geoindex__update_vertex_CS( self_WL->graph, self_WL, prop->keyhash );
+        _vxgraph_textindex__update_vertex_CS( self_WL->graph, self_WL, prop->keyhash );
+      }
     } GRAPH_RELEASE;
 
     // If we deleted something check if all properties are deleted
@@ -1719,6 +1731,9 @@ DLL_HIDDEN int64_t _vxvertex_property__del_properties_WL( vgx_Vertex_t *self_WL
       n_deleted = iFramehash.simple.Process( self_WL->properties, __OBJECT64_destroy_WL_CS, NULL, graph_CS );
       // Decrement global counter
       SubGraphPropCount( self_WL->graph, n_deleted );
+      // Vertex no longer has a position or text
+      _vxgraph_geoindex__remove_vertex_CS( graph_CS, self_WL );
+      _vxgraph_textindex__remove_vertex_CS( graph_CS, self_WL );
     } GRAPH_RELEASE;
     
     // Destroy the property map
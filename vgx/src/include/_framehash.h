@@ -1217,6 +1217,7 @@ DLL_HIDDEN extern IStandardCellProcessors_t _framehash_processor__iStandardCellP
 DLL_HIDDEN extern IStandardSubtreeProcessors_t _framehash_processor__iStandardSubtreeProcessors;
 DLL_HIDDEN extern int64_t _framehash_processor__process_nolock_nocache( framehash_processing_context_t * const processor );
 DLL_HIDDEN extern int64_t _framehash_processor__process_cache_partial_nolock_nocache( framehash_processing_context_t * const processor, uint64_t selector );
+DLL_HIDDEN extern int64_t _framehash_processor__process_partition_nolock_nocache( framehash_processing_context_t * const processor, int part, int nparts );
 DLL_HIDDEN extern int64_t _framehash_processor__process_nolock( framehash_processing_context_t * const processor );
 DLL_HIDDEN extern int64_t _framehash_processor__process( framehash_processing_context_t * const processor );
 
@@ -95,6 +95,8 @@ DLL_HIDDEN extern vgx_ArcStager_t _iStageArc;
 
 DLL_HIDDEN extern int _vxarcvector_comparator__unstage( vgx_BaseCollector_context_t *collector, int index );
 DLL_HIDDEN extern int _vxarcvector_comparator__commit( vgx_BaseCollector_context_t *collector, int index );
+DLL_HIDDEN extern f_vgx_ArcComparator _vxarcvector_comparator__get_cursor_comparator( vgx_CollectorFloorGate_t key );
+DLL_HIDDEN extern void _vxarcvector_comparator__set_cursor_position( vgx_CollectorCursor_t *cursor, vgx_CollectorFloorGate_t key, const vgx_CollectorItem_t *item );
 
 DLL_HIDDEN extern vgx_ArcRankScorer_t _iComputeArcRankScore;
 DLL_HIDDEN extern vgx_VertexRankScorer_t _iComputeVertexRankScore;
@@ -550,6 +552,8 @@ DLL_HIDDEN extern             int _vxgraph_vxtable__clear_readonly_CS( vgx_Graph
 DLL_HIDDEN extern         int64_t _vxgraph_vxtable__collect_items_ROG_or_CSNOWL( vgx_Graph_t *self, vgx_global_search_context_t *search, vgx_VertexFilter_context_t *filter );
 DLL_HIDDEN extern         int64_t _vxgraph_vxtable__count_vertex_properties_ROG( vgx_Graph_t *self );
 DLL_HIDDEN extern         int64_t _vxgraph_vxtable__count_vertex_tmx_ROG( vgx_Graph_t *self );
+DLL_HIDDEN extern         int64_t _vxgraph_vxtable__freeze_arcs_OPEN( vgx_Graph_t *self, int64_t min_degree, int64_t *ret_bytes, int64_t *ret_oversized );
+DLL_HIDDEN extern         int64_t _vxgraph_vxtable__thaw_arcs_OPEN( vgx_Graph_t *self );
 DLL_HIDDEN extern         int64_t _vxgraph_vxtable__prepare_vertices_CS_NT( vgx_Graph_t *self );
 DLL_HIDDEN extern         int64_t _vxgraph_vxtable__truncate_noeventproc_CS( vgx_Graph_t *self, vgx_VertexTypeEnumeration_t vxtype, CString_t **CSTR__error );
 DLL_HIDDEN extern  vgx_Vertex_t * _vxgraph_vxtable__query_OPEN( vgx_Graph_t *self, const CString_t *CSTR__idstr, const objectid_t *obid, vgx_VertexTypeEnumeration_t vxtype );
@@ -565,6 +569,42 @@ DLL_HIDDEN extern         int64_t _vxgraph_vxtable__operation_sync_arcs_CS_NT_NO
 DLL_HIDDEN extern         int64_t _vxgraph_vxtable__operation_sync_virtual_vertices_CS_NT_NOROG( vgx_Graph_t *self );
 
 
+DLL_HIDDEN extern         int64_t _vxgraph_geoindex__create_OPEN( vgx_Graph_t *self, const char *lat_key, const char *lon_key, CString_t **CSTR__error );
+DLL_HIDDEN extern             int _vxgraph_geoindex__drop_OPEN( vgx_Graph_t *self );
+DLL_HIDDEN extern            void _vxgraph_geoindex__destroy_CS( vgx_Graph_t *self );
+DLL_HIDDEN extern         int64_t _vxgraph_geoindex__rebuild_CS( vgx_Graph_t *self );
+DLL_HIDDEN extern             int _vxgraph_geoindex__update_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK, shortid_t keyhash );
+DLL_HIDDEN extern             int _vxgraph_geoindex__remove_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK );
+DLL_HIDDEN extern             int _vxgraph_geoindex__get_keys_OPEN( vgx_Graph_t *self, shortid_t *lat_keyhash, shortid_t *lon_keyhash );
+DLL_HIDDEN extern         int64_t _vxgraph_geoindex__process_candidates_ROG_or_CS( vgx_Graph_t *self, const vgx_geo_probe_t *geo_probe, cxmalloc_object_processing_context_t *scan_context );
+DLL_HIDDEN extern            bool _vxgraph_geoindex__vertex_position( const vgx_Vertex_t *vertex, shortid_t lat_keyhash, shortid_t lon_keyhash, double *lat, double *lon );
+DLL_HIDDEN extern          double _vxgraph_geoindex__distance( double lat1, double lon1, double lat2, double lon2 );
+
+
+DLL_HIDDEN extern         int64_t _vxgraph_textindex__create_OPEN( vgx_Graph_t *self, const char *key, CString_t **CSTR__error );
+DLL_HIDDEN extern             int _vxgraph_textindex__drop_OPEN( vgx_Graph_t *self, const char *key );
+DLL_HIDDEN extern            void _vxgraph_textindex__destroy_CS( vgx_Graph_t *self );
+DLL_HIDDEN extern         int64_t _vxgraph_textindex__rebuild_CS( vgx_Graph_t *self );
+DLL_HIDDEN extern             int _vxgraph_textindex__update_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK, shortid_t keyhash );
+DLL_HIDDEN extern             int _vxgraph_textindex__remove_vertex_CS( vgx_Graph_t *self, vgx_Vertex_t *vertex_LCK );
+DLL_HIDDEN extern             int _vxgraph_textindex__get_keyhash_OPEN( vgx_Graph_t *self, const CString_t *CSTR__key, shortid_t *keyhash );
+DLL_HIDDEN extern          QWORD * _vxgraph_textindex__tokenize( const char *text, int64_t *n );
+DLL_HIDDEN extern            bool _vxgraph_textindex__match_vertex( const vgx_Vertex_t *vertex, const vgx_text_probe_t *text_probe );
+DLL_HIDDEN extern         int64_t _vxgraph_textindex__process_candidates_ROG_or_CS( vgx_Graph_t *self, const vgx_text_probe_t *text_probe, cxmalloc_object_processing_context_t *scan_context );
+DLL_HIDDEN extern          double _vxgraph_textindex__bm25( vgx_Graph_t *self, struct s_vgx_TextScorer_t **scorer, const CString_t *CSTR__key, const CString_t *CSTR__terms, const vgx_Vertex_t *vertex );
+DLL_HIDDEN extern            void _vxgraph_textindex__delete_scorer( struct s_vgx_TextScorer_t **scorer );
+
+
+DLL_HIDDEN extern         int64_t _vxgraph_pagerank__process_candidates_ROG_or_CS( vgx_Graph_t *self, const vgx_PageRankCondition_t *pagerank, vgx_ExecutionTimingBudget_t *timing_budget, cxmalloc_object_processing_context_t *scan_context, CString_t **CSTR__error );
+
+
+DLL_HIDDEN extern vgx_NeighborSet_t * _vxgraph_neighbors__new_set( void );
+DLL_HIDDEN extern            void _vxgraph_neighbors__delete_set( vgx_NeighborSet_t **set );
+DLL_HIDDEN extern         int64_t _vxgraph_neighbors__extract( const vgx_Vertex_t *vertex_RO, vgx_arc_direction arcdir, vgx_virtual_ArcFilter_context_t *filter, vgx_predicator_rel_enum rel, vgx_NeighborSet_t *set );
+DLL_HIDDEN extern         int64_t _vxgraph_neighbors__intersect( const vgx_NeighborSet_t *A, const vgx_NeighborSet_t *B, bool adamic_adar, bool readonly_graph, vgx_CommonNeighbors_t *result );
+DLL_HIDDEN extern             int _vxgraph_neighbors__common( vgx_NeighborSet_t **sets, const vgx_Vertex_t *vertex_RO, const vgx_Vertex_t *other_RO, vgx_predicator_rel_enum rel, vgx_arc_direction arcdir, bool adamic_adar, vgx_CommonNeighbors_t *result );
+
+
 
 /*******************************************************************//**
  *
@@ -1009,6 +1049,7 @@ typedef struct s_IGraphCollector_t {
   vgx_BaseCollector_context_t * (*ConvertToBaseListCollector)( vgx_BaseCollector_context_t *collector );
   vgx_BaseCollector_context_t * (*TrimBaseListCollector)( vgx_BaseCollector_context_t *collector, int64_t n_collected, int offset, int64_t hits );
   int64_t (*TransferBaseList)( vgx_ranking_context_t *ranking_context, vgx_BaseCollector_context_t **src, vgx_BaseCollector_context_t **dest );
+  int64_t (*MergeArcCollector)( vgx_ArcCollector_context_t *collector, vgx_ArcCollector_context_t *other );
 } IGraphCollector_t;
 
 DLL_HIDDEN extern IGraphCollector_t iGraphCollector;
@@ -1027,15 +1068,50 @@ DLL_HIDDEN extern vgx_Vertex_t * _vxquery_collector__safe_head_access_ACQUIRE_CS
  *
  ***********************************************************************
  */
+typedef struct s_vgx_neighborhood_expansion_t {
+  vgx_Graph_t *graph;
+  bool readonly_graph;
+  vgx_ExecutionTimingBudget_t *timing_budget;
+  const vgx_Vertex_t *anchor_RO;
+  // Visited set (open addressing over vertex allocator offsets)
+  struct {
+    vgx_Vertex_t **slots;
+    int8_t *state;
+    int64_t mask;
+    int64_t n;
+  } visited;
+  // Current frontier (locked readonly unless readonly graph)
+  vgx_Vertex_t **frontier;
+  int64_t n_frontier;
+  int64_t cap_frontier;
+  bool frontier_locked;
+  // Next frontier being built
+  vgx_Vertex_t **next;
+  int64_t n_next;
+  int64_t cap_next;
+  int64_t remain;
+  // Candidate arcs from final frontier into unvisited neighborhood
+  vgx_Arc_t *candidates;
+  int64_t n_candidates;
+  int64_t cap_candidates;
+  int64_t n_candidate_heads;
+  int distance;
+} vgx_neighborhood_expansion_t;
+
+
 typedef struct s_IGraphTraverse_t {
   vgx_collect_counts_t (*GetNeighborhoodCollectableCounts)( vgx_Graph_t *self, bool readonly_graph, const vgx_Vertex_t *vertex_RO, vgx_arc_direction arcdir, int offset, int64_t hits );
   vgx_collect_counts_t (*GetGlobalCollectableCounts)( vgx_Graph_t *self, vgx_GlobalQuery_t *query );
   int64_t (*ValidateNeighborhoodCollectableCounts)( vgx_Graph_t *self, bool readonly_graph, vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO );
   int64_t (*ValidateGlobalCollectableCounts)( vgx_Graph_t *self, vgx_GlobalQuery_t *query );
   int (*TraverseNeighborArcs)( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *context );
+  int (*TraverseNeighborArcsParallel)( vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search );
   int (*TraverseNeighborVertices)( const vgx_Vertex_t *vertex_RO, vgx_neighborhood_search_context_t *search );
   int (*TraverseGlobalItems)( vgx_Graph_t *self, vgx_global_search_context_t *search, bool readonly_graph );
   int (*AggregateNeighborhood)( const vgx_Vertex_t *vertex_RO, vgx_aggregator_search_context_t *search );
+  vgx_neighborhood_expansion_t * (*NewNeighborhoodExpansion)( vgx_Graph_t *self, bool readonly_graph, vgx_NeighborhoodQuery_t *query, const vgx_Vertex_t *vertex_RO );
+  int (*TraverseExpandedNeighborhood)( vgx_neighborhood_expansion_t *expansion, vgx_neighborhood_search_context_t *search );
+  void (*DeleteNeighborhoodExpansion)( vgx_neighborhood_expansion_t **expansion );
 } IGraphTraverse_t;
 
 DLL_HIDDEN extern IGraphTraverse_t iGraphTraverse;
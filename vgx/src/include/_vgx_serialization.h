@@ -410,6 +410,7 @@ typedef struct s_vgx_ISerialization_t {
 
   void (*PrintGraphCounts_ROG)( vgx_Graph_t *self, const char *message );
   int64_t (*BulkSerialize)( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, bool force, bool remote, CString_t **CSTR__error );
+  int64_t (*BulkSerializeBackground)( vgx_Graph_t *self, vgx_ExecutionTimingBudget_t *timing_budget, bool remote, CString_t **CSTR__error );
   graph_state_t * (*LoadState)( vgx_Graph_t *self );
 
 } vgx_ISerialization_t;
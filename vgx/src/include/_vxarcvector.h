@@ -69,6 +69,7 @@ DLL_HIDDEN extern int     _vxarcvector_fhash__convert_array_of_arcs_to_simple_ar
 DLL_HIDDEN extern int     _vxarcvector_fhash__convert_simple_arc_to_multiple_arc(  framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *simple_arc_cell );
 DLL_HIDDEN extern int     _vxarcvector_fhash__convert_multiple_arc_to_simple_arc(  framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, vgx_ArcVector_cell_t *MAV );
 DLL_HIDDEN extern vgx_ArcVector_cell_t * _vxarcvector_fhash__get_arc_cell(         framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, const vgx_Vertex_t *KEY_vertex, vgx_ArcVector_cell_t *ret_arc_cell );
+DLL_HIDDEN extern int64_t _vxarcvector_fhash__process_heads(                       framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, const vgx_Vertex_t **heads, int64_t n );
 DLL_HIDDEN extern vgx_predicator_t _vxarcvector_fhash__get_predicator(             framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *MAV, vgx_predicator_t KEY_predicator );
 DLL_HIDDEN extern int     _vxarcvector_fhash__set_simple_arc(                      framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, vgx_Arc_t *arc );
 DLL_HIDDEN extern int     _vxarcvector_fhash__set_predicator_map(                  framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, vgx_Vertex_t *KEY_vertex, framehash_cell_t *VAL_framehash );
@@ -86,6 +87,23 @@ DLL_HIDDEN extern vgx_ArcHead_t * _vxarcvector_dispatch__get_arc(       framehas
 DLL_HIDDEN extern int         _vxarcvector_dispatch__array_add(         framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, vgx_Arc_t *arc, f_Vertex_connect_event connect_event );
 DLL_HIDDEN extern int         _vxarcvector_dispatch__array_remove(      framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, vgx_Arc_t *arc, vgx_ExecutionTimingBudget_t *timing_budget, f_Vertex_disconnect_event disconnect, int64_t *n_removed );
 
+// _vxarcvector_frozen
+DLL_HIDDEN extern int         _vxarcvector_frozen__freeze(              framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V );
+DLL_HIDDEN extern int         _vxarcvector_frozen__thaw(                framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V );
+DLL_HIDDEN extern int64_t     _vxarcvector_frozen__process(             const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor );
+DLL_HIDDEN extern int64_t     _vxarcvector_frozen__process_partition(   const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, int part, int nparts );
+DLL_HIDDEN extern int64_t     _vxarcvector_frozen__process_heads(       const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, const vgx_Vertex_t **heads, int64_t n );
+DLL_HIDDEN extern vgx_ArcVector_cell_t * _vxarcvector_frozen__get_arc_cell( const vgx_ArcVector_cell_t *V, const vgx_Vertex_t *KEY_vertex, vgx_ArcVector_cell_t *ret_arc_cell );
+DLL_HIDDEN extern int64_t     _vxarcvector_frozen__bytes(               const vgx_ArcVector_cell_t *V );
+
+// _vxarcvector_bloom
+DLL_HIDDEN extern int64_t     _vxarcvector_bloom__set_min_degree(      int64_t min_degree );
+DLL_HIDDEN extern int         _vxarcvector_bloom__rebuild(             framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V );
+DLL_HIDDEN extern int         _vxarcvector_bloom__added(               framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, const vgx_Vertex_t *head );
+DLL_HIDDEN extern int         _vxarcvector_bloom__removed(             framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V, int64_t n_removed );
+DLL_HIDDEN extern void        _vxarcvector_bloom__discard(             const vgx_ArcVector_cell_t *V );
+DLL_HIDDEN extern int64_t     _vxarcvector_bloom__bytes(               const vgx_ArcVector_cell_t *V );
+
 // _vxarcvector_serialization
 DLL_HIDDEN extern int64_t     _vxarcvector_serialization__serialize(    const vgx_ArcVector_cell_t *V, CQwordQueue_t *output );
 DLL_HIDDEN extern int64_t     _vxarcvector_serialization__deserialize(  vgx_Vertex_t *tail, vgx_ArcVector_cell_t *V, framehash_dynamic_t *dynamic, cxmalloc_family_t *vertex_allocator, CQwordQueue_t *input );
@@ -99,6 +117,25 @@ DLL_HIDDEN extern int64_t     _vxarcvector_serialization__deserialize(  vgx_Vert
 
 
 
+/*******************************************************************//**
+ * Blocked Bloom filter over the head vertices of an array of arcs.
+ * The filter replaces the frametop pointer in the array's FxP and holds
+ * the frametop itself, so all framehash access goes through it. Each key
+ * sets four bits in one cacheline-sized block.
+ ***********************************************************************
+ */
+CALIGNED_TYPE(struct) s_vgx_ArcVector_bloom_t {
+  framehash_cell_t *frametop; // top cell of the array's framehash
+  int64_t capacity;           // number of keys the filter was sized for
+  int64_t n_keys;             // number of keys added since last build
+  int64_t n_removed;          // number of arcs removed since last build
+  uint64_t mask;              // number of blocks - 1
+  QWORD __rsv[3];
+  // [ blocks ] follow
+} vgx_ArcVector_bloom_t;
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -115,6 +152,8 @@ DLL_HIDDEN extern int64_t     _vxarcvector_serialization__deserialize(  vgx_Vert
  * BLUE:    [ VxD VERTEX ][ FxP PRED  ]     =     [ 101 ][ 101 ]  SIMPLE ARC
  * RED:     [ VxD DEGREE ][ FxP FRAME ]     =     [ 111 ][ 000 ]  ARRAY OF ARCS
  * GREEN:   [ VxD VERTEX ][ FxP FRAME ]     =     [ 101 ][ 000 ]  MULTIPLE ARC
+ * ICE:     [ VxD DEGREE ][ FxP FROZEN]     =     [ 111 ][ 001 ]  FROZEN ARRAY OF ARCS
+ * RED+:    [ VxD DEGREE ][ FxP BLOOM ]     =     [ 111 ][ 010 ]  ARRAY OF ARCS WITH BLOOM FILTER
  * 
  * 
  ***********************************************************************
@@ -149,13 +188,18 @@ __inline static _vgx_ArcVector_cell_type __arcvector_cell_type( const vgx_ArcVec
     }
   case VGX_ARCVECTOR_VxD_DEGREE:
     // 111 000  Array of Arcs           RED
-    if( FxP_tag == VGX_ARCVECTOR_FxP_FRAME ) {
+    // 111 010  Array of Arcs w/Bloom   RED+
+    if( FxP_tag == VGX_ARCVECTOR_FxP_FRAME || FxP_tag == VGX_ARCVECTOR_FxP_BLOOM ) {
       return VGX_ARCVECTOR_ARRAY_OF_ARCS; // RED = ARRAY OF ARCS
     }
     // 111 100  Indegree Counter Only   GRAY
     else if( FxP_tag == VGX_ARCVECTOR_FxP_EMPTY ) {
       return VGX_ARCVECTOR_INDEGREE_COUNTER_ONLY;
     }
+    // 111 001  Frozen Array of Arcs    ICE
+    else if( FxP_tag == VGX_ARCVECTOR_FxP_FROZEN ) {
+      return VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS;
+    }
     // 111 ---
     else {
       goto error;
@@ -178,7 +222,8 @@ error:
  ******************************************************************************
  */
 __inline static bool __arcvector_has_framepointer( const vgx_ArcVector_cell_t *arc_cell ) {
-  return TPTR_AS_TAG( &arc_cell->FxP ) == VGX_ARCVECTOR_FxP_FRAME;
+  int FxP_tag = TPTR_AS_TAG( &arc_cell->FxP );
+  return FxP_tag == VGX_ARCVECTOR_FxP_FRAME || FxP_tag == VGX_ARCVECTOR_FxP_BLOOM;
 }
 
 
@@ -238,6 +283,9 @@ __inline static vgx_Vertex_t * __arcvector_get_vertex( const vgx_ArcVector_cell_
  ******************************************************************************
  */
 __inline static framehash_cell_t * __arcvector_as_frametop( const vgx_ArcVector_cell_t *arc_cell ) {
+  if( TPTR_AS_TAG( &arc_cell->FxP ) == VGX_ARCVECTOR_FxP_BLOOM ) {
+    return ((vgx_ArcVector_bloom_t*)TPTR_GET_POINTER( &arc_cell->FxP ))->frametop;
+  }
   return (framehash_cell_t*)TPTR_GET_POINTER( &arc_cell->FxP );
 }
 
@@ -275,7 +323,7 @@ __inline static void __arcvector_set_ephemeral_top( const vgx_ArcVector_cell_t *
  */
 __inline static framehash_cell_t __arcvector_avcell_get_ephemeral_top( const vgx_ArcVector_cell_t *av_cell ) {
   framehash_cell_t eph_top;
-  APTR_COPY( &eph_top, __arcvector_as_frametop( av_cell ) );
+  __arcvector_set_ephemeral_top( av_cell, &eph_top );
   return eph_top;
 }
 
@@ -469,6 +517,161 @@ __inline static vgx_ArcVector_cell_t * __arcvector_cell_set_multiple_arc( vgx_Ar
 
 
 
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+__inline static vgx_ArcVector_cell_t * __arcvector_cell_set_frozen_array_of_arcs( vgx_ArcVector_cell_t *cell, int64_t degree, const void *frozen ) {
+  // VxD: DEGREE
+  TPTR_SET_INTEGER_AND_TAG( &cell->VxD, degree, VGX_ARCVECTOR_VxD_DEGREE );
+  // FxP: FROZEN
+  TPTR_SET_POINTER_AND_TAG( &cell->FxP, frozen, VGX_ARCVECTOR_FxP_FROZEN );  // header line of the frozen arc array
+  return cell;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+__inline static bool __arcvector_cell_is_frozen( const vgx_ArcVector_cell_t *arc_cell ) {
+  return TPTR_AS_TAG( &arc_cell->FxP ) == VGX_ARCVECTOR_FxP_FROZEN;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+__inline static void * __arcvector_as_frozen( const vgx_ArcVector_cell_t *arc_cell ) {
+  return TPTR_GET_POINTER( &arc_cell->FxP );
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+__inline static bool __arcvector_cell_has_bloom( const vgx_ArcVector_cell_t *arc_cell ) {
+  return TPTR_AS_TAG( &arc_cell->FxP ) == VGX_ARCVECTOR_FxP_BLOOM;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+__inline static vgx_ArcVector_bloom_t * __arcvector_as_bloom( const vgx_ArcVector_cell_t *arc_cell ) {
+  return (vgx_ArcVector_bloom_t*)TPTR_GET_POINTER( &arc_cell->FxP );
+}
+
+
+
+/*******************************************************************//**
+ * 
+ * 
+ ***********************************************************************
+ */
+__inline static const cacheline_t * __arcvector_bloom_block( const vgx_ArcVector_bloom_t *bloom, uint64_t h ) {
+  return (const cacheline_t*)(bloom + 1) + (h & bloom->mask);
+}
+
+
+
+/*******************************************************************//**
+ * Four bit positions within the block selected by the low bits of h.
+ *
+ ***********************************************************************
+ */
+__inline static void __arcvector_bloom_bits( uint64_t h, uint64_t bits[4] ) {
+  bits[0] = (h >> 28) & 511;
+  bits[1] = (h >> 37) & 511;
+  bits[2] = (h >> 46) & 511;
+  bits[3] = (h >> 55);
+}
+
+
+
+/*******************************************************************//**
+ * Returns false if the array of arcs definitely has no arc to head.
+ * Returns true if it may have one, or if the array has no Bloom filter.
+ ***********************************************************************
+ */
+__inline static bool __arcvector_bloom_may_contain( const vgx_ArcVector_cell_t *V, const vgx_Vertex_t *head ) {
+  if( __arcvector_cell_has_bloom( V ) ) {
+    uint64_t h = ihash64( (uint64_t)head );
+    const uint64_t *q = __arcvector_bloom_block( __arcvector_as_bloom( V ), h )->qwords;
+    uint64_t b[4];
+    __arcvector_bloom_bits( h, b );
+    return ((q[b[0]>>6] >> (b[0]&63)) & (q[b[1]>>6] >> (b[1]&63)) & (q[b[2]>>6] >> (b[2]&63)) & (q[b[3]>>6] >> (b[3]&63)) & 1) != 0;
+  }
+  return true;
+}
+
+
+
+/*******************************************************************//**
+ * Process all arcs in an array of arcs, frozen or not. Frozen arrays are
+ * decoded into ephemeral framehash cells so the same cell processors
+ * apply to both representations.
+ ***********************************************************************
+ */
+__inline static int64_t __arcvector_process_arcarray( const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor ) {
+  if( __arcvector_cell_is_frozen( V ) ) {
+    return _vxarcvector_frozen__process( V, processor );
+  }
+  else {
+    return iFramehash.processing.ProcessNolock( processor );
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Process the arcs in partition part of nparts disjoint partitions of an
+ * array of arcs. All partitions together cover every arc exactly once.
+ ***********************************************************************
+ */
+__inline static int64_t __arcvector_process_arcarray_partition( const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, int part, int nparts ) {
+  if( nparts < 2 ) {
+    return __arcvector_process_arcarray( V, processor );
+  }
+  else if( __arcvector_cell_is_frozen( V ) ) {
+    return _vxarcvector_frozen__process_partition( V, processor, part, nparts );
+  }
+  else {
+    return iFramehash.processing.ProcessPartitionNolock( processor, part, nparts );
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Process only the arcs to the given heads (sorted by address without
+ * duplicates). Frozen arrays may merge heads with their sorted arcs,
+ * otherwise each head is looked up.
+ ***********************************************************************
+ */
+__inline static int64_t __arcvector_process_arcarray_heads( framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, framehash_processing_context_t *processor, const vgx_Vertex_t **heads, int64_t n, bool merge ) {
+  if( merge && __arcvector_cell_is_frozen( V ) ) {
+    return _vxarcvector_frozen__process_heads( V, processor, heads, n );
+  }
+  else {
+    return _vxarcvector_fhash__process_heads( dynamic, V, processor, heads, n );
+  }
+}
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -605,6 +808,27 @@ typedef struct __s_arcvector_traversal_output_context_t { VGX_ARCVECTOR_TRAVERSA
 
 
 
+/*******************************************************************//**
+ * BLOCK TRAVERSAL
+ * OUTPUT
+ *
+ * Arcs accepted for columnar filter evaluation are buffered here and
+ * flushed through the evaluator one block at a time.
+ ***********************************************************************
+ */
+typedef struct __s_arcvector_arc_block_t {
+  __arcvector_traversal_output_context_t *output;
+  vgx_Evaluator_t *evaluator;
+  bool positive;
+  bool collect;
+  int n;
+  const vgx_Vertex_t *head;
+  const vgx_Vertex_t *counted;
+  vgx_ArcHeadHeapItem_t arcs[ VGX_EXPRESS_EVAL_BATCH_SIZE ];
+} __arcvector_arc_block_t;
+
+
+
 /*******************************************************************//**
  * BIDIRECTIONAL TRAVERSAL
  * INPUT
@@ -36,6 +36,8 @@ static void __initialize_cmp_vertices( void );
 static f_vgx_VertexComparator __get_vertex_comparator( const vgx_ranking_context_t *ranking_context, vgx_CollectorItem_t *lowest );
 static void __get_vertex_collector_functions( const vgx_ranking_context_t *ranking_context, f_vgx_StageVertex *stagef, f_vgx_CollectVertex *collectf );
 static f_vgx_ArcComparator __get_arc_comparator( const vgx_ranking_context_t *ranking_context, vgx_CollectorItem_t *lowest );
+static vgx_CollectorFloorGate_t __get_vertex_floor_gate( f_vgx_VertexComparator comparator );
+static vgx_CollectorFloorGate_t __get_arc_floor_gate( f_vgx_ArcComparator comparator );
 static void __get_arc_collector_functions_by_sortspec( const vgx_sortspec_t sortspec, const vgx_predicator_mod_t modifier, f_vgx_StageArc *stagef, f_vgx_CollectArc *collectf );
 static void __get_arc_collector_functions( const vgx_ranking_context_t *ranking_context, f_vgx_StageArc *stagef, f_vgx_CollectArc *collectf );
 static f_vgx_ComputeArcDynamicRank __get_arc_rank_scorer_function( const vgx_ranking_context_t *ranking_context );
@@ -447,6 +449,58 @@ nosort:
 
 
 
+/*******************************************************************//**
+ * Return the typed floor gate matching a vertex heap comparator, or
+ * VGX_COLLECTOR_FLOOR_GATE_NONE when the comparator is not a plain
+ * numeric comparison (identifiers, internalids.)
+ *
+ ***********************************************************************
+ */
+static vgx_CollectorFloorGate_t __get_vertex_floor_gate( f_vgx_VertexComparator comparator ) {
+  if( comparator == NULL ) {
+    return VGX_COLLECTOR_FLOOR_GATE_NONE;
+  }
+  // Descending sort uses min-heap comparators
+  if( comparator == _iVertexMinComparator.cmp_vertex_double_rank ) { return VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC; }
+  if( comparator == _iVertexMinComparator.cmp_vertex_int64_rank )  { return VGX_COLLECTOR_FLOOR_GATE_INT64_DESC; }
+  if( comparator == _iVertexMinComparator.cmp_vertex_uint64_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT64_DESC; }
+  if( comparator == _iVertexMinComparator.cmp_vertex_uint32_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC; }
+  // Ascending sort uses max-heap comparators
+  if( comparator == _iVertexMaxComparator.cmp_vertex_double_rank ) { return VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC; }
+  if( comparator == _iVertexMaxComparator.cmp_vertex_int64_rank )  { return VGX_COLLECTOR_FLOOR_GATE_INT64_ASC; }
+  if( comparator == _iVertexMaxComparator.cmp_vertex_uint64_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT64_ASC; }
+  if( comparator == _iVertexMaxComparator.cmp_vertex_uint32_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC; }
+  return VGX_COLLECTOR_FLOOR_GATE_NONE;
+}
+
+
+
+/*******************************************************************//**
+ * Return the typed floor gate matching an arc heap comparator, or
+ * VGX_COLLECTOR_FLOOR_GATE_NONE when the comparator is not a plain
+ * numeric comparison (identifiers, internalids.)
+ *
+ ***********************************************************************
+ */
+static vgx_CollectorFloorGate_t __get_arc_floor_gate( f_vgx_ArcComparator comparator ) {
+  if( comparator == NULL ) {
+    return VGX_COLLECTOR_FLOOR_GATE_NONE;
+  }
+  // Descending sort uses min-heap comparators
+  if( comparator == _iArcMinComparator.cmp_archead_double_rank ) { return VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC; }
+  if( comparator == _iArcMinComparator.cmp_archead_int64_rank )  { return VGX_COLLECTOR_FLOOR_GATE_INT64_DESC; }
+  if( comparator == _iArcMinComparator.cmp_archead_uint64_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT64_DESC; }
+  if( comparator == _iArcMinComparator.cmp_archead_uint32_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC; }
+  // Ascending sort uses max-heap comparators
+  if( comparator == _iArcMaxComparator.cmp_archead_double_rank ) { return VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC; }
+  if( comparator == _iArcMaxComparator.cmp_archead_int64_rank )  { return VGX_COLLECTOR_FLOOR_GATE_INT64_ASC; }
+  if( comparator == _iArcMaxComparator.cmp_archead_uint64_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT64_ASC; }
+  if( comparator == _iArcMaxComparator.cmp_archead_uint32_rank ) { return VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC; }
+  return VGX_COLLECTOR_FLOOR_GATE_NONE;
+}
+
+
+
 /*******************************************************************//**
  *
  *
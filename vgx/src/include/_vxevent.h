@@ -178,9 +178,24 @@ __inline static __cutoff_timespec __get_executable_cutoff( void ) {
 
 
 
-extern int __schedule_events_WL( vgx_EventProcessor_t *processor_WL, vgx_ExecutionJobDescriptor_t **job );
+extern int __schedule_events_WL( vgx_EventProcessor_t *processor_WL, vgx_EventExecutorPool_t *executors );
 extern vgx_VertexEventQueue_t * __eventexec_cancel_execution_job_WL( vgx_ExecutionJobDescriptor_t **job, int timeout_ms );
-extern vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProcessor_t *processor_WL );
+extern vgx_ExecutionJobDescriptor_t * __eventexec_new_execution_job_WL( vgx_EventProcessor_t *processor_WL, int shard );
+extern vgx_EventExecutorPool_t * __eventexec_new_executor_pool( int n_shards );
+extern void __eventexec_delete_executor_pool( vgx_EventExecutorPool_t **executors );
+
+
+
+/**************************************************************************//**
+ * __eventexec_shard_of
+ *
+ * Events for the same vertex always map to the same executor shard.
+ *
+ ******************************************************************************
+ */
+__inline static int __eventexec_shard_of( const vgx_VertexStorableEvent_t *ev, int n_shards ) {
+  return n_shards > 1 ? (int)(ihash64( ev->event_key.allocdata ) % (uint64_t)n_shards) : 0;
+}
 
 
 // Queue
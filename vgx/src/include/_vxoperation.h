@@ -1364,6 +1364,7 @@ DLL_HIDDEN extern int _vxdurable_operation_capture__system_send_comment_SYS_CS(
 DLL_HIDDEN extern int _vxdurable_operation_capture__system_send_simple_aux_command_SYS_CS( struct s_vgx_Graph_t *SYSTEM, OperationProcessorAuxCommand cmd, CString_t *CSTR__command );
 DLL_HIDDEN extern int _vxdurable_operation_capture__system_forward_aux_command_SYS_CS( struct s_vgx_Graph_t *SYSTEM, OperationProcessorAuxCommand cmd, objectid_t cmd_id, vgx_StringList_t *cmd_data );
 DLL_HIDDEN extern int _vxdurable_operation_capture__system_send_raw_data_SYS_CS( struct s_vgx_Graph_t *SYSTEM, const char *data, int64_t dlen );
+DLL_HIDDEN extern int _vxdurable_operation_capture__system_send_snapshot_part_SYS_CS( struct s_vgx_Graph_t *SYSTEM, OperationProcessorAuxCommand cmd, objectid_t cmd_id, int64_t n_parts, int64_t part_id, const char *data, int64_t dlen );
 DLL_HIDDEN extern int _vxdurable_operation_capture__system_clone_graph_SYS_CS( struct s_vgx_Graph_t *SYSTEM, struct s_vgx_Graph_t *source );
 
 DLL_HIDDEN extern int _vxdurable_operation_capture__graph_truncate_CS( struct s_vgx_Graph_t *graph, vgx_vertex_type_t vxtype, int64_t n_discarded );
@@ -1483,7 +1484,7 @@ DLL_HIDDEN extern int          _vxdurable_operation_consumer_service__destroy_SY
 DLL_HIDDEN extern int          _vxdurable_operation_consumer_service__destroy_OPEN( vgx_TransactionalConsumerService_t *consumer_service );
 DLL_HIDDEN extern CString_t *  _vxdurable_operation_consumer_service__get_input_uri_SYS_CS( vgx_TransactionalConsumerService_t *consumer_service );
 DLL_HIDDEN extern CString_t *  _vxdurable_operation_consumer_service__get_provider_uri_SYS_CS( vgx_TransactionalConsumerService_t *consumer_service );
-DLL_HIDDEN extern int          _vxdurable_operation_consumer_service__subscribe_OPEN( struct s_vgx_Graph_t *SYSTEM, const char *host, uint16_t port, bool hardsync, int timeout_ms, CString_t **CSTR__error );
+DLL_HIDDEN extern int          _vxdurable_operation_consumer_service__subscribe_OPEN( struct s_vgx_Graph_t *SYSTEM, const char *host, uint16_t port, bool hardsync, bool snapshot, int timeout_ms, CString_t **CSTR__error );
 DLL_HIDDEN extern int          _vxdurable_operation_consumer_service__unsubscribe_OPEN( struct s_vgx_Graph_t *SYSTEM );
 
 
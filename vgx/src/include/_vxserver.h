@@ -102,8 +102,8 @@ typedef enum e_vgx_HTTPRequestHeaderField {
   HTTP_REQUEST_HEADER_FIELD__XVgxPartialTarget,
   HTTP_REQUEST_HEADER_FIELD__XVgxBuiltinExecutor,
   HTTP_REQUEST_HEADER_FIELD__XVgxBypassSOUT,
-  HTTP_REQUEST_HEADER_FIELD__XVgxRsv4,
-  HTTP_REQUEST_HEADER_FIELD__XVgxRsv5,
+  HTTP_REQUEST_HEADER_FIELD__XVgxDeadline,
+  HTTP_REQUEST_HEADER_FIELD__XVgxPriority,
   HTTP_REQUEST_HEADER_FIELD__XVgxRsv6,
   HTTP_REQUEST_HEADER_FIELD__XVgxRsv7,
   HTTP_REQUEST_HEADER_FIELD__XVgxRsv8
@@ -366,6 +366,7 @@ typedef struct s_vgx_SubscriberSynchronizer_t {
   } stage_TCS;
 
   bool sync_hard;
+  bool sync_snapshot;
   bool resume_tx_input;
 
   vgx_StringList_t *subscribers_URIs;
@@ -466,6 +467,8 @@ DLL_HIDDEN extern void                          vgx_server_resource__plugin_clea
 DLL_HIDDEN extern int                           vgx_server_resource__add_plugin( const char *plugin_name, vgx_server_plugin_phase phase );
 DLL_HIDDEN extern int                           vgx_server_resource__del_plugin( const char *plugin_name );
 DLL_HIDDEN extern uint8_t                       vgx_server_resource__get_plugin_phases( const char *plugin_name );
+DLL_HIDDEN extern int                           vgx_server_resource__set_plugin_admission( const char *plugin_name, int deadline_ms, vgx_server_request_priority priority );
+DLL_HIDDEN extern void                          vgx_server_resource__apply_plugin_admission( vgx_VGXServer_t *server, vgx_VGXServerRequest_t *request );
 DLL_HIDDEN extern int                           vgx_server_resource__has_pre_plugin( const char *plugin_name );
 DLL_HIDDEN extern int                           vgx_server_resource__has_exec_plugin( const char *plugin_name );
 DLL_HIDDEN extern int                           vgx_server_resource__has_post_plugin( const char *plugin_name );
@@ -559,6 +562,13 @@ DLL_HIDDEN extern void                          vgx_server_dispatch__destroy( vg
 
 // plugin
 DLL_HIDDEN extern int                           vgx_server_plugin__none( vgx_Graph_t *sysgraph, const char *plugin, vgx_URIQueryParameters_t *params, vgx_VGXServerRequest_t *request, vgx_VGXServerResponse_t *response, CString_t **CSTR__error );
+DLL_HIDDEN extern int                           vgx_server_plugin__native_init( void );
+DLL_HIDDEN extern void                          vgx_server_plugin__native_clear( void );
+DLL_HIDDEN extern int                           vgx_server_plugin__native_load( const char *path, vgx_Graph_t *graph, vgx_StringList_t **names, CString_t **CSTR__error );
+DLL_HIDDEN extern int                           vgx_server_plugin__native_remove( const char *plugin_name );
+DLL_HIDDEN extern vgx_StringList_t *            vgx_server_plugin__native_list( void );
+DLL_HIDDEN extern const vgx_NativePlugin_t *    vgx_server_plugin__native_get( const char *plugin_name, CString_t **CSTR__library, vgx_Graph_t **graph );
+DLL_HIDDEN extern int                           vgx_server_plugin__native_call( const char *plugin_name, vgx_URIQueryParameters_t *params, vgx_VGXServerRequest_t *request, vgx_VGXServerResponse_t *response, CString_t **CSTR__error );
 
 // util
 DLL_HIDDEN extern int                           vgx_server_util__sendall( vgx_URI_t *URI, vgx_VGXServerRequest_t *request, int timeout_ms );
@@ -614,6 +624,10 @@ DLL_HIDDEN extern void    vgx_server_dispatcher_matrix__deboost_replica( vgx_VGX
 DLL_HIDDEN extern int     vgx_server_dispatcher_matrix__width( const vgx_VGXServer_t *server );
 DLL_HIDDEN extern void    vgx_server_dispatcher_matrix__abort_channels( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerClient_t *client );
 DLL_HIDDEN extern void    vgx_server_dispatcher_matrix__channel_close( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel );
+DLL_HIDDEN extern int     vgx_server_dispatcher_matrix__channel_drain( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel );
+DLL_HIDDEN extern void    vgx_server_dispatcher_matrix__drain_complete( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel );
+DLL_HIDDEN extern void    vgx_server_dispatcher_matrix__drain_close( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel );
+DLL_HIDDEN extern void    vgx_server_dispatcher_matrix__expire_drained( vgx_VGXServerDispatcherMatrix_t *matrix, int64_t now_ns );
 
 
 // Dispatch
@@ -671,6 +685,8 @@ DLL_HIDDEN extern void    vgx_server_dispatcher_partition__clear( vgx_VGXServerD
 
 // Response
 DLL_HIDDEN extern int     vgx_server_dispatcher_response__handle( vgx_VGXServer_t *server, vgx_VGXServerDispatcherChannel_t *channel );
+DLL_HIDDEN extern int     vgx_server_dispatcher_response__drain_buffered( vgx_VGXServerDispatcherChannel_t *channel );
+DLL_HIDDEN extern int     vgx_server_dispatcher_response__drain( vgx_VGXServer_t *server, vgx_VGXServerDispatcherChannel_t *channel );
 
 // Client
 DLL_HIDDEN extern void    vgx_server_dispatcher_client__channel_append( vgx_VGXServerClient_t *client, vgx_VGXServerDispatcherChannel_t *channel );
@@ -713,6 +729,14 @@ DLL_HIDDEN extern int     vgx_server_dispatcher_asynctask__destroy( vgx_VGXServe
 #endif
 #define SEND_CHUNK_SZ           (1 << SEND_CHUNK_ORDER)
 
+// Max bytes offered to socket in one gather send (response headers and body)
+#if defined VGXSERVER_SEND_GATHER_ORDER
+#define SEND_GATHER_ORDER       VGXSERVER_SEND_GATHER_ORDER
+#else
+#define SEND_GATHER_ORDER       20
+#endif
+#define SEND_GATHER_SZ          (1 << SEND_GATHER_ORDER)
+
 #define WORKBUFFER_ORDER        16
 
 #define MAX_EXECUTOR_POOL_ORDER   5
@@ -840,6 +864,9 @@ DLL_HIDDEN extern int     vgx_server_dispatcher_asynctask__destroy( vgx_VGXServe
 // Unused channel will have socket closed after X seconds of inactivity
 #define CHANNEL_MAX_IDLE_SECONDS      15
 
+// Aborted channel is closed if the remainder of its response does not arrive within X seconds
+#define CHANNEL_MAX_DRAIN_SECONDS     10
+
 
 
 #define SERVER_MATRIX_WIDTH_NONE        0
@@ -852,6 +879,12 @@ DLL_HIDDEN extern int     vgx_server_dispatcher_asynctask__destroy( vgx_VGXServe
 
 #define EXECUTOR_DISPATCH_QUEUE_MAX_WAITING 4
 
+// Idle executor polls for work this many rounds before parking
+#define EXECUTOR_IDLE_SPIN_ROUNDS           32
+
+// Keep-alive connection stays with its previous executor unless that executor has this many requests queued
+#define EXECUTOR_AFFINITY_MAX_DEPTH         1
+
 
 
 
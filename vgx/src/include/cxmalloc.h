@@ -353,6 +353,11 @@ typedef struct s_cxmalloc_family_vtable_t {
   int               (*IsReadonly)(            struct s_cxmalloc_family_t *family ); 
   int               (*ClearReadonly)(         struct s_cxmalloc_family_t *family ); 
 
+  /* Fork support */
+  int               (*ForkPrepare)(           struct s_cxmalloc_family_t *family );
+  void              (*ForkParent)(            struct s_cxmalloc_family_t *family );
+  void              (*ForkChild)(             struct s_cxmalloc_family_t *family );
+
   /* Serialization (non-standard interface, separate from the COMLIB serialization protocol) */
   int64_t           (*BulkSerialize)(         struct s_cxmalloc_family_t *family, bool force );
   int64_t           (*RestoreObjects)(        struct s_cxmalloc_family_t *family );
@@ -1210,6 +1210,7 @@ typedef struct s_IFramehashProcessing_t {
   IMathCellProcessors_t * MathCellProcessors;
   int64_t (*ProcessNolockNocache)( framehash_processing_context_t *processor );
   int64_t (*ProcessNolock)( framehash_processing_context_t *processor );
+  int64_t (*ProcessPartitionNolock)( framehash_processing_context_t *processor, int part, int nparts );
 } IFramehashProcessing_t;
 
 
@@ -122,6 +122,7 @@ typedef struct s_vgx_IStreamBuffer_t {
   bool  (*IsSingleSegment)( const vgx_StreamBuffer_t *buffer );
   const char * (*EndSingleSegment)( const vgx_StreamBuffer_t *buffer );
   int64_t (*ReadableSegment)( vgx_StreamBuffer_t *buffer, int64_t max, const char **segment, const char **end );
+  int (*ReadableSegments)( vgx_StreamBuffer_t *buffer, int64_t max, cxiovec_t *iov );
   int64_t (*AdvanceRead)( vgx_StreamBuffer_t *buffer, int64_t n );
   int64_t (*Clear)( vgx_StreamBuffer_t *buffer );
   void (*Dump)( const vgx_StreamBuffer_t *buffer );
@@ -413,6 +414,23 @@ typedef enum e__plugin_phase {
 
 
 
+/*******************************************************************//**
+ * Request priority class (X-Vgx-Priority: low|normal|high)
+ *
+ * High priority requests are never shed at admission and are fetched
+ * ahead of other requests in their dispatch queue. Low priority requests
+ * are shed when their dispatch queue has no spare executor capacity.
+ ***********************************************************************
+ */
+typedef enum e__request_priority {
+    VGX_SERVER_REQUEST_PRIORITY__DEFAULT  = 0,
+    VGX_SERVER_REQUEST_PRIORITY__LOW      = 1,
+    VGX_SERVER_REQUEST_PRIORITY__NORMAL   = 2,
+    VGX_SERVER_REQUEST_PRIORITY__HIGH     = 3
+} vgx_server_request_priority;
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -899,15 +917,19 @@ typedef struct s_vgx_HTTPHeaders_t {
   struct {
     int8_t bypass_sout;
     int8_t resubmit;
-    int8_t _rsv_2_7_1_3;
+    int8_t priority;
     int8_t _rsv_2_7_1_4;
   } control;
 
   // [Q2.7.2]
   int nresubmit;
 
-  // [Q2.8]
-  QWORD __rsv_2_8;
+  // [Q2.8.1]
+  // Request deadline in milliseconds after request start (X-Vgx-Deadline), 0 if none
+  int deadline_ms;
+
+  // [Q2.8.2]
+  DWORD __rsv_2_8_2;
 
 } vgx_HTTPHeaders_t;
 
@@ -1186,7 +1208,7 @@ typedef struct s_vgx_VGXServerResponse_t {
       int16_t http_errcode;
       struct {
         uint8_t svc_exe   : 1;
-        uint8_t _rsv06    : 1;
+        uint8_t expired   : 1;
         uint8_t _rsv07    : 1;
         uint8_t _rsv08    : 1;
         uint8_t mem_err   : 1;
@@ -1343,8 +1365,12 @@ typedef struct s_vgx_VGXServerClient_t {
   // IO Loop's nanosecond timestamp for most recently completed request
   int64_t io_t1_ns;
 
-  // [Q4.8]
-  QWORD __rsv_4_8;
+  // [Q4.8.1]
+  // Executor that most recently served this connection (-1 if none)
+  int executor_affinity;
+
+  // [Q4.8.2]
+  DWORD __rsv_4_8_2;
 
 
 } vgx_VGXServerClient_t;
@@ -1501,7 +1527,9 @@ typedef struct s_vgx_VGXServerDispatcherChannel_t {
   vgx_VGXServerResponse_t *response;
 
   // [Q2.2]
-  int64_t __rsv_2_2;
+  // Channel's own response instance used to drain the remainder of a
+  // response to an aborted request (allocated on first use)
+  vgx_VGXServerResponse_t *drain;
 
   // [Q2.3.1]
   union {
@@ -1617,6 +1645,18 @@ __inline static bool __channel_io_inflight( const vgx_VGXServerDispatcherChannel
 
 
 
+/*******************************************************************//**
+ * Channel detached from its client while still receiving a response
+ *
+ ***********************************************************************
+ */
+__inline static bool __channel_io_draining( const vgx_VGXServerDispatcherChannel_t *channel ) {
+  return channel->parent.dynamic.client == NULL && __channel_io_inbound( channel );
+}
+#define CHANNEL_DRAINING( Channel ) __channel_io_draining( Channel )
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1934,20 +1974,28 @@ typedef struct s_vgx_VGXServerDispatcherMatrix_t {
   // [Q3.3.2]
   ATOMIC_VOLATILE_i32( backlog_count_atomic );
 
-  // [Q3.4]
-  QWORD __rsv_3_4;
+  // [Q3.4-5]
+  // Channels detached from aborted requests that are consuming the
+  // remainder of their responses so connections can be reused
+  struct {
+    // [Q3.4]
+    struct s_vgx_VGXServerDispatcherChannel_t *head;
 
-  // [Q3.5]
-  QWORD __rsv_3_5;
+    // [Q3.5]
+    struct s_vgx_VGXServerDispatcherChannel_t *tail;
+  } draining;
 
   // [Q3.6]
-  QWORD __rsv_3_6;
+  // Number of aborted channels drained and returned to the pool
+  int64_t n_drained;
 
   // [Q3.7]
-  QWORD __rsv_3_7;
+  // Number of aborted channels closed because they could not be drained
+  int64_t n_drain_closed;
 
   // [Q3.8]
-  QWORD __rsv_3_8;
+  // Number of channel connections opened to backend replicas
+  int64_t n_connects_MCS;
 
   // -------------------------------------------------------------------
 
@@ -2114,6 +2162,39 @@ typedef int (*f_vgx_ServicePluginCall)( const char *plugin_name, bool post, vgx_
 
 
 
+/*******************************************************************//**
+ * Native plugin ABI
+ *
+ * A native plugin library exports a function named by
+ * VGX_NATIVE_PLUGIN_ENTRYPOINT. It is called once when the library is
+ * loaded with the ABI version of the server and returns a NULL-terminated
+ * array of plugin definitions, or NULL if the version is not supported.
+ * Definitions must remain valid for the lifetime of the process.
+ *
+ * Plugin functions are called from executor threads without the Python
+ * GIL. The response body has been prepared so the function writes only
+ * the response value (e.g. a JSON object) to response->buffers.content.
+ * Return 0 on success. On failure return -1 with *CSTR__error describing
+ * the error and optionally response->info.http_errcode set.
+ *
+ * graph is the graph bound at load time, or NULL if none was bound.
+ ***********************************************************************
+ */
+#define VGX_NATIVE_PLUGIN_ABI_VERSION   1
+#define VGX_NATIVE_PLUGIN_ENTRYPOINT    "vgx_native_plugin_init"
+
+typedef int (*f_vgx_NativePluginCall)( struct s_vgx_Graph_t *graph, vgx_URIQueryParameters_t *params, vgx_VGXServerRequest_t *request, vgx_VGXServerResponse_t *response, CString_t **CSTR__error );
+
+typedef struct s_vgx_NativePlugin_t {
+  const char *name;
+  const char *description;
+  f_vgx_NativePluginCall call;
+} vgx_NativePlugin_t;
+
+typedef const vgx_NativePlugin_t * (*f_vgx_NativePluginInit)( int abi_version );
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -2174,6 +2255,43 @@ typedef struct s_vgx_VGXServerExecutorCompletion_t {
 
 
 
+#define EXECUTOR_LOCAL_QUEUE_ORDER  8
+#define EXECUTOR_LOCAL_QUEUE_SIZE   (1 << EXECUTOR_LOCAL_QUEUE_ORDER)
+#define EXECUTOR_LOCAL_QUEUE_MASK   (EXECUTOR_LOCAL_QUEUE_SIZE - 1)
+
+
+/*******************************************************************//**
+ * Bounded lock-free queue owned by one executor. The server thread is
+ * the only producer. The owning executor and its siblings serving the
+ * same dispatch queue consume by advancing head with compare-and-swap.
+ * 
+ ***********************************************************************
+ */
+typedef struct s_vgx_VGXServerExecutorLocalQueue_t {
+  // -------------------------------------------------------------------
+  // [Q1.1]
+  // Next slot to consume
+  ATOMIC_VOLATILE_i64 head_atomic;
+
+  // [Q1.2-8]
+  QWORD __rsv_1_2_8[7];
+
+  // -------------------------------------------------------------------
+  // [Q2.1]
+  // Next slot to produce (server thread)
+  ATOMIC_VOLATILE_i64 tail_atomic;
+
+  // [Q2.2-8]
+  QWORD __rsv_2_2_8[7];
+
+  // -------------------------------------------------------------------
+  // [Q3-]
+  ATOMIC_VOLATILE_i64 slot[ EXECUTOR_LOCAL_QUEUE_SIZE ];
+
+} vgx_VGXServerExecutorLocalQueue_t;
+
+
+
 /*******************************************************************//**
  * 
  * 
@@ -2196,6 +2314,7 @@ typedef struct s_vgx_VGXServerDispatchQueue_t {
   ATOMIC_VOLATILE_i32 length_atomic;
 
   // [Q2.8.2]
+  // Number of idle executors (spinning or parked)
   ATOMIC_VOLATILE_i32 n_waiting_atomic;
 
 
@@ -2224,19 +2343,32 @@ typedef struct s_vgx_VGXServerDispatchQueue_t {
   } flag;
 
   // [Q3.2.2]
-  DWORD __rsv_3_2_2;
+  // Number of executors fetching from this queue
+  int n_executors;
 
   // [Q3.3]
-  QWORD __rsv_3_3;
+  // Moving average of observed service time for requests in this queue
+  ATOMIC_VOLATILE_i64 service_ns_atomic;
 
   // [Q3.4]
-  QWORD __rsv_3_4;
+  // High priority requests, fetched before requests in the main queue
+  CQwordQueue_t *priority_queue;
 
-  // [Q3.5]
-  QWORD __rsv_3_5;
+  // [Q3.5.1]
+  // Pool index of first executor fetching from this queue
+  int executor_base;
 
-  // [Q3.6]
-  QWORD __rsv_3_6;
+  // [Q3.5.2]
+  // Rotating start position for executor selection (server thread)
+  int executor_cursor;
+
+  // [Q3.6.1]
+  // Number of entries in main queue and priority queue
+  ATOMIC_VOLATILE_i32 shared_atomic;
+
+  // [Q3.6.2]
+  // Number of executors parked on wake condition
+  ATOMIC_VOLATILE_i32 n_parked_atomic;
 
   // [Q3.7]
   QWORD __rsv_3_7;
@@ -2279,10 +2411,12 @@ typedef struct s_vgx_VGXServerWorkDispatch_t {
   int ready;
 
   // [Q15.3]
-  QWORD __rsv_15_3;
+  // Requests rejected at admission (updated by server loop)
+  int64_t n_rejected;
   
   // [Q15.4]
-  QWORD __rsv_15_4;
+  // Requests dropped by executors after their deadline expired in queue
+  ATOMIC_VOLATILE_i64 n_expired_atomic;
   
   // [Q15.5]
   QWORD __rsv_15_5;
@@ -2368,6 +2502,34 @@ typedef struct s_vgx_VGXServerExecutor_t {
 
   // --------------------------
 
+  // [Q2.1]
+  // Requests staged for this executor
+  vgx_VGXServerExecutorLocalQueue_t *localQ;
+
+  // [Q2.2]
+  // Requests taken from sibling executors' local queues
+  ATOMIC_VOLATILE_i64 n_stolen_atomic;
+
+  // [Q2.3]
+  // Requests staged here because of connection affinity
+  // OWNED BY SERVER THREAD
+  int64_t n_affine;
+
+  // [Q2.4]
+  QWORD __rsv_2_4;
+
+  // [Q2.5]
+  QWORD __rsv_2_5;
+
+  // [Q2.6]
+  QWORD __rsv_2_6;
+
+  // [Q2.7]
+  QWORD __rsv_2_7;
+
+  // [Q2.8]
+  QWORD __rsv_2_8;
+
 
 } vgx_VGXServerExecutor_t;
 
@@ -2864,6 +3026,13 @@ typedef struct s_vgx_IVGXServer_t {
       int (*Register)( const char *plugin_name, vgx_server_plugin_phase phase );
       int (*Unregister)( const char *plugin_name );
       uint8_t (*IsRegistered)( const char *plugin_name );
+      int (*SetAdmission)( const char *plugin_name, int deadline_ms, vgx_server_request_priority priority );
+      struct {
+        int (*Load)( const char *path, struct s_vgx_Graph_t *graph, vgx_StringList_t **names, CString_t **CSTR__error );
+        int (*Remove)( const char *plugin_name );
+        vgx_StringList_t * (*List)( void );
+        const vgx_NativePlugin_t * (*Get)( const char *plugin_name, CString_t **CSTR__library, struct s_vgx_Graph_t **graph );
+      } Native;
     } Plugin;
   } Resource;
 
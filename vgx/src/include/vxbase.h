@@ -3678,6 +3678,8 @@ typedef enum _e_vgx_ArcVector_VxD_tag {
 typedef enum _e_vgx_ArcVector_FxP_tag {
   /*  FxP                                  N D T                                  */
   VGX_ARCVECTOR_FxP_FRAME       = 0x0,  /*  0 0 0   ARRAY Pointer to Frame Top    */
+  VGX_ARCVECTOR_FxP_FROZEN      = 0x1,  /*  0 0 1   ARRAY Pointer to Frozen Array */
+  VGX_ARCVECTOR_FxP_BLOOM       = 0x2,  /*  0 1 0   ARRAY Pointer to Bloom Filter */
   VGX_ARCVECTOR_FxP_EMPTY       = 0x4,  /*  1 0 0   NO ARC                        */
   VGX_ARCVECTOR_FxP_PREDICATOR  = 0x5   /*  1 0 1   data 56-bit PREDICATOR        */
 } _vgx_ArcVector_FxP_tag;
@@ -3695,7 +3697,8 @@ typedef enum _e_vgx_ArcVector_cell_type {
   VGX_ARCVECTOR_ARRAY_OF_ARCS           = 2,
   VGX_ARCVECTOR_MULTIPLE_ARC            = 3,
   VGX_ARCVECTOR_INDEGREE_COUNTER_ONLY   = 4,
-  VGX_ARCVECTOR_INVALID                 = 5
+  VGX_ARCVECTOR_FROZEN_ARRAY_OF_ARCS    = 5,
+  VGX_ARCVECTOR_INVALID                 = 6
 } _vgx_ArcVector_cell_type;
 
 
@@ -4175,6 +4178,26 @@ typedef enum e_vgx_CollectorType_t {
 
 
 
+/*******************************************************************//**
+ * Typed admission test against the current top-k heap floor. Selected
+ * from the heap comparator when a sorted collector is created so that
+ * candidates which cannot enter the heap are rejected inline.
+ ***********************************************************************
+ */
+typedef enum e_vgx_CollectorFloorGate_t {
+  VGX_COLLECTOR_FLOOR_GATE_NONE         = 0x00,
+  VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC  = 0x01,
+  VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC   = 0x02,
+  VGX_COLLECTOR_FLOOR_GATE_INT64_DESC   = 0x03,
+  VGX_COLLECTOR_FLOOR_GATE_INT64_ASC    = 0x04,
+  VGX_COLLECTOR_FLOOR_GATE_UINT64_DESC  = 0x05,
+  VGX_COLLECTOR_FLOOR_GATE_UINT64_ASC   = 0x06,
+  VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC  = 0x07,
+  VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC   = 0x08
+} vgx_CollectorFloorGate_t;
+
+
+
 /*******************************************************************//**
  *
  ***********************************************************************
@@ -503,6 +503,24 @@ typedef struct s_vgx_EventParamInfo_t {
 
 
 
+#define VGX_EVENT_EXECUTOR_MAX_SHARDS 16
+
+
+
+/*******************************************************************//**
+ * 
+ ***********************************************************************
+ */
+typedef struct s_vgx_EventShardInfo_t {
+  int64_t n_current;    // number of events currently managed by executor shard
+  int64_t n_exec;       // number of completed events
+  int64_t n_transient;  // number of transient execution failures (will be re-tried)
+  int64_t n_yield;      // number of batches reduced to give way to foreground readers
+  int is_running;       // executor shard thread running
+} vgx_EventShardInfo_t;
+
+
+
 /*******************************************************************//**
  * 
  ***********************************************************************
@@ -522,6 +540,12 @@ typedef struct s_vgx_EventBacklogInfo_t {
     int is_paused;   // event monitor temporarily paused
   } flags;
   vgx_EventParamInfo_t param;
+  struct {
+    int64_t max_rate;     // shared execution rate limit (events per second, 0 = unlimited)
+    int64_t n_throttled;  // number of times executors were held back by rate limit
+    int n_shards;         // number of executor shards
+    vgx_EventShardInfo_t shard[ VGX_EVENT_EXECUTOR_MAX_SHARDS ];
+  } executor;
 } vgx_EventBacklogInfo_t;
 
 
@@ -1083,6 +1107,46 @@ typedef struct s_vgx_Relation_t {
 
 
 
+/*******************************************************************//**
+ * vgx_Mutation_t
+ *
+ * One item in a batch of mutations applied by MutateBatch(). Items are
+ * grouped by vertex and the vertices are acquired atomically, so each
+ * vertex is acquired once per batch.
+ *
+ * CONNECT       : relation->initial is the vertex, relation->terminal
+ *                 is created as VIRTUAL if it does not exist
+ * SET_PROPERTY  : property is set on vertex CSTR__idstr
+ * SET_VECTOR    : vector is set on vertex CSTR__idstr, and is stolen
+ *                 (set to NULL) when the vertex takes ownership
+ *
+ * Per-item result is placed in result (-1 on error, otherwise the
+ * return value of the mutation), reason and CSTR__error.
+ ***********************************************************************
+ */
+typedef enum e_vgx_MutationType_t {
+  VGX_MUTATION_NONE         = 0,
+  VGX_MUTATION_CONNECT      = 1,
+  VGX_MUTATION_SET_PROPERTY = 2,
+  VGX_MUTATION_SET_VECTOR   = 3
+} vgx_MutationType_t;
+
+typedef struct s_vgx_Mutation_t {
+  vgx_MutationType_t type;
+  int lifespan;
+  const CString_t *CSTR__idstr;
+  union {
+    vgx_Relation_t *relation;
+    struct s_vgx_VertexProperty_t *property;
+    vgx_Vector_t *vector;
+  };
+  int result;
+  vgx_AccessReason_t reason;
+  CString_t *CSTR__error;
+} vgx_Mutation_t;
+
+
+
 
 /*******************************************************************//**
  * vgx_collector_mode_t
@@ -1234,6 +1298,55 @@ DLL_VISIBLE extern const vgx_TimestampCondition_t DEFAULT_VGX_TIMESTAMP_CONDITIO
 
 
 
+/*******************************************************************//**
+ * vgx_GeoCondition_t
+ * Match vertices whose position (lat/lon properties declared by the
+ * graph's geo index) is within radius meters of a point.
+ ***********************************************************************
+ */
+typedef struct s_vgx_GeoCondition_t {
+  bool positive;
+  double lat;
+  double lon;
+  double radius;
+} vgx_GeoCondition_t;
+
+
+
+#define VGX_TEXT_INDEX_MAX_FIELDS 8
+#define VGX_TEXT_QUERY_MAX_TERMS  32
+
+
+
+/*******************************************************************//**
+ * vgx_TextMatchMode
+ *
+ ***********************************************************************
+ */
+typedef enum e_vgx_TextMatchMode {
+  VGX_TEXT_MATCH_ALL,
+  VGX_TEXT_MATCH_ANY,
+  VGX_TEXT_MATCH_PHRASE
+} vgx_TextMatchMode;
+
+
+
+/*******************************************************************//**
+ * vgx_TextCondition_t
+ * Match vertices whose text in a string property (declared by one of
+ * the graph's text indexes) contains all terms, any term, or the terms
+ * as a phrase.
+ ***********************************************************************
+ */
+typedef struct s_vgx_TextCondition_t {
+  bool positive;
+  vgx_TextMatchMode mode;
+  CString_t *CSTR__key;
+  CString_t *CSTR__terms;
+} vgx_TextCondition_t;
+
+
+
 /*******************************************************************//**
  *
  *
@@ -1308,6 +1421,10 @@ typedef struct s_vgx_VertexCondition_t {
     vgx_SimilarityCondition_t *similarity_condition;
     // Timestamp
     vgx_TimestampCondition_t *timestamp_condition;
+    // Geo
+    vgx_GeoCondition_t *geo_condition;
+    // Text
+    vgx_TextCondition_t *text_condition;
     // Properties
     vgx_PropertyConditionSet_t *property_condition_set;
     // Recursion
@@ -1372,6 +1489,176 @@ typedef union u_vgx_VertexSortValue_t {
 
 
 
+/*******************************************************************//**
+ * Keyset pagination position. Identifies the last item of a previous
+ * result page by its sort value and object ids so that the next page
+ * can resume strictly after it. The key selects the typed comparison
+ * and direction of the sort value, using the same encoding as the
+ * collector floor gate.
+ ***********************************************************************
+ */
+typedef struct s_vgx_CollectorCursor_t {
+  bool enabled;
+  bool positioned;
+  vgx_CollectorFloorGate_t key;
+  vgx_VertexSortValue_t sort;
+  objectid_t head;
+  objectid_t tail;
+  uint64_t predicator_data;
+} vgx_CollectorCursor_t;
+
+// Opaque token: key char, then sort value, head id (2), tail id (2) and predicator as 16 hex digits each
+#define VGX_COLLECTOR_CURSOR_TOKEN_SIZE (1 + 6*16 + 1)
+
+
+
+/*******************************************************************//**
+ * Multi-hop neighborhood expansion. Each hop expands the current
+ * frontier (initially the anchor) along arcs matching the hop's arc
+ * condition, following at most fanout arcs per frontier vertex.
+ * Vertices already visited by the expansion are not revisited. The
+ * neighborhood query is then executed from the final frontier.
+ ***********************************************************************
+ */
+#define VGX_EXPAND_MAX_HOPS 8
+
+typedef struct s_vgx_ExpandHop_t {
+  vgx_ArcConditionSet_t *arc_condition_set;
+  int64_t fanout;
+} vgx_ExpandHop_t;
+
+typedef struct s_vgx_ExpandCondition_t {
+  int n_hops;
+  vgx_ExpandHop_t hop[ VGX_EXPAND_MAX_HOPS ];
+} vgx_ExpandCondition_t;
+
+
+
+/*******************************************************************//**
+ * Execution plan for a neighborhood traversal where each head must be
+ * adjacent to one of a few terminal vertices. Either the anchor's arcs
+ * are iterated and adjacency to the terminal is probed for each head,
+ * or the terminals' arcs are iterated to find candidate heads which
+ * are intersected with the anchor's arcs, by lookup of each candidate
+ * (probe) or by merging sorted candidates with a frozen array (merge).
+ ***********************************************************************
+ */
+typedef enum e_vgx_neighborhood_plan_iterate {
+  VGX_NEIGHBORHOOD_PLAN_ITERATE_ANCHOR    = 0,
+  VGX_NEIGHBORHOOD_PLAN_ITERATE_TERMINAL  = 1
+} vgx_neighborhood_plan_iterate;
+
+typedef enum e_vgx_neighborhood_plan_intersect {
+  VGX_NEIGHBORHOOD_PLAN_INTERSECT_PROBE   = 0,
+  VGX_NEIGHBORHOOD_PLAN_INTERSECT_MERGE   = 1
+} vgx_neighborhood_plan_intersect;
+
+typedef struct s_vgx_NeighborhoodPlan_t {
+  bool planned;                             // traversal had a terminal adjacency condition
+  vgx_neighborhood_plan_iterate iterate;
+  vgx_neighborhood_plan_intersect intersect;
+  int64_t anchor_degree;                    // arcs of anchor in traversal direction
+  int64_t terminal_degree;                  // arcs of terminals leading to candidate heads
+  int64_t candidates;                       // distinct candidate heads when iterating terminals
+} vgx_NeighborhoodPlan_t;
+
+// Anchors with fewer arcs are always iterated
+#define VGX_NEIGHBORHOOD_PLAN_MIN_DEGREE 64
+
+
+
+/*******************************************************************//**
+ * Personalized PageRank from a weighted set of seed vertices, computed
+ * by residual push (random walk with restart probability alpha.)
+ * Residual mass is pushed along arcs matching the arc condition, split
+ * in proportion to arc weights. An arc's weight is the weight of its
+ * relationship (1.0 if not listed), multiplied by the arc value when
+ * arcvalue is set. Vertices are pushed while their residual is at
+ * least epsilon, up to max_iterations pushes. At most max_vertices
+ * vertices are tracked; mass flowing to other vertices is dropped.
+ ***********************************************************************
+ */
+typedef struct s_vgx_PageRankSeed_t {
+  CString_t *CSTR__id;
+  double weight;
+} vgx_PageRankSeed_t;
+
+typedef struct s_vgx_PageRankWeight_t {
+  CString_t *CSTR__relationship;
+  double weight;
+} vgx_PageRankWeight_t;
+
+typedef struct s_vgx_PageRankCondition_t {
+  int n_seeds;
+  vgx_PageRankSeed_t *seeds;
+  int n_weights;
+  vgx_PageRankWeight_t *weights;
+  vgx_ArcConditionSet_t *arc_condition_set;
+  double alpha;
+  double epsilon;
+  int64_t max_iterations;
+  int64_t max_vertices;
+  bool arcvalue;
+} vgx_PageRankCondition_t;
+
+#define VGX_PAGERANK_DEFAULT_ALPHA           0.15
+#define VGX_PAGERANK_DEFAULT_EPSILON         1e-6
+#define VGX_PAGERANK_DEFAULT_MAX_ITERATIONS  1000000
+#define VGX_PAGERANK_DEFAULT_MAX_VERTICES    100000
+
+
+
+/*******************************************************************//**
+ * Neighbor set of a vertex, as sorted distinct head vertex addresses
+ * of its arcs in one direction (or both for VGX_ARCDIR_ANY.) Buffers
+ * are reused when a set is extracted again. The evaluator keeps its
+ * extracted set for the traversal anchor until its context is reset.
+ ***********************************************************************
+ */
+typedef struct s_vgx_NeighborSet_t {
+  vgx_Vertex_t **heads;
+  int64_t n;
+  int64_t capacity;
+  // Extraction key (for reuse)
+  const vgx_Vertex_t *vertex;
+  vgx_predicator_rel_enum rel;
+  vgx_arc_direction arcdir;
+} vgx_NeighborSet_t;
+
+
+
+/*******************************************************************//**
+ * Common neighbors of two vertices and link prediction scores derived
+ * from their neighbor sets A and B.
+ *
+ *   jaccard     = |A & B| / |A | B|
+ *   cosine      = |A & B| / sqrt( |A| * |B| )
+ *   adamic_adar = SUM( 1 / log( degree(z) ) ) for z in A & B
+ *
+ * The degree of a common neighbor z is its total degree opposite to
+ * the direction of the neighbor sets (indegree for outarc neighbors.)
+ ***********************************************************************
+ */
+typedef struct s_vgx_CommonNeighbors_t {
+  int64_t n_common;
+  int64_t n_A;
+  int64_t n_B;
+  double jaccard;
+  double cosine;
+  double adamic_adar;
+} vgx_CommonNeighbors_t;
+
+// Gallop through the larger set when it is this many times larger
+#define VGX_COMMON_NEIGHBORS_GALLOP_RATIO 32
+
+
+#define VGX_PARALLEL_TRAVERSAL_DEFAULT_MIN_DEGREE   (1 << 16)
+#define VGX_PARALLEL_TRAVERSAL_DEFAULT_WORKERS      4
+#define VGX_PARALLEL_TRAVERSAL_MAX_WORKERS          16
+
+
+
+
 /*******************************************************************//**
  * vgx_vertex_rankspec_t 
  * 
@@ -1532,6 +1819,7 @@ do {                                                              \
   vgx_QueryType type;                                 \
   vgx_query_debug debug;                              \
   vgx_ExecutionTimingBudget_t timing_budget;          \
+  vgx_ExecutionTimingBudget_t *shared_timing_budget;  \
   vgx_ExecutionTime_t exe_time;                       \
   struct s_vgx_Graph_t *graph;                        \
   CString_t *CSTR__error;                             \
@@ -1616,6 +1904,7 @@ DLL_HIDDEN extern void vgx_AdjacencyQuery_UnregisterClass( void );
   struct s_vgx_Evaluator_t *selector;     \
   int offset;                             \
   int64_t hits;                           \
+  vgx_CollectorCursor_t cursor;           \
   struct s_vgx_BaseCollector_context_t *collector;
 
 
@@ -1628,13 +1917,16 @@ DLL_HIDDEN extern void vgx_AdjacencyQuery_UnregisterClass( void );
 #define __vgx_NeighborhoodQuery_vtable( Struct )  \
   __vgx_AdjacencyQuery_vtable( Struct )           \
   int (*SetResponseFormat)( Struct *self, vgx_ResponseAttrFastMask format );  \
-  int (*SelectStatement)( Struct *self, struct s_vgx_Graph_t *graph, const char *select_statement, CString_t **CSTR__error );
+  int (*SelectStatement)( Struct *self, struct s_vgx_Graph_t *graph, const char *select_statement, CString_t **CSTR__error ); \
+  int (*AddExpandHop)( Struct *self, vgx_ArcConditionSet_t **arc_condition_set, int64_t fanout );
 
 #define __vgx_NeighborhoodQuery_members             \
   __vgx_AdjacencyQuery_members                      \
   __vgx_ResultSetQuery_members                      \
   vgx_ArcConditionSet_t *collect_arc_condition_set; \
-  vgx_collector_mode_t collector_mode; 
+  vgx_collector_mode_t collector_mode;              \
+  vgx_ExpandCondition_t *expand_condition;          \
+  vgx_NeighborhoodPlan_t plan;
 
 #define __vgx_NeighborhoodQuery_args                  \
   __vgx_AdjacencyQuery_args                           \
@@ -1675,7 +1967,8 @@ DLL_HIDDEN extern void vgx_NeighborhoodQuery_UnregisterClass( void );
   __vgx_BaseQuery_members             \
   const CString_t *CSTR__vertex_id;   \
   int64_t n_items;                    \
-  vgx_collector_mode_t collector_mode; 
+  vgx_collector_mode_t collector_mode; \
+  vgx_PageRankCondition_t *pagerank_condition;
 
 
 
@@ -1687,7 +1980,8 @@ DLL_HIDDEN extern void vgx_NeighborhoodQuery_UnregisterClass( void );
 #define __vgx_GlobalQuery_vtable( Struct )    \
   __vgx_BaseQuery_vtable( Struct )            \
   int (*SetResponseFormat)( Struct *self, vgx_ResponseAttrFastMask format );  \
-  int (*SelectStatement)( Struct *self, struct s_vgx_Graph_t *graph, const char *select_statement, CString_t **CSTR__error );
+  int (*SelectStatement)( Struct *self, struct s_vgx_Graph_t *graph, const char *select_statement, CString_t **CSTR__error ); \
+  void (*SetPageRankCondition)( Struct *self, vgx_PageRankCondition_t **pagerank_condition );
 
 
 #define __vgx_GlobalQuery_args              \
@@ -2419,6 +2713,7 @@ typedef struct s_vgx_IGraphSimple_t {
   int64_t (*VertexDegree)( struct s_vgx_Graph_t *self, const CString_t *CSTR__vertex_name, vgx_AccessReason_t *reason );
   int64_t (*VertexInDegree)( struct s_vgx_Graph_t *self, const CString_t *CSTR__vertex_name, vgx_AccessReason_t *reason );
   int64_t (*VertexOutDegree)( struct s_vgx_Graph_t *self, const CString_t *CSTR__vertex_name, vgx_AccessReason_t *reason );
+  int64_t (*CommonNeighbors)( struct s_vgx_Graph_t *self, const CString_t *CSTR__vertex_name, CString_t **CSTR__others, int64_t n_others, vgx_ArcConditionSet_t *arc_condition_set, vgx_CommonNeighbors_t *result, int timeout_ms, vgx_AccessReason_t *reason, CString_t **CSTR__error );
 
   vgx_vertex_type_t (*VertexSetType)( struct s_vgx_Graph_t *self, const CString_t *CSTR__vertex_name, const CString_t *CSTR__vertex_type, int timeout_ms, vgx_AccessReason_t *reason );
   const CString_t * (*VertexGetType)( struct s_vgx_Graph_t *self, const CString_t *CSTR__vertex_name, int timeout_ms, vgx_AccessReason_t *reason );
@@ -2514,6 +2809,8 @@ typedef struct s_vgx_IGraphAdvanced_t {
 
   int64_t (*Disconnect_WL)( struct s_vgx_Graph_t *self, vgx_Arc_t *arc_WL );
 
+  int64_t (*MutateBatch)( struct s_vgx_Graph_t *self, vgx_Mutation_t *items, int64_t n, int timeout_ms, CString_t **CSTR__error );
+
   void (*DeleteCollector)( struct s_vgx_BaseCollector_context_t **collector );
 
   int (*GetOpenVertices)( struct s_vgx_Graph_t *self, int64_t thread_id_filter, Key64Value56List_t **readonly, Key64Value56List_t **writable );
@@ -2525,6 +2822,17 @@ typedef struct s_vgx_IGraphAdvanced_t {
 
   int64_t (*ResetSerial)( struct s_vgx_Graph_t *self, int64_t sn );
 
+  int64_t (*FreezeArcs)( struct s_vgx_Graph_t *self, int64_t min_degree, int64_t *ret_bytes, int64_t *ret_oversized );
+  int64_t (*ThawArcs)( struct s_vgx_Graph_t *self );
+
+  int64_t (*CreateGeoIndex)( struct s_vgx_Graph_t *self, const char *lat_key, const char *lon_key, CString_t **CSTR__error );
+  int (*DropGeoIndex)( struct s_vgx_Graph_t *self );
+
+  int64_t (*CreateTextIndex)( struct s_vgx_Graph_t *self, const char *key, CString_t **CSTR__error );
+  int (*DropTextIndex)( struct s_vgx_Graph_t *self, const char *key );
+
+  int (*ParallelTraversal)( struct s_vgx_Graph_t *self, int min_degree, int workers, int *ret_min_degree, int *ret_workers );
+
   void (*DebugPrintVertexAcquisitionMaps)( struct s_vgx_Graph_t *self );
   void (*DebugPrintAllocators)( struct s_vgx_Graph_t *self, const char *alloc_name );
   int (*DebugCheckAllocators)( struct s_vgx_Graph_t *self, const char *alloc_name );
@@ -2707,6 +3015,7 @@ typedef struct s_vgx_IOperation_t {
     int     (*SendSimpleAuxCommand)( struct s_vgx_Graph_t *SYSTEM, OperationProcessorAuxCommand cmd, CString_t *CSTR__command );
     int     (*ForwardAuxCommand)( struct s_vgx_Graph_t *SYSTEM, OperationProcessorAuxCommand cmd, objectid_t cmd_id, vgx_StringList_t *cmd_data );
     int     (*SendRawData)( struct s_vgx_Graph_t *SYSTEM, const char *data, int64_t dlen );
+    int     (*SendSnapshotPart)( struct s_vgx_Graph_t *SYSTEM, OperationProcessorAuxCommand cmd, objectid_t cmd_id, int64_t n_parts, int64_t part_id, const char *data, int64_t dlen );
     int     (*CloneGraph)( struct s_vgx_Graph_t *SYSTEM, struct s_vgx_Graph_t *source );
   } System_SYS_CS;
 
@@ -2717,7 +3026,7 @@ typedef struct s_vgx_IOperation_t {
       unsigned (*BoundPort)( struct s_vgx_Graph_t *SYSTEM );
       int (*IsDurable)( struct s_vgx_Graph_t *SYSTEM );
       int (*Stop)( struct s_vgx_Graph_t *SYSTEM );
-      int (*Subscribe)( struct s_vgx_Graph_t *SYSTEM, const char *host, uint16_t port, bool hardsync, int timeout_ms, CString_t **CSTR__error );
+      int (*Subscribe)( struct s_vgx_Graph_t *SYSTEM, const char *host, uint16_t port, bool hardsync, bool snapshot, int timeout_ms, CString_t **CSTR__error );
       int (*Unsubscribe)( struct s_vgx_Graph_t *SYSTEM );
       int (*SuspendExecution)( struct s_vgx_Graph_t *SYSTEM, int timeout_ms );
       int (*IsExecutionSuspended)( struct s_vgx_Graph_t *SYSTEM );
@@ -2743,6 +3052,7 @@ typedef struct s_vgx_IOperation_t {
 
   struct {
     int (*Sync)( struct s_vgx_Graph_t *graph, bool hard, int timeout_ms, CString_t **CSTR__error );
+    int (*SyncSnapshot)( struct s_vgx_Graph_t *graph, int timeout_ms, CString_t **CSTR__error );
   } Graph_OPEN;
 
   struct {
@@ -2837,12 +3147,13 @@ typedef struct s_vgx_ExecutionJobDescriptor_t {
   struct s_vgx_Graph_t *graph;
 
   // [3]
-  // Q3-6
+  // Q3-7
   struct {
     vgx_VertexEventHeap_t  *pri_inp;  // executor's input heap
     vgx_VertexEventQueue_t *lin_bat;  // execution batch
     vgx_VertexEventQueue_t *lin_imm;  // imminent execution (execute asap)
     vgx_VertexEventQueue_t *lin_pen;  // pending execution (execution should be re-tried)
+    vgx_VertexEventQueue_t *lin_stg;  // staged by event monitor for transfer into input heap (monitor owned)
   } Queue;
 
   // [5]
@@ -2861,11 +3172,83 @@ typedef struct s_vgx_ExecutionJobDescriptor_t {
   // Q9
   float ontime_rate;
 
+  // [9]
+  // Q10.1
+  int shard;
+
+  // [10]
+  // Q10.2
+  int __rsv_10_2;
+
+  // [11]
+  // Q11
+  int64_t n_transient;
+
+  // [12]
+  // Q12
+  int64_t n_yield;
+
+  // [13]
+  // Q13
+  struct s_vgx_EventExecutionThrottle_t *throttle;
 
 } vgx_ExecutionJobDescriptor_t;
 
 
 
+/*******************************************************************//**
+ *
+ * vgx_EventExecutionThrottle_t
+ *
+ * Shared by all executor shards. Limits the total execution rate and
+ * makes executors back off while the graph serves foreground readers.
+ *
+ ***********************************************************************/
+typedef struct s_vgx_EventExecutionThrottle_t {
+  // [1]
+  CS_LOCK lock;
+
+  // [2] Max events per second across all shards (0 = unlimited)
+  int64_t max_rate;
+
+  // [3] Start of current rate window
+  int64_t tms_window;
+
+  // [4] Events granted in current rate window
+  int64_t n_window;
+
+  // [5] Number of times any shard was throttled
+  int64_t n_throttled;
+
+} vgx_EventExecutionThrottle_t;
+
+
+
+/*******************************************************************//**
+ *
+ * vgx_EventExecutorPool_t
+ *
+ * Events are partitioned across shards by vertex so that no two shards
+ * ever contend for the same vertex.
+ *
+ ***********************************************************************/
+typedef struct s_vgx_EventExecutorPool_t {
+  // [1]
+  int n_shards;
+
+  // [2]
+  vgx_EventExecutionThrottle_t throttle;
+
+  // [3]
+  vgx_ExecutionJobDescriptor_t *shard[ VGX_EVENT_EXECUTOR_MAX_SHARDS ];
+
+  // [4]
+  DWORD thread_id[ VGX_EVENT_EXECUTOR_MAX_SHARDS ];
+
+} vgx_EventExecutorPool_t;
+
+
+
 
 struct s_vgx_EventActionTrigger_t;
 
@@ -2924,10 +3307,10 @@ CALIGNED_TYPE(union) u_vgx_EventProcessor_t {
     struct s_vgx_Graph_t *graph;
 
     // [Q1.3]
-    vgx_ExecutionJobDescriptor_t *EXECUTOR;
+    vgx_EventExecutorPool_t *EXECUTORS;
     
     // [Q1.4.1]
-    DWORD executor_thread_id;
+    DWORD __rsv_1_4_1;
 
     // [Q1.4.2]
     int ready;
@@ -3070,8 +3453,8 @@ typedef struct s_vgx_readonly_state_t {
       uint8_t TX_in_suspended : 1;
       uint8_t __rsv4          : 1;
       uint8_t is_serializing  : 1;
-      uint8_t __rsv6          : 1;
-      uint8_t __rsv7          : 1;
+      uint8_t is_snapshotting : 1;
+      uint8_t is_syncing      : 1;
       uint8_t __rsv8          : 1;
     } bit;
     uint8_t __rsv;
@@ -3170,6 +3553,79 @@ __inline static bool _vgx_is_serializing_CS( vgx_readonly_state_t *state_CS ) {
 
 
 
+/*******************************************************************//**
+ * Background snapshot in progress. Unlike serializing, the graph is
+ * writable while the snapshot is written.
+ ***********************************************************************
+ */
+__inline static void _vgx_set_snapshotting_CS( vgx_readonly_state_t *state_CS ) {
+  state_CS->__flags.bit.is_snapshotting = true;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ ***********************************************************************
+ */
+__inline static void _vgx_clear_snapshotting_CS( vgx_readonly_state_t *state_CS ) {
+  state_CS->__flags.bit.is_snapshotting = false;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ ***********************************************************************
+ */
+__inline static bool _vgx_is_snapshotting_CS( vgx_readonly_state_t *state_CS ) {
+  return state_CS->__flags.bit.is_snapshotting != 0;
+}
+
+
+
+/*******************************************************************//**
+ * Snapshot sync in progress. The graph is held readonly by the sync
+ * while persisted and transferred, which is not recorded as the
+ * graph's access state unless readonly is also held by others.
+ ***********************************************************************
+ */
+__inline static void _vgx_set_syncing_CS( vgx_readonly_state_t *state_CS ) {
+  state_CS->__flags.bit.is_syncing = true;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ ***********************************************************************
+ */
+__inline static void _vgx_clear_syncing_CS( vgx_readonly_state_t *state_CS ) {
+  state_CS->__flags.bit.is_syncing = false;
+}
+
+
+
+/*******************************************************************//**
+ * 
+ ***********************************************************************
+ */
+__inline static bool _vgx_is_syncing_CS( const vgx_readonly_state_t *state_CS ) {
+  return state_CS->__flags.bit.is_syncing != 0;
+}
+
+
+
+/*******************************************************************//**
+ * Return true if the only explicit readonly hold is by snapshot sync
+ ***********************************************************************
+ */
+__inline static bool _vgx_is_readonly_by_sync_only_CS( const vgx_readonly_state_t *state_CS ) {
+  return _vgx_is_syncing_CS( state_CS ) && state_CS->__n_explicit == 1;
+}
+
+
+
 /*******************************************************************//**
  * 
  ***********************************************************************
@@ -3552,6 +4008,7 @@ typedef struct s_vgx_Graph_vtable_t {
   void (*ClearSystemSyncCallback)( struct s_vgx_Graph_t *self );
   const char * (*FullPath)( const struct s_vgx_Graph_t *self );
   int64_t (*BulkSerialize)( struct s_vgx_Graph_t *self, int timeout_ms, bool force, bool remote, vgx_AccessReason_t *reason, CString_t **CSTR__error );
+  int64_t (*BulkSerializeBackground)( struct s_vgx_Graph_t *self, int timeout_ms, bool remote, vgx_AccessReason_t *reason, CString_t **CSTR__error );
   void (*Dump)( struct s_vgx_Graph_t *self );
   
   /* Simple API */
@@ -3624,8 +4081,8 @@ CALIGNED_TYPE(struct) s_vgx_Graph_t {
       // [Q2.7] Similarity object
       vgx_Similarity_t *similarity;
 
-      // [Q2.8]
-      QWORD __rsv_2_8;
+      // [Q2.8] Geo cell index (in-memory only, NULL when not declared)
+      struct s_vgx_GeoIndex_t *geoindex;
     };
   };
 
@@ -3719,11 +4176,14 @@ CALIGNED_TYPE(struct) s_vgx_Graph_t {
       // [Q8.4]
       ATOMIC_VOLATILE_i64 rev_size_atomic;
 
-      // [Q8.5]
-      QWORD __rsv_8_5;
+      // [Q8.5] Full-text index (in-memory only, NULL when not declared)
+      struct s_vgx_TextIndex_t *textindex;
 
-      // [Q8.6]
-      QWORD __rsv_8_6;
+      // [Q8.6] Parallel traversal of high degree vertices in readonly graph
+      struct {
+        int32_t min_degree;
+        int32_t workers;
+      } parallel_traversal;
 
       // [Q8.7]
       QWORD __rsv_8_7;
@@ -4953,6 +5413,7 @@ typedef struct s_vgx_IGraphFactory_t {
   int (*Size)( void );
   const vgx_Graph_t ** (*ListGraphs)( int64_t *n_graphs );
   int (*SyncAllGraphs)( bool hard, int timeout_ms, CString_t **CSTR__error );
+  int (*SyncAllGraphsSnapshot)( int timeout_ms, CString_t **CSTR__error );
   int (*CancelSync)( void );
   bool (*IsSyncActive)( void );
   objectid_t (*UniqueLabel)( void );
@@ -5036,7 +5497,9 @@ typedef struct s_vgx_IGraphEvent_t {
 
   int (*ExistsInSchedule_WL_NT)( vgx_Graph_t *self, vgx_Vertex_t *vertex_WL );
 
-  uint32_t (*ExecutorThreadId)( vgx_Graph_t *self );
+  bool (*IsExecutorThread)( vgx_Graph_t *self, uint32_t threadid );
+
+  int64_t (*SetExecutorThrottle)( vgx_Graph_t *self, int64_t max_rate );
 
 } vgx_IGraphEvent_t;
 
@@ -5531,6 +5994,15 @@ typedef struct s_vgx_neighborhood_probe_t {
   struct s_vgx_Evaluator_t *pre_evaluator;
   struct s_vgx_Evaluator_t *post_evaluator;
   vgx_virtual_ArcFilter_context_t *collect_filter_context;  /* Collection filter (for populating search results) to use for this neighborhood level */
+  struct {
+    int part;                                               /* Array of arcs partition traversed by this probe */
+    int nparts;                                             /* Number of partitions (0 or 1 means entire array) */
+  } partition;
+  struct {
+    const struct s_vgx_Vertex_t **heads;                    /* Traverse only arcs to these heads (sorted by address) when not NULL */
+    int64_t n;                                              /* Number of heads */
+    bool merge;                                             /* Merge heads with frozen array of arcs instead of lookup */
+  } candidates;
 } vgx_neighborhood_probe_t;
 
 
@@ -5564,6 +6036,27 @@ typedef struct s_vgx_timestamp_probe_t {
 
 
 
+typedef struct s_vgx_geo_probe_t {
+  bool positive;
+  shortid_t lat_keyhash;
+  shortid_t lon_keyhash;
+  double lat;
+  double lon;
+  double radius;
+} vgx_geo_probe_t;
+
+
+
+typedef struct s_vgx_text_probe_t {
+  bool positive;
+  vgx_TextMatchMode mode;
+  shortid_t keyhash;
+  int n_terms;
+  QWORD terms[ VGX_TEXT_QUERY_MAX_TERMS ];
+} vgx_text_probe_t;
+
+
+
 typedef struct s_vgx_similarity_probe_t {
   bool positive;
   struct s_vgx_Similarity_t *simcontext;  // shared clone of graph's simcontext, for use during query
@@ -5620,6 +6113,8 @@ typedef struct s_vgx_vertex_probe_t {
     } local_evaluator;
     vgx_degree_probe_t *degree_probe;
     vgx_timestamp_probe_t *timestamp_probe;
+    vgx_geo_probe_t *geo_probe;
+    vgx_text_probe_t *text_probe;
     vgx_similarity_probe_t *similarity_probe;
     vgx_property_probe_t *property_probe;
     struct {
@@ -5894,6 +6389,41 @@ __inline static void __set_stack_item_terminator( vgx_EvalStackItem_t *x ) {
 
 
 
+// Number of candidates evaluated together in columnar batch mode
+#define VGX_EXPRESS_EVAL_BATCH_SIZE 32
+
+// Deepest evaluation stack a program may use and still run in batch mode
+#define VGX_EXPRESS_EVAL_BATCH_MAX_DEPTH 8
+
+
+typedef enum e_vgx_ExpressEvalBatchStepKind {
+  VGX_EXPRESS_EVAL_BATCH_END = 0,
+  VGX_EXPRESS_EVAL_BATCH_BROADCAST, // operand identical for all candidates
+  VGX_EXPRESS_EVAL_BATCH_GATHER,    // operand gathered per candidate
+  VGX_EXPRESS_EVAL_BATCH_ADD,
+  VGX_EXPRESS_EVAL_BATCH_SUB,
+  VGX_EXPRESS_EVAL_BATCH_MUL,
+  VGX_EXPRESS_EVAL_BATCH_EQU,
+  VGX_EXPRESS_EVAL_BATCH_NEQ,
+  VGX_EXPRESS_EVAL_BATCH_GT,
+  VGX_EXPRESS_EVAL_BATCH_GTE,
+  VGX_EXPRESS_EVAL_BATCH_LT,
+  VGX_EXPRESS_EVAL_BATCH_LTE,
+  VGX_EXPRESS_EVAL_BATCH_AND,
+  VGX_EXPRESS_EVAL_BATCH_OR,
+  VGX_EXPRESS_EVAL_BATCH_NOT
+} vgx_ExpressEvalBatchStepKind;
+
+
+typedef struct s_vgx_ExpressEvalBatchStep_t {
+  // Column operation
+  vgx_ExpressEvalBatchStepKind kind;
+  // First program operation of a BROADCAST or GATHER operand
+  int offset;
+  // Number of program operations producing the operand
+  int count;
+} vgx_ExpressEvalBatchStep_t;
+
 
 
 typedef struct s_vgx_ExpressEvalProgram_t {
@@ -5928,6 +6458,12 @@ typedef struct s_vgx_ExpressEvalProgram_t {
 
   // Number of work register slots required by program
   int n_wreg;
+
+  // Number of operations reading or writing evaluator memory
+  int memory_ops;
+
+  // Columnar execution plan, NULL unless every operation can run over a block of candidates
+  vgx_ExpressEvalBatchStep_t *batch;
   
   // Literal strings
   vgx_ExpressEvalString_t *strings;
@@ -6112,6 +6648,8 @@ typedef struct s_vgx_ExpressEvalCache_t {
   vgx_ExpressEvalTypeEncCache_t vertextype;
   CString_t *CSTR__tmp_prop;
   int64_t sz_tmp_prop;
+  struct s_vgx_TextScorer_t *textscorer;
+  vgx_NeighborSet_t *neighbors[2];
 } vgx_ExpressEvalCache_t;
 
 
@@ -6130,6 +6668,8 @@ typedef struct s_vgx_Evaluator_vtable_t {
   vgx_EvalStackItem_t * (*Eval)( struct s_vgx_Evaluator_t *self );
   vgx_EvalStackItem_t * (*EvalVertex)( struct s_vgx_Evaluator_t *self, const vgx_Vertex_t *vertex );
   vgx_EvalStackItem_t * (*EvalArc)( struct s_vgx_Evaluator_t *self, vgx_LockableArc_t *next );
+  uint64_t (*EvalArcBlock)( struct s_vgx_Evaluator_t *self, vgx_LockableArc_t *next, const vgx_ArcHeadHeapItem_t *block, int n );
+  bool (*HasBatch)( const struct s_vgx_Evaluator_t *self );
   int (*PrevDeref)( const struct s_vgx_Evaluator_t *self );
   int (*ThisDeref)( const struct s_vgx_Evaluator_t *self );
   int (*HeadDeref)( const struct s_vgx_Evaluator_t *self );
@@ -6139,6 +6679,7 @@ typedef struct s_vgx_Evaluator_vtable_t {
   bool (*HasCull)( const struct s_vgx_Evaluator_t *self );
   int (*SynArcOps)( const struct s_vgx_Evaluator_t *self );
   int (*WRegOps)( const struct s_vgx_Evaluator_t *self );
+  int (*MemoryOps)( const struct s_vgx_Evaluator_t *self );
   int (*ClearWReg)( struct s_vgx_Evaluator_t *self );
   int64_t (*GetWRegNCall)( const struct s_vgx_Evaluator_t *self );
   void (*ClearMCull)( struct s_vgx_Evaluator_t *self );
@@ -6259,8 +6800,26 @@ __inline static vgx_ResponseAttrFastMask vgx_query_response_attr_fastmask( const
  * 
  ***********************************************************************
  */
+__inline static const vgx_CollectorCursor_t * vgx_query_cursor( const vgx_BaseQuery_t *query ) {
+  switch( query->type ) {
+  case VGX_QUERY_TYPE_NEIGHBORHOOD:
+    return &((vgx_NeighborhoodQuery_t*)query)->cursor;
+  case VGX_QUERY_TYPE_GLOBAL:
+    return &((vgx_GlobalQuery_t*)query)->cursor;
+  default:
+    return NULL;
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Timing budget of searches built from query. Worker queries in a
+ * parallel traversal share the budget of the calling search.
+ ***********************************************************************
+ */
 __inline static vgx_ExecutionTimingBudget_t * vgx_query_timing_budget( vgx_BaseQuery_t *query ) {
-  return &query->timing_budget;
+  return query->shared_timing_budget ? query->shared_timing_budget : &query->timing_budget;
 }
 
 
@@ -6722,6 +7281,9 @@ ALIGNED_TYPE( struct, 32 ) s_vgx_CollectorStage_t {
   int64_t sz_refmap;                          \
   vgx_CollectorStage_t *stage;                \
   Cm256iHeap_t *postheap;                     \
+  vgx_VertexSortValue_t floor;                \
+  vgx_CollectorFloorGate_t floor_gate;        \
+  vgx_CollectorCursor_t cursor;               \
   int64_t size;                               \
   int64_t n_remain;                           \
   int64_t n_collectable;                      \
@@ -6793,6 +7355,38 @@ __inline static bool _vgx_collector_is_sorted( vgx_BaseCollector_context_t *coll
 
 
 
+/*******************************************************************//**
+ * Return true if an item with the given sort value cannot enter the
+ * collector's top-k heap. Mirrors the heap comparator exactly: ties with
+ * the floor are rejected since the heap only replaces its root when the
+ * candidate sorts strictly higher.
+ ***********************************************************************
+ */
+__inline static bool _vgx_collector_below_floor( const vgx_BaseCollector_context_t *collector, const vgx_VertexSortValue_t sort ) {
+  switch( collector->floor_gate ) {
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_DESC:
+    return !(sort.flt64.value > collector->floor.flt64.value);
+  case VGX_COLLECTOR_FLOOR_GATE_DOUBLE_ASC:
+    return !(sort.flt64.value < collector->floor.flt64.value);
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_DESC:
+    return sort.int64.value <= collector->floor.int64.value;
+  case VGX_COLLECTOR_FLOOR_GATE_INT64_ASC:
+    return sort.int64.value >= collector->floor.int64.value;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT64_DESC:
+    return sort.uint64.value <= collector->floor.uint64.value;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT64_ASC:
+    return sort.uint64.value >= collector->floor.uint64.value;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_DESC:
+    return sort.uint32.value <= collector->floor.uint32.value;
+  case VGX_COLLECTOR_FLOOR_GATE_UINT32_ASC:
+    return sort.uint32.value >= collector->floor.uint32.value;
+  default:
+    return false;
+  }
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -6892,6 +7486,7 @@ typedef struct s_vgx_neighborhood_search_context_t {
   //
   vgx_collector_mode_t collector_mode;    // collect on this level? if so collect arcs or vertices?
   vgx_BaseCollector_context_t *collector; // shared collector instance for all neighborhood levels
+  vgx_NeighborhoodPlan_t plan;            // execution plan chosen for the traversal
 } vgx_neighborhood_search_context_t;
 
 
@@ -6905,6 +7500,7 @@ typedef struct s_vgx_neighborhood_search_context_t {
 typedef struct s_vgx_global_search_context_t {
   GLOBAL_SEARCH_CONTEXT_HEAD
   RESULT_SET_SEARCH_CONTEXT_HEAD
+  const vgx_PageRankCondition_t *pagerank;
   struct {
     vgx_collector_mode_t mode;
     union {
@@ -6953,6 +7549,15 @@ typedef int64_t (*f_Vertex_disconnect_event)( framehash_dynamic_t *dynamic, vgx_
 
 
 
+/*******************************************************************//**
+ * Arc visitor callback. Return 0 to continue, positive to stop the
+ * visit, or negative on error.
+ ***********************************************************************
+ */
+typedef int (*f_vgx_ArcVisitor)( void *context, const vgx_Arc_t *arc );
+
+
+
 /*******************************************************************//**
  * 
  *
@@ -6969,6 +7574,9 @@ typedef struct s_vgx_IArcVector_t {
   int (*Add)( framehash_dynamic_t *dynamic, vgx_Arc_t * arc, f_Vertex_connect_event connect_event );
   int64_t (*Remove)( framehash_dynamic_t *dynamic, vgx_Arc_t *arc, vgx_ExecutionTimingBudget_t *timing_budget, f_Vertex_disconnect_event disconnect_event );
   int64_t (*Expire)( framehash_dynamic_t *dynamic, vgx_Vertex_t *vertex_WL, uint32_t now_ts, uint32_t *next_ts );
+  int (*Freeze)( framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V );
+  int (*Thaw)( framehash_dynamic_t *dynamic, vgx_ArcVector_cell_t *V );
+  int64_t (*FrozenBytes)( const vgx_ArcVector_cell_t *V );
   vgx_ArcVector_cell_t * (*GetArcCell)( framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, const vgx_Vertex_t *KEY_vertex, vgx_ArcVector_cell_t *ret_arc_cell );
   vgx_predicator_t (*GetArcValue)( framehash_dynamic_t *dynamic, const vgx_ArcVector_cell_t *V, vgx_ArcHead_t *arc_head );
   vgx_ArcFilter_match (*GetArcs)( const vgx_ArcVector_cell_t *V, vgx_neighborhood_probe_t *neighborhood_probe );
@@ -6977,6 +7585,7 @@ typedef struct s_vgx_IArcVector_t {
   vgx_ArcFilter_match (*GetVerticesBidirectional)( const vgx_ArcVector_cell_t *V_IN, const vgx_ArcVector_cell_t *V_OUT, vgx_neighborhood_probe_t *neighborhood_probe );
   vgx_ArcFilter_match (*HasArc)( const vgx_ArcVector_cell_t *V, vgx_recursive_probe_t *recursive, vgx_neighborhood_probe_t *neighborhood_probe, vgx_Arc_t *first_match );
   vgx_ArcFilter_match (*HasArcBidirectional)( const vgx_ArcVector_cell_t *V_IN, const vgx_ArcVector_cell_t *V_OUT, vgx_neighborhood_probe_t *neighborhood_probe );
+  int64_t (*Visit)( vgx_Vertex_t *tail_RO, const vgx_ArcVector_cell_t *V, vgx_virtual_ArcFilter_context_t *filter, f_vgx_ArcVisitor visitor, void *context );
   int64_t (*Serialize)( const vgx_ArcVector_cell_t *V, CQwordQueue_t *output );
   int64_t (*Deserialize)( vgx_Vertex_t *tail, framehash_dynamic_t *dynamic, cxmalloc_family_t *vertex_allocator, vgx_ArcVector_cell_t *V, CQwordQueue_t *input );
   void (*PrintDebugDump)( const vgx_ArcVector_cell_t *V, const char *message );
@@ -7370,6 +7979,9 @@ typedef struct s_vgx_IGraphQuery_t {
   vgx_GlobalQuery_t       * (*CloneGlobalQuery)(        const vgx_GlobalQuery_t       *other, CString_t **CSTR__error );
   vgx_AggregatorQuery_t   * (*CloneAggregatorQuery)(    const vgx_AggregatorQuery_t   *other, CString_t **CSTR__error );
 
+  vgx_PageRankCondition_t * (*NewPageRankCondition)(    int n_seeds, int n_weights );
+  void                      (*DeletePageRankCondition)( vgx_PageRankCondition_t **pagerank_condition );
+
 } vgx_IGraphQuery_t;
 
 
@@ -7403,6 +8015,8 @@ typedef struct s_vgx_IVertexCondition_t {
   int (*RequireCreationTime)(         vgx_VertexCondition_t *vertex_condition, const vgx_value_condition_t tmc_condition );
   int (*RequireModificationTime)(     vgx_VertexCondition_t *vertex_condition, const vgx_value_condition_t tmm_condition );
   int (*RequireExpirationTime)(       vgx_VertexCondition_t *vertex_condition, const vgx_value_condition_t tmx_condition );
+  int (*RequireGeo)(                  vgx_VertexCondition_t *vertex_condition, bool positive, double lat, double lon, double radius );
+  int (*RequireText)(                 vgx_VertexCondition_t *vertex_condition, bool positive, const char *key, const char *terms, vgx_TextMatchMode mode );
 
   void (*RequireRecursiveCondition)(  vgx_VertexCondition_t *vertex_condition, vgx_VertexCondition_t **neighbor_condition );
   void (*RequireArcCondition)(        vgx_VertexCondition_t *vertex_condition, vgx_ArcConditionSet_t **arc_condition_set );
@@ -7429,6 +8043,8 @@ typedef struct s_vgx_IVertexCondition_t {
   int (*HasCreationTime)(             const vgx_VertexCondition_t *vertex_condition );
   int (*HasModificationTime)(         const vgx_VertexCondition_t *vertex_condition );
   int (*HasExpirationTime)(           const vgx_VertexCondition_t *vertex_condition );
+  int (*HasGeo)(                      const vgx_VertexCondition_t *vertex_condition );
+  int (*HasText)(                     const vgx_VertexCondition_t *vertex_condition );
   int (*HasRecursiveCondition)(       const vgx_VertexCondition_t *vertex_condition );
   int (*HasArcCondition)(             const vgx_VertexCondition_t *vertex_condition );
   int (*HasConditionFilter)(          const vgx_VertexCondition_t *vertex_condition );
@@ -7681,6 +8297,14 @@ typedef struct s_vgx_SearchResult_t {
   vgx_VertexCompleteIdentifier_t *head_identifiers;
   vgx_ResponseFieldData_t *list;
 
+  // Keyset pagination positions of listed items, and of the next page
+  // (enabled in cursor mode, positioned if more items may follow)
+  vgx_CollectorCursor_t *cursors;
+  vgx_CollectorCursor_t next_cursor;
+
+  // Execution plan of neighborhood traversal
+  vgx_NeighborhoodPlan_t plan;
+
   vgx_ExecutionTime_t exe_time;
   //
 
@@ -7703,6 +8327,8 @@ typedef struct s_vgx_IGraphResponse_t {
   void (*FormatResultsToStream)( vgx_Graph_t *self, vgx_BaseQuery_t *query, FILE *output );
   vgx_VertexProperty_t * (*SelectProperty)( vgx_Graph_t *graph, const char *name, vgx_VertexProperty_t *prop );
   vgx_Evaluator_t * (*ParseSelectProperties)( vgx_Graph_t *graph, const char *select_statement, vgx_Vector_t *vector, CString_t **CSTR__error );
+  const char * (*EncodeCursor)( const vgx_CollectorCursor_t *cursor, char *token );
+  int (*DecodeCursor)( const char *token, vgx_CollectorCursor_t *cursor, CString_t **CSTR__error );
 } vgx_IGraphResponse_t;
 
 
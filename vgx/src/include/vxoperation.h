@@ -539,13 +539,18 @@ typedef enum e_OperationProcessorAuxCommand {
   __OPAUX_MASK__PROP_DEL      = 0x00000400,
   __OPAUX_MASK__PROP_MULTI    = 0x00000800,
   __OPAUX_MASK__FORWARD       = 0x00001000,
+  __OPAUX_MASK__SNAPSHOT      = 0x00010000,
+  __OPAUX_MASK__SNAP_BEGIN    = 0x00020000,
+  __OPAUX_MASK__SNAP_FILE     = 0x00040000,
   OPAUX_NONE                  = 0,
   OPAUX_SYSTEM_PROPERTY       = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__PROPERTY,
   OPAUX_SYSTEM_SET_PROPERTY   = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__PROPERTY | __OPAUX_MASK__PROP_SET,
   OPAUX_SYSTEM_DEL_PROPERTY   = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__PROPERTY | __OPAUX_MASK__PROP_DEL,
   OPAUX_SYSTEM_SET_PROPERTIES = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__PROPERTY | __OPAUX_MASK__PROP_SET | __OPAUX_MASK__PROP_MULTI,
   OPAUX_SYSTEM_DEL_PROPERTIES = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__PROPERTY | __OPAUX_MASK__PROP_DEL | __OPAUX_MASK__PROP_MULTI,
-  OPAUX_RAW_DATA              = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__FORWARD
+  OPAUX_RAW_DATA              = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__FORWARD,
+  OPAUX_SNAPSHOT_BEGIN        = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__SNAPSHOT | __OPAUX_MASK__SNAP_BEGIN,
+  OPAUX_SNAPSHOT_FILE         = __OPAUX_MASK__SYSTEM | __OPAUX_MASK__SNAPSHOT | __OPAUX_MASK__SNAP_FILE
 } OperationProcessorAuxCommand;
 
 
@@ -54,6 +54,7 @@ DLL_HIDDEN void vgx_server_dispatcher_channel__dump( const vgx_VGXServerDispatch
     CXLIB_OSTREAM( "    next      = %llp", channel->chain.next );
     CXLIB_OSTREAM( "response" );
     vgx_server_response__dump( channel->response, NULL );
+    CXLIB_OSTREAM( "drain         = %llp", channel->drain );
     CXLIB_OSTREAM( "flag" );
     CXLIB_OSTREAM( "    partial   = %d", (int)channel->flag.partial );
     CXLIB_OSTREAM( "    busy      = %d", (int)channel->flag.busy );
@@ -136,7 +137,7 @@ DLL_HIDDEN int vgx_server_dispatcher_channel__init( vgx_VGXServer_t *server, int
     channel->response = NULL;
 
     // [Q2.2]
-    channel->__rsv_2_2 = 0;
+    channel->drain = NULL;
 
     // [Q2.3.1.1]
     channel->flag.partial = partition->flag.partial;
@@ -202,6 +203,9 @@ DLL_HIDDEN void vgx_server_dispatcher_channel__clear( vgx_VGXServerDispatcherCha
     // [Q2.8]
     free( channel->ident_request );
 
+    // [Q2.2]
+    vgx_server_response__delete( &channel->drain );
+
     // Zero everything
     memset( channel, 0, sizeof( vgx_VGXServerDispatcherChannel_t ) );
   }
@@ -105,7 +105,7 @@ DLL_HIDDEN int vgx_server_dispatcher_io__send( vgx_VGXServer_t *server, vgx_VGXS
   const char *segment = channel->request.read;
   const char *end = channel->request.end;
   size_t n_remain = end - segment;
-  size_t sz_segment = minimum_value( SEND_CHUNK_SZ, n_remain );
+  size_t sz_segment = minimum_value( SEND_GATHER_SZ, n_remain );
 
   // Send segment to socket
   int64_t n_sent = cxsend( &channel->socket, segment, sz_segment, 0 );
@@ -220,6 +220,10 @@ recv_segment:
 
 
 handle_channel_response:
+  // Channel is consuming the response to an aborted request
+  if( CHANNEL_DRAINING( channel ) ) {
+    return vgx_server_dispatcher_response__drain( server, channel );
+  }
   return vgx_server_dispatcher_response__handle( server, channel );
 
 payload_too_large:
@@ -417,7 +421,11 @@ static int __handle__Unrecoverable( vgx_VGXServer_t *server, vgx_VGXServerClient
 DLL_HIDDEN int vgx_server_dispatcher_io__handle_exception( vgx_VGXServer_t *server, vgx_VGXServerDispatcherChannel_t *channel, HTTPStatus code, const char *message ) {
   vgx_VGXServerClient_t *client = channel->parent.dynamic.client;
 
-  if( channel->state != VGXSERVER_CHANNEL_STATE__RESET && client != NULL ) {
+  // Error while draining response to aborted request, give up the connection
+  if( CHANNEL_DRAINING( channel ) ) {
+    vgx_server_dispatcher_matrix__drain_close( &server->matrix, channel );
+  }
+  else if( channel->state != VGXSERVER_CHANNEL_STATE__RESET && client != NULL ) {
     switch( code ) {
     case HTTP_STATUS__INTERNAL_SOCKET_ERROR:
       __handle__socket_error( server, client, channel, message );
@@ -65,6 +65,12 @@ DLL_HIDDEN void vgx_server_dispatcher_matrix__dump( const vgx_VGXServerDispatche
     vgx_server_client__dump( matrix->active.head, NULL );
     CXLIB_OSTREAM( "  tail");
     vgx_server_client__dump( matrix->active.tail, NULL );
+    CXLIB_OSTREAM( "draining");
+    CXLIB_OSTREAM( "  head             = @ %llp", matrix->draining.head );
+    CXLIB_OSTREAM( "  tail             = @ %llp", matrix->draining.tail );
+    CXLIB_OSTREAM( "n_drained          = %lld", matrix->n_drained );
+    CXLIB_OSTREAM( "n_drain_closed     = %lld", matrix->n_drain_closed );
+    CXLIB_OSTREAM( "n_connects_MCS     = %lld", matrix->n_connects_MCS );
     CXLIB_OSTREAM( "stream_set_pool");
     CXLIB_OSTREAM( "  sets");
     vgx_server_dispatcher_streams__dump_sets( matrix->stream_set_pool.sets, NULL );
@@ -155,6 +161,21 @@ DLL_HIDDEN int vgx_server_dispatcher_matrix__init( vgx_VGXServer_t *server, CStr
       // [Q1.5]
       matrix->active.tail = NULL;
 
+      // [Q3.4]
+      matrix->draining.head = NULL;
+
+      // [Q3.5]
+      matrix->draining.tail = NULL;
+
+      // [Q3.6]
+      matrix->n_drained = 0;
+
+      // [Q3.7]
+      matrix->n_drain_closed = 0;
+
+      // [Q3.8]
+      matrix->n_connects_MCS = 0;
+
       // [Q1.6]
       // Collection of stream set instances
       matrix->stream_set_pool.sets = vgx_server_dispatcher_streams__new_sets( server, cf );
@@ -261,6 +282,10 @@ DLL_HIDDEN void vgx_server_dispatcher_matrix__clear( vgx_VGXServer_t *server ) {
     if( matrix->active.head || matrix->active.tail ) {
       // BAD (active clients at destruction time)
     }
+
+    // Draining channels are owned by the (now deleted) partitions
+    matrix->draining.head = NULL;
+    matrix->draining.tail = NULL;
     // --------------------------------
 
 
@@ -308,9 +333,14 @@ DLL_HIDDEN int vgx_server_dispatcher_matrix__width( const vgx_VGXServer_t *serve
 DLL_HIDDEN void  vgx_server_dispatcher_matrix__abort_channels( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerClient_t *client ) {
   vgx_VGXServerDispatcherChannel_t *channel;
   while( (channel = client->dispatcher.channels.tail) != NULL ) {
-    // Partial I/O performed on aborted channel. We must close it to abandon I/O in delegate service
+    // Partial I/O performed on aborted channel. If the complete request was sent we keep
+    // the connection and drain the response in the background, otherwise we must close it
+    // to abandon I/O in delegate service
     if( CHANNEL_INFLIGHT( channel ) ) {
-      vgx_server_dispatcher_matrix__channel_close( matrix, channel );
+      if( vgx_server_dispatcher_matrix__channel_drain( matrix, channel ) < 0 ) {
+        vgx_server_dispatcher_matrix__channel_close( matrix, channel );
+        matrix->n_drain_closed++;
+      }
     }
     // Clean abort
     else {
@@ -538,6 +568,159 @@ DLL_HIDDEN void vgx_server_dispatcher_matrix__channel_close( vgx_VGXServerDispat
 
 
 
+/*******************************************************************//**
+ * Detach an in-flight channel from its (aborted) client and keep
+ * receiving the response in the background so the connection can be
+ * reused once the response is complete. The backend answers requests
+ * on a connection in order, so the connection is clean when the
+ * response to the aborted request has been consumed.
+ *
+ * The response may already be fully buffered, in which case no more
+ * data will arrive to drive the drain. The channel is then recycled
+ * immediately.
+ *
+ * Return:  0 if channel is now draining (or was already drained)
+ *         -1 if channel cannot be drained and must be closed
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int vgx_server_dispatcher_matrix__channel_drain( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel ) {
+  // Request was not completely sent
+  if( !CHANNEL_INBOUND( channel ) || channel->response == NULL ) {
+    return -1;
+  }
+
+  // Channel's own response instance
+  if( channel->drain == NULL ) {
+    if( (channel->drain = vgx_server_response__new( "channel.drain" )) == NULL ) {
+      return -1;
+    }
+  }
+
+  // Take over the response data received so far
+  vgx_VGXServerResponse_t *response = channel->response;
+  vgx_VGXServerResponse_t *drain = channel->drain;
+  vgx_server_response__reset( drain );
+  iStreamBuffer.Swap( drain->buffers.content, response->buffers.content );
+  iStreamBuffer.Clear( response->buffers.content );
+  drain->status = response->status;
+  drain->content_length = response->content_length;
+  drain->content_offset = response->content_offset;
+  drain->x_vgx_backlog = response->x_vgx_backlog;
+
+  // Detach from client (channel is not returned to replica until drained)
+  vgx_VGXServerChannelState state = channel->state;
+  vgx_server_dispatcher_client__channel_yank( channel->parent.dynamic.client, channel );
+
+  // Yielded channel belonged to client's I/O chain
+  if( channel->flag.yielded ) {
+    channel->flag.yielded = 0;
+    matrix->n_ch_yielded--;
+  }
+
+  // Resume receiving into channel's own response
+  channel->response = drain;
+  channel->flag.busy = true;
+  channel->t0_ns = __GET_CURRENT_NANOSECOND_TICK();
+  CHANNEL_UPDATE_STATE( channel, state );
+
+  VGX_LLIST_APPEND( matrix->draining, channel );
+
+  // Complete response already buffered
+  int complete = vgx_server_dispatcher_response__drain_buffered( channel );
+  if( complete > 0 ) {
+    vgx_server_dispatcher_matrix__drain_complete( matrix, channel );
+  }
+  else if( complete < 0 ) {
+    vgx_server_dispatcher_matrix__drain_close( matrix, channel );
+  }
+
+  return 0;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static void __matrix__drain_detach( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel ) {
+  VGX_LLIST_YANK( matrix->draining, channel );
+  CHANNEL_UPDATE_STATE( channel, VGXSERVER_CHANNEL_STATE__READY );
+  channel->flag.busy = false;
+  channel->request.read = NULL;
+  channel->request.end = NULL;
+  channel->request.cost = -1;
+}
+
+
+
+/*******************************************************************//**
+ * Response to aborted request fully consumed. Return the connected
+ * channel to its replica.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void vgx_server_dispatcher_matrix__drain_complete( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel ) {
+  __matrix__drain_detach( matrix, channel );
+  matrix->n_drained++;
+
+  // Replica cost is updated from backlog reported in drained response
+  vgx_server_dispatcher_replica__push_channel( channel->parent.permanent.replica, channel );
+
+  vgx_server_response__reset( channel->drain );
+  channel->response = NULL;
+}
+
+
+
+/*******************************************************************//**
+ * Draining failed. Close the channel and return it to its replica.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void vgx_server_dispatcher_matrix__drain_close( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXServerDispatcherChannel_t *channel ) {
+  __matrix__drain_detach( matrix, channel );
+  matrix->n_drain_closed++;
+
+  SYNCHRONIZE_ON( matrix->lock ) {
+    CXSOCKET *psock = &channel->socket;
+    cxclose( &psock );
+    channel->flag.connected_MCS = false;
+    channel->request.counter = -1;
+  } RELEASE;
+
+  CHANNEL_UPDATE_STATE( channel, VGXSERVER_CHANNEL_STATE__RESET );
+
+  vgx_server_response__reset( channel->drain );
+  channel->response = NULL;
+  vgx_server_dispatcher_replica__push_channel( channel->parent.permanent.replica, channel );
+}
+
+
+
+/*******************************************************************//**
+ * Close draining channels whose responses have not completed within
+ * the drain time limit.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void vgx_server_dispatcher_matrix__expire_drained( vgx_VGXServerDispatcherMatrix_t *matrix, int64_t now_ns ) {
+  int64_t max_drain_ns = CHANNEL_MAX_DRAIN_SECONDS * 1000000000LL;
+  vgx_VGXServerDispatcherChannel_t *channel = matrix->draining.head;
+  while( channel ) {
+    vgx_VGXServerDispatcherChannel_t *next = channel->chain.next;
+    if( now_ns - channel->t0_ns > max_drain_ns ) {
+      VGX_SERVER_DISPATCHER_VERBOSE( 0x000, "Drain timeout: channel %d.%d.%d", channel->id.channel, channel->id.replica, channel->id.partition );
+      vgx_server_dispatcher_matrix__drain_close( matrix, channel );
+    }
+    channel = next;
+  }
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -576,6 +759,7 @@ static int __channel_connect( vgx_VGXServerDispatcherMatrix_t *matrix, vgx_VGXSe
 
       // Mark as connected
       channel->flag.connected_MCS = true;
+      matrix->n_connects_MCS++;
     }
   } RELEASE;
 
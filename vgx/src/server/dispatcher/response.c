@@ -190,3 +190,102 @@ error:
 
 
 }
+
+
+
+/*******************************************************************//**
+ * Consume buffered data of the response to an aborted request on a
+ * draining channel. Content is discarded.
+ *
+ * Return:  1 if the response is complete
+ *          0 if more data is needed
+ *         -1 on error
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int vgx_server_dispatcher_response__drain_buffered( vgx_VGXServerDispatcherChannel_t *channel ) {
+  int sz = 0;
+  const char *line = NULL;
+
+  vgx_VGXServerResponse_t *ch_response = channel->response;
+  vgx_StreamBuffer_t *rbuf = ch_response->buffers.content;
+  vgx_HTTPResponseHeaderField field;
+
+  switch( CHANNEL_STATE_NOERROR( channel ) ) {
+
+  // ------------------------------
+  // Response line
+  // ------------------------------
+  case VGXSERVER_CHANNEL_STATE__RECV_INITIAL:
+    if( (line = iStreamBuffer.GetLinearLine( rbuf, ch_response->content_offset, HTTP_LINE_MAX, &sz )) == NULL ) {
+      goto incomplete_line;
+    }
+    if( vgx_server_parser__parse_response_initial_line( line, ch_response ) < 0 ) {
+      return -1;
+    }
+    ch_response->content_offset += sz;
+    CHANNEL_UPDATE_STATE( channel, VGXSERVER_CHANNEL_STATE__RECV_HEADERS );
+
+  // ------------------------------
+  // Header line(s)
+  // ------------------------------
+  case VGXSERVER_CHANNEL_STATE__RECV_HEADERS:
+    do {
+      if( (line = iStreamBuffer.GetLinearLine( rbuf, ch_response->content_offset, HTTP_LINE_MAX, &sz )) == NULL ) {
+        goto incomplete_line;
+      }
+      field = vgx_server_parser__parse_response_header_line( line, ch_response );
+      ch_response->content_offset += sz;
+    } while( field != HTTP_RESPONSE_HEADER__END_OF_HEADERS );
+
+    CHANNEL_UPDATE_STATE( channel, VGXSERVER_CHANNEL_STATE__RECV_CONTENT );
+
+  // ------------------------------
+  // Response content (discarded)
+  // ------------------------------
+  case VGXSERVER_CHANNEL_STATE__RECV_CONTENT:
+    // Discard content received so far, keep track of remaining content
+    ch_response->content_length -= iStreamBuffer.Size( rbuf ) - ch_response->content_offset;
+    ch_response->content_offset = 0;
+    iStreamBuffer.Clear( rbuf );
+    if( ch_response->content_length > 0 ) {
+      return 0;
+    }
+    // Connection is clean
+    return 1;
+
+  default:
+    return -1;
+  }
+
+incomplete_line:
+  if( (iStreamBuffer.Size( rbuf ) - ch_response->content_offset) < HTTP_LINE_MAX ) {
+    return 0;
+  }
+  return -1;
+}
+
+
+
+/*******************************************************************//**
+ * Consume the response to an aborted request on a draining channel.
+ * The channel is returned to its replica when the response is complete.
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int vgx_server_dispatcher_response__drain( vgx_VGXServer_t *server, vgx_VGXServerDispatcherChannel_t *channel ) {
+  int complete = vgx_server_dispatcher_response__drain_buffered( channel );
+  if( complete < 0 ) {
+    return vgx_server_dispatcher_io__handle_exception( server, channel, HTTP_STATUS__INTERNAL_SOCKET_ERROR, NULL );
+  }
+
+  if( complete > 0 ) {
+    // Connection is clean, channel can be reused
+    vgx_server_dispatcher_matrix__drain_complete( &server->matrix, channel );
+
+    // Dispatch next in line client if backlog exists
+    vgx_server_dispatcher_dispatch__apply_backlog( server );
+  }
+
+  return 0;
+}
@@ -177,6 +177,7 @@ static int64_t                  _stream_buffer__advance_write( vgx_StreamBuffer_
 static bool                     _stream_buffer__is_single_segment( const vgx_StreamBuffer_t *buffer );
 static const char *             _stream_buffer__end_single_segment( const vgx_StreamBuffer_t *buffer );
 static int64_t                  _stream_buffer__readable_segment( vgx_StreamBuffer_t *buffer, int64_t max, const char **segment, const char **end );
+static int                      _stream_buffer__readable_segments( vgx_StreamBuffer_t *buffer, int64_t max, cxiovec_t *iov );
 static int64_t                  _stream_buffer__advance_read( vgx_StreamBuffer_t *buffer, int64_t n );
 static int64_t                  _stream_buffer__clear( vgx_StreamBuffer_t *buffer );
 static void                     _stream_buffer__dump( const vgx_StreamBuffer_t *buffer );
@@ -215,6 +216,7 @@ DLL_EXPORT vgx_IStreamBuffer_t iStreamBuffer = {
   .IsSingleSegment    = _stream_buffer__is_single_segment,
   .EndSingleSegment   = _stream_buffer__end_single_segment,
   .ReadableSegment    = _stream_buffer__readable_segment,
+  .ReadableSegments   = _stream_buffer__readable_segments,
   .AdvanceRead        = _stream_buffer__advance_read,
   .Clear              = _stream_buffer__clear,
   .Dump               = _stream_buffer__dump
@@ -999,6 +1001,37 @@ static int64_t _stream_buffer__readable_segment( vgx_StreamBuffer_t *buffer, int
 
 
 
+/*******************************************************************//**
+ * Describe up to max bytes of readable content as one or two linear
+ * segments in iov (two when readable region wraps.)
+ *
+ * Returns the number of segments.
+ ***********************************************************************
+ */
+static int _stream_buffer__readable_segments( vgx_StreamBuffer_t *buffer, int64_t max, cxiovec_t *iov ) {
+  int n_iov = 0;
+  int64_t n;
+  if( max > 0 && (n = __is_single_segment( buffer ) ? buffer->wp - buffer->rp : __sz_end_segment( buffer, buffer->rp )) > 0 ) {
+    if( n > max ) {
+      n = max;
+    }
+    iov[n_iov].base = buffer->rp;
+    iov[n_iov++].len = n;
+    max -= n;
+    // Wrapped remainder at start of buffer
+    if( max > 0 && !__is_single_segment( buffer ) && (n = __sz_start_segment( buffer, buffer->wp )) > 0 ) {
+      if( n > max ) {
+        n = max;
+      }
+      iov[n_iov].base = buffer->data;
+      iov[n_iov++].len = n;
+    }
+  }
+  return n_iov;
+}
+
+
+
 /*******************************************************************//**
  * Advance cursor for readable content
  *
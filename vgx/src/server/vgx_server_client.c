@@ -498,8 +498,11 @@ DLL_HIDDEN int vgx_server_client__create_pool( vgx_VGXServer_t *server, int capa
       // [Q4.7]
       client->io_t1_ns = 0;
 
-      // [Q4.8]
-      client->__rsv_4_8 = 0;
+      // [Q4.8.1]
+      client->executor_affinity = -1;
+
+      // [Q4.8.2]
+      client->__rsv_4_8_2 = 0;
 
       ++client;
     }
@@ -571,6 +574,8 @@ static vgx_VGXServerClient_t * __client__register( vgx_VGXServer_t *server, vgx_
   client->partial_ident._bits = 0;
   // Reset metas
   memset( &client->dispatch_metas, 0, sizeof(client->dispatch_metas) );
+  // New connection has no executor affinity
+  client->executor_affinity = -1;
 
   return client;
 }
@@ -32,27 +32,102 @@ SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
 
 
 
-static int64_t                      __dispatch__length( vgx_VGXServerWorkDispatch_t *dispatch );
-static void                         __dispatch__drain( vgx_VGXServerWorkDispatch_t *dispatch );
+static int64_t                      __local_queue__depth( vgx_VGXServerExecutorLocalQueue_t *LQ );
+static bool                         __local_queue__push( vgx_VGXServerExecutorLocalQueue_t *LQ, vgx_VGXServerClient_t *client );
+static bool                         __local_queue__pop( vgx_VGXServerExecutorLocalQueue_t *LQ, vgx_VGXServerClient_t **client );
+static int64_t                      __dispatch__length( vgx_VGXServer_t *server );
+static void                         __dispatch__drain( vgx_VGXServer_t *server );
+static bool                         __dispatch__admit( vgx_VGXServerClient_t *client, vgx_VGXServerDispatchQueue_t *job );
+static bool                         __dispatch__expired( const vgx_VGXServerClient_t *client, int64_t now_ns );
+static void                         __dispatch__drop_expired( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client );
+static void                         __dispatch__observe_service_time( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client );
+
+
+#define DISPATCH_SERVICE_TIME_EMA_SHIFT 3
 
 
 
 
 /*******************************************************************//**
+ * Number of entries in executor's local queue
  *
+ ***********************************************************************
+ */
+__inline static int64_t __local_queue__depth( vgx_VGXServerExecutorLocalQueue_t *LQ ) {
+  return ATOMIC_READ_i64( &LQ->tail_atomic ) - ATOMIC_READ_i64( &LQ->head_atomic );
+}
+
+
+
+/*******************************************************************//**
+ * Append client to executor's local queue. Server thread only.
  *
+ * Returns false if queue is full.
  ***********************************************************************
  */
-__inline static int64_t __dispatch__length( vgx_VGXServerWorkDispatch_t *dispatch ) {
+__inline static bool __local_queue__push( vgx_VGXServerExecutorLocalQueue_t *LQ, vgx_VGXServerClient_t *client ) {
+  int64_t tail = ATOMIC_READ_i64( &LQ->tail_atomic );
+  if( tail - ATOMIC_READ_i64( &LQ->head_atomic ) >= EXECUTOR_LOCAL_QUEUE_SIZE ) {
+    return false;
+  }
+  // Slot is written before tail is published
+  ATOMIC_ASSIGN_i64( &LQ->slot[ tail & EXECUTOR_LOCAL_QUEUE_MASK ], (int64_t)(uintptr_t)client );
+  ATOMIC_ASSIGN_i64( &LQ->tail_atomic, tail + 1 );
+  return true;
+}
+
+
+
+/*******************************************************************//**
+ * Take next client from executor's local queue. Any executor may call
+ * this, the owner to consume its own queue and siblings to steal.
+ *
+ * A slot cannot be overwritten by the producer until head has moved past
+ * it, so the value read before a successful compare-and-swap of head is
+ * the value that was staged.
+ *
+ * Returns false if queue is empty.
+ ***********************************************************************
+ */
+__inline static bool __local_queue__pop( vgx_VGXServerExecutorLocalQueue_t *LQ, vgx_VGXServerClient_t **client ) {
+  int64_t head;
+  while( (head = ATOMIC_READ_i64( &LQ->head_atomic )) < ATOMIC_READ_i64( &LQ->tail_atomic ) ) {
+    int64_t addr = ATOMIC_READ_i64( &LQ->slot[ head & EXECUTOR_LOCAL_QUEUE_MASK ] );
+    if( ATOMIC_CMPXCHG_i64( &LQ->head_atomic, head, head + 1 ) ) {
+      *client = (vgx_VGXServerClient_t*)(uintptr_t)addr;
+      return true;
+    }
+  }
+  return false;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static int64_t __dispatch__length( vgx_VGXServer_t *server ) {
+  vgx_VGXServerWorkDispatch_t *dispatch = &server->dispatch;
   int64_t sz = 0;
 
   for( int i=0; i < DISPATCH_QUEUE_COUNT; ++i ) {
     vgx_VGXServerDispatchQueue_t *job = &dispatch->Q[i];
     SYNCHRONIZE_ON( job->lock ) {
-      sz += ComlibSequenceLength( job->queue );
+      sz += ComlibSequenceLength( job->queue ) + ComlibSequenceLength( job->priority_queue );
     } RELEASE;
   }
 
+  vgx_VGXServerExecutorPool_t *pool = server->pool.executors;
+  if( pool ) {
+    for( int n=0; n < pool->sz; ++n ) {
+      if( pool->executors[n] && pool->executors[n]->localQ ) {
+        sz += __local_queue__depth( pool->executors[n]->localQ );
+      }
+    }
+  }
+
   return sz;
 }
 
@@ -63,7 +138,8 @@ __inline static int64_t __dispatch__length( vgx_VGXServerWorkDispatch_t *dispatc
  *
  ***********************************************************************
  */
-__inline static void __dispatch__drain( vgx_VGXServerWorkDispatch_t *dispatch ) {
+__inline static void __dispatch__drain( vgx_VGXServer_t *server ) {
+  vgx_VGXServerWorkDispatch_t *dispatch = &server->dispatch;
   for( int i=0; i < DISPATCH_QUEUE_COUNT; ++i ) {
     vgx_VGXServerDispatchQueue_t *job = &dispatch->Q[i];
 
@@ -71,11 +147,163 @@ __inline static void __dispatch__drain( vgx_VGXServerWorkDispatch_t *dispatch )
       uintptr_t client_addr = 0;
       while( ComlibSequenceLength( job->queue ) > 0 ) {
         CALLABLE( job->queue )->NextNolock( job->queue, (QWORD*)&client_addr );
+        ATOMIC_DECREMENT_i32( &job->shared_atomic );
+        ATOMIC_DECREMENT_i32( &job->length_atomic );
+      }
+      while( ComlibSequenceLength( job->priority_queue ) > 0 ) {
+        CALLABLE( job->priority_queue )->NextNolock( job->priority_queue, (QWORD*)&client_addr );
+        ATOMIC_DECREMENT_i32( &job->shared_atomic );
         ATOMIC_DECREMENT_i32( &job->length_atomic );
       }
     } RELEASE;
   }
 
+  vgx_VGXServerExecutorPool_t *pool = server->pool.executors;
+  if( pool ) {
+    for( int n=0; n < pool->sz; ++n ) {
+      vgx_VGXServerExecutor_t *executor = pool->executors[n];
+      if( executor && executor->localQ ) {
+        vgx_VGXServerClient_t *client;
+        while( __local_queue__pop( executor->localQ, &client ) ) {
+          ATOMIC_DECREMENT_i32( &executor->jobQ->length_atomic );
+        }
+      }
+    }
+  }
+
+}
+
+
+
+/*******************************************************************//**
+ * Decide if a new request can be admitted to dispatch queue
+ *
+ * Completion time is estimated from the number of requests already queued
+ * ahead of this request, the number of executors serving the queue and the
+ * observed service time. Requests that would miss their deadline are
+ * rejected immediately instead of timing out at the client after
+ * occupying an executor.
+ ***********************************************************************
+ */
+static bool __dispatch__admit( vgx_VGXServerClient_t *client, vgx_VGXServerDispatchQueue_t *job ) {
+  vgx_HTTPHeaders_t *headers = client->request.headers;
+  int priority = headers->control.priority;
+
+  // High priority is never shed
+  if( priority == VGX_SERVER_REQUEST_PRIORITY__HIGH ) {
+    return true;
+  }
+
+  int64_t n_exec = job->n_executors > 0 ? job->n_executors : 1;
+  int64_t backlog = ATOMIC_READ_i32( &job->length_atomic );
+  int64_t idle = ATOMIC_READ_i32( &job->n_waiting_atomic );
+
+  // Low priority only runs on spare capacity
+  if( priority == VGX_SERVER_REQUEST_PRIORITY__LOW && idle == 0 && backlog >= n_exec ) {
+    return false;
+  }
+
+  // No deadline
+  if( headers->deadline_ms == 0 ) {
+    return true;
+  }
+
+  // No observations yet
+  int64_t service_ns = ATOMIC_READ_i64( &job->service_ns_atomic );
+  if( service_ns == 0 ) {
+    return true;
+  }
+
+  // Waves of queued requests to complete before this one can start
+  int64_t waves = backlog < idle ? 0 : (backlog + n_exec - idle) / n_exec;
+  int64_t estimate_ns = (waves + 1) * service_ns;
+  int64_t elapsed_ns = __GET_CURRENT_NANOSECOND_TICK() - client->io_t0_ns;
+
+  return elapsed_ns + estimate_ns <= headers->deadline_ms * 1000000LL;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+__inline static bool __dispatch__expired( const vgx_VGXServerClient_t *client, int64_t now_ns ) {
+  int deadline_ms = client->request.headers->deadline_ms;
+  if( deadline_ms == 0 ) {
+    return false;
+  }
+  // Only new requests are dropped, work already performed for the client is not discarded
+  vgx_VGXServerClientState state = client->request.state;
+  if( state != VGXSERVER_CLIENT_STATE__EXECUTE && state != VGXSERVER_CLIENT_STATE__PREPROCESS ) {
+    return false;
+  }
+  return now_ns - client->io_t0_ns > deadline_ms * 1000000LL;
+}
+
+
+
+/*******************************************************************//**
+ * Complete client with an error response without executing the request
+ *
+ ***********************************************************************
+ */
+static void __dispatch__drop_expired( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client ) {
+  static const char msg[] = "Request deadline expired";
+  vgx_VGXServerResponse_t *response = &client->response;
+
+  ATOMIC_INCREMENT_i64( &server->dispatch.n_expired_atomic );
+
+  response->info.error.expired = true;
+  response->info.execution.complete = true;
+  response->info.http_errcode = HTTP_STATUS__ServiceUnavailable;
+
+  CString_t *CSTR__error = CStringNew( msg );
+  if( vgx_server_response__prepare_body_error( response, CSTR__error ) < 0 ) {
+    response->info.error.mem_err = true;
+  }
+  else if( response->mediatype == MEDIA_TYPE__application_json ) {
+    response->info.execution.nometas = 0;
+    vgx_server_response__complete_body( server, client );
+  }
+  iString.Discard( &CSTR__error );
+
+  if( vgx_server_dispatch__return( server, client ) < 1 ) {
+    CRITICAL( 0x001, "Failed to return expired request" );
+  }
+}
+
+
+
+/*******************************************************************//**
+ * Update moving average of service time for the executor's queue
+ *
+ ***********************************************************************
+ */
+static void __dispatch__observe_service_time( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client ) {
+  if( client->response.info.error.expired || client->request.exec_t0_ns == 0 ) {
+    return;
+  }
+  vgx_VGXServerExecutorPool_t *pool = server->pool.executors;
+  int executor_id = client->request.executor_id;
+  if( pool == NULL || executor_id < 0 || executor_id >= pool->sz ) {
+    return;
+  }
+  vgx_VGXServerExecutor_t *executor = pool->executors[ executor_id ];
+  if( executor == NULL ) {
+    return;
+  }
+  vgx_VGXServerDispatchQueue_t *job = executor->jobQ;
+  int64_t service_ns = __GET_CURRENT_NANOSECOND_TICK() - client->request.exec_t0_ns;
+  int64_t avg_ns = ATOMIC_READ_i64( &job->service_ns_atomic );
+  if( avg_ns == 0 ) {
+    avg_ns = service_ns;
+  }
+  else {
+    avg_ns += (service_ns - avg_ns) >> DISPATCH_SERVICE_TIME_EMA_SHIFT;
+  }
+  ATOMIC_ASSIGN_i64( &job->service_ns_atomic, avg_ns > 0 ? avg_ns : 1 );
 }
 
 
@@ -119,7 +347,7 @@ DLL_HIDDEN void vgx_server_dispatch__dispose_and_disconnect_TCS( comlib_task_t *
       // All executors seem to have disappeared
       if( presumed_dead == server->pool.executors->sz ) {
         // Dispose of all pipelines
-        __dispatch__drain( &server->dispatch );
+        __dispatch__drain( server );
         // Disconnect all clients
         vgx_server_client__close_all( server );
       }
@@ -140,7 +368,7 @@ DLL_HIDDEN float vgx_server_dispatch__drain_pct( comlib_task_t *self ) {
 
   vgx_VGXServer_t *server = COMLIB_TASK__GetData( self );
 
-  int64_t n = __dispatch__length( &server->dispatch );
+  int64_t n = __dispatch__length( server );
 
   float pct;
 
@@ -323,14 +551,40 @@ DLL_HIDDEN int vgx_server_dispatch__create( vgx_VGXServer_t *server, CString_t *
       // [Q3.1] Last collect timestamp
       job->ts_last_collect = 0;
 
-      // [Q3.2.2]
-      job->__rsv_3_2_2 = 0;
+      // [Q3.2.2] Executors serving this queue
+      // [Q3.5.1] Executors serving the same queue are contiguous in pool
+      job->n_executors = 0;
+      job->executor_base = 0;
+      vgx_VGXServerExecutorPool_t *pool = server->pool.executors;
+      if( pool ) {
+        for( int n=0; n < pool->sz; ++n ) {
+          if( pool->executors[n] && pool->executors[n]->jobQ == job ) {
+            if( job->n_executors++ == 0 ) {
+              job->executor_base = n;
+            }
+          }
+        }
+      }
+
+      // [Q3.3] No service time observed yet
+      job->service_ns_atomic = 0;
+
+      // [Q3.4]
+      // Priority Queue
+      if( (job->priority_queue = CQwordQueueNew( 16 )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x003 );
+      }
+
+      // [Q3.5.2]
+      job->executor_cursor = 0;
 
-      // [Q3.3-8]
-      job->__rsv_3_3 = 0;
-      job->__rsv_3_4 = 0;
-      job->__rsv_3_5 = 0;
-      job->__rsv_3_6 = 0;
+      // [Q3.6.1]
+      job->shared_atomic = 0;
+
+      // [Q3.6.2]
+      job->n_parked_atomic = 0;
+
+      // [Q3.7-8]
       job->__rsv_3_7 = 0;
       job->__rsv_3_8 = 0;
     }
@@ -341,9 +595,13 @@ DLL_HIDDEN int vgx_server_dispatch__create( vgx_VGXServer_t *server, CString_t *
     // [Q15.2.1]
     dispatch->n_current = 0;
 
-    // [Q15.3-8]
-    dispatch->__rsv_15_3 = 0;
-    dispatch->__rsv_15_4 = 0;
+    // [Q15.3]
+    dispatch->n_rejected = 0;
+
+    // [Q15.4]
+    dispatch->n_expired_atomic = 0;
+
+    // [Q15.5-8]
     dispatch->__rsv_15_5 = 0;
     dispatch->__rsv_15_6 = 0;
     dispatch->__rsv_15_7 = 0;
@@ -485,6 +743,12 @@ DLL_HIDDEN void vgx_server_dispatch__destroy( vgx_VGXServer_t *server ) {
         job->queue = NULL;
       }
 
+      // [Q3.4]
+      if( job->priority_queue ) {
+        COMLIB_OBJECT_DESTROY( job->priority_queue );
+        job->priority_queue = NULL;
+      }
+
       // [Q2.1/2/3/4/5/6]
       if( job->flag.init.d_cond ) {
         DEL_CONDITION_VARIABLE( &job->wake.cond );
@@ -538,6 +802,9 @@ static int __stage_executor_handle_request( vgx_VGXServer_t *server, vgx_VGXServ
     CLIENT_STATE__UPDATE( client, VGXSERVER_CLIENT_STATE__EXECUTE );
   }
 
+  // Apply plugin's default deadline and priority where request headers did not specify
+  vgx_server_resource__apply_plugin_admission( server, &client->request );
+
   // Time of dispatch of a new request into executor
   int64_t tx_ns = __GET_CURRENT_NANOSECOND_TICK();
   // Measure elapse time, executor thread will add to this
@@ -629,33 +896,90 @@ static int __stage_executor_dispatch_complete( vgx_VGXServer_t *server, vgx_VGXS
 
 
 
+/*******************************************************************//**
+ * Select executor whose local queue will receive client
+ *
+ * A keep-alive connection returns to the executor that served its
+ * previous request as long as that executor is not backed up. Otherwise
+ * the executor with the shortest local queue is selected, scanning from
+ * a rotating start position.
+ ***********************************************************************
+ */
+static vgx_VGXServerExecutor_t * __stage_executor_select( vgx_VGXServer_t *server, vgx_VGXServerDispatchQueue_t *job, const vgx_VGXServerClient_t *client ) {
+  int n = job->n_executors;
+  if( n < 1 || server->pool.executors == NULL ) {
+    return NULL;
+  }
+
+  vgx_VGXServerExecutor_t **executors = server->pool.executors->executors + job->executor_base;
+
+  // Connection affinity
+  int affine = client->executor_affinity - job->executor_base;
+  if( affine >= 0 && affine < n ) {
+    vgx_VGXServerExecutor_t *executor = executors[ affine ];
+    if( __local_queue__depth( executor->localQ ) < EXECUTOR_AFFINITY_MAX_DEPTH ) {
+      executor->n_affine++;
+      return executor;
+    }
+  }
+
+  // Shortest local queue
+  vgx_VGXServerExecutor_t *selected = NULL;
+  int64_t min_depth = LLONG_MAX;
+  int cursor = job->executor_cursor;
+  for( int i=0; i<n; ++i ) {
+    vgx_VGXServerExecutor_t *executor = executors[ (cursor + i) % n ];
+    int64_t depth = __local_queue__depth( executor->localQ );
+    if( depth < min_depth ) {
+      selected = executor;
+      if( (min_depth = depth) == 0 ) {
+        break;
+      }
+    }
+  }
+  job->executor_cursor = (cursor + 1) % n;
+
+  return selected;
+}
+
+
+
 /*******************************************************************//**
  *
  *
  ***********************************************************************
  */
-static int __stage_executor_queue( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client, int queue_index ) {
+static int __stage_executor_queue( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client, int queue_index, bool admission ) {
 
   // Select optimal queue: waterfall
   bool signal_sent = false;
   int staged = 0;
   vgx_VGXServerDispatchQueue_t *job = NULL;
+  vgx_VGXServerExecutor_t *target = NULL;
   while( queue_index < DISPATCH_QUEUE_COUNT ) {
     job = &server->dispatch.Q[queue_index++];
     // Use this queue since enough available workers are waiting to process entire queue, or it's the last queue
     if( ATOMIC_READ_i32( &job->length_atomic ) < ATOMIC_READ_i32( &job->n_waiting_atomic ) || queue_index == DISPATCH_QUEUE_COUNT ) {
-      SYNCHRONIZE_ON( job->lock ) {
-        uintptr_t client_addr = (uintptr_t)client;
-        staged = CALLABLE( job->queue )->AppendNolock( job->queue, (QWORD*)&client_addr );
-        ATOMIC_INCREMENT_i32( &job->length_atomic );
-        // Workers are waiting on job queue, wake up one of them
-        if( ATOMIC_READ_i32( &job->n_waiting_atomic ) > 0 ) {
-          SIGNAL_ONE_CONDITION( &(job->wake.cond) );
-          signal_sent = true;
+      // New request cannot be completed in time, reject before it consumes any executor time
+      if( admission && !__dispatch__admit( client, job ) ) {
+        return 0;
+      }
+      // Normal requests go to an executor's local queue without locking
+      if( client->request.headers->control.priority != VGX_SERVER_REQUEST_PRIORITY__HIGH ) {
+        if( (target = __stage_executor_select( server, job, client )) != NULL && __local_queue__push( target->localQ, client ) ) {
+          ATOMIC_INCREMENT_i32( &job->length_atomic );
+          staged = 1;
         }
-      } RELEASE;
-      if( signal_sent ) {
-        return staged;
+      }
+      // High priority requests and local queue overflow go to the shared queues
+      if( staged == 0 ) {
+        CQwordQueue_t *Q = client->request.headers->control.priority == VGX_SERVER_REQUEST_PRIORITY__HIGH ? job->priority_queue : job->queue;
+        SYNCHRONIZE_ON( job->lock ) {
+          uintptr_t client_addr = (uintptr_t)client;
+          staged = CALLABLE( Q )->AppendNolock( Q, (QWORD*)&client_addr );
+          ATOMIC_INCREMENT_i32( &job->shared_atomic );
+          ATOMIC_INCREMENT_i32( &job->length_atomic );
+        } RELEASE;
       }
       break;
     }
@@ -665,12 +989,28 @@ static int __stage_executor_queue( vgx_VGXServer_t *server, vgx_VGXServerClient_
     return -1;
   }
 
-  // No workers are waiting on job queue, either all are busy or sleeping. Wake up one sleeping worker.
+  // Executors are parked on job queue, wake up one of them. Any parked
+  // executor will do since it can steal from the target's local queue.
+  if( ATOMIC_READ_i32( &job->n_parked_atomic ) > 0 ) {
+    SYNCHRONIZE_ON( job->lock ) {
+      SIGNAL_ONE_CONDITION( &(job->wake.cond) );
+    } RELEASE;
+    return staged;
+  }
+
+  // Executors are polling for work and will find the client before they stop polling
+  if( ATOMIC_READ_i32( &job->n_waiting_atomic ) > 0 ) {
+    return staged;
+  }
+
+  // No workers are waiting on job queue, either all are busy or sleeping. Wake up one sleeping worker,
+  // starting with the executor that received the client.
   vgx_VGXServerExecutorPool_t *pool = server->pool.executors;
   vgx_VGXServerExecutor_t **executors = pool->executors;
-  vgx_VGXServerExecutor_t **end = executors + pool->sz;
-  while( !signal_sent && executors < end ) {
-    vgx_VGXServerExecutor_t *executor = *executors++;
+  int n = pool->sz;
+  int first = target ? target->id : 0;
+  for( int i=0; i<n && !signal_sent; ++i ) {
+    vgx_VGXServerExecutor_t *executor = executors[ (first + i) % n ];
     // Not interested in this executor since we didn't dispatch to its queue
     if( executor->jobQ != job ) {
       continue;
@@ -701,10 +1041,12 @@ DLL_HIDDEN int vgx_server_dispatch__stage_executor( vgx_VGXServer_t *server, vgx
   int err = 0;
 
   int jobq_i = 0;
+  bool admission = false;
 
   // New request
   if( client->request.state == VGXSERVER_CLIENT_STATE__HANDLE_REQUEST ) {
     jobq_i = __stage_executor_handle_request( server, client );
+    admission = true;
   }
   // Process response(s) from matrix backend(s)
   else if( client->request.state == VGXSERVER_CLIENT_STATE__DISPATCH_COMPLETE ) {
@@ -727,7 +1069,11 @@ DLL_HIDDEN int vgx_server_dispatch__stage_executor( vgx_VGXServer_t *server, vgx
   }
 
   // Send client to optimal executor queue
-  if( __stage_executor_queue( server, client, jobq_i ) < 1 ) {
+  int staged = __stage_executor_queue( server, client, jobq_i, admission );
+  if( staged == 0 && admission ) {
+    goto reject;
+  }
+  if( staged < 1 ) {
     goto error;
   }
 
@@ -747,6 +1093,13 @@ error:
 
   return vgx_server_response__produce_error( server, client, HTTP_STATUS__InternalServerError, "Internal error in request handler", true );
 
+reject:
+  // Load shedding, not an internal error
+  dispatch->n_rejected++;
+  CLIENT_STATE__SET_ERROR( client );
+  vgx_server_client__append_front( server, client );
+  return vgx_server_response__produce_error( server, client, HTTP_STATUS__ServiceUnavailable, "Request deadline cannot be met", false );
+
 }
 
 
@@ -803,49 +1156,132 @@ DLL_HIDDEN int vgx_server_dispatch__dispatch( vgx_VGXServer_t *server, vgx_VGXSe
  *
  ***********************************************************************
  */
-__inline static void __await_dispatch_DQCS( vgx_VGXServerExecutor_t *executor, int64_t *t_slept_ns ) {
-  vgx_VGXServerDispatchQueue_t *jobQ = executor->jobQ;
-  *t_slept_ns = 0;
-  // Wait unless many others are already waiting
-  if( ATOMIC_READ_i32( &jobQ->n_waiting_atomic ) < EXECUTOR_DISPATCH_QUEUE_MAX_WAITING ) {
-    // Sleep and wait for signal
-    ATOMIC_INCREMENT_i32( &jobQ->n_waiting_atomic );
-    *t_slept_ns = TIMED_WAIT_CONDITION_CS( &jobQ->wake.cond, &jobQ->lock.lock, 25 + executor->max_sleep );
-    ATOMIC_DECREMENT_i32( &jobQ->n_waiting_atomic );
+__inline static vgx_VGXServerClient_t * __client_from_address( vgx_VGXServerExecutor_t *executor, vgx_VGXServerClient_t *client ) {
+  if( client == NULL ) {
+    return NULL;
   }
+
+  // Executor thread is acceptable for this request
+  client->request.executor_id = executor->id;
+  // Next request on this connection prefers the same executor
+  client->executor_affinity = executor->id;
+  ATOMIC_INCREMENT_i64( &executor->count_atomic );
+  return client;
 }
 
 
 
 /*******************************************************************//**
+ * Take next client from the shared queues (high priority clients first)
  *
+ ***********************************************************************
+ */
+__inline static bool __fetch_shared_DQCS( vgx_VGXServerDispatchQueue_t *jobQ, vgx_VGXServerClient_t **client ) {
+  CQwordQueue_t *src = ComlibSequenceLength( jobQ->priority_queue ) > 0 ? jobQ->priority_queue : jobQ->queue;
+  uintptr_t client_addr = 0;
+  if( CALLABLE( src )->NextNolock( src, (QWORD*)&client_addr ) != 1 ) {
+    return false;
+  }
+  ATOMIC_DECREMENT_i32( &jobQ->shared_atomic );
+  *client = (vgx_VGXServerClient_t*)client_addr;
+  return true;
+}
+
+
+
+/*******************************************************************//**
+ * Find work for executor
  *
+ * Order: shared queues, own local queue, then local queues of sibling
+ * executors serving the same dispatch queue.
  *
+ * Returns true if an entry was taken (client may be NULL for no-op.)
  ***********************************************************************
  */
-__inline static vgx_VGXServerClient_t * __client_from_address_DQCS( vgx_VGXServerExecutor_t *executor, QWORD addr ) {
-  vgx_VGXServerClient_t *client = (vgx_VGXServerClient_t*)addr;
-  if( client == NULL ) {
-    return NULL;
+static bool __fetch_any( vgx_VGXServer_t *server, vgx_VGXServerExecutor_t *executor, bool DQCS, vgx_VGXServerClient_t **client ) {
+  vgx_VGXServerDispatchQueue_t *jobQ = executor->jobQ;
+  bool found = false;
+
+  // Shared queues
+  if( ATOMIC_READ_i32( &jobQ->shared_atomic ) > 0 ) {
+    if( DQCS ) {
+      found = __fetch_shared_DQCS( jobQ, client );
+    }
+    else {
+      SYNCHRONIZE_ON( jobQ->lock ) {
+        found = __fetch_shared_DQCS( jobQ, client );
+      } RELEASE;
+    }
   }
 
-  // Executor thread is acceptable for this request
-  client->request.executor_id = executor->id;
-  ATOMIC_INCREMENT_i64( &executor->count_atomic );
-  return client;
+  // Own local queue
+  if( !found ) {
+    found = __local_queue__pop( executor->localQ, client );
+  }
+
+  // Steal from siblings
+  if( !found && jobQ->n_executors > 1 ) {
+    vgx_VGXServerExecutor_t **siblings = server->pool.executors->executors + jobQ->executor_base;
+    int n = jobQ->n_executors;
+    int self = executor->id - jobQ->executor_base;
+    for( int i=1; i<n && !found; ++i ) {
+      vgx_VGXServerExecutor_t *victim = siblings[ (self + i) % n ];
+      if( __local_queue__pop( victim->localQ, client ) ) {
+        ATOMIC_INCREMENT_i64( &executor->n_stolen_atomic );
+        found = true;
+      }
+    }
+  }
+
+  if( found ) {
+    ATOMIC_DECREMENT_i32( &jobQ->length_atomic );
+  }
+
+  return found;
 }
 
 
 
 /*******************************************************************//**
+ * Park executor on job queue condition until signal or timeout
  *
+ * Parked count is raised before the final check so that a client staged
+ * concurrently either is seen here or causes a signal under the lock.
+ ***********************************************************************
+ */
+__inline static bool __await_dispatch_DQCS( vgx_VGXServer_t *server, vgx_VGXServerExecutor_t *executor, int64_t *t_slept_ns, vgx_VGXServerClient_t **client ) {
+  vgx_VGXServerDispatchQueue_t *jobQ = executor->jobQ;
+  bool found = false;
+  // Wait unless many others are already waiting
+  if( ATOMIC_READ_i32( &jobQ->n_parked_atomic ) < EXECUTOR_DISPATCH_QUEUE_MAX_WAITING ) {
+    ATOMIC_INCREMENT_i32( &jobQ->n_parked_atomic );
+    if( (found = __fetch_any( server, executor, true, client )) == false ) {
+      // Sleep and wait for signal
+      *t_slept_ns = TIMED_WAIT_CONDITION_CS( &jobQ->wake.cond, &jobQ->lock.lock, 25 + executor->max_sleep );
+    }
+    ATOMIC_DECREMENT_i32( &jobQ->n_parked_atomic );
+  }
+  return found;
+}
+
+
+
+/*******************************************************************//**
+ * Get next client for executor
  *
+ * An idle executor polls for work for a short while before it parks.
+ * While polling or parked it is counted as waiting, which lets the
+ * server thread stage work without signaling. The waiting count is
+ * released before the final check so work staged by a server thread
+ * that saw this executor as waiting is never left behind.
  *
  ***********************************************************************
  */
 DLL_HIDDEN vgx_VGXServerClient_t * vgx_server_dispatch__fetch( vgx_VGXServer_t *server, vgx_VGXServerExecutor_t *executor, int *n_waiting, int64_t *t_slept_ns )  {
   vgx_VGXServerWorkDispatch_t *dispatch = &server->dispatch;
 
+  *t_slept_ns = 0;
+
   // Dispatch not ready
   if( !dispatch->ready ) {
     sleep_milliseconds(1);
@@ -853,33 +1289,56 @@ DLL_HIDDEN vgx_VGXServerClient_t * vgx_server_dispatch__fetch( vgx_VGXServer_t *
   }
 
   vgx_VGXServerClient_t *client = NULL;
-
   vgx_VGXServerDispatchQueue_t *jobQ = executor->jobQ;
-  CQwordQueue_t *Q = jobQ->queue;
 
-  SYNCHRONIZE_ON( jobQ->lock ) {
-    
-    // Empty queue - go to sleep until signal or timeout
-    if( ComlibSequenceLength( Q ) == 0 ) {
-      __await_dispatch_DQCS( executor, t_slept_ns );
+  // Fast path
+  bool found = __fetch_any( server, executor, false, &client );
+
+  if( !found ) {
+    ATOMIC_INCREMENT_i32( &jobQ->n_waiting_atomic );
+
+    // Poll
+    for( int i=0; i < EXECUTOR_IDLE_SPIN_ROUNDS && !found; ++i ) {
+      cpu_yield();
+      found = __fetch_any( server, executor, false, &client );
     }
 
-    // At least one client in queue
-    if( ComlibSequenceLength( Q ) > 0 ) {
-      uintptr_t client_addr = 0;
-      CALLABLE( Q )->NextNolock( Q, (QWORD*)&client_addr );
-      ATOMIC_DECREMENT_i32( &jobQ->length_atomic );
-      client = __client_from_address_DQCS( executor, client_addr );
-      // Signal if queue not empty and at least one executor needs to be woken up
-      if( ComlibSequenceLength( Q ) > 0 && ATOMIC_READ_i32( &jobQ->n_waiting_atomic ) > 0 ) {
-        SIGNAL_ONE_CONDITION( &(jobQ->wake.cond) );
-      }
+    // Park
+    if( !found ) {
+      SYNCHRONIZE_ON( jobQ->lock ) {
+        found = __await_dispatch_DQCS( server, executor, t_slept_ns, &client );
+      } RELEASE;
     }
 
-    // Inform caller of the current number executors waiting for a client to be dispatached
-    *n_waiting = ATOMIC_READ_i32( &jobQ->n_waiting_atomic );
+    ATOMIC_DECREMENT_i32( &jobQ->n_waiting_atomic );
 
-  } RELEASE;
+    // Final check
+    if( !found ) {
+      found = __fetch_any( server, executor, false, &client );
+    }
+  }
+
+  // Inform caller of the current number executors waiting for a client to be dispatached
+  *n_waiting = ATOMIC_READ_i32( &jobQ->n_waiting_atomic );
+
+  if( !found ) {
+    return NULL;
+  }
+
+  // Work remains and executors are parked, wake one up to share the load
+  if( ATOMIC_READ_i32( &jobQ->length_atomic ) > 0 && ATOMIC_READ_i32( &jobQ->n_parked_atomic ) > 0 ) {
+    SYNCHRONIZE_ON( jobQ->lock ) {
+      SIGNAL_ONE_CONDITION( &(jobQ->wake.cond) );
+    } RELEASE;
+  }
+
+  client = __client_from_address( executor, client );
+
+  // Drop new request whose deadline expired while in queue
+  if( client && __dispatch__expired( client, __GET_CURRENT_NANOSECOND_TICK() ) ) {
+    __dispatch__drop_expired( server, client );
+    return NULL;
+  }
 
   return client;
 
@@ -899,6 +1358,9 @@ DLL_HIDDEN int vgx_server_dispatch__return( vgx_VGXServer_t *server, vgx_VGXServ
   static char noop[1] = {1};
 #endif
 
+  // Feed service time estimate used for admission
+  __dispatch__observe_service_time( server, client );
+
   // Pass the completed client back to the I/O loop via the completion queue
   vgx_VGXServerExecutorCompletion_t *completion = &server->dispatch.completion;
   uintptr_t client_addr = (uintptr_t)client;
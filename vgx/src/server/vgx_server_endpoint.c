@@ -1989,7 +1989,9 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
       "dispatch": {
         "dispatched": 548,
         "completed": 547,
-        "signals": 547
+        "signals": 547,
+        "rejected": 0,
+        "expired": 0
       },
       "executor": {
         "0": 156,
@@ -2022,13 +2024,21 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
       "dispatch": {
         "dispatched": 548,
         "completed": 547,
-        "signals": 547
+        "signals": 547,
+        "rejected": 0,
+        "expired": 0
       },
       "executor": {
         "0": 156,
         "1": 157,
         "2": 129,
         "3": 106
+      },
+      "executor-queue": {
+        "0": [0, 12, 140],
+        "1": [1, 9, 151],
+        "2": [0, 17, 98],
+        "3": [0, 21, 77]
       }
     }
   }
@@ -2041,6 +2051,13 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
     bsz += 128 * n_hosts; // plenty
   }
   iVGXServer.Config.Delete( &main_cf );
+  // Executor and executor queue entries
+  vgx_VGXServer_t *pools[] = { serverA, serverB };
+  for( int p=0; p<2; p++ ) {
+    if( pools[p] && pools[p]->pool.executors ) {
+      bsz += 128 * pools[p]->pool.executors->sz;
+    }
+  }
 
   try_json_dynamic( response, bsz, '{' ) {
 
@@ -2053,6 +2070,7 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
 
       int64_t *executor_count = NULL;
       double *executor_busy = NULL;
+      int64_t (*executor_queue)[3] = NULL;
       int sz_wpool = 0;
 
       vgx_VGXServerWorkDispatch_t *dispatch = &s->dispatch;
@@ -2063,11 +2081,14 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
         sz_wpool = pool->sz;
         executor_count = calloc( sz_wpool, sizeof(int64_t) );
         executor_busy = calloc( sz_wpool, sizeof(double) );
+        executor_queue = calloc( sz_wpool, sizeof(*executor_queue) );
       }
       // 
       vgx_VGXServerConfig_t *cf = iVGXServer.Config.Clone( s );
 
       n_dispatched = dispatch->n_total; // unlocked, updated by server loop
+      int64_t n_rejected = dispatch->n_rejected; // unlocked, updated by server loop
+      int64_t n_expired = ATOMIC_READ_i64( &dispatch->n_expired_atomic );
 
       if( executor_count ) {
         vgx_VGXServerExecutor_t **pexecutor = pool->executors;
@@ -2077,17 +2098,29 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
             continue;
           }
           executor_count[i] = ATOMIC_READ_i64( &exec->count_atomic );
+          if( executor_queue ) {
+            vgx_VGXServerExecutorLocalQueue_t *LQ = exec->localQ;
+            executor_queue[i][0] = LQ ? ATOMIC_READ_i64( &LQ->tail_atomic ) - ATOMIC_READ_i64( &LQ->head_atomic ) : 0;
+            executor_queue[i][1] = ATOMIC_READ_i64( &exec->n_stolen_atomic );
+            executor_queue[i][2] = exec->n_affine; // unlocked, updated by server loop
+          }
         }
       }
 
       int64_t nopen_channels = 0;
       int64_t nmax_channels = 0;
+      int64_t n_connects = 0;
+      int64_t n_drained = 0;
+      int64_t n_drain_closed = 0;
       if( cf && cf->dispatcher && DISPATCHER_MATRIX_ENABLED( s ) ) {
         vgx_VGXServerDispatcherMatrix_t *matrix = &s->matrix;
         SYNCHRONIZE_ON( matrix->lock ) {
           nopen_channels = matrix->partition.nopen_channels_MCS;
           nmax_channels = matrix->partition.nmax_channels_MCS;
+          n_connects = matrix->n_connects_MCS;
         } RELEASE;
+        n_drained = matrix->n_drained; // unlocked, updated by server loop
+        n_drain_closed = matrix->n_drain_closed; // unlocked, updated by server loop
       }
 
       int64_t n_completed;
@@ -2120,6 +2153,8 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
         first_key_int( "dispatched", n_dispatched );
         next_key_int( "completed", n_completed );
         next_key_int( "signals", n_signals );
+        next_key_int( "rejected", n_rejected );
+        next_key_int( "expired", n_expired );
       } end_key_dict;
       begin_next_key_dict( "executor" ) {
         if( executor_count && executor_busy ) {
@@ -2141,12 +2176,37 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
           }
         }
       } end_key_dict;
+      begin_next_key_dict( "executor-queue" ) {
+        if( executor_queue ) {
+          for( int i=0; i<sz_wpool; i++ ) {
+            // "n": [
+            if( i == 0 ) {
+              out_txt( "\"" );
+            }
+            else {
+              out_txt( ", \"" );
+            }
+            out_int( i );
+            out_txt( "\": [" );
+            // depth, stolen, affine]
+            out_int( executor_queue[i][0] );
+            out_txt( ", " );
+            out_int( executor_queue[i][1] );
+            out_txt( ", " );
+            out_int( executor_queue[i][2] );
+            out_txt( "]" );
+          }
+        }
+      } end_key_dict;
       if( cf && cf->dispatcher ) {
         begin_next_key_dict( "matrix" ) {
           first_key_int( "width", cf->dispatcher->shape.width );
           next_key_int( "height", cf->dispatcher->shape.height );
           next_key_int( "active-channels", nopen_channels );
           next_key_int( "total-channels", nmax_channels );
+          next_key_int( "connects", n_connects );
+          next_key_int( "drained", n_drained );
+          next_key_int( "drain-closed", n_drain_closed );
           next_key_bol( "allow-incomplete", cf->dispatcher->allow_incomplete );
           next_key_bol( "proxy", cf->dispatcher->shape.width == 1 );
           begin_next_key_array( "partitions" ) {
@@ -2191,6 +2251,7 @@ static int __endpoint__service_dispatch( vgx_VGXServer_t *server, vgx_URIQueryPa
       ++(*ident);
       free( executor_count );
       free( executor_busy );
+      free( executor_queue );
       iVGXServer.Config.Delete( &cf );
     }
 
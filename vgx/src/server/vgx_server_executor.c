@@ -661,6 +661,18 @@ static vgx_VGXServerExecutor_t * __executor__new( vgx_VGXServer_t *server, int e
     // [Q1.8]
     executor->count_atomic = 0;
 
+    // [Q2.1]
+    if( CALIGNED_MALLOC( executor->localQ, vgx_VGXServerExecutorLocalQueue_t ) == NULL ) {
+      THROW_ERROR( CXLIB_ERR_MEMORY, 0x002 );
+    }
+    memset( executor->localQ, 0, sizeof( vgx_VGXServerExecutorLocalQueue_t ) );
+
+    // [Q2.2]
+    executor->n_stolen_atomic = 0;
+
+    // [Q2.3]
+    executor->n_affine = 0;
+
   }
   XCATCH( errcode ) {
     __executor__destroy( server, &executor );
@@ -748,6 +760,7 @@ static void __executor__signal_shutdown( vgx_VGXServer_t *server, vgx_VGXServerE
                   QWORD zero = 0;
                   for( int i=0; i<100; i++ ) {
                     CALLABLE( job->queue )->AppendNolock( job->queue, &zero );
+                    ATOMIC_INCREMENT_i32( &job->shared_atomic );
                   }
                   SIGNAL_ALL_CONDITION( &(job->wake.cond) );
                 } RELEASE;
@@ -807,6 +820,9 @@ static int __executor__destroy( vgx_VGXServer_t *server, vgx_VGXServerExecutor_t
     // Executor is stoppped, clean up
     if( stopped == 1 ) {
       COMLIB_TASK__Delete( &EXEC->TASK );
+      if( EXEC->localQ ) {
+        ALIGNED_FREE( EXEC->localQ );
+      }
       free( *executor );
       *executor = NULL;
     }
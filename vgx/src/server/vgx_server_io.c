@@ -47,9 +47,8 @@ static void     __io__handle_yielded_dispatcher_channels( vgx_VGXServer_t *serve
 static void     __io__not_accepted( vgx_VGXServer_t *server, vgx_URI_t *ClientURI, HTTPStatus status );
 static int      __io__try_accept( vgx_VGXServer_t *server );
 static int      __io__recv( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client );
-static int64_t  __io__send_segment( CXSOCKET *psock, vgx_StreamBuffer_t *outbuf, int64_t send_limit );
+static int64_t  __io__send_gather( CXSOCKET *psock, vgx_StreamBuffer_t *head, vgx_StreamBuffer_t *body, int64_t send_limit );
 static int64_t  __io__get_input_buffer( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client, vgx_StreamBuffer_t **buffer );
-static int      __io__get_output_buffer( vgx_VGXServerClient_t *client, vgx_StreamBuffer_t **buffer );
 static int      __io__transition_request_state( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client );
 
 
@@ -273,6 +272,12 @@ static struct pollfd * __io__pollinit_dispatcher( vgx_VGXServer_t *server, struc
     // Next client in matrix
     dispatcher_io_client = dispatcher_io_client->chain.next;
   }
+  // Channels draining responses to aborted requests
+  vgx_VGXServerDispatcherChannel_t *channel = server->matrix.draining.head;
+  while( channel ) {
+    cxpollfd_pollinit( pollable++, &channel->socket, true, false );
+    channel = channel->chain.next;
+  }
   return pollable;
 }
 
@@ -306,6 +311,18 @@ static int __io__ready_dispatcher( vgx_VGXServer_t *server, struct pollfd *polle
     // Next client in matrix
     dispatcher_io_client = dispatcher_io_client->chain.next;
   }
+  // Channels draining responses to aborted requests
+  vgx_VGXServerDispatcherChannel_t *channel = server->matrix.draining.head;
+  while( channel && n_disp < n_max ) {
+    if( cxpollfd_any_valid( polled ) ) {
+      ready_dispatcher->channel = channel;
+      ready_dispatcher->pfd = polled;
+      ++ready_dispatcher;
+      ++n_disp;
+    }
+    ++polled;
+    channel = channel->chain.next;
+  }
   // Terminate dispatcher ready list
   ready_dispatcher->channel = NULL;
   // Return number of ready file descriptors in dispatcher
@@ -788,8 +805,15 @@ DLL_HIDDEN void vgx_server_io__process_socket_events( vgx_VGXServer_t *server, i
 
       }
 
+      int64_t now_ns = __GET_CURRENT_NANOSECOND_TICK();
+
+      // Close drained channels whose responses never complete
+      if( server->matrix.draining.head ) {
+        vgx_server_dispatcher_matrix__expire_drained( &server->matrix, now_ns );
+      }
+
       // Continue IO until exit condition met
-      if( __GET_CURRENT_NANOSECOND_TICK() > deadline_ns || server->control.flag_TCS.snapshot_request /* <- NOTE: we're not TCS */ ) {
+      if( now_ns > deadline_ns || server->control.flag_TCS.snapshot_request /* <- NOTE: we're not TCS */ ) {
         __io__set_blocked( &server->dispatch.completion );
         return;
       }
@@ -819,8 +843,15 @@ DLL_HIDDEN void vgx_server_io__process_socket_events( vgx_VGXServer_t *server, i
 
       }
 
+      int64_t now_ns = __GET_CURRENT_NANOSECOND_TICK();
+
+      // Close drained channels whose responses never complete
+      if( server->matrix.draining.head ) {
+        vgx_server_dispatcher_matrix__expire_drained( &server->matrix, now_ns );
+      }
+
       // Continue IO until exit condition met
-      if( __GET_CURRENT_NANOSECOND_TICK() > deadline_ns || server->control.flag_TCS.snapshot_request /* <- NOTE: we're not TCS */ ) {
+      if( now_ns > deadline_ns || server->control.flag_TCS.snapshot_request /* <- NOTE: we're not TCS */ ) {
         __io__set_blocked( &server->dispatch.completion );
         return;
       }
@@ -986,34 +1017,51 @@ socket_exception:
 
 
 /*******************************************************************//**
+ * Send readable data in head followed by readable data in body using a
+ * single gather write. Nothing is copied in userspace.
  *
- *
+ * Returns number of bytes sent, 0 if socket not writable, -1 on error.
  ***********************************************************************
  */
-__inline static int64_t __io__send_segment( CXSOCKET *psock, vgx_StreamBuffer_t *outbuf, int64_t send_limit ) {
-  // Get a linear buffer segment to send
-  const char *segment;
-  int64_t sz_segment;
+__inline static int64_t __io__send_gather( CXSOCKET *psock, vgx_StreamBuffer_t *head, vgx_StreamBuffer_t *body, int64_t send_limit ) {
+  cxiovec_t iov[4];
+  int64_t sz_head = 0;
   int64_t n_sent;
 
-  // Get linear segment
-  if( (sz_segment = iStreamBuffer.ReadableSegment( outbuf, send_limit, &segment, NULL )) == 0 ) {
+  // Head segments (status line and headers, or nothing once sent)
+  int n_iov = iStreamBuffer.ReadableSegments( head, send_limit, iov );
+  for( int i=0; i<n_iov; i++ ) {
+    sz_head += iov[i].len;
+  }
+
+  // Body segments
+  n_iov += iStreamBuffer.ReadableSegments( body, send_limit - sz_head, iov + n_iov );
+  if( n_iov == 0 ) {
     return 0;
   }
 
-  // Send linear segment to socket
-  if( (n_sent = cxsend( psock, segment, sz_segment, 0 )) <= 0 ) {
+  // Send all segments to socket
+  if( (n_sent = cxsendv( psock, iov, n_iov, 0 )) <= 0 ) {
     // Error not caused by socket temporarily unwritable
     if( n_sent < 0 && !iURI.Sock.Busy( errno ) ) {
       return -1;
     }
     return 0;
   }
-    
+
   // At least one byte was sent to the socket
-  iStreamBuffer.AdvanceRead( outbuf, n_sent );
-  if( iStreamBuffer.Empty( outbuf ) ) {
-    iStreamBuffer.Clear( outbuf );
+  int64_t n_head = n_sent < sz_head ? n_sent : sz_head;
+  if( n_head > 0 ) {
+    iStreamBuffer.AdvanceRead( head, n_head );
+    if( iStreamBuffer.Empty( head ) ) {
+      iStreamBuffer.Clear( head );
+    }
+  }
+  if( n_sent > n_head ) {
+    iStreamBuffer.AdvanceRead( body, n_sent - n_head );
+    if( iStreamBuffer.Empty( body ) ) {
+      iStreamBuffer.Clear( body );
+    }
   }
 
   return n_sent;
@@ -1029,9 +1077,7 @@ __inline static int64_t __io__send_segment( CXSOCKET *psock, vgx_StreamBuffer_t
 DLL_HIDDEN int vgx_server_io__front_send( vgx_VGXServer_t *server, vgx_VGXServerClient_t *client ) {
 
   CXSOCKET *psock;
-  vgx_StreamBuffer_t *outbuf = NULL;
-  int64_t n_sent1;
-  int64_t n_sent2 = 0;
+  int64_t n_sent;
 
   if( client == NULL ) {
     return -1;
@@ -1042,23 +1088,13 @@ DLL_HIDDEN int vgx_server_io__front_send( vgx_VGXServer_t *server, vgx_VGXServer
     goto error;
   }
 
-  // Get the client's output buffer to send
-  if( __io__get_output_buffer( client, &outbuf ) < 0 ) {
-    goto error;
-  }
-
-  // Send one or two linear buffer segments
-  if( (n_sent1 = __io__send_segment( psock, outbuf, SEND_CHUNK_SZ )) > 0 ) {
-    n_sent2 = __io__send_segment( psock, outbuf, SEND_CHUNK_SZ - n_sent1 );
-  }
-
-  // Check error
-  if( n_sent1 < 0 || n_sent2 < 0 ) {
+  // Send headers and body together
+  if( (n_sent = __io__send_gather( psock, client->response.buffers.stream, client->response.buffers.content, SEND_GATHER_SZ )) < 0 ) {
     goto error;
   }
 
   // Increment output counter
-  server->counters.perf->bytes_out += n_sent1 + n_sent2;
+  server->counters.perf->bytes_out += n_sent;
 
   // Check request state and transition as needed
   return __io__transition_request_state( server, client );
@@ -1165,35 +1201,6 @@ static int64_t __io__get_input_buffer( vgx_VGXServer_t *server, vgx_VGXServerCli
 
 
 
-/*******************************************************************//**
- *
- *
- ***********************************************************************
- */
-static int __io__get_output_buffer( vgx_VGXServerClient_t *client, vgx_StreamBuffer_t **buffer ) {
-  int64_t sz_stream = iStreamBuffer.Size( client->response.buffers.stream );
-  // We still need to send status and headers
-  if( sz_stream > 0 ) {
-    int64_t sz_content = iStreamBuffer.Size( client->response.buffers.content ); 
-    // Entire response will fit in one chunk. Combine to avoid two send() with another poll() in between.
-    // We may not be able to send the whole thing. In that case more sends are going to occur, but only
-    // from one buffer since body will have been emptied.
-    if( sz_content > 0 && sz_stream + sz_content <= SEND_CHUNK_SZ ) {
-      if( iStreamBuffer.Absorb( client->response.buffers.stream, client->response.buffers.content, LLONG_MAX ) < 0 ) {
-        return -1; // big server problem. No response just close.
-      }
-    }
-    *buffer = client->response.buffers.stream;
-  }
-  // We are sending response body
-  else {
-    *buffer = client->response.buffers.content;
-  }
-  return 0;
-}
-
-
-
 /*******************************************************************//**
  *
  *
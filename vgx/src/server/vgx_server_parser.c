@@ -45,6 +45,8 @@ static int8_t               __parse_header__x_vgx_partial_target( const char *da
 static int                  __parse_header__x_vgx_builtin_min_executor( vgx_VGXServer_t *server, const char *data );
 static int16_t              __parse_header__x_vgx_backlog( const char *data );
 static int                  __parse_header__x_vgx_bypass_sout( const char *data );
+static int                  __parse_header__x_vgx_deadline( const char *data );
+static int                  __parse_header__x_vgx_priority( const char *data );
 static void                 __parse_header__ignore( const char *data );
 
 
@@ -634,6 +636,73 @@ __inline static int __parse_header__x_vgx_bypass_sout( const char *data ) {
 
 
 
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+#define HEADER_XVgxDeadline "x-vgx-deadline:"
+#define sz_HEADER_XVgxDeadline (sizeof(HEADER_XVgxDeadline) - 1)
+#define IS_HEADER_XVgxDeadline( Line ) __match_lower_prefix( Line, HEADER_XVgxDeadline )
+
+/**************************************************************************//**
+ * __parse_header__x_vgx_deadline
+ *
+ * Milliseconds after request start by which a response is still useful
+ ******************************************************************************
+ */
+__inline static int __parse_header__x_vgx_deadline( const char *data ) {
+  data += sz_HEADER_XVgxDeadline;
+  __skip_spaces( data );
+  int64_t ms = 0;
+  if( (data = decimal_to_integer( data, &ms )) == NULL ) {
+    return -1;
+  }
+  __skip_line( data );
+  if( ms < 0 || ms > INT_MAX ) {
+    return -1;
+  }
+  return (int)ms;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+#define HEADER_XVgxPriority "x-vgx-priority:"
+#define sz_HEADER_XVgxPriority (sizeof(HEADER_XVgxPriority) - 1)
+#define IS_HEADER_XVgxPriority( Line ) __match_lower_prefix( Line, HEADER_XVgxPriority )
+
+/**************************************************************************//**
+ * __parse_header__x_vgx_priority
+ *
+ ******************************************************************************
+ */
+__inline static int __parse_header__x_vgx_priority( const char *data ) {
+  data += sz_HEADER_XVgxPriority;
+  __skip_spaces( data );
+  int priority;
+  if( __match_lower_prefix( data, "low" ) ) {
+    priority = VGX_SERVER_REQUEST_PRIORITY__LOW;
+  }
+  else if( __match_lower_prefix( data, "normal" ) ) {
+    priority = VGX_SERVER_REQUEST_PRIORITY__NORMAL;
+  }
+  else if( __match_lower_prefix( data, "high" ) ) {
+    priority = VGX_SERVER_REQUEST_PRIORITY__HIGH;
+  }
+  else {
+    return -1;
+  }
+  __skip_line( data );
+  return priority;
+}
+
+
+
 /*******************************************************************//**
  *
  *
@@ -682,6 +751,22 @@ DLL_HIDDEN vgx_HTTPRequestHeaderField vgx_server_parser__parse_request_header_li
       }
       return HTTP_REQUEST_HEADER_FIELD__XVgxBypassSOUT;
     }
+
+    // X-Vgx-Deadline:
+    if( IS_HEADER_XVgxDeadline( line ) ) {
+      if( (request->headers->deadline_ms = __parse_header__x_vgx_deadline( line )) < 0 ) {
+        goto bad_header;
+      }
+      return HTTP_REQUEST_HEADER_FIELD__XVgxDeadline;
+    }
+
+    // X-Vgx-Priority:
+    if( IS_HEADER_XVgxPriority( line ) ) {
+      if( (request->headers->control.priority = (int8_t)__parse_header__x_vgx_priority( line )) < 0 ) {
+        goto bad_header;
+      }
+      return HTTP_REQUEST_HEADER_FIELD__XVgxPriority;
+    }
     goto ignore_header;
 
   case 'c':
@@ -26,11 +26,57 @@
 #include "_vgx.h"
 #include "_vxserver.h"
 
+#if defined CXPLAT_WINDOWS_X64
+typedef HMODULE __native_library_t;
+#define __native_library_open( Path )           LoadLibraryA( Path )
+#define __native_library_symbol( Lib, Name )    ((void*)GetProcAddress( Lib, Name ))
+#define __native_library_error()                "cannot load library"
+#else
+#include <dlfcn.h>
+typedef void * __native_library_t;
+#define __native_library_open( Path )           dlopen( Path, RTLD_NOW | RTLD_LOCAL )
+#define __native_library_symbol( Lib, Name )    dlsym( Lib, Name )
+#define __native_library_error()                dlerror()
+#endif
+
 
 /* exception module */
 SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
 
 
+
+/*******************************************************************//**
+ * Registered native plugin
+ *
+ * Entries and their libraries are kept until the plugin registry is
+ * cleared since executors may still be running a plugin after it has
+ * been removed or replaced.
+ ***********************************************************************
+ */
+typedef struct s___native_plugin_t {
+  const vgx_NativePlugin_t *def;
+  CString_t *CSTR__library;
+  objectid_t graph_obid;
+  bool bound;
+  struct s___native_plugin_t *replaced;
+  struct s___native_plugin_t *next;
+} __native_plugin_t;
+
+
+
+static CS_LOCK g_native_lock = {0};
+static bool g_native_lock_init = false;
+static framehash_cell_t *g_native_map = NULL;
+static framehash_dynamic_t g_native_map_dyn = {0};
+static __native_plugin_t *g_native_entries = NULL;
+static int64_t g_native_count = 0;
+
+
+
+static bool               __plugin__valid_native_name( const char *name );
+static __native_plugin_t * __plugin__get_native_CS( const char *plugin_name );
+
+
 /*******************************************************************//**
  *
  *
@@ -40,3 +86,350 @@ SUPPRESS_WARNING_UNREFERENCED_FORMAL_PARAMETER
 DLL_HIDDEN int vgx_server_plugin__none( vgx_Graph_t *sysgraph, const char *plugin, vgx_URIQueryParameters_t *params, vgx_VGXServerRequest_t *request, vgx_VGXServerResponse_t *response, CString_t **CSTR__error ) {
   return -1;
 }
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static bool __plugin__valid_native_name( const char *name ) {
+  if( name == NULL || strlen( name ) > 255 || CharsStartsWithConst( name, "sysplugin__" ) ) {
+    return false;
+  }
+  const char *p = name;
+  char c = *p++;
+  if( !isalpha( c ) && c != '_' ) {
+    return false;
+  }
+  while( (c = *p++) != '\0' ) {
+    if( !isalnum( c ) && c != '_' ) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+static __native_plugin_t * __plugin__get_native_CS( const char *plugin_name ) {
+  int64_t x = 0;
+  if( g_native_map && iMapping.IntegerMapGet( g_native_map, &g_native_map_dyn, plugin_name, &x ) ) {
+    return (__native_plugin_t*)(uintptr_t)x;
+  }
+  return NULL;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN int vgx_server_plugin__native_init( void ) {
+  if( !g_native_lock_init ) {
+    INIT_CRITICAL_SECTION( &g_native_lock.lock );
+    g_native_lock_init = true;
+  }
+  int ret = 0;
+  SYNCHRONIZE_ON( g_native_lock ) {
+    if( g_native_map == NULL ) {
+      if( (g_native_map = iMapping.NewIntegerMap( &g_native_map_dyn, "vgxserver_native_plugin.dyn" )) == NULL ) {
+        ret = -1;
+      }
+      else {
+        ret = 1;
+      }
+    }
+  } RELEASE;
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN void vgx_server_plugin__native_clear( void ) {
+  if( !g_native_lock_init ) {
+    return;
+  }
+  SYNCHRONIZE_ON( g_native_lock ) {
+    if( g_native_map ) {
+      iMapping.DeleteIntegerMap( &g_native_map, &g_native_map_dyn );
+      iFramehash.dynamic.ClearDynamic( &g_native_map_dyn );
+    }
+    while( g_native_entries ) {
+      __native_plugin_t *entry = g_native_entries;
+      g_native_entries = entry->next;
+      iString.Discard( &entry->CSTR__library );
+      free( entry );
+    }
+    g_native_count = 0;
+  } RELEASE;
+}
+
+
+
+/*******************************************************************//**
+ * Load native plugin library and register all plugins it defines
+ *
+ * Returns the number of plugins registered, or -1 on error.
+ ***********************************************************************
+ */
+DLL_HIDDEN int vgx_server_plugin__native_load( const char *path, vgx_Graph_t *graph, vgx_StringList_t **names, CString_t **CSTR__error ) {
+  int n = 0;
+
+  SYNCHRONIZE_ON( g_native_lock ) {
+    // Entries registered by this call are those added in front of this one
+    __native_plugin_t *loaded = g_native_entries;
+
+    XTRY {
+      if( g_native_map == NULL ) {
+        __set_error_string( CSTR__error, "plugin registry not initialized" );
+        THROW_SILENT( CXLIB_ERR_INITIALIZATION, 0x001 );
+      }
+
+      // Load library (libraries are never unloaded)
+      __native_library_t library = __native_library_open( path );
+      if( library == NULL ) {
+        __format_error_string( CSTR__error, "%s", __native_library_error() );
+        THROW_SILENT( CXLIB_ERR_GENERAL, 0x002 );
+      }
+
+      f_vgx_NativePluginInit initf = (f_vgx_NativePluginInit)__native_library_symbol( library, VGX_NATIVE_PLUGIN_ENTRYPOINT );
+      if( initf == NULL ) {
+        __format_error_string( CSTR__error, "%s: missing entrypoint %s()", path, VGX_NATIVE_PLUGIN_ENTRYPOINT );
+        THROW_SILENT( CXLIB_ERR_API, 0x003 );
+      }
+
+      const vgx_NativePlugin_t *defs = initf( VGX_NATIVE_PLUGIN_ABI_VERSION );
+      if( defs == NULL ) {
+        __format_error_string( CSTR__error, "%s: plugin ABI version %d not supported by library", path, VGX_NATIVE_PLUGIN_ABI_VERSION );
+        THROW_SILENT( CXLIB_ERR_API, 0x004 );
+      }
+
+      // Validate all definitions before registering any
+      for( const vgx_NativePlugin_t *def = defs; def->name != NULL; ++def ) {
+        if( !__plugin__valid_native_name( def->name ) ) {
+          __format_error_string( CSTR__error, "%s: invalid plugin name '%s'", path, def->name );
+          THROW_SILENT( CXLIB_ERR_API, 0x005 );
+        }
+        if( def->call == NULL ) {
+          __format_error_string( CSTR__error, "%s: plugin '%s' has no function", path, def->name );
+          THROW_SILENT( CXLIB_ERR_API, 0x006 );
+        }
+        if( __plugin__get_native_CS( def->name ) == NULL && vgx_server_resource__get_plugin_phases( def->name ) ) {
+          __format_error_string( CSTR__error, "%s: plugin name '%s' already in use", path, def->name );
+          THROW_SILENT( CXLIB_ERR_API, 0x007 );
+        }
+      }
+
+      if( names && *names == NULL && (*names = iString.List.New( NULL, 0 )) == NULL ) {
+        THROW_ERROR( CXLIB_ERR_MEMORY, 0x008 );
+      }
+
+      // Register
+      for( const vgx_NativePlugin_t *def = defs; def->name != NULL; ++def ) {
+        __native_plugin_t *entry = calloc( 1, sizeof( __native_plugin_t ) );
+        if( entry == NULL ) {
+          THROW_ERROR( CXLIB_ERR_MEMORY, 0x009 );
+        }
+        entry->next = g_native_entries;
+        g_native_entries = entry;
+        entry->def = def;
+        entry->replaced = __plugin__get_native_CS( def->name );
+        if( graph ) {
+          idcpy( &entry->graph_obid, &graph->obid );
+          entry->bound = true;
+        }
+        if( (entry->CSTR__library = CStringNew( path )) == NULL ) {
+          THROW_ERROR( CXLIB_ERR_MEMORY, 0x00A );
+        }
+        if( iMapping.IntegerMapAdd( &g_native_map, &g_native_map_dyn, def->name, (int64_t)(uintptr_t)entry ) < 0 ) {
+          THROW_ERROR( CXLIB_ERR_MEMORY, 0x00B );
+        }
+        if( entry->replaced == NULL ) {
+          ++g_native_count;
+        }
+        // Register plugin existence with server core
+        if( vgx_server_resource__add_plugin( def->name, VGX_SERVER_PLUGIN_PHASE__EXEC ) < 0 ) {
+          THROW_ERROR( CXLIB_ERR_MEMORY, 0x00C );
+        }
+        if( names && iString.List.Append( *names, def->name ) == NULL ) {
+          THROW_ERROR( CXLIB_ERR_MEMORY, 0x00D );
+        }
+        ++n;
+      }
+    }
+    XCATCH( errcode ) {
+      // Unregister plugins from this library in reverse order, restoring
+      // any plugins they replaced. No executor can have picked up these
+      // entries without holding the lock so they are freed.
+      while( g_native_entries != loaded ) {
+        __native_plugin_t *entry = g_native_entries;
+        const char *name = entry->def->name;
+        if( __plugin__get_native_CS( name ) == entry ) {
+          if( entry->replaced ) {
+            iMapping.IntegerMapAdd( &g_native_map, &g_native_map_dyn, name, (int64_t)(uintptr_t)entry->replaced );
+          }
+          else {
+            iMapping.IntegerMapDel( &g_native_map, &g_native_map_dyn, name );
+            vgx_server_resource__del_plugin( name );
+            --g_native_count;
+          }
+        }
+        g_native_entries = entry->next;
+        iString.Discard( &entry->CSTR__library );
+        free( entry );
+      }
+      if( CSTR__error && *CSTR__error == NULL ) {
+        __set_error_string( CSTR__error, "internal error" );
+      }
+      n = -1;
+    }
+    XFINALLY {
+    }
+  } RELEASE;
+
+  return n;
+}
+
+
+
+/*******************************************************************//**
+ *
+ * Returns:  1 : removed
+ *           0 : not a native plugin
+ ***********************************************************************
+ */
+DLL_HIDDEN int vgx_server_plugin__native_remove( const char *plugin_name ) {
+  int ret = 0;
+  if( !g_native_lock_init ) {
+    return 0;
+  }
+  SYNCHRONIZE_ON( g_native_lock ) {
+    if( __plugin__get_native_CS( plugin_name ) ) {
+      iMapping.IntegerMapDel( &g_native_map, &g_native_map_dyn, plugin_name );
+      vgx_server_resource__del_plugin( plugin_name );
+      --g_native_count;
+      ret = 1;
+    }
+  } RELEASE;
+  return ret;
+}
+
+
+
+/*******************************************************************//**
+ * Return names of all registered native plugins
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN vgx_StringList_t * vgx_server_plugin__native_list( void ) {
+  vgx_StringList_t *names = iString.List.New( NULL, 0 );
+  if( names == NULL || !g_native_lock_init ) {
+    return names;
+  }
+  SYNCHRONIZE_ON( g_native_lock ) {
+    // Entries are kept after removal, list only those still registered
+    for( __native_plugin_t *entry = g_native_entries; entry != NULL; entry = entry->next ) {
+      if( __plugin__get_native_CS( entry->def->name ) == entry ) {
+        if( iString.List.Append( names, entry->def->name ) == NULL ) {
+          iString.List.Discard( &names );
+          break;
+        }
+      }
+    }
+  } RELEASE;
+  return names;
+}
+
+
+
+/*******************************************************************//**
+ *
+ *
+ ***********************************************************************
+ */
+DLL_HIDDEN const vgx_NativePlugin_t * vgx_server_plugin__native_get( const char *plugin_name, CString_t **CSTR__library, vgx_Graph_t **graph ) {
+  const vgx_NativePlugin_t *def = NULL;
+  if( g_native_count == 0 ) {
+    return NULL;
+  }
+  SYNCHRONIZE_ON( g_native_lock ) {
+    __native_plugin_t *entry = __plugin__get_native_CS( plugin_name );
+    if( entry ) {
+      def = entry->def;
+      if( CSTR__library ) {
+        *CSTR__library = CStringClone( entry->CSTR__library );
+      }
+      if( graph ) {
+        *graph = entry->bound ? igraphfactory.GetGraphByObid( &entry->graph_obid ) : NULL;
+      }
+    }
+  } RELEASE;
+  return def;
+}
+
+
+
+/*******************************************************************//**
+ * Call native plugin
+ *
+ * Returns:  1 : plugin executed
+ *           0 : no native plugin by this name
+ *          -1 : error, response prepared with error message
+ ***********************************************************************
+ */
+DLL_HIDDEN int vgx_server_plugin__native_call( const char *plugin_name, vgx_URIQueryParameters_t *params, vgx_VGXServerRequest_t *request, vgx_VGXServerResponse_t *response, CString_t **CSTR__error ) {
+  // No lock needed to find out there are no native plugins
+  if( g_native_count == 0 ) {
+    return 0;
+  }
+
+  f_vgx_NativePluginCall callf = NULL;
+  vgx_Graph_t *graph = NULL;
+  bool bound = false;
+  SYNCHRONIZE_ON( g_native_lock ) {
+    __native_plugin_t *entry = __plugin__get_native_CS( plugin_name );
+    if( entry ) {
+      callf = entry->def->call;
+      if( (bound = entry->bound) == true ) {
+        graph = igraphfactory.GetGraphByObid( &entry->graph_obid );
+      }
+    }
+  } RELEASE;
+
+  if( callf == NULL ) {
+    return 0;
+  }
+
+  if( bound && graph == NULL ) {
+    response->info.http_errcode = HTTP_STATUS__ServiceUnavailable;
+    __format_error_string( CSTR__error, "graph bound to plugin '%s' no longer exists", plugin_name );
+  }
+  else if( callf( graph, params, request, response, CSTR__error ) >= 0 ) {
+    response->info.execution.complete = true;
+    response->info.execution.nometas = 1;
+    return 1;
+  }
+
+  if( !response->info.http_errcode ) {
+    response->info.http_errcode = HTTP_STATUS__InternalServerError;
+  }
+  if( CSTR__error && *CSTR__error == NULL ) {
+    __format_error_string( CSTR__error, "plugin '%s' failed", plugin_name );
+  }
+  vgx_server_response__prepare_body_error( response, CSTR__error ? *CSTR__error : NULL );
+  return -1;
+}
@@ -525,12 +525,14 @@ static vgx_HTTPHeaders_t * __new_headers_object( void ) {
 
     headers->control.bypass_sout = 0;
     headers->control.resubmit = false;
-    headers->control._rsv_2_7_1_3 = 0;
+    headers->control.priority = VGX_SERVER_REQUEST_PRIORITY__DEFAULT;
     headers->control._rsv_2_7_1_4 = 0;
 
     headers->nresubmit = 0;
 
-    headers->__rsv_2_8 = 0;
+    headers->deadline_ms = 0;
+
+    headers->__rsv_2_8_2 = 0;
   }
   XCATCH( errcode ) {
     __delete_headers_object( &headers );
@@ -593,7 +595,9 @@ static void __clear_request_headers( vgx_VGXServerRequest_t *request ) {
   headers->flag.__bits = 0;
   headers->control.bypass_sout = 0;
   headers->control.resubmit = false;
+  headers->control.priority = VGX_SERVER_REQUEST_PRIORITY__DEFAULT;
   headers->nresubmit = 0;
+  headers->deadline_ms = 0;
   DESTROY_HEADERS_CAPSULE( &headers->capsule );
 }
 
@@ -636,6 +640,10 @@ static void __copy_headers( vgx_HTTPHeaders_t *dest, const vgx_HTTPHeaders_t *sr
 
   // Request user flags
   dest->flag.__bits = src->flag.__bits;
+
+  // Admission control
+  dest->control.priority = src->control.priority;
+  dest->deadline_ms = src->deadline_ms;
 }
 
 
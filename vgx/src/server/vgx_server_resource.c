@@ -204,6 +204,9 @@ DLL_HIDDEN void vgx_server_resource__clear( void ) {
  */
 static framehash_cell_t *g_plugin_map = NULL;
 static framehash_dynamic_t g_plugin_map_dyn = {0};
+static framehash_cell_t *g_admission_map = NULL;
+static framehash_dynamic_t g_admission_map_dyn = {0};
+static int64_t g_admission_count = 0;
 
 
 
@@ -237,11 +240,70 @@ DLL_HIDDEN int vgx_server_resource__add_plugin( const char *plugin_name, vgx_ser
  ******************************************************************************
  */
 DLL_HIDDEN int vgx_server_resource__del_plugin( const char *plugin_name ) {
+  vgx_server_resource__set_plugin_admission( plugin_name, 0, VGX_SERVER_REQUEST_PRIORITY__DEFAULT );
   return iMapping.IntegerMapDel( &g_plugin_map, &g_plugin_map_dyn, plugin_name );
 }
 
 
 
+/******************************************************************************
+ * Set default deadline and priority for requests to plugin when not given
+ * by request headers. Zero deadline and default priority removes defaults.
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN int vgx_server_resource__set_plugin_admission( const char *plugin_name, int deadline_ms, vgx_server_request_priority priority ) {
+  if( g_admission_map == NULL || deadline_ms < 0 ) {
+    return -1;
+  }
+  int64_t x = 0;
+  bool exists = iMapping.IntegerMapGet( g_admission_map, &g_admission_map_dyn, plugin_name, &x ) != 0;
+  if( deadline_ms == 0 && priority == VGX_SERVER_REQUEST_PRIORITY__DEFAULT ) {
+    if( exists ) {
+      iMapping.IntegerMapDel( &g_admission_map, &g_admission_map_dyn, plugin_name );
+      --g_admission_count;
+    }
+    return 0;
+  }
+  x = ((int64_t)deadline_ms << 8) | (uint8_t)priority;
+  if( iMapping.IntegerMapAdd( &g_admission_map, &g_admission_map_dyn, plugin_name, x ) < 0 ) {
+    return -1;
+  }
+  if( !exists ) {
+    ++g_admission_count;
+  }
+  return 1;
+}
+
+
+
+/******************************************************************************
+ * Apply plugin's default deadline and priority to request unless already
+ * specified by request headers
+ *
+ ******************************************************************************
+ */
+DLL_HIDDEN void vgx_server_resource__apply_plugin_admission( vgx_VGXServer_t *server, vgx_VGXServerRequest_t *request ) {
+  vgx_HTTPHeaders_t *headers = request->headers;
+  if( g_admission_count == 0 || (headers->deadline_ms > 0 && headers->control.priority != VGX_SERVER_REQUEST_PRIORITY__DEFAULT) ) {
+    return;
+  }
+  vgx_server_pathspec_t pathspec;
+  const char *plugin_name = vgx_server_resource__plugin_name( vgx_server_resource__init_pathspec( &pathspec, server, request ) );
+  int64_t x = 0;
+  if( plugin_name == NULL || !iMapping.IntegerMapGet( g_admission_map, &g_admission_map_dyn, plugin_name, &x ) ) {
+    return;
+  }
+  if( headers->deadline_ms == 0 ) {
+    headers->deadline_ms = (int)(x >> 8);
+  }
+  if( headers->control.priority == VGX_SERVER_REQUEST_PRIORITY__DEFAULT ) {
+    headers->control.priority = (int8_t)(x & 0xFF);
+  }
+}
+
+
+
 /******************************************************************************
  *
  *
@@ -300,6 +362,13 @@ DLL_HIDDEN int vgx_server_resource__plugin_init( void ) {
   if( (g_plugin_map = __resource__new_plugin_map( &g_plugin_map_dyn )) == NULL ) { 
     return -1; // error
   }
+  if( (g_admission_map = __resource__new_plugin_map( &g_admission_map_dyn )) == NULL ) { 
+    return -1; // error
+  }
+  g_admission_count = 0;
+  if( vgx_server_plugin__native_init() < 0 ) {
+    return -1; // error
+  }
   return 1; // initialized ok
 }
 
@@ -311,6 +380,12 @@ DLL_HIDDEN int vgx_server_resource__plugin_init( void ) {
  ******************************************************************************
  */
 DLL_HIDDEN void vgx_server_resource__plugin_clear( void ) {
+  vgx_server_plugin__native_clear();
+  if( g_admission_map ) {
+    iMapping.DeleteIntegerMap( &g_admission_map, &g_admission_map_dyn );
+    iFramehash.dynamic.ClearDynamic( &g_admission_map_dyn );
+    g_admission_count = 0;
+  }
   if( g_plugin_map ) {
     iMapping.DeleteIntegerMap( &g_plugin_map, &g_plugin_map_dyn );
     iFramehash.dynamic.ClearDynamic( &g_plugin_map_dyn );
@@ -727,6 +802,13 @@ DLL_HIDDEN int  vgx_server_resource__call( vgx_VGXServer_t *server, vgx_URIQuery
 
     // Call plugin
     response->info.execution.plugin = true;
+
+    // Native plugins run directly on the executor thread
+    int native = vgx_server_plugin__native_call( plugin_name, params, request, response, CSTR__error );
+    if( native != 0 ) {
+      return native < 0 ? -1 : 0;
+    }
+
     return server->resource.pluginf( plugin_name, false, params, request, response, CSTR__error );
   }
 
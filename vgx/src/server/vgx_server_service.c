@@ -78,7 +78,14 @@ DLL_EXPORT vgx_IVGXServer_t iVGXServer = {
       .Clear              = vgx_server_resource__plugin_clear,
       .Register           = vgx_server_resource__add_plugin,
       .Unregister         = vgx_server_resource__del_plugin,
-      .IsRegistered       = vgx_server_resource__get_plugin_phases
+      .IsRegistered       = vgx_server_resource__get_plugin_phases,
+      .SetAdmission       = vgx_server_resource__set_plugin_admission,
+      .Native = {
+        .Load             = vgx_server_plugin__native_load,
+        .Remove           = vgx_server_plugin__native_remove,
+        .List             = vgx_server_plugin__native_list,
+        .Get              = vgx_server_plugin__native_get
+      }
     }
   },
 
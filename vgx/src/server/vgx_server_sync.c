@@ -34,8 +34,8 @@ SET_EXCEPTION_MODULE( COMLIB_MSG_MOD_VGX_GRAPH );
 
 static int              __sync__get_keyval_string( const vgx_KeyVal_t *kv, const char **value, CString_t **CSTR__error );
 static int              __sync__get_keyval_integer( const vgx_KeyVal_t *kv, int64_t *value, CString_t **CSTR__error );
-static CString_t *      __sync__subscribe_new_URI_string( vgx_URIQueryParameters_t *params, int *timeout_ms, bool *hardsync, CString_t **CSTR__error );
-static int              __sync__start_subscriber_synchronizer( vgx_Graph_t *SYSTEM, CString_t **CSTR__new_subscriber_uri, vgx_StringList_t **subscribers_URIs, bool sync_hard, bool resume_tx_input );
+static CString_t *      __sync__subscribe_new_URI_string( vgx_URIQueryParameters_t *params, int *timeout_ms, bool *hardsync, bool *snapshot, CString_t **CSTR__error );
+static int              __sync__start_subscriber_synchronizer( vgx_Graph_t *SYSTEM, CString_t **CSTR__new_subscriber_uri, vgx_StringList_t **subscribers_URIs, bool sync_hard, bool sync_snapshot, bool resume_tx_input );
 
 DECLARE_COMLIB_TASK(    __sync__task_synchronize_new_subscriber );
 
@@ -102,7 +102,7 @@ static int __sync__get_keyval_integer( const vgx_KeyVal_t *kv, int64_t *value, C
  *
  ***********************************************************************
  */
-static CString_t * __sync__subscribe_new_URI_string( vgx_URIQueryParameters_t *params, int *timeout_ms, bool *hardsync, CString_t **CSTR__error ) {
+static CString_t * __sync__subscribe_new_URI_string( vgx_URIQueryParameters_t *params, int *timeout_ms, bool *hardsync, bool *snapshot, CString_t **CSTR__error ) {
   CString_t *CSTR__uri = NULL;
 
   XTRY {
@@ -128,6 +128,16 @@ static CString_t * __sync__subscribe_new_URI_string( vgx_URIQueryParameters_t *p
           *hardsync = true;
         }
       }
+      // snapshot
+      else if( CharsEqualsConst( kv->key, "snapshot" ) ) {
+        int64_t i;
+        if( __sync__get_keyval_integer( kv, &i, CSTR__error ) < 0 ) { 
+          THROW_SILENT( CXLIB_ERR_API, 0x008 );
+        }
+        if( i > 0 ) {
+          *snapshot = true;
+        }
+      }
       // timeout
       else if( CharsEqualsConst( kv->key, "timeout" ) ) {
         int64_t i;
@@ -219,7 +229,14 @@ BEGIN_COMLIB_TASK( self,
       // 
       // --------------------------------------------------
       XTRY {
-        if( igraphfactory.SyncAllGraphs( synchronizer->sync_hard, timeout_ms, &CSTR__error ) != 0 ) {
+        // Snapshot: transfer persisted graph files for restore by subscriber
+        if( synchronizer->sync_snapshot ) {
+          if( igraphfactory.SyncAllGraphsSnapshot( timeout_ms, &CSTR__error ) != 0 ) {
+            THROW_ERROR( CXLIB_ERR_GENERAL, 0x002 );
+          }
+        }
+        // Replay all graph objects as operations
+        else if( igraphfactory.SyncAllGraphs( synchronizer->sync_hard, timeout_ms, &CSTR__error ) != 0 ) {
           THROW_ERROR( CXLIB_ERR_GENERAL, 0x002 );
         }
 
@@ -296,7 +313,7 @@ BEGIN_COMLIB_TASK( self,
  *
  ***********************************************************************
  */
-static int __sync__start_subscriber_synchronizer( vgx_Graph_t *SYSTEM, CString_t **CSTR__new_subscriber_uri, vgx_StringList_t **subscribers_URIs, bool sync_hard, bool resume_tx_input ) {
+static int __sync__start_subscriber_synchronizer( vgx_Graph_t *SYSTEM, CString_t **CSTR__new_subscriber_uri, vgx_StringList_t **subscribers_URIs, bool sync_hard, bool sync_snapshot, bool resume_tx_input ) {
   int ret = -1;
   vgx_SubscriberSynchronizer_t *synchronizer = NULL;
   // Allocate
@@ -307,6 +324,9 @@ static int __sync__start_subscriber_synchronizer( vgx_Graph_t *SYSTEM, CString_t
     // Hard sync requested by subscriber
     synchronizer->sync_hard = sync_hard;
 
+    // Snapshot sync requested by subscriber
+    synchronizer->sync_snapshot = sync_snapshot;
+
     // Resume transaction input after synchronization completes
     synchronizer->resume_tx_input = resume_tx_input;
 
@@ -368,8 +388,9 @@ DLL_HIDDEN int vgx_server_sync__subscribe_and_sync( vgx_Graph_t *SYSTEM, vgx_URI
 
   int timeout_ms = 10000;
   bool hardsync = false;
+  bool snapshot = false;
   // Get the operation destination URI for the new subscriber
-  CString_t *CSTR__new_subscriber_uri = __sync__subscribe_new_URI_string( params, &timeout_ms, &hardsync, CSTR__error );
+  CString_t *CSTR__new_subscriber_uri = __sync__subscribe_new_URI_string( params, &timeout_ms, &hardsync, &snapshot, CSTR__error );
   if( CSTR__new_subscriber_uri == NULL ) {
     return -1;
   }
@@ -446,7 +467,7 @@ DLL_HIDDEN int vgx_server_sync__subscribe_and_sync( vgx_Graph_t *SYSTEM, vgx_URI
       // Now hand the job over to a new thread and respond to 
       // subscriber that sync is in progress and should complete
       // on its own some time in the future.
-      if (__sync__start_subscriber_synchronizer( SYSTEM, &CSTR__new_subscriber_uri, &subscribers_URIs, hardsync, tx_input_suspended_here ) < 0 ) {
+      if (__sync__start_subscriber_synchronizer( SYSTEM, &CSTR__new_subscriber_uri, &subscribers_URIs, hardsync, snapshot, tx_input_suspended_here ) < 0 ) {
         THROW_ERROR( CXLIB_ERR_GENERAL, 0x006 );
       }
 
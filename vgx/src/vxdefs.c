@@ -299,6 +299,8 @@ DLL_EXPORT const vgx_PropertyConditionSet_t DEFAULT_VGX_PROPERTY_CONDITION_SET =
       },                                        \
       .degree_condition       = NULL,           \
       .timestamp_condition    = NULL,           \
+      .geo_condition          = NULL,           \
+      .text_condition         = NULL,           \
       .similarity_condition   = NULL,           \
       .property_condition_set = NULL,           \
       .recursive = {                            \